@@ -32,7 +32,13 @@
 #include "testing_axpy.hpp"
 #include "testing_axpy_batched.hpp"
 #include "testing_axpy_batched_ex.hpp"
+#include "testing_axpy_dot.hpp"
+#include "testing_axpy_dot_batched.hpp"
+#include "testing_axpy_dot_strided_batched.hpp"
 #include "testing_axpy_ex.hpp"
+#include "testing_axpy_nrm2.hpp"
+#include "testing_axpy_nrm2_batched.hpp"
+#include "testing_axpy_nrm2_strided_batched.hpp"
 #include "testing_axpy_strided_batched.hpp"
 #include "testing_axpy_strided_batched_ex.hpp"
 #include "testing_copy.hpp"
@@ -42,6 +48,9 @@
 #include "testing_dot_batched.hpp"
 #include "testing_dot_batched_ex.hpp"
 #include "testing_dot_ex.hpp"
+#include "testing_dot_nrm2.hpp"
+#include "testing_dot_nrm2_batched.hpp"
+#include "testing_dot_nrm2_strided_batched.hpp"
 #include "testing_dot_strided_batched.hpp"
 #include "testing_dot_strided_batched_ex.hpp"
 #include "testing_iamax_iamin.hpp"
@@ -83,6 +92,8 @@
 #include "testing_gbmv_strided_batched.hpp"
 #include "testing_gemv.hpp"
 #include "testing_gemv_batched.hpp"
+#include "testing_gemv_grouped.hpp"
+#include "testing_gemv_multi.hpp"
 #include "testing_gemv_strided_batched.hpp"
 #include "testing_ger.hpp"
 #include "testing_ger_batched.hpp"
@@ -146,6 +157,7 @@
 #include "testing_trmv_strided_batched.hpp"
 #include "testing_trsv.hpp"
 #include "testing_trsv_batched.hpp"
+#include "testing_trsv_inverse_cache.hpp"
 #include "testing_trsv_strided_batched.hpp"
 // blas3 with no tensile
 #include "testing_dgmm.hpp"
@@ -204,16 +216,23 @@ void run_function(const func_map& map, const Arguments& arg, const std::string&
 #include "testing_gemm.hpp"
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
+#include "testing_gemm_epilogue.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_grouped.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
+#include "testing_rank_update_deferred.hpp"
 #include "testing_trmm.hpp"
 #include "testing_trmm_batched.hpp"
+#include "testing_trmm_outofplace.hpp"
+#include "testing_trmm_outofplace_batched.hpp"
+#include "testing_trmm_outofplace_strided_batched.hpp"
 #include "testing_trmm_strided_batched.hpp"
 #include "testing_trsm.hpp"
 #include "testing_trsm_batched.hpp"
 #include "testing_trsm_batched_ex.hpp"
 #include "testing_trsm_ex.hpp"
+#include "testing_trsm_inverse_cache.hpp"
 #include "testing_trsm_strided_batched.hpp"
 #include "testing_trsm_strided_batched_ex.hpp"
 #include "testing_trtri.hpp"
@@ -241,6 +260,7 @@ struct perf_gemm_ex<Ti,
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex<Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex<Ti, To, Tc>},
+            {"gemm_epilogue", testing_gemm_epilogue<Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -271,6 +291,29 @@ struct perf_gemm_strided_batched_ex<
     }
 };
 
+// Template to dispatch testing_gemm_epilogue_dequantize for performance tests
+// When To is not a real type of D for an int8 gemm, the test is marked invalid
+template <typename To, typename = void>
+struct perf_gemm_dequantize : rocblas_test_invalid
+{
+};
+
+template <typename To>
+struct perf_gemm_dequantize<To,
+                            std::enable_if_t<std::is_same<To, float>{}
+                                             || std::is_same<To, rocblas_half>{}
+                                             || std::is_same<To, rocblas_bfloat16>{}>>
+    : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_epilogue_dequantize", testing_gemm_epilogue_dequantize<To>},
+        };
+        run_function(map, arg);
+    }
+};
+
 #endif // BUILD_WITH_TENSILE
 
 template <typename T, typename U = T, typename = void>
@@ -320,6 +363,15 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"swap", testing_swap<T>},
                 {"swap_batched", testing_swap_batched<T>},
                 {"swap_strided_batched", testing_swap_strided_batched<T>},
+                {"dot_nrm2", testing_dot_nrm2<T>},
+                {"dot_nrm2_batched", testing_dot_nrm2_batched<T>},
+                {"dot_nrm2_strided_batched", testing_dot_nrm2_strided_batched<T>},
+                {"axpy_dot", testing_axpy_dot<T>},
+                {"axpy_dot_batched", testing_axpy_dot_batched<T>},
+                {"axpy_dot_strided_batched", testing_axpy_dot_strided_batched<T>},
+                {"axpy_nrm2", testing_axpy_nrm2<T>},
+                {"axpy_nrm2_batched", testing_axpy_nrm2_batched<T>},
+                {"axpy_nrm2_strided_batched", testing_axpy_nrm2_strided_batched<T>},
                 // L2
                 {"gbmv", testing_gbmv<T>},
                 {"gbmv_batched", testing_gbmv_batched<T>},
@@ -330,6 +382,8 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"gemv", testing_gemv<T>},
                 {"gemv_batched", testing_gemv_batched<T>},
                 {"gemv_strided_batched", testing_gemv_strided_batched<T>},
+                {"gemv_multi", testing_gemv_multi<T>},
+                {"gemv_grouped", testing_gemv_grouped<T>},
                 {"ger", testing_ger<T, false>},
                 {"ger_batched", testing_ger_batched<T, false>},
                 {"ger_strided_batched", testing_ger_strided_batched<T, false>},
@@ -385,25 +439,34 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
                 {"trsv", testing_trsv<T>},
                 {"trsv_batched", testing_trsv_batched<T>},
                 {"trsv_strided_batched", testing_trsv_strided_batched<T>},
+                {"trsv_inverse_cache", testing_trsv_inverse_cache<T>},
 #if BUILD_WITH_TENSILE
+                {"ger_deferred", testing_rank_update_deferred<T, rocblas_rank_update_test::ger>},
+                {"syr_deferred", testing_rank_update_deferred<T, rocblas_rank_update_test::syr>},
+                {"syr2_deferred", testing_rank_update_deferred<T, rocblas_rank_update_test::syr2>},
                 {"syrkx", testing_syr2k<T, false>},
                 {"syrkx_batched", testing_syr2k_batched<T, false>},
                 {"syrkx_strided_batched", testing_syr2k_strided_batched<T, false>},
                 {"trmm", testing_trmm<T>},
                 {"trmm_batched", testing_trmm_batched<T>},
                 {"trmm_strided_batched", testing_trmm_strided_batched<T>},
+                {"trmm_outofplace", testing_trmm_outofplace<T>},
+                {"trmm_outofplace_batched", testing_trmm_outofplace_batched<T>},
+                {"trmm_outofplace_strided_batched", testing_trmm_outofplace_strided_batched<T>},
                 {"trtri", testing_trtri<T>},
                 {"trtri_batched", testing_trtri_batched<T>},
                 {"trtri_strided_batched", testing_trtri_strided_batched<T>},
                 {"gemm", testing_gemm<T>},
                 {"gemm_batched", testing_gemm_batched<T>},
                 {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+                {"gemm_grouped", testing_gemm_grouped<T>},
                 {"trsm", testing_trsm<T>},
                 {"trsm_ex", testing_trsm_ex<T>},
                 {"trsm_batched", testing_trsm_batched<T>},
                 {"trsm_batched_ex", testing_trsm_batched_ex<T>},
                 {"trsm_strided_batched", testing_trsm_strided_batched<T>},
                 {"trsm_strided_batched_ex", testing_trsm_strided_batched_ex<T>},
+                {"trsm_inverse_cache", testing_trsm_inverse_cache<T>},
 #endif
               };
         run_function(map, arg);
@@ -487,6 +550,15 @@ struct perf_blas<T,
                 {"swap", testing_swap<T>},
                 {"swap_batched", testing_swap_batched<T>},
                 {"swap_strided_batched", testing_swap_strided_batched<T>},
+                {"dot_nrm2", testing_dot_nrm2<T>},
+                {"dot_nrm2_batched", testing_dot_nrm2_batched<T>},
+                {"dot_nrm2_strided_batched", testing_dot_nrm2_strided_batched<T>},
+                {"axpy_dot", testing_axpy_dot<T>},
+                {"axpy_dot_batched", testing_axpy_dot_batched<T>},
+                {"axpy_dot_strided_batched", testing_axpy_dot_strided_batched<T>},
+                {"axpy_nrm2", testing_axpy_nrm2<T>},
+                {"axpy_nrm2_batched", testing_axpy_nrm2_batched<T>},
+                {"axpy_nrm2_strided_batched", testing_axpy_nrm2_strided_batched<T>},
                 // L2
                 {"gbmv", testing_gbmv<T>},
                 {"gbmv_batched", testing_gbmv_batched<T>},
@@ -494,6 +566,8 @@ struct perf_blas<T,
                 {"gemv", testing_gemv<T>},
                 {"gemv_batched", testing_gemv_batched<T>},
                 {"gemv_strided_batched", testing_gemv_strided_batched<T>},
+                {"gemv_multi", testing_gemv_multi<T>},
+                {"gemv_grouped", testing_gemv_grouped<T>},
                 {"geru", testing_ger<T, false>},
                 {"geru_batched", testing_ger_batched<T, false>},
                 {"geru_strided_batched", testing_ger_strided_batched<T, false>},
@@ -579,7 +653,14 @@ struct perf_blas<T,
                 {"trsv", testing_trsv<T>},
                 {"trsv_batched", testing_trsv_batched<T>},
                 {"trsv_strided_batched", testing_trsv_strided_batched<T>},
+                {"trsv_inverse_cache", testing_trsv_inverse_cache<T>},
 #if BUILD_WITH_TENSILE
+                {"geru_deferred", testing_rank_update_deferred<T, rocblas_rank_update_test::ger>},
+                {"gerc_deferred", testing_rank_update_deferred<T, rocblas_rank_update_test::gerc>},
+                {"her_deferred", testing_rank_update_deferred<T, rocblas_rank_update_test::her>},
+                {"her2_deferred", testing_rank_update_deferred<T, rocblas_rank_update_test::her2>},
+                {"syr_deferred", testing_rank_update_deferred<T, rocblas_rank_update_test::syr>},
+                {"syr2_deferred", testing_rank_update_deferred<T, rocblas_rank_update_test::syr2>},
                 {"syrkx", testing_syr2k<T, false>},
                 {"syrkx_batched", testing_syr2k_batched<T, false>},
                 {"syrkx_strided_batched", testing_syr2k_strided_batched<T, false>},
@@ -589,15 +670,20 @@ struct perf_blas<T,
                 {"gemm", testing_gemm<T>},
                 {"gemm_batched", testing_gemm_batched<T>},
                 {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+                {"gemm_grouped", testing_gemm_grouped<T>},
                 {"trsm", testing_trsm<T>},
                 {"trsm_ex", testing_trsm_ex<T>},
                 {"trsm_batched", testing_trsm_batched<T>},
                 {"trsm_batched_ex", testing_trsm_batched_ex<T>},
                 {"trsm_strided_batched", testing_trsm_strided_batched<T>},
                 {"trsm_strided_batched_ex", testing_trsm_strided_batched_ex<T>},
+                {"trsm_inverse_cache", testing_trsm_inverse_cache<T>},
                 {"trmm", testing_trmm<T>},
                 {"trmm_batched", testing_trmm_batched<T>},
                 {"trmm_strided_batched", testing_trmm_strided_batched<T>},
+                {"trmm_outofplace", testing_trmm_outofplace<T>},
+                {"trmm_outofplace_batched", testing_trmm_outofplace_batched<T>},
+                {"trmm_outofplace_strided_batched", testing_trmm_outofplace_strided_batched<T>},
 #endif
               };
         run_function(map, arg);
@@ -998,7 +1084,8 @@ int run_bench_test(Arguments& arg, const std::string& filter, bool yaml = false)
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_epilogue") || !strcmp(function, "gemm_epilogue_dequantize"))
     {
         // adjust dimension for GEMM routines
         rocblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1032,7 +1119,10 @@ int run_bench_test(Arguments& arg, const std::string& filter, bool yaml = false)
                          << ", set batch_count = 1" << std::endl;
             arg.batch_count = 1;
         }
-        rocblas_gemm_dispatch<perf_gemm_ex>(arg);
+        if(!strcmp(function, "gemm_epilogue_dequantize"))
+            rocblas_gemm_dequantize_dispatch<perf_gemm_dequantize>(arg);
+        else
+            rocblas_gemm_dispatch<perf_gemm_ex>(arg);
     }
     else if(!strcmp(function, "gemm_strided_batched_ex"))
     {
@@ -1146,10 +1236,13 @@ try
     std::string initialization;
     std::string filter;
     rocblas_int device_id;
-    int         flags               = 0;
-    bool        datafile            = rocblas_parse_data(argc, argv);
-    bool        atomics_not_allowed = false;
-    bool        log_function_name   = false;
+    int         flags                  = 0;
+    bool        datafile               = rocblas_parse_data(argc, argv);
+    bool        atomics_not_allowed    = false;
+    bool        reduction_reproducible = false;
+    bool        accuracy_compensated   = false;
+    bool        packed_unpack          = false;
+    bool        log_function_name      = false;
 
     options_description desc("rocblas-bench command line options");
     desc.add_options()
@@ -1237,6 +1330,10 @@ try
          value<rocblas_int>(&arg.incb)->default_value(1),
          "increment between values in b vector")
 
+        ("incd",
+         value<rocblas_int>(&arg.incd)->default_value(1),
+         "increment between values in d vector, used as z in axpy_dot")
+
         ("alpha",
           value<double>(&arg.alpha)->default_value(1.0), "specifies the scalar alpha")
 
@@ -1338,6 +1435,18 @@ try
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
 
+        ("reduction_reproducible",
+         bool_switch(&reduction_reproducible)->default_value(false),
+         "Reductions use a fixed summation order giving bitwise reproducible results")
+
+        ("accuracy_compensated",
+         bool_switch(&accuracy_compensated)->default_value(false),
+         "dot, asum and nrm2 use compensated summation whose error does not grow with n")
+
+        ("packed_unpack",
+         bool_switch(&packed_unpack)->default_value(false),
+         "spmv, hpmv, tpmv and tpsv unpack AP in device memory and call symv, hemv, trmv and trsv")
+
         ("device",
          value<rocblas_int>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
@@ -1389,7 +1498,12 @@ try
     // transfer local variable state
 
     arg.atomics_mode = atomics_not_allowed ? rocblas_atomics_not_allowed : rocblas_atomics_allowed;
-    arg.flags        = rocblas_gemm_flags(flags);
+    arg.reduction_mode
+        = reduction_reproducible ? rocblas_reduction_reproducible : rocblas_reduction_default;
+    arg.accuracy_mode
+        = accuracy_compensated ? rocblas_accuracy_compensated : rocblas_accuracy_default;
+    arg.packed_mode = packed_unpack ? rocblas_packed_unpack : rocblas_packed_default;
+    arg.flags = rocblas_gemm_flags(flags);
     ArgumentModel_set_log_function_name(log_function_name);
 
     // Device Query
@@ -195,7 +195,7 @@ def setkey_product(test, key, vals):
     if all(x in test for x in vals):
         result = 1
         for x in vals:
-            if x in ('incx', 'incy'):
+            if x in ('incx', 'incy', 'incd'):
                 result *= abs(test[x])
             else:
                 result *= test[x]
@@ -224,6 +224,12 @@ def setdefaults(test):
         if all([x in test for x in ('stride_scale')]):
             test.setdefault('stride_c', int(test['stride_scale']) * 5)
 
+    elif test['function'] in ('dot_nrm2_strided_batched', 'axpy_dot_strided_batched',
+                              'axpy_nrm2_strided_batched'):
+        setkey_product(test, 'stride_x', ['N', 'incx', 'stride_scale'])
+        setkey_product(test, 'stride_y', ['N', 'incy', 'stride_scale'])
+        setkey_product(test, 'stride_d', ['N', 'incd', 'stride_scale'])
+
     elif test['function'] in ('tpmv_strided_batched'):
         setkey_product(test, 'stride_x', ['M', 'incx', 'stride_scale'])
 # Let's use M * M (> (M * (M+1)) / 2) as a 'stride' size for the packed format.
@@ -235,7 +241,8 @@ def setdefaults(test):
 
     elif test['function'] in ('gemv_strided_batched', 'gbmv_strided_batched',
                               'ger_strided_batched', 'geru_strided_batched',
-                              'gerc_strided_batched', 'trsv_strided_batched'):
+                              'gerc_strided_batched', 'trsv_strided_batched',
+                              'gemv_multi'):
         if test['function'] in ('ger_strided_batched', 'geru_strided_batched',
                                 'gerc_strided_batched', 'trsv_strided_batched'
                                 ) or test['transA'] in ('T', 'C'):
@@ -315,8 +322,11 @@ def setdefaults(test):
         else:
             setkey_product(test, 'stride_b', ['M', 'ldb', 'stride_scale'])
 
-    elif test['function'] in ('trmm_strided_batched'):
+    elif test['function'] in ('trmm_strided_batched',
+                              'trmm_outofplace_strided_batched'):
         setkey_product(test, 'stride_b', ['N', 'ldb', 'stride_scale'])
+        if 'ldc' in test:
+            setkey_product(test, 'stride_c', ['N', 'ldc', 'stride_scale'])
 
         if test['side'].upper() == 'L':
             setkey_product(test, 'stride_a', ['M', 'lda', 'stride_scale'])
@@ -264,6 +264,18 @@ rocblas_local_handle::rocblas_local_handle(const Arguments& arg)
     // Set the atomics mode
     auto status = rocblas_set_atomics_mode(m_handle, arg.atomics_mode);
 
+    // Set the reduction mode
+    if(status == rocblas_status_success)
+        status = rocblas_set_reduction_mode(m_handle, arg.reduction_mode);
+
+    // Set the accuracy mode
+    if(status == rocblas_status_success)
+        status = rocblas_set_accuracy_mode(m_handle, arg.accuracy_mode);
+
+    // Set the packed mode
+    if(status == rocblas_status_success)
+        status = rocblas_set_packed_mode(m_handle, arg.packed_mode);
+
     if(status == rocblas_status_success)
     {
         // If the test specifies user allocated workspace, allocate and use it
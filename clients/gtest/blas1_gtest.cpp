@@ -8,12 +8,21 @@
 #include "testing_asum_strided_batched.hpp"
 #include "testing_axpy.hpp"
 #include "testing_axpy_batched.hpp"
+#include "testing_axpy_dot.hpp"
+#include "testing_axpy_dot_batched.hpp"
+#include "testing_axpy_dot_strided_batched.hpp"
+#include "testing_axpy_nrm2.hpp"
+#include "testing_axpy_nrm2_batched.hpp"
+#include "testing_axpy_nrm2_strided_batched.hpp"
 #include "testing_axpy_strided_batched.hpp"
 #include "testing_copy.hpp"
 #include "testing_copy_batched.hpp"
 #include "testing_copy_strided_batched.hpp"
 #include "testing_dot.hpp"
 #include "testing_dot_batched.hpp"
+#include "testing_dot_nrm2.hpp"
+#include "testing_dot_nrm2_batched.hpp"
+#include "testing_dot_nrm2_strided_batched.hpp"
 #include "testing_dot_strided_batched.hpp"
 #include "testing_iamax_iamin.hpp"
 #include "testing_iamax_iamin_batched.hpp"
@@ -88,6 +97,15 @@ namespace
         rotmg,
         rotmg_batched,
         rotmg_strided_batched,
+        dot_nrm2,
+        dot_nrm2_batched,
+        dot_nrm2_strided_batched,
+        axpy_dot,
+        axpy_dot_batched,
+        axpy_dot_strided_batched,
+        axpy_nrm2,
+        axpy_nrm2_batched,
+        axpy_nrm2_strided_batched,
     };
 
     // ----------------------------------------------------------------------------
@@ -121,15 +139,22 @@ namespace
                     = (BLAS1 == blas1::dot || BLAS1 == blas1::dot_batched
                        || BLAS1 == blas1::dot_strided_batched || BLAS1 == blas1::dotc
                        || BLAS1 == blas1::dotc_batched || BLAS1 == blas1::dotc_strided_batched);
-                bool is_axpy  = (BLAS1 == blas1::axpy || BLAS1 == blas1::axpy_batched
-                                || BLAS1 == blas1::axpy_strided_batched);
-                bool is_scal  = (BLAS1 == blas1::scal || BLAS1 == blas1::scal_batched
+                bool is_dot_nrm2  = (BLAS1 == blas1::dot_nrm2 || BLAS1 == blas1::dot_nrm2_batched
+                                    || BLAS1 == blas1::dot_nrm2_strided_batched);
+                bool is_axpy_dot  = (BLAS1 == blas1::axpy_dot || BLAS1 == blas1::axpy_dot_batched
+                                    || BLAS1 == blas1::axpy_dot_strided_batched);
+                bool is_axpy_nrm2 = (BLAS1 == blas1::axpy_nrm2 || BLAS1 == blas1::axpy_nrm2_batched
+                                     || BLAS1 == blas1::axpy_nrm2_strided_batched);
+                bool is_axpy      = (BLAS1 == blas1::axpy || BLAS1 == blas1::axpy_batched
+                                || BLAS1 == blas1::axpy_strided_batched || is_axpy_dot
+                                || is_axpy_nrm2);
+                bool is_scal      = (BLAS1 == blas1::scal || BLAS1 == blas1::scal_batched
                                 || BLAS1 == blas1::scal_strided_batched);
-                bool is_rot   = (BLAS1 == blas1::rot || BLAS1 == blas1::rot_batched
+                bool is_rot       = (BLAS1 == blas1::rot || BLAS1 == blas1::rot_batched
                                || BLAS1 == blas1::rot_strided_batched);
-                bool is_rotg  = (BLAS1 == blas1::rotg || BLAS1 == blas1::rotg_batched
+                bool is_rotg      = (BLAS1 == blas1::rotg || BLAS1 == blas1::rotg_batched
                                 || BLAS1 == blas1::rotg_strided_batched);
-                bool is_rotmg = (BLAS1 == blas1::rotmg || BLAS1 == blas1::rotmg_batched
+                bool is_rotmg     = (BLAS1 == blas1::rotmg || BLAS1 == blas1::rotmg_batched
                                  || BLAS1 == blas1::rotmg_strided_batched);
                 bool is_batched
                     = (BLAS1 == blas1::nrm2_batched || BLAS1 == blas1::asum_batched
@@ -138,7 +163,9 @@ namespace
                        || BLAS1 == blas1::dotc_batched || BLAS1 == blas1::rot_batched
                        || BLAS1 == blas1::rotm_batched || BLAS1 == blas1::rotg_batched
                        || BLAS1 == blas1::iamax_batched || BLAS1 == blas1::iamin_batched
-                       || BLAS1 == blas1::rotmg_batched || BLAS1 == blas1::axpy_batched);
+                       || BLAS1 == blas1::rotmg_batched || BLAS1 == blas1::axpy_batched
+                       || BLAS1 == blas1::dot_nrm2_batched || BLAS1 == blas1::axpy_dot_batched
+                       || BLAS1 == blas1::axpy_nrm2_batched);
                 bool is_strided
                     = (BLAS1 == blas1::nrm2_strided_batched || BLAS1 == blas1::asum_strided_batched
                        || BLAS1 == blas1::scal_strided_batched
@@ -152,7 +179,10 @@ namespace
                        || BLAS1 == blas1::rotmg_strided_batched
                        || BLAS1 == blas1::iamax_strided_batched
                        || BLAS1 == blas1::iamin_strided_batched
-                       || BLAS1 == blas1::axpy_strided_batched);
+                       || BLAS1 == blas1::axpy_strided_batched
+                       || BLAS1 == blas1::dot_nrm2_strided_batched
+                       || BLAS1 == blas1::axpy_dot_strided_batched
+                       || BLAS1 == blas1::axpy_nrm2_strided_batched);
 
                 if((is_scal || is_rotg || is_rot) && arg.a_type != arg.b_type)
                     name << '_' << rocblas_datatype2string(arg.b_type);
@@ -177,19 +207,32 @@ namespace
                    || BLAS1 == blas1::copy_batched || is_dot || BLAS1 == blas1::swap
                    || BLAS1 == blas1::swap_batched || BLAS1 == blas1::swap_strided_batched || is_rot
                    || BLAS1 == blas1::rotm || BLAS1 == blas1::rotm_batched
-                   || BLAS1 == blas1::rotm_strided_batched)
+                   || BLAS1 == blas1::rotm_strided_batched || is_dot_nrm2)
                 {
                     name << '_' << arg.incy;
                 }
 
+                if(is_axpy_dot)
+                {
+                    name << '_' << arg.incd;
+                }
+
                 if(BLAS1 == blas1::swap_strided_batched || BLAS1 == blas1::copy_strided_batched
                    || BLAS1 == blas1::dot_strided_batched || BLAS1 == blas1::dotc_strided_batched
                    || BLAS1 == blas1::rot_strided_batched || BLAS1 == blas1::rotm_strided_batched
-                   || BLAS1 == blas1::axpy_strided_batched)
+                   || BLAS1 == blas1::axpy_strided_batched
+                   || BLAS1 == blas1::dot_nrm2_strided_batched
+                   || BLAS1 == blas1::axpy_dot_strided_batched
+                   || BLAS1 == blas1::axpy_nrm2_strided_batched)
                 {
                     name << '_' << arg.stride_y;
                 }
 
+                if(BLAS1 == blas1::axpy_dot_strided_batched)
+                {
+                    name << '_' << arg.stride_d;
+                }
+
                 if(BLAS1 == blas1::rotg_strided_batched)
                 {
                     name << '_' << arg.stride_a << '_' << arg.stride_b << '_' << arg.stride_c << '_'
@@ -329,7 +372,17 @@ namespace
             || ((BLAS1 == blas1::rotmg || BLAS1 == blas1::rotmg_batched
                  || BLAS1 == blas1::rotmg_strided_batched)
                 && std::is_same<To, Ti>{} && std::is_same<To, Tc>{}
-                && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}))>;
+                && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}))
+
+            || ((BLAS1 == blas1::dot_nrm2 || BLAS1 == blas1::dot_nrm2_batched
+                 || BLAS1 == blas1::dot_nrm2_strided_batched || BLAS1 == blas1::axpy_dot
+                 || BLAS1 == blas1::axpy_dot_batched || BLAS1 == blas1::axpy_dot_strided_batched
+                 || BLAS1 == blas1::axpy_nrm2 || BLAS1 == blas1::axpy_nrm2_batched
+                 || BLAS1 == blas1::axpy_nrm2_strided_batched)
+                && std::is_same<To, Ti>{} && std::is_same<To, Tc>{}
+                && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                    || std::is_same<Ti, rocblas_float_complex>{}
+                    || std::is_same<Ti, rocblas_double_complex>{}))>;
 
 // Creates tests for one of the BLAS 1 functions
 // ARG passes 1-3 template arguments to the testing_* function
@@ -420,5 +473,14 @@ namespace
     BLAS1_TESTING(rotmg, ARG1)
     BLAS1_TESTING(rotmg_batched, ARG1)
     BLAS1_TESTING(rotmg_strided_batched, ARG1)
+    BLAS1_TESTING(dot_nrm2, ARG1)
+    BLAS1_TESTING(dot_nrm2_batched, ARG1)
+    BLAS1_TESTING(dot_nrm2_strided_batched, ARG1)
+    BLAS1_TESTING(axpy_dot, ARG1)
+    BLAS1_TESTING(axpy_dot_batched, ARG1)
+    BLAS1_TESTING(axpy_dot_strided_batched, ARG1)
+    BLAS1_TESTING(axpy_nrm2, ARG1)
+    BLAS1_TESTING(axpy_nrm2_batched, ARG1)
+    BLAS1_TESTING(axpy_nrm2_strided_batched, ARG1)
 
 } // namespace
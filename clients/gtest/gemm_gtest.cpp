@@ -7,8 +7,10 @@
 #include "testing_gemm.hpp"
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
+#include "testing_gemm_epilogue.hpp"
 #include "testing_gemm_ex.hpp"
 #include "testing_gemm_ext2.hpp"
+#include "testing_gemm_grouped.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
 #include "type_dispatch.hpp"
@@ -28,6 +30,9 @@ namespace
         GEMM_STRIDED_BATCHED,
         GEMM_STRIDED_BATCHED_EX,
         GEMM_EXT2,
+        GEMM_GROUPED,
+        GEMM_EPILOGUE,
+        GEMM_EPILOGUE_DEQUANTIZE,
     };
 
     // ----------------------------------------------------------------------------
@@ -52,7 +57,12 @@ namespace
         // Filter for which types apply to this suite
         static bool type_filter(const Arguments& arg)
         {
-            return rocblas_gemm_dispatch<gemm_test_template::template type_filter_functor>(arg);
+            if constexpr(GEMM_TYPE == GEMM_EPILOGUE_DEQUANTIZE)
+                return rocblas_gemm_dequantize_dispatch<
+                    gemm_test_template::template type_filter_functor>(arg);
+            else
+                return rocblas_gemm_dispatch<gemm_test_template::template type_filter_functor>(
+                    arg);
         }
 
         // Filter for which functions apply to this suite
@@ -84,6 +94,17 @@ namespace
             case GEMM_EXT2:
                 return !strcmp(arg.function, "gemm_ext2")
                        || !strcmp(arg.function, "gemm_ext2_bad_arg");
+
+            case GEMM_GROUPED:
+                return !strcmp(arg.function, "gemm_grouped")
+                       || !strcmp(arg.function, "gemm_grouped_bad_arg");
+
+            case GEMM_EPILOGUE:
+                return !strcmp(arg.function, "gemm_epilogue")
+                       || !strcmp(arg.function, "gemm_epilogue_bad_arg");
+
+            case GEMM_EPILOGUE_DEQUANTIZE:
+                return !strcmp(arg.function, "gemm_epilogue_dequantize");
             }
 
             return false;
@@ -95,10 +116,13 @@ namespace
             RocBLAS_TestName<gemm_test_template> name(arg.name);
             name << rocblas_datatype2string(arg.a_type);
             constexpr bool isEx = GEMM_TYPE == GEMM_EX || GEMM_TYPE == GEMM_BATCHED_EX
-                                  || GEMM_TYPE == GEMM_STRIDED_BATCHED_EX || GEMM_TYPE == GEMM_EXT2;
+                                  || GEMM_TYPE == GEMM_STRIDED_BATCHED_EX || GEMM_TYPE == GEMM_EXT2
+                                  || GEMM_TYPE == GEMM_EPILOGUE
+                                  || GEMM_TYPE == GEMM_EPILOGUE_DEQUANTIZE;
             constexpr bool isBatched
                 = (GEMM_TYPE == GEMM_STRIDED_BATCHED || GEMM_TYPE == GEMM_STRIDED_BATCHED_EX
-                   || GEMM_TYPE == GEMM_BATCHED || GEMM_TYPE == GEMM_BATCHED_EX);
+                   || GEMM_TYPE == GEMM_BATCHED || GEMM_TYPE == GEMM_BATCHED_EX
+                   || GEMM_TYPE == GEMM_GROUPED);
 
             if(isEx)
                 name << rocblas_datatype2string(arg.b_type) << rocblas_datatype2string(arg.c_type)
@@ -193,6 +217,7 @@ namespace
     // gemm_batched_ex
     // gemm_strided_batched_ex
     // gemm_ext2
+    // gemm_epilogue
     // ----------------------------------------------------------------------------
 
     // In the general case of <Ti, To, Tc>, these tests do not apply, and if this
@@ -232,6 +257,10 @@ namespace
                 testing_gemm_ext2<Ti, To, Tc>(arg);
             else if(!strcmp(arg.function, "gemm_ext2_bad_arg"))
                 testing_gemm_ext2<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_epilogue"))
+                testing_gemm_epilogue<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_epilogue_bad_arg"))
+                testing_gemm_epilogue_bad_arg<Ti, To, Tc>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -268,4 +297,92 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemm_ext2);
 
+    using gemm_epilogue = gemm_test_template<gemm_ex_testing, GEMM_EPILOGUE>;
+    TEST_P(gemm_epilogue, blas3_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_gemm_dispatch<gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_epilogue);
+
+    // ----------------------------------------------------------------------------
+    // gemm_epilogue_dequantize
+    // ----------------------------------------------------------------------------
+
+    // In the general case of <To>, these tests do not apply, and if this
+    // functor is called, an internal error message is generated. When converted
+    // to bool, this functor returns false.
+    template <typename To, typename = void>
+    struct gemm_epilogue_dequantize_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the int8 product is dequantized to a real To, this test applies.
+    // When converted to bool, this functor returns true.
+    template <typename To>
+    struct gemm_epilogue_dequantize_testing<
+        To,
+        std::enable_if_t<std::is_same<To, float>{} || std::is_same<To, rocblas_half>{}
+                         || std::is_same<To, rocblas_bfloat16>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_epilogue_dequantize"))
+                testing_gemm_epilogue_dequantize<To>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_epilogue_dequantize
+        = gemm_test_template<gemm_epilogue_dequantize_testing, GEMM_EPILOGUE_DEQUANTIZE>;
+    TEST_P(gemm_epilogue_dequantize, blas3_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_gemm_dequantize_dispatch<gemm_epilogue_dequantize_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_epilogue_dequantize);
+
+    // ----------------------------------------------------------------------------
+    // gemm_grouped
+    // ----------------------------------------------------------------------------
+
+    // In the general case of <Ti, To, Tc>, these tests do not apply, and if this
+    // functor is called, an internal error message is generated. When converted
+    // to bool, this functor returns false.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct gemm_grouped_testing : rocblas_test_invalid
+    {
+    };
+
+    // When Ti = To = Tc is a single, double or complex type, this test applies.
+    // When converted to bool, this functor returns true.
+    template <typename T>
+    struct gemm_grouped_testing<
+        T,
+        T,
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_grouped"))
+                testing_gemm_grouped<T>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_bad_arg"))
+                testing_gemm_grouped_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_grouped = gemm_test_template<gemm_grouped_testing, GEMM_GROUPED>;
+    TEST_P(gemm_grouped, blas3_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_gemm_dispatch<gemm_grouped_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_grouped);
+
 } // namespace
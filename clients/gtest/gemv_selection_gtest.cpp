@@ -0,0 +1,142 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "../../library/src/blas2/rocblas_gemv_selection.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include <string>
+
+namespace
+{
+    // Selects the variant of a gemv of m = n = size with the rules of table before the built-in
+    // rules
+    rocblas_gemv_variant select(const char*       table,
+                                rocblas_int       arch,
+                                const char*       precision,
+                                rocblas_operation transA,
+                                rocblas_int       m,
+                                rocblas_int       n,
+                                bool              skinny_workspace = true)
+    {
+        size_t malformed = 0;
+        auto   variant   = rocblas_internal_gemv_select_variant(
+            table, &malformed, arch, precision, transA, m, n, 1, skinny_workspace);
+        EXPECT_EQ(malformed, size_t(0));
+        return variant;
+    }
+
+    template <typename...>
+    struct testing_gemv_selection : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            const rocblas_operation N = rocblas_operation_none;
+            const rocblas_operation T = rocblas_operation_transpose;
+
+            // Malformed rules are counted and ignored, comments and blank lines are not rules
+            const char malformed_table[] = R"(
+# comment only
+
+906 f32_r N * * * * * * * gemvn_64x4 extra
+906 f32_r X * * * * * * * gemvn_64x4
+906 f32_r N * * * * * * * gemvn_bogus
+906 f32_r N -1 * * * * * * gemvn_64x4
+906 f32_r N abc * * * * * * gemvn_64x4
+1   *     N * * * * * * * gemvn_64x4 # a valid rule after the malformed ones
+)";
+            size_t     malformed         = 0;
+            auto       variant           = rocblas_internal_gemv_select_variant(
+                malformed_table, &malformed, 906, "f32_r", N, 1000, 1000, 1, true);
+            EXPECT_EQ(malformed, size_t(5));
+            EXPECT_EQ(variant, select(nullptr, 906, "f32_r", N, 1000, 1000));
+            EXPECT_EQ(rocblas_internal_gemv_select_variant(
+                          malformed_table, nullptr, 1, "f32_r", N, 1000, 1000, 1, true),
+                      rocblas_gemv_variant::gemvn_64x4);
+
+            // The built-in rules, for gfx906, gfx908 and any other architecture
+            EXPECT_EQ(select(nullptr, 908, "f32_r", N, 1000, 1000),
+                      rocblas_gemv_variant::gemvn_32x16);
+            EXPECT_EQ(select(nullptr, 906, "f32_c", N, 1000, 1000),
+                      rocblas_gemv_variant::gemvn_32x16);
+            EXPECT_EQ(select(nullptr, 0, "f32_r", N, 1000, 1000),
+                      rocblas_gemv_variant::gemvn_64x16);
+            EXPECT_EQ(select(nullptr, 0, "f32_r", N, 1 << 20, 16),
+                      rocblas_gemv_variant::gemvn_64x4);
+            EXPECT_EQ(select(nullptr, 0, "f64_r", T, 64, 1000), rocblas_gemv_variant::gemvt_sn);
+            EXPECT_EQ(select(nullptr, 0, "f64_r", T, 64, 1000, false),
+                      rocblas_gemv_variant::gemvt_1024);
+
+            // A rule applies to its architecture only, '*' to all of them
+            const char arch_table[] = "906 * N * * * * * * * gemvn_64x4";
+            EXPECT_EQ(select(arch_table, 906, "f32_r", N, 1000, 1000),
+                      rocblas_gemv_variant::gemvn_64x4);
+            EXPECT_EQ(select(arch_table, 908, "f32_r", N, 1000, 1000),
+                      rocblas_gemv_variant::gemvn_32x16);
+            EXPECT_EQ(select(arch_table, 906, "f32_r", T, 1000, 1000),
+                      rocblas_gemv_variant::gemvt_sn);
+
+            const char any_arch_table[] = "* f64_r,f64_c N,C * * * * * * * gemvn_64x4";
+            EXPECT_EQ(select(any_arch_table, 908, "f64_c", N, 1000, 1000),
+                      rocblas_gemv_variant::gemvn_64x4);
+            EXPECT_EQ(select(any_arch_table, 0, "f64_r", N, 1000, 1000),
+                      rocblas_gemv_variant::gemvn_64x4);
+            EXPECT_EQ(select(any_arch_table, 908, "f32_r", N, 1000, 1000),
+                      rocblas_gemv_variant::gemvn_32x16);
+
+            // The rules of the table take precedence over the built-in rules, the first matching
+            // rule winning, and the bounds of the ranges are inclusive
+            const char precedence_table[] = R"(
+908 f32_r N 100 200 * * * * * gemvn_64x4
+908 f32_r N *   *   * * * * * gemvn_64x16
+)";
+            EXPECT_EQ(select(precedence_table, 908, "f32_r", N, 100, 1000),
+                      rocblas_gemv_variant::gemvn_64x4);
+            EXPECT_EQ(select(precedence_table, 908, "f32_r", N, 200, 1000),
+                      rocblas_gemv_variant::gemvn_64x4);
+            EXPECT_EQ(select(precedence_table, 908, "f32_r", N, 201, 1000),
+                      rocblas_gemv_variant::gemvn_64x16);
+            EXPECT_EQ(select(precedence_table, 908, "f64_r", N, 201, 1000),
+                      rocblas_gemv_variant::gemvn_32x16);
+
+            // A matching rule whose variant does not apply to the problem is skipped
+            const char skipped_table[] = "* * T * * * * * * * gemvt_sm";
+            EXPECT_EQ(select(skipped_table, 906, "f32_r", T, 64, 1000),
+                      rocblas_gemv_variant::gemvt_sm);
+            EXPECT_EQ(select(skipped_table, 906, "f32_r", T, 65, 1000),
+                      rocblas_gemv_variant::gemvt_sn);
+            EXPECT_EQ(select(skipped_table, 906, "f32_r", T, 65, 1000, false),
+                      rocblas_gemv_variant::gemvt_256);
+            EXPECT_EQ(select(skipped_table, 906, "f64_r", T, 65, 1000, false),
+                      rocblas_gemv_variant::gemvt_1024);
+        }
+    };
+
+    struct gemv_selection : RocBLAS_Test<gemv_selection, testing_gemv_selection>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemv_selection");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<gemv_selection>(arg.name);
+        }
+    };
+
+    TEST_P(gemv_selection, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_gemv_selection<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_selection)
+
+} // namespace
@@ -762,4 +762,418 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(check_numerics_matrix);
 
+    // Builds a 16 bit float from its bits, so the half and bfloat16 limits are exact on the host
+    template <typename T>
+    T check_numerics_stats_from_bits(uint16_t bits)
+    {
+        T value;
+        static_assert(sizeof(value) == sizeof(bits), "T must be a 16 bit float");
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Smallest positive denormal of T
+    template <typename T>
+    T check_numerics_stats_denorm_min()
+    {
+        if constexpr(std::is_same<T, rocblas_half>{} || std::is_same<T, rocblas_bfloat16>{})
+            return check_numerics_stats_from_bits<T>(0x0001);
+        else
+            return std::numeric_limits<T>::denorm_min();
+    }
+
+    // Largest finite value of T
+    template <typename T>
+    T check_numerics_stats_max()
+    {
+        if constexpr(std::is_same<T, rocblas_half>{})
+            return check_numerics_stats_from_bits<T>(0x7bff);
+        else if constexpr(std::is_same<T, rocblas_bfloat16>{})
+            return check_numerics_stats_from_bits<T>(0x7f7f);
+        else
+            return std::numeric_limits<T>::max();
+    }
+
+    // Magnitude of a real value of T as gathered in the statistics
+    template <typename T>
+    double check_numerics_stats_magnitude(T value)
+    {
+        return std::abs(double(float(value)));
+    }
+
+    template <>
+    double check_numerics_stats_magnitude(double value)
+    {
+        return std::abs(value);
+    }
+
+    //Testing the statistics gathered by rocblas_check_numerics_mode_stats
+    template <typename T>
+    void testing_check_numerics_stats(const Arguments& arg)
+    {
+        rocblas_int N     = arg.N;
+        rocblas_int inc_x = arg.incx;
+
+        //Argument sanity check before allocating invalid memory
+        if(N < 3 || inc_x <= 0)
+            return;
+
+        //Creating a rocBLAS handle
+        rocblas_handle handle;
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+        rocblas_check_numerics_mode check_numerics = rocblas_check_numerics_mode_stats;
+
+        size_t size_x = N * size_t(inc_x);
+
+        //Values in [1, 10] apart from one zero, one denormal and the largest finite value, set
+        //explicitly since random values of the 16 bit types may be zero
+        host_vector<T> h_x(size_x);
+        for(rocblas_int i = 0; i < N; i++)
+            h_x[i * size_t(inc_x)] = T(float(1 + i % 10));
+        h_x[0]         = T(0);
+        h_x[inc_x]     = check_numerics_stats_denorm_min<T>();
+        h_x[2 * inc_x] = check_numerics_stats_max<T>();
+
+        double max_magnitude = 0;
+        for(rocblas_int i = 0; i < N; i++)
+            max_magnitude
+                = std::max(max_magnitude, check_numerics_stats_magnitude(h_x[i * size_t(inc_x)]));
+
+        device_vector<T> d_x(size_x);
+        CHECK_HIP_ERROR(hipMemcpy(d_x, h_x, sizeof(T) * size_x, hipMemcpyHostToDevice));
+
+        const char function_name[] = "testing_check_numerics_stats";
+        for(int call = 0; call < 2; call++)
+        {
+            rocblas_status status = rocblas_internal_check_numerics_vector_template(
+                function_name, handle, N, (const T*)d_x, 0, inc_x, 0, 1, check_numerics, true);
+            EXPECT_EQ(status, rocblas_status_success);
+        }
+
+        rocblas_check_numerics_stats stats;
+        CHECK_ROCBLAS_ERROR(rocblas_get_check_numerics_stats(handle, function_name, true, &stats));
+        EXPECT_EQ(stats.num_calls, 2);
+        EXPECT_EQ(stats.num_elements, 2 * uint64_t(N));
+        EXPECT_EQ(stats.num_zero, 2);
+        EXPECT_EQ(stats.num_denormal, 2);
+        EXPECT_EQ(stats.num_NaN, 0);
+        EXPECT_EQ(stats.num_Inf, 0);
+        EXPECT_EQ(stats.min_magnitude,
+                  check_numerics_stats_magnitude(check_numerics_stats_denorm_min<T>()));
+        EXPECT_EQ(stats.max_magnitude, max_magnitude);
+
+        uint64_t histogram_total = 0;
+        for(int i = 0; i < ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS; i++)
+            histogram_total += stats.exponent_histogram[i];
+        EXPECT_EQ(histogram_total, 2 * uint64_t(N - 1));
+
+        //Outputs are kept separately from inputs
+        CHECK_ROCBLAS_ERROR(rocblas_get_check_numerics_stats(handle, function_name, false, &stats));
+        EXPECT_EQ(stats.num_calls, 0);
+
+        CHECK_ROCBLAS_ERROR(rocblas_reset_check_numerics_stats(handle));
+        CHECK_ROCBLAS_ERROR(rocblas_get_check_numerics_stats(handle, function_name, true, &stats));
+        EXPECT_EQ(stats.num_calls, 0);
+        EXPECT_EQ(stats.num_elements, 0);
+
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+    }
+
+    //Testing the statistics gathered by rocblas_check_numerics_mode_stats for a general matrix
+    template <typename T>
+    void testing_check_numerics_matrix_stats(const Arguments& arg)
+    {
+        rocblas_int M   = arg.M;
+        rocblas_int N   = arg.N;
+        rocblas_int lda = arg.lda;
+
+        //Argument sanity check before allocating invalid memory
+        if(M < 2 || N < 2 || lda < M)
+            return;
+
+        //Creating a rocBLAS handle
+        rocblas_handle handle;
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+        rocblas_check_numerics_mode check_numerics = rocblas_check_numerics_mode_stats;
+
+        size_t size_A = size_t(lda) * N;
+
+        //Values in [1, 10] apart from one zero, one denormal and the largest finite value, and NaN
+        //in the rows past M, which must not be counted
+        host_vector<T> h_A(size_A);
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            for(rocblas_int i = 0; i < M; i++)
+                h_A[i + size_t(lda) * j] = T(float(1 + (i + j) % 10));
+            for(rocblas_int i = M; i < lda; i++)
+                h_A[i + size_t(lda) * j] = T(std::numeric_limits<float>::quiet_NaN());
+        }
+        h_A[0]   = T(0);
+        h_A[1]   = check_numerics_stats_max<T>();
+        h_A[lda] = check_numerics_stats_denorm_min<T>();
+
+        double max_magnitude = 0;
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < M; i++)
+                max_magnitude = std::max(max_magnitude,
+                                         check_numerics_stats_magnitude(h_A[i + size_t(lda) * j]));
+
+        device_vector<T> d_A(size_A);
+        CHECK_HIP_ERROR(hipMemcpy(d_A, h_A, sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+        const char function_name[] = "testing_check_numerics_matrix_stats";
+        for(int call = 0; call < 2; call++)
+        {
+            rocblas_status status
+                = rocblas_internal_check_numerics_ge_matrix_template(function_name,
+                                                                     handle,
+                                                                     rocblas_operation_none,
+                                                                     M,
+                                                                     N,
+                                                                     (const T*)d_A,
+                                                                     0,
+                                                                     lda,
+                                                                     0,
+                                                                     1,
+                                                                     check_numerics,
+                                                                     false);
+            EXPECT_EQ(status, rocblas_status_success);
+        }
+
+        rocblas_check_numerics_stats stats;
+        CHECK_ROCBLAS_ERROR(
+            rocblas_get_check_numerics_stats(handle, function_name, false, &stats));
+        EXPECT_EQ(stats.num_calls, 2);
+        EXPECT_EQ(stats.num_elements, 2 * uint64_t(M) * N);
+        EXPECT_EQ(stats.num_zero, 2);
+        EXPECT_EQ(stats.num_denormal, 2);
+        EXPECT_EQ(stats.num_NaN, 0);
+        EXPECT_EQ(stats.num_Inf, 0);
+        EXPECT_EQ(stats.min_magnitude,
+                  check_numerics_stats_magnitude(check_numerics_stats_denorm_min<T>()));
+        EXPECT_EQ(stats.max_magnitude, max_magnitude);
+
+        uint64_t histogram_total = 0;
+        for(int i = 0; i < ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS; i++)
+            histogram_total += stats.exponent_histogram[i];
+        EXPECT_EQ(histogram_total, 2 * (uint64_t(M) * N - 1));
+
+        //Inputs are kept separately from outputs
+        CHECK_ROCBLAS_ERROR(rocblas_get_check_numerics_stats(handle, function_name, true, &stats));
+        EXPECT_EQ(stats.num_calls, 0);
+
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+    }
+
+    template <typename, typename = void>
+    struct check_numerics_stats_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct check_numerics_stats_testing<
+        T,
+        std::enable_if_t<std::is_same<T, rocblas_half>{} || std::is_same<T, rocblas_bfloat16>{}
+                         || std::is_same<T, float>{} || std::is_same<T, double>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "check_numerics_stats"))
+                testing_check_numerics_stats<T>(arg);
+            else if(!strcmp(arg.function, "check_numerics_matrix_stats"))
+                testing_check_numerics_matrix_stats<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct check_numerics_stats : RocBLAS_Test<check_numerics_stats, check_numerics_stats_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "check_numerics_stats");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<check_numerics_stats> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type) << '_' << arg.N << '_' << arg.incx;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(check_numerics_stats, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<check_numerics_stats_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(check_numerics_stats);
+
+    struct check_numerics_matrix_stats
+        : RocBLAS_Test<check_numerics_matrix_stats, check_numerics_stats_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "check_numerics_matrix_stats");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<check_numerics_matrix_stats> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type) << '_' << arg.M << '_' << arg.N << '_'
+                 << arg.lda;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(check_numerics_matrix_stats, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<check_numerics_stats_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(check_numerics_matrix_stats);
+
+    //Testing the reports of rocblas_check_numerics_mode_deferred
+    template <typename T>
+    void testing_check_numerics_deferred(const Arguments& arg)
+    {
+        rocblas_int N     = arg.N;
+        rocblas_int inc_x = arg.incx;
+
+        //Argument sanity check before allocating invalid memory
+        if(N < 2 || inc_x <= 0)
+            return;
+
+        //Creating a rocBLAS handle
+        rocblas_handle handle;
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+        CHECK_ROCBLAS_ERROR(rocblas_set_check_numerics_mode(
+            handle,
+            rocblas_check_numerics_mode(rocblas_check_numerics_mode_deferred
+                                        | rocblas_check_numerics_mode_fail)));
+
+        rocblas_check_numerics_mode check_numerics;
+        CHECK_ROCBLAS_ERROR(rocblas_get_check_numerics_mode(handle, &check_numerics));
+
+        size_t size_x = N * size_t(inc_x);
+
+        host_vector<T> h_x(size_x);
+        rocblas_seedrand();
+        rocblas_init<T>(h_x, 1, N, inc_x);
+
+        device_vector<T> d_x(size_x);
+        CHECK_HIP_ERROR(hipMemcpy(d_x, h_x, sizeof(T) * size_x, hipMemcpyHostToDevice));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        const char function_name[] = "testing_check_numerics_deferred";
+
+        //No failure before anything is checked, and none for a clean vector
+        rocblas_check_numerics_report report;
+        EXPECT_EQ(rocblas_check_numerics_poll(handle, &report), rocblas_status_success);
+
+        rocblas_status status = rocblas_internal_check_numerics_vector_template(
+            function_name, handle, N, (const T*)d_x, 0, inc_x, 0, 1, check_numerics, true);
+        EXPECT_EQ(status, rocblas_status_success);
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        EXPECT_EQ(rocblas_check_numerics_poll(handle, &report), rocblas_status_success);
+        EXPECT_EQ(report.function_name, nullptr);
+
+        //A NaN is not reported by the checking function, only by a later poll
+        rocblas_int nan_index = N - 1;
+        h_x[nan_index * inc_x] = T(rocblas_nan_rng());
+        CHECK_HIP_ERROR(hipMemcpy(d_x, h_x, sizeof(T) * size_x, hipMemcpyHostToDevice));
+
+        status = rocblas_internal_check_numerics_vector_template(
+            function_name, handle, N, (const T*)d_x, 0, inc_x, 0, 1, check_numerics, false);
+        EXPECT_EQ(status, rocblas_status_success);
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        EXPECT_EQ(rocblas_check_numerics_poll(handle, &report), rocblas_status_check_numerics_fail);
+        ASSERT_NE(report.function_name, nullptr);
+        EXPECT_STREQ(report.function_name, function_name);
+        EXPECT_FALSE(report.is_input);
+        EXPECT_TRUE(report.has_NaN);
+        EXPECT_FALSE(report.has_Inf);
+        EXPECT_EQ(report.operand, (const void*)(T*)d_x);
+        EXPECT_EQ(report.batch_index, 0);
+        EXPECT_EQ(report.element_index, int64_t(nan_index) * inc_x);
+
+        //The failure is cleared once reported
+        EXPECT_EQ(rocblas_check_numerics_poll(handle, &report), rocblas_status_success);
+
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+    }
+
+    template <typename, typename = void>
+    struct check_numerics_deferred_testing : rocblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct check_numerics_deferred_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "check_numerics_deferred"))
+                testing_check_numerics_deferred<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    struct check_numerics_deferred
+        : RocBLAS_Test<check_numerics_deferred, check_numerics_deferred_testing>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "check_numerics_deferred");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<check_numerics_deferred> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type) << '_' << arg.N << '_' << arg.incx;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(check_numerics_deferred, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<check_numerics_deferred_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(check_numerics_deferred);
+
 } // namespace
@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_rank_update_deferred.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // rank_update_deferred test template
+    template <template <typename...> class FILTER>
+    struct rank_update_deferred_template
+        : RocBLAS_Test<rank_update_deferred_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<
+                rank_update_deferred_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "ger_deferred") || !strcmp(arg.function, "geru_deferred")
+                   || !strcmp(arg.function, "gerc_deferred")
+                   || !strcmp(arg.function, "syr_deferred")
+                   || !strcmp(arg.function, "her_deferred")
+                   || !strcmp(arg.function, "syr2_deferred")
+                   || !strcmp(arg.function, "her2_deferred")
+                   || !strcmp(arg.function, "rank_update_deferred_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<rank_update_deferred_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << arg.function;
+
+                if(!strncmp(arg.function, "ger", 3))
+                    name << '_' << arg.M;
+                else
+                    name << '_' << (char)std::toupper(arg.uplo);
+
+                name << '_' << arg.N << '_' << arg.K << '_' << arg.batch_count << '_'
+                     << arg.alpha << '_' << arg.incx << '_' << arg.incy << '_' << arg.lda;
+            }
+
+            if(arg.fortran)
+            {
+                name << "_F";
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct rank_update_deferred_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct rank_update_deferred_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}
+                         || std::is_same<T, rocblas_float_complex>{}
+                         || std::is_same<T, rocblas_double_complex>{}>> : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "rank_update_deferred_bad_arg"))
+                testing_rank_update_deferred_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "syr_deferred"))
+                testing_rank_update_deferred<T, rocblas_rank_update_test::syr>(arg);
+            else if(!strcmp(arg.function, "syr2_deferred"))
+                testing_rank_update_deferred<T, rocblas_rank_update_test::syr2>(arg);
+            else if(!is_complex<T> && !strcmp(arg.function, "ger_deferred"))
+                testing_rank_update_deferred<T, rocblas_rank_update_test::ger>(arg);
+            else if(is_complex<T> && !strcmp(arg.function, "geru_deferred"))
+                testing_rank_update_deferred<T, rocblas_rank_update_test::ger>(arg);
+            else if(!complex_function(arg))
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+
+        // gerc, her and her2 exist only for complex types
+        static bool complex_function(const Arguments& arg)
+        {
+            if constexpr(is_complex<T>)
+            {
+                if(!strcmp(arg.function, "gerc_deferred"))
+                    testing_rank_update_deferred<T, rocblas_rank_update_test::gerc>(arg);
+                else if(!strcmp(arg.function, "her_deferred"))
+                    testing_rank_update_deferred<T, rocblas_rank_update_test::her>(arg);
+                else if(!strcmp(arg.function, "her2_deferred"))
+                    testing_rank_update_deferred<T, rocblas_rank_update_test::her2>(arg);
+                else
+                    return false;
+                return true;
+            }
+            return false;
+        }
+    };
+
+    using rank_update_deferred = rank_update_deferred_template<rank_update_deferred_testing>;
+    TEST_P(rank_update_deferred, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<rank_update_deferred_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(rank_update_deferred);
+
+} // namespace
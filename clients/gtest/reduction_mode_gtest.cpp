@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_accuracy_mode.hpp"
+#include "testing_reduction_mode.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // possible reduction mode test cases
+    enum reduction_mode_test_type
+    {
+        REDUCTION_MODE,
+        ACCURACY_MODE,
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct reduction_mode_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct reduction_mode_testing<
+        T,
+        std::enable_if_t<std::is_same<T, float>{} || std::is_same<T, double>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "reduction_mode"))
+                testing_reduction_mode<T>(arg);
+            else if(!strcmp(arg.function, "accuracy_mode"))
+                testing_accuracy_mode<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    template <template <typename...> class FILTER, reduction_mode_test_type MODE_TYPE>
+    struct reduction_mode_template
+        : RocBLAS_Test<reduction_mode_template<FILTER, MODE_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<reduction_mode_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(MODE_TYPE)
+            {
+            case REDUCTION_MODE:
+                return !strcmp(arg.function, "reduction_mode");
+            case ACCURACY_MODE:
+                return !strcmp(arg.function, "accuracy_mode");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<reduction_mode_template>{}
+                   << rocblas_datatype2string(arg.a_type) << '_' << arg.N << '_'
+                   << arg.batch_count;
+        }
+    };
+
+    using reduction_mode = reduction_mode_template<reduction_mode_testing, REDUCTION_MODE>;
+    TEST_P(reduction_mode, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<reduction_mode_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(reduction_mode);
+
+    using accuracy_mode = reduction_mode_template<reduction_mode_testing, ACCURACY_MODE>;
+    TEST_P(accuracy_mode, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<reduction_mode_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(accuracy_mode);
+
+} // namespace
@@ -10,6 +10,7 @@
 #include "testing_trsm_batched.hpp"
 #include "testing_trsm_batched_ex.hpp"
 #include "testing_trsm_ex.hpp"
+#include "testing_trsm_inverse_cache.hpp"
 #include "testing_trsm_strided_batched.hpp"
 #include "testing_trsm_strided_batched_ex.hpp"
 #include "type_dispatch.hpp"
@@ -28,6 +29,7 @@ namespace
         TRSM_BATCHED_EX,
         TRSM_STRIDED_BATCHED,
         TRSM_STRIDED_BATCHED_EX,
+        TRSM_INVERSE_CACHE,
     };
 
     // trsm test template
@@ -57,6 +59,8 @@ namespace
                 return !strcmp(arg.function, "trsm_strided_batched");
             case TRSM_STRIDED_BATCHED_EX:
                 return !strcmp(arg.function, "trsm_strided_batched_ex");
+            case TRSM_INVERSE_CACHE:
+                return !strcmp(arg.function, "trsm_inverse_cache");
             }
             return false;
         }
@@ -121,6 +125,8 @@ namespace
                 testing_trsm_strided_batched<T>(arg);
             else if(!strcmp(arg.function, "trsm_strided_batched_ex"))
                 testing_trsm_strided_batched_ex<T>(arg);
+            else if(!strcmp(arg.function, "trsm_inverse_cache"))
+                testing_trsm_inverse_cache<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -168,4 +174,11 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(trsm_strided_batched_ex);
 
+    using trsm_inverse_cache = trsm_template<trsm_testing, TRSM_INVERSE_CACHE>;
+    TEST_P(trsm_inverse_cache, blas3_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(rocblas_simple_dispatch<trsm_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsm_inverse_cache);
+
 } // namespace
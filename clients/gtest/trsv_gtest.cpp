@@ -8,6 +8,7 @@
 #include "rocblas_test.hpp"
 #include "testing_trsv.hpp"
 #include "testing_trsv_batched.hpp"
+#include "testing_trsv_inverse_cache.hpp"
 #include "testing_trsv_strided_batched.hpp"
 #include "type_dispatch.hpp"
 #include <cctype>
@@ -22,6 +23,7 @@ namespace
         TRSV,
         TRSV_BATCHED,
         TRSV_STRIDED_BATCHED,
+        TRSV_INVERSE_CACHE,
     };
 
     // By default, this test does not apply to any types.
@@ -48,6 +50,8 @@ namespace
                 testing_trsv_batched<T>(arg);
             else if(!strcmp(arg.function, "trsv_strided_batched"))
                 testing_trsv_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "trsv_inverse_cache"))
+                testing_trsv_inverse_cache<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -73,6 +77,8 @@ namespace
                 return !strcmp(arg.function, "trsv_batched");
             case TRSV_STRIDED_BATCHED:
                 return !strcmp(arg.function, "trsv_strided_batched");
+            case TRSV_INVERSE_CACHE:
+                return !strcmp(arg.function, "trsv_inverse_cache");
             }
             return false;
         }
@@ -93,7 +99,7 @@ namespace
             if(TRSV_TYPE == TRSV_STRIDED_BATCHED)
                 name << '_' << arg.stride_x;
 
-            if(TRSV_TYPE != TRSV)
+            if(TRSV_TYPE != TRSV && TRSV_TYPE != TRSV_INVERSE_CACHE)
                 name << '_' << arg.batch_count;
 
             if(arg.fortran)
@@ -126,4 +132,11 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(trsv_strided_batched);
 
+    using trsv_inverse_cache = trsv_template<trsv_testing, TRSV_INVERSE_CACHE>;
+    TEST_P(trsv_inverse_cache, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(rocblas_simple_dispatch<trsv_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsv_inverse_cache);
+
 } // namespace
@@ -0,0 +1,324 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_axpy_dot_batched_bad_arg(const Arguments& arg)
+{
+    auto rocblas_axpy_dot_batched_fn
+        = arg.fortran ? rocblas_axpy_dot_batched<T, true> : rocblas_axpy_dot_batched<T, false>;
+
+    rocblas_int N           = 100;
+    rocblas_int incx        = 1;
+    rocblas_int incy        = 1;
+    rocblas_int incz        = 1;
+    rocblas_int batch_count = 5;
+    T           alpha       = 0.6;
+
+    rocblas_local_handle   handle{arg};
+    device_batch_vector<T> dx(N, incx, batch_count);
+    device_batch_vector<T> dy(N, incy, batch_count);
+    device_batch_vector<T> dz(N, incz, batch_count);
+    host_vector<T>         results(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_batched_fn(handle,
+                                                      N,
+                                                      nullptr,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      dz.ptr_on_device(),
+                                                      incz,
+                                                      batch_count,
+                                                      results),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_batched_fn(handle,
+                                                      N,
+                                                      &alpha,
+                                                      nullptr,
+                                                      incx,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      dz.ptr_on_device(),
+                                                      incz,
+                                                      batch_count,
+                                                      results),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_batched_fn(handle,
+                                                      N,
+                                                      &alpha,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      nullptr,
+                                                      incy,
+                                                      dz.ptr_on_device(),
+                                                      incz,
+                                                      batch_count,
+                                                      results),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_batched_fn(handle,
+                                                      N,
+                                                      &alpha,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      nullptr,
+                                                      incz,
+                                                      batch_count,
+                                                      results),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_batched_fn(handle,
+                                                      N,
+                                                      &alpha,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      dz.ptr_on_device(),
+                                                      incz,
+                                                      batch_count,
+                                                      nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_batched_fn(nullptr,
+                                                      N,
+                                                      &alpha,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      dz.ptr_on_device(),
+                                                      incz,
+                                                      batch_count,
+                                                      results),
+                          rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_axpy_dot_batched(const Arguments& arg)
+{
+    auto rocblas_axpy_dot_batched_fn
+        = arg.fortran ? rocblas_axpy_dot_batched<T, true> : rocblas_axpy_dot_batched<T, false>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int incz        = arg.incd;
+    rocblas_int batch_count = arg.batch_count;
+    T           h_alpha     = arg.get_alpha<T>();
+
+    double               rocblas_error_1 = 0;
+    double               rocblas_error_2 = 0;
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || batch_count <= 0)
+    {
+        host_vector<T> results(std::max(batch_count, 1));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_batched_fn(handle,
+                                                        N,
+                                                        nullptr,
+                                                        nullptr,
+                                                        incx,
+                                                        nullptr,
+                                                        incy,
+                                                        nullptr,
+                                                        incz,
+                                                        batch_count,
+                                                        results));
+        return;
+    }
+
+    rocblas_int abs_incy = incy > 0 ? incy : -incy;
+
+    host_vector<T> cpu_result(batch_count);
+    host_vector<T> rocblas_result_1(batch_count);
+    host_vector<T> rocblas_result_2(batch_count);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_batch_vector<T> hx(N, incx ? incx : 1, batch_count);
+    host_batch_vector<T> hy(N, incy ? incy : 1, batch_count);
+    host_batch_vector<T> hz(N, incz ? incz : 1, batch_count);
+    host_batch_vector<T> hy_1(N, incy ? incy : 1, batch_count);
+    host_batch_vector<T> hy_2(N, incy ? incy : 1, batch_count);
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hy.memcheck());
+    CHECK_HIP_ERROR(hz.memcheck());
+    CHECK_HIP_ERROR(hy_1.memcheck());
+    CHECK_HIP_ERROR(hy_2.memcheck());
+
+    //Device-arrays of pointers to device memory
+    device_batch_vector<T> dx(N, incx ? incx : 1, batch_count);
+    device_batch_vector<T> dy(N, incy ? incy : 1, batch_count);
+    device_batch_vector<T> dz(N, incz ? incz : 1, batch_count);
+    device_vector<T>       d_alpha(1);
+    device_vector<T>       d_rocblas_result_2(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result_2.memcheck());
+
+    // Initial Data on CPU
+    if(rocblas_isnan(arg.alpha))
+    {
+        rocblas_init_nan(hx, true);
+        rocblas_init_nan(hy, false);
+        rocblas_init_nan(hz, false);
+    }
+    else
+    {
+        rocblas_init(hx, true);
+        rocblas_init(hy, false);
+        rocblas_init(hz, false);
+    }
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_batched_fn(handle,
+                                                        N,
+                                                        &h_alpha,
+                                                        dx.ptr_on_device(),
+                                                        incx,
+                                                        dy.ptr_on_device(),
+                                                        incy,
+                                                        dz.ptr_on_device(),
+                                                        incz,
+                                                        batch_count,
+                                                        rocblas_result_1));
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_batched_fn(handle,
+                                                        N,
+                                                        d_alpha,
+                                                        dx.ptr_on_device(),
+                                                        incx,
+                                                        dy.ptr_on_device(),
+                                                        incy,
+                                                        dz.ptr_on_device(),
+                                                        incz,
+                                                        batch_count,
+                                                        d_rocblas_result_2));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy));
+        CHECK_HIP_ERROR(rocblas_result_2.transfer_from(d_rocblas_result_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < batch_count; ++b)
+        {
+            cblas_axpy<T>(N, h_alpha, hx[b], incx, hy[b], incy);
+            if constexpr(is_complex<T>)
+                cblas_dotc<T>(N, hy[b], incy, hz[b], incz, &cpu_result[b]);
+            else
+                cblas_dot<T>(N, hy[b], incy, hz[b], incz, &cpu_result[b]);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy, hy_1, batch_count);
+            unit_check_general<T>(1, N, abs_incy, hy, hy_2, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_result, rocblas_result_1, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_result, rocblas_result_2, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            for(int b = 0; b < batch_count; ++b)
+            {
+                rocblas_error_1
+                    += rocblas_abs((cpu_result[b] - rocblas_result_1[b]) / cpu_result[b]);
+                rocblas_error_2
+                    += rocblas_abs((cpu_result[b] - rocblas_result_2[b]) / cpu_result[b]);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpy_dot_batched_fn(handle,
+                                        N,
+                                        d_alpha,
+                                        dx.ptr_on_device(),
+                                        incx,
+                                        dy.ptr_on_device(),
+                                        incy,
+                                        dz.ptr_on_device(),
+                                        incz,
+                                        batch_count,
+                                        d_rocblas_result_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_axpy_dot_batched_fn(handle,
+                                        N,
+                                        d_alpha,
+                                        dx.ptr_on_device(),
+                                        incx,
+                                        dy.ptr_on_device(),
+                                        incy,
+                                        dz.ptr_on_device(),
+                                        incz,
+                                        batch_count,
+                                        d_rocblas_result_2);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_incy, e_incd, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpy_dot_gflop_count<T>(N),
+            axpy_dot_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
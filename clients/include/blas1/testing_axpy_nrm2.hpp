@@ -0,0 +1,205 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_axpy_nrm2_bad_arg(const Arguments& arg)
+{
+    auto rocblas_axpy_nrm2_fn
+        = arg.fortran ? rocblas_axpy_nrm2<T, true> : rocblas_axpy_nrm2<T, false>;
+
+    rocblas_int N         = 100;
+    rocblas_int incx      = 1;
+    rocblas_int incy      = 1;
+    size_t      safe_size = 100;
+    T           alpha     = 0.6;
+
+    rocblas_local_handle handle{arg};
+    device_vector<T>     dx(safe_size);
+    device_vector<T>     dy(safe_size);
+    real_t<T>            result;
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_nrm2_fn(handle, N, nullptr, dx, incx, dy, incy, &result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_nrm2_fn(handle, N, &alpha, nullptr, incx, dy, incy, &result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_nrm2_fn(handle, N, &alpha, dx, incx, nullptr, incy, &result),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_nrm2_fn(handle, N, &alpha, dx, incx, dy, incy, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_nrm2_fn(nullptr, N, &alpha, dx, incx, dy, incy, &result),
+                          rocblas_status_invalid_handle);
+    // If N == 0, then alpha, X and Y can be nullptr without error
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_axpy_nrm2_fn(handle, 0, nullptr, nullptr, incx, nullptr, incy, &result),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_axpy_nrm2(const Arguments& arg)
+{
+    auto rocblas_axpy_nrm2_fn
+        = arg.fortran ? rocblas_axpy_nrm2<T, true> : rocblas_axpy_nrm2<T, false>;
+
+    rocblas_int N       = arg.N;
+    rocblas_int incx    = arg.incx;
+    rocblas_int incy    = arg.incy;
+    T           h_alpha = arg.get_alpha<T>();
+
+    real_t<T> rocblas_result_1, rocblas_result_2, cpu_result;
+
+    double               rocblas_error_1 = 0;
+    double               rocblas_error_2 = 0;
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_nrm2_fn(
+            handle, N, nullptr, nullptr, incx, nullptr, incy, &rocblas_result_1));
+        EXPECT_EQ(rocblas_result_1, real_t<T>(0));
+        return;
+    }
+
+    rocblas_int abs_incx = incx > 0 ? incx : -incx;
+    rocblas_int abs_incy = incy > 0 ? incy : -incy;
+    size_t      size_x   = N * size_t(abs_incx ? abs_incx : 1);
+    size_t      size_y   = N * size_t(abs_incy ? abs_incy : 1);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+    host_vector<T> hy_1(size_y);
+    host_vector<T> hy_2(size_y);
+    host_vector<T> cpu_y(size_y);
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    if(rocblas_isnan(arg.alpha))
+    {
+        rocblas_init_nan<T>(hx, 1, N, abs_incx ? abs_incx : 1);
+        rocblas_init_nan<T>(hy, 1, N, abs_incy ? abs_incy : 1);
+    }
+    else
+    {
+        rocblas_init<T>(hx, 1, N, abs_incx ? abs_incx : 1);
+        rocblas_init<T>(hy, 1, N, abs_incy ? abs_incy : 1);
+    }
+    cpu_y = hy;
+
+    // allocate memory on device
+    device_vector<T>         dx(size_x);
+    device_vector<T>         dy(size_y);
+    device_vector<T>         d_alpha(1);
+    device_vector<real_t<T>> d_rocblas_result_2(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_rocblas_result_2.memcheck());
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_axpy_nrm2_fn(handle, N, &h_alpha, dx, incx, dy, incy, &rocblas_result_1));
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_axpy_nrm2_fn(handle, N, d_alpha, dx, incx, dy, incy, d_rocblas_result_2));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy));
+        CHECK_HIP_ERROR(hipMemcpy(
+            &rocblas_result_2, d_rocblas_result_2, sizeof(real_t<T>), hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        cblas_axpy<T>(N, h_alpha, hx, incx, cpu_y, incy);
+        cblas_nrm2<T>(N, cpu_y, incy, &cpu_result);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        //  accounts for rounding in reduction sum. depends on n.
+        //  If test fails, try decreasing n or increasing tolerance.
+        real_t<T> abs_error = std::numeric_limits<real_t<T>>::epsilon() * N
+                              * std::max(cpu_result, real_t<T>(1)) * real_t<T>(2.0);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, cpu_y, hy_1);
+            unit_check_general<T>(1, N, abs_incy, cpu_y, hy_2);
+            near_check_general<real_t<T>, real_t<T>>(
+                1, 1, 1, &cpu_result, &rocblas_result_1, abs_error);
+            near_check_general<real_t<T>, real_t<T>>(
+                1, 1, 1, &cpu_result, &rocblas_result_2, abs_error);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_cout << "cpu=" << cpu_result << ", gpu_host_ptr=" << rocblas_result_1
+                         << ", gpu_device_ptr=" << rocblas_result_2 << std::endl;
+            rocblas_error_1 = rocblas_abs((cpu_result - rocblas_result_1) / cpu_result);
+            rocblas_error_2 = rocblas_abs((cpu_result - rocblas_result_2) / cpu_result);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpy_nrm2_fn(handle, N, d_alpha, dx, incx, dy, incy, d_rocblas_result_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_axpy_nrm2_fn(handle, N, d_alpha, dx, incx, dy, incy, d_rocblas_result_2);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_incy>{}.log_args<T>(rocblas_cout,
+                                                                  arg,
+                                                                  gpu_time_used,
+                                                                  axpy_nrm2_gflop_count<T>(N),
+                                                                  axpy_nrm2_gbyte_count<T>(N),
+                                                                  cpu_time_used,
+                                                                  rocblas_error_1,
+                                                                  rocblas_error_2);
+    }
+}
@@ -0,0 +1,220 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_dot_nrm2_bad_arg(const Arguments& arg)
+{
+    auto rocblas_dot_nrm2_fn
+        = arg.fortran ? rocblas_dot_nrm2<T, true> : rocblas_dot_nrm2<T, false>;
+
+    rocblas_int N         = 100;
+    rocblas_int incx      = 1;
+    rocblas_int incy      = 1;
+    size_t      safe_size = 100; //  arbitrarily set to 100
+
+    rocblas_local_handle     handle{arg};
+    device_vector<T>         dx(safe_size);
+    device_vector<T>         dy(safe_size);
+    device_vector<T>         d_dot_result(1);
+    device_vector<real_t<T>> d_nrm2_result(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_dot_result.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_nrm2_result.memcheck());
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot_nrm2_fn(handle, N, nullptr, incx, dy, incy, d_dot_result, d_nrm2_result),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot_nrm2_fn(handle, N, dx, incx, nullptr, incy, d_dot_result, d_nrm2_result),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot_nrm2_fn(handle, N, dx, incx, dy, incy, nullptr, d_nrm2_result),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot_nrm2_fn(handle, N, dx, incx, dy, incy, d_dot_result, nullptr),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_dot_nrm2_fn(nullptr, N, dx, incx, dy, incy, d_dot_result, d_nrm2_result),
+        rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_dot_nrm2(const Arguments& arg)
+{
+    auto rocblas_dot_nrm2_fn
+        = arg.fortran ? rocblas_dot_nrm2<T, true> : rocblas_dot_nrm2<T, false>;
+
+    rocblas_int N    = arg.N;
+    rocblas_int incx = arg.incx;
+    rocblas_int incy = arg.incy;
+
+    T         rocblas_dot_1, rocblas_dot_2, cpu_dot;
+    real_t<T> rocblas_nrm2_1, rocblas_nrm2_2, cpu_nrm2;
+
+    double               rocblas_error_1 = 0;
+    double               rocblas_error_2 = 0;
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0)
+    {
+        device_vector<T>         d_dot_result(1);
+        device_vector<real_t<T>> d_nrm2_result(1);
+        CHECK_DEVICE_ALLOCATION(d_dot_result.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_nrm2_result.memcheck());
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_dot_nrm2_fn(
+            handle, N, nullptr, incx, nullptr, incy, d_dot_result, d_nrm2_result));
+
+        T         gpu_dot;
+        real_t<T> gpu_nrm2;
+        CHECK_HIP_ERROR(hipMemcpy(&gpu_dot, d_dot_result, sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(&gpu_nrm2, d_nrm2_result, sizeof(real_t<T>), hipMemcpyDeviceToHost));
+        EXPECT_EQ(gpu_dot, T(0));
+        EXPECT_EQ(gpu_nrm2, real_t<T>(0));
+        return;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+    size_t      size_x   = N * size_t(abs_incx ? abs_incx : 1);
+    size_t      size_y   = N * size_t(abs_incy ? abs_incy : 1);
+
+    // allocate memory on device
+    device_vector<T>         dx(size_x);
+    device_vector<T>         dy(size_y);
+    device_vector<T>         d_dot_result_2(1);
+    device_vector<real_t<T>> d_nrm2_result_2(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_dot_result_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_nrm2_result_2.memcheck());
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    if(rocblas_isnan(arg.alpha))
+    {
+        rocblas_init_nan<T>(hx, 1, N, abs_incx ? abs_incx : 1);
+        rocblas_init_nan<T>(hy, 1, N, abs_incy ? abs_incy : 1);
+    }
+    else
+    {
+        rocblas_init<T>(hx, 1, N, abs_incx ? abs_incx : 1);
+        rocblas_init<T>(hy, 1, N, abs_incy ? abs_incy : 1);
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double gpu_time_used, cpu_time_used;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_dot_nrm2_fn(handle, N, dx, incx, dy, incy, &rocblas_dot_1, &rocblas_nrm2_1));
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_dot_nrm2_fn(handle, N, dx, incx, dy, incy, d_dot_result_2, d_nrm2_result_2));
+        CHECK_HIP_ERROR(
+            hipMemcpy(&rocblas_dot_2, d_dot_result_2, sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            &rocblas_nrm2_2, d_nrm2_result_2, sizeof(real_t<T>), hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        if constexpr(is_complex<T>)
+            cblas_dotc<T>(N, hx, incx, hy, incy, &cpu_dot);
+        else
+            cblas_dot<T>(N, hx, incx, hy, incy, &cpu_dot);
+        cblas_nrm2<T>(N, hx, incx, &cpu_nrm2);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        //  accounts for rounding in reduction sum. depends on n.
+        //  If test fails, try decreasing n or increasing tolerance.
+        real_t<T> abs_error = std::numeric_limits<real_t<T>>::epsilon() * N
+                              * std::max(cpu_nrm2, real_t<T>(1)) * real_t<T>(2.0);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, 1, 1, &cpu_dot, &rocblas_dot_1);
+            unit_check_general<T>(1, 1, 1, &cpu_dot, &rocblas_dot_2);
+            near_check_general<real_t<T>, real_t<T>>(
+                1, 1, 1, &cpu_nrm2, &rocblas_nrm2_1, abs_error);
+            near_check_general<real_t<T>, real_t<T>>(
+                1, 1, 1, &cpu_nrm2, &rocblas_nrm2_2, abs_error);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_cout << "cpu=" << cpu_dot << ", " << cpu_nrm2 << ", gpu_host_ptr="
+                         << rocblas_dot_1 << ", " << rocblas_nrm2_1
+                         << ", gpu_device_ptr=" << rocblas_dot_2 << ", " << rocblas_nrm2_2
+                         << std::endl;
+            rocblas_error_1 = rocblas_abs((cpu_nrm2 - rocblas_nrm2_1) / cpu_nrm2);
+            rocblas_error_2 = rocblas_abs((cpu_nrm2 - rocblas_nrm2_2) / cpu_nrm2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_dot_nrm2_fn(handle, N, dx, incx, dy, incy, d_dot_result_2, d_nrm2_result_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_dot_nrm2_fn(handle, N, dx, incx, dy, incy, d_dot_result_2, d_nrm2_result_2);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_incx, e_incy>{}.log_args<T>(rocblas_cout,
+                                                         arg,
+                                                         gpu_time_used,
+                                                         dot_nrm2_gflop_count<T>(N),
+                                                         dot_gbyte_count<T>(N),
+                                                         cpu_time_used,
+                                                         rocblas_error_1,
+                                                         rocblas_error_2);
+    }
+}
@@ -0,0 +1,287 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_dot_nrm2_batched_bad_arg(const Arguments& arg)
+{
+    auto rocblas_dot_nrm2_batched_fn
+        = arg.fortran ? rocblas_dot_nrm2_batched<T, true> : rocblas_dot_nrm2_batched<T, false>;
+
+    rocblas_int N           = 100;
+    rocblas_int incx        = 1;
+    rocblas_int incy        = 1;
+    rocblas_int batch_count = 5;
+
+    rocblas_local_handle     handle{arg};
+    device_batch_vector<T>   dx(N, incx, batch_count);
+    device_batch_vector<T>   dy(N, incy, batch_count);
+    device_vector<T>         d_dot_results(batch_count);
+    device_vector<real_t<T>> d_nrm2_results(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_dot_results.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_nrm2_results.memcheck());
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2_batched_fn(handle,
+                                                      N,
+                                                      nullptr,
+                                                      incx,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      batch_count,
+                                                      d_dot_results,
+                                                      d_nrm2_results),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2_batched_fn(handle,
+                                                      N,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      nullptr,
+                                                      incy,
+                                                      batch_count,
+                                                      d_dot_results,
+                                                      d_nrm2_results),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2_batched_fn(handle,
+                                                      N,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      batch_count,
+                                                      nullptr,
+                                                      d_nrm2_results),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2_batched_fn(handle,
+                                                      N,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      batch_count,
+                                                      d_dot_results,
+                                                      nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2_batched_fn(nullptr,
+                                                      N,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      dy.ptr_on_device(),
+                                                      incy,
+                                                      batch_count,
+                                                      d_dot_results,
+                                                      d_nrm2_results),
+                          rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_dot_nrm2_batched(const Arguments& arg)
+{
+    auto rocblas_dot_nrm2_batched_fn
+        = arg.fortran ? rocblas_dot_nrm2_batched<T, true> : rocblas_dot_nrm2_batched<T, false>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int batch_count = arg.batch_count;
+
+    double               rocblas_error_1 = 0;
+    double               rocblas_error_2 = 0;
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0 || batch_count <= 0)
+    {
+        device_vector<T>         d_dot_results(std::max(batch_count, 1));
+        device_vector<real_t<T>> d_nrm2_results(std::max(batch_count, 1));
+        CHECK_DEVICE_ALLOCATION(d_dot_results.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_nrm2_results.memcheck());
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_dot_nrm2_batched_fn(
+            handle, N, nullptr, incx, nullptr, incy, batch_count, d_dot_results, d_nrm2_results));
+
+        if(batch_count > 0)
+        {
+            host_vector<T>         cpu_0(batch_count);
+            host_vector<T>         gpu_0(batch_count);
+            host_vector<real_t<T>> cpu_nrm2_0(batch_count);
+            host_vector<real_t<T>> gpu_nrm2_0(batch_count);
+            CHECK_HIP_ERROR(gpu_0.transfer_from(d_dot_results));
+            CHECK_HIP_ERROR(gpu_nrm2_0.transfer_from(d_nrm2_results));
+            unit_check_general<T>(1, 1, 1, 1, cpu_0, gpu_0, batch_count);
+            unit_check_general<real_t<T>>(1, 1, 1, 1, cpu_nrm2_0, gpu_nrm2_0, batch_count);
+        }
+        return;
+    }
+
+    host_vector<T>         cpu_dot(batch_count);
+    host_vector<T>         rocblas_dot_1(batch_count);
+    host_vector<T>         rocblas_dot_2(batch_count);
+    host_vector<real_t<T>> cpu_nrm2(batch_count);
+    host_vector<real_t<T>> rocblas_nrm2_1(batch_count);
+    host_vector<real_t<T>> rocblas_nrm2_2(batch_count);
+
+    //Device-arrays of pointers to device memory
+    device_batch_vector<T>   dx(N, incx ? incx : 1, batch_count);
+    device_batch_vector<T>   dy(N, incy ? incy : 1, batch_count);
+    device_vector<T>         d_dot_results_2(batch_count);
+    device_vector<real_t<T>> d_nrm2_results_2(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_dot_results_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_nrm2_results_2.memcheck());
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_batch_vector<T> hx(N, incx ? incx : 1, batch_count);
+    host_batch_vector<T> hy(N, incy ? incy : 1, batch_count);
+
+    // Initial Data on CPU
+    if(rocblas_isnan(arg.alpha))
+    {
+        rocblas_init_nan(hx, true);
+        rocblas_init_nan(hy, false);
+    }
+    else
+    {
+        rocblas_init(hx, true);
+        rocblas_init(hy, false);
+    }
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double gpu_time_used, cpu_time_used;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_dot_nrm2_batched_fn(handle,
+                                                        N,
+                                                        dx.ptr_on_device(),
+                                                        incx,
+                                                        dy.ptr_on_device(),
+                                                        incy,
+                                                        batch_count,
+                                                        rocblas_dot_1,
+                                                        rocblas_nrm2_1));
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_dot_nrm2_batched_fn(handle,
+                                                        N,
+                                                        dx.ptr_on_device(),
+                                                        incx,
+                                                        dy.ptr_on_device(),
+                                                        incy,
+                                                        batch_count,
+                                                        d_dot_results_2,
+                                                        d_nrm2_results_2));
+        CHECK_HIP_ERROR(rocblas_dot_2.transfer_from(d_dot_results_2));
+        CHECK_HIP_ERROR(rocblas_nrm2_2.transfer_from(d_nrm2_results_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < batch_count; ++b)
+        {
+            if constexpr(is_complex<T>)
+                cblas_dotc<T>(N, hx[b], incx, hy[b], incy, &cpu_dot[b]);
+            else
+                cblas_dot<T>(N, hx[b], incx, hy[b], incy, &cpu_dot[b]);
+            cblas_nrm2<T>(N, hx[b], incx, &cpu_nrm2[b]);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        //  accounts for rounding in reduction sum. depends on n.
+        //  If test fails, try decreasing n or increasing tolerance.
+        real_t<T> abs_error = std::numeric_limits<real_t<T>>::epsilon() * N
+                              * std::max(cpu_nrm2[0], real_t<T>(1)) * real_t<T>(2.0);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, 1, 1, 1, cpu_dot, rocblas_dot_1, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_dot, rocblas_dot_2, batch_count);
+            near_check_general<real_t<T>, real_t<T>>(
+                batch_count, 1, 1, cpu_nrm2, rocblas_nrm2_1, abs_error);
+            near_check_general<real_t<T>, real_t<T>>(
+                batch_count, 1, 1, cpu_nrm2, rocblas_nrm2_2, abs_error);
+        }
+
+        if(arg.norm_check)
+        {
+            for(int b = 0; b < batch_count; ++b)
+            {
+                rocblas_error_1 += rocblas_abs((cpu_nrm2[b] - rocblas_nrm2_1[b]) / cpu_nrm2[b]);
+                rocblas_error_2 += rocblas_abs((cpu_nrm2[b] - rocblas_nrm2_2[b]) / cpu_nrm2[b]);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_dot_nrm2_batched_fn(handle,
+                                        N,
+                                        dx.ptr_on_device(),
+                                        incx,
+                                        dy.ptr_on_device(),
+                                        incy,
+                                        batch_count,
+                                        d_dot_results_2,
+                                        d_nrm2_results_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_dot_nrm2_batched_fn(handle,
+                                        N,
+                                        dx.ptr_on_device(),
+                                        incx,
+                                        dy.ptr_on_device(),
+                                        incy,
+                                        batch_count,
+                                        d_dot_results_2,
+                                        d_nrm2_results_2);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_incx, e_incy, e_batch_count>{}.log_args<T>(rocblas_cout,
+                                                                        arg,
+                                                                        gpu_time_used,
+                                                                        dot_nrm2_gflop_count<T>(N),
+                                                                        dot_gbyte_count<T>(N),
+                                                                        cpu_time_used,
+                                                                        rocblas_error_1,
+                                                                        rocblas_error_2);
+    }
+}
@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_dot_nrm2_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto rocblas_dot_nrm2_strided_batched_fn = arg.fortran
+                                                   ? rocblas_dot_nrm2_strided_batched<T, true>
+                                                   : rocblas_dot_nrm2_strided_batched<T, false>;
+
+    rocblas_int N           = 100;
+    rocblas_int incx        = 1;
+    rocblas_int incy        = 1;
+    rocblas_int stride_x    = incx * N;
+    rocblas_int stride_y    = incy * N;
+    rocblas_int batch_count = 5;
+    size_t      size_x      = stride_x * batch_count;
+    size_t      size_y      = stride_y * batch_count;
+
+    rocblas_local_handle     handle{arg};
+    device_vector<T>         dx(size_x);
+    device_vector<T>         dy(size_y);
+    device_vector<T>         d_dot_results(batch_count);
+    device_vector<real_t<T>> d_nrm2_results(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_dot_results.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_nrm2_results.memcheck());
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2_strided_batched_fn(handle,
+                                                              N,
+                                                              nullptr,
+                                                              incx,
+                                                              stride_x,
+                                                              dy,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count,
+                                                              d_dot_results,
+                                                              d_nrm2_results),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2_strided_batched_fn(handle,
+                                                              N,
+                                                              dx,
+                                                              incx,
+                                                              stride_x,
+                                                              nullptr,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count,
+                                                              d_dot_results,
+                                                              d_nrm2_results),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2_strided_batched_fn(handle,
+                                                              N,
+                                                              dx,
+                                                              incx,
+                                                              stride_x,
+                                                              dy,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count,
+                                                              nullptr,
+                                                              d_nrm2_results),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2_strided_batched_fn(handle,
+                                                              N,
+                                                              dx,
+                                                              incx,
+                                                              stride_x,
+                                                              dy,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count,
+                                                              d_dot_results,
+                                                              nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_dot_nrm2_strided_batched_fn(nullptr,
+                                                              N,
+                                                              dx,
+                                                              incx,
+                                                              stride_x,
+                                                              dy,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count,
+                                                              d_dot_results,
+                                                              d_nrm2_results),
+                          rocblas_status_invalid_handle);
+}
+
+template <typename T>
+void testing_dot_nrm2_strided_batched(const Arguments& arg)
+{
+    auto rocblas_dot_nrm2_strided_batched_fn = arg.fortran
+                                                   ? rocblas_dot_nrm2_strided_batched<T, true>
+                                                   : rocblas_dot_nrm2_strided_batched<T, false>;
+
+    rocblas_int    N           = arg.N;
+    rocblas_int    incx        = arg.incx;
+    rocblas_int    incy        = arg.incy;
+    rocblas_int    batch_count = arg.batch_count;
+    rocblas_int    abs_incx    = incx >= 0 ? incx : -incx;
+    rocblas_int    abs_incy    = incy >= 0 ? incy : -incy;
+    rocblas_stride stride_x    = arg.stride_x;
+    rocblas_stride stride_y    = arg.stride_y;
+    size_t         size_x      = N * size_t(abs_incx);
+    size_t         size_y      = N * size_t(abs_incy);
+    if(!size_x)
+        size_x = 1;
+    if(!size_y)
+        size_y = 1;
+
+    double               rocblas_error_1 = 0;
+    double               rocblas_error_2 = 0;
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0 || batch_count <= 0)
+    {
+        device_vector<T>         d_dot_results(std::max(batch_count, 1));
+        device_vector<real_t<T>> d_nrm2_results(std::max(batch_count, 1));
+        CHECK_DEVICE_ALLOCATION(d_dot_results.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_nrm2_results.memcheck());
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_dot_nrm2_strided_batched_fn(handle,
+                                                                N,
+                                                                nullptr,
+                                                                incx,
+                                                                stride_x,
+                                                                nullptr,
+                                                                incy,
+                                                                stride_y,
+                                                                batch_count,
+                                                                d_dot_results,
+                                                                d_nrm2_results));
+
+        if(batch_count > 0)
+        {
+            host_vector<T>         cpu_0(batch_count);
+            host_vector<T>         gpu_0(batch_count);
+            host_vector<real_t<T>> cpu_nrm2_0(batch_count);
+            host_vector<real_t<T>> gpu_nrm2_0(batch_count);
+            CHECK_HIP_ERROR(gpu_0.transfer_from(d_dot_results));
+            CHECK_HIP_ERROR(gpu_nrm2_0.transfer_from(d_nrm2_results));
+            unit_check_general<T>(1, 1, 1, 1, cpu_0, gpu_0, batch_count);
+            unit_check_general<real_t<T>>(1, 1, 1, 1, cpu_nrm2_0, gpu_nrm2_0, batch_count);
+        }
+        return;
+    }
+
+    host_vector<T>         cpu_dot(batch_count);
+    host_vector<T>         rocblas_dot_1(batch_count);
+    host_vector<T>         rocblas_dot_2(batch_count);
+    host_vector<real_t<T>> cpu_nrm2(batch_count);
+    host_vector<real_t<T>> rocblas_nrm2_1(batch_count);
+    host_vector<real_t<T>> rocblas_nrm2_2(batch_count);
+
+    size_x += size_t(stride_x) * size_t(batch_count - 1);
+    size_y += size_t(stride_y) * size_t(batch_count - 1);
+
+    // allocate memory on device
+    device_vector<T>         dx(size_x);
+    device_vector<T>         dy(size_y);
+    device_vector<T>         d_dot_results_2(batch_count);
+    device_vector<real_t<T>> d_nrm2_results_2(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_dot_results_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_nrm2_results_2.memcheck());
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    if(rocblas_isnan(arg.alpha))
+    {
+        rocblas_init_nan<T>(hx, 1, N, abs_incx, stride_x, batch_count);
+        rocblas_init_nan<T>(hy, 1, N, abs_incy, stride_y, batch_count);
+    }
+    else
+    {
+        rocblas_init<T>(hx, 1, N, abs_incx, stride_x, batch_count);
+        rocblas_init<T>(hy, 1, N, abs_incy, stride_y, batch_count);
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double gpu_time_used, cpu_time_used;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_dot_nrm2_strided_batched_fn(handle,
+                                                                N,
+                                                                dx,
+                                                                incx,
+                                                                stride_x,
+                                                                dy,
+                                                                incy,
+                                                                stride_y,
+                                                                batch_count,
+                                                                rocblas_dot_1,
+                                                                rocblas_nrm2_1));
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_dot_nrm2_strided_batched_fn(handle,
+                                                                N,
+                                                                dx,
+                                                                incx,
+                                                                stride_x,
+                                                                dy,
+                                                                incy,
+                                                                stride_y,
+                                                                batch_count,
+                                                                d_dot_results_2,
+                                                                d_nrm2_results_2));
+        CHECK_HIP_ERROR(rocblas_dot_2.transfer_from(d_dot_results_2));
+        CHECK_HIP_ERROR(rocblas_nrm2_2.transfer_from(d_nrm2_results_2));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < batch_count; ++b)
+        {
+            if constexpr(is_complex<T>)
+                cblas_dotc<T>(N, hx + b * stride_x, incx, hy + b * stride_y, incy, &cpu_dot[b]);
+            else
+                cblas_dot<T>(N, hx + b * stride_x, incx, hy + b * stride_y, incy, &cpu_dot[b]);
+            cblas_nrm2<T>(N, hx + b * stride_x, incx, &cpu_nrm2[b]);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        //  accounts for rounding in reduction sum. depends on n.
+        //  If test fails, try decreasing n or increasing tolerance.
+        real_t<T> abs_error = std::numeric_limits<real_t<T>>::epsilon() * N
+                              * std::max(cpu_nrm2[0], real_t<T>(1)) * real_t<T>(2.0);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, 1, 1, 1, cpu_dot, rocblas_dot_1, batch_count);
+            unit_check_general<T>(1, 1, 1, 1, cpu_dot, rocblas_dot_2, batch_count);
+            near_check_general<real_t<T>, real_t<T>>(
+                batch_count, 1, 1, cpu_nrm2, rocblas_nrm2_1, abs_error);
+            near_check_general<real_t<T>, real_t<T>>(
+                batch_count, 1, 1, cpu_nrm2, rocblas_nrm2_2, abs_error);
+        }
+
+        if(arg.norm_check)
+        {
+            for(int b = 0; b < batch_count; ++b)
+            {
+                rocblas_error_1 += rocblas_abs((cpu_nrm2[b] - rocblas_nrm2_1[b]) / cpu_nrm2[b]);
+                rocblas_error_2 += rocblas_abs((cpu_nrm2[b] - rocblas_nrm2_2[b]) / cpu_nrm2[b]);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_dot_nrm2_strided_batched_fn(handle,
+                                                N,
+                                                dx,
+                                                incx,
+                                                stride_x,
+                                                dy,
+                                                incy,
+                                                stride_y,
+                                                batch_count,
+                                                d_dot_results_2,
+                                                d_nrm2_results_2);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_dot_nrm2_strided_batched_fn(handle,
+                                                N,
+                                                dx,
+                                                incx,
+                                                stride_x,
+                                                dy,
+                                                incy,
+                                                stride_y,
+                                                batch_count,
+                                                d_dot_results_2,
+                                                d_nrm2_results_2);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_incx, e_incy, e_stride_x, e_stride_y, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            dot_nrm2_gflop_count<T>(N),
+            dot_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "near.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// Check the unit stride level 1 kernels on vectors which do not start on a 16 byte boundary, where
+// rocblas_vec_load and rocblas_vec_store access the elements one by one. This is done by:
+// - Starting x, y or both one element into their allocations, so that their base is misaligned
+//   for every T of less than 16 bytes
+// - Calling copy, swap, scal, axpy, rot, dot, asum and nrm2 with incx == incy == 1. rocblas_half
+//   only has scal, axpy, dot and nrm2, the first and last through scal_ex and nrm2_ex
+// - Checking x, y and the results against the CPU reference
+// The N of the yaml are mostly not multiples of rocblas_vec_width<T>, so the peeled remainder of
+// the kernels runs too.
+
+template <typename T>
+rocblas_status
+    testing_vector_access_scal(rocblas_handle handle, rocblas_int n, const T* alpha, T* x)
+{
+    if constexpr(std::is_same<T, rocblas_half>{})
+        return rocblas_scal_ex(handle,
+                               n,
+                               alpha,
+                               rocblas_datatype_f16_r,
+                               x,
+                               rocblas_datatype_f16_r,
+                               1,
+                               rocblas_datatype_f32_r);
+    else
+        return rocblas_scal<T>(handle, n, alpha, x, 1);
+}
+
+template <typename T, typename Tr>
+rocblas_status
+    testing_vector_access_nrm2(rocblas_handle handle, rocblas_int n, const T* x, Tr* result)
+{
+    if constexpr(std::is_same<T, rocblas_half>{})
+        return rocblas_nrm2_ex(handle,
+                               n,
+                               x,
+                               rocblas_datatype_f16_r,
+                               1,
+                               result,
+                               rocblas_datatype_f32_r,
+                               rocblas_datatype_f32_r);
+    else
+        return rocblas_nrm2<T>(handle, n, x, 1, result);
+}
+
+template <typename T>
+void testing_vector_access(const Arguments& arg)
+{
+    // nrm2_ex of rocblas_half returns a float
+    using Tr             = std::conditional_t<std::is_same<T, rocblas_half>{}, float, real_t<T>>;
+    constexpr bool HALF  = std::is_same<T, rocblas_half>{};
+    rocblas_int    N     = arg.N;
+    T              alpha = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    if(N <= 0)
+        return;
+
+    // one element more than N, to start x or y at the second element
+    device_vector<T> dx(N + 1);
+    device_vector<T> dy(N + 1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    host_vector<T>         hx(N);
+    host_vector<T>         hy(N);
+    host_vector<T>         rx(N);
+    host_vector<T>         ry(N);
+    host_vector<real_t<T>> hc(1);
+    host_vector<T>         hs(1);
+
+    rocblas_seedrand();
+    rocblas_init<T>(hx, 1, N, 1);
+    rocblas_init<T>(hy, 1, N, 1);
+    rocblas_init<real_t<T>>(hc, 1, 1, 1);
+    rocblas_init<T>(hs, 1, 1, 1);
+
+    // element offsets of x and y in their allocations
+    static const rocblas_int offsets[][2] = {{1, 1}, {1, 0}, {0, 1}};
+
+    for(auto& offset : offsets)
+    {
+        T* x = dx + offset[0];
+        T* y = dy + offset[1];
+
+        host_vector<T> cx(N);
+        host_vector<T> cy(N);
+
+        auto upload = [&]() {
+            cx = hx;
+            cy = hy;
+            CHECK_HIP_ERROR(hipMemcpy(x, hx, sizeof(T) * N, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(y, hy, sizeof(T) * N, hipMemcpyHostToDevice));
+        };
+
+        auto check_xy = [&]() {
+            CHECK_HIP_ERROR(hipMemcpy(rx, x, sizeof(T) * N, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(ry, y, sizeof(T) * N, hipMemcpyDeviceToHost));
+            unit_check_general<T>(1, N, 1, cx, rx);
+            unit_check_general<T>(1, N, 1, cy, ry);
+        };
+
+        // tolerance of the reductions asum and nrm2
+        auto check_sum = [&](Tr cpu_result, Tr rocblas_result) {
+            Tr abs_error
+                = std::numeric_limits<Tr>::epsilon() * N * std::max(Tr(1), cpu_result) * 2;
+            near_check_general<Tr, Tr>(1, 1, 1, &cpu_result, &rocblas_result, abs_error);
+        };
+
+        if constexpr(!HALF)
+        {
+            upload();
+            CHECK_ROCBLAS_ERROR(rocblas_copy<T>(handle, N, x, 1, y, 1));
+            cblas_copy<T>(N, cx, 1, cy, 1);
+            check_xy();
+
+            upload();
+            CHECK_ROCBLAS_ERROR(rocblas_swap<T>(handle, N, x, 1, y, 1));
+            cblas_swap<T>(N, cx, 1, cy, 1);
+            check_xy();
+
+            upload();
+            CHECK_ROCBLAS_ERROR((rocblas_rot<T, real_t<T>, T>(handle, N, x, 1, y, 1, hc, hs)));
+            cblas_rot<T, T, real_t<T>, T>(N, cx, 1, cy, 1, hc, hs);
+            check_xy();
+
+            Tr cpu_asum, rocblas_asum_result;
+            CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, N, x, 1, &rocblas_asum_result));
+            cblas_asum<T>(N, cx, 1, &cpu_asum);
+            check_sum(cpu_asum, rocblas_asum_result);
+        }
+
+        upload();
+        CHECK_ROCBLAS_ERROR(testing_vector_access_scal<T>(handle, N, &alpha, x));
+        cblas_scal<T, T*>(N, alpha, cx, 1);
+        check_xy();
+
+        upload();
+        CHECK_ROCBLAS_ERROR(rocblas_axpy<T>(handle, N, &alpha, x, 1, y, 1));
+        cblas_axpy<T>(N, alpha, cx, 1, cy, 1);
+        check_xy();
+
+        T cpu_dot, rocblas_dot_result;
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, x, 1, y, 1, &rocblas_dot_result));
+        cblas_dot<T>(N, cx, 1, cy, 1, &cpu_dot);
+        unit_check_general<T>(1, 1, 1, &cpu_dot, &rocblas_dot_result);
+
+        Tr cpu_nrm2, rocblas_nrm2_result;
+        CHECK_ROCBLAS_ERROR(testing_vector_access_nrm2(handle, N, x, &rocblas_nrm2_result));
+        if constexpr(HALF)
+        {
+            host_vector<float> cx_float(cx);
+            cblas_nrm2<float>(N, cx_float, 1, &cpu_nrm2);
+        }
+        else
+            cblas_nrm2<T>(N, cx, 1, &cpu_nrm2);
+        check_sum(cpu_nrm2, rocblas_nrm2_result);
+    }
+}
@@ -0,0 +1,544 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemv_grouped_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemv_grouped_fn
+        = arg.fortran ? rocblas_gemv_grouped<T, true> : rocblas_gemv_grouped<T, false>;
+
+    const rocblas_int M           = 100;
+    const rocblas_int N           = 100;
+    const rocblas_int lda         = 100;
+    const rocblas_int incx        = 1;
+    const rocblas_int incy        = 1;
+    const T           alpha       = 2.0;
+    const T           beta        = 0.5;
+    const T           zero        = 0.0;
+    const T           one         = 1.0;
+    const rocblas_int group_count = 5;
+
+    const rocblas_operation transA = rocblas_operation_none;
+
+    rocblas_local_handle handle{arg};
+
+    // allocate memory on device
+    device_batch_vector<T>     dA(size_t(lda) * N, 1, group_count);
+    device_batch_vector<T>     dx(N, incx, group_count);
+    device_batch_vector<T>     dy(M, incy, group_count);
+    device_vector<rocblas_int> dm(group_count);
+    device_vector<rocblas_int> dn(group_count);
+    device_vector<rocblas_int> dlda(group_count);
+    device_vector<rocblas_int> dincx(group_count);
+    device_vector<rocblas_int> dincy(group_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dm.memcheck());
+    CHECK_DEVICE_ALLOCATION(dn.memcheck());
+    CHECK_DEVICE_ALLOCATION(dlda.memcheck());
+    CHECK_DEVICE_ALLOCATION(dincx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dincy.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(nullptr,
+                                                  transA,
+                                                  dm,
+                                                  dn,
+                                                  &alpha,
+                                                  dA.ptr_on_device(),
+                                                  dlda,
+                                                  dx.ptr_on_device(),
+                                                  dincx,
+                                                  &beta,
+                                                  dy.ptr_on_device(),
+                                                  dincy,
+                                                  group_count),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  dm,
+                                                  dn,
+                                                  &alpha,
+                                                  dA.ptr_on_device(),
+                                                  dlda,
+                                                  dx.ptr_on_device(),
+                                                  dincx,
+                                                  &beta,
+                                                  dy.ptr_on_device(),
+                                                  dincy,
+                                                  -1),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  dm,
+                                                  dn,
+                                                  nullptr,
+                                                  dA.ptr_on_device(),
+                                                  dlda,
+                                                  dx.ptr_on_device(),
+                                                  dincx,
+                                                  &beta,
+                                                  dy.ptr_on_device(),
+                                                  dincy,
+                                                  group_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  dm,
+                                                  dn,
+                                                  &alpha,
+                                                  dA.ptr_on_device(),
+                                                  dlda,
+                                                  dx.ptr_on_device(),
+                                                  dincx,
+                                                  nullptr,
+                                                  dy.ptr_on_device(),
+                                                  dincy,
+                                                  group_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  dm,
+                                                  dn,
+                                                  &alpha,
+                                                  nullptr,
+                                                  dlda,
+                                                  dx.ptr_on_device(),
+                                                  dincx,
+                                                  &beta,
+                                                  dy.ptr_on_device(),
+                                                  dincy,
+                                                  group_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  dm,
+                                                  dn,
+                                                  &alpha,
+                                                  dA.ptr_on_device(),
+                                                  dlda,
+                                                  nullptr,
+                                                  dincx,
+                                                  &beta,
+                                                  dy.ptr_on_device(),
+                                                  dincy,
+                                                  group_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  dm,
+                                                  dn,
+                                                  &alpha,
+                                                  dA.ptr_on_device(),
+                                                  dlda,
+                                                  dx.ptr_on_device(),
+                                                  dincx,
+                                                  &beta,
+                                                  nullptr,
+                                                  dincy,
+                                                  group_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  nullptr,
+                                                  dn,
+                                                  &alpha,
+                                                  dA.ptr_on_device(),
+                                                  dlda,
+                                                  dx.ptr_on_device(),
+                                                  dincx,
+                                                  &beta,
+                                                  dy.ptr_on_device(),
+                                                  dincy,
+                                                  group_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  dm,
+                                                  dn,
+                                                  &alpha,
+                                                  dA.ptr_on_device(),
+                                                  nullptr,
+                                                  dx.ptr_on_device(),
+                                                  dincx,
+                                                  &beta,
+                                                  dy.ptr_on_device(),
+                                                  dincy,
+                                                  group_count),
+                          rocblas_status_invalid_pointer);
+
+    // If group_count==0, then all pointers may be nullptr without error
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  0),
+                          rocblas_status_success);
+
+    // If alpha==0 && beta==1, then all other pointers may be nullptr without error
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  nullptr,
+                                                  nullptr,
+                                                  &zero,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  &one,
+                                                  nullptr,
+                                                  nullptr,
+                                                  group_count),
+                          rocblas_status_success);
+
+    // If alpha==0, then A and x may be nullptr without error, y being scaled by beta
+    host_vector<rocblas_int> hsize(group_count), hinc(group_count);
+    for(rocblas_int p = 0; p < group_count; p++)
+    {
+        hsize[p] = M;
+        hinc[p]  = incx;
+    }
+    CHECK_HIP_ERROR(dm.transfer_from(hsize));
+    CHECK_HIP_ERROR(dn.transfer_from(hsize));
+    CHECK_HIP_ERROR(dlda.transfer_from(hsize));
+    CHECK_HIP_ERROR(dincx.transfer_from(hinc));
+    CHECK_HIP_ERROR(dincy.transfer_from(hinc));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                  transA,
+                                                  dm,
+                                                  dn,
+                                                  &zero,
+                                                  nullptr,
+                                                  dlda,
+                                                  nullptr,
+                                                  dincx,
+                                                  &beta,
+                                                  dy.ptr_on_device(),
+                                                  dincy,
+                                                  group_count),
+                          rocblas_status_success);
+}
+
+// Size of problem p of a group whose sizes are at most max_size, 0 included
+inline rocblas_int gemv_grouped_test_size(rocblas_int p, rocblas_int max_size)
+{
+    return (p * 37 + 11) % (max_size + 1);
+}
+
+template <typename T>
+void testing_gemv_grouped(const Arguments& arg)
+{
+    auto rocblas_gemv_grouped_fn
+        = arg.fortran ? rocblas_gemv_grouped<T, true> : rocblas_gemv_grouped<T, false>;
+
+    // M, N and lda are the largest sizes of the problems of the group, lda - M the padding of A
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       incx        = arg.incx;
+    rocblas_int       incy        = arg.incy;
+    T                 h_alpha     = arg.get_alpha<T>();
+    T                 h_beta      = arg.get_beta<T>();
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_int       group_count = arg.batch_count;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = group_count < 0;
+    if(invalid_size || !group_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_grouped_fn(handle,
+                                                      transA,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      group_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // sizes, leading dimensions and increments of the problems. Every 7th problem has an invalid
+    // lda, which gemv_grouped skips, and every 3rd problem negative increments
+    host_vector<rocblas_int> hm(group_count);
+    host_vector<rocblas_int> hn(group_count);
+    host_vector<rocblas_int> hlda(group_count);
+    host_vector<rocblas_int> hincx(group_count);
+    host_vector<rocblas_int> hincy(group_count);
+    for(rocblas_int p = 0; p < group_count; p++)
+    {
+        hm[p]    = gemv_grouped_test_size(p, M);
+        hn[p]    = gemv_grouped_test_size(p + 1, N);
+        hlda[p]  = p % 7 == 6 ? 0 : std::max(hm[p], 1) + std::max(lda - M, 0);
+        hincx[p] = p % 3 == 2 ? -incx : incx;
+        hincy[p] = p % 3 == 2 ? -incy : incy;
+    }
+
+    size_t abs_incx = incx >= 0 ? incx : -incx;
+    size_t abs_incy = incy >= 0 ? incy : -incy;
+    size_t dim_x    = transA == rocblas_operation_none ? N : M;
+    size_t dim_y    = transA == rocblas_operation_none ? M : N;
+
+    // every problem has a buffer of the largest size, which is compared as a whole
+    size_t size_A = std::max(size_t(std::max(lda, M)) * N, size_t(1));
+    size_t size_x = std::max(dim_x * abs_incx, size_t(1));
+    size_t size_y = std::max(dim_y * abs_incy, size_t(1));
+
+    // Host-arrays of pointers to host memory
+    host_batch_vector<T> hA(size_A, 1, group_count);
+    host_batch_vector<T> hx(size_x, 1, group_count);
+    host_batch_vector<T> hy_1(size_y, 1, group_count);
+    host_batch_vector<T> hy_2(size_y, 1, group_count);
+    host_batch_vector<T> hy_gold(size_y, 1, group_count);
+    host_vector<T>       halpha(1);
+    host_vector<T>       hbeta(1);
+    halpha[0] = h_alpha;
+    hbeta[0]  = h_beta;
+
+    // Host-arrays of pointers to device memory
+    // (intermediate arrays used for the transfers)
+    device_batch_vector<T>     dA(size_A, 1, group_count);
+    device_batch_vector<T>     dx(size_x, 1, group_count);
+    device_batch_vector<T>     dy_1(size_y, 1, group_count);
+    device_batch_vector<T>     dy_2(size_y, 1, group_count);
+    device_vector<rocblas_int> dm(group_count);
+    device_vector<rocblas_int> dn(group_count);
+    device_vector<rocblas_int> dlda(group_count);
+    device_vector<rocblas_int> dincx(group_count);
+    device_vector<rocblas_int> dincy(group_count);
+    device_vector<T>           d_alpha(1);
+    device_vector<T>           d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dm.memcheck());
+    CHECK_DEVICE_ALLOCATION(dn.memcheck());
+    CHECK_DEVICE_ALLOCATION(dlda.memcheck());
+    CHECK_DEVICE_ALLOCATION(dincx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dincy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initial Data on CPU
+    if(arg.alpha_isnan<T>())
+    {
+        rocblas_init_nan(hA, true);
+        rocblas_init_nan(hx, false);
+    }
+    else
+    {
+        rocblas_init(hA, true);
+        rocblas_init(hx, false);
+    }
+
+    if(arg.beta_isnan<T>())
+        rocblas_init_nan(hy_1, false);
+    else
+        rocblas_init(hy_1, false);
+
+    hy_2.copy_from(hy_1);
+    hy_gold.copy_from(hy_1);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_1.transfer_from(hy_1));
+    CHECK_HIP_ERROR(dm.transfer_from(hm));
+    CHECK_HIP_ERROR(dn.transfer_from(hn));
+    CHECK_HIP_ERROR(dlda.transfer_from(hlda));
+    CHECK_HIP_ERROR(dincx.transfer_from(hincx));
+    CHECK_HIP_ERROR(dincy.transfer_from(hincy));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dy_2.transfer_from(hy_2));
+        CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+        CHECK_HIP_ERROR(d_beta.transfer_from(hbeta));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_grouped_fn(handle,
+                                                    transA,
+                                                    dm,
+                                                    dn,
+                                                    &h_alpha,
+                                                    dA.ptr_on_device(),
+                                                    dlda,
+                                                    dx.ptr_on_device(),
+                                                    dincx,
+                                                    &h_beta,
+                                                    dy_1.ptr_on_device(),
+                                                    dincy,
+                                                    group_count));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_grouped_fn(handle,
+                                                    transA,
+                                                    dm,
+                                                    dn,
+                                                    d_alpha,
+                                                    dA.ptr_on_device(),
+                                                    dlda,
+                                                    dx.ptr_on_device(),
+                                                    dincx,
+                                                    d_beta,
+                                                    dy_2.ptr_on_device(),
+                                                    dincy,
+                                                    group_count));
+
+        // CPU BLAS, leaving y of the empty and skipped problems unchanged
+        cpu_time_used = get_time_us_no_sync();
+        for(int p = 0; p < group_count; ++p)
+        {
+            if(!hm[p] || !hn[p] || hlda[p] < hm[p])
+                continue;
+
+            cblas_gemv<T>(transA,
+                          hm[p],
+                          hn[p],
+                          h_alpha,
+                          hA[p],
+                          hlda[p],
+                          hx[p],
+                          hincx[p],
+                          h_beta,
+                          hy_gold[p],
+                          hincy[p]);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy device to host
+        CHECK_HIP_ERROR(hy_1.transfer_from(dy_1));
+        CHECK_HIP_ERROR(hy_2.transfer_from(dy_2));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, size_y, 1, hy_gold, hy_1, group_count);
+            unit_check_general<T>(1, size_y, 1, hy_gold, hy_2, group_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1
+                = norm_check_general<T>('F', 1, size_y, 1, hy_gold, hy_1, group_count);
+            rocblas_error_2
+                = norm_check_general<T>('F', 1, size_y, 1, hy_gold, hy_2, group_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemv_grouped_fn(handle,
+                                    transA,
+                                    dm,
+                                    dn,
+                                    &h_alpha,
+                                    dA.ptr_on_device(),
+                                    dlda,
+                                    dx.ptr_on_device(),
+                                    dincx,
+                                    &h_beta,
+                                    dy_1.ptr_on_device(),
+                                    dincy,
+                                    group_count);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_gemv_grouped_fn(handle,
+                                    transA,
+                                    dm,
+                                    dn,
+                                    &h_alpha,
+                                    dA.ptr_on_device(),
+                                    dlda,
+                                    dx.ptr_on_device(),
+                                    dincx,
+                                    &h_beta,
+                                    dy_1.ptr_on_device(),
+                                    dincy,
+                                    group_count);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // counts of the problems which are computed
+        double gflops = 0, gbytes = 0;
+        for(int p = 0; p < group_count; ++p)
+        {
+            if(!hm[p] || !hn[p] || hlda[p] < hm[p])
+                continue;
+
+            gflops += gemv_gflop_count<T>(transA, hm[p], hn[p]);
+            gbytes += gemv_gbyte_count<T>(transA, hm[p], hn[p]);
+        }
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy, e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gflops,
+                         gbytes,
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+}
@@ -0,0 +1,475 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemv_multi_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemv_multi_fn
+        = arg.fortran ? rocblas_gemv_multi<T, true> : rocblas_gemv_multi<T, false>;
+
+    const rocblas_int M        = 100;
+    const rocblas_int N        = 100;
+    const rocblas_int K        = 5;
+    const rocblas_int lda      = 100;
+    const rocblas_int incx     = 1;
+    const rocblas_int incy     = 1;
+    const T           alpha    = 2.0;
+    const T           beta     = 0.5;
+    const T           zero     = 0.0;
+    const T           one      = 1.0;
+    const rocblas_int stride_x = 100;
+    const rocblas_int stride_y = 100;
+
+    const rocblas_operation transA = rocblas_operation_none;
+
+    rocblas_local_handle handle{arg};
+
+    size_t size_A = lda * static_cast<size_t>(N);
+
+    // allocate memory on device
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(stride_x * K);
+    device_vector<T> dy(stride_y * K);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_fn(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                K,
+                                                &alpha,
+                                                nullptr,
+                                                lda,
+                                                dx,
+                                                incx,
+                                                stride_x,
+                                                &beta,
+                                                dy,
+                                                incy,
+                                                stride_y),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_fn(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                K,
+                                                &alpha,
+                                                dA,
+                                                lda,
+                                                nullptr,
+                                                incx,
+                                                stride_x,
+                                                &beta,
+                                                dy,
+                                                incy,
+                                                stride_y),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_fn(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                K,
+                                                &alpha,
+                                                dA,
+                                                lda,
+                                                dx,
+                                                incx,
+                                                stride_x,
+                                                &beta,
+                                                nullptr,
+                                                incy,
+                                                stride_y),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_fn(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                K,
+                                                nullptr,
+                                                dA,
+                                                lda,
+                                                dx,
+                                                incx,
+                                                stride_x,
+                                                &beta,
+                                                dy,
+                                                incy,
+                                                stride_y),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_fn(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                K,
+                                                &alpha,
+                                                dA,
+                                                lda,
+                                                dx,
+                                                incx,
+                                                stride_x,
+                                                nullptr,
+                                                dy,
+                                                incy,
+                                                stride_y),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_fn(nullptr,
+                                                transA,
+                                                M,
+                                                N,
+                                                K,
+                                                &alpha,
+                                                dA,
+                                                lda,
+                                                dx,
+                                                incx,
+                                                stride_x,
+                                                &beta,
+                                                dy,
+                                                incy,
+                                                stride_y),
+                          rocblas_status_invalid_handle);
+
+    // When K==0, all pointers may be nullptr without error
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_fn(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                0,
+                                                nullptr,
+                                                nullptr,
+                                                lda,
+                                                nullptr,
+                                                incx,
+                                                stride_x,
+                                                nullptr,
+                                                nullptr,
+                                                incy,
+                                                stride_y),
+                          rocblas_status_success);
+
+    // When alpha==0, A and x may be nullptr without error
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_fn(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                K,
+                                                &zero,
+                                                nullptr,
+                                                lda,
+                                                nullptr,
+                                                incx,
+                                                stride_x,
+                                                &beta,
+                                                dy,
+                                                incy,
+                                                stride_y),
+                          rocblas_status_success);
+
+    // When alpha==0 && beta==1, A, x and y may be nullptr without error
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_fn(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                K,
+                                                &zero,
+                                                nullptr,
+                                                lda,
+                                                nullptr,
+                                                incx,
+                                                stride_x,
+                                                &one,
+                                                nullptr,
+                                                incy,
+                                                stride_y),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_gemv_multi(const Arguments& arg)
+{
+    auto rocblas_gemv_multi_fn
+        = arg.fortran ? rocblas_gemv_multi<T, true> : rocblas_gemv_multi<T, false>;
+
+    rocblas_int       M        = arg.M;
+    rocblas_int       N        = arg.N;
+    rocblas_int       K        = arg.K;
+    rocblas_int       lda      = arg.lda;
+    rocblas_int       incx     = arg.incx;
+    rocblas_int       incy     = arg.incy;
+    T                 h_alpha  = arg.get_alpha<T>();
+    T                 h_beta   = arg.get_beta<T>();
+    rocblas_operation transA   = char2rocblas_operation(arg.transA);
+    rocblas_stride    stride_x = arg.stride_x;
+    rocblas_stride    stride_y = arg.stride_y;
+
+    rocblas_local_handle handle{arg};
+    size_t               size_A = lda * static_cast<size_t>(N);
+    size_t               size_x, dim_x, abs_incx;
+    size_t               size_y, dim_y, abs_incy;
+
+    if(transA == rocblas_operation_none)
+    {
+        dim_x = N;
+        dim_y = M;
+    }
+    else
+    {
+        dim_x = M;
+        dim_y = N;
+    }
+
+    abs_incx = incx >= 0 ? incx : -incx;
+    abs_incy = incy >= 0 ? incy : -incy;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < M || lda < 1 || !incx || !incy;
+    if(invalid_size || !M || !N || !K)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi_fn(handle,
+                                                    transA,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    nullptr,
+                                                    nullptr,
+                                                    lda,
+                                                    nullptr,
+                                                    incx,
+                                                    stride_x,
+                                                    nullptr,
+                                                    nullptr,
+                                                    incy,
+                                                    stride_y),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // vectors may be interleaved (stride < dim * inc) so size for the furthest element
+    size_x = (dim_x - 1) * abs_incx + size_t(stride_x) * (K - 1) + 1;
+    size_y = (dim_y - 1) * abs_incy + size_t(stride_y) * (K - 1) + 1;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hx(size_x);
+    host_vector<T> hy_1(size_y);
+    host_vector<T> hy_2(size_y);
+    host_vector<T> hy_gold(size_y);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(size_x);
+    device_vector<T> dy_1(size_y);
+    device_vector<T> dy_2(size_y);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    if(arg.alpha_isnan<T>())
+    {
+        rocblas_init_nan<T>(hA, M, N, lda);
+        rocblas_init_nan<T>(hx, 1, size_x, 1);
+    }
+    else
+    {
+        rocblas_init<T>(hA, M, N, lda);
+        rocblas_init<T>(hx, 1, size_x, 1);
+    }
+
+    if(arg.beta_isnan<T>())
+        rocblas_init_nan<T>(hy_1, 1, size_y, 1);
+    else
+        rocblas_init<T>(hy_1, 1, size_y, 1);
+
+    hy_gold = hy_1;
+    hy_2    = hy_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * size_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_multi_fn(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &h_alpha,
+                                                  dA,
+                                                  lda,
+                                                  dx,
+                                                  incx,
+                                                  stride_x,
+                                                  &h_beta,
+                                                  dy_1,
+                                                  incy,
+                                                  stride_y));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_multi_fn(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  d_alpha,
+                                                  dA,
+                                                  lda,
+                                                  dx,
+                                                  incx,
+                                                  stride_x,
+                                                  d_beta,
+                                                  dy_2,
+                                                  incy,
+                                                  stride_y));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+        for(int j = 0; j < K; ++j)
+        {
+            cblas_gemv<T>(transA,
+                          M,
+                          N,
+                          h_alpha,
+                          hA,
+                          lda,
+                          hx + j * stride_x,
+                          incx,
+                          h_beta,
+                          hy_gold + j * stride_y,
+                          incy);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+        // the whole buffer is compared, which also checks that nothing outside the vectors changed
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, size_y, 1, hy_gold, hy_1);
+            unit_check_general<T>(1, size_y, 1, hy_gold, hy_2);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', 1, size_y, 1, hy_gold, hy_1);
+            rocblas_error_2 = norm_check_general<T>('F', 1, size_y, 1, hy_gold, hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemv_multi_fn(handle,
+                                  transA,
+                                  M,
+                                  N,
+                                  K,
+                                  &h_alpha,
+                                  dA,
+                                  lda,
+                                  dx,
+                                  incx,
+                                  stride_x,
+                                  &h_beta,
+                                  dy_1,
+                                  incy,
+                                  stride_y);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_gemv_multi_fn(handle,
+                                  transA,
+                                  M,
+                                  N,
+                                  K,
+                                  &h_alpha,
+                                  dA,
+                                  lda,
+                                  dx,
+                                  incx,
+                                  stride_x,
+                                  &h_beta,
+                                  dy_1,
+                                  incy,
+                                  stride_y);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_transA,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_incx,
+                      e_stride_x,
+                      e_beta,
+                      e_incy,
+                      e_stride_y>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemv_multi_gflop_count<T>(transA, M, N, K),
+                         gemv_multi_gbyte_count<T>(transA, M, N, K),
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+}
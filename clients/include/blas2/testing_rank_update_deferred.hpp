@@ -0,0 +1,374 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// deferred rank updates tested by testing_rank_update_deferred
+enum class rocblas_rank_update_test
+{
+    ger,
+    gerc,
+    syr,
+    her,
+    syr2,
+    her2,
+};
+
+// RAII helper for rocblas_rank_update
+class rocblas_local_rank_update
+{
+    rocblas_rank_update m_update = nullptr;
+
+public:
+    explicit rocblas_local_rank_update(rocblas_int k)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_create_rank_update(&m_update, k));
+    }
+
+    ~rocblas_local_rank_update()
+    {
+        rocblas_destroy_rank_update(m_update);
+    }
+
+    rocblas_local_rank_update(const rocblas_local_rank_update&) = delete;
+    rocblas_local_rank_update& operator=(const rocblas_local_rank_update&) = delete;
+
+    operator rocblas_rank_update() const
+    {
+        return m_update;
+    }
+};
+
+template <typename T>
+void testing_rank_update_deferred_bad_arg(const Arguments& arg)
+{
+    auto rocblas_ger_deferred_fn = arg.fortran ? rocblas_ger_deferred<T, false, true>
+                                               : rocblas_ger_deferred<T, false, false>;
+
+    rocblas_int M     = 100;
+    rocblas_int N     = 100;
+    rocblas_int incx  = 1;
+    rocblas_int incy  = 1;
+    rocblas_int lda   = 100;
+    T           alpha = 0.6;
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_rank_update created;
+    EXPECT_ROCBLAS_STATUS(rocblas_create_rank_update(nullptr, 16), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_create_rank_update(&created, 1), rocblas_status_invalid_size);
+
+    rocblas_local_rank_update local_update(16);
+    rocblas_rank_update       u = local_update;
+
+    // allocate memory on device
+    device_vector<T> dA(size_t(lda) * N);
+    device_vector<T> dx(M * size_t(incx));
+    device_vector<T> dy(N * size_t(incy));
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_deferred_fn(handle, nullptr, M, N, &alpha, dx, incx, dy, incy, dA, lda),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_deferred_fn(handle, u, M, N, &alpha, nullptr, incx, dy, incy, dA, lda),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_deferred_fn(handle, u, M, N, &alpha, dx, incx, nullptr, incy, dA, lda),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_deferred_fn(handle, u, M, N, &alpha, dx, incx, dy, incy, nullptr, lda),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_deferred_fn(nullptr, u, M, N, &alpha, dx, incx, dy, incy, dA, lda),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        (rocblas_syr_deferred<T>)(handle, u, rocblas_fill_full, N, &alpha, dx, incx, dA, lda),
+        rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_rank_update_flush(nullptr, u), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_rank_update_flush(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+}
+
+// Applies batch_count updates of a matrix with a rocblas_rank_update holding K vectors, so that
+// the updates are applied by the calls which fill the buffer and by the final flush, and
+// compares the matrix with the one updated by batch_count calls to CBLAS.
+template <typename T, rocblas_rank_update_test OP>
+void testing_rank_update_deferred(const Arguments& arg)
+{
+    static constexpr bool GENERAL
+        = OP == rocblas_rank_update_test::ger || OP == rocblas_rank_update_test::gerc;
+    static constexpr bool RANK2
+        = OP == rocblas_rank_update_test::syr2 || OP == rocblas_rank_update_test::her2;
+    static constexpr bool CONJ  = OP == rocblas_rank_update_test::gerc;
+    static constexpr bool HAS_Y = GENERAL || RANK2;
+
+    // alpha is real for her
+    using U = std::conditional_t<OP == rocblas_rank_update_test::her, real_t<T>, T>;
+
+    bool FORTRAN = arg.fortran;
+
+    // calls the deferred function of OP, y is unused by syr and her
+    auto rocblas_deferred_fn = [FORTRAN](rocblas_handle      handle,
+                                         rocblas_rank_update update,
+                                         rocblas_fill        uplo,
+                                         rocblas_int         m,
+                                         rocblas_int         n,
+                                         const U*            alpha,
+                                         const T*            x,
+                                         rocblas_int         incx,
+                                         const T*            y,
+                                         rocblas_int         incy,
+                                         T*                  A,
+                                         rocblas_int         lda) {
+        if constexpr(GENERAL)
+            return (FORTRAN ? rocblas_ger_deferred<T, CONJ, true>
+                            : rocblas_ger_deferred<T, CONJ, false>)(
+                handle, update, m, n, alpha, x, incx, y, incy, A, lda);
+        else if constexpr(OP == rocblas_rank_update_test::syr)
+            return (FORTRAN ? rocblas_syr_deferred<T, true> : rocblas_syr_deferred<T, false>)(
+                handle, update, uplo, n, alpha, x, incx, A, lda);
+        else if constexpr(OP == rocblas_rank_update_test::her)
+            return (FORTRAN ? rocblas_her_deferred<T, true> : rocblas_her_deferred<T, false>)(
+                handle, update, uplo, n, alpha, x, incx, A, lda);
+        else if constexpr(OP == rocblas_rank_update_test::syr2)
+            return (FORTRAN ? rocblas_syr2_deferred<T, true> : rocblas_syr2_deferred<T, false>)(
+                handle, update, uplo, n, alpha, x, incx, y, incy, A, lda);
+        else
+            return (FORTRAN ? rocblas_her2_deferred<T, true> : rocblas_her2_deferred<T, false>)(
+                handle, update, uplo, n, alpha, x, incx, y, incy, A, lda);
+    };
+
+    rocblas_int  N       = arg.N;
+    rocblas_int  M       = GENERAL ? arg.M : N;
+    rocblas_int  K       = arg.K;
+    rocblas_int  updates = arg.batch_count;
+    rocblas_int  incx    = arg.incx;
+    rocblas_int  incy    = arg.incy;
+    rocblas_int  lda     = arg.lda;
+    rocblas_fill uplo    = GENERAL ? rocblas_fill_full : char2rocblas_fill(arg.uplo);
+    U            h_alpha = arg.get_alpha<U>();
+
+    rocblas_local_handle      handle{arg};
+    rocblas_local_rank_update update(K);
+
+    // argument check before allocating invalid memory
+    if(M < 0 || N < 0 || lda < M || lda < 1 || !incx || (HAS_Y && !incy) || updates <= 0)
+    {
+        if(updates > 0)
+            EXPECT_ROCBLAS_STATUS(rocblas_deferred_fn(handle,
+                                                      update,
+                                                      uplo,
+                                                      M,
+                                                      N,
+                                                      nullptr,
+                                                      nullptr,
+                                                      incx,
+                                                      nullptr,
+                                                      incy,
+                                                      nullptr,
+                                                      lda),
+                                  rocblas_status_invalid_size);
+        return;
+    }
+
+    size_t abs_incx = incx >= 0 ? incx : -incx;
+    size_t abs_incy = incy >= 0 ? incy : -incy;
+    size_t size_A   = size_t(lda) * N;
+    size_t size_x   = M * abs_incx;
+    size_t size_y   = N * abs_incy;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA_1(size_A);
+    host_vector<T> hA_2(size_A);
+    host_vector<T> hA_gold(size_A);
+    host_vector<T> hx(size_x * updates);
+    host_vector<T> hy(size_y * updates);
+
+    // allocate memory on device
+    device_vector<T> dA_1(size_A);
+    device_vector<T> dA_2(size_A);
+    device_vector<T> dx(size_x * updates);
+    device_vector<T> dy(size_y * updates);
+    device_vector<U> d_alpha(1);
+
+    CHECK_DEVICE_ALLOCATION(dA_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    rocblas_init<T>(hA_1, M, N, lda);
+    rocblas_init<T>(hx, 1, M, abs_incx, size_x, updates);
+    rocblas_init<T>(hy, 1, N, abs_incy, size_y, updates);
+
+    hA_gold = hA_1;
+    hA_2    = hA_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA_1, hA_1, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * size_x * updates, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * size_y * updates, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(dA_2, hA_2, sizeof(T) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(U), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        for(rocblas_int u = 0; u < updates; u++)
+            CHECK_ROCBLAS_ERROR(rocblas_deferred_fn(handle,
+                                                    update,
+                                                    uplo,
+                                                    M,
+                                                    N,
+                                                    &h_alpha,
+                                                    dx + u * size_x,
+                                                    incx,
+                                                    dy + u * size_y,
+                                                    incy,
+                                                    dA_1,
+                                                    lda));
+
+        // the pending updates of dA_1 are applied by the first update of dA_2
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        for(rocblas_int u = 0; u < updates; u++)
+            CHECK_ROCBLAS_ERROR(rocblas_deferred_fn(handle,
+                                                    update,
+                                                    uplo,
+                                                    M,
+                                                    N,
+                                                    d_alpha,
+                                                    dx + u * size_x,
+                                                    incx,
+                                                    dy + u * size_y,
+                                                    incy,
+                                                    dA_2,
+                                                    lda));
+        CHECK_ROCBLAS_ERROR(rocblas_rank_update_flush(handle, update));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        for(rocblas_int u = 0; u < updates; u++)
+        {
+            T* x = hx + u * size_x;
+            T* y = hy + u * size_y;
+            if constexpr(GENERAL)
+                cblas_ger<T, CONJ>(M, N, h_alpha, x, incx, y, incy, hA_gold, lda);
+            else if constexpr(OP == rocblas_rank_update_test::syr)
+                cblas_syr<T>(uplo, N, h_alpha, x, incx, hA_gold, lda);
+            else if constexpr(OP == rocblas_rank_update_test::her)
+                cblas_her<T>(uplo, N, h_alpha, x, incx, hA_gold, lda);
+            else if constexpr(OP == rocblas_rank_update_test::syr2)
+                cblas_syr2<T>(uplo, N, h_alpha, x, incx, y, incy, hA_gold, lda);
+            else
+                cblas_her2<T>(uplo, N, h_alpha, x, incx, y, incy, hA_gold, lda);
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hA_1, dA_1, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hA_2, dA_2, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+        {
+            // the rank-k update sums the products in another order than the rank-1 updates
+            const double tol = updates * sum_error_tolerance<T>;
+            near_check_general<T>(M, N, lda, hA_gold, hA_1, tol);
+            near_check_general<T>(M, N, lda, hA_gold, hA_2, tol);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', M, N, lda, hA_gold, hA_1);
+            rocblas_error_2 = norm_check_general<T>('F', M, N, lda, hA_gold, hA_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        // one call applies all the updates
+        auto deferred_updates = [&]() {
+            for(rocblas_int u = 0; u < updates; u++)
+                rocblas_deferred_fn(handle,
+                                    update,
+                                    uplo,
+                                    M,
+                                    N,
+                                    &h_alpha,
+                                    dx + u * size_x,
+                                    incx,
+                                    dy + u * size_y,
+                                    incy,
+                                    dA_1,
+                                    lda);
+            rocblas_rank_update_flush(handle, update);
+        };
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            deferred_updates();
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+            deferred_updates();
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        double gflops = [&]() {
+            if constexpr(GENERAL)
+                return ger_gflop_count<T, CONJ>(M, N);
+            else if constexpr(OP == rocblas_rank_update_test::syr)
+                return syr_gflop_count<T>(N);
+            else if constexpr(OP == rocblas_rank_update_test::her)
+                return her_gflop_count<T>(N);
+            else if constexpr(OP == rocblas_rank_update_test::syr2)
+                return syr2_gflop_count<T>(N);
+            else
+                return her2_gflop_count<T>(N);
+        }();
+
+        ArgumentModel<e_uplo, e_M, e_N, e_K, e_alpha, e_lda, e_incx, e_incy, e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         updates * gflops,
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+}
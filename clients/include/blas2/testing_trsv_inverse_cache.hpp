@@ -0,0 +1,214 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// Check the trsv inverse cache of the handle:
+// - With a cache large enough for the inverses of A, solve twice with transA, the first solve
+//   computing and caching the inverses of the diagonal blocks of A, the second one using them
+// - Change an element of the first diagonal block of A in place without changing the version, and
+//   check that the next solve still solves with the previous A, which shows the cached inverses
+//   are used
+// - Scale A in place and change the version, so that the next solve does not use the stale
+//   inverses, and check that its solution is the one of the scaled A
+// - With a cache too small for the inverses of A, check that solves are still correct
+// Timing measures solves which use the cached inverses.
+template <typename T>
+void testing_trsv_inverse_cache(const Arguments& arg)
+{
+    auto rocblas_trsv_fn = arg.fortran ? rocblas_trsv<T, true> : rocblas_trsv<T, false>;
+
+    rocblas_int M           = arg.M;
+    rocblas_int lda         = arg.lda;
+    rocblas_int incx        = arg.incx;
+    char        char_uplo   = arg.uplo;
+    char        char_transA = arg.transA;
+    char        char_diag   = arg.diag;
+
+    rocblas_fill      uplo   = char2rocblas_fill(char_uplo);
+    rocblas_operation transA = char2rocblas_operation(char_transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(char_diag);
+
+    rocblas_local_handle handle{arg};
+
+    size_t size = 1;
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsv_inverse_cache_size(handle, &size));
+    EXPECT_EQ(size, 0);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_trsv_inverse_cache_size(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || lda < M || lda < 1 || !incx;
+    if(invalid_size || !M)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_trsv_inverse_cache_size(handle, 1 << 20));
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_trsv_fn(handle, uplo, transA, diag, M, nullptr, lda, nullptr, incx),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // an inverse takes 128 * M elements
+    size_t cache_size = sizeof(T) * 128 * M;
+    CHECK_ROCBLAS_ERROR(rocblas_set_trsv_inverse_cache_size(handle, cache_size));
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsv_inverse_cache_size(handle, &size));
+    EXPECT_EQ(size, cache_size);
+
+    size_t size_A   = size_t(lda) * size_t(M);
+    size_t abs_incx = size_t(incx >= 0 ? incx : -incx);
+    size_t size_x   = M * abs_incx;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> AAT(size_A);
+    host_vector<T> hb(size_x);
+    host_vector<T> hx(size_x);
+    host_vector<T> hx_or_b(size_x);
+
+    double gpu_time_used, cpu_time_used;
+    double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
+    double eps                  = std::numeric_limits<real_t<T>>::epsilon();
+    double max_err              = 0.0;
+
+    // allocate memory on device
+    device_vector<T> dA(size_A);
+    device_vector<T> dx_or_b(size_x);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_or_b.memcheck());
+
+    rocblas_init<T>(hA, M, M, lda);
+
+    //  calculate AAT = hA * hA ^ T or AAT = hA * hA ^ H if complex
+    cblas_gemm<T>(rocblas_operation_none,
+                  rocblas_operation_conjugate_transpose,
+                  M,
+                  M,
+                  M,
+                  T(1.0),
+                  hA,
+                  lda,
+                  hA,
+                  lda,
+                  T(0.0),
+                  AAT,
+                  lda);
+
+    //  copy AAT into hA, make hA strictly diagonal dominant, and therefore SPD
+    for(int i = 0; i < M; i++)
+    {
+        T t = 0.0;
+        for(int j = 0; j < M; j++)
+        {
+            hA[i + j * lda] = AAT[i + j * lda];
+            t += rocblas_abs(AAT[i + j * lda]);
+        }
+        hA[i + i * lda] = t;
+    }
+
+    //  calculate Cholesky factorization of SPD (or Hermitian if complex) matrix hA
+    cblas_potrf<T>(char_uplo, M, hA, lda);
+
+    //initialize "exact" answer hx
+    rocblas_init<T>(hx, 1, M, abs_incx);
+
+    // solves A x = b on the device for b = A * hx, and checks the forward error
+    auto solve_and_check = [&]() {
+        hb = hx;
+        cblas_trmv<T>(uplo, transA, diag, M, hA, lda, hb, incx);
+        CHECK_HIP_ERROR(hipMemcpy(dx_or_b, hb, sizeof(T) * size_x, hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_trsv_fn(handle, uplo, transA, diag, M, dA, lda, dx_or_b, incx));
+        CHECK_HIP_ERROR(hipMemcpy(hx_or_b, dx_or_b, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+
+        max_err = rocblas_abs(vector_norm_1<T>(M, abs_incx, hx, hx_or_b));
+        trsm_err_res_check<T>(max_err, M, error_eps_multiplier, eps);
+    };
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // the first solve caches the inverses, the second one uses them
+        solve_and_check();
+        solve_and_check();
+
+        // The element below or right of the first diagonal element of A is only read through the
+        // inverse of the first diagonal block, so changing it on the device alone is not seen
+        // while the cached inverses are used
+        if(M > 1)
+        {
+            host_vector<T> hA_changed(size_A);
+            hA_changed = hA;
+            hA_changed[uplo == rocblas_fill_lower ? 1 : lda] += T(1);
+            CHECK_HIP_ERROR(hipMemcpy(dA, hA_changed, sizeof(T) * size_A, hipMemcpyHostToDevice));
+            solve_and_check();
+        }
+
+        // scale A in place, the inverses of the previous version must not be used
+        for(size_t i = 0; i < size_A; i++)
+            hA[i] = hA[i] * T(2);
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_trsv_inverse_cache_version(handle, 1));
+        solve_and_check();
+        solve_and_check();
+
+        // inverses which do not fit are not cached
+        CHECK_ROCBLAS_ERROR(rocblas_set_trsv_inverse_cache_size(handle, cache_size - 1));
+        solve_and_check();
+        solve_and_check();
+        CHECK_ROCBLAS_ERROR(rocblas_set_trsv_inverse_cache_size(handle, cache_size));
+    }
+
+    if(arg.timing)
+    {
+        // GPU rocBLAS, the cold calls cache the inverses
+        CHECK_HIP_ERROR(hipMemcpy(dx_or_b, hx, sizeof(T) * size_x, hipMemcpyHostToDevice));
+
+        int number_cold_calls = std::max(arg.cold_iters, 1);
+        int number_hot_calls  = arg.iters;
+
+        for(int i = 0; i < number_cold_calls; i++)
+            rocblas_trsv_fn(handle, uplo, transA, diag, M, dA, lda, dx_or_b, incx);
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int i = 0; i < number_hot_calls; i++)
+            rocblas_trsv_fn(handle, uplo, transA, diag, M, dA, lda, dx_or_b, incx);
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // CPU cblas
+        cpu_time_used = get_time_us_no_sync();
+
+        if(arg.norm_check)
+            cblas_trsv<T>(uplo, transA, diag, M, hA, lda, hx, incx);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        ArgumentModel<e_uplo, e_transA, e_diag, e_M, e_lda, e_incx>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            trsv_gflop_count<T>(M),
+            ArgumentLogging::NA_value,
+            cpu_time_used,
+            max_err,
+            max_err);
+    }
+}
@@ -0,0 +1,729 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_gemm_grouped_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_grouped_fn
+        = arg.fortran ? rocblas_gemm_grouped<T, true> : rocblas_gemm_grouped<T, false>;
+
+    const rocblas_int M           = 100;
+    const rocblas_int N           = 100;
+    const rocblas_int K           = 100;
+    const rocblas_int lda_        = 100;
+    const rocblas_int ldb_        = 100;
+    const rocblas_int ldc_        = 100;
+    const T           alpha       = 2.0;
+    const T           beta        = 0.5;
+    const T           zero        = 0.0;
+    const T           one         = 1.0;
+    const rocblas_int group_count = 5;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    rocblas_local_handle handle{arg};
+
+    // allocate memory on device
+    device_batch_vector<T>     dA(size_t(lda_) * K, 1, group_count);
+    device_batch_vector<T>     dB(size_t(ldb_) * N, 1, group_count);
+    device_batch_vector<T>     dC(size_t(ldc_) * N, 1, group_count);
+    device_vector<rocblas_int> dm(group_count);
+    device_vector<rocblas_int> dn(group_count);
+    device_vector<rocblas_int> dk(group_count);
+    device_vector<rocblas_int> dlda(group_count);
+    device_vector<rocblas_int> dldb(group_count);
+    device_vector<rocblas_int> dldc(group_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dm.memcheck());
+    CHECK_DEVICE_ALLOCATION(dn.memcheck());
+    CHECK_DEVICE_ALLOCATION(dk.memcheck());
+    CHECK_DEVICE_ALLOCATION(dlda.memcheck());
+    CHECK_DEVICE_ALLOCATION(dldb.memcheck());
+    CHECK_DEVICE_ALLOCATION(dldc.memcheck());
+
+    host_vector<rocblas_int> hm(group_count);
+    host_vector<rocblas_int> hn(group_count);
+    host_vector<rocblas_int> hk(group_count);
+    host_vector<rocblas_int> hlda(group_count);
+    host_vector<rocblas_int> hldb(group_count);
+    host_vector<rocblas_int> hldc(group_count);
+    for(rocblas_int p = 0; p < group_count; p++)
+    {
+        hm[p]   = M;
+        hn[p]   = N;
+        hk[p]   = K;
+        hlda[p] = lda_;
+        hldb[p] = ldb_;
+        hldc[p] = ldc_;
+    }
+    CHECK_HIP_ERROR(dm.transfer_from(hm));
+    CHECK_HIP_ERROR(dn.transfer_from(hn));
+    CHECK_HIP_ERROR(dk.transfer_from(hk));
+    CHECK_HIP_ERROR(dlda.transfer_from(hlda));
+    CHECK_HIP_ERROR(dldb.transfer_from(hldb));
+    CHECK_HIP_ERROR(dldc.transfer_from(hldc));
+
+    // the arrays of pointers to the matrices, in host or device memory
+    T* const* hA = dA;
+    T* const* hB = dB;
+    T* const* hC = dC;
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    for(auto array_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        bool               host_arrays = array_mode == rocblas_pointer_mode_host;
+        const rocblas_int* m           = host_arrays ? (rocblas_int*)hm : (rocblas_int*)dm;
+        const rocblas_int* n           = host_arrays ? (rocblas_int*)hn : (rocblas_int*)dn;
+        const rocblas_int* k           = host_arrays ? (rocblas_int*)hk : (rocblas_int*)dk;
+        const rocblas_int* lda         = host_arrays ? (rocblas_int*)hlda : (rocblas_int*)dlda;
+        const rocblas_int* ldb         = host_arrays ? (rocblas_int*)hldb : (rocblas_int*)dldb;
+        const rocblas_int* ldc         = host_arrays ? (rocblas_int*)hldc : (rocblas_int*)dldc;
+        T* const*          A           = host_arrays ? hA : dA.ptr_on_device();
+        T* const*          B           = host_arrays ? hB : dB.ptr_on_device();
+        T* const*          C           = host_arrays ? hC : dC.ptr_on_device();
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(nullptr,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      rocblas_pointer_mode(-1),
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      ldc,
+                                                      -1),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      nullptr,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      nullptr,
+                                                      C,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      nullptr,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      A,
+                                                      lda,
+                                                      nullptr,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      &beta,
+                                                      nullptr,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      nullptr,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      nullptr,
+                                                      &alpha,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      A,
+                                                      nullptr,
+                                                      B,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      nullptr,
+                                                      group_count),
+                              rocblas_status_invalid_pointer);
+
+        // If group_count==0, then all pointers may be nullptr without error
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      0),
+                              rocblas_status_success);
+
+        // If alpha==0 && beta==1, then all other pointers may be nullptr without error
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      &zero,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      &one,
+                                                      nullptr,
+                                                      nullptr,
+                                                      group_count),
+                              rocblas_status_success);
+
+        // If alpha==0, then A and B may be nullptr without error, C being scaled by beta
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      array_mode,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &zero,
+                                                      nullptr,
+                                                      lda,
+                                                      nullptr,
+                                                      ldb,
+                                                      &beta,
+                                                      C,
+                                                      ldc,
+                                                      group_count),
+                              rocblas_status_success);
+    }
+
+    // the problems of host arrays are checked like the arguments of gemm
+    auto check_host_arrays = [&](T* const* C, rocblas_status status) {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_fn(handle,
+                                                      rocblas_pointer_mode_host,
+                                                      transA,
+                                                      transB,
+                                                      hm,
+                                                      hn,
+                                                      hk,
+                                                      &alpha,
+                                                      hA,
+                                                      hlda,
+                                                      hB,
+                                                      hldb,
+                                                      &beta,
+                                                      C,
+                                                      hldc,
+                                                      group_count),
+                              status);
+    };
+
+    hk[1] = -1;
+    check_host_arrays(hC, rocblas_status_invalid_size);
+    hk[1]   = K;
+    hlda[2] = M - 1;
+    check_host_arrays(hC, rocblas_status_invalid_size);
+    hlda[2] = lda_;
+    hldc[4] = M - 1;
+    check_host_arrays(hC, rocblas_status_invalid_size);
+    hldc[4] = ldc_;
+
+    host_vector<T*> hC_null(group_count);
+    for(rocblas_int p = 0; p < group_count; p++)
+        hC_null[p] = p == 3 ? nullptr : dC[p];
+    check_host_arrays(hC_null, rocblas_status_invalid_pointer);
+
+    // the matrices of an empty problem are not referenced
+    hm[3] = 0;
+    check_host_arrays(hC_null, rocblas_status_success);
+}
+
+// Size of problem p of a group whose sizes are at most max_size, 0 included
+inline rocblas_int gemm_grouped_test_size(rocblas_int p, rocblas_int max_size)
+{
+    return (p * 37 + 11) % (max_size + 1);
+}
+
+template <typename T>
+void testing_gemm_grouped(const Arguments& arg)
+{
+    auto rocblas_gemm_grouped_fn
+        = arg.fortran ? rocblas_gemm_grouped<T, true> : rocblas_gemm_grouped<T, false>;
+
+    // M, N, K and the leading dimensions are the largest of the problems of the group, the first
+    // problem having the largest sizes
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       K           = arg.K;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       ldb         = arg.ldb;
+    rocblas_int       ldc         = arg.ldc;
+    T                 h_alpha     = arg.get_alpha<T>();
+    T                 h_beta      = arg.get_beta<T>();
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_operation transB      = char2rocblas_operation(arg.transB);
+    rocblas_int       group_count = arg.batch_count;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = group_count < 0;
+    if(invalid_size || !group_count)
+    {
+        for(auto array_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_gemm_grouped_fn(handle,
+                                        array_mode,
+                                        transA,
+                                        transB,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr,
+                                        group_count),
+                invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        }
+        return;
+    }
+
+    bool        none_a = transA == rocblas_operation_none;
+    bool        none_b = transB == rocblas_operation_none;
+    rocblas_int A_row  = none_a ? M : K;
+    rocblas_int A_col  = none_a ? K : M;
+    rocblas_int B_row  = none_b ? K : N;
+    rocblas_int B_col  = none_b ? N : K;
+    rocblas_int pad_a  = std::max(lda - A_row, 0);
+    rocblas_int pad_b  = std::max(ldb - B_row, 0);
+    rocblas_int pad_c  = std::max(ldc - M, 0);
+
+    // Sizes and leading dimensions of the problems. Every 7th problem of the device arrays has an
+    // invalid lda, which gemm_grouped skips, and no rows in the host arrays, whose sizes must be
+    // valid, so both give the same result.
+    host_vector<rocblas_int> hm(group_count);
+    host_vector<rocblas_int> hn(group_count);
+    host_vector<rocblas_int> hk(group_count);
+    host_vector<rocblas_int> hlda(group_count);
+    host_vector<rocblas_int> hldb(group_count);
+    host_vector<rocblas_int> hldc(group_count);
+    host_vector<rocblas_int> hm_host(group_count);
+    host_vector<rocblas_int> hlda_device(group_count);
+    for(rocblas_int p = 0; p < group_count; p++)
+    {
+        bool skip = p % 7 == 6;
+
+        hm[p]          = p ? gemm_grouped_test_size(p, M) : M;
+        hn[p]          = p ? gemm_grouped_test_size(p + 1, N) : N;
+        hk[p]          = p ? gemm_grouped_test_size(p + 2, K) : K;
+        hlda[p]        = std::max(none_a ? hm[p] : hk[p], 1) + pad_a;
+        hldb[p]        = std::max(none_b ? hk[p] : hn[p], 1) + pad_b;
+        hldc[p]        = std::max(hm[p], 1) + pad_c;
+        hm_host[p]     = skip ? 0 : hm[p];
+        hlda_device[p] = skip ? -1 : hlda[p];
+    }
+
+    // every problem has a buffer of the largest size, which is compared as a whole
+    size_t size_A = std::max(size_t(std::max(lda, A_row)) * A_col, size_t(1));
+    size_t size_B = std::max(size_t(std::max(ldb, B_row)) * B_col, size_t(1));
+    size_t size_C = std::max(size_t(std::max(ldc, M)) * N, size_t(1));
+
+    // Host-arrays of pointers to host memory
+    host_batch_vector<T> hA(size_A, 1, group_count);
+    host_batch_vector<T> hB(size_B, 1, group_count);
+    host_batch_vector<T> hC_1(size_C, 1, group_count);
+    host_batch_vector<T> hC_2(size_C, 1, group_count);
+    host_batch_vector<T> hC_gold(size_C, 1, group_count);
+    host_vector<T>       halpha(1);
+    host_vector<T>       hbeta(1);
+    halpha[0] = h_alpha;
+    hbeta[0]  = h_beta;
+
+    // Host-arrays of pointers to device memory
+    // (intermediate arrays used for the transfers)
+    device_batch_vector<T>     dA(size_A, 1, group_count);
+    device_batch_vector<T>     dB(size_B, 1, group_count);
+    device_batch_vector<T>     dC_1(size_C, 1, group_count);
+    device_batch_vector<T>     dC_2(size_C, 1, group_count);
+    device_vector<rocblas_int> dm(group_count);
+    device_vector<rocblas_int> dn(group_count);
+    device_vector<rocblas_int> dk(group_count);
+    device_vector<rocblas_int> dlda(group_count);
+    device_vector<rocblas_int> dldb(group_count);
+    device_vector<rocblas_int> dldc(group_count);
+    device_vector<T>           d_alpha(1);
+    device_vector<T>           d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_2.memcheck());
+    CHECK_DEVICE_ALLOCATION(dm.memcheck());
+    CHECK_DEVICE_ALLOCATION(dn.memcheck());
+    CHECK_DEVICE_ALLOCATION(dk.memcheck());
+    CHECK_DEVICE_ALLOCATION(dlda.memcheck());
+    CHECK_DEVICE_ALLOCATION(dldb.memcheck());
+    CHECK_DEVICE_ALLOCATION(dldc.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initial Data on CPU
+    rocblas_init(hA, true);
+    rocblas_init(hB, false);
+    rocblas_init(hC_1, false);
+
+    hC_2.copy_from(hC_1);
+    hC_gold.copy_from(hC_1);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC_1.transfer_from(hC_1));
+    CHECK_HIP_ERROR(dm.transfer_from(hm));
+    CHECK_HIP_ERROR(dn.transfer_from(hn));
+    CHECK_HIP_ERROR(dk.transfer_from(hk));
+    CHECK_HIP_ERROR(dlda.transfer_from(hlda_device));
+    CHECK_HIP_ERROR(dldb.transfer_from(hldb));
+    CHECK_HIP_ERROR(dldc.transfer_from(hldc));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dC_2.transfer_from(hC_2));
+        CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+        CHECK_HIP_ERROR(d_beta.transfer_from(hbeta));
+
+        // host arrays of pointers to device memory, with host alpha and beta
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_grouped_fn(handle,
+                                                    rocblas_pointer_mode_host,
+                                                    transA,
+                                                    transB,
+                                                    hm_host,
+                                                    hn,
+                                                    hk,
+                                                    &h_alpha,
+                                                    (T**)dA,
+                                                    hlda,
+                                                    (T**)dB,
+                                                    hldb,
+                                                    &h_beta,
+                                                    (T**)dC_1,
+                                                    hldc,
+                                                    group_count));
+
+        // device arrays, with device alpha and beta
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_grouped_fn(handle,
+                                                    rocblas_pointer_mode_device,
+                                                    transA,
+                                                    transB,
+                                                    dm,
+                                                    dn,
+                                                    dk,
+                                                    d_alpha,
+                                                    dA.ptr_on_device(),
+                                                    dlda,
+                                                    dB.ptr_on_device(),
+                                                    dldb,
+                                                    d_beta,
+                                                    dC_2.ptr_on_device(),
+                                                    dldc,
+                                                    group_count));
+
+        // CPU BLAS, leaving C of the empty and skipped problems unchanged
+        cpu_time_used = get_time_us_no_sync();
+        for(int p = 0; p < group_count; ++p)
+        {
+            if(!hm_host[p] || !hn[p])
+                continue;
+
+            cblas_gemm<T>(transA,
+                          transB,
+                          hm[p],
+                          hn[p],
+                          hk[p],
+                          h_alpha,
+                          hA[p],
+                          hlda[p],
+                          hB[p],
+                          hldb[p],
+                          h_beta,
+                          hC_gold[p],
+                          hldc[p]);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // copy device to host
+        CHECK_HIP_ERROR(hC_1.transfer_from(dC_1));
+        CHECK_HIP_ERROR(hC_2.transfer_from(dC_2));
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, size_C, 1, hC_gold, hC_1, group_count);
+            unit_check_general<T>(1, size_C, 1, hC_gold, hC_2, group_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1
+                = norm_check_general<T>('F', 1, size_C, 1, hC_gold, hC_1, group_count);
+            rocblas_error_2
+                = norm_check_general<T>('F', 1, size_C, 1, hC_gold, hC_2, group_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        // host arrays, as given by an application which knows the sizes of its problems
+        auto gemm_grouped_host_arrays = [&]() {
+            rocblas_gemm_grouped_fn(handle,
+                                    rocblas_pointer_mode_host,
+                                    transA,
+                                    transB,
+                                    hm_host,
+                                    hn,
+                                    hk,
+                                    &h_alpha,
+                                    (T**)dA,
+                                    hlda,
+                                    (T**)dB,
+                                    hldb,
+                                    &h_beta,
+                                    (T**)dC_1,
+                                    hldc,
+                                    group_count);
+        };
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+            gemm_grouped_host_arrays();
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+            gemm_grouped_host_arrays();
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // count of the problems which are computed
+        double gflops = 0;
+        for(int p = 0; p < group_count; ++p)
+            gflops += gemm_gflop_count<T>(hm_host[p], hn[p], hk[p]);
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_ldb,
+                      e_beta,
+                      e_ldc,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gflops,
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+}
@@ -0,0 +1,341 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_trmm_outofplace_bad_arg(const Arguments& arg)
+{
+    auto rocblas_trmm_outofplace_fn = arg.fortran ? rocblas_trmm_outofplace<T, true>
+                                                  : rocblas_trmm_outofplace<T, false>;
+
+    const rocblas_int M   = 100;
+    const rocblas_int N   = 100;
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+
+    const T alpha = 1.0;
+    const T zero  = 0.0;
+
+    const rocblas_side      side   = rocblas_side_left;
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_diagonal  diag   = rocblas_diagonal_non_unit;
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int K      = side == rocblas_side_left ? M : N;
+    size_t      size_A = lda * size_t(K);
+    size_t      size_B = ldb * size_t(N);
+    size_t      size_C = ldc * size_t(N);
+
+    // allocate memory on device
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> dC(size_C);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trmm_outofplace_fn(
+            handle, side, uplo, transA, diag, M, N, &alpha, nullptr, lda, dB, ldb, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trmm_outofplace_fn(
+            handle, side, uplo, transA, diag, M, N, &alpha, dA, lda, nullptr, ldb, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trmm_outofplace_fn(
+            handle, side, uplo, transA, diag, M, N, &alpha, dA, lda, dB, ldb, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trmm_outofplace_fn(
+            handle, side, uplo, transA, diag, M, N, nullptr, dA, lda, dB, ldb, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trmm_outofplace_fn(
+            nullptr, side, uplo, transA, diag, M, N, &alpha, dA, lda, dB, ldb, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    // ldc < M is invalid
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trmm_outofplace_fn(
+            handle, side, uplo, transA, diag, M, N, &alpha, dA, lda, dB, ldb, dC, M - 1),
+        rocblas_status_invalid_size);
+
+    // C may only alias B as the in-place trmm
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trmm_outofplace_fn(
+            handle, side, uplo, transA, diag, M, N, &alpha, dA, lda, dB, ldb, dB, ldb + 1),
+        rocblas_status_invalid_value);
+
+    // If M==0, then all pointers can be nullptr without error
+    EXPECT_ROCBLAS_STATUS(rocblas_trmm_outofplace_fn(handle,
+                                                     side,
+                                                     uplo,
+                                                     transA,
+                                                     diag,
+                                                     0,
+                                                     N,
+                                                     nullptr,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     ldb,
+                                                     nullptr,
+                                                     ldc),
+                          rocblas_status_success);
+
+    // If N==0, then all pointers can be nullptr without error
+    EXPECT_ROCBLAS_STATUS(rocblas_trmm_outofplace_fn(handle,
+                                                     side,
+                                                     uplo,
+                                                     transA,
+                                                     diag,
+                                                     M,
+                                                     0,
+                                                     nullptr,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     ldb,
+                                                     nullptr,
+                                                     ldc),
+                          rocblas_status_success);
+
+    // If alpha==0, then A and B can be nullptr without error
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trmm_outofplace_fn(
+            handle, side, uplo, transA, diag, M, N, &zero, nullptr, lda, nullptr, ldb, dC, ldc),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_trmm_outofplace(const Arguments& arg)
+{
+    auto rocblas_trmm_outofplace_fn = arg.fortran ? rocblas_trmm_outofplace<T, true>
+                                                  : rocblas_trmm_outofplace<T, false>;
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    char char_side   = arg.side;
+    char char_uplo   = arg.uplo;
+    char char_transA = arg.transA;
+    char char_diag   = arg.diag;
+    T    h_alpha_T   = arg.get_alpha<T>();
+
+    rocblas_side      side   = char2rocblas_side(char_side);
+    rocblas_fill      uplo   = char2rocblas_fill(char_uplo);
+    rocblas_operation transA = char2rocblas_operation(char_transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(char_diag);
+
+    rocblas_int K      = side == rocblas_side_left ? M : N;
+    size_t      size_A = lda * size_t(K);
+    size_t      size_B = ldb * size_t(N);
+    size_t      size_C = ldc * size_t(N);
+
+    rocblas_local_handle handle{arg};
+
+    // ensure invalid sizes and quick return checked before pointer check
+    bool invalid_size = M < 0 || N < 0 || lda < K || ldb < M || ldc < M;
+    if(M == 0 || N == 0 || invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_trmm_outofplace_fn(handle,
+                                                         side,
+                                                         uplo,
+                                                         transA,
+                                                         diag,
+                                                         M,
+                                                         N,
+                                                         nullptr,
+                                                         nullptr,
+                                                         lda,
+                                                         nullptr,
+                                                         ldb,
+                                                         nullptr,
+                                                         ldc),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> h_alpha(1);
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hB_out(size_B);
+    host_vector<T> hC_1(size_C);
+    host_vector<T> hC_2(size_C);
+    host_vector<T> cpuC(size_C);
+
+    CHECK_HIP_ERROR(h_alpha.memcheck());
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hB_out.memcheck());
+    CHECK_HIP_ERROR(hC_1.memcheck());
+    CHECK_HIP_ERROR(hC_2.memcheck());
+    CHECK_HIP_ERROR(cpuC.memcheck());
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    // allocate memory on device
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> dC(size_C);
+    device_vector<T> d_alpha(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    //  initialize full random matrix hA, hB and hC
+    h_alpha[0] = h_alpha_T;
+    rocblas_seedrand();
+
+    if(arg.alpha_isnan<T>())
+    {
+        rocblas_init_nan<T>(hA, K, K, lda);
+        rocblas_init_nan<T>(hB, M, N, ldb);
+    }
+    else
+    {
+        rocblas_init<T>(hA);
+        rocblas_init<T>(hB);
+    }
+    rocblas_init<T>(hC_1);
+
+    // the reference computes C in place from a copy of B with leading dimension ldc
+    hC_2 = hC_1;
+    cpuC = hC_1;
+    for(rocblas_int j = 0; j < N; j++)
+        for(rocblas_int i = 0; i < M; i++)
+            cpuC[i + j * ldc] = hB[i + j * ldb];
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // calculate dC <- op(A) B or B op(A)   rocblas_device_pointer_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_1));
+
+        CHECK_ROCBLAS_ERROR(rocblas_trmm_outofplace_fn(
+            handle, side, uplo, transA, diag, M, N, &h_alpha[0], dA, lda, dB, ldb, dC, ldc));
+
+        CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+
+        // calculate dC <- op(A) B or B op(A)   rocblas_device_pointer_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_2));
+        CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+
+        CHECK_ROCBLAS_ERROR(rocblas_trmm_outofplace_fn(
+            handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb, dC, ldc));
+
+        CHECK_HIP_ERROR(hC_2.transfer_from(dC));
+        CHECK_HIP_ERROR(hB_out.transfer_from(dB));
+
+        // CPU BLAS
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us_no_sync();
+        }
+
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, h_alpha_T, hA, lda, cpuC, ldc);
+
+        if(arg.timing)
+        {
+            cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+        }
+
+        // B is only read
+        unit_check_general<T>(M, N, ldb, hB, hB_out);
+
+        if(arg.unit_check)
+        {
+            if(std::is_same<T, rocblas_half>{} && K > 10000)
+            {
+                // For large K, rocblas_half tends to diverge proportional to K
+                // Tolerance is slightly greater than 1 / 1024.0
+                const double tol = K * sum_error_tolerance<T>;
+                near_check_general<T>(M, N, ldc, cpuC, hC_1, tol);
+                near_check_general<T>(M, N, ldc, cpuC, hC_2, tol);
+            }
+            else
+            {
+                unit_check_general<T>(M, N, ldc, cpuC, hC_1);
+                unit_check_general<T>(M, N, ldc, cpuC, hC_2);
+            }
+        }
+
+        if(arg.norm_check)
+        {
+            auto err1     = std::abs(norm_check_general<T>('F', M, N, ldc, cpuC, hC_1));
+            auto err2     = std::abs(norm_check_general<T>('F', M, N, ldc, cpuC, hC_2));
+            rocblas_error = err1 > err2 ? err1 : err2;
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_trmm_outofplace_fn(
+                handle, side, uplo, transA, diag, M, N, &h_alpha[0], dA, lda, dB, ldb, dC, ldc));
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_trmm_outofplace_fn(
+                handle, side, uplo, transA, diag, M, N, &h_alpha[0], dA, lda, dB, ldb, dC, ldc);
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_alpha, e_lda, e_ldb, e_ldc>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         trmm_gflop_count<T>(M, N, side),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
@@ -0,0 +1,292 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// Check the trsm inverse cache of the handle:
+// - With a cache large enough for the inverses of A, solve three times with different right-hand
+//   sides, the first solve computing and caching the inverses of the diagonal blocks of A, the
+//   next ones using them, in host and device pointer modes
+// - Change an element of the first diagonal block of A in place without changing the version, and
+//   check that the next solve still solves with the previous A, which shows the cached inverses
+//   are used
+// - Scale A in place and change the version, so that the next solve does not use the stale
+//   inverses, and check that its solution is the one of the scaled A
+// - Scale A in place again and clear the inverses of A instead of changing the version
+// - With a cache too small for the inverses of A, check that solves are still correct
+// Timing measures solves which use the cached inverses.
+template <typename T>
+void testing_trsm_inverse_cache(const Arguments& arg)
+{
+    auto rocblas_trsm_fn = arg.fortran ? rocblas_trsm<T, true> : rocblas_trsm<T, false>;
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+
+    char char_side   = arg.side;
+    char char_uplo   = arg.uplo;
+    char char_transA = arg.transA;
+    char char_diag   = arg.diag;
+    T    alpha_h     = arg.get_alpha<T>();
+
+    rocblas_side      side   = char2rocblas_side(char_side);
+    rocblas_fill      uplo   = char2rocblas_fill(char_uplo);
+    rocblas_operation transA = char2rocblas_operation(char_transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(char_diag);
+
+    rocblas_int K      = side == rocblas_side_left ? M : N;
+    size_t      size_A = lda * size_t(K);
+    size_t      size_B = ldb * size_t(N);
+
+    rocblas_local_handle handle{arg};
+
+    size_t size = 1;
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsm_inverse_cache_size(handle, &size));
+    EXPECT_EQ(size, 0);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_trsm_inverse_cache_size(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || lda < K || ldb < M;
+    if(invalid_size || !M || !N)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_trsm_inverse_cache_size(handle, 1 << 20));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_trsm_fn(
+                handle, side, uplo, transA, diag, M, N, nullptr, nullptr, lda, nullptr, ldb),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // an inverse takes 128 * K elements
+    size_t cache_size = sizeof(T) * 128 * K;
+    CHECK_ROCBLAS_ERROR(rocblas_set_trsm_inverse_cache_size(handle, cache_size));
+    CHECK_ROCBLAS_ERROR(rocblas_get_trsm_inverse_cache_size(handle, &size));
+    EXPECT_EQ(size, cache_size);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> AAT(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hX(size_B);
+    host_vector<T> hXorB(size_B);
+    host_vector<T> cpuXorB(size_B);
+
+    double gpu_time_used, cpu_time_used;
+    double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
+    double eps                  = std::numeric_limits<real_t<T>>::epsilon();
+    double max_err              = 0.0;
+
+    // allocate memory on device
+    device_vector<T> dA(size_A);
+    device_vector<T> dXorB(size_B);
+    device_vector<T> alpha_d(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dXorB.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+
+    //  initialize full random matrix hA with all entries in [1, 10]
+    rocblas_init<T>(hA, K, K, lda);
+
+    //  pad untouched area into zero
+    for(int i = K; i < lda; i++)
+        for(int j = 0; j < K; j++)
+            hA[i + j * lda] = 0.0;
+
+    //  calculate AAT = hA * hA ^ T or AAT = hA * hA ^ H if complex
+    cblas_gemm<T>(rocblas_operation_none,
+                  rocblas_operation_conjugate_transpose,
+                  K,
+                  K,
+                  K,
+                  T(1.0),
+                  hA,
+                  lda,
+                  hA,
+                  lda,
+                  T(0.0),
+                  AAT,
+                  lda);
+
+    //  copy AAT into hA, make hA strictly diagonal dominant, and therefore SPD
+    for(int i = 0; i < K; i++)
+    {
+        T t = 0.0;
+        for(int j = 0; j < K; j++)
+        {
+            hA[i + j * lda] = AAT[i + j * lda];
+            t += rocblas_abs(AAT[i + j * lda]);
+        }
+        hA[i + i * lda] = t;
+    }
+
+    //  calculate Cholesky factorization of SPD (or Hermitian if complex) matrix hA
+    cblas_potrf<T>(char_uplo, K, hA, lda);
+
+    //  make hA unit diagonal if diag == rocblas_diagonal_unit
+    if(char_diag == 'U' || char_diag == 'u')
+    {
+        if('L' == char_uplo || 'l' == char_uplo)
+            for(int i = 0; i < K; i++)
+            {
+                T diag = hA[i + i * lda];
+                for(int j = 0; j <= i; j++)
+                    hA[i + j * lda] = hA[i + j * lda] / diag;
+            }
+        else
+            for(int j = 0; j < K; j++)
+            {
+                T diag = hA[j + j * lda];
+                for(int i = 0; i <= j; i++)
+                    hA[i + j * lda] = hA[i + j * lda] / diag;
+            }
+    }
+
+    // Initialize "exact" answer hX
+    rocblas_init<T>(hX, M, N, ldb);
+    // pad untouched area into zero
+    for(int i = M; i < ldb; i++)
+        for(int j = 0; j < N; j++)
+            hX[i + j * ldb] = 0.0;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemcpy(alpha_d, &alpha_h, sizeof(T), hipMemcpyHostToDevice));
+
+    // solves op(A) X = alpha B or X op(A) = alpha B on the device for the B of the exact answer
+    // scaled by s, and checks the forward error
+    auto solve_and_check = [&](T s, bool alpha_on_device) {
+        for(size_t i = 0; i < size_B; i++)
+            hB[i] = hX[i] * s;
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, T(1.0) / alpha_h, hA, lda, hB, ldb);
+        CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(
+            handle, alpha_on_device ? rocblas_pointer_mode_device : rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_trsm_fn(handle,
+                                            side,
+                                            uplo,
+                                            transA,
+                                            diag,
+                                            M,
+                                            N,
+                                            alpha_on_device ? (const T*)alpha_d : &alpha_h,
+                                            dA,
+                                            lda,
+                                            dXorB,
+                                            ldb));
+        CHECK_HIP_ERROR(hXorB.transfer_from(dXorB));
+
+        for(size_t i = 0; i < size_B; i++)
+            hB[i] = hX[i] * s;
+        max_err = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hB, hXorB));
+        trsm_err_res_check<T>(max_err, M, error_eps_multiplier * rocblas_abs(s), eps);
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // the first solve caches the inverses, the next ones use them
+        solve_and_check(T(1), false);
+        solve_and_check(T(2), false);
+        solve_and_check(T(-1), true);
+
+        // The element below or right of the first diagonal element of A is only read through the
+        // inverse of the first diagonal block, so changing it on the device alone is not seen
+        // while the cached inverses are used. The small kernels do not use the inverses.
+        if(M > 64 || N > 64)
+        {
+            host_vector<T> hA_changed(size_A);
+            hA_changed = hA;
+            hA_changed[uplo == rocblas_fill_lower ? 1 : lda] += T(1);
+            CHECK_HIP_ERROR(dA.transfer_from(hA_changed));
+            solve_and_check(T(1), false);
+            solve_and_check(T(2), true);
+        }
+
+        // scale A in place, the inverses of the previous version must not be used
+        for(size_t i = 0; i < size_A; i++)
+            hA[i] = hA[i] * T(2);
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_ROCBLAS_ERROR(rocblas_set_trsm_inverse_cache_version(handle, 1));
+        solve_and_check(T(1), false);
+        solve_and_check(T(2), false);
+
+        // scale A in place again and free its inverses
+        for(size_t i = 0; i < size_A; i++)
+            hA[i] = hA[i] * T(0.5);
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_ROCBLAS_ERROR(rocblas_clear_trsm_inverse_cache(handle, dA));
+        solve_and_check(T(1), false);
+        solve_and_check(T(2), true);
+
+        // inverses which do not fit are not cached
+        CHECK_ROCBLAS_ERROR(rocblas_set_trsm_inverse_cache_size(handle, cache_size - 1));
+        solve_and_check(T(1), false);
+        solve_and_check(T(2), false);
+        CHECK_ROCBLAS_ERROR(rocblas_set_trsm_inverse_cache_size(handle, cache_size));
+    }
+
+    if(arg.timing)
+    {
+        // GPU rocBLAS, the cold calls cache the inverses
+        hB = hX;
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, T(1.0) / alpha_h, hA, lda, hB, ldb);
+        cpuXorB = hB;
+        CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        int number_cold_calls = std::max(arg.cold_iters, 1);
+        int number_hot_calls  = arg.iters;
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_trsm_fn(
+                handle, side, uplo, transA, diag, M, N, &alpha_h, dA, lda, dXorB, ldb));
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_trsm_fn(
+                handle, side, uplo, transA, diag, M, N, &alpha_h, dA, lda, dXorB, ldb));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // CPU cblas
+        cpu_time_used = get_time_us_no_sync();
+
+        cblas_trsm<T>(side, uplo, transA, diag, M, N, alpha_h, hA, lda, cpuXorB, ldb);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_alpha, e_lda, e_ldb>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         trsm_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         max_err,
+                         max_err);
+    }
+}
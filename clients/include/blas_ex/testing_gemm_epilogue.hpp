@@ -0,0 +1,891 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// RAII helper for rocblas_gemm_epilogue
+class rocblas_local_gemm_epilogue
+{
+    rocblas_gemm_epilogue m_epilogue = nullptr;
+
+public:
+    rocblas_local_gemm_epilogue()
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_create_gemm_epilogue(&m_epilogue));
+    }
+
+    ~rocblas_local_gemm_epilogue()
+    {
+        rocblas_destroy_gemm_epilogue(m_epilogue);
+    }
+
+    rocblas_local_gemm_epilogue(const rocblas_local_gemm_epilogue&) = delete;
+    rocblas_local_gemm_epilogue& operator=(const rocblas_local_gemm_epilogue&) = delete;
+
+    operator rocblas_gemm_epilogue() const
+    {
+        return m_epilogue;
+    }
+};
+
+// types of D for which rocblas_gemm_ex_epilogue and rocblas_gemm_ext2_epilogue apply an epilogue
+template <typename To>
+static constexpr bool gemm_epilogue_supported
+    = std::is_same<To, float>{} || std::is_same<To, double>{} || std::is_same<To, rocblas_half>{}
+      || std::is_same<To, rocblas_bfloat16>{};
+
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_epilogue_bad_arg(const Arguments& arg)
+{
+    const rocblas_int M   = 100;
+    const rocblas_int N   = 100;
+    const rocblas_int K   = 100;
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+    const rocblas_int ldd = 100;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+    const rocblas_gemm_algo algo   = rocblas_gemm_algo_standard;
+    const float             alpha(1), beta(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_create_gemm_epilogue(nullptr), rocblas_status_invalid_pointer);
+
+    rocblas_local_gemm_epilogue local_epilogue;
+    rocblas_gemm_epilogue       epilogue = local_epilogue;
+
+    device_vector<float> dA(size_t(lda) * K);
+    device_vector<float> dB(size_t(ldb) * N);
+    device_vector<float> dC(size_t(ldc) * N);
+    device_vector<float> dD(size_t(ldd) * N);
+    device_vector<float> dbias(M);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbias.memcheck());
+
+    // setters
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_epilogue_set_bias(nullptr, dbias, rocblas_epilogue_vector_per_row),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_epilogue_set_bias(epilogue, dbias, rocblas_epilogue_vector(2)),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_epilogue_set_scale(nullptr, dbias, rocblas_epilogue_vector_per_row),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_epilogue_set_scale(epilogue, dbias, rocblas_epilogue_vector(2)),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_epilogue_set_activation(nullptr, rocblas_activation_relu),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_epilogue_set_activation(epilogue, rocblas_activation(3)),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_epilogue_set_saturation(nullptr, true),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_epilogue_set_dequantization(nullptr, nullptr, nullptr, nullptr, nullptr),
+        rocblas_status_invalid_pointer);
+
+    CHECK_ROCBLAS_ERROR(
+        rocblas_gemm_epilogue_set_bias(epilogue, dbias, rocblas_epilogue_vector_per_row));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_epilogue_set_activation(epilogue, rocblas_activation_relu));
+
+    // clang-format off
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(nullptr, transA, transB, M, N, K, &alpha,
+                          dA, rocblas_datatype_f32_r, lda, dB, rocblas_datatype_f32_r, ldb, &beta,
+                          dC, rocblas_datatype_f32_r, ldc, dD, rocblas_datatype_f32_r, ldd,
+                          rocblas_datatype_f32_r, algo, 0, 0, epilogue),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ext2_epilogue(nullptr, M, N, K, &alpha,
+                          dA, rocblas_datatype_f32_r, 1, lda, dB, rocblas_datatype_f32_r, 1, ldb,
+                          &beta, dC, rocblas_datatype_f32_r, 0, ldc, dD, rocblas_datatype_f32_r,
+                          1, ldd, rocblas_datatype_f32_r, algo, 0, 0, epilogue),
+                          rocblas_status_invalid_handle);
+
+    // the arguments of the gemm are checked with an epilogue
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(handle, transA, transB, M, N, K, &alpha,
+                          nullptr, rocblas_datatype_f32_r, lda, dB, rocblas_datatype_f32_r, ldb,
+                          &beta, dC, rocblas_datatype_f32_r, ldc, dD, rocblas_datatype_f32_r, ldd,
+                          rocblas_datatype_f32_r, algo, 0, 0, epilogue),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ext2_epilogue(handle, M, N, K, &alpha,
+                          dA, rocblas_datatype_f32_r, 1, lda, dB, rocblas_datatype_f32_r, 1, ldb,
+                          &beta, dC, rocblas_datatype_f32_r, 0, ldc, nullptr,
+                          rocblas_datatype_f32_r, 1, ldd, rocblas_datatype_f32_r, algo, 0, 0,
+                          epilogue),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with an epilogue
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(handle, transA, transB, 0, N, K, nullptr,
+                          nullptr, rocblas_datatype_f32_r, lda, nullptr, rocblas_datatype_f32_r,
+                          ldb, nullptr, nullptr, rocblas_datatype_f32_r, ldc, nullptr,
+                          rocblas_datatype_f32_r, ldd, rocblas_datatype_f32_r, algo, 0, 0,
+                          epilogue),
+                          rocblas_status_success);
+
+    // the epilogue is not implemented for integer and complex types
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(handle, transA, transB, M, N, K, &alpha,
+                          dA, rocblas_datatype_i8_r, lda, dB, rocblas_datatype_i8_r, ldb, &beta,
+                          dC, rocblas_datatype_i32_r, ldc, dD, rocblas_datatype_i32_r, ldd,
+                          rocblas_datatype_i32_r, algo, 0, 0, epilogue),
+                          rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ext2_epilogue(handle, M, N, K, &alpha,
+                          dA, rocblas_datatype_f32_c, 1, lda, dB, rocblas_datatype_f32_c, 1, ldb,
+                          &beta, dC, rocblas_datatype_f32_c, 0, ldc, dD, rocblas_datatype_f32_c,
+                          1, ldd, rocblas_datatype_f32_c, algo, 0, 0, epilogue),
+                          rocblas_status_not_implemented);
+
+    // a nullptr epilogue is a plain gemm
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(handle, transA, transB, M, N, K, &alpha,
+                          dA, rocblas_datatype_f32_r, lda, dB, rocblas_datatype_f32_r, ldb, &beta,
+                          dC, rocblas_datatype_f32_r, ldc, dD, rocblas_datatype_f32_r, ldd,
+                          rocblas_datatype_f32_r, algo, 0, 0, nullptr),
+                          rocblas_status_success);
+    // clang-format on
+}
+
+// For each configuration of an epilogue, runs rocblas_gemm_ex and rocblas_gemm_ext2 without
+// epilogue, applies the epilogue to their results with cblas_gemm_epilogue, and compares them
+// with the results of rocblas_gemm_ex_epilogue and rocblas_gemm_ext2_epilogue, so that the
+// epilogue is checked on the same D as computed by the device.
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_epilogue(const Arguments& arg)
+{
+    auto rocblas_gemm_ex_fn   = arg.fortran ? rocblas_gemm_ex_fortran : rocblas_gemm_ex;
+    auto rocblas_gemm_ext2_fn = arg.fortran ? rocblas_gemm_ext2_fortran : rocblas_gemm_ext2;
+
+    rocblas_gemm_algo algo = rocblas_gemm_algo(arg.algo);
+    int32_t           solution_index(arg.solution_index);
+    uint32_t          flags(arg.flags);
+
+    Tc h_alpha_Tc = arg.get_alpha<Tc>();
+    Tc h_beta_Tc  = arg.get_beta<Tc>();
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    rocblas_local_handle handle{arg};
+    auto                 transA = char2rocblas_operation(arg.transA);
+    auto                 transB = char2rocblas_operation(arg.transB);
+    auto                 M = arg.M, N = arg.N, K = arg.K;
+    auto                 lda = arg.lda, ldb = arg.ldb, ldc = arg.ldc, ldd = arg.ldd;
+    auto                 A_row = transA == rocblas_operation_none ? M : K;
+    auto                 A_col = transA == rocblas_operation_none ? K : M;
+    auto                 B_row = transB == rocblas_operation_none ? K : N;
+    auto                 B_col = transB == rocblas_operation_none ? N : K;
+
+    // gemm_ext2 takes row and column strides instead of transposes and leading dimensions, and
+    // only supports row_stride_c == 0, see testing_gemm_ext2
+    rocblas_stride row_stride_a = transA == rocblas_operation_none ? 1 : lda;
+    rocblas_stride col_stride_a = transA == rocblas_operation_none ? lda : 1;
+    rocblas_stride row_stride_b = transB == rocblas_operation_none ? 1 : ldb;
+    rocblas_stride col_stride_b = transB == rocblas_operation_none ? ldb : 1;
+
+    rocblas_local_gemm_epilogue local_epilogue;
+    rocblas_gemm_epilogue       epilogue = local_epilogue;
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_epilogue_set_activation(epilogue, rocblas_activation_relu));
+
+    // check for invalid sizes
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M;
+    if(invalid_size || !M || !N || !gemm_epilogue_supported<To>)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       nullptr,
+                                                       nullptr,
+                                                       arg.a_type,
+                                                       lda,
+                                                       nullptr,
+                                                       arg.b_type,
+                                                       ldb,
+                                                       nullptr,
+                                                       nullptr,
+                                                       arg.c_type,
+                                                       ldc,
+                                                       nullptr,
+                                                       arg.d_type,
+                                                       ldd,
+                                                       arg.compute_type,
+                                                       algo,
+                                                       solution_index,
+                                                       flags,
+                                                       epilogue),
+                              !gemm_epilogue_supported<To>
+                                  ? rocblas_status_not_implemented
+                                  : invalid_size ? rocblas_status_invalid_size
+                                                 : rocblas_status_success);
+        return;
+    }
+
+    const size_t size_A    = size_t(lda) * size_t(A_col);
+    const size_t size_B    = size_t(ldb) * size_t(B_col);
+    const size_t size_C    = size_t(ldc) * size_t(N);
+    const size_t size_D    = size_t(ldd) * size_t(N);
+    const size_t size_bias = std::max(M, N);
+
+    // allocate memory on device
+    device_vector<Ti> dA(size_A);
+    device_vector<Ti> dB(size_B);
+    device_vector<To> dC(size_C);
+    device_vector<To> dD(size_D);
+    device_vector<Tc> dbias(size_bias);
+    device_vector<Tc> dscale(size_bias);
+    device_vector<Tc> dscale_gelu(size_bias);
+    device_vector<Tc> dscale_saturate(size_bias);
+    device_vector<Tc> d_alpha_Tc(1);
+    device_vector<Tc> d_beta_Tc(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbias.memcheck());
+    CHECK_DEVICE_ALLOCATION(dscale.memcheck());
+    CHECK_DEVICE_ALLOCATION(dscale_gelu.memcheck());
+    CHECK_DEVICE_ALLOCATION(dscale_saturate.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha_Tc.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta_Tc.memcheck());
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ti> hA(size_A);
+    host_vector<Ti> hB(size_B);
+    host_vector<To> hC(size_C);
+    host_vector<To> hD(size_D);
+    host_vector<To> hD_1(size_D);
+    host_vector<Tc> hbias(size_bias);
+    host_vector<Tc> hscale(size_bias);
+    host_vector<Tc> hscale_gelu(size_bias);
+    host_vector<Tc> hscale_saturate(size_bias);
+    using To_hpa = std::conditional_t<std::is_same<To, rocblas_bfloat16>{}, float, To>;
+    host_vector<To_hpa> hD_gold(size_D);
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    rocblas_init<Ti>(hA, A_row, A_col, lda);
+    rocblas_init_alternating_sign<Ti>(hB, B_row, B_col, ldb);
+    rocblas_init<To>(hC, M, N, ldc);
+    rocblas_init<To>(hD, M, N, ldd);
+
+    // small integers and powers of two, so that scale .* D + bias is exact in every type; the
+    // gelu scale brings D near the bend of gelu, the saturate scale overflows half precision
+    for(size_t i = 0; i < size_bias; i++)
+    {
+        hbias[i]           = Tc(double(i % 11) - 5);
+        hscale[i]          = Tc(double(i % 4 + 1));
+        hscale_gelu[i]     = Tc((double(i % 5) - 2) / 64);
+        hscale_saturate[i] = Tc(i % 2 ? 1024.0 : -1024.0);
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(dbias.transfer_from(hbias));
+    CHECK_HIP_ERROR(dscale.transfer_from(hscale));
+    CHECK_HIP_ERROR(dscale_gelu.transfer_from(hscale_gelu));
+    CHECK_HIP_ERROR(dscale_saturate.transfer_from(hscale_saturate));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha_Tc, &h_alpha_Tc, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta_Tc, &h_beta_Tc, sizeof(Tc), hipMemcpyHostToDevice));
+
+    struct epilogue_config
+    {
+        const Tc*               bias;
+        rocblas_epilogue_vector bias_vector;
+        const Tc*               scale;
+        rocblas_epilogue_vector scale_vector;
+        rocblas_activation      activation;
+        bool                    saturate;
+    };
+
+    // host vector of the device vector of a configuration
+    auto host_of = [&](const Tc* d) -> const Tc* {
+        if(d == dbias)
+            return hbias;
+        if(d == dscale)
+            return hscale;
+        if(d == dscale_gelu)
+            return hscale_gelu;
+        if(d == dscale_saturate)
+            return hscale_saturate;
+        return nullptr;
+    };
+
+    constexpr auto row = rocblas_epilogue_vector_per_row;
+    constexpr auto col = rocblas_epilogue_vector_per_column;
+
+    // clang-format off
+    const epilogue_config configs[] = {
+        {dbias,   row, nullptr,         row, rocblas_activation_none, false},
+        {dbias,   col, nullptr,         row, rocblas_activation_relu, false},
+        {nullptr, row, dscale,          col, rocblas_activation_none, false},
+        {dbias,   col, dscale,          row, rocblas_activation_relu, false},
+        {dbias,   row, dscale_saturate, col, rocblas_activation_none, true},
+        {dbias,   row, dscale_gelu,     col, rocblas_activation_gelu, false},
+        {nullptr, row, dscale_gelu,     row, rocblas_activation_gelu, true},
+    };
+    // clang-format on
+
+    // gemm_ex in host pointer mode, or gemm_ext2 in device pointer mode
+    auto run = [&](bool ext2, rocblas_gemm_epilogue epi) {
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        if(!ext2)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            if(!epi)
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_fn(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       &h_alpha_Tc,
+                                                       dA,
+                                                       arg.a_type,
+                                                       lda,
+                                                       dB,
+                                                       arg.b_type,
+                                                       ldb,
+                                                       &h_beta_Tc,
+                                                       dC,
+                                                       arg.c_type,
+                                                       ldc,
+                                                       dD,
+                                                       arg.d_type,
+                                                       ldd,
+                                                       arg.compute_type,
+                                                       algo,
+                                                       solution_index,
+                                                       flags));
+            else
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_epilogue(handle,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             &h_alpha_Tc,
+                                                             dA,
+                                                             arg.a_type,
+                                                             lda,
+                                                             dB,
+                                                             arg.b_type,
+                                                             ldb,
+                                                             &h_beta_Tc,
+                                                             dC,
+                                                             arg.c_type,
+                                                             ldc,
+                                                             dD,
+                                                             arg.d_type,
+                                                             ldd,
+                                                             arg.compute_type,
+                                                             algo,
+                                                             solution_index,
+                                                             flags,
+                                                             epi));
+        }
+        else
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            if(!epi)
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_ext2_fn(handle,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         d_alpha_Tc,
+                                                         dA,
+                                                         arg.a_type,
+                                                         row_stride_a,
+                                                         col_stride_a,
+                                                         dB,
+                                                         arg.b_type,
+                                                         row_stride_b,
+                                                         col_stride_b,
+                                                         d_beta_Tc,
+                                                         dC,
+                                                         arg.c_type,
+                                                         0,
+                                                         ldc,
+                                                         dD,
+                                                         arg.d_type,
+                                                         1,
+                                                         ldd,
+                                                         arg.compute_type,
+                                                         algo,
+                                                         solution_index,
+                                                         flags));
+            else
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_ext2_epilogue(handle,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               d_alpha_Tc,
+                                                               dA,
+                                                               arg.a_type,
+                                                               row_stride_a,
+                                                               col_stride_a,
+                                                               dB,
+                                                               arg.b_type,
+                                                               row_stride_b,
+                                                               col_stride_b,
+                                                               d_beta_Tc,
+                                                               dC,
+                                                               arg.c_type,
+                                                               0,
+                                                               ldc,
+                                                               dD,
+                                                               arg.d_type,
+                                                               1,
+                                                               ldd,
+                                                               arg.compute_type,
+                                                               algo,
+                                                               solution_index,
+                                                               flags,
+                                                               epi));
+        }
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(bool ext2 : {false, true})
+        {
+            // D of the gemm without epilogue
+            run(ext2, nullptr);
+            host_vector<To> hD_gemm(size_D);
+            CHECK_HIP_ERROR(hD_gemm.transfer_from(dD));
+
+            for(const auto& config : configs)
+            {
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_gemm_epilogue_set_bias(epilogue, config.bias, config.bias_vector));
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_gemm_epilogue_set_scale(epilogue, config.scale, config.scale_vector));
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_gemm_epilogue_set_activation(epilogue, config.activation));
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_gemm_epilogue_set_saturation(epilogue, config.saturate));
+
+                run(ext2, epilogue);
+                CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+
+                // CPU reference
+                host_vector<To> hD_cpu(hD_gemm);
+                cpu_time_used = get_time_us_no_sync();
+                if constexpr(gemm_epilogue_supported<To>)
+                    cblas_gemm_epilogue<Tc, To>(M,
+                                                N,
+                                                host_of(config.bias),
+                                                config.bias_vector,
+                                                host_of(config.scale),
+                                                config.scale_vector,
+                                                config.activation,
+                                                config.saturate,
+                                                hD_cpu,
+                                                ldd);
+                cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+                for(size_t i = 0; i < size_D; i++)
+                    hD_gold[i] = To_hpa(hD_cpu[i]);
+
+                // gelu uses tanh, whose last bits may differ between the device and the host
+                if(config.activation == rocblas_activation_gelu)
+                {
+                    double max_gold = 0;
+                    for(rocblas_int j = 0; j < N; j++)
+                        for(rocblas_int i = 0; i < M; i++)
+                            max_gold
+                                = std::max(max_gold, double(rocblas_abs(hD_gold[i + j * ldd])));
+                    const double tol
+                        = std::max(sum_error_tolerance<To>, 1e-5) * std::max(max_gold, 1.0);
+                    if(arg.unit_check)
+                        near_check_general<To, To_hpa>(M, N, ldd, hD_gold, hD_1, tol);
+                }
+                else if(arg.unit_check)
+                    unit_check_general<To, To_hpa>(M, N, ldd, hD_gold, hD_1);
+
+                if(arg.norm_check)
+                {
+                    auto err = std::abs(norm_check_general<To>('F', M, N, ldd, hD_gold, hD_1));
+                    rocblas_error = err > rocblas_error ? err : rocblas_error;
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        // the bias, scale and relu of a layer of a multilayer perceptron
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemm_epilogue_set_bias(epilogue, dbias, rocblas_epilogue_vector_per_row));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemm_epilogue_set_scale(epilogue, dscale, rocblas_epilogue_vector_per_row));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemm_epilogue_set_activation(epilogue, rocblas_activation_relu));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_epilogue_set_saturation(epilogue, false));
+
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int i = 0; i < number_cold_calls; i++)
+            run(false, epilogue);
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_gemm_ex_epilogue(handle,
+                                     transA,
+                                     transB,
+                                     M,
+                                     N,
+                                     K,
+                                     &h_alpha_Tc,
+                                     dA,
+                                     arg.a_type,
+                                     lda,
+                                     dB,
+                                     arg.b_type,
+                                     ldb,
+                                     &h_beta_Tc,
+                                     dC,
+                                     arg.c_type,
+                                     ldc,
+                                     dD,
+                                     arg.d_type,
+                                     ldd,
+                                     arg.compute_type,
+                                     algo,
+                                     solution_index,
+                                     flags,
+                                     epilogue);
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldb,
+                      e_ldc,
+                      e_ldd>{}
+            .log_args<To>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemm_gflop_count<Tc>(M, N, K),
+                          ArgumentLogging::NA_value,
+                          cpu_time_used,
+                          rocblas_error);
+    }
+}
+
+// For each configuration of a dequantizing epilogue, runs rocblas_gemm_ex_epilogue with int8 A and
+// B and a real D, in host and device pointer modes, and compares its results with the int32
+// product of cblas_gemm dequantized by cblas_gemm_epilogue_dequantize. The scales are small
+// fractions with power of two denominators, so that the float results are exact.
+template <typename To>
+void testing_gemm_epilogue_dequantize(const Arguments& arg)
+{
+    using Ti = int8_t;
+
+    rocblas_gemm_algo algo = rocblas_gemm_algo(arg.algo);
+    int32_t           solution_index(arg.solution_index);
+    uint32_t          flags(arg.flags);
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+    double rocblas_error          = 0.0;
+
+    rocblas_local_handle handle{arg};
+    auto                 transA = char2rocblas_operation(arg.transA);
+    auto                 transB = char2rocblas_operation(arg.transB);
+    auto                 M = arg.M, N = arg.N, K = arg.K;
+    auto                 lda = arg.lda, ldb = arg.ldb, ldc = arg.ldc, ldd = arg.ldd;
+    auto                 A_row = transA == rocblas_operation_none ? M : K;
+    auto                 A_col = transA == rocblas_operation_none ? K : M;
+    auto                 B_row = transB == rocblas_operation_none ? K : N;
+    auto                 B_col = transB == rocblas_operation_none ? N : K;
+
+    rocblas_local_gemm_epilogue local_epilogue;
+    rocblas_gemm_epilogue       epilogue = local_epilogue;
+
+    auto gemm = [&](const float* alpha, const float* beta, const Ti* dA, const Ti* dB,
+                    const To* dC, To* dD, rocblas_gemm_epilogue epi) {
+        return rocblas_gemm_ex_epilogue(handle,
+                                        transA,
+                                        transB,
+                                        M,
+                                        N,
+                                        K,
+                                        alpha,
+                                        dA,
+                                        arg.a_type,
+                                        lda,
+                                        dB,
+                                        arg.b_type,
+                                        ldb,
+                                        beta,
+                                        dC,
+                                        arg.c_type,
+                                        ldc,
+                                        dD,
+                                        arg.d_type,
+                                        ldd,
+                                        arg.compute_type,
+                                        algo,
+                                        solution_index,
+                                        flags,
+                                        epi);
+    };
+
+    // check for invalid sizes
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M;
+    if(invalid_size || !M || !N)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(gemm(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, epilogue),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    const size_t size_A = size_t(lda) * size_t(A_col);
+    const size_t size_B = size_t(ldb) * size_t(B_col);
+    const size_t size_C = size_t(ldc) * size_t(N);
+    const size_t size_D = size_t(ldd) * size_t(N);
+    const size_t size_Q = size_t(M) * size_t(N);
+
+    // allocate memory on device
+    device_vector<Ti>      dA(size_A);
+    device_vector<Ti>      dB(size_B);
+    device_vector<To>      dC(size_C);
+    device_vector<To>      dD(size_D);
+    device_vector<float>   drow_scale(M);
+    device_vector<float>   dcolumn_scale(N);
+    device_vector<int32_t> drow_offset(M);
+    device_vector<int32_t> dcolumn_offset(N);
+    device_vector<float>   dbias(N);
+    device_vector<float>   dscale_saturate(M);
+    device_vector<float>   d_alpha(1);
+    device_vector<float>   d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(drow_scale.memcheck());
+    CHECK_DEVICE_ALLOCATION(dcolumn_scale.memcheck());
+    CHECK_DEVICE_ALLOCATION(drow_offset.memcheck());
+    CHECK_DEVICE_ALLOCATION(dcolumn_offset.memcheck());
+    CHECK_DEVICE_ALLOCATION(dbias.memcheck());
+    CHECK_DEVICE_ALLOCATION(dscale_saturate.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ti>      hA(size_A);
+    host_vector<Ti>      hB(size_B);
+    host_vector<To>      hC(size_C);
+    host_vector<To>      hD(size_D);
+    host_vector<To>      hD_1(size_D);
+    host_vector<To>      hD_cpu(size_D);
+    host_vector<int32_t> hQ(size_Q);
+    host_vector<float>   hrow_scale(M);
+    host_vector<float>   hcolumn_scale(N);
+    host_vector<int32_t> hrow_offset(M);
+    host_vector<int32_t> hcolumn_offset(N);
+    host_vector<float>   hbias(N);
+    host_vector<float>   hscale_saturate(M);
+    using To_hpa = std::conditional_t<std::is_same<To, rocblas_bfloat16>{}, float, To>;
+    host_vector<To_hpa> hD_gold(size_D);
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    rocblas_init<Ti>(hA, A_row, A_col, lda);
+    rocblas_init_alternating_sign<Ti>(hB, B_row, B_col, ldb);
+    rocblas_init<To>(hC, M, N, ldc);
+    rocblas_init<To>(hD, M, N, ldd);
+
+    for(rocblas_int i = 0; i < M; i++)
+    {
+        hrow_scale[i]      = float(i % 4 + 1) / 8;
+        hrow_offset[i]     = i % 7 - 3;
+        hscale_saturate[i] = i % 2 ? 1024.0f : -1024.0f;
+    }
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        hcolumn_scale[j]  = float(j % 3 + 1) / 4;
+        hcolumn_offset[j] = j % 5 - 2;
+        hbias[j]          = float(j % 11) - 5;
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(drow_scale.transfer_from(hrow_scale));
+    CHECK_HIP_ERROR(dcolumn_scale.transfer_from(hcolumn_scale));
+    CHECK_HIP_ERROR(drow_offset.transfer_from(hrow_offset));
+    CHECK_HIP_ERROR(dcolumn_offset.transfer_from(hcolumn_offset));
+    CHECK_HIP_ERROR(dbias.transfer_from(hbias));
+    CHECK_HIP_ERROR(dscale_saturate.transfer_from(hscale_saturate));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+
+    // the int32 product of A and B
+    cblas_gemm<Ti, int32_t, int32_t>(transA, transB, M, N, K, 1, hA, lda, hB, ldb, 0, hQ, M);
+
+    struct dequantize_config
+    {
+        bool                    use_epilogue;
+        bool                    offsets;
+        const float*            bias;
+        const float*            scale;
+        rocblas_epilogue_vector scale_vector;
+        rocblas_activation      activation;
+        bool                    saturate;
+    };
+
+    constexpr auto row = rocblas_epilogue_vector_per_row;
+    constexpr auto col = rocblas_epilogue_vector_per_column;
+
+    // clang-format off
+    const dequantize_config configs[] = {
+        {false, false, nullptr, nullptr,         row, rocblas_activation_none, false},
+        {true,  false, nullptr, nullptr,         row, rocblas_activation_none, false},
+        {true,  true,  dbias,   nullptr,         row, rocblas_activation_relu, false},
+        {true,  true,  dbias,   dscale_saturate, row, rocblas_activation_none, true},
+    };
+    // clang-format on
+
+    auto set_config = [&](const dequantize_config& config) {
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_epilogue_set_dequantization(
+            epilogue,
+            drow_scale,
+            dcolumn_scale,
+            config.offsets ? (const int32_t*)drow_offset : nullptr,
+            config.offsets ? (const int32_t*)dcolumn_offset : nullptr));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_epilogue_set_bias(epilogue, config.bias, col));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemm_epilogue_set_scale(epilogue, config.scale, config.scale_vector));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_epilogue_set_activation(epilogue, config.activation));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_epilogue_set_saturation(epilogue, config.saturate));
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(const auto& config : configs)
+        {
+            set_config(config);
+            rocblas_gemm_epilogue epi = config.use_epilogue ? epilogue : nullptr;
+
+            // CPU reference
+            cpu_time_used = get_time_us_no_sync();
+            // clang-format off
+            cblas_gemm_epilogue_dequantize<To>(M, N, hQ, K ? h_alpha : 0, h_beta, hC, ldc,
+                config.use_epilogue ? (const float*)hrow_scale : nullptr,
+                config.use_epilogue ? (const float*)hcolumn_scale : nullptr,
+                config.offsets ? (const int32_t*)hrow_offset : nullptr,
+                config.offsets ? (const int32_t*)hcolumn_offset : nullptr,
+                config.bias ? (const float*)hbias : nullptr, col,
+                config.scale ? (const float*)hscale_saturate : nullptr, config.scale_vector,
+                config.activation, config.saturate, hD_cpu, ldd);
+            // clang-format on
+            cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+            for(size_t i = 0; i < size_D; i++)
+                hD_gold[i] = To_hpa(hD_cpu[i]);
+
+            for(bool device_mode : {false, true})
+            {
+                CHECK_HIP_ERROR(dD.transfer_from(hD));
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(
+                    handle, device_mode ? rocblas_pointer_mode_device : rocblas_pointer_mode_host));
+                CHECK_ROCBLAS_ERROR(gemm(device_mode ? (const float*)d_alpha : &h_alpha,
+                                         device_mode ? (const float*)d_beta : &h_beta,
+                                         dA,
+                                         dB,
+                                         dC,
+                                         dD,
+                                         epi));
+                CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+
+                if(arg.unit_check)
+                    unit_check_general<To, To_hpa>(M, N, ldd, hD_gold, hD_1);
+
+                if(arg.norm_check)
+                {
+                    auto err = std::abs(norm_check_general<To>('F', M, N, ldd, hD_gold, hD_1));
+                    rocblas_error = err > rocblas_error ? err : rocblas_error;
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        // the dequantization, bias and relu of a quantized layer
+        set_config(configs[2]);
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int i = 0; i < number_cold_calls; i++)
+            gemm(&h_alpha, &h_beta, dA, dB, dC, dD, epilogue);
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+            gemm(&h_alpha, &h_beta, dA, dB, dC, dD, epilogue);
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldb,
+                      e_ldc,
+                      e_ldd>{}
+            .log_args<To>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemm_gflop_count<float>(M, N, K),
+                          ArgumentLogging::NA_value,
+                          cpu_time_used,
+                          rocblas_error);
+    }
+}
@@ -76,6 +76,20 @@ constexpr double nrm2_gbyte_count(rocblas_int n)
     return (sizeof(T) * n) / 1e9;
 }
 
+/* \brief byte counts of AXPY_DOT */
+template <typename T>
+constexpr double axpy_dot_gbyte_count(rocblas_int n)
+{
+    return (sizeof(T) * 4.0 * n) / 1e9;
+}
+
+/* \brief byte counts of AXPY_NRM2 */
+template <typename T>
+constexpr double axpy_nrm2_gbyte_count(rocblas_int n)
+{
+    return (sizeof(T) * 3.0 * n) / 1e9;
+}
+
 /* \brief byte counts of SCAL */
 template <typename T>
 constexpr double scal_gbyte_count(rocblas_int n)
@@ -145,6 +159,16 @@ constexpr double gemv_gbyte_count(rocblas_operation transA, rocblas_int m, rocbl
     return (sizeof(T) * (m * n + 2 * (transA == rocblas_operation_none ? n : m))) / 1e9;
 }
 
+/* \brief byte counts of GEMV_MULTI, A is read once for all k vectors */
+template <typename T>
+constexpr double
+    gemv_multi_gbyte_count(rocblas_operation transA, rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    size_t dim_x = transA == rocblas_operation_none ? n : m;
+    size_t dim_y = transA == rocblas_operation_none ? m : n;
+    return (sizeof(T) * (size_t(m) * n + k * (dim_x + 2 * dim_y))) / 1e9;
+}
+
 /* \brief byte counts of GER */
 template <typename T>
 constexpr double ger_gbyte_count(rocblas_int m, rocblas_int n)
@@ -8,6 +8,7 @@
 #include "cblas.h"
 #include "rocblas.h"
 #include "rocblas.hpp"
+#include <cmath>
 #include <type_traits>
 
 /*!\file
@@ -2352,6 +2353,115 @@ inline void cblas_gemm(rocblas_operation       transA,
                 ldc);
 }
 
+// saturate(activation(scale[i or j] * x + bias[i or j])) for the element (i, j) of a D of To
+template <typename Tw, typename To, typename Tc>
+Tw cblas_gemm_epilogue_element(Tw                      x,
+                               rocblas_int             i,
+                               rocblas_int             j,
+                               const Tc*               bias,
+                               rocblas_epilogue_vector bias_vector,
+                               const Tc*               scale,
+                               rocblas_epilogue_vector scale_vector,
+                               rocblas_activation      activation,
+                               bool                    saturate)
+{
+    // largest finite value of To
+    Tw max;
+    if constexpr(std::is_same<To, rocblas_half>{})
+        max = 65504.0f;
+    else if constexpr(std::is_same<To, rocblas_bfloat16>{})
+        max = 3.38953139e38f;
+    else
+        max = std::numeric_limits<Tw>::max();
+
+    if(scale)
+        x *= Tw(scale[scale_vector == rocblas_epilogue_vector_per_row ? i : j]);
+    if(bias)
+        x += Tw(bias[bias_vector == rocblas_epilogue_vector_per_row ? i : j]);
+
+    if(activation == rocblas_activation_relu)
+        x = x > 0 ? x : Tw(0);
+    else if(activation == rocblas_activation_gelu)
+        x = Tw(0.5) * x * (1 + std::tanh(Tw(0.7978845608028654) * (x + Tw(0.044715) * x * x * x)));
+
+    if(saturate)
+        x = x > max ? max : x < -max ? -max : x;
+    return x;
+}
+
+// gemm epilogue of rocblas_gemm_ex_epilogue and rocblas_gemm_ext2_epilogue
+// D := saturate(activation(scale .* D + bias)), computed in double for double D and in float
+// otherwise; a nullptr bias or scale is not applied
+template <typename Tc, typename To>
+void cblas_gemm_epilogue(rocblas_int             m,
+                         rocblas_int             n,
+                         const Tc*               bias,
+                         rocblas_epilogue_vector bias_vector,
+                         const Tc*               scale,
+                         rocblas_epilogue_vector scale_vector,
+                         rocblas_activation      activation,
+                         bool                    saturate,
+                         To*                     D,
+                         rocblas_int             ldd)
+{
+    using Tw = std::conditional_t<std::is_same<To, double>{}, double, float>;
+
+    for(rocblas_int j = 0; j < n; j++)
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            To& d = D[i + size_t(j) * ldd];
+            d     = To(cblas_gemm_epilogue_element<Tw, To>(
+                Tw(d), i, j, bias, bias_vector, scale, scale_vector, activation, saturate));
+        }
+}
+
+// dequantizing gemm epilogue of rocblas_gemm_ex_epilogue for int8 A and B
+// D := epilogue(alpha * column_scale[j] * row_scale[i] * (Q + row_offset[i] + column_offset[j])
+//      + beta * C), computed in float, Q being the int32 product of A and B with a leading
+// dimension of m; a nullptr vector is not applied
+template <typename To>
+void cblas_gemm_epilogue_dequantize(rocblas_int             m,
+                                    rocblas_int             n,
+                                    const int32_t*          Q,
+                                    float                   alpha,
+                                    float                   beta,
+                                    const To*               C,
+                                    rocblas_int             ldc,
+                                    const float*            row_scale,
+                                    const float*            column_scale,
+                                    const int32_t*          row_offset,
+                                    const int32_t*          column_offset,
+                                    const float*            bias,
+                                    rocblas_epilogue_vector bias_vector,
+                                    const float*            scale,
+                                    rocblas_epilogue_vector scale_vector,
+                                    rocblas_activation      activation,
+                                    bool                    saturate,
+                                    To*                     D,
+                                    rocblas_int             ldd)
+{
+    for(rocblas_int j = 0; j < n; j++)
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            float x = 0;
+            if(alpha)
+            {
+                int32_t q = Q[i + size_t(j) * m] + (row_offset ? row_offset[i] : 0);
+                if(column_offset)
+                    q += column_offset[j];
+                x = alpha * float(q);
+                x *= row_scale ? row_scale[i] : 1.0f;
+                if(column_scale)
+                    x *= column_scale[j];
+            }
+            if(beta)
+                x += beta * float(C[i + size_t(j) * ldc]);
+
+            D[i + size_t(j) * ldd] = To(cblas_gemm_epilogue_element<float, To>(
+                x, i, j, bias, bias_vector, scale, scale_vector, activation, saturate));
+        }
+}
+
 // symm
 template <typename T>
 void cblas_symm(rocblas_side side,
@@ -104,6 +104,25 @@ constexpr double nrm2_gflop_count<rocblas_double_complex>(rocblas_int n)
     return nrm2_gflop_count<rocblas_float_complex>(n);
 }
 
+// fused dot_nrm2, axpy_dot and axpy_nrm2
+template <typename T>
+constexpr double dot_nrm2_gflop_count(rocblas_int n)
+{
+    return dot_gflop_count<true, T>(n) + nrm2_gflop_count<T>(n);
+}
+
+template <typename T>
+constexpr double axpy_dot_gflop_count(rocblas_int n)
+{
+    return axpy_gflop_count<T>(n) + dot_gflop_count<true, T>(n);
+}
+
+template <typename T>
+constexpr double axpy_nrm2_gflop_count(rocblas_int n)
+{
+    return axpy_gflop_count<T>(n) + nrm2_gflop_count<T>(n);
+}
+
 // scal
 template <typename T, typename U>
 constexpr double scal_gflop_count(rocblas_int n)
@@ -292,6 +311,14 @@ constexpr double
     return (8.0 * m * n + 6.0 * (transA == rocblas_operation_none ? m : n)) / 1e9;
 }
 
+/* \brief floating point counts of GEMV_MULTI */
+template <typename T>
+constexpr double
+    gemv_multi_gflop_count(rocblas_operation transA, rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    return k * gemv_gflop_count<T>(transA, m, n);
+}
+
 /* \brief floating point counts of HBMV */
 template <typename T>
 constexpr double hbmv_gflop_count(rocblas_int n, rocblas_int k)
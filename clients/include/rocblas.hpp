@@ -747,6 +747,177 @@ static rocblas_status (*rocblas_rotmg_strided_batched)(rocblas_handle handle,
 MAP2CF(rocblas_rotmg_strided_batched, float, rocblas_srotmg_strided_batched);
 MAP2CF(rocblas_rotmg_strided_batched, double, rocblas_drotmg_strided_batched);
 
+// dot_nrm2
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_dot_nrm2)(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          const T*       y,
+                                          rocblas_int    incy,
+                                          T*             dot_result,
+                                          real_t<T>*     nrm2_result);
+
+MAP2CF(rocblas_dot_nrm2, float, rocblas_sdot_nrm2);
+MAP2CF(rocblas_dot_nrm2, double, rocblas_ddot_nrm2);
+MAP2CF(rocblas_dot_nrm2, rocblas_float_complex, rocblas_cdotc_nrm2);
+MAP2CF(rocblas_dot_nrm2, rocblas_double_complex, rocblas_zdotc_nrm2);
+
+// dot_nrm2_batched
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_dot_nrm2_batched)(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  const T* const x[],
+                                                  rocblas_int    incx,
+                                                  const T* const y[],
+                                                  rocblas_int    incy,
+                                                  rocblas_int    batch_count,
+                                                  T*             dot_results,
+                                                  real_t<T>*     nrm2_results);
+
+MAP2CF(rocblas_dot_nrm2_batched, float, rocblas_sdot_nrm2_batched);
+MAP2CF(rocblas_dot_nrm2_batched, double, rocblas_ddot_nrm2_batched);
+MAP2CF(rocblas_dot_nrm2_batched, rocblas_float_complex, rocblas_cdotc_nrm2_batched);
+MAP2CF(rocblas_dot_nrm2_batched, rocblas_double_complex, rocblas_zdotc_nrm2_batched);
+
+// dot_nrm2_strided_batched
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_dot_nrm2_strided_batched)(rocblas_handle handle,
+                                                          rocblas_int    n,
+                                                          const T*       x,
+                                                          rocblas_int    incx,
+                                                          rocblas_stride stridex,
+                                                          const T*       y,
+                                                          rocblas_int    incy,
+                                                          rocblas_stride stridey,
+                                                          rocblas_int    batch_count,
+                                                          T*             dot_results,
+                                                          real_t<T>*     nrm2_results);
+
+MAP2CF(rocblas_dot_nrm2_strided_batched, float, rocblas_sdot_nrm2_strided_batched);
+MAP2CF(rocblas_dot_nrm2_strided_batched, double, rocblas_ddot_nrm2_strided_batched);
+MAP2CF(rocblas_dot_nrm2_strided_batched, rocblas_float_complex, rocblas_cdotc_nrm2_strided_batched);
+MAP2CF(rocblas_dot_nrm2_strided_batched,
+       rocblas_double_complex,
+       rocblas_zdotc_nrm2_strided_batched);
+
+// axpy_dot
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_axpy_dot)(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       alpha,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          T*             y,
+                                          rocblas_int    incy,
+                                          const T*       z,
+                                          rocblas_int    incz,
+                                          T*             result);
+
+MAP2CF(rocblas_axpy_dot, float, rocblas_saxpy_dot);
+MAP2CF(rocblas_axpy_dot, double, rocblas_daxpy_dot);
+MAP2CF(rocblas_axpy_dot, rocblas_float_complex, rocblas_caxpy_dotc);
+MAP2CF(rocblas_axpy_dot, rocblas_double_complex, rocblas_zaxpy_dotc);
+
+// axpy_dot_batched
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_axpy_dot_batched)(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  const T*       alpha,
+                                                  const T* const x[],
+                                                  rocblas_int    incx,
+                                                  T* const       y[],
+                                                  rocblas_int    incy,
+                                                  const T* const z[],
+                                                  rocblas_int    incz,
+                                                  rocblas_int    batch_count,
+                                                  T*             results);
+
+MAP2CF(rocblas_axpy_dot_batched, float, rocblas_saxpy_dot_batched);
+MAP2CF(rocblas_axpy_dot_batched, double, rocblas_daxpy_dot_batched);
+MAP2CF(rocblas_axpy_dot_batched, rocblas_float_complex, rocblas_caxpy_dotc_batched);
+MAP2CF(rocblas_axpy_dot_batched, rocblas_double_complex, rocblas_zaxpy_dotc_batched);
+
+// axpy_dot_strided_batched
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_axpy_dot_strided_batched)(rocblas_handle handle,
+                                                          rocblas_int    n,
+                                                          const T*       alpha,
+                                                          const T*       x,
+                                                          rocblas_int    incx,
+                                                          rocblas_stride stridex,
+                                                          T*             y,
+                                                          rocblas_int    incy,
+                                                          rocblas_stride stridey,
+                                                          const T*       z,
+                                                          rocblas_int    incz,
+                                                          rocblas_stride stridez,
+                                                          rocblas_int    batch_count,
+                                                          T*             results);
+
+MAP2CF(rocblas_axpy_dot_strided_batched, float, rocblas_saxpy_dot_strided_batched);
+MAP2CF(rocblas_axpy_dot_strided_batched, double, rocblas_daxpy_dot_strided_batched);
+MAP2CF(rocblas_axpy_dot_strided_batched, rocblas_float_complex, rocblas_caxpy_dotc_strided_batched);
+MAP2CF(rocblas_axpy_dot_strided_batched,
+       rocblas_double_complex,
+       rocblas_zaxpy_dotc_strided_batched);
+
+// axpy_nrm2
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_axpy_nrm2)(rocblas_handle handle,
+                                           rocblas_int    n,
+                                           const T*       alpha,
+                                           const T*       x,
+                                           rocblas_int    incx,
+                                           T*             y,
+                                           rocblas_int    incy,
+                                           real_t<T>*     result);
+
+MAP2CF(rocblas_axpy_nrm2, float, rocblas_saxpy_nrm2);
+MAP2CF(rocblas_axpy_nrm2, double, rocblas_daxpy_nrm2);
+MAP2CF(rocblas_axpy_nrm2, rocblas_float_complex, rocblas_caxpy_nrm2);
+MAP2CF(rocblas_axpy_nrm2, rocblas_double_complex, rocblas_zaxpy_nrm2);
+
+// axpy_nrm2_batched
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_axpy_nrm2_batched)(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   const T*       alpha,
+                                                   const T* const x[],
+                                                   rocblas_int    incx,
+                                                   T* const       y[],
+                                                   rocblas_int    incy,
+                                                   rocblas_int    batch_count,
+                                                   real_t<T>*     results);
+
+MAP2CF(rocblas_axpy_nrm2_batched, float, rocblas_saxpy_nrm2_batched);
+MAP2CF(rocblas_axpy_nrm2_batched, double, rocblas_daxpy_nrm2_batched);
+MAP2CF(rocblas_axpy_nrm2_batched, rocblas_float_complex, rocblas_caxpy_nrm2_batched);
+MAP2CF(rocblas_axpy_nrm2_batched, rocblas_double_complex, rocblas_zaxpy_nrm2_batched);
+
+// axpy_nrm2_strided_batched
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_axpy_nrm2_strided_batched)(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           const T*       alpha,
+                                                           const T*       x,
+                                                           rocblas_int    incx,
+                                                           rocblas_stride stridex,
+                                                           T*             y,
+                                                           rocblas_int    incy,
+                                                           rocblas_stride stridey,
+                                                           rocblas_int    batch_count,
+                                                           real_t<T>*     results);
+
+MAP2CF(rocblas_axpy_nrm2_strided_batched, float, rocblas_saxpy_nrm2_strided_batched);
+MAP2CF(rocblas_axpy_nrm2_strided_batched, double, rocblas_daxpy_nrm2_strided_batched);
+MAP2CF(rocblas_axpy_nrm2_strided_batched,
+       rocblas_float_complex,
+       rocblas_caxpy_nrm2_strided_batched);
+MAP2CF(rocblas_axpy_nrm2_strided_batched,
+       rocblas_double_complex,
+       rocblas_zaxpy_nrm2_strided_batched);
+
 /*
  * ===========================================================================
  *    level 2 BLAS
@@ -1162,6 +1333,139 @@ MAP2CF(rocblas_gemv_strided_batched, double, rocblas_dgemv_strided_batched);
 MAP2CF(rocblas_gemv_strided_batched, rocblas_float_complex, rocblas_cgemv_strided_batched);
 MAP2CF(rocblas_gemv_strided_batched, rocblas_double_complex, rocblas_zgemv_strided_batched);
 
+// gemv_multi
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_gemv_multi)(rocblas_handle    handle,
+                                            rocblas_operation transA,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const T*          alpha,
+                                            const T*          A,
+                                            rocblas_int       lda,
+                                            const T*          x,
+                                            rocblas_int       incx,
+                                            rocblas_stride    stride_x,
+                                            const T*          beta,
+                                            T*                y,
+                                            rocblas_int       incy,
+                                            rocblas_stride    stride_y);
+
+MAP2CF(rocblas_gemv_multi, float, rocblas_sgemv_multi);
+MAP2CF(rocblas_gemv_multi, double, rocblas_dgemv_multi);
+MAP2CF(rocblas_gemv_multi, rocblas_float_complex, rocblas_cgemv_multi);
+MAP2CF(rocblas_gemv_multi, rocblas_double_complex, rocblas_zgemv_multi);
+
+// gemv_grouped
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_gemv_grouped)(rocblas_handle     handle,
+                                              rocblas_operation  transA,
+                                              const rocblas_int* m,
+                                              const rocblas_int* n,
+                                              const T*           alpha,
+                                              const T* const     A[],
+                                              const rocblas_int* lda,
+                                              const T* const     x[],
+                                              const rocblas_int* incx,
+                                              const T*           beta,
+                                              T* const           y[],
+                                              const rocblas_int* incy,
+                                              rocblas_int        group_count);
+
+MAP2CF(rocblas_gemv_grouped, float, rocblas_sgemv_grouped);
+MAP2CF(rocblas_gemv_grouped, double, rocblas_dgemv_grouped);
+MAP2CF(rocblas_gemv_grouped, rocblas_float_complex, rocblas_cgemv_grouped);
+MAP2CF(rocblas_gemv_grouped, rocblas_double_complex, rocblas_zgemv_grouped);
+
+// ger_deferred
+template <typename T, bool CONJ, bool FORTRAN = false>
+static rocblas_status (*rocblas_ger_deferred)(rocblas_handle      handle,
+                                              rocblas_rank_update update,
+                                              rocblas_int         m,
+                                              rocblas_int         n,
+                                              const T*            alpha,
+                                              const T*            x,
+                                              rocblas_int         incx,
+                                              const T*            y,
+                                              rocblas_int         incy,
+                                              T*                  A,
+                                              rocblas_int         lda);
+
+MAP2CF(rocblas_ger_deferred, float, false, rocblas_sger_deferred);
+MAP2CF(rocblas_ger_deferred, double, false, rocblas_dger_deferred);
+MAP2CF(rocblas_ger_deferred, rocblas_float_complex, false, rocblas_cgeru_deferred);
+MAP2CF(rocblas_ger_deferred, rocblas_double_complex, false, rocblas_zgeru_deferred);
+MAP2CF(rocblas_ger_deferred, rocblas_float_complex, true, rocblas_cgerc_deferred);
+MAP2CF(rocblas_ger_deferred, rocblas_double_complex, true, rocblas_zgerc_deferred);
+
+// syr_deferred
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_syr_deferred)(rocblas_handle      handle,
+                                              rocblas_rank_update update,
+                                              rocblas_fill        uplo,
+                                              rocblas_int         n,
+                                              const T*            alpha,
+                                              const T*            x,
+                                              rocblas_int         incx,
+                                              T*                  A,
+                                              rocblas_int         lda);
+
+MAP2CF(rocblas_syr_deferred, float, rocblas_ssyr_deferred);
+MAP2CF(rocblas_syr_deferred, double, rocblas_dsyr_deferred);
+MAP2CF(rocblas_syr_deferred, rocblas_float_complex, rocblas_csyr_deferred);
+MAP2CF(rocblas_syr_deferred, rocblas_double_complex, rocblas_zsyr_deferred);
+
+// her_deferred
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_her_deferred)(rocblas_handle      handle,
+                                              rocblas_rank_update update,
+                                              rocblas_fill        uplo,
+                                              rocblas_int         n,
+                                              const real_t<T>*    alpha,
+                                              const T*            x,
+                                              rocblas_int         incx,
+                                              T*                  A,
+                                              rocblas_int         lda);
+
+MAP2CF(rocblas_her_deferred, rocblas_float_complex, rocblas_cher_deferred);
+MAP2CF(rocblas_her_deferred, rocblas_double_complex, rocblas_zher_deferred);
+
+// syr2_deferred
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_syr2_deferred)(rocblas_handle      handle,
+                                               rocblas_rank_update update,
+                                               rocblas_fill        uplo,
+                                               rocblas_int         n,
+                                               const T*            alpha,
+                                               const T*            x,
+                                               rocblas_int         incx,
+                                               const T*            y,
+                                               rocblas_int         incy,
+                                               T*                  A,
+                                               rocblas_int         lda);
+
+MAP2CF(rocblas_syr2_deferred, float, rocblas_ssyr2_deferred);
+MAP2CF(rocblas_syr2_deferred, double, rocblas_dsyr2_deferred);
+MAP2CF(rocblas_syr2_deferred, rocblas_float_complex, rocblas_csyr2_deferred);
+MAP2CF(rocblas_syr2_deferred, rocblas_double_complex, rocblas_zsyr2_deferred);
+
+// her2_deferred
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_her2_deferred)(rocblas_handle      handle,
+                                               rocblas_rank_update update,
+                                               rocblas_fill        uplo,
+                                               rocblas_int         n,
+                                               const T*            alpha,
+                                               const T*            x,
+                                               rocblas_int         incx,
+                                               const T*            y,
+                                               rocblas_int         incy,
+                                               T*                  A,
+                                               rocblas_int         lda);
+
+MAP2CF(rocblas_her2_deferred, rocblas_float_complex, rocblas_cher2_deferred);
+MAP2CF(rocblas_her2_deferred, rocblas_double_complex, rocblas_zher2_deferred);
+
 // tpmv
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_tpmv)(rocblas_handle    handle,
@@ -2230,6 +2534,30 @@ MAP2CF(rocblas_gemm_strided_batched, rocblas_half, rocblas_hgemm_strided_batched
 MAP2CF(rocblas_gemm_strided_batched, rocblas_float_complex, rocblas_cgemm_strided_batched);
 MAP2CF(rocblas_gemm_strided_batched, rocblas_double_complex, rocblas_zgemm_strided_batched);
 
+// gemm_grouped
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_gemm_grouped)(rocblas_handle       handle,
+                                              rocblas_pointer_mode array_mode,
+                                              rocblas_operation    transA,
+                                              rocblas_operation    transB,
+                                              const rocblas_int*   m,
+                                              const rocblas_int*   n,
+                                              const rocblas_int*   k,
+                                              const T*             alpha,
+                                              const T* const       A[],
+                                              const rocblas_int*   lda,
+                                              const T* const       B[],
+                                              const rocblas_int*   ldb,
+                                              const T*             beta,
+                                              T* const             C[],
+                                              const rocblas_int*   ldc,
+                                              rocblas_int          group_count);
+
+MAP2CF(rocblas_gemm_grouped, float, rocblas_sgemm_grouped);
+MAP2CF(rocblas_gemm_grouped, double, rocblas_dgemm_grouped);
+MAP2CF(rocblas_gemm_grouped, rocblas_float_complex, rocblas_cgemm_grouped);
+MAP2CF(rocblas_gemm_grouped, rocblas_double_complex, rocblas_zgemm_grouped);
+
 // hemm
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_hemm)(rocblas_handle handle,
@@ -2806,6 +3134,81 @@ MAP2CF(rocblas_trmm_strided_batched, double, rocblas_dtrmm_strided_batched);
 MAP2CF(rocblas_trmm_strided_batched, rocblas_float_complex, rocblas_ctrmm_strided_batched);
 MAP2CF(rocblas_trmm_strided_batched, rocblas_double_complex, rocblas_ztrmm_strided_batched);
 
+// trmm_outofplace
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_trmm_outofplace)(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transA,
+                                                rocblas_diagonal  diag,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                const T*          alpha,
+                                                const T*          A,
+                                                rocblas_int       lda,
+                                                const T*          B,
+                                                rocblas_int       ldb,
+                                                T*                C,
+                                                rocblas_int       ldc);
+
+MAP2CF(rocblas_trmm_outofplace, float, rocblas_strmm_outofplace);
+MAP2CF(rocblas_trmm_outofplace, double, rocblas_dtrmm_outofplace);
+MAP2CF(rocblas_trmm_outofplace, rocblas_float_complex, rocblas_ctrmm_outofplace);
+MAP2CF(rocblas_trmm_outofplace, rocblas_double_complex, rocblas_ztrmm_outofplace);
+
+// trmm_outofplace_batched
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_trmm_outofplace_batched)(rocblas_handle    handle,
+                                                        rocblas_side      side,
+                                                        rocblas_fill      uplo,
+                                                        rocblas_operation transA,
+                                                        rocblas_diagonal  diag,
+                                                        rocblas_int       m,
+                                                        rocblas_int       n,
+                                                        const T*          alpha,
+                                                        const T* const    A[],
+                                                        rocblas_int       lda,
+                                                        const T* const    B[],
+                                                        rocblas_int       ldb,
+                                                        T* const          C[],
+                                                        rocblas_int       ldc,
+                                                        rocblas_int       batch_count);
+
+MAP2CF(rocblas_trmm_outofplace_batched, float, rocblas_strmm_outofplace_batched);
+MAP2CF(rocblas_trmm_outofplace_batched, double, rocblas_dtrmm_outofplace_batched);
+MAP2CF(rocblas_trmm_outofplace_batched, rocblas_float_complex, rocblas_ctrmm_outofplace_batched);
+MAP2CF(rocblas_trmm_outofplace_batched, rocblas_double_complex, rocblas_ztrmm_outofplace_batched);
+
+// trmm_outofplace_strided_batched
+template <typename T, bool FORTRAN = false>
+static rocblas_status (*rocblas_trmm_outofplace_strided_batched)(rocblas_handle    handle,
+                                                                rocblas_side      side,
+                                                                rocblas_fill      uplo,
+                                                                rocblas_operation transA,
+                                                                rocblas_diagonal  diag,
+                                                                rocblas_int       m,
+                                                                rocblas_int       n,
+                                                                const T*          alpha,
+                                                                const T*          A,
+                                                                rocblas_int       lda,
+                                                                rocblas_stride    stride_A,
+                                                                const T*          B,
+                                                                rocblas_int       ldb,
+                                                                rocblas_stride    stride_B,
+                                                                T*                C,
+                                                                rocblas_int       ldc,
+                                                                rocblas_stride    stride_C,
+                                                                rocblas_int       batch_count);
+
+MAP2CF(rocblas_trmm_outofplace_strided_batched, float, rocblas_strmm_outofplace_strided_batched);
+MAP2CF(rocblas_trmm_outofplace_strided_batched, double, rocblas_dtrmm_outofplace_strided_batched);
+MAP2CF(rocblas_trmm_outofplace_strided_batched,
+       rocblas_float_complex,
+       rocblas_ctrmm_outofplace_strided_batched);
+MAP2CF(rocblas_trmm_outofplace_strided_batched,
+       rocblas_double_complex,
+       rocblas_ztrmm_outofplace_strided_batched);
+
 // trsm
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_trsm)(rocblas_handle    handle,
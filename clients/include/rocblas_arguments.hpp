@@ -88,6 +88,12 @@ struct Arguments
 
     rocblas_atomics_mode atomics_mode;
 
+    rocblas_reduction_mode reduction_mode;
+
+    rocblas_accuracy_mode accuracy_mode;
+
+    rocblas_packed_mode packed_mode;
+
     // 16 bit
 
     uint16_t threads;
@@ -159,6 +165,9 @@ struct Arguments
     OPER(compute_type) SEP           \
     OPER(initialization) SEP         \
     OPER(atomics_mode) SEP           \
+    OPER(reduction_mode) SEP         \
+    OPER(accuracy_mode) SEP          \
+    OPER(packed_mode) SEP            \
     OPER(threads) SEP                \
     OPER(streams) SEP                \
     OPER(devices) SEP                \
@@ -3042,6 +3042,783 @@ module rocblas_interface
         return
     end function rocblas_drotmg_strided_batched_fortran
 
+    ! dot_nrm2
+    function rocblas_sdot_nrm2_fortran(handle, n, x, incx, y, incy, dot_result, nrm2_result) &
+            result(res) &
+            bind(c, name = 'rocblas_sdot_nrm2_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: dot_result
+        type(c_ptr), value :: nrm2_result
+        integer(c_int) :: res
+        res = rocblas_sdot_nrm2(handle, n, x, incx, y, incy, dot_result, nrm2_result)
+        return
+    end function rocblas_sdot_nrm2_fortran
+
+    function rocblas_ddot_nrm2_fortran(handle, n, x, incx, y, incy, dot_result, nrm2_result) &
+            result(res) &
+            bind(c, name = 'rocblas_ddot_nrm2_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: dot_result
+        type(c_ptr), value :: nrm2_result
+        integer(c_int) :: res
+        res = rocblas_ddot_nrm2(handle, n, x, incx, y, incy, dot_result, nrm2_result)
+        return
+    end function rocblas_ddot_nrm2_fortran
+
+    function rocblas_cdotc_nrm2_fortran(handle, n, x, incx, y, incy, dot_result, nrm2_result) &
+            result(res) &
+            bind(c, name = 'rocblas_cdotc_nrm2_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: dot_result
+        type(c_ptr), value :: nrm2_result
+        integer(c_int) :: res
+        res = rocblas_cdotc_nrm2(handle, n, x, incx, y, incy, dot_result, nrm2_result)
+        return
+    end function rocblas_cdotc_nrm2_fortran
+
+    function rocblas_zdotc_nrm2_fortran(handle, n, x, incx, y, incy, dot_result, nrm2_result) &
+            result(res) &
+            bind(c, name = 'rocblas_zdotc_nrm2_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: dot_result
+        type(c_ptr), value :: nrm2_result
+        integer(c_int) :: res
+        res = rocblas_zdotc_nrm2(handle, n, x, incx, y, incy, dot_result, nrm2_result)
+        return
+    end function rocblas_zdotc_nrm2_fortran
+
+    ! dot_nrm2_batched
+    function rocblas_sdot_nrm2_batched_fortran(handle, n, x, incx, y, incy, batch_count, &
+            dot_results, nrm2_results) &
+            result(res) &
+            bind(c, name = 'rocblas_sdot_nrm2_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: dot_results
+        type(c_ptr), value :: nrm2_results
+        integer(c_int) :: res
+        res = rocblas_sdot_nrm2_batched(handle, n, x, incx, y, incy, batch_count, dot_results, &
+            nrm2_results)
+        return
+    end function rocblas_sdot_nrm2_batched_fortran
+
+    function rocblas_ddot_nrm2_batched_fortran(handle, n, x, incx, y, incy, batch_count, &
+            dot_results, nrm2_results) &
+            result(res) &
+            bind(c, name = 'rocblas_ddot_nrm2_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: dot_results
+        type(c_ptr), value :: nrm2_results
+        integer(c_int) :: res
+        res = rocblas_ddot_nrm2_batched(handle, n, x, incx, y, incy, batch_count, dot_results, &
+            nrm2_results)
+        return
+    end function rocblas_ddot_nrm2_batched_fortran
+
+    function rocblas_cdotc_nrm2_batched_fortran(handle, n, x, incx, y, incy, batch_count, &
+            dot_results, nrm2_results) &
+            result(res) &
+            bind(c, name = 'rocblas_cdotc_nrm2_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: dot_results
+        type(c_ptr), value :: nrm2_results
+        integer(c_int) :: res
+        res = rocblas_cdotc_nrm2_batched(handle, n, x, incx, y, incy, batch_count, dot_results, &
+            nrm2_results)
+        return
+    end function rocblas_cdotc_nrm2_batched_fortran
+
+    function rocblas_zdotc_nrm2_batched_fortran(handle, n, x, incx, y, incy, batch_count, &
+            dot_results, nrm2_results) &
+            result(res) &
+            bind(c, name = 'rocblas_zdotc_nrm2_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: dot_results
+        type(c_ptr), value :: nrm2_results
+        integer(c_int) :: res
+        res = rocblas_zdotc_nrm2_batched(handle, n, x, incx, y, incy, batch_count, dot_results, &
+            nrm2_results)
+        return
+    end function rocblas_zdotc_nrm2_batched_fortran
+
+    ! dot_nrm2_strided_batched
+    function rocblas_sdot_nrm2_strided_batched_fortran(handle, n, x, incx, stridex, y, incy, &
+            stridey, batch_count, dot_results, nrm2_results) &
+            result(res) &
+            bind(c, name = 'rocblas_sdot_nrm2_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: dot_results
+        type(c_ptr), value :: nrm2_results
+        integer(c_int) :: res
+        res = rocblas_sdot_nrm2_strided_batched(handle, n, x, incx, stridex, y, incy, stridey, &
+            batch_count, dot_results, nrm2_results)
+        return
+    end function rocblas_sdot_nrm2_strided_batched_fortran
+
+    function rocblas_ddot_nrm2_strided_batched_fortran(handle, n, x, incx, stridex, y, incy, &
+            stridey, batch_count, dot_results, nrm2_results) &
+            result(res) &
+            bind(c, name = 'rocblas_ddot_nrm2_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: dot_results
+        type(c_ptr), value :: nrm2_results
+        integer(c_int) :: res
+        res = rocblas_ddot_nrm2_strided_batched(handle, n, x, incx, stridex, y, incy, stridey, &
+            batch_count, dot_results, nrm2_results)
+        return
+    end function rocblas_ddot_nrm2_strided_batched_fortran
+
+    function rocblas_cdotc_nrm2_strided_batched_fortran(handle, n, x, incx, stridex, y, incy, &
+            stridey, batch_count, dot_results, nrm2_results) &
+            result(res) &
+            bind(c, name = 'rocblas_cdotc_nrm2_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: dot_results
+        type(c_ptr), value :: nrm2_results
+        integer(c_int) :: res
+        res = rocblas_cdotc_nrm2_strided_batched(handle, n, x, incx, stridex, y, incy, stridey, &
+            batch_count, dot_results, nrm2_results)
+        return
+    end function rocblas_cdotc_nrm2_strided_batched_fortran
+
+    function rocblas_zdotc_nrm2_strided_batched_fortran(handle, n, x, incx, stridex, y, incy, &
+            stridey, batch_count, dot_results, nrm2_results) &
+            result(res) &
+            bind(c, name = 'rocblas_zdotc_nrm2_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: dot_results
+        type(c_ptr), value :: nrm2_results
+        integer(c_int) :: res
+        res = rocblas_zdotc_nrm2_strided_batched(handle, n, x, incx, stridex, y, incy, stridey, &
+            batch_count, dot_results, nrm2_results)
+        return
+    end function rocblas_zdotc_nrm2_strided_batched_fortran
+
+    ! axpy_dot
+    function rocblas_saxpy_dot_fortran(handle, n, alpha, x, incx, y, incy, z, incz, result) &
+            result(res) &
+            bind(c, name = 'rocblas_saxpy_dot_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        type(c_ptr), value :: result
+        integer(c_int) :: res
+        res = rocblas_saxpy_dot(handle, n, alpha, x, incx, y, incy, z, incz, result)
+        return
+    end function rocblas_saxpy_dot_fortran
+
+    function rocblas_daxpy_dot_fortran(handle, n, alpha, x, incx, y, incy, z, incz, result) &
+            result(res) &
+            bind(c, name = 'rocblas_daxpy_dot_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        type(c_ptr), value :: result
+        integer(c_int) :: res
+        res = rocblas_daxpy_dot(handle, n, alpha, x, incx, y, incy, z, incz, result)
+        return
+    end function rocblas_daxpy_dot_fortran
+
+    function rocblas_caxpy_dotc_fortran(handle, n, alpha, x, incx, y, incy, z, incz, result) &
+            result(res) &
+            bind(c, name = 'rocblas_caxpy_dotc_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        type(c_ptr), value :: result
+        integer(c_int) :: res
+        res = rocblas_caxpy_dotc(handle, n, alpha, x, incx, y, incy, z, incz, result)
+        return
+    end function rocblas_caxpy_dotc_fortran
+
+    function rocblas_zaxpy_dotc_fortran(handle, n, alpha, x, incx, y, incy, z, incz, result) &
+            result(res) &
+            bind(c, name = 'rocblas_zaxpy_dotc_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        type(c_ptr), value :: result
+        integer(c_int) :: res
+        res = rocblas_zaxpy_dotc(handle, n, alpha, x, incx, y, incy, z, incz, result)
+        return
+    end function rocblas_zaxpy_dotc_fortran
+
+    ! axpy_dot_batched
+    function rocblas_saxpy_dot_batched_fortran(handle, n, alpha, x, incx, y, incy, z, incz, &
+            batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_saxpy_dot_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_saxpy_dot_batched(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, &
+            results)
+        return
+    end function rocblas_saxpy_dot_batched_fortran
+
+    function rocblas_daxpy_dot_batched_fortran(handle, n, alpha, x, incx, y, incy, z, incz, &
+            batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_daxpy_dot_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_daxpy_dot_batched(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, &
+            results)
+        return
+    end function rocblas_daxpy_dot_batched_fortran
+
+    function rocblas_caxpy_dotc_batched_fortran(handle, n, alpha, x, incx, y, incy, z, incz, &
+            batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_caxpy_dotc_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_caxpy_dotc_batched(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, &
+            results)
+        return
+    end function rocblas_caxpy_dotc_batched_fortran
+
+    function rocblas_zaxpy_dotc_batched_fortran(handle, n, alpha, x, incx, y, incy, z, incz, &
+            batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_zaxpy_dotc_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_zaxpy_dotc_batched(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, &
+            results)
+        return
+    end function rocblas_zaxpy_dotc_batched_fortran
+
+    ! axpy_dot_strided_batched
+    function rocblas_saxpy_dot_strided_batched_fortran(handle, n, alpha, x, incx, stridex, y, &
+            incy, stridey, z, incz, stridez, batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_saxpy_dot_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        integer(c_int64_t), value :: stridez
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_saxpy_dot_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+            stridey, z, incz, stridez, batch_count, results)
+        return
+    end function rocblas_saxpy_dot_strided_batched_fortran
+
+    function rocblas_daxpy_dot_strided_batched_fortran(handle, n, alpha, x, incx, stridex, y, &
+            incy, stridey, z, incz, stridez, batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_daxpy_dot_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        integer(c_int64_t), value :: stridez
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_daxpy_dot_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+            stridey, z, incz, stridez, batch_count, results)
+        return
+    end function rocblas_daxpy_dot_strided_batched_fortran
+
+    function rocblas_caxpy_dotc_strided_batched_fortran(handle, n, alpha, x, incx, stridex, y, &
+            incy, stridey, z, incz, stridez, batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_caxpy_dotc_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        integer(c_int64_t), value :: stridez
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_caxpy_dotc_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+            stridey, z, incz, stridez, batch_count, results)
+        return
+    end function rocblas_caxpy_dotc_strided_batched_fortran
+
+    function rocblas_zaxpy_dotc_strided_batched_fortran(handle, n, alpha, x, incx, stridex, y, &
+            incy, stridey, z, incz, stridez, batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_zaxpy_dotc_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        type(c_ptr), value :: z
+        integer(c_int), value :: incz
+        integer(c_int64_t), value :: stridez
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_zaxpy_dotc_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+            stridey, z, incz, stridez, batch_count, results)
+        return
+    end function rocblas_zaxpy_dotc_strided_batched_fortran
+
+    ! axpy_nrm2
+    function rocblas_saxpy_nrm2_fortran(handle, n, alpha, x, incx, y, incy, result) &
+            result(res) &
+            bind(c, name = 'rocblas_saxpy_nrm2_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: result
+        integer(c_int) :: res
+        res = rocblas_saxpy_nrm2(handle, n, alpha, x, incx, y, incy, result)
+        return
+    end function rocblas_saxpy_nrm2_fortran
+
+    function rocblas_daxpy_nrm2_fortran(handle, n, alpha, x, incx, y, incy, result) &
+            result(res) &
+            bind(c, name = 'rocblas_daxpy_nrm2_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: result
+        integer(c_int) :: res
+        res = rocblas_daxpy_nrm2(handle, n, alpha, x, incx, y, incy, result)
+        return
+    end function rocblas_daxpy_nrm2_fortran
+
+    function rocblas_caxpy_nrm2_fortran(handle, n, alpha, x, incx, y, incy, result) &
+            result(res) &
+            bind(c, name = 'rocblas_caxpy_nrm2_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: result
+        integer(c_int) :: res
+        res = rocblas_caxpy_nrm2(handle, n, alpha, x, incx, y, incy, result)
+        return
+    end function rocblas_caxpy_nrm2_fortran
+
+    function rocblas_zaxpy_nrm2_fortran(handle, n, alpha, x, incx, y, incy, result) &
+            result(res) &
+            bind(c, name = 'rocblas_zaxpy_nrm2_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: result
+        integer(c_int) :: res
+        res = rocblas_zaxpy_nrm2(handle, n, alpha, x, incx, y, incy, result)
+        return
+    end function rocblas_zaxpy_nrm2_fortran
+
+    ! axpy_nrm2_batched
+    function rocblas_saxpy_nrm2_batched_fortran(handle, n, alpha, x, incx, y, incy, batch_count, &
+            results) &
+            result(res) &
+            bind(c, name = 'rocblas_saxpy_nrm2_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_saxpy_nrm2_batched(handle, n, alpha, x, incx, y, incy, batch_count, results)
+        return
+    end function rocblas_saxpy_nrm2_batched_fortran
+
+    function rocblas_daxpy_nrm2_batched_fortran(handle, n, alpha, x, incx, y, incy, batch_count, &
+            results) &
+            result(res) &
+            bind(c, name = 'rocblas_daxpy_nrm2_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_daxpy_nrm2_batched(handle, n, alpha, x, incx, y, incy, batch_count, results)
+        return
+    end function rocblas_daxpy_nrm2_batched_fortran
+
+    function rocblas_caxpy_nrm2_batched_fortran(handle, n, alpha, x, incx, y, incy, batch_count, &
+            results) &
+            result(res) &
+            bind(c, name = 'rocblas_caxpy_nrm2_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_caxpy_nrm2_batched(handle, n, alpha, x, incx, y, incy, batch_count, results)
+        return
+    end function rocblas_caxpy_nrm2_batched_fortran
+
+    function rocblas_zaxpy_nrm2_batched_fortran(handle, n, alpha, x, incx, y, incy, batch_count, &
+            results) &
+            result(res) &
+            bind(c, name = 'rocblas_zaxpy_nrm2_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_zaxpy_nrm2_batched(handle, n, alpha, x, incx, y, incy, batch_count, results)
+        return
+    end function rocblas_zaxpy_nrm2_batched_fortran
+
+    ! axpy_nrm2_strided_batched
+    function rocblas_saxpy_nrm2_strided_batched_fortran(handle, n, alpha, x, incx, stridex, y, &
+            incy, stridey, batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_saxpy_nrm2_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_saxpy_nrm2_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+            stridey, batch_count, results)
+        return
+    end function rocblas_saxpy_nrm2_strided_batched_fortran
+
+    function rocblas_daxpy_nrm2_strided_batched_fortran(handle, n, alpha, x, incx, stridex, y, &
+            incy, stridey, batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_daxpy_nrm2_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_daxpy_nrm2_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+            stridey, batch_count, results)
+        return
+    end function rocblas_daxpy_nrm2_strided_batched_fortran
+
+    function rocblas_caxpy_nrm2_strided_batched_fortran(handle, n, alpha, x, incx, stridex, y, &
+            incy, stridey, batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_caxpy_nrm2_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_caxpy_nrm2_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+            stridey, batch_count, results)
+        return
+    end function rocblas_caxpy_nrm2_strided_batched_fortran
+
+    function rocblas_zaxpy_nrm2_strided_batched_fortran(handle, n, alpha, x, incx, stridex, y, &
+            incy, stridey, batch_count, results) &
+            result(res) &
+            bind(c, name = 'rocblas_zaxpy_nrm2_strided_batched_fortran')
+        use iso_c_binding
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stridex
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stridey
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: results
+        integer(c_int) :: res
+        res = rocblas_zaxpy_nrm2_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+            stridey, batch_count, results)
+        return
+    end function rocblas_zaxpy_nrm2_strided_batched_fortran
+
     !--------!
     ! blas 2 !
     !--------!
@@ -3947,6 +4724,216 @@ module rocblas_interface
               x, incx, stride_x, beta, y, incy, stride_y, batch_count)
     end function rocblas_zgemv_strided_batched_fortran
 
+    ! gemv_multi
+    function rocblas_sgemv_multi_fortran(handle, trans, m, n, k, alpha, A, lda, &
+            x, incx, stride_x, beta, y, incy, stride_y) &
+            result(res) &
+            bind(c, name = 'rocblas_sgemv_multi_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stride_x
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stride_y
+        integer(c_int) :: res
+        res = rocblas_sgemv_multi(handle, trans, m, n, k, alpha, A, lda,&
+              x, incx, stride_x, beta, y, incy, stride_y)
+    end function rocblas_sgemv_multi_fortran
+
+    function rocblas_dgemv_multi_fortran(handle, trans, m, n, k, alpha, A, lda, &
+            x, incx, stride_x, beta, y, incy, stride_y) &
+            result(res) &
+            bind(c, name = 'rocblas_dgemv_multi_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stride_x
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stride_y
+        integer(c_int) :: res
+        res = rocblas_dgemv_multi(handle, trans, m, n, k, alpha, A, lda,&
+              x, incx, stride_x, beta, y, incy, stride_y)
+    end function rocblas_dgemv_multi_fortran
+
+    function rocblas_cgemv_multi_fortran(handle, trans, m, n, k, alpha, A, lda, &
+            x, incx, stride_x, beta, y, incy, stride_y) &
+            result(res) &
+            bind(c, name = 'rocblas_cgemv_multi_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stride_x
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stride_y
+        integer(c_int) :: res
+        res = rocblas_cgemv_multi(handle, trans, m, n, k, alpha, A, lda,&
+              x, incx, stride_x, beta, y, incy, stride_y)
+    end function rocblas_cgemv_multi_fortran
+
+    function rocblas_zgemv_multi_fortran(handle, trans, m, n, k, alpha, A, lda, &
+            x, incx, stride_x, beta, y, incy, stride_y) &
+            result(res) &
+            bind(c, name = 'rocblas_zgemv_multi_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        integer(c_int64_t), value :: stride_x
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        integer(c_int64_t), value :: stride_y
+        integer(c_int) :: res
+        res = rocblas_zgemv_multi(handle, trans, m, n, k, alpha, A, lda,&
+              x, incx, stride_x, beta, y, incy, stride_y)
+    end function rocblas_zgemv_multi_fortran
+
+    ! gemv_grouped
+    function rocblas_sgemv_grouped_fortran(handle, trans, m, n, alpha, A, lda, &
+            x, incx, beta, y, incy, group_count) &
+            result(res) &
+            bind(c, name = 'rocblas_sgemv_grouped_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: trans
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: x
+        type(c_ptr), value :: incx
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        type(c_ptr), value :: incy
+        integer(c_int), value :: group_count
+        integer(c_int) :: res
+        res = rocblas_sgemv_grouped(handle, trans, m, n, alpha, A, lda,&
+              x, incx, beta, y, incy, group_count)
+    end function rocblas_sgemv_grouped_fortran
+
+    function rocblas_dgemv_grouped_fortran(handle, trans, m, n, alpha, A, lda, &
+            x, incx, beta, y, incy, group_count) &
+            result(res) &
+            bind(c, name = 'rocblas_dgemv_grouped_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: trans
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: x
+        type(c_ptr), value :: incx
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        type(c_ptr), value :: incy
+        integer(c_int), value :: group_count
+        integer(c_int) :: res
+        res = rocblas_dgemv_grouped(handle, trans, m, n, alpha, A, lda,&
+              x, incx, beta, y, incy, group_count)
+    end function rocblas_dgemv_grouped_fortran
+
+    function rocblas_cgemv_grouped_fortran(handle, trans, m, n, alpha, A, lda, &
+            x, incx, beta, y, incy, group_count) &
+            result(res) &
+            bind(c, name = 'rocblas_cgemv_grouped_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: trans
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: x
+        type(c_ptr), value :: incx
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        type(c_ptr), value :: incy
+        integer(c_int), value :: group_count
+        integer(c_int) :: res
+        res = rocblas_cgemv_grouped(handle, trans, m, n, alpha, A, lda,&
+              x, incx, beta, y, incy, group_count)
+    end function rocblas_cgemv_grouped_fortran
+
+    function rocblas_zgemv_grouped_fortran(handle, trans, m, n, alpha, A, lda, &
+            x, incx, beta, y, incy, group_count) &
+            result(res) &
+            bind(c, name = 'rocblas_zgemv_grouped_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: trans
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: x
+        type(c_ptr), value :: incx
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: y
+        type(c_ptr), value :: incy
+        integer(c_int), value :: group_count
+        integer(c_int) :: res
+        res = rocblas_zgemv_grouped(handle, trans, m, n, alpha, A, lda,&
+              x, incx, beta, y, incy, group_count)
+    end function rocblas_zgemv_grouped_fortran
+
     ! hbmv
     function rocblas_chbmv_fortran(handle, uplo, n, k, alpha, A, lda, &
             x, incx, beta, y, incy) &
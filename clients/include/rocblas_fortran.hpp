@@ -1423,6 +1423,415 @@ rocblas_status rocblas_drotmg_strided_batched_fortran(rocblas_handle handle,
                                                       rocblas_stride stride_param,
                                                       rocblas_int    batch_count);
 
+// dot_nrm2
+rocblas_status rocblas_sdot_nrm2_fortran(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const float*   x,
+                                         rocblas_int    incx,
+                                         const float*   y,
+                                         rocblas_int    incy,
+                                         float*         dot_result,
+                                         float*         nrm2_result);
+
+rocblas_status rocblas_ddot_nrm2_fortran(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const double*  x,
+                                         rocblas_int    incx,
+                                         const double*  y,
+                                         rocblas_int    incy,
+                                         double*        dot_result,
+                                         double*        nrm2_result);
+
+rocblas_status rocblas_cdotc_nrm2_fortran(rocblas_handle               handle,
+                                          rocblas_int                  n,
+                                          const rocblas_float_complex* x,
+                                          rocblas_int                  incx,
+                                          const rocblas_float_complex* y,
+                                          rocblas_int                  incy,
+                                          rocblas_float_complex*       dot_result,
+                                          float*                       nrm2_result);
+
+rocblas_status rocblas_zdotc_nrm2_fortran(rocblas_handle                handle,
+                                          rocblas_int                   n,
+                                          const rocblas_double_complex* x,
+                                          rocblas_int                   incx,
+                                          const rocblas_double_complex* y,
+                                          rocblas_int                   incy,
+                                          rocblas_double_complex*       dot_result,
+                                          double*                       nrm2_result);
+
+// dot_nrm2_batched
+rocblas_status rocblas_sdot_nrm2_batched_fortran(rocblas_handle     handle,
+                                                 rocblas_int        n,
+                                                 const float* const x[],
+                                                 rocblas_int        incx,
+                                                 const float* const y[],
+                                                 rocblas_int        incy,
+                                                 rocblas_int        batch_count,
+                                                 float*             dot_results,
+                                                 float*             nrm2_results);
+
+rocblas_status rocblas_ddot_nrm2_batched_fortran(rocblas_handle      handle,
+                                                 rocblas_int         n,
+                                                 const double* const x[],
+                                                 rocblas_int         incx,
+                                                 const double* const y[],
+                                                 rocblas_int         incy,
+                                                 rocblas_int         batch_count,
+                                                 double*             dot_results,
+                                                 double*             nrm2_results);
+
+rocblas_status rocblas_cdotc_nrm2_batched_fortran(rocblas_handle                     handle,
+                                                  rocblas_int                        n,
+                                                  const rocblas_float_complex* const x[],
+                                                  rocblas_int                        incx,
+                                                  const rocblas_float_complex* const y[],
+                                                  rocblas_int                        incy,
+                                                  rocblas_int                        batch_count,
+                                                  rocblas_float_complex*             dot_results,
+                                                  float*                             nrm2_results);
+
+rocblas_status rocblas_zdotc_nrm2_batched_fortran(rocblas_handle                      handle,
+                                                  rocblas_int                         n,
+                                                  const rocblas_double_complex* const x[],
+                                                  rocblas_int                         incx,
+                                                  const rocblas_double_complex* const y[],
+                                                  rocblas_int                         incy,
+                                                  rocblas_int                         batch_count,
+                                                  rocblas_double_complex*             dot_results,
+                                                  double*                             nrm2_results);
+
+// dot_nrm2_strided_batched
+rocblas_status rocblas_sdot_nrm2_strided_batched_fortran(rocblas_handle handle,
+                                                         rocblas_int    n,
+                                                         const float*   x,
+                                                         rocblas_int    incx,
+                                                         rocblas_stride stridex,
+                                                         const float*   y,
+                                                         rocblas_int    incy,
+                                                         rocblas_stride stridey,
+                                                         rocblas_int    batch_count,
+                                                         float*         dot_results,
+                                                         float*         nrm2_results);
+
+rocblas_status rocblas_ddot_nrm2_strided_batched_fortran(rocblas_handle handle,
+                                                         rocblas_int    n,
+                                                         const double*  x,
+                                                         rocblas_int    incx,
+                                                         rocblas_stride stridex,
+                                                         const double*  y,
+                                                         rocblas_int    incy,
+                                                         rocblas_stride stridey,
+                                                         rocblas_int    batch_count,
+                                                         double*        dot_results,
+                                                         double*        nrm2_results);
+
+rocblas_status rocblas_cdotc_nrm2_strided_batched_fortran(rocblas_handle               handle,
+                                                          rocblas_int                  n,
+                                                          const rocblas_float_complex* x,
+                                                          rocblas_int                  incx,
+                                                          rocblas_stride               stridex,
+                                                          const rocblas_float_complex* y,
+                                                          rocblas_int                  incy,
+                                                          rocblas_stride               stridey,
+                                                          rocblas_int                  batch_count,
+                                                          rocblas_float_complex*       dot_results,
+                                                          float* nrm2_results);
+
+rocblas_status rocblas_zdotc_nrm2_strided_batched_fortran(rocblas_handle                handle,
+                                                          rocblas_int                   n,
+                                                          const rocblas_double_complex* x,
+                                                          rocblas_int                   incx,
+                                                          rocblas_stride                stridex,
+                                                          const rocblas_double_complex* y,
+                                                          rocblas_int                   incy,
+                                                          rocblas_stride                stridey,
+                                                          rocblas_int             batch_count,
+                                                          rocblas_double_complex* dot_results,
+                                                          double*                 nrm2_results);
+
+// axpy_dot
+rocblas_status rocblas_saxpy_dot_fortran(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const float*   alpha,
+                                         const float*   x,
+                                         rocblas_int    incx,
+                                         float*         y,
+                                         rocblas_int    incy,
+                                         const float*   z,
+                                         rocblas_int    incz,
+                                         float*         result);
+
+rocblas_status rocblas_daxpy_dot_fortran(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const double*  alpha,
+                                         const double*  x,
+                                         rocblas_int    incx,
+                                         double*        y,
+                                         rocblas_int    incy,
+                                         const double*  z,
+                                         rocblas_int    incz,
+                                         double*        result);
+
+rocblas_status rocblas_caxpy_dotc_fortran(rocblas_handle               handle,
+                                          rocblas_int                  n,
+                                          const rocblas_float_complex* alpha,
+                                          const rocblas_float_complex* x,
+                                          rocblas_int                  incx,
+                                          rocblas_float_complex*       y,
+                                          rocblas_int                  incy,
+                                          const rocblas_float_complex* z,
+                                          rocblas_int                  incz,
+                                          rocblas_float_complex*       result);
+
+rocblas_status rocblas_zaxpy_dotc_fortran(rocblas_handle                handle,
+                                          rocblas_int                   n,
+                                          const rocblas_double_complex* alpha,
+                                          const rocblas_double_complex* x,
+                                          rocblas_int                   incx,
+                                          rocblas_double_complex*       y,
+                                          rocblas_int                   incy,
+                                          const rocblas_double_complex* z,
+                                          rocblas_int                   incz,
+                                          rocblas_double_complex*       result);
+
+// axpy_dot_batched
+rocblas_status rocblas_saxpy_dot_batched_fortran(rocblas_handle     handle,
+                                                 rocblas_int        n,
+                                                 const float*       alpha,
+                                                 const float* const x[],
+                                                 rocblas_int        incx,
+                                                 float* const       y[],
+                                                 rocblas_int        incy,
+                                                 const float* const z[],
+                                                 rocblas_int        incz,
+                                                 rocblas_int        batch_count,
+                                                 float*             results);
+
+rocblas_status rocblas_daxpy_dot_batched_fortran(rocblas_handle      handle,
+                                                 rocblas_int         n,
+                                                 const double*       alpha,
+                                                 const double* const x[],
+                                                 rocblas_int         incx,
+                                                 double* const       y[],
+                                                 rocblas_int         incy,
+                                                 const double* const z[],
+                                                 rocblas_int         incz,
+                                                 rocblas_int         batch_count,
+                                                 double*             results);
+
+rocblas_status rocblas_caxpy_dotc_batched_fortran(rocblas_handle                     handle,
+                                                  rocblas_int                        n,
+                                                  const rocblas_float_complex*       alpha,
+                                                  const rocblas_float_complex* const x[],
+                                                  rocblas_int                        incx,
+                                                  rocblas_float_complex* const       y[],
+                                                  rocblas_int                        incy,
+                                                  const rocblas_float_complex* const z[],
+                                                  rocblas_int                        incz,
+                                                  rocblas_int                        batch_count,
+                                                  rocblas_float_complex*             results);
+
+rocblas_status rocblas_zaxpy_dotc_batched_fortran(rocblas_handle                      handle,
+                                                  rocblas_int                         n,
+                                                  const rocblas_double_complex*       alpha,
+                                                  const rocblas_double_complex* const x[],
+                                                  rocblas_int                         incx,
+                                                  rocblas_double_complex* const       y[],
+                                                  rocblas_int                         incy,
+                                                  const rocblas_double_complex* const z[],
+                                                  rocblas_int                         incz,
+                                                  rocblas_int                         batch_count,
+                                                  rocblas_double_complex*             results);
+
+// axpy_dot_strided_batched
+rocblas_status rocblas_saxpy_dot_strided_batched_fortran(rocblas_handle handle,
+                                                         rocblas_int    n,
+                                                         const float*   alpha,
+                                                         const float*   x,
+                                                         rocblas_int    incx,
+                                                         rocblas_stride stridex,
+                                                         float*         y,
+                                                         rocblas_int    incy,
+                                                         rocblas_stride stridey,
+                                                         const float*   z,
+                                                         rocblas_int    incz,
+                                                         rocblas_stride stridez,
+                                                         rocblas_int    batch_count,
+                                                         float*         results);
+
+rocblas_status rocblas_daxpy_dot_strided_batched_fortran(rocblas_handle handle,
+                                                         rocblas_int    n,
+                                                         const double*  alpha,
+                                                         const double*  x,
+                                                         rocblas_int    incx,
+                                                         rocblas_stride stridex,
+                                                         double*        y,
+                                                         rocblas_int    incy,
+                                                         rocblas_stride stridey,
+                                                         const double*  z,
+                                                         rocblas_int    incz,
+                                                         rocblas_stride stridez,
+                                                         rocblas_int    batch_count,
+                                                         double*        results);
+
+rocblas_status rocblas_caxpy_dotc_strided_batched_fortran(rocblas_handle               handle,
+                                                          rocblas_int                  n,
+                                                          const rocblas_float_complex* alpha,
+                                                          const rocblas_float_complex* x,
+                                                          rocblas_int                  incx,
+                                                          rocblas_stride               stridex,
+                                                          rocblas_float_complex*       y,
+                                                          rocblas_int                  incy,
+                                                          rocblas_stride               stridey,
+                                                          const rocblas_float_complex* z,
+                                                          rocblas_int                  incz,
+                                                          rocblas_stride               stridez,
+                                                          rocblas_int                  batch_count,
+                                                          rocblas_float_complex*       results);
+
+rocblas_status rocblas_zaxpy_dotc_strided_batched_fortran(rocblas_handle                handle,
+                                                          rocblas_int                   n,
+                                                          const rocblas_double_complex* alpha,
+                                                          const rocblas_double_complex* x,
+                                                          rocblas_int                   incx,
+                                                          rocblas_stride                stridex,
+                                                          rocblas_double_complex*       y,
+                                                          rocblas_int                   incy,
+                                                          rocblas_stride                stridey,
+                                                          const rocblas_double_complex* z,
+                                                          rocblas_int                   incz,
+                                                          rocblas_stride                stridez,
+                                                          rocblas_int                   batch_count,
+                                                          rocblas_double_complex*       results);
+
+// axpy_nrm2
+rocblas_status rocblas_saxpy_nrm2_fortran(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const float*   alpha,
+                                          const float*   x,
+                                          rocblas_int    incx,
+                                          float*         y,
+                                          rocblas_int    incy,
+                                          float*         result);
+
+rocblas_status rocblas_daxpy_nrm2_fortran(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const double*  alpha,
+                                          const double*  x,
+                                          rocblas_int    incx,
+                                          double*        y,
+                                          rocblas_int    incy,
+                                          double*        result);
+
+rocblas_status rocblas_caxpy_nrm2_fortran(rocblas_handle               handle,
+                                          rocblas_int                  n,
+                                          const rocblas_float_complex* alpha,
+                                          const rocblas_float_complex* x,
+                                          rocblas_int                  incx,
+                                          rocblas_float_complex*       y,
+                                          rocblas_int                  incy,
+                                          float*                       result);
+
+rocblas_status rocblas_zaxpy_nrm2_fortran(rocblas_handle                handle,
+                                          rocblas_int                   n,
+                                          const rocblas_double_complex* alpha,
+                                          const rocblas_double_complex* x,
+                                          rocblas_int                   incx,
+                                          rocblas_double_complex*       y,
+                                          rocblas_int                   incy,
+                                          double*                       result);
+
+// axpy_nrm2_batched
+rocblas_status rocblas_saxpy_nrm2_batched_fortran(rocblas_handle     handle,
+                                                  rocblas_int        n,
+                                                  const float*       alpha,
+                                                  const float* const x[],
+                                                  rocblas_int        incx,
+                                                  float* const       y[],
+                                                  rocblas_int        incy,
+                                                  rocblas_int        batch_count,
+                                                  float*             results);
+
+rocblas_status rocblas_daxpy_nrm2_batched_fortran(rocblas_handle      handle,
+                                                  rocblas_int         n,
+                                                  const double*       alpha,
+                                                  const double* const x[],
+                                                  rocblas_int         incx,
+                                                  double* const       y[],
+                                                  rocblas_int         incy,
+                                                  rocblas_int         batch_count,
+                                                  double*             results);
+
+rocblas_status rocblas_caxpy_nrm2_batched_fortran(rocblas_handle                     handle,
+                                                  rocblas_int                        n,
+                                                  const rocblas_float_complex*       alpha,
+                                                  const rocblas_float_complex* const x[],
+                                                  rocblas_int                        incx,
+                                                  rocblas_float_complex* const       y[],
+                                                  rocblas_int                        incy,
+                                                  rocblas_int                        batch_count,
+                                                  float*                             results);
+
+rocblas_status rocblas_zaxpy_nrm2_batched_fortran(rocblas_handle                      handle,
+                                                  rocblas_int                         n,
+                                                  const rocblas_double_complex*       alpha,
+                                                  const rocblas_double_complex* const x[],
+                                                  rocblas_int                         incx,
+                                                  rocblas_double_complex* const       y[],
+                                                  rocblas_int                         incy,
+                                                  rocblas_int                         batch_count,
+                                                  double*                             results);
+
+// axpy_nrm2_strided_batched
+rocblas_status rocblas_saxpy_nrm2_strided_batched_fortran(rocblas_handle handle,
+                                                          rocblas_int    n,
+                                                          const float*   alpha,
+                                                          const float*   x,
+                                                          rocblas_int    incx,
+                                                          rocblas_stride stridex,
+                                                          float*         y,
+                                                          rocblas_int    incy,
+                                                          rocblas_stride stridey,
+                                                          rocblas_int    batch_count,
+                                                          float*         results);
+
+rocblas_status rocblas_daxpy_nrm2_strided_batched_fortran(rocblas_handle handle,
+                                                          rocblas_int    n,
+                                                          const double*  alpha,
+                                                          const double*  x,
+                                                          rocblas_int    incx,
+                                                          rocblas_stride stridex,
+                                                          double*        y,
+                                                          rocblas_int    incy,
+                                                          rocblas_stride stridey,
+                                                          rocblas_int    batch_count,
+                                                          double*        results);
+
+rocblas_status rocblas_caxpy_nrm2_strided_batched_fortran(rocblas_handle               handle,
+                                                          rocblas_int                  n,
+                                                          const rocblas_float_complex* alpha,
+                                                          const rocblas_float_complex* x,
+                                                          rocblas_int                  incx,
+                                                          rocblas_stride               stridex,
+                                                          rocblas_float_complex*       y,
+                                                          rocblas_int                  incy,
+                                                          rocblas_stride               stridey,
+                                                          rocblas_int                  batch_count,
+                                                          float*                       results);
+
+rocblas_status rocblas_zaxpy_nrm2_strided_batched_fortran(rocblas_handle                handle,
+                                                          rocblas_int                   n,
+                                                          const rocblas_double_complex* alpha,
+                                                          const rocblas_double_complex* x,
+                                                          rocblas_int                   incx,
+                                                          rocblas_stride                stridex,
+                                                          rocblas_double_complex*       y,
+                                                          rocblas_int                   incy,
+                                                          rocblas_stride                stridey,
+                                                          rocblas_int                   batch_count,
+                                                          double*                       results);
+
 /* ==========
  *    L2
  * ========== */
@@ -1809,6 +2218,333 @@ rocblas_status rocblas_zgemv_strided_batched_fortran(rocblas_handle
                                                      rocblas_stride                stridey,
                                                      rocblas_int                   batch_count);
 
+// gemv_multi
+rocblas_status rocblas_sgemv_multi_fortran(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const float*      alpha,
+                                           const float*      A,
+                                           rocblas_int       lda,
+                                           const float*      x,
+                                           rocblas_int       incx,
+                                           rocblas_stride    stride_x,
+                                           const float*      beta,
+                                           float*            y,
+                                           rocblas_int       incy,
+                                           rocblas_stride    stride_y);
+
+rocblas_status rocblas_dgemv_multi_fortran(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const double*     alpha,
+                                           const double*     A,
+                                           rocblas_int       lda,
+                                           const double*     x,
+                                           rocblas_int       incx,
+                                           rocblas_stride    stride_x,
+                                           const double*     beta,
+                                           double*           y,
+                                           rocblas_int       incy,
+                                           rocblas_stride    stride_y);
+
+rocblas_status rocblas_cgemv_multi_fortran(rocblas_handle               handle,
+                                           rocblas_operation            transA,
+                                           rocblas_int                  m,
+                                           rocblas_int                  n,
+                                           rocblas_int                  k,
+                                           const rocblas_float_complex* alpha,
+                                           const rocblas_float_complex* A,
+                                           rocblas_int                  lda,
+                                           const rocblas_float_complex* x,
+                                           rocblas_int                  incx,
+                                           rocblas_stride               stride_x,
+                                           const rocblas_float_complex* beta,
+                                           rocblas_float_complex*       y,
+                                           rocblas_int                  incy,
+                                           rocblas_stride               stride_y);
+
+rocblas_status rocblas_zgemv_multi_fortran(rocblas_handle                handle,
+                                           rocblas_operation             transA,
+                                           rocblas_int                   m,
+                                           rocblas_int                   n,
+                                           rocblas_int                   k,
+                                           const rocblas_double_complex* alpha,
+                                           const rocblas_double_complex* A,
+                                           rocblas_int                   lda,
+                                           const rocblas_double_complex* x,
+                                           rocblas_int                   incx,
+                                           rocblas_stride                stride_x,
+                                           const rocblas_double_complex* beta,
+                                           rocblas_double_complex*       y,
+                                           rocblas_int                   incy,
+                                           rocblas_stride                stride_y);
+
+// gemv_grouped
+rocblas_status rocblas_sgemv_grouped_fortran(rocblas_handle     handle,
+                                             rocblas_operation  transA,
+                                             const rocblas_int* m,
+                                             const rocblas_int* n,
+                                             const float*       alpha,
+                                             const float* const A[],
+                                             const rocblas_int* lda,
+                                             const float* const x[],
+                                             const rocblas_int* incx,
+                                             const float*       beta,
+                                             float* const       y[],
+                                             const rocblas_int* incy,
+                                             rocblas_int        group_count);
+
+rocblas_status rocblas_dgemv_grouped_fortran(rocblas_handle      handle,
+                                             rocblas_operation   transA,
+                                             const rocblas_int*  m,
+                                             const rocblas_int*  n,
+                                             const double*       alpha,
+                                             const double* const A[],
+                                             const rocblas_int*  lda,
+                                             const double* const x[],
+                                             const rocblas_int*  incx,
+                                             const double*       beta,
+                                             double* const       y[],
+                                             const rocblas_int*  incy,
+                                             rocblas_int         group_count);
+
+rocblas_status rocblas_cgemv_grouped_fortran(rocblas_handle                     handle,
+                                             rocblas_operation                  transA,
+                                             const rocblas_int*                 m,
+                                             const rocblas_int*                 n,
+                                             const rocblas_float_complex*       alpha,
+                                             const rocblas_float_complex* const A[],
+                                             const rocblas_int*                 lda,
+                                             const rocblas_float_complex* const x[],
+                                             const rocblas_int*                 incx,
+                                             const rocblas_float_complex*       beta,
+                                             rocblas_float_complex* const       y[],
+                                             const rocblas_int*                 incy,
+                                             rocblas_int                        group_count);
+
+rocblas_status rocblas_zgemv_grouped_fortran(rocblas_handle                      handle,
+                                             rocblas_operation                   transA,
+                                             const rocblas_int*                  m,
+                                             const rocblas_int*                  n,
+                                             const rocblas_double_complex*       alpha,
+                                             const rocblas_double_complex* const A[],
+                                             const rocblas_int*                  lda,
+                                             const rocblas_double_complex* const x[],
+                                             const rocblas_int*                  incx,
+                                             const rocblas_double_complex*       beta,
+                                             rocblas_double_complex* const       y[],
+                                             const rocblas_int*                  incy,
+                                             rocblas_int                         group_count);
+
+// ger_deferred, syr_deferred, her_deferred, syr2_deferred, her2_deferred
+rocblas_status rocblas_sger_deferred_fortran(rocblas_handle      handle,
+                                             rocblas_rank_update update,
+                                             rocblas_int         m,
+                                             rocblas_int         n,
+                                             const float*        alpha,
+                                             const float*        x,
+                                             rocblas_int         incx,
+                                             const float*        y,
+                                             rocblas_int         incy,
+                                             float*              A,
+                                             rocblas_int         lda);
+
+rocblas_status rocblas_dger_deferred_fortran(rocblas_handle      handle,
+                                             rocblas_rank_update update,
+                                             rocblas_int         m,
+                                             rocblas_int         n,
+                                             const double*       alpha,
+                                             const double*       x,
+                                             rocblas_int         incx,
+                                             const double*       y,
+                                             rocblas_int         incy,
+                                             double*             A,
+                                             rocblas_int         lda);
+
+rocblas_status rocblas_cgeru_deferred_fortran(rocblas_handle               handle,
+                                              rocblas_rank_update          update,
+                                              rocblas_int                  m,
+                                              rocblas_int                  n,
+                                              const rocblas_float_complex* alpha,
+                                              const rocblas_float_complex* x,
+                                              rocblas_int                  incx,
+                                              const rocblas_float_complex* y,
+                                              rocblas_int                  incy,
+                                              rocblas_float_complex*       A,
+                                              rocblas_int                  lda);
+
+rocblas_status rocblas_zgeru_deferred_fortran(rocblas_handle                handle,
+                                              rocblas_rank_update           update,
+                                              rocblas_int                   m,
+                                              rocblas_int                   n,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* x,
+                                              rocblas_int                   incx,
+                                              const rocblas_double_complex* y,
+                                              rocblas_int                   incy,
+                                              rocblas_double_complex*       A,
+                                              rocblas_int                   lda);
+
+rocblas_status rocblas_cgerc_deferred_fortran(rocblas_handle               handle,
+                                              rocblas_rank_update          update,
+                                              rocblas_int                  m,
+                                              rocblas_int                  n,
+                                              const rocblas_float_complex* alpha,
+                                              const rocblas_float_complex* x,
+                                              rocblas_int                  incx,
+                                              const rocblas_float_complex* y,
+                                              rocblas_int                  incy,
+                                              rocblas_float_complex*       A,
+                                              rocblas_int                  lda);
+
+rocblas_status rocblas_zgerc_deferred_fortran(rocblas_handle                handle,
+                                              rocblas_rank_update           update,
+                                              rocblas_int                   m,
+                                              rocblas_int                   n,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* x,
+                                              rocblas_int                   incx,
+                                              const rocblas_double_complex* y,
+                                              rocblas_int                   incy,
+                                              rocblas_double_complex*       A,
+                                              rocblas_int                   lda);
+
+rocblas_status rocblas_ssyr_deferred_fortran(rocblas_handle      handle,
+                                             rocblas_rank_update update,
+                                             rocblas_fill        uplo,
+                                             rocblas_int         n,
+                                             const float*        alpha,
+                                             const float*        x,
+                                             rocblas_int         incx,
+                                             float*              A,
+                                             rocblas_int         lda);
+
+rocblas_status rocblas_dsyr_deferred_fortran(rocblas_handle      handle,
+                                             rocblas_rank_update update,
+                                             rocblas_fill        uplo,
+                                             rocblas_int         n,
+                                             const double*       alpha,
+                                             const double*       x,
+                                             rocblas_int         incx,
+                                             double*             A,
+                                             rocblas_int         lda);
+
+rocblas_status rocblas_csyr_deferred_fortran(rocblas_handle               handle,
+                                             rocblas_rank_update          update,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  incx,
+                                             rocblas_float_complex*       A,
+                                             rocblas_int                  lda);
+
+rocblas_status rocblas_zsyr_deferred_fortran(rocblas_handle                handle,
+                                             rocblas_rank_update           update,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   incx,
+                                             rocblas_double_complex*       A,
+                                             rocblas_int                   lda);
+
+rocblas_status rocblas_cher_deferred_fortran(rocblas_handle               handle,
+                                             rocblas_rank_update          update,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             const float*                 alpha,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  incx,
+                                             rocblas_float_complex*       A,
+                                             rocblas_int                  lda);
+
+rocblas_status rocblas_zher_deferred_fortran(rocblas_handle                handle,
+                                             rocblas_rank_update           update,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             const double*                 alpha,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   incx,
+                                             rocblas_double_complex*       A,
+                                             rocblas_int                   lda);
+
+rocblas_status rocblas_ssyr2_deferred_fortran(rocblas_handle      handle,
+                                              rocblas_rank_update update,
+                                              rocblas_fill        uplo,
+                                              rocblas_int         n,
+                                              const float*        alpha,
+                                              const float*        x,
+                                              rocblas_int         incx,
+                                              const float*        y,
+                                              rocblas_int         incy,
+                                              float*              A,
+                                              rocblas_int         lda);
+
+rocblas_status rocblas_dsyr2_deferred_fortran(rocblas_handle      handle,
+                                              rocblas_rank_update update,
+                                              rocblas_fill        uplo,
+                                              rocblas_int         n,
+                                              const double*       alpha,
+                                              const double*       x,
+                                              rocblas_int         incx,
+                                              const double*       y,
+                                              rocblas_int         incy,
+                                              double*             A,
+                                              rocblas_int         lda);
+
+rocblas_status rocblas_csyr2_deferred_fortran(rocblas_handle               handle,
+                                              rocblas_rank_update          update,
+                                              rocblas_fill                 uplo,
+                                              rocblas_int                  n,
+                                              const rocblas_float_complex* alpha,
+                                              const rocblas_float_complex* x,
+                                              rocblas_int                  incx,
+                                              const rocblas_float_complex* y,
+                                              rocblas_int                  incy,
+                                              rocblas_float_complex*       A,
+                                              rocblas_int                  lda);
+
+rocblas_status rocblas_zsyr2_deferred_fortran(rocblas_handle                handle,
+                                              rocblas_rank_update           update,
+                                              rocblas_fill                  uplo,
+                                              rocblas_int                   n,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* x,
+                                              rocblas_int                   incx,
+                                              const rocblas_double_complex* y,
+                                              rocblas_int                   incy,
+                                              rocblas_double_complex*       A,
+                                              rocblas_int                   lda);
+
+rocblas_status rocblas_cher2_deferred_fortran(rocblas_handle               handle,
+                                              rocblas_rank_update          update,
+                                              rocblas_fill                 uplo,
+                                              rocblas_int                  n,
+                                              const rocblas_float_complex* alpha,
+                                              const rocblas_float_complex* x,
+                                              rocblas_int                  incx,
+                                              const rocblas_float_complex* y,
+                                              rocblas_int                  incy,
+                                              rocblas_float_complex*       A,
+                                              rocblas_int                  lda);
+
+rocblas_status rocblas_zher2_deferred_fortran(rocblas_handle                handle,
+                                              rocblas_rank_update           update,
+                                              rocblas_fill                  uplo,
+                                              rocblas_int                   n,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* x,
+                                              rocblas_int                   incx,
+                                              const rocblas_double_complex* y,
+                                              rocblas_int                   incy,
+                                              rocblas_double_complex*       A,
+                                              rocblas_int                   lda);
+
 // hbmv
 rocblas_status rocblas_chbmv_fortran(rocblas_handle               handle,
                                      rocblas_fill                 uplo,
@@ -5501,6 +6237,209 @@ rocblas_status rocblas_ztrmm_strided_batched_fortran(rocblas_handle
                                                      rocblas_stride                stride_c,
                                                      rocblas_int                   batch_count);
 
+// trmm_outofplace
+rocblas_status rocblas_strmm_outofplace_fortran(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transA,
+                                                rocblas_diagonal  diag,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                const float*      alpha,
+                                                const float*      A,
+                                                rocblas_int       lda,
+                                                const float*      B,
+                                                rocblas_int       ldb,
+                                                float*            C,
+                                                rocblas_int       ldc);
+
+rocblas_status rocblas_dtrmm_outofplace_fortran(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transA,
+                                                rocblas_diagonal  diag,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                const double*     alpha,
+                                                const double*     A,
+                                                rocblas_int       lda,
+                                                const double*     B,
+                                                rocblas_int       ldb,
+                                                double*           C,
+                                                rocblas_int       ldc);
+
+rocblas_status rocblas_ctrmm_outofplace_fortran(rocblas_handle               handle,
+                                                rocblas_side                 side,
+                                                rocblas_fill                 uplo,
+                                                rocblas_operation            transA,
+                                                rocblas_diagonal             diag,
+                                                rocblas_int                  m,
+                                                rocblas_int                  n,
+                                                const rocblas_float_complex* alpha,
+                                                const rocblas_float_complex* A,
+                                                rocblas_int                  lda,
+                                                const rocblas_float_complex* B,
+                                                rocblas_int                  ldb,
+                                                rocblas_float_complex*       C,
+                                                rocblas_int                  ldc);
+
+rocblas_status rocblas_ztrmm_outofplace_fortran(rocblas_handle                handle,
+                                                rocblas_side                  side,
+                                                rocblas_fill                  uplo,
+                                                rocblas_operation             transA,
+                                                rocblas_diagonal              diag,
+                                                rocblas_int                   m,
+                                                rocblas_int                   n,
+                                                const rocblas_double_complex* alpha,
+                                                const rocblas_double_complex* A,
+                                                rocblas_int                   lda,
+                                                const rocblas_double_complex* B,
+                                                rocblas_int                   ldb,
+                                                rocblas_double_complex*       C,
+                                                rocblas_int                   ldc);
+
+// trmm_outofplace_batched
+rocblas_status rocblas_strmm_outofplace_batched_fortran(rocblas_handle     handle,
+                                                        rocblas_side       side,
+                                                        rocblas_fill       uplo,
+                                                        rocblas_operation  transA,
+                                                        rocblas_diagonal   diag,
+                                                        rocblas_int        m,
+                                                        rocblas_int        n,
+                                                        const float*       alpha,
+                                                        const float* const A[],
+                                                        rocblas_int        lda,
+                                                        const float* const B[],
+                                                        rocblas_int        ldb,
+                                                        float* const       C[],
+                                                        rocblas_int        ldc,
+                                                        rocblas_int        batch_count);
+
+rocblas_status rocblas_dtrmm_outofplace_batched_fortran(rocblas_handle      handle,
+                                                        rocblas_side        side,
+                                                        rocblas_fill        uplo,
+                                                        rocblas_operation   transA,
+                                                        rocblas_diagonal    diag,
+                                                        rocblas_int         m,
+                                                        rocblas_int         n,
+                                                        const double*       alpha,
+                                                        const double* const A[],
+                                                        rocblas_int         lda,
+                                                        const double* const B[],
+                                                        rocblas_int         ldb,
+                                                        double* const       C[],
+                                                        rocblas_int         ldc,
+                                                        rocblas_int         batch_count);
+
+rocblas_status rocblas_ctrmm_outofplace_batched_fortran(rocblas_handle                     handle,
+                                                        rocblas_side                       side,
+                                                        rocblas_fill                       uplo,
+                                                        rocblas_operation                  transA,
+                                                        rocblas_diagonal                   diag,
+                                                        rocblas_int                        m,
+                                                        rocblas_int                        n,
+                                                        const rocblas_float_complex*       alpha,
+                                                        const rocblas_float_complex* const A[],
+                                                        rocblas_int                        lda,
+                                                        const rocblas_float_complex* const B[],
+                                                        rocblas_int                        ldb,
+                                                        rocblas_float_complex* const       C[],
+                                                        rocblas_int                        ldc,
+                                                        rocblas_int batch_count);
+
+rocblas_status rocblas_ztrmm_outofplace_batched_fortran(rocblas_handle                      handle,
+                                                        rocblas_side                        side,
+                                                        rocblas_fill                        uplo,
+                                                        rocblas_operation                   transA,
+                                                        rocblas_diagonal                    diag,
+                                                        rocblas_int                         m,
+                                                        rocblas_int                         n,
+                                                        const rocblas_double_complex*       alpha,
+                                                        const rocblas_double_complex* const A[],
+                                                        rocblas_int                         lda,
+                                                        const rocblas_double_complex* const B[],
+                                                        rocblas_int                         ldb,
+                                                        rocblas_double_complex* const       C[],
+                                                        rocblas_int                         ldc,
+                                                        rocblas_int batch_count);
+
+// trmm_outofplace_strided_batched
+rocblas_status rocblas_strmm_outofplace_strided_batched_fortran(rocblas_handle    handle,
+                                                                rocblas_side      side,
+                                                                rocblas_fill      uplo,
+                                                                rocblas_operation transA,
+                                                                rocblas_diagonal  diag,
+                                                                rocblas_int       m,
+                                                                rocblas_int       n,
+                                                                const float*      alpha,
+                                                                const float*      A,
+                                                                rocblas_int       lda,
+                                                                rocblas_stride    stride_A,
+                                                                const float*      B,
+                                                                rocblas_int       ldb,
+                                                                rocblas_stride    stride_B,
+                                                                float*            C,
+                                                                rocblas_int       ldc,
+                                                                rocblas_stride    stride_C,
+                                                                rocblas_int       batch_count);
+
+rocblas_status rocblas_dtrmm_outofplace_strided_batched_fortran(rocblas_handle    handle,
+                                                                rocblas_side      side,
+                                                                rocblas_fill      uplo,
+                                                                rocblas_operation transA,
+                                                                rocblas_diagonal  diag,
+                                                                rocblas_int       m,
+                                                                rocblas_int       n,
+                                                                const double*     alpha,
+                                                                const double*     A,
+                                                                rocblas_int       lda,
+                                                                rocblas_stride    stride_A,
+                                                                const double*     B,
+                                                                rocblas_int       ldb,
+                                                                rocblas_stride    stride_B,
+                                                                double*           C,
+                                                                rocblas_int       ldc,
+                                                                rocblas_stride    stride_C,
+                                                                rocblas_int       batch_count);
+
+rocblas_status rocblas_ctrmm_outofplace_strided_batched_fortran(rocblas_handle               handle,
+                                                                rocblas_side                 side,
+                                                                rocblas_fill                 uplo,
+                                                                rocblas_operation            transA,
+                                                                rocblas_diagonal             diag,
+                                                                rocblas_int                  m,
+                                                                rocblas_int                  n,
+                                                                const rocblas_float_complex* alpha,
+                                                                const rocblas_float_complex* A,
+                                                                rocblas_int                  lda,
+                                                                rocblas_stride stride_A,
+                                                                const rocblas_float_complex* B,
+                                                                rocblas_int                  ldb,
+                                                                rocblas_stride stride_B,
+                                                                rocblas_float_complex*       C,
+                                                                rocblas_int                  ldc,
+                                                                rocblas_stride stride_C,
+                                                                rocblas_int batch_count);
+
+rocblas_status rocblas_ztrmm_outofplace_strided_batched_fortran(rocblas_handle handle,
+                                                                rocblas_side                  side,
+                                                                rocblas_fill                  uplo,
+                                                                rocblas_operation transA,
+                                                                rocblas_diagonal              diag,
+                                                                rocblas_int                   m,
+                                                                rocblas_int                   n,
+                                                                const rocblas_double_complex* alpha,
+                                                                const rocblas_double_complex* A,
+                                                                rocblas_int                   lda,
+                                                                rocblas_stride stride_A,
+                                                                const rocblas_double_complex* B,
+                                                                rocblas_int                   ldb,
+                                                                rocblas_stride stride_B,
+                                                                rocblas_double_complex*       C,
+                                                                rocblas_int                   ldc,
+                                                                rocblas_stride stride_C,
+                                                                rocblas_int batch_count);
+
 // trtri
 rocblas_status rocblas_strtri_fortran(rocblas_handle   handle,
                                       rocblas_fill     uplo,
@@ -6056,6 +6995,75 @@ rocblas_status rocblas_zgemm_strided_batched_fortran(rocblas_handle
                                                      rocblas_stride                stride_c,
                                                      rocblas_int                   batch_count);
 
+// gemm_grouped
+rocblas_status rocblas_sgemm_grouped_fortran(rocblas_handle       handle,
+                                             rocblas_pointer_mode array_mode,
+                                             rocblas_operation    transA,
+                                             rocblas_operation    transB,
+                                             const rocblas_int*   m,
+                                             const rocblas_int*   n,
+                                             const rocblas_int*   k,
+                                             const float*         alpha,
+                                             const float* const   A[],
+                                             const rocblas_int*   lda,
+                                             const float* const   B[],
+                                             const rocblas_int*   ldb,
+                                             const float*         beta,
+                                             float* const         C[],
+                                             const rocblas_int*   ldc,
+                                             rocblas_int          group_count);
+
+rocblas_status rocblas_dgemm_grouped_fortran(rocblas_handle       handle,
+                                             rocblas_pointer_mode array_mode,
+                                             rocblas_operation    transA,
+                                             rocblas_operation    transB,
+                                             const rocblas_int*   m,
+                                             const rocblas_int*   n,
+                                             const rocblas_int*   k,
+                                             const double*        alpha,
+                                             const double* const  A[],
+                                             const rocblas_int*   lda,
+                                             const double* const  B[],
+                                             const rocblas_int*   ldb,
+                                             const double*        beta,
+                                             double* const        C[],
+                                             const rocblas_int*   ldc,
+                                             rocblas_int          group_count);
+
+rocblas_status rocblas_cgemm_grouped_fortran(rocblas_handle                     handle,
+                                             rocblas_pointer_mode               array_mode,
+                                             rocblas_operation                  transA,
+                                             rocblas_operation                  transB,
+                                             const rocblas_int*                 m,
+                                             const rocblas_int*                 n,
+                                             const rocblas_int*                 k,
+                                             const rocblas_float_complex*       alpha,
+                                             const rocblas_float_complex* const A[],
+                                             const rocblas_int*                 lda,
+                                             const rocblas_float_complex* const B[],
+                                             const rocblas_int*                 ldb,
+                                             const rocblas_float_complex*       beta,
+                                             rocblas_float_complex* const       C[],
+                                             const rocblas_int*                 ldc,
+                                             rocblas_int                        group_count);
+
+rocblas_status rocblas_zgemm_grouped_fortran(rocblas_handle                      handle,
+                                             rocblas_pointer_mode                array_mode,
+                                             rocblas_operation                   transA,
+                                             rocblas_operation                   transB,
+                                             const rocblas_int*                  m,
+                                             const rocblas_int*                  n,
+                                             const rocblas_int*                  k,
+                                             const rocblas_double_complex*       alpha,
+                                             const rocblas_double_complex* const A[],
+                                             const rocblas_int*                  lda,
+                                             const rocblas_double_complex* const B[],
+                                             const rocblas_int*                  ldb,
+                                             const rocblas_double_complex*       beta,
+                                             rocblas_double_complex* const       C[],
+                                             const rocblas_int*                  ldc,
+                                             rocblas_int                         group_count);
+
 // dgmm
 rocblas_status rocblas_sdgmm_fortran(rocblas_handle handle,
                                      rocblas_side   side,
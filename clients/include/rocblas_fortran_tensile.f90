@@ -1086,752 +1086,783 @@ module rocblas_interface_tensile
             A, lda, stride_A, B, ldb, stride_B, batch_count)
     end function rocblas_ztrmm_strided_batched_fortran
 
-    ! trtri
-    function rocblas_strtri_fortran(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA) &
+    ! trmm_outofplace
+    function rocblas_strmm_outofplace_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc) &
             result(res) &
-            bind(c, name = 'rocblas_strtri_fortran')
+            bind(c, name = 'rocblas_strmm_outofplace_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
         integer(c_int) :: res
-        res = rocblas_strtri(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA)
-    end function rocblas_strtri_fortran
+        res = rocblas_strmm_outofplace(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc)
+    end function rocblas_strmm_outofplace_fortran
 
-    function rocblas_dtrtri_fortran(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA) &
+    function rocblas_dtrmm_outofplace_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc) &
             result(res) &
-            bind(c, name = 'rocblas_dtrtri_fortran')
+            bind(c, name = 'rocblas_dtrmm_outofplace_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
         integer(c_int) :: res
-        res = rocblas_dtrtri(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA)
-    end function rocblas_dtrtri_fortran
+        res = rocblas_dtrmm_outofplace(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc)
+    end function rocblas_dtrmm_outofplace_fortran
 
-    function rocblas_ctrtri_fortran(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA) &
+    function rocblas_ctrmm_outofplace_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc) &
             result(res) &
-            bind(c, name = 'rocblas_ctrtri_fortran')
+            bind(c, name = 'rocblas_ctrmm_outofplace_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
         integer(c_int) :: res
-        res = rocblas_ctrtri(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA)
-    end function rocblas_ctrtri_fortran
+        res = rocblas_ctrmm_outofplace(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc)
+    end function rocblas_ctrmm_outofplace_fortran
 
-    function rocblas_ztrtri_fortran(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA) &
+    function rocblas_ztrmm_outofplace_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc) &
             result(res) &
-            bind(c, name = 'rocblas_ztrtri_fortran')
+            bind(c, name = 'rocblas_ztrmm_outofplace_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
         integer(c_int) :: res
-        res = rocblas_ztrtri(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA)
-    end function rocblas_ztrtri_fortran
+        res = rocblas_ztrmm_outofplace(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc)
+    end function rocblas_ztrmm_outofplace_fortran
 
-    ! trtri_batched
-    function rocblas_strtri_batched_fortran(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA, batch_count) &
+    ! trmm_outofplace_batched
+    function rocblas_strmm_outofplace_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_strtri_batched_fortran')
+            bind(c, name = 'rocblas_strmm_outofplace_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_strtri_batched(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA, batch_count)
-    end function rocblas_strtri_batched_fortran
+        res = rocblas_strmm_outofplace_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc, batch_count)
+    end function rocblas_strmm_outofplace_batched_fortran
 
-    function rocblas_dtrtri_batched_fortran(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA, batch_count) &
+    function rocblas_dtrmm_outofplace_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_dtrtri_batched_fortran')
+            bind(c, name = 'rocblas_dtrmm_outofplace_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_dtrtri_batched(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA, batch_count)
-    end function rocblas_dtrtri_batched_fortran
+        res = rocblas_dtrmm_outofplace_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc, batch_count)
+    end function rocblas_dtrmm_outofplace_batched_fortran
 
-    function rocblas_ctrtri_batched_fortran(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA, batch_count) &
+    function rocblas_ctrmm_outofplace_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_ctrtri_batched_fortran')
+            bind(c, name = 'rocblas_ctrmm_outofplace_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_ctrtri_batched(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA, batch_count)
-    end function rocblas_ctrtri_batched_fortran
+        res = rocblas_ctrmm_outofplace_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc, batch_count)
+    end function rocblas_ctrmm_outofplace_batched_fortran
 
-    function rocblas_ztrtri_batched_fortran(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA, batch_count) &
+    function rocblas_ztrmm_outofplace_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_ztrtri_batched_fortran')
+            bind(c, name = 'rocblas_ztrmm_outofplace_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_ztrtri_batched(handle, uplo, diag, n, &
-            A, lda, invA, ldinvA, batch_count)
-    end function rocblas_ztrtri_batched_fortran
+        res = rocblas_ztrmm_outofplace_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, C, ldc, batch_count)
+    end function rocblas_ztrmm_outofplace_batched_fortran
 
-    ! trtri_strided_batched
-    function rocblas_strtri_strided_batched_fortran(handle, uplo, diag, n, &
-            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
+    ! trmm_outofplace_strided_batched
+    function rocblas_strmm_outofplace_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_strtri_strided_batched_fortran')
+            bind(c, name = 'rocblas_strmm_outofplace_strided_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         integer(c_int64_t), value :: stride_A
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
-        integer(c_int64_t), value :: stride_invA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int64_t), value :: stride_B
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int64_t), value :: stride_C
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_strtri_strided_batched(handle, uplo, diag, n, &
-            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count)
-    end function rocblas_strtri_strided_batched_fortran
+        res = rocblas_strmm_outofplace_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count)
+    end function rocblas_strmm_outofplace_strided_batched_fortran
 
-    function rocblas_dtrtri_strided_batched_fortran(handle, uplo, diag, n, &
-            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
+    function rocblas_dtrmm_outofplace_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_dtrtri_strided_batched_fortran')
+            bind(c, name = 'rocblas_dtrmm_outofplace_strided_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         integer(c_int64_t), value :: stride_A
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
-        integer(c_int64_t), value :: stride_invA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int64_t), value :: stride_B
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int64_t), value :: stride_C
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_dtrtri_strided_batched(handle, uplo, diag, n, &
-            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count)
-    end function rocblas_dtrtri_strided_batched_fortran
+        res = rocblas_dtrmm_outofplace_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count)
+    end function rocblas_dtrmm_outofplace_strided_batched_fortran
 
-    function rocblas_ctrtri_strided_batched_fortran(handle, uplo, diag, n, &
-            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
+    function rocblas_ctrmm_outofplace_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_ctrtri_strided_batched_fortran')
+            bind(c, name = 'rocblas_ctrmm_outofplace_strided_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         integer(c_int64_t), value :: stride_A
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
-        integer(c_int64_t), value :: stride_invA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int64_t), value :: stride_B
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int64_t), value :: stride_C
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_ctrtri_strided_batched(handle, uplo, diag, n, &
-            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count)
-    end function rocblas_ctrtri_strided_batched_fortran
+        res = rocblas_ctrmm_outofplace_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count)
+    end function rocblas_ctrmm_outofplace_strided_batched_fortran
 
-    function rocblas_ztrtri_strided_batched_fortran(handle, uplo, diag, n, &
-            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
+    function rocblas_ztrmm_outofplace_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_ztrtri_strided_batched_fortran')
+            bind(c, name = 'rocblas_ztrmm_outofplace_strided_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         integer(c_int64_t), value :: stride_A
-        type(c_ptr), value :: invA
-        integer(c_int), value :: ldinvA
-        integer(c_int64_t), value :: stride_invA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int64_t), value :: stride_B
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int64_t), value :: stride_C
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_ztrtri_strided_batched(handle, uplo, diag, n, &
-            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count)
-    end function rocblas_ztrtri_strided_batched_fortran
+        res = rocblas_ztrmm_outofplace_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count)
+    end function rocblas_ztrmm_outofplace_strided_batched_fortran
 
-    ! trsm
-    function rocblas_strsm_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb) &
+    ! trtri
+    function rocblas_strtri_fortran(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA) &
             result(res) &
-            bind(c, name = 'rocblas_strsm_fortran')
+            bind(c, name = 'rocblas_strtri_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
         integer(c_int) :: res
-        res = rocblas_strsm(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb)
-    end function rocblas_strsm_fortran
+        res = rocblas_strtri(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA)
+    end function rocblas_strtri_fortran
 
-    function rocblas_dtrsm_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb) &
+    function rocblas_dtrtri_fortran(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA) &
             result(res) &
-            bind(c, name = 'rocblas_dtrsm_fortran')
+            bind(c, name = 'rocblas_dtrtri_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
         integer(c_int) :: res
-        res = rocblas_dtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb)
-    end function rocblas_dtrsm_fortran
+        res = rocblas_dtrtri(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA)
+    end function rocblas_dtrtri_fortran
 
-    function rocblas_ctrsm_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb) &
+    function rocblas_ctrtri_fortran(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA) &
             result(res) &
-            bind(c, name = 'rocblas_ctrsm_fortran')
+            bind(c, name = 'rocblas_ctrtri_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
         integer(c_int) :: res
-        res = rocblas_ctrsm(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb)
-    end function rocblas_ctrsm_fortran
+        res = rocblas_ctrtri(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA)
+    end function rocblas_ctrtri_fortran
 
-    function rocblas_ztrsm_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb) &
+    function rocblas_ztrtri_fortran(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA) &
             result(res) &
-            bind(c, name = 'rocblas_ztrsm_fortran')
+            bind(c, name = 'rocblas_ztrtri_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
         integer(c_int) :: res
-        res = rocblas_ztrsm(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb)
-    end function rocblas_ztrsm_fortran
+        res = rocblas_ztrtri(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA)
+    end function rocblas_ztrtri_fortran
 
-    ! trsm_batched
-    function rocblas_strsm_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb, batch_count) &
+    ! trtri_batched
+    function rocblas_strtri_batched_fortran(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_strsm_batched_fortran')
+            bind(c, name = 'rocblas_strtri_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_strsm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb, batch_count)
-    end function rocblas_strsm_batched_fortran
+        res = rocblas_strtri_batched(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA, batch_count)
+    end function rocblas_strtri_batched_fortran
 
-    function rocblas_dtrsm_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb, batch_count) &
+    function rocblas_dtrtri_batched_fortran(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_dtrsm_batched_fortran')
+            bind(c, name = 'rocblas_dtrtri_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_dtrsm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb, batch_count)
-    end function rocblas_dtrsm_batched_fortran
+        res = rocblas_dtrtri_batched(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA, batch_count)
+    end function rocblas_dtrtri_batched_fortran
 
-    function rocblas_ctrsm_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb, batch_count) &
+    function rocblas_ctrtri_batched_fortran(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_ctrsm_batched_fortran')
+            bind(c, name = 'rocblas_ctrtri_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_ctrsm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb, batch_count)
-    end function rocblas_ctrsm_batched_fortran
+        res = rocblas_ctrtri_batched(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA, batch_count)
+    end function rocblas_ctrtri_batched_fortran
 
-    function rocblas_ztrsm_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb, batch_count) &
+    function rocblas_ztrtri_batched_fortran(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_ztrsm_batched_fortran')
+            bind(c, name = 'rocblas_ztrtri_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_ztrsm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb, batch_count)
-    end function rocblas_ztrsm_batched_fortran
+        res = rocblas_ztrtri_batched(handle, uplo, diag, n, &
+            A, lda, invA, ldinvA, batch_count)
+    end function rocblas_ztrtri_batched_fortran
 
-    ! trsm_strided_batched
-    function rocblas_strsm_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+    ! trtri_strided_batched
+    function rocblas_strtri_strided_batched_fortran(handle, uplo, diag, n, &
+            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_strsm_strided_batched_fortran')
+            bind(c, name = 'rocblas_strtri_strided_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         integer(c_int64_t), value :: stride_A
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        integer(c_int64_t), value :: stride_B
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
+        integer(c_int64_t), value :: stride_invA
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_strsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, stride_A, B, ldb, stride_B, batch_count)
-    end function rocblas_strsm_strided_batched_fortran
+        res = rocblas_strtri_strided_batched(handle, uplo, diag, n, &
+            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count)
+    end function rocblas_strtri_strided_batched_fortran
 
-    function rocblas_dtrsm_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+    function rocblas_dtrtri_strided_batched_fortran(handle, uplo, diag, n, &
+            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_dtrsm_strided_batched_fortran')
+            bind(c, name = 'rocblas_dtrtri_strided_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         integer(c_int64_t), value :: stride_A
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        integer(c_int64_t), value :: stride_B
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
+        integer(c_int64_t), value :: stride_invA
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_dtrsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, stride_A, B, ldb, stride_B, batch_count)
-    end function rocblas_dtrsm_strided_batched_fortran
+        res = rocblas_dtrtri_strided_batched(handle, uplo, diag, n, &
+            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count)
+    end function rocblas_dtrtri_strided_batched_fortran
 
-    function rocblas_ctrsm_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+    function rocblas_ctrtri_strided_batched_fortran(handle, uplo, diag, n, &
+            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_ctrsm_strided_batched_fortran')
+            bind(c, name = 'rocblas_ctrtri_strided_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         integer(c_int64_t), value :: stride_A
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        integer(c_int64_t), value :: stride_B
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
+        integer(c_int64_t), value :: stride_invA
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_ctrsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, stride_A, B, ldb, stride_B, batch_count)
-    end function rocblas_ctrsm_strided_batched_fortran
+        res = rocblas_ctrtri_strided_batched(handle, uplo, diag, n, &
+            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count)
+    end function rocblas_ctrtri_strided_batched_fortran
 
-    function rocblas_ztrsm_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+    function rocblas_ztrtri_strided_batched_fortran(handle, uplo, diag, n, &
+            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_ztrsm_strided_batched_fortran')
+            bind(c, name = 'rocblas_ztrtri_strided_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(rocblas_side_left)), value :: side
         integer(kind(rocblas_fill_full)), value :: uplo
-        integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
-        integer(c_int), value :: m
         integer(c_int), value :: n
-        type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         integer(c_int64_t), value :: stride_A
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
-        integer(c_int64_t), value :: stride_B
+        type(c_ptr), value :: invA
+        integer(c_int), value :: ldinvA
+        integer(c_int64_t), value :: stride_invA
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_ztrsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, stride_A, B, ldb, stride_B, batch_count)
-    end function rocblas_ztrsm_strided_batched_fortran
-
-    !-----------------!
-    ! blas Extensions !
-    !-----------------!
+        res = rocblas_ztrtri_strided_batched(handle, uplo, diag, n, &
+            A, lda, stride_A, invA, ldinvA, stride_invA, batch_count)
+    end function rocblas_ztrtri_strided_batched_fortran
 
-    ! gemm_ex
-    function rocblas_gemm_ex_fortran(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
-            b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
-            compute_type, algo, solution_index, flags) &
+    ! trsm
+    function rocblas_strsm_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb) &
             result(res) &
-            bind(c, name = 'rocblas_gemm_ex_fortran')
+            bind(c, name = 'rocblas_strsm_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_full)), value :: uplo
         integer(kind(rocblas_operation_none)), value :: transA
-        integer(kind(rocblas_operation_none)), value :: transB
+        integer(kind(rocblas_diagonal_unit)), value :: diag
         integer(c_int), value :: m
         integer(c_int), value :: n
-        integer(c_int), value :: k
         type(c_ptr), value :: alpha
-        type(c_ptr), value :: a
-        integer(kind(rocblas_datatype_f16_r)), value :: a_type
+        type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: b
-        integer(kind(rocblas_datatype_f16_r)), value :: b_type
+        type(c_ptr), value :: B
         integer(c_int), value :: ldb
-        type(c_ptr), value :: beta
-        type(c_ptr), value :: c
-        integer(kind(rocblas_datatype_f16_r)), value :: c_type
-        integer(c_int), value :: ldc
-        type(c_ptr), value :: d
-        integer(kind(rocblas_datatype_f16_r)), value :: d_type
-        integer(c_int), value :: ldd
-        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
-        integer(kind(rocblas_gemm_algo_standard)), value :: algo
-        integer(c_int32_t), value :: solution_index
-        ! No unsigned types in fortran. If larger values are needed
-        ! we will need a workaround.
-        integer(c_int32_t), value :: flags
         integer(c_int) :: res
-        res = rocblas_gemm_ex(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
-            b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
-            compute_type, algo, solution_index, flags)
-    end function rocblas_gemm_ex_fortran
+        res = rocblas_strsm(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb)
+    end function rocblas_strsm_fortran
 
-    function rocblas_gemm_batched_ex_fortran(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
-            b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
-            batch_count, compute_type, algo, solution_index, flags) &
+    function rocblas_dtrsm_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb) &
             result(res) &
-            bind(c, name = 'rocblas_gemm_batched_ex_fortran')
+            bind(c, name = 'rocblas_dtrsm_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_full)), value :: uplo
         integer(kind(rocblas_operation_none)), value :: transA
-        integer(kind(rocblas_operation_none)), value :: transB
+        integer(kind(rocblas_diagonal_unit)), value :: diag
         integer(c_int), value :: m
         integer(c_int), value :: n
-        integer(c_int), value :: k
         type(c_ptr), value :: alpha
-        type(c_ptr), value :: a
-        integer(kind(rocblas_datatype_f16_r)), value :: a_type
+        type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: b
-        integer(kind(rocblas_datatype_f16_r)), value :: b_type
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int) :: res
+        res = rocblas_dtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb)
+    end function rocblas_dtrsm_fortran
+
+    function rocblas_ctrsm_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb) &
+            result(res) &
+            bind(c, name = 'rocblas_ctrsm_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int) :: res
+        res = rocblas_ctrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb)
+    end function rocblas_ctrsm_fortran
+
+    function rocblas_ztrsm_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb) &
+            result(res) &
+            bind(c, name = 'rocblas_ztrsm_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int) :: res
+        res = rocblas_ztrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb)
+    end function rocblas_ztrsm_fortran
+
+    ! trsm_batched
+    function rocblas_strsm_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, batch_count) &
+            result(res) &
+            bind(c, name = 'rocblas_strsm_batched_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
         integer(c_int), value :: ldb
-        type(c_ptr), value :: beta
-        type(c_ptr), value :: c
-        integer(kind(rocblas_datatype_f16_r)), value :: c_type
-        integer(c_int), value :: ldc
-        type(c_ptr), value :: d
-        integer(kind(rocblas_datatype_f16_r)), value :: d_type
-        integer(c_int), value :: ldd
         integer(c_int), value :: batch_count
-        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
-        integer(kind(rocblas_gemm_algo_standard)), value :: algo
-        integer(c_int32_t), value :: solution_index
-        ! No unsigned types in fortran. If larger values are needed
-        ! we will need a workaround.
-        integer(c_int32_t), value :: flags
         integer(c_int) :: res
-        res = rocblas_gemm_batched_ex(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
-            b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
-            batch_count, compute_type, algo, solution_index, flags)
-    end function rocblas_gemm_batched_ex_fortran
+        res = rocblas_strsm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, batch_count)
+    end function rocblas_strsm_batched_fortran
 
-    function rocblas_gemm_strided_batched_ex_fortran(handle, transA, transB, m, n, k, alpha, a, a_type, lda, stride_a, &
-            b, b_type, ldb, stride_b, beta, c, c_type, ldc, stride_c, d, d_type, ldd, stride_d, &
-            batch_count, compute_type, algo, solution_index, flags) &
+    function rocblas_dtrsm_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_gemm_strided_batched_ex_fortran')
+            bind(c, name = 'rocblas_dtrsm_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_full)), value :: uplo
         integer(kind(rocblas_operation_none)), value :: transA
-        integer(kind(rocblas_operation_none)), value :: transB
+        integer(kind(rocblas_diagonal_unit)), value :: diag
         integer(c_int), value :: m
         integer(c_int), value :: n
-        integer(c_int), value :: k
         type(c_ptr), value :: alpha
-        type(c_ptr), value :: a
-        integer(kind(rocblas_datatype_f16_r)), value :: a_type
+        type(c_ptr), value :: A
         integer(c_int), value :: lda
-        integer(c_int64_t), value :: stride_a
-        type(c_ptr), value :: b
-        integer(kind(rocblas_datatype_f16_r)), value :: b_type
+        type(c_ptr), value :: B
         integer(c_int), value :: ldb
-        integer(c_int64_t), value :: stride_b
-        type(c_ptr), value :: beta
-        type(c_ptr), value :: c
-        integer(kind(rocblas_datatype_f16_r)), value :: c_type
-        integer(c_int), value :: ldc
-        integer(c_int64_t), value :: stride_c
-        type(c_ptr), value :: d
-        integer(kind(rocblas_datatype_f16_r)), value :: d_type
-        integer(c_int), value :: ldd
-        integer(c_int64_t), value :: stride_d
         integer(c_int), value :: batch_count
-        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
-        integer(kind(rocblas_gemm_algo_standard)), value :: algo
-        integer(c_int32_t), value :: solution_index
-        ! No unsigned types in fortran. If larger values are needed
-        ! we will need a workaround.
-        integer(c_int32_t), value :: flags
         integer(c_int) :: res
-        res = rocblas_gemm_strided_batched_ex(handle, transA, transB, m, n, k, alpha, a, a_type, lda, stride_a, &
-            b, b_type, ldb, stride_b, beta, c, c_type, ldc, stride_c, d, d_type, ldd, stride_d, &
-            batch_count, compute_type, algo, solution_index, flags)
-    end function rocblas_gemm_strided_batched_ex_fortran
+        res = rocblas_dtrsm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, batch_count)
+    end function rocblas_dtrsm_batched_fortran
 
-    function rocblas_gemm_ext2_fortran(handle, m, n, k, alpha, a, a_type, row_stride_a, col_stride_a, &
-         b, b_type, row_stride_b, col_stride_b, beta, c, c_type, row_stride_c, col_stride_c, &
-         d, d_type, row_stride_d, col_stride_d, compute_type, algo, solution_index, flags) &
+    function rocblas_ctrsm_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_gemm_ext2_fortran')
+            bind(c, name = 'rocblas_ctrsm_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_diagonal_unit)), value :: diag
         integer(c_int), value :: m
         integer(c_int), value :: n
-        integer(c_int), value :: k
         type(c_ptr), value :: alpha
-        type(c_ptr), value :: a
-        integer(kind(rocblas_datatype_f16_r)), value :: a_type
-        integer(c_int64_t), value :: row_stride_a, col_stride_a
-        type(c_ptr), value :: b
-        integer(kind(rocblas_datatype_f16_r)), value :: b_type
-        integer(c_int64_t), value :: row_stride_b, col_stride_b
-        type(c_ptr), value :: beta
-        type(c_ptr), value :: c
-        integer(kind(rocblas_datatype_f16_r)), value :: c_type
-        integer(c_int64_t), value :: row_stride_c, col_stride_c
-        type(c_ptr), value :: d
-        integer(kind(rocblas_datatype_f16_r)), value :: d_type
-        integer(c_int64_t), value :: row_stride_d, col_stride_d
-        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
-        integer(kind(rocblas_gemm_algo_standard)), value :: algo
-        integer(c_int32_t), value :: solution_index
-        ! No unsigned types in fortran. If larger values are needed
-        ! we will need a workaround.
-        integer(c_int32_t), value :: flags
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_gemm_ext2(handle, m, n, k, alpha, a, a_type, row_stride_a, col_stride_a, &
-             b, b_type, row_stride_b, col_stride_b, beta, c, c_type, row_stride_c, col_stride_c, &
-             d, d_type, row_stride_d, col_stride_d, compute_type, algo, solution_index, flags)
-    end function rocblas_gemm_ext2_fortran
+        res = rocblas_ctrsm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, batch_count)
+    end function rocblas_ctrsm_batched_fortran
 
-    ! trsm_ex
-    function rocblas_trsm_ex_fortran(handle, side, uplo, transA, diag, m, n, alpha, A, lda, &
-            B, ldb, invA, invA_size, compute_type) &
+    function rocblas_ztrsm_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_trsm_ex_fortran')
+            bind(c, name = 'rocblas_ztrsm_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(rocblas_side_left)), value :: side
-        integer(kind(rocblas_fill_upper)), value :: uplo
+        integer(kind(rocblas_fill_full)), value :: uplo
         integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
         integer(c_int), value :: m
@@ -1841,24 +1872,23 @@ module rocblas_interface_tensile
         integer(c_int), value :: lda
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
-        type(c_ptr), value :: invA
-        integer(c_int), value :: invA_size
-        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = rocblas_trsm_ex(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb, invA, invA_size, compute_type)
-    end function rocblas_trsm_ex_fortran
+        res = rocblas_ztrsm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, batch_count)
+    end function rocblas_ztrsm_batched_fortran
 
-    function rocblas_trsm_batched_ex_fortran(handle, side, uplo, transA, diag, m, n, alpha, A, lda, &
-            B, ldb, batch_count, invA, invA_size, compute_type) &
+    ! trsm_strided_batched
+    function rocblas_strsm_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_trsm_batched_ex_fortran')
+            bind(c, name = 'rocblas_strsm_strided_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(rocblas_side_left)), value :: side
-        integer(kind(rocblas_fill_upper)), value :: uplo
+        integer(kind(rocblas_fill_full)), value :: uplo
         integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
         integer(c_int), value :: m
@@ -1866,27 +1896,26 @@ module rocblas_interface_tensile
         type(c_ptr), value :: alpha
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int64_t), value :: stride_A
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        integer(c_int64_t), value :: stride_B
         integer(c_int), value :: batch_count
-        type(c_ptr), value :: invA
-        integer(c_int), value :: invA_size
-        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
         integer(c_int) :: res
-        res = rocblas_trsm_batched_ex(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, B, ldb, batch_count, invA, invA_size, compute_type)
-    end function rocblas_trsm_batched_ex_fortran
+        res = rocblas_strsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, batch_count)
+    end function rocblas_strsm_strided_batched_fortran
 
-    function rocblas_trsm_strided_batched_ex_fortran(handle, side, uplo, transA, diag, m, n, alpha, A, lda, stride_A, &
-            B, ldb, stride_B, batch_count, invA, invA_size, stride_invA, compute_type) &
+    function rocblas_dtrsm_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, batch_count) &
             result(res) &
-            bind(c, name = 'rocblas_trsm_strided_batched_ex_fortran')
+            bind(c, name = 'rocblas_dtrsm_strided_batched_fortran')
         use iso_c_binding
         use rocblas_enums
         implicit none
         type(c_ptr), value :: handle
         integer(kind(rocblas_side_left)), value :: side
-        integer(kind(rocblas_fill_upper)), value :: uplo
+        integer(kind(rocblas_fill_full)), value :: uplo
         integer(kind(rocblas_operation_none)), value :: transA
         integer(kind(rocblas_diagonal_unit)), value :: diag
         integer(c_int), value :: m
@@ -1899,13 +1928,837 @@ module rocblas_interface_tensile
         integer(c_int), value :: ldb
         integer(c_int64_t), value :: stride_B
         integer(c_int), value :: batch_count
-        type(c_ptr), value :: invA
-        integer(c_int), value :: invA_size
-        integer(c_int64_t), value :: stride_invA
-        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
         integer(c_int) :: res
-        res = rocblas_trsm_strided_batched_ex(handle, side, uplo, transA, diag, m, n, alpha, &
-            A, lda, stride_A, B, ldb, stride_B, batch_count, invA, invA_size, stride_invA, compute_type)
-    end function rocblas_trsm_strided_batched_ex_fortran
+        res = rocblas_dtrsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, batch_count)
+    end function rocblas_dtrsm_strided_batched_fortran
+
+    function rocblas_ctrsm_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+            result(res) &
+            bind(c, name = 'rocblas_ctrsm_strided_batched_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int64_t), value :: stride_A
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int64_t), value :: stride_B
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = rocblas_ctrsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, batch_count)
+    end function rocblas_ctrsm_strided_batched_fortran
+
+    function rocblas_ztrsm_strided_batched_fortran(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+            result(res) &
+            bind(c, name = 'rocblas_ztrsm_strided_batched_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int64_t), value :: stride_A
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int64_t), value :: stride_B
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = rocblas_ztrsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, batch_count)
+    end function rocblas_ztrsm_strided_batched_fortran
+
+    !-----------------!
+    ! blas Extensions !
+    !-----------------!
+
+    ! gemm_ex
+    function rocblas_gemm_ex_fortran(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
+            b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
+            compute_type, algo, solution_index, flags) &
+            result(res) &
+            bind(c, name = 'rocblas_gemm_ex_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: a
+        integer(kind(rocblas_datatype_f16_r)), value :: a_type
+        integer(c_int), value :: lda
+        type(c_ptr), value :: b
+        integer(kind(rocblas_datatype_f16_r)), value :: b_type
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: c
+        integer(kind(rocblas_datatype_f16_r)), value :: c_type
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: d
+        integer(kind(rocblas_datatype_f16_r)), value :: d_type
+        integer(c_int), value :: ldd
+        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+        integer(kind(rocblas_gemm_algo_standard)), value :: algo
+        integer(c_int32_t), value :: solution_index
+        ! No unsigned types in fortran. If larger values are needed
+        ! we will need a workaround.
+        integer(c_int32_t), value :: flags
+        integer(c_int) :: res
+        res = rocblas_gemm_ex(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
+            b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
+            compute_type, algo, solution_index, flags)
+    end function rocblas_gemm_ex_fortran
+
+    function rocblas_gemm_batched_ex_fortran(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
+            b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
+            batch_count, compute_type, algo, solution_index, flags) &
+            result(res) &
+            bind(c, name = 'rocblas_gemm_batched_ex_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: a
+        integer(kind(rocblas_datatype_f16_r)), value :: a_type
+        integer(c_int), value :: lda
+        type(c_ptr), value :: b
+        integer(kind(rocblas_datatype_f16_r)), value :: b_type
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: c
+        integer(kind(rocblas_datatype_f16_r)), value :: c_type
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: d
+        integer(kind(rocblas_datatype_f16_r)), value :: d_type
+        integer(c_int), value :: ldd
+        integer(c_int), value :: batch_count
+        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+        integer(kind(rocblas_gemm_algo_standard)), value :: algo
+        integer(c_int32_t), value :: solution_index
+        ! No unsigned types in fortran. If larger values are needed
+        ! we will need a workaround.
+        integer(c_int32_t), value :: flags
+        integer(c_int) :: res
+        res = rocblas_gemm_batched_ex(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
+            b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
+            batch_count, compute_type, algo, solution_index, flags)
+    end function rocblas_gemm_batched_ex_fortran
+
+    function rocblas_gemm_strided_batched_ex_fortran(handle, transA, transB, m, n, k, alpha, a, a_type, lda, stride_a, &
+            b, b_type, ldb, stride_b, beta, c, c_type, ldc, stride_c, d, d_type, ldd, stride_d, &
+            batch_count, compute_type, algo, solution_index, flags) &
+            result(res) &
+            bind(c, name = 'rocblas_gemm_strided_batched_ex_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: a
+        integer(kind(rocblas_datatype_f16_r)), value :: a_type
+        integer(c_int), value :: lda
+        integer(c_int64_t), value :: stride_a
+        type(c_ptr), value :: b
+        integer(kind(rocblas_datatype_f16_r)), value :: b_type
+        integer(c_int), value :: ldb
+        integer(c_int64_t), value :: stride_b
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: c
+        integer(kind(rocblas_datatype_f16_r)), value :: c_type
+        integer(c_int), value :: ldc
+        integer(c_int64_t), value :: stride_c
+        type(c_ptr), value :: d
+        integer(kind(rocblas_datatype_f16_r)), value :: d_type
+        integer(c_int), value :: ldd
+        integer(c_int64_t), value :: stride_d
+        integer(c_int), value :: batch_count
+        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+        integer(kind(rocblas_gemm_algo_standard)), value :: algo
+        integer(c_int32_t), value :: solution_index
+        ! No unsigned types in fortran. If larger values are needed
+        ! we will need a workaround.
+        integer(c_int32_t), value :: flags
+        integer(c_int) :: res
+        res = rocblas_gemm_strided_batched_ex(handle, transA, transB, m, n, k, alpha, a, a_type, lda, stride_a, &
+            b, b_type, ldb, stride_b, beta, c, c_type, ldc, stride_c, d, d_type, ldd, stride_d, &
+            batch_count, compute_type, algo, solution_index, flags)
+    end function rocblas_gemm_strided_batched_ex_fortran
+
+    function rocblas_gemm_ext2_fortran(handle, m, n, k, alpha, a, a_type, row_stride_a, col_stride_a, &
+         b, b_type, row_stride_b, col_stride_b, beta, c, c_type, row_stride_c, col_stride_c, &
+         d, d_type, row_stride_d, col_stride_d, compute_type, algo, solution_index, flags) &
+            result(res) &
+            bind(c, name = 'rocblas_gemm_ext2_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: a
+        integer(kind(rocblas_datatype_f16_r)), value :: a_type
+        integer(c_int64_t), value :: row_stride_a, col_stride_a
+        type(c_ptr), value :: b
+        integer(kind(rocblas_datatype_f16_r)), value :: b_type
+        integer(c_int64_t), value :: row_stride_b, col_stride_b
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: c
+        integer(kind(rocblas_datatype_f16_r)), value :: c_type
+        integer(c_int64_t), value :: row_stride_c, col_stride_c
+        type(c_ptr), value :: d
+        integer(kind(rocblas_datatype_f16_r)), value :: d_type
+        integer(c_int64_t), value :: row_stride_d, col_stride_d
+        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+        integer(kind(rocblas_gemm_algo_standard)), value :: algo
+        integer(c_int32_t), value :: solution_index
+        ! No unsigned types in fortran. If larger values are needed
+        ! we will need a workaround.
+        integer(c_int32_t), value :: flags
+        integer(c_int) :: res
+        res = rocblas_gemm_ext2(handle, m, n, k, alpha, a, a_type, row_stride_a, col_stride_a, &
+             b, b_type, row_stride_b, col_stride_b, beta, c, c_type, row_stride_c, col_stride_c, &
+             d, d_type, row_stride_d, col_stride_d, compute_type, algo, solution_index, flags)
+    end function rocblas_gemm_ext2_fortran
+
+    ! trsm_ex
+    function rocblas_trsm_ex_fortran(handle, side, uplo, transA, diag, m, n, alpha, A, lda, &
+            B, ldb, invA, invA_size, compute_type) &
+            result(res) &
+            bind(c, name = 'rocblas_trsm_ex_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_upper)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: invA
+        integer(c_int), value :: invA_size
+        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+        integer(c_int) :: res
+        res = rocblas_trsm_ex(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, invA, invA_size, compute_type)
+    end function rocblas_trsm_ex_fortran
+
+    function rocblas_trsm_batched_ex_fortran(handle, side, uplo, transA, diag, m, n, alpha, A, lda, &
+            B, ldb, batch_count, invA, invA_size, compute_type) &
+            result(res) &
+            bind(c, name = 'rocblas_trsm_batched_ex_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_upper)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: invA
+        integer(c_int), value :: invA_size
+        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+        integer(c_int) :: res
+        res = rocblas_trsm_batched_ex(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, B, ldb, batch_count, invA, invA_size, compute_type)
+    end function rocblas_trsm_batched_ex_fortran
+
+    function rocblas_trsm_strided_batched_ex_fortran(handle, side, uplo, transA, diag, m, n, alpha, A, lda, stride_A, &
+            B, ldb, stride_B, batch_count, invA, invA_size, stride_invA, compute_type) &
+            result(res) &
+            bind(c, name = 'rocblas_trsm_strided_batched_ex_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_side_left)), value :: side
+        integer(kind(rocblas_fill_upper)), value :: uplo
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_diagonal_unit)), value :: diag
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int64_t), value :: stride_A
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int64_t), value :: stride_B
+        integer(c_int), value :: batch_count
+        type(c_ptr), value :: invA
+        integer(c_int), value :: invA_size
+        integer(c_int64_t), value :: stride_invA
+        integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+        integer(c_int) :: res
+        res = rocblas_trsm_strided_batched_ex(handle, side, uplo, transA, diag, m, n, alpha, &
+            A, lda, stride_A, B, ldb, stride_B, batch_count, invA, invA_size, stride_invA, compute_type)
+    end function rocblas_trsm_strided_batched_ex_fortran
+
+
+    ! ger_deferred, syr_deferred, her_deferred, syr2_deferred, her2_deferred
+    function rocblas_sger_deferred_fortran(handle, update, m, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_sger_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_sger_deferred(handle, update, m, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_sger_deferred_fortran
+
+    function rocblas_dger_deferred_fortran(handle, update, m, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_dger_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_dger_deferred(handle, update, m, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_dger_deferred_fortran
+
+    function rocblas_cgeru_deferred_fortran(handle, update, m, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_cgeru_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_cgeru_deferred(handle, update, m, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_cgeru_deferred_fortran
+
+    function rocblas_zgeru_deferred_fortran(handle, update, m, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_zgeru_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_zgeru_deferred(handle, update, m, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_zgeru_deferred_fortran
+
+    function rocblas_cgerc_deferred_fortran(handle, update, m, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_cgerc_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_cgerc_deferred(handle, update, m, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_cgerc_deferred_fortran
+
+    function rocblas_zgerc_deferred_fortran(handle, update, m, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_zgerc_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_zgerc_deferred(handle, update, m, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_zgerc_deferred_fortran
+
+    function rocblas_ssyr_deferred_fortran(handle, update, uplo, n, alpha, x, incx, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_ssyr_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_ssyr_deferred(handle, update, uplo, n, alpha, x, incx,&
+              A, lda)
+    end function rocblas_ssyr_deferred_fortran
+
+    function rocblas_dsyr_deferred_fortran(handle, update, uplo, n, alpha, x, incx, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_dsyr_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_dsyr_deferred(handle, update, uplo, n, alpha, x, incx,&
+              A, lda)
+    end function rocblas_dsyr_deferred_fortran
+
+    function rocblas_csyr_deferred_fortran(handle, update, uplo, n, alpha, x, incx, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_csyr_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_csyr_deferred(handle, update, uplo, n, alpha, x, incx,&
+              A, lda)
+    end function rocblas_csyr_deferred_fortran
+
+    function rocblas_zsyr_deferred_fortran(handle, update, uplo, n, alpha, x, incx, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_zsyr_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_zsyr_deferred(handle, update, uplo, n, alpha, x, incx,&
+              A, lda)
+    end function rocblas_zsyr_deferred_fortran
+
+    function rocblas_cher_deferred_fortran(handle, update, uplo, n, alpha, x, incx, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_cher_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_cher_deferred(handle, update, uplo, n, alpha, x, incx,&
+              A, lda)
+    end function rocblas_cher_deferred_fortran
+
+    function rocblas_zher_deferred_fortran(handle, update, uplo, n, alpha, x, incx, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_zher_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_zher_deferred(handle, update, uplo, n, alpha, x, incx,&
+              A, lda)
+    end function rocblas_zher_deferred_fortran
+
+    function rocblas_ssyr2_deferred_fortran(handle, update, uplo, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_ssyr2_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_ssyr2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_ssyr2_deferred_fortran
+
+    function rocblas_dsyr2_deferred_fortran(handle, update, uplo, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_dsyr2_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_dsyr2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_dsyr2_deferred_fortran
+
+    function rocblas_csyr2_deferred_fortran(handle, update, uplo, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_csyr2_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_csyr2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_csyr2_deferred_fortran
+
+    function rocblas_zsyr2_deferred_fortran(handle, update, uplo, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_zsyr2_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_zsyr2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_zsyr2_deferred_fortran
+
+    function rocblas_cher2_deferred_fortran(handle, update, uplo, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_cher2_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_cher2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_cher2_deferred_fortran
+
+    function rocblas_zher2_deferred_fortran(handle, update, uplo, n, alpha, x, incx, y, incy, &
+            A, lda) &
+            result(res) &
+            bind(c, name = 'rocblas_zher2_deferred_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: update
+        integer(kind(rocblas_fill_full)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: x
+        integer(c_int), value :: incx
+        type(c_ptr), value :: y
+        integer(c_int), value :: incy
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int) :: res
+        res = rocblas_zher2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy,&
+              A, lda)
+    end function rocblas_zher2_deferred_fortran
+
+
+    ! gemm_grouped
+    function rocblas_sgemm_grouped_fortran(handle, array_mode, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc, group_count) &
+            result(res) &
+            bind(c, name = 'rocblas_sgemm_grouped_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_pointer_mode_host)), value :: array_mode
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: C
+        type(c_ptr), value :: ldc
+        integer(c_int), value :: group_count
+        integer(c_int) :: res
+        res = rocblas_sgemm_grouped(handle, array_mode, transA, transB, m, n, k, alpha, &
+              A, lda, B, ldb, beta, C, ldc, group_count)
+    end function rocblas_sgemm_grouped_fortran
+
+    function rocblas_dgemm_grouped_fortran(handle, array_mode, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc, group_count) &
+            result(res) &
+            bind(c, name = 'rocblas_dgemm_grouped_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_pointer_mode_host)), value :: array_mode
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: C
+        type(c_ptr), value :: ldc
+        integer(c_int), value :: group_count
+        integer(c_int) :: res
+        res = rocblas_dgemm_grouped(handle, array_mode, transA, transB, m, n, k, alpha, &
+              A, lda, B, ldb, beta, C, ldc, group_count)
+    end function rocblas_dgemm_grouped_fortran
+
+    function rocblas_cgemm_grouped_fortran(handle, array_mode, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc, group_count) &
+            result(res) &
+            bind(c, name = 'rocblas_cgemm_grouped_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_pointer_mode_host)), value :: array_mode
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: C
+        type(c_ptr), value :: ldc
+        integer(c_int), value :: group_count
+        integer(c_int) :: res
+        res = rocblas_cgemm_grouped(handle, array_mode, transA, transB, m, n, k, alpha, &
+              A, lda, B, ldb, beta, C, ldc, group_count)
+    end function rocblas_cgemm_grouped_fortran
+
+    function rocblas_zgemm_grouped_fortran(handle, array_mode, transA, transB, m, n, k, alpha, &
+            A, lda, B, ldb, beta, C, ldc, group_count) &
+            result(res) &
+            bind(c, name = 'rocblas_zgemm_grouped_fortran')
+        use iso_c_binding
+        use rocblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(rocblas_pointer_mode_host)), value :: array_mode
+        integer(kind(rocblas_operation_none)), value :: transA
+        integer(kind(rocblas_operation_none)), value :: transB
+        type(c_ptr), value :: m
+        type(c_ptr), value :: n
+        type(c_ptr), value :: k
+        type(c_ptr), value :: alpha
+        type(c_ptr), value :: A
+        type(c_ptr), value :: lda
+        type(c_ptr), value :: B
+        type(c_ptr), value :: ldb
+        type(c_ptr), value :: beta
+        type(c_ptr), value :: C
+        type(c_ptr), value :: ldc
+        integer(c_int), value :: group_count
+        integer(c_int) :: res
+        res = rocblas_zgemm_grouped(handle, array_mode, transA, transB, m, n, k, alpha, &
+              A, lda, B, ldb, beta, C, ldc, group_count)
+    end function rocblas_zgemm_grouped_fortran
 
 end module rocblas_interface_tensile
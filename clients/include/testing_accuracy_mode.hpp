@@ -0,0 +1,136 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "near.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <cstring>
+
+// Check that rocblas_accuracy_compensated bounds the error of asum, nrm2 and dot independently of
+// n. This is done by:
+// - Initializing x and y with values of widely varying magnitude, replicated into every instance
+//   of a strided batch
+// - Calling asum, nrm2 and dot without batching in host pointer mode and with batch_count
+//   instances in device pointer mode, in both reduction modes
+// - Checking every result against a long double reference with a tolerance of a few ulps of the
+//   sum of the absolute values of the summed terms, instead of the n ulps of the default mode
+// - Checking that the results in rocblas_reduction_reproducible mode still have the same bits
+
+template <typename T>
+void testing_accuracy_mode(const Arguments& arg)
+{
+    rocblas_int    N           = arg.N;
+    rocblas_int    batch_count = arg.batch_count;
+    rocblas_stride stride      = N;
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_accuracy_mode mode = rocblas_accuracy_mode(-1);
+    CHECK_ROCBLAS_ERROR(rocblas_get_accuracy_mode(handle, &mode));
+    EXPECT_EQ(rocblas_accuracy_default, mode);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_accuracy_mode(handle, rocblas_accuracy_mode(2)),
+                          rocblas_status_invalid_value);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_accuracy_mode(handle, rocblas_accuracy_compensated));
+    CHECK_ROCBLAS_ERROR(rocblas_get_accuracy_mode(handle, &mode));
+    EXPECT_EQ(rocblas_accuracy_compensated, mode);
+
+    if(N <= 0 || batch_count <= 0)
+        return;
+
+    size_t         size_x = size_t(N) * batch_count;
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_x);
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hy.memcheck());
+
+    for(size_t i = 0; i < size_x; i++)
+    {
+        rocblas_int j = i % N;
+        hx[i]         = T(sin(double(j)) * double(1 << (j % 16)));
+        hy[i]         = T(cos(double(j)) * double(1 << (j % 11)));
+    }
+
+    // references and sums of the absolute values of the summed terms
+    long double asum_ref = 0, nrm2_ref = 0, dot_ref = 0, dot_abs = 0;
+    for(rocblas_int i = 0; i < N; i++)
+    {
+        long double xi = hx[i], yi = hy[i];
+        asum_ref += std::abs(xi);
+        nrm2_ref += xi * xi;
+        dot_ref += xi * yi;
+        dot_abs += std::abs(xi * yi);
+    }
+    nrm2_ref = std::sqrt(nrm2_ref);
+
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_x);
+    device_vector<T> dr(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dr.memcheck());
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    host_vector<T> h_single(1);
+    host_vector<T> h_device(batch_count);
+
+    auto same_bits = [](T a, T b) { return !memcmp(&a, &b, sizeof(T)); };
+
+    auto check_accurate = [&](const char*            name,
+                              rocblas_reduction_mode reduction_mode,
+                              long double            ref,
+                              long double            magnitude) {
+        T cpu_result = T(ref);
+        T abs_error  = T(4 * std::numeric_limits<T>::epsilon() * magnitude);
+        near_check_general<T, T>(1, 1, 1, &cpu_result, h_single, abs_error);
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            near_check_general<T, T>(1, 1, 1, &cpu_result, &h_device[b], abs_error);
+            if(reduction_mode == rocblas_reduction_reproducible)
+                EXPECT_TRUE(same_bits(h_single[0], h_device[b]))
+                    << name << " batch " << b << " differs from batch_count 1";
+        }
+    };
+
+    for(auto reduction_mode : {rocblas_reduction_default, rocblas_reduction_reproducible})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_reduction_mode(handle, reduction_mode));
+
+        // asum
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, N, dx, 1, h_single));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_asum_strided_batched<T>(handle, N, dx, 1, stride, batch_count, dr));
+        CHECK_HIP_ERROR(h_device.transfer_from(dr));
+        check_accurate("asum", reduction_mode, asum_ref, asum_ref);
+
+        // nrm2
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, N, dx, 1, h_single));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_nrm2_strided_batched<T>(handle, N, dx, 1, stride, batch_count, dr));
+        CHECK_HIP_ERROR(h_device.transfer_from(dr));
+        check_accurate("nrm2", reduction_mode, nrm2_ref, nrm2_ref);
+
+        // dot
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx, 1, dy, 1, h_single));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_dot_strided_batched<T>(
+            handle, N, dx, 1, stride, dy, 1, stride, batch_count, dr));
+        CHECK_HIP_ERROR(h_device.transfer_from(dr));
+        check_accurate("dot", reduction_mode, dot_ref, dot_abs);
+    }
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+// Check the rocblas_packed_mode handle setting, rocblas_unpack and rocblas_pack. This is done by:
+// - Setting and getting the packed mode
+// - Checking the argument checks of rocblas_unpack and rocblas_pack
+// - Unpacking a random packed matrix into a full matrix whose other entries hold a sentinel, and
+//   checking that the triangle is unpacked in place and the rest of the matrix is untouched
+// - Packing the full matrix back and checking that it gives the packed matrix bitwise
+// - With a packed unpack cache large enough for the unpacked matrix, running tpmv twice, the
+//   first call caching the unpacked matrix and the second one using it, then scaling the packed
+//   matrix in place and changing the version, so that the next call does not use the stale copy
+
+template <typename T>
+void testing_packed_mode(const Arguments& arg)
+{
+    rocblas_fill uplo      = char2rocblas_fill(arg.uplo);
+    rocblas_int  N         = arg.N;
+    rocblas_int  lda       = arg.lda;
+    rocblas_int  elem_size = sizeof(T);
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_packed_mode mode = rocblas_packed_mode(-1);
+    CHECK_ROCBLAS_ERROR(rocblas_get_packed_mode(handle, &mode));
+    EXPECT_EQ(rocblas_packed_default, mode);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_packed_mode(handle, rocblas_packed_mode(2)),
+                          rocblas_status_invalid_value);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_packed_mode(handle, rocblas_packed_unpack));
+    CHECK_ROCBLAS_ERROR(rocblas_get_packed_mode(handle, &mode));
+    EXPECT_EQ(rocblas_packed_unpack, mode);
+
+    size_t cache_size = 1;
+    CHECK_ROCBLAS_ERROR(rocblas_get_packed_unpack_cache_size(handle, &cache_size));
+    EXPECT_EQ(cache_size, 0);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_packed_unpack_cache_size(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_packed_unpack_cache_size(nullptr, 0),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_packed_unpack_cache_version(nullptr, 0),
+                          rocblas_status_invalid_handle);
+
+    bool invalid_size = N < 0 || lda < N || lda < 1;
+    if(invalid_size || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_unpack(handle, uplo, N, elem_size, nullptr, nullptr, lda),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(rocblas_pack(handle, uplo, N, elem_size, nullptr, lda, nullptr),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_AP = size_t(N) * (N + 1) / 2;
+    size_t size_A  = size_t(lda) * N;
+
+    host_vector<T> hAP(size_AP);
+    host_vector<T> hAP_gold(size_AP);
+    host_vector<T> hA(size_A);
+    host_vector<T> hA_gold(size_A);
+    CHECK_HIP_ERROR(hAP.memcheck());
+    CHECK_HIP_ERROR(hAP_gold.memcheck());
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hA_gold.memcheck());
+
+    device_vector<T> dAP(size_AP);
+    device_vector<T> dA(size_A);
+    CHECK_DEVICE_ALLOCATION(dAP.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_unpack(nullptr, uplo, N, elem_size, dAP, dA, lda),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_unpack(handle, rocblas_fill_full, N, elem_size, dAP, dA, lda),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_unpack(handle, uplo, N, 0, dAP, dA, lda),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_unpack(handle, uplo, N, elem_size, nullptr, dA, lda),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_pack(handle, uplo, N, elem_size, dA, lda, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    rocblas_init(hAP_gold, true);
+    for(size_t i = 0; i < size_A; i++)
+        hA[i] = T(-99);
+
+    // unpack on the CPU
+    hA_gold = hA;
+    for(rocblas_int j = 0, p = 0; j < N; j++)
+        for(rocblas_int i = uplo == rocblas_fill_upper ? 0 : j;
+            i < (uplo == rocblas_fill_upper ? j + 1 : N);
+            i++)
+            hA_gold[i + size_t(lda) * j] = hAP_gold[p++];
+
+    CHECK_HIP_ERROR(dAP.transfer_from(hAP_gold));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_ROCBLAS_ERROR(rocblas_unpack(handle, uplo, N, elem_size, dAP, dA, lda));
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+    unit_check_general<T>(lda, N, lda, hA_gold, hA);
+
+    CHECK_HIP_ERROR(dAP.transfer_from(hAP));
+    CHECK_ROCBLAS_ERROR(rocblas_pack(handle, uplo, N, elem_size, dA, lda, dAP));
+    CHECK_HIP_ERROR(hAP.transfer_from(dAP));
+    unit_check_general<T>(1, size_AP, 1, hAP_gold, hAP);
+
+    // an unpacked matrix takes N * N elements
+    size_t unpacked_size = sizeof(T) * N * N;
+    CHECK_ROCBLAS_ERROR(rocblas_set_packed_unpack_cache_size(handle, unpacked_size));
+    CHECK_ROCBLAS_ERROR(rocblas_get_packed_unpack_cache_size(handle, &cache_size));
+    EXPECT_EQ(cache_size, unpacked_size);
+
+    host_vector<T>   hx_init(N);
+    host_vector<T>   hx(N);
+    host_vector<T>   hx_gold(N);
+    device_vector<T> dx(N);
+    CHECK_HIP_ERROR(hx_init.memcheck());
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hx_gold.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    rocblas_init(hx_init, false);
+
+    // x := A * x with the unpacked copy of AP, cached or not, checked against cblas
+    auto tpmv_and_check = [&]() {
+        hx_gold = hx_init;
+        CHECK_HIP_ERROR(dx.transfer_from(hx_init));
+        CHECK_ROCBLAS_ERROR(rocblas_tpmv<T>(
+            handle, uplo, rocblas_operation_none, rocblas_diagonal_non_unit, N, dAP, dx, 1));
+        cblas_tpmv<T>(
+            uplo, rocblas_operation_none, rocblas_diagonal_non_unit, N, hAP_gold, hx_gold, 1);
+        CHECK_HIP_ERROR(hx.transfer_from(dx));
+        unit_check_general<T>(1, N, 1, hx_gold, hx);
+    };
+
+    // the first call caches the unpacked matrix, the second one uses it
+    tpmv_and_check();
+    tpmv_and_check();
+
+    // scale AP in place, the unpacked copy of the previous version must not be used
+    for(size_t i = 0; i < size_AP; i++)
+        hAP_gold[i] = hAP_gold[i] * T(2);
+    CHECK_HIP_ERROR(dAP.transfer_from(hAP_gold));
+    CHECK_ROCBLAS_ERROR(rocblas_set_packed_unpack_cache_version(handle, 1));
+    tpmv_and_check();
+    tpmv_and_check();
+}
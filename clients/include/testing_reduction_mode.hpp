@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "near.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <cstring>
+
+// Check that rocblas_reduction_reproducible gives bitwise identical results. This is done by:
+// - Initializing x and y with values whose sum depends on the summation order, and replicating
+//   them into every instance of a strided batch
+// - Calling asum, nrm2 and dot without batching and with batch_count instances, in both
+//   pointer modes
+// - Checking that every result has the same bits, and that it is near the CPU reference
+
+template <typename T>
+void testing_reduction_mode(const Arguments& arg)
+{
+    rocblas_int    N           = arg.N;
+    rocblas_int    batch_count = arg.batch_count;
+    rocblas_stride stride      = N;
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_reduction_mode mode = rocblas_reduction_mode(-1);
+    CHECK_ROCBLAS_ERROR(rocblas_get_reduction_mode(handle, &mode));
+    EXPECT_EQ(rocblas_reduction_default, mode);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_reduction_mode(handle, rocblas_reduction_mode(2)),
+                          rocblas_status_invalid_value);
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_reduction_mode(handle, rocblas_reduction_reproducible));
+    CHECK_ROCBLAS_ERROR(rocblas_get_reduction_mode(handle, &mode));
+    EXPECT_EQ(rocblas_reduction_reproducible, mode);
+
+    if(N <= 0 || batch_count <= 0)
+        return;
+
+    size_t         size_x = size_t(N) * batch_count;
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_x);
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hy.memcheck());
+
+    for(size_t i = 0; i < size_x; i++)
+    {
+        hx[i] = T(sin(double(i % N)));
+        hy[i] = T(cos(double(i % N)));
+    }
+
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_x);
+    device_vector<T> dr(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dr.memcheck());
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    host_vector<T> h_single(1);
+    host_vector<T> h_batched(batch_count);
+    host_vector<T> h_device(batch_count);
+
+    auto same_bits = [](T a, T b) { return !memcmp(&a, &b, sizeof(T)); };
+
+    // magnitude is the sum of absolute values of the summed terms, which bounds the rounding error
+    auto check_reproducible = [&](const char* name, T cpu_result, T magnitude) {
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            EXPECT_TRUE(same_bits(h_single[0], h_batched[b]))
+                << name << " batch " << b << " host pointer mode differs from batch_count 1";
+            EXPECT_TRUE(same_bits(h_single[0], h_device[b]))
+                << name << " batch " << b << " device pointer mode differs from batch_count 1";
+        }
+
+        T abs_error = std::numeric_limits<T>::epsilon() * N * magnitude;
+        near_check_general<T, T>(1, 1, 1, &cpu_result, h_single, abs_error);
+    };
+
+    T cpu_result;
+
+    // asum
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_asum<T>(handle, N, dx, 1, h_single));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_asum_strided_batched<T>(handle, N, dx, 1, stride, batch_count, h_batched));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_asum_strided_batched<T>(handle, N, dx, 1, stride, batch_count, dr));
+    CHECK_HIP_ERROR(h_device.transfer_from(dr));
+
+    cblas_asum<T>(N, hx, 1, &cpu_result);
+    check_reproducible("asum", cpu_result, cpu_result);
+
+    // nrm2
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_nrm2<T>(handle, N, dx, 1, h_single));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_nrm2_strided_batched<T>(handle, N, dx, 1, stride, batch_count, h_batched));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_nrm2_strided_batched<T>(handle, N, dx, 1, stride, batch_count, dr));
+    CHECK_HIP_ERROR(h_device.transfer_from(dr));
+
+    cblas_nrm2<T>(N, hx, 1, &cpu_result);
+    check_reproducible("nrm2", cpu_result, cpu_result);
+
+    // dot
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx, 1, dy, 1, h_single));
+    CHECK_ROCBLAS_ERROR(rocblas_dot_strided_batched<T>(
+        handle, N, dx, 1, stride, dy, 1, stride, batch_count, h_batched));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_dot_strided_batched<T>(handle, N, dx, 1, stride, dy, 1, stride, batch_count, dr));
+    CHECK_HIP_ERROR(h_device.transfer_from(dr));
+
+    cblas_dot<T>(N, hx, 1, hy, 1, &cpu_result);
+    T abs_sum = 0;
+    for(rocblas_int i = 0; i < N; i++)
+        abs_sum += std::abs(hx[i] * hy[i]);
+    check_reproducible("dot", cpu_result, abs_sum);
+}
@@ -279,3 +279,26 @@ auto rocblas_gemm_dispatch(const Arguments& arg)
     }
     return TEST<void>{}(arg);
 }
+
+// gemm functions with int8 inputs and a real output dequantized from the int32 product,
+// dispatched on the type of the output
+template <template <typename...> class TEST>
+auto rocblas_gemm_dequantize_dispatch(const Arguments& arg)
+{
+    if(arg.a_type == rocblas_datatype_i8_r && arg.b_type == rocblas_datatype_i8_r
+       && arg.c_type == arg.d_type && arg.compute_type == rocblas_datatype_f32_r)
+    {
+        switch(arg.d_type)
+        {
+        case rocblas_datatype_f32_r:
+            return TEST<float>{}(arg);
+        case rocblas_datatype_f16_r:
+            return TEST<rocblas_half>{}(arg);
+        case rocblas_datatype_bf16_r:
+            return TEST<rocblas_bfloat16>{}(arg);
+        default:
+            break;
+        }
+    }
+    return TEST<void>{}(arg);
+}
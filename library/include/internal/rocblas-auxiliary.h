@@ -42,6 +42,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_get_pointer_mode(rocblas_handle        han
                                                        rocblas_pointer_mode* pointer_mode);
 
 /*! \brief set rocblas_atomics_mode
+    \details
+    Level-2 functions reduce partial results in a fixed order in both modes, so their results do
+    not depend on the atomics mode. gemv_grouped and gemm_grouped take their tiles from an atomic
+    counter to balance them across the device, and in a fixed round robin order when atomics are
+    not allowed.
  */
 ROCBLAS_EXPORT rocblas_status rocblas_set_atomics_mode(rocblas_handle       handle,
                                                        rocblas_atomics_mode atomics_mode);
@@ -51,6 +56,372 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_atomics_mode(rocblas_handle       hand
 ROCBLAS_EXPORT rocblas_status rocblas_get_atomics_mode(rocblas_handle        handle,
                                                        rocblas_atomics_mode* atomics_mode);
 
+/*! \brief set rocblas_reduction_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_reduction_mode(rocblas_handle         handle,
+                                                         rocblas_reduction_mode reduction_mode);
+
+/*! \brief get rocblas_reduction_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_reduction_mode(rocblas_handle          handle,
+                                                         rocblas_reduction_mode* reduction_mode);
+
+/*! \brief set rocblas_accuracy_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_accuracy_mode(rocblas_handle        handle,
+                                                        rocblas_accuracy_mode accuracy_mode);
+
+/*! \brief get rocblas_accuracy_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_accuracy_mode(rocblas_handle         handle,
+                                                        rocblas_accuracy_mode* accuracy_mode);
+
+/*! \brief set rocblas_packed_mode
+     \details
+    In rocblas_packed_unpack mode rocblas_Xspmv, rocblas_Xhpmv, rocblas_Xtpmv, rocblas_Xtpsv and
+    their batched and strided_batched variants need n * n * batch_count elements of device
+    memory for the unpacked matrices, in addition to the device memory of rocblas_Xsymv,
+    rocblas_Xhemv, rocblas_Xtrmv or rocblas_Xtrsv. When this device memory cannot be allocated,
+    they index the packed matrices directly, as in the default mode.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_packed_mode(rocblas_handle      handle,
+                                                      rocblas_packed_mode packed_mode);
+
+/*! \brief get rocblas_packed_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_packed_mode(rocblas_handle       handle,
+                                                      rocblas_packed_mode* packed_mode);
+
+/*! \brief set the size of the packed unpack cache
+     \details
+    In rocblas_packed_unpack mode rocblas_Xspmv, rocblas_Xhpmv, rocblas_Xtpmv and rocblas_Xtpsv
+    unpack AP at every call. With a non-zero cache size, they keep the unpacked matrices in
+    device memory owned by the handle, so that calls with the same packed matrix skip the
+    unpacking. The unpacked matrices are identified by the device pointer AP, n, uplo, the
+    precision and the version set by rocblas_set_packed_unpack_cache_version at the time of the
+    call. When the cache is full, the least recently used matrices are freed first. An unpacked
+    matrix takes n * n elements of the precision of AP. The batched and strided_batched variants
+    do not use the cache.
+    Setting the size frees all the cached matrices; the default size 0 disables the cache.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    size        maximum number of bytes of device memory for the unpacked matrices
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_packed_unpack_cache_size(rocblas_handle handle,
+                                                                   size_t         size);
+
+/*! \brief get the size of the packed unpack cache
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_packed_unpack_cache_size(rocblas_handle handle,
+                                                                   size_t*        size);
+
+/*! \brief set the version of the packed matrices unpacked in rocblas_packed_unpack mode
+     \details
+    The cached unpacked copy of a packed matrix is only used by calls made with the version it
+    was unpacked with, so changing the version after modifying a packed matrix in place, or after
+    reusing its memory for another matrix, ensures that stale copies are not used. The default
+    version is 0.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    version     tag of the current contents of the packed matrices used with handle
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_packed_unpack_cache_version(rocblas_handle handle,
+                                                                      int64_t        version);
+
+/*! \brief set the size of the trsv inverse cache
+     \details
+    rocblas_strsv, rocblas_dtrsv, rocblas_ctrsv and rocblas_ztrsv normally solve by substitution.
+    With a non-zero cache size, they instead solve with the inverses of the diagonal blocks of A,
+    like rocblas_trsv_ex, and keep these inverses in device memory owned by the handle, so that
+    solves against the same matrix skip the inversion. The inverses are identified by the device
+    pointer A, m, lda, uplo, diag, the precision and the version set by
+    rocblas_set_trsv_inverse_cache_version at the time of the solve; they do not depend on transA.
+    When the cache is full, the least recently used inverses are freed first. An inverse takes
+    128 * m elements of the precision of A.
+    Setting the size frees all the cached inverses; the default size 0 disables the cache.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    size        maximum number of bytes of device memory for the cached inverses
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_trsv_inverse_cache_size(rocblas_handle handle,
+                                                                  size_t         size);
+
+/*! \brief get the size of the trsv inverse cache
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_trsv_inverse_cache_size(rocblas_handle handle,
+                                                                  size_t*        size);
+
+/*! \brief set the version of the matrices solved by trsv
+     \details
+    The cached inverses of a matrix are only used by solves made with the version they were
+    computed with, so changing the version after modifying a matrix in place, or after reusing
+    its memory for another matrix, ensures that stale inverses are not used. The default
+    version is 0.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    version     tag of the current contents of the matrices solved with handle
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_trsv_inverse_cache_version(rocblas_handle handle,
+                                                                     int64_t        version);
+
+/*! \brief set the size of the trsm inverse cache
+     \details
+    rocblas_strsm, rocblas_dtrsm, rocblas_ctrsm, rocblas_ztrsm and rocblas_trsm_ex without invA
+    compute the inverses of the 128 x 128 diagonal blocks of A in the device memory of the handle
+    at every call, unless m and n are both at most 64. With a non-zero cache size, they keep these
+    inverses in device memory owned by the handle, so that solves against the same factor with
+    other right-hand sides skip the inversion. The inverses are identified by the device pointer
+    A, the size k of A, lda, uplo, diag, the precision and the version set by
+    rocblas_set_trsm_inverse_cache_version at the time of the solve; they do not depend on side or
+    transA. When the cache is full, the least recently used inverses are freed first. An inverse
+    takes 128 * k elements of the precision of A.
+    Setting the size frees all the cached inverses; the default size 0 disables the cache.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    size        maximum number of bytes of device memory for the cached inverses
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_trsm_inverse_cache_size(rocblas_handle handle,
+                                                                  size_t         size);
+
+/*! \brief get the size of the trsm inverse cache
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_trsm_inverse_cache_size(rocblas_handle handle,
+                                                                  size_t*        size);
+
+/*! \brief set the version of the matrices solved by trsm
+     \details
+    The cached inverses of a matrix are only used by solves made with the version they were
+    computed with, so changing the version after modifying the factors in place, or after reusing
+    their memory for other matrices, ensures that stale inverses are not used. The default
+    version is 0.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    version     tag of the current contents of the matrices solved with handle
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_trsm_inverse_cache_version(rocblas_handle handle,
+                                                                     int64_t        version);
+
+/*! \brief free the cached trsm inverses of a matrix
+     \details
+    Frees the inverses cached for the device pointer A, whatever their version, so that a factor
+    modified in place is inverted again by the next solve without changing the version of the
+    other factors.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    A           device pointer of the matrix, or nullptr to free all the cached inverses
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_clear_trsm_inverse_cache(rocblas_handle handle,
+                                                               const void*    A);
+
+/*! \brief create a buffer of deferred rank updates
+     \details
+    Creates a rocblas_rank_update which holds up to k pending rank-1 updates (k / 2 rank-2
+    updates) of a matrix, made by rocblas_Xger_deferred, rocblas_Xsyr_deferred,
+    rocblas_Xher_deferred, rocblas_Xsyr2_deferred and rocblas_Xher2_deferred. The pending
+    updates are applied together as a single rank-k update with xGEMM, xSYRKX or xHERKX, which
+    reads and writes the matrix once instead of once per update.
+    The device memory of the buffer, 2 * k * max(m, n) elements, is allocated by the first update.
+    @param[out]
+    update      pointer to the created rocblas_rank_update
+    @param[in]
+    k           [rocblas_int]
+                number of vectors buffered before the updates are applied, at least 2
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_create_rank_update(rocblas_rank_update* update,
+                                                         rocblas_int          k);
+
+/*! \brief destroy a buffer of deferred rank updates
+     \details
+    Frees the device memory of update, waiting for the device. Pending updates which have not
+    been applied with rocblas_rank_update_flush are discarded.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_destroy_rank_update(rocblas_rank_update update);
+
+/*! \brief apply the pending updates of a buffer of deferred rank updates
+     \details
+    Applies the pending updates of update to their matrix on the stream of handle. The matrix
+    must not be read or written by other functions before the flush.
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[inout]
+    update      [rocblas_rank_update]
+                the buffer of deferred rank updates.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_rank_update_flush(rocblas_handle      handle,
+                                                        rocblas_rank_update update);
+
+/*! \brief create a gemm epilogue
+     \details
+    Creates a rocblas_gemm_epilogue which applies no bias, no scaling, no activation and no
+    saturation. Passed to rocblas_gemm_ex_epilogue or rocblas_gemm_ext2_epilogue, it changes the
+    result D of the gemm into
+        D := saturate(activation(scale .* D + bias))
+    computed in double for rocblas_datatype_f64_r and in float for the other types of D, in a
+    single pass over D after the gemm. Only the real floating point types of D are supported,
+    the int8 gemms with such a D being described in rocblas_gemm_epilogue_set_dequantization.
+    @param[out]
+    epilogue    pointer to the created rocblas_gemm_epilogue
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_create_gemm_epilogue(rocblas_gemm_epilogue* epilogue);
+
+/*! \brief destroy a gemm epilogue
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_destroy_gemm_epilogue(rocblas_gemm_epilogue epilogue);
+
+/*! \brief set the bias of a gemm epilogue
+     \details
+    @param[inout]
+    epilogue    [rocblas_gemm_epilogue]
+    @param[in]
+    bias        device pointer of the bias vector, of compute_type, with m elements per row or n
+                elements per column, or nullptr for no bias. It is read by every gemm using
+                epilogue.
+    @param[in]
+    vector      [rocblas_epilogue_vector]
+                whether bias is indexed by the row or by the column of D.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_epilogue_set_bias(rocblas_gemm_epilogue   epilogue,
+                                                             const void*             bias,
+                                                             rocblas_epilogue_vector vector);
+
+/*! \brief set the scale of a gemm epilogue
+     \details
+    @param[inout]
+    epilogue    [rocblas_gemm_epilogue]
+    @param[in]
+    scale       device pointer of the scale vector, of compute_type, with m elements per row or n
+                elements per column, or nullptr for no scaling. It multiplies D before the bias
+                is added.
+    @param[in]
+    vector      [rocblas_epilogue_vector]
+                whether scale is indexed by the row or by the column of D.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_epilogue_set_scale(rocblas_gemm_epilogue   epilogue,
+                                                              const void*             scale,
+                                                              rocblas_epilogue_vector vector);
+
+/*! \brief set the activation of a gemm epilogue
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_epilogue_set_activation(rocblas_gemm_epilogue epilogue,
+                                                                   rocblas_activation activation);
+
+/*! \brief set the saturation of a gemm epilogue
+     \details
+    When saturate is true, the results which exceed the largest finite value of d_type are
+    clamped to it instead of overflowing to infinity in the conversion to d_type.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_epilogue_set_saturation(rocblas_gemm_epilogue epilogue,
+                                                                   bool                  saturate);
+
+/*! \brief set the dequantization of a gemm epilogue
+     \details
+    The dequantization applies to rocblas_gemm_ex_epilogue with a_type and b_type
+    rocblas_datatype_i8_r, c_type and d_type rocblas_datatype_f32_r, rocblas_datatype_f16_r or
+    rocblas_datatype_bf16_r, and compute_type rocblas_datatype_f32_r. The product of A and B is
+    accumulated in int32 and the epilogue computes the element (i, j) of D as
+        alpha * column_scale[j] * row_scale[i] * (Q[i, j] + row_offset[i] + column_offset[j])
+        + beta * C[i, j]
+    in float before it applies its scale, bias, activation and saturation, Q being the int32
+    product. The offsets correct for the zero points of asymmetric quantization. alpha, beta,
+    the bias and the scale are float. When k is 0, alpha is taken as 0.
+    @param[in]
+    epilogue        [rocblas_gemm_epilogue]
+                    the gemm epilogue.
+    @param[in]
+    row_scale       device pointer of m floats, or nullptr for a scale of 1.
+    @param[in]
+    column_scale    device pointer of n floats, or nullptr for a scale of 1.
+    @param[in]
+    row_offset      device pointer of m int32_t, or nullptr for an offset of 0.
+    @param[in]
+    column_offset   device pointer of n int32_t, or nullptr for an offset of 0.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_gemm_epilogue_set_dequantization(rocblas_gemm_epilogue epilogue,
+                                             const float*          row_scale,
+                                             const float*          column_scale,
+                                             const int32_t*        row_offset,
+                                             const int32_t*        column_offset);
+
+/*! \brief set rocblas_check_numerics_mode
+     \details
+    Sets the bitwise OR of rocblas_check_numerics_mode flags used for the functions called with handle.
+    The initial value is read from the environment variable ROCBLAS_CHECK_NUMERICS.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    check_numerics [rocblas_check_numerics_mode]
+                bitwise OR of rocblas_check_numerics_mode flags
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_check_numerics_mode(
+    rocblas_handle handle, rocblas_check_numerics_mode check_numerics);
+
+/*! \brief get rocblas_check_numerics_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_check_numerics_mode(
+    rocblas_handle handle, rocblas_check_numerics_mode* check_numerics);
+
+/*! \brief get the statistics gathered by rocblas_check_numerics_mode_stats
+     \details
+    Returns the statistics of the Input or the Output vectors/matrices of a rocBLAS function,
+    aggregated over all the calls made with handle while rocblas_check_numerics_mode_stats was set.
+    If the function has not been checked, all the statistics are zero.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    function_name  name of the rocBLAS function, e.g. "rocblas_sgemv"
+    @param[in]
+    is_input    true for the statistics of the Input, false for the statistics of the Output
+    @param[out]
+    stats       pointer to rocblas_check_numerics_stats on the host
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_check_numerics_stats(rocblas_handle handle,
+                                                               const char*    function_name,
+                                                               bool           is_input,
+                                                               rocblas_check_numerics_stats* stats);
+
+/*! \brief clear the statistics gathered by rocblas_check_numerics_mode_stats
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_reset_check_numerics_stats(rocblas_handle handle);
+
+/*! \brief poll for a NaN or an Inf found by rocblas_check_numerics_mode_deferred
+     \details
+    With rocblas_check_numerics_mode_deferred set, rocBLAS functions check their Input and Output
+    vectors/matrices without synchronizing, and record the first NaN or Inf in the handle.
+    rocblas_check_numerics_poll does not synchronize either: it only sees the checks which have completed
+    on the handle's stream, and it returns rocblas_status_continue if some are still running. After the
+    stream has been synchronized, the result of rocblas_check_numerics_poll is final.
+    A reported failure is cleared, so that the next call reports the next failure.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[out]
+    report      pointer to rocblas_check_numerics_report on the host, or NULL.
+                Identifies the first function and operand with a NaN or an Inf.
+    @return     rocblas_status_success if no NaN or Inf was found by the completed checks,
+                rocblas_status_check_numerics_fail if a NaN or an Inf was found,
+                rocblas_status_continue if checks are still running on the handle's stream.
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_check_numerics_poll(rocblas_handle                 handle,
+                                                          rocblas_check_numerics_report* report);
+
 /*! \brief query the preferable supported int8 input layout for gemm
      \details
     Indicates the supported int8 input layout for gemm according to the device.
@@ -108,6 +479,73 @@ ROCBLAS_EXPORT rocblas_status rocblas_get_matrix(rocblas_int rows,
                                                  void*       b,
                                                  rocblas_int ldb);
 
+/*! \brief copy a packed triangular matrix into full storage on the device
+     \details
+    rocblas_unpack copies the upper or lower triangle of an n by n matrix, stored packed column by
+    column in AP as for rocblas_Xspmv and rocblas_Xtpmv, into the same triangle of A. The other
+    triangle of A is not written. The copy is queued on the stream of handle.
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    uplo        [rocblas_fill]
+                rocblas_fill_upper: AP holds the upper triangle
+                rocblas_fill_lower: AP holds the lower triangle
+    @param[in]
+    n           [rocblas_int]
+                number of rows and columns of A
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the matrix
+    @param[in]
+    AP          pointer to the packed matrix on the GPU, of n * (n + 1) / 2 elements
+    @param[out]
+    A           pointer to the full matrix on the GPU
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of A, at least max(1, n)
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_unpack(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             rocblas_int    elem_size,
+                                             const void*    AP,
+                                             void*          A,
+                                             rocblas_int    lda);
+
+/*! \brief copy a triangle of a matrix in full storage into packed storage on the device
+     \details
+    rocblas_pack is the inverse of rocblas_unpack: it copies the upper or lower triangle of the
+    n by n matrix A into AP, packed column by column.
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    uplo        [rocblas_fill]
+                rocblas_fill_upper: the upper triangle of A is packed
+                rocblas_fill_lower: the lower triangle of A is packed
+    @param[in]
+    n           [rocblas_int]
+                number of rows and columns of A
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the matrix
+    @param[in]
+    A           pointer to the full matrix on the GPU
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of A, at least max(1, n)
+    @param[out]
+    AP          pointer to the packed matrix on the GPU, of n * (n + 1) / 2 elements
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_pack(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           rocblas_int    elem_size,
+                                           const void*    A,
+                                           rocblas_int    lda,
+                                           void*          AP);
+
 /*! \brief asynchronously copy vector from host to device
      \details
     rocblas_set_vector_async copies a vector from pinned host memory to device memory asynchronously.
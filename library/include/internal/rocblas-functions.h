@@ -2640,530 +2640,934 @@ ROCBLAS_EXPORT rocblas_status rocblas_drotmg_strided_batched(rocblas_handle hand
                                                              rocblas_stride stride_param,
                                                              rocblas_int    batch_count);
 
-/*
- * ===========================================================================
- *    level 2 BLAS
- * ===========================================================================
- */
-
-ROCBLAS_EXPORT rocblas_status rocblas_sgbmv(rocblas_handle    handle,
-                                            rocblas_operation trans,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            rocblas_int       kl,
-                                            rocblas_int       ku,
-                                            const float*      alpha,
-                                            const float*      A,
-                                            rocblas_int       lda,
-                                            const float*      x,
-                                            rocblas_int       incx,
-                                            const float*      beta,
-                                            float*            y,
-                                            rocblas_int       incy);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dgbmv(rocblas_handle    handle,
-                                            rocblas_operation trans,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            rocblas_int       kl,
-                                            rocblas_int       ku,
-                                            const double*     alpha,
-                                            const double*     A,
-                                            rocblas_int       lda,
-                                            const double*     x,
-                                            rocblas_int       incx,
-                                            const double*     beta,
-                                            double*           y,
-                                            rocblas_int       incy);
-
-ROCBLAS_EXPORT rocblas_status rocblas_cgbmv(rocblas_handle               handle,
-                                            rocblas_operation            trans,
-                                            rocblas_int                  m,
-                                            rocblas_int                  n,
-                                            rocblas_int                  kl,
-                                            rocblas_int                  ku,
-                                            const rocblas_float_complex* alpha,
-                                            const rocblas_float_complex* A,
-                                            rocblas_int                  lda,
-                                            const rocblas_float_complex* x,
-                                            rocblas_int                  incx,
-                                            const rocblas_float_complex* beta,
-                                            rocblas_float_complex*       y,
-                                            rocblas_int                  incy);
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_nrm2(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const float*   x,
+                                                rocblas_int    incx,
+                                                const float*   y,
+                                                rocblas_int    incy,
+                                                float*         dot_result,
+                                                float*         nrm2_result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_nrm2(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const double*  x,
+                                                rocblas_int    incx,
+                                                const double*  y,
+                                                rocblas_int    incy,
+                                                double*        dot_result,
+                                                double*        nrm2_result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc_nrm2(rocblas_handle               handle,
+                                                 rocblas_int                  n,
+                                                 const rocblas_float_complex* x,
+                                                 rocblas_int                  incx,
+                                                 const rocblas_float_complex* y,
+                                                 rocblas_int                  incy,
+                                                 rocblas_float_complex*       dot_result,
+                                                 float*                       nrm2_result);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    xGBMV performs one of the matrix-vector operations
+    dot_nrm2 computes the dot product of vectors x and y and the euclidean norm of x
+              in a single pass over x and y
 
-        y := alpha*A*x    + beta*y,   or
-        y := alpha*A**T*x + beta*y,   or
-        y := alpha*A**H*x + beta*y,
+        dot_result  := x^T * y  (x^H * y for complex dotc_nrm2)
+        nrm2_result := sqrt( x^H * x )
 
-    where alpha and beta are scalars, x and y are vectors and A is an
-    m by n banded matrix with kl sub-diagonals and ku super-diagonals.
+              This is cheaper than calling dot and nrm2 separately because x is read once.
+              Both results are reduced in the same order as the reproducible dot and nrm2 when
+              the handle is in rocblas_reduction_reproducible mode.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
-    trans     [rocblas_operation]
-              indicates whether matrix A is tranposed (conjugated) or not
-    @param[in]
-    m         [rocblas_int]
-              number of rows of matrix A
-    @param[in]
     n         [rocblas_int]
-              number of columns of matrix A
-    @param[in]
-    kl        [rocblas_int]
-              number of sub-diagonals of A
-    @param[in]
-    ku        [rocblas_int]
-              number of super-diagonals of A
-    @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
-    @param[in]
-        A     device pointer storing banded matrix A.
-              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
-              of the banded matrix. The leading diagonal resides in row (ku + 1) with
-              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
-              resides below on the LHS of row ku + 2. This propogates up and down across
-              sub/super-diagonals.
-                Ex: (m = n = 7; ku = 2, kl = 2)
-                1 2 3 0 0 0 0             0 0 3 3 3 3 3
-                4 1 2 3 0 0 0             0 2 2 2 2 2 2
-                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
-                0 5 4 1 2 3 0             4 4 4 4 4 4 0
-                0 0 5 4 1 2 0             5 5 5 5 5 0 0
-                0 0 0 5 4 1 2             0 0 0 0 0 0 0
-                0 0 0 0 5 4 1             0 0 0 0 0 0 0
-              Note that the empty elements which don't correspond to data will not
-              be referenced.
-    @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of A. Must be >= (kl + ku + 1)
+              the number of elements in x and y.
     @param[in]
     x         device pointer storing vector x.
     @param[in]
     incx      [rocblas_int]
               specifies the increment for the elements of x.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
-    @param[inout]
     y         device pointer storing vector y.
     @param[in]
     incy      [rocblas_int]
               specifies the increment for the elements of y.
+    @param[inout]
+    dot_result
+              device pointer or host pointer to store the dot product.
+              return 0.0 if n <= 0.
+    @param[inout]
+    nrm2_result
+              device pointer or host pointer to store the euclidean norm.
+              return 0.0 if n <= 0.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zgbmv(rocblas_handle                handle,
-                                            rocblas_operation             trans,
-                                            rocblas_int                   m,
-                                            rocblas_int                   n,
-                                            rocblas_int                   kl,
-                                            rocblas_int                   ku,
-                                            const rocblas_double_complex* alpha,
-                                            const rocblas_double_complex* A,
-                                            rocblas_int                   lda,
-                                            const rocblas_double_complex* x,
-                                            rocblas_int                   incx,
-                                            const rocblas_double_complex* beta,
-                                            rocblas_double_complex*       y,
-                                            rocblas_int                   incy);
-
-ROCBLAS_EXPORT rocblas_status rocblas_sgbmv_batched(rocblas_handle     handle,
-                                                    rocblas_operation  trans,
-                                                    rocblas_int        m,
-                                                    rocblas_int        n,
-                                                    rocblas_int        kl,
-                                                    rocblas_int        ku,
-                                                    const float*       alpha,
-                                                    const float* const A[],
-                                                    rocblas_int        lda,
-                                                    const float* const x[],
-                                                    rocblas_int        incx,
-                                                    const float*       beta,
-                                                    float* const       y[],
-                                                    rocblas_int        incy,
-                                                    rocblas_int        batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dgbmv_batched(rocblas_handle      handle,
-                                                    rocblas_operation   trans,
-                                                    rocblas_int         m,
-                                                    rocblas_int         n,
-                                                    rocblas_int         kl,
-                                                    rocblas_int         ku,
-                                                    const double*       alpha,
-                                                    const double* const A[],
-                                                    rocblas_int         lda,
-                                                    const double* const x[],
-                                                    rocblas_int         incx,
-                                                    const double*       beta,
-                                                    double* const       y[],
-                                                    rocblas_int         incy,
-                                                    rocblas_int         batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cgbmv_batched(rocblas_handle                     handle,
-                                                    rocblas_operation                  trans,
-                                                    rocblas_int                        m,
-                                                    rocblas_int                        n,
-                                                    rocblas_int                        kl,
-                                                    rocblas_int                        ku,
-                                                    const rocblas_float_complex*       alpha,
-                                                    const rocblas_float_complex* const A[],
-                                                    rocblas_int                        lda,
-                                                    const rocblas_float_complex* const x[],
-                                                    rocblas_int                        incx,
-                                                    const rocblas_float_complex*       beta,
-                                                    rocblas_float_complex* const       y[],
-                                                    rocblas_int                        incy,
-                                                    rocblas_int                        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc_nrm2(rocblas_handle                handle,
+                                                 rocblas_int                   n,
+                                                 const rocblas_double_complex* x,
+                                                 rocblas_int                   incx,
+                                                 const rocblas_double_complex* y,
+                                                 rocblas_int                   incy,
+                                                 rocblas_double_complex*       dot_result,
+                                                 double*                       nrm2_result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_nrm2_batched(rocblas_handle     handle,
+                                                        rocblas_int        n,
+                                                        const float* const x[],
+                                                        rocblas_int        incx,
+                                                        const float* const y[],
+                                                        rocblas_int        incy,
+                                                        rocblas_int        batch_count,
+                                                        float*             dot_results,
+                                                        float*             nrm2_results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_nrm2_batched(rocblas_handle      handle,
+                                                        rocblas_int         n,
+                                                        const double* const x[],
+                                                        rocblas_int         incx,
+                                                        const double* const y[],
+                                                        rocblas_int         incy,
+                                                        rocblas_int         batch_count,
+                                                        double*             dot_results,
+                                                        double*             nrm2_results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc_nrm2_batched(rocblas_handle                     handle,
+                                                         rocblas_int                        n,
+                                                         const rocblas_float_complex* const x[],
+                                                         rocblas_int                        incx,
+                                                         const rocblas_float_complex* const y[],
+                                                         rocblas_int                        incy,
+                                                         rocblas_int            batch_count,
+                                                         rocblas_float_complex* dot_results,
+                                                         float*                 nrm2_results);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    xGBMV_BATCHED performs one of the matrix-vector operations
+    dot_nrm2_batched computes the dot product of vectors x_i and y_i and the euclidean norm of x_i
+              in a single pass over x_i and y_i
 
-        y_i := alpha*A_i*x_i    + beta*y_i,   or
-        y_i := alpha*A_i**T*x_i + beta*y_i,   or
-        y_i := alpha*A_i**H*x_i + beta*y_i,
+        dot_result_i  := x_i^T * y_i  (x_i^H * y_i for complex dotc_nrm2)
+        nrm2_result_i := sqrt( x_i^H * x_i )
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    m by n banded matrix with kl sub-diagonals and ku super-diagonals,
-    for i = 1, ..., batch_count.
+              This is cheaper than calling dot and nrm2 separately because x_i is read once.
+              Both results are reduced in the same order as the reproducible dot and nrm2 when
+              the handle is in rocblas_reduction_reproducible mode.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
-    trans     [rocblas_operation]
-              indicates whether matrix A is tranposed (conjugated) or not
+    n         [rocblas_int]
+              the number of elements in each x_i and y_i.
     @param[in]
-    m         [rocblas_int]
-              number of rows of each matrix A_i
+    x         device array of device pointers storing each vector x_i.
     @param[in]
-    n         [rocblas_int]
-              number of columns of each matrix A_i
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
     @param[in]
-    kl        [rocblas_int]
-              number of sub-diagonals of each A_i
+    y         device array of device pointers storing each vector y_i.
     @param[in]
-    ku        [rocblas_int]
-              number of super-diagonals of each A_i
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
     @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
+    batch_count [rocblas_int]
+                number of instances in the batch
+    @param[inout]
+    dot_results
+              device pointer or host pointer to store the dot product of each instance, batch_count elements.
+              return 0.0 if n <= 0.
+    @param[inout]
+    nrm2_results
+              device pointer or host pointer to store the euclidean norm of each x_i, batch_count elements.
+              return 0.0 if n <= 0.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc_nrm2_batched(rocblas_handle          handle,
+                                                         rocblas_int                         n,
+                                                         const rocblas_double_complex* const x[],
+                                                         rocblas_int                         incx,
+                                                         const rocblas_double_complex* const y[],
+                                                         rocblas_int                         incy,
+                                                         rocblas_int             batch_count,
+                                                         rocblas_double_complex* dot_results,
+                                                         double*                 nrm2_results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_nrm2_strided_batched(rocblas_handle handle,
+                                                                rocblas_int    n,
+                                                                const float*   x,
+                                                                rocblas_int    incx,
+                                                                rocblas_stride stridex,
+                                                                const float*   y,
+                                                                rocblas_int    incy,
+                                                                rocblas_stride stridey,
+                                                                rocblas_int    batch_count,
+                                                                float*         dot_results,
+                                                                float*         nrm2_results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_nrm2_strided_batched(rocblas_handle handle,
+                                                                rocblas_int    n,
+                                                                const double*  x,
+                                                                rocblas_int    incx,
+                                                                rocblas_stride stridex,
+                                                                const double*  y,
+                                                                rocblas_int    incy,
+                                                                rocblas_stride stridey,
+                                                                rocblas_int    batch_count,
+                                                                double*        dot_results,
+                                                                double*        nrm2_results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cdotc_nrm2_strided_batched(rocblas_handle         handle,
+                                                                 rocblas_int                  n,
+                                                                 const rocblas_float_complex* x,
+                                                                 rocblas_int                  incx,
+                                                                 rocblas_stride         stridex,
+                                                                 const rocblas_float_complex* y,
+                                                                 rocblas_int                  incy,
+                                                                 rocblas_stride         stridey,
+                                                                 rocblas_int            batch_count,
+                                                                 rocblas_float_complex* dot_results,
+                                                                 float*                 nrm2_results);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    dot_nrm2_strided_batched computes the dot product of vectors x_i and y_i and the euclidean norm of x_i
+              in a single pass over x_i and y_i
+
+        dot_result_i  := x_i^T * y_i  (x_i^H * y_i for complex dotc_nrm2)
+        nrm2_result_i := sqrt( x_i^H * x_i )
+
+              This is cheaper than calling dot and nrm2 separately because x_i is read once.
+              Both results are reduced in the same order as the reproducible dot and nrm2 when
+              the handle is in rocblas_reduction_reproducible mode.
+
     @param[in]
-        A     device array of device pointers storing each banded matrix A_i.
-              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
-              of the banded matrix. The leading diagonal resides in row (ku + 1) with
-              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
-              resides below on the LHS of row ku + 2. This propogates up and down across
-              sub/super-diagonals.
-                Ex: (m = n = 7; ku = 2, kl = 2)
-                1 2 3 0 0 0 0             0 0 3 3 3 3 3
-                4 1 2 3 0 0 0             0 2 2 2 2 2 2
-                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
-                0 5 4 1 2 3 0             4 4 4 4 4 4 0
-                0 0 5 4 1 2 0             5 5 5 5 5 0 0
-                0 0 0 5 4 1 2             0 0 0 0 0 0 0
-                0 0 0 0 5 4 1             0 0 0 0 0 0 0
-              Note that the empty elements which don't correspond to data will not
-              be referenced.
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
     @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of each A_i. Must be >= (kl + ku + 1)
+    n         [rocblas_int]
+              the number of elements in each x_i and y_i.
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    x         device pointer to the first vector (x_1) in the batch.
     @param[in]
     incx      [rocblas_int]
               specifies the increment for the elements of each x_i.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
-    @param[inout]
-    y         device array of device pointers storing each vector y_i.
+    stridex   [rocblas_stride]
+              stride from the start of one vector (x_i) and the next one (x_i+1)
+    @param[in]
+    y         device pointer to the first vector (y_1) in the batch.
     @param[in]
     incy      [rocblas_int]
               specifies the increment for the elements of each y_i.
     @param[in]
+    stridey   [rocblas_stride]
+              stride from the start of one vector (y_i) and the next one (y_i+1)
+    @param[in]
     batch_count [rocblas_int]
-                specifies the number of instances in the batch.
+                number of instances in the batch
+    @param[inout]
+    dot_results
+              device pointer or host pointer to store the dot product of each instance, batch_count elements.
+              return 0.0 if n <= 0.
+    @param[inout]
+    nrm2_results
+              device pointer or host pointer to store the euclidean norm of each x_i, batch_count elements.
+              return 0.0 if n <= 0.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zgbmv_batched(rocblas_handle                      handle,
-                                                    rocblas_operation                   trans,
-                                                    rocblas_int                         m,
-                                                    rocblas_int                         n,
-                                                    rocblas_int                         kl,
-                                                    rocblas_int                         ku,
-                                                    const rocblas_double_complex*       alpha,
-                                                    const rocblas_double_complex* const A[],
-                                                    rocblas_int                         lda,
-                                                    const rocblas_double_complex* const x[],
-                                                    rocblas_int                         incx,
-                                                    const rocblas_double_complex*       beta,
-                                                    rocblas_double_complex* const       y[],
-                                                    rocblas_int                         incy,
-                                                    rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_sgbmv_strided_batched(rocblas_handle    handle,
-                                                            rocblas_operation trans,
-                                                            rocblas_int       m,
-                                                            rocblas_int       n,
-                                                            rocblas_int       kl,
-                                                            rocblas_int       ku,
-                                                            const float*      alpha,
-                                                            const float*      A,
-                                                            rocblas_int       lda,
-                                                            rocblas_stride    stride_A,
-                                                            const float*      x,
-                                                            rocblas_int       incx,
-                                                            rocblas_stride    stride_x,
-                                                            const float*      beta,
-                                                            float*            y,
-                                                            rocblas_int       incy,
-                                                            rocblas_stride    stride_y,
-                                                            rocblas_int       batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dgbmv_strided_batched(rocblas_handle    handle,
-                                                            rocblas_operation trans,
-                                                            rocblas_int       m,
-                                                            rocblas_int       n,
-                                                            rocblas_int       kl,
-                                                            rocblas_int       ku,
-                                                            const double*     alpha,
-                                                            const double*     A,
-                                                            rocblas_int       lda,
-                                                            rocblas_stride    stride_A,
-                                                            const double*     x,
-                                                            rocblas_int       incx,
-                                                            rocblas_stride    stride_x,
-                                                            const double*     beta,
-                                                            double*           y,
-                                                            rocblas_int       incy,
-                                                            rocblas_stride    stride_y,
-                                                            rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cgbmv_strided_batched(rocblas_handle               handle,
-                                                            rocblas_operation            trans,
-                                                            rocblas_int                  m,
-                                                            rocblas_int                  n,
-                                                            rocblas_int                  kl,
-                                                            rocblas_int                  ku,
-                                                            const rocblas_float_complex* alpha,
-                                                            const rocblas_float_complex* A,
-                                                            rocblas_int                  lda,
-                                                            rocblas_stride               stride_A,
-                                                            const rocblas_float_complex* x,
-                                                            rocblas_int                  incx,
-                                                            rocblas_stride               stride_x,
-                                                            const rocblas_float_complex* beta,
-                                                            rocblas_float_complex*       y,
-                                                            rocblas_int                  incy,
-                                                            rocblas_stride               stride_y,
-                                                            rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zdotc_nrm2_strided_batched(rocblas_handle          handle,
+                                                                 rocblas_int                   n,
+                                                                 const rocblas_double_complex* x,
+                                                                 rocblas_int             incx,
+                                                                 rocblas_stride          stridex,
+                                                                 const rocblas_double_complex* y,
+                                                                 rocblas_int             incy,
+                                                                 rocblas_stride          stridey,
+                                                                 rocblas_int             batch_count,
+                                                                 rocblas_double_complex* dot_results,
+                                                                 double*                 nrm2_results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const float*   alpha,
+                                                const float*   x,
+                                                rocblas_int    incx,
+                                                float*         y,
+                                                rocblas_int    incy,
+                                                const float*   z,
+                                                rocblas_int    incz,
+                                                float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const double*  alpha,
+                                                const double*  x,
+                                                rocblas_int    incx,
+                                                double*        y,
+                                                rocblas_int    incy,
+                                                const double*  z,
+                                                rocblas_int    incz,
+                                                double*        result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_dotc(rocblas_handle               handle,
+                                                 rocblas_int                  n,
+                                                 const rocblas_float_complex* alpha,
+                                                 const rocblas_float_complex* x,
+                                                 rocblas_int                  incx,
+                                                 rocblas_float_complex*       y,
+                                                 rocblas_int                  incy,
+                                                 const rocblas_float_complex* z,
+                                                 rocblas_int                  incz,
+                                                 rocblas_float_complex*       result);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    xGBMV_STRIDED_BATCHED performs one of the matrix-vector operations
+    axpy_dot updates y with alpha * x and returns the dot product of the updated y with z
+              in a single pass over x, y and z
 
-        y_i := alpha*A_i*x_i    + beta*y_i,   or
-        y_i := alpha*A_i**T*x_i + beta*y_i,   or
-        y_i := alpha*A_i**H*x_i + beta*y_i,
+        y      := alpha * x + y
+        result := y^T * z  (y^H * z for complex axpy_dotc)
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    m by n banded matrix with kl sub-diagonals and ku super-diagonals,
-    for i = 1, ..., batch_count.
+              This saves one read of y compared to calling axpy and then dot.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
-    trans     [rocblas_operation]
-              indicates whether matrix A is tranposed (conjugated) or not
-    @param[in]
-    m         [rocblas_int]
-              number of rows of matrix A
-    @param[in]
     n         [rocblas_int]
-              number of columns of matrix A
+              the number of elements in x, y and z.
     @param[in]
-    kl        [rocblas_int]
-              number of sub-diagonals of A
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
-    ku        [rocblas_int]
-              number of super-diagonals of A
+    x         device pointer storing vector x.
     @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    y         device pointer storing vector y.
     @param[in]
-        A     device pointer to first banded matrix (A_1).
-              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
-              of the banded matrix. The leading diagonal resides in row (ku + 1) with
-              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
-              resides below on the LHS of row ku + 2. This propogates up and down across
-              sub/super-diagonals.
-                Ex: (m = n = 7; ku = 2, kl = 2)
-                1 2 3 0 0 0 0             0 0 3 3 3 3 3
-                4 1 2 3 0 0 0             0 2 2 2 2 2 2
-                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
-                0 5 4 1 2 3 0             4 4 4 4 4 4 0
-                0 0 5 4 1 2 0             5 5 5 5 5 0 0
-                0 0 0 5 4 1 2             0 0 0 0 0 0 0
-                0 0 0 0 5 4 1             0 0 0 0 0 0 0
-              Note that the empty elements which don't correspond to data will not
-              be referenced.
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
     @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of A. Must be >= (kl + ku + 1)
+    z         device pointer storing vector z.
     @param[in]
-    stride_A  [rocblas_stride]
-              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    incz      [rocblas_int]
+              specifies the increment for the elements of z.
+    @param[inout]
+    result
+              device pointer or host pointer to store the dot product.
+              return 0.0 if n <= 0.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_dotc(rocblas_handle                handle,
+                                                 rocblas_int                   n,
+                                                 const rocblas_double_complex* alpha,
+                                                 const rocblas_double_complex* x,
+                                                 rocblas_int                   incx,
+                                                 rocblas_double_complex*       y,
+                                                 rocblas_int                   incy,
+                                                 const rocblas_double_complex* z,
+                                                 rocblas_int                   incz,
+                                                 rocblas_double_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot_batched(rocblas_handle     handle,
+                                                        rocblas_int        n,
+                                                        const float*       alpha,
+                                                        const float* const x[],
+                                                        rocblas_int        incx,
+                                                        float* const       y[],
+                                                        rocblas_int        incy,
+                                                        const float* const z[],
+                                                        rocblas_int        incz,
+                                                        rocblas_int        batch_count,
+                                                        float*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot_batched(rocblas_handle      handle,
+                                                        rocblas_int         n,
+                                                        const double*       alpha,
+                                                        const double* const x[],
+                                                        rocblas_int         incx,
+                                                        double* const       y[],
+                                                        rocblas_int         incy,
+                                                        const double* const z[],
+                                                        rocblas_int         incz,
+                                                        rocblas_int         batch_count,
+                                                        double*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_dotc_batched(rocblas_handle                     handle,
+                                                         rocblas_int                        n,
+                                                         const rocblas_float_complex*       alpha,
+                                                         const rocblas_float_complex* const x[],
+                                                         rocblas_int                        incx,
+                                                         rocblas_float_complex* const       y[],
+                                                         rocblas_int                        incy,
+                                                         const rocblas_float_complex* const z[],
+                                                         rocblas_int                        incz,
+                                                         rocblas_int            batch_count,
+                                                         rocblas_float_complex* results);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    axpy_dot_batched updates y_i with alpha * x_i and returns the dot product of the updated y_i with z_i
+              in a single pass over x_i, y_i and z_i
+
+        y_i      := alpha * x_i + y_i
+        result_i := y_i^T * z_i  (y_i^H * z_i for complex axpy_dotc)
+
+              This saves one read of y_i compared to calling axpy and then dot.
+
     @param[in]
-    x         device pointer to first vector (x_1).
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
     @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of x.
+    n         [rocblas_int]
+              the number of elements in each x_i, y_i and z_i.
     @param[in]
-    stride_x  [rocblas_stride]
-              stride from the start of one vector (x_i) and the next one (x_i+1)
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
     @param[inout]
-    y         device pointer to first vector (y_1).
+    y         device array of device pointers storing each vector y_i.
     @param[in]
     incy      [rocblas_int]
-              specifies the increment for the elements of y.
+              specifies the increment for the elements of each y_i.
     @param[in]
-    stride_y  [rocblas_stride]
-              stride from the start of one vector (y_i) and the next one (x_i+1)
+    z         device array of device pointers storing each vector z_i.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of each z_i.
     @param[in]
     batch_count [rocblas_int]
-                specifies the number of instances in the batch.
+                number of instances in the batch
+    @param[inout]
+    results
+              device pointer or host pointer to store the dot product of each instance, batch_count elements.
+              return 0.0 if n <= 0.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zgbmv_strided_batched(rocblas_handle                handle,
-                                                            rocblas_operation             trans,
-                                                            rocblas_int                   m,
-                                                            rocblas_int                   n,
-                                                            rocblas_int                   kl,
-                                                            rocblas_int                   ku,
-                                                            const rocblas_double_complex* alpha,
-                                                            const rocblas_double_complex* A,
-                                                            rocblas_int                   lda,
-                                                            rocblas_stride                stride_A,
-                                                            const rocblas_double_complex* x,
-                                                            rocblas_int                   incx,
-                                                            rocblas_stride                stride_x,
-                                                            const rocblas_double_complex* beta,
-                                                            rocblas_double_complex*       y,
-                                                            rocblas_int                   incy,
-                                                            rocblas_stride                stride_y,
-                                                            rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_sgemv(rocblas_handle    handle,
-                                            rocblas_operation trans,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            const float*      alpha,
-                                            const float*      A,
-                                            rocblas_int       lda,
-                                            const float*      x,
-                                            rocblas_int       incx,
-                                            const float*      beta,
-                                            float*            y,
-                                            rocblas_int       incy);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dgemv(rocblas_handle    handle,
-                                            rocblas_operation trans,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            const double*     alpha,
-                                            const double*     A,
-                                            rocblas_int       lda,
-                                            const double*     x,
-                                            rocblas_int       incx,
-                                            const double*     beta,
-                                            double*           y,
-                                            rocblas_int       incy);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cgemv(rocblas_handle               handle,
-                                            rocblas_operation            trans,
-                                            rocblas_int                  m,
-                                            rocblas_int                  n,
-                                            const rocblas_float_complex* alpha,
-                                            const rocblas_float_complex* A,
-                                            rocblas_int                  lda,
-                                            const rocblas_float_complex* x,
-                                            rocblas_int                  incx,
-                                            const rocblas_float_complex* beta,
-                                            rocblas_float_complex*       y,
-                                            rocblas_int                  incy);
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_dotc_batched(rocblas_handle          handle,
+                                                         rocblas_int                         n,
+                                                         const rocblas_double_complex*       alpha,
+                                                         const rocblas_double_complex* const x[],
+                                                         rocblas_int                         incx,
+                                                         rocblas_double_complex* const       y[],
+                                                         rocblas_int                         incy,
+                                                         const rocblas_double_complex* const z[],
+                                                         rocblas_int                         incz,
+                                                         rocblas_int             batch_count,
+                                                         rocblas_double_complex* results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot_strided_batched(rocblas_handle handle,
+                                                                rocblas_int    n,
+                                                                const float*   alpha,
+                                                                const float*   x,
+                                                                rocblas_int    incx,
+                                                                rocblas_stride stridex,
+                                                                float*         y,
+                                                                rocblas_int    incy,
+                                                                rocblas_stride stridey,
+                                                                const float*   z,
+                                                                rocblas_int    incz,
+                                                                rocblas_stride stridez,
+                                                                rocblas_int    batch_count,
+                                                                float*         results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot_strided_batched(rocblas_handle handle,
+                                                                rocblas_int    n,
+                                                                const double*  alpha,
+                                                                const double*  x,
+                                                                rocblas_int    incx,
+                                                                rocblas_stride stridex,
+                                                                double*        y,
+                                                                rocblas_int    incy,
+                                                                rocblas_stride stridey,
+                                                                const double*  z,
+                                                                rocblas_int    incz,
+                                                                rocblas_stride stridez,
+                                                                rocblas_int    batch_count,
+                                                                double*        results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_dotc_strided_batched(rocblas_handle               handle,
+                                                                 rocblas_int                  n,
+                                                                 const rocblas_float_complex* alpha,
+                                                                 const rocblas_float_complex* x,
+                                                                 rocblas_int                  incx,
+                                                                 rocblas_stride               stridex,
+                                                                 rocblas_float_complex*       y,
+                                                                 rocblas_int                  incy,
+                                                                 rocblas_stride               stridey,
+                                                                 const rocblas_float_complex* z,
+                                                                 rocblas_int                  incz,
+                                                                 rocblas_stride               stridez,
+                                                                 rocblas_int                  batch_count,
+                                                                 rocblas_float_complex*       results);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    xGEMV performs one of the matrix-vector operations
+    axpy_dot_strided_batched updates y_i with alpha * x_i and returns the dot product of the updated y_i with z_i
+              in a single pass over x_i, y_i and z_i
 
-        y := alpha*A*x    + beta*y,   or
-        y := alpha*A**T*x + beta*y,   or
-        y := alpha*A**H*x + beta*y,
+        y_i      := alpha * x_i + y_i
+        result_i := y_i^T * z_i  (y_i^H * z_i for complex axpy_dotc)
 
-    where alpha and beta are scalars, x and y are vectors and A is an
-    m by n matrix.
+              This saves one read of y_i compared to calling axpy and then dot.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
-    trans     [rocblas_operation]
-              indicates whether matrix A is tranposed (conjugated) or not
-    @param[in]
-    m         [rocblas_int]
-              number of rows of matrix A
-    @param[in]
     n         [rocblas_int]
-              number of columns of matrix A
-    @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
-    @param[in]
-    A         device pointer storing matrix A.
+              the number of elements in each x_i, y_i and z_i.
     @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of A.
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
-    x         device pointer storing vector x.
+    x         device pointer to the first vector (x_1) in the batch.
     @param[in]
     incx      [rocblas_int]
-              specifies the increment for the elements of x.
+              specifies the increment for the elements of each x_i.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
+    stridex   [rocblas_stride]
+              stride from the start of one vector (x_i) and the next one (x_i+1)
     @param[inout]
-    y         device pointer storing vector y.
+    y         device pointer to the first vector (y_1) in the batch.
     @param[in]
     incy      [rocblas_int]
-              specifies the increment for the elements of y.
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey   [rocblas_stride]
+              stride from the start of one vector (y_i) and the next one (y_i+1)
+    @param[in]
+    z         device pointer to the first vector (z_1) in the batch.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of each z_i.
+    @param[in]
+    stridez   [rocblas_stride]
+              stride from the start of one vector (z_i) and the next one (z_i+1)
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch
+    @param[inout]
+    results
+              device pointer or host pointer to store the dot product of each instance, batch_count elements.
+              return 0.0 if n <= 0.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zgemv(rocblas_handle                handle,
-                                            rocblas_operation             trans,
-                                            rocblas_int                   m,
-                                            rocblas_int                   n,
-                                            const rocblas_double_complex* alpha,
-                                            const rocblas_double_complex* A,
-                                            rocblas_int                   lda,
-                                            const rocblas_double_complex* x,
-                                            rocblas_int                   incx,
-                                            const rocblas_double_complex* beta,
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_dotc_strided_batched(rocblas_handle                handle,
+                                                                 rocblas_int                   n,
+                                                                 const rocblas_double_complex* alpha,
+                                                                 const rocblas_double_complex* x,
+                                                                 rocblas_int                   incx,
+                                                                 rocblas_stride                stridex,
+                                                                 rocblas_double_complex*       y,
+                                                                 rocblas_int                   incy,
+                                                                 rocblas_stride                stridey,
+                                                                 const rocblas_double_complex* z,
+                                                                 rocblas_int                   incz,
+                                                                 rocblas_stride                stridez,
+                                                                 rocblas_int                   batch_count,
+                                                                 rocblas_double_complex*       results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_nrm2(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 const float*   alpha,
+                                                 const float*   x,
+                                                 rocblas_int    incx,
+                                                 float*         y,
+                                                 rocblas_int    incy,
+                                                 float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_nrm2(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 const double*  alpha,
+                                                 const double*  x,
+                                                 rocblas_int    incx,
+                                                 double*        y,
+                                                 rocblas_int    incy,
+                                                 double*        result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_nrm2(rocblas_handle               handle,
+                                                 rocblas_int                  n,
+                                                 const rocblas_float_complex* alpha,
+                                                 const rocblas_float_complex* x,
+                                                 rocblas_int                  incx,
+                                                 rocblas_float_complex*       y,
+                                                 rocblas_int                  incy,
+                                                 float*                       result);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    axpy_nrm2 updates y with alpha * x and returns the euclidean norm of the updated y
+              in a single pass over x and y
+
+        y      := alpha * x + y
+        result := sqrt( y^H * y )
+
+              This saves one read of y compared to calling axpy and then nrm2.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and y.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    result
+              device pointer or host pointer to store the euclidean norm.
+              return 0.0 if n <= 0.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_nrm2(rocblas_handle                handle,
+                                                 rocblas_int                   n,
+                                                 const rocblas_double_complex* alpha,
+                                                 const rocblas_double_complex* x,
+                                                 rocblas_int                   incx,
+                                                 rocblas_double_complex*       y,
+                                                 rocblas_int                   incy,
+                                                 double*                       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_nrm2_batched(rocblas_handle     handle,
+                                                         rocblas_int        n,
+                                                         const float*       alpha,
+                                                         const float* const x[],
+                                                         rocblas_int        incx,
+                                                         float* const       y[],
+                                                         rocblas_int        incy,
+                                                         rocblas_int        batch_count,
+                                                         float*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_nrm2_batched(rocblas_handle      handle,
+                                                         rocblas_int         n,
+                                                         const double*       alpha,
+                                                         const double* const x[],
+                                                         rocblas_int         incx,
+                                                         double* const       y[],
+                                                         rocblas_int         incy,
+                                                         rocblas_int         batch_count,
+                                                         double*             results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_nrm2_batched(rocblas_handle                     handle,
+                                                         rocblas_int                        n,
+                                                         const rocblas_float_complex*       alpha,
+                                                         const rocblas_float_complex* const x[],
+                                                         rocblas_int                        incx,
+                                                         rocblas_float_complex* const       y[],
+                                                         rocblas_int                        incy,
+                                                         rocblas_int batch_count,
+                                                         float*      results);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    axpy_nrm2_batched updates y_i with alpha * x_i and returns the euclidean norm of the updated y_i
+              in a single pass over x_i and y_i
+
+        y_i      := alpha * x_i + y_i
+        result_i := sqrt( y_i^H * y_i )
+
+              This saves one read of y_i compared to calling axpy and then nrm2.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each x_i and y_i.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[inout]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch
+    @param[inout]
+    results
+              device pointer or host pointer to store the euclidean norm of each y_i, batch_count elements.
+              return 0.0 if n <= 0.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_nrm2_batched(rocblas_handle handle,
+                                                         rocblas_int                         n,
+                                                         const rocblas_double_complex*       alpha,
+                                                         const rocblas_double_complex* const x[],
+                                                         rocblas_int                         incx,
+                                                         rocblas_double_complex* const       y[],
+                                                         rocblas_int                         incy,
+                                                         rocblas_int    batch_count,
+                                                         double*        results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_nrm2_strided_batched(rocblas_handle handle,
+                                                                 rocblas_int    n,
+                                                                 const float*   alpha,
+                                                                 const float*   x,
+                                                                 rocblas_int    incx,
+                                                                 rocblas_stride stridex,
+                                                                 float*         y,
+                                                                 rocblas_int    incy,
+                                                                 rocblas_stride stridey,
+                                                                 rocblas_int    batch_count,
+                                                                 float*         results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_nrm2_strided_batched(rocblas_handle handle,
+                                                                 rocblas_int    n,
+                                                                 const double*  alpha,
+                                                                 const double*  x,
+                                                                 rocblas_int    incx,
+                                                                 rocblas_stride stridex,
+                                                                 double*        y,
+                                                                 rocblas_int    incy,
+                                                                 rocblas_stride stridey,
+                                                                 rocblas_int    batch_count,
+                                                                 double*        results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_nrm2_strided_batched(rocblas_handle               handle,
+                                                                 rocblas_int                  n,
+                                                                 const rocblas_float_complex* alpha,
+                                                                 const rocblas_float_complex* x,
+                                                                 rocblas_int                  incx,
+                                                                 rocblas_stride               stridex,
+                                                                 rocblas_float_complex*       y,
+                                                                 rocblas_int                  incy,
+                                                                 rocblas_stride               stridey,
+                                                                 rocblas_int                  batch_count,
+                                                                 float*                       results);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    axpy_nrm2_strided_batched updates y_i with alpha * x_i and returns the euclidean norm of the updated y_i
+              in a single pass over x_i and y_i
+
+        y_i      := alpha * x_i + y_i
+        result_i := sqrt( y_i^H * y_i )
+
+              This saves one read of y_i compared to calling axpy and then nrm2.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each x_i and y_i.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device pointer to the first vector (x_1) in the batch.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   [rocblas_stride]
+              stride from the start of one vector (x_i) and the next one (x_i+1)
+    @param[inout]
+    y         device pointer to the first vector (y_1) in the batch.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey   [rocblas_stride]
+              stride from the start of one vector (y_i) and the next one (y_i+1)
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch
+    @param[inout]
+    results
+              device pointer or host pointer to store the euclidean norm of each y_i, batch_count elements.
+              return 0.0 if n <= 0.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_nrm2_strided_batched(rocblas_handle                handle,
+                                                                 rocblas_int                   n,
+                                                                 const rocblas_double_complex* alpha,
+                                                                 const rocblas_double_complex* x,
+                                                                 rocblas_int                   incx,
+                                                                 rocblas_stride                stridex,
+                                                                 rocblas_double_complex*       y,
+                                                                 rocblas_int                   incy,
+                                                                 rocblas_stride                stridey,
+                                                                 rocblas_int                   batch_count,
+                                                                 double*                       results);
+
+/*
+ * ===========================================================================
+ *    level 2 BLAS
+ * ===========================================================================
+ */
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgbmv(rocblas_handle    handle,
+                                            rocblas_operation trans,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       kl,
+                                            rocblas_int       ku,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            const float*      x,
+                                            rocblas_int       incx,
+                                            const float*      beta,
+                                            float*            y,
+                                            rocblas_int       incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgbmv(rocblas_handle    handle,
+                                            rocblas_operation trans,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       kl,
+                                            rocblas_int       ku,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            const double*     x,
+                                            rocblas_int       incx,
+                                            const double*     beta,
+                                            double*           y,
+                                            rocblas_int       incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgbmv(rocblas_handle               handle,
+                                            rocblas_operation            trans,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            rocblas_int                  kl,
+                                            rocblas_int                  ku,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex*       y,
+                                            rocblas_int                  incy);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGBMV performs one of the matrix-vector operations
+
+        y := alpha*A*x    + beta*y,   or
+        y := alpha*A**T*x + beta*y,   or
+        y := alpha*A**H*x + beta*y,
+
+    where alpha and beta are scalars, x and y are vectors and A is an
+    m by n banded matrix with kl sub-diagonals and ku super-diagonals.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans     [rocblas_operation]
+              indicates whether matrix A is tranposed (conjugated) or not
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrix A
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrix A
+    @param[in]
+    kl        [rocblas_int]
+              number of sub-diagonals of A
+    @param[in]
+    ku        [rocblas_int]
+              number of super-diagonals of A
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+        A     device pointer storing banded matrix A.
+              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
+              of the banded matrix. The leading diagonal resides in row (ku + 1) with
+              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
+              resides below on the LHS of row ku + 2. This propogates up and down across
+              sub/super-diagonals.
+                Ex: (m = n = 7; ku = 2, kl = 2)
+                1 2 3 0 0 0 0             0 0 3 3 3 3 3
+                4 1 2 3 0 0 0             0 2 2 2 2 2 2
+                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
+                0 5 4 1 2 3 0             4 4 4 4 4 4 0
+                0 0 5 4 1 2 0             5 5 5 5 5 0 0
+                0 0 0 5 4 1 2             0 0 0 0 0 0 0
+                0 0 0 0 5 4 1             0 0 0 0 0 0 0
+              Note that the empty elements which don't correspond to data will not
+              be referenced.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A. Must be >= (kl + ku + 1)
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zgbmv(rocblas_handle                handle,
+                                            rocblas_operation             trans,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            rocblas_int                   kl,
+                                            rocblas_int                   ku,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            const rocblas_double_complex* beta,
                                             rocblas_double_complex*       y,
                                             rocblas_int                   incy);
 
-ROCBLAS_EXPORT rocblas_status rocblas_sgemv_batched(rocblas_handle     handle,
+ROCBLAS_EXPORT rocblas_status rocblas_sgbmv_batched(rocblas_handle     handle,
                                                     rocblas_operation  trans,
                                                     rocblas_int        m,
                                                     rocblas_int        n,
+                                                    rocblas_int        kl,
+                                                    rocblas_int        ku,
                                                     const float*       alpha,
                                                     const float* const A[],
                                                     rocblas_int        lda,
@@ -3174,10 +3578,12 @@ ROCBLAS_EXPORT rocblas_status rocblas_sgemv_batched(rocblas_handle     handle,
                                                     rocblas_int        incy,
                                                     rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dgemv_batched(rocblas_handle      handle,
+ROCBLAS_EXPORT rocblas_status rocblas_dgbmv_batched(rocblas_handle      handle,
                                                     rocblas_operation   trans,
                                                     rocblas_int         m,
                                                     rocblas_int         n,
+                                                    rocblas_int         kl,
+                                                    rocblas_int         ku,
                                                     const double*       alpha,
                                                     const double* const A[],
                                                     rocblas_int         lda,
@@ -3188,10 +3594,12 @@ ROCBLAS_EXPORT rocblas_status rocblas_dgemv_batched(rocblas_handle      handle,
                                                     rocblas_int         incy,
                                                     rocblas_int         batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cgemv_batched(rocblas_handle                     handle,
+ROCBLAS_EXPORT rocblas_status rocblas_cgbmv_batched(rocblas_handle                     handle,
                                                     rocblas_operation                  trans,
                                                     rocblas_int                        m,
                                                     rocblas_int                        n,
+                                                    rocblas_int                        kl,
+                                                    rocblas_int                        ku,
                                                     const rocblas_float_complex*       alpha,
                                                     const rocblas_float_complex* const A[],
                                                     rocblas_int                        lda,
@@ -3205,7 +3613,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_cgemv_batched(rocblas_handle
 /*! \brief BLAS Level 2 API
 
     \details
-    xGEMV_BATCHED performs a batch of matrix-vector operations
+    xGBMV_BATCHED performs one of the matrix-vector operations
 
         y_i := alpha*A_i*x_i    + beta*y_i,   or
         y_i := alpha*A_i**T*x_i + beta*y_i,   or
@@ -3213,48 +3621,72 @@ ROCBLAS_EXPORT rocblas_status rocblas_cgemv_batched(rocblas_handle
 
     where (A_i, x_i, y_i) is the i-th instance of the batch.
     alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    m by n matrix, for i = 1, ..., batch_count.
+    m by n banded matrix with kl sub-diagonals and ku super-diagonals,
+    for i = 1, ..., batch_count.
 
     @param[in]
-    handle      [rocblas_handle]
-                handle to the rocblas library context queue.
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
     @param[in]
-    trans       [rocblas_operation]
-                indicates whether matrices A_i are tranposed (conjugated) or not
+    trans     [rocblas_operation]
+              indicates whether matrix A is tranposed (conjugated) or not
     @param[in]
-    m           [rocblas_int]
-                number of rows of each matrix A_i
+    m         [rocblas_int]
+              number of rows of each matrix A_i
     @param[in]
-    n           [rocblas_int]
-                number of columns of each matrix A_i
+    n         [rocblas_int]
+              number of columns of each matrix A_i
     @param[in]
-    alpha       device pointer or host pointer to scalar alpha.
+    kl        [rocblas_int]
+              number of sub-diagonals of each A_i
     @param[in]
-    A           device array of device pointers storing each matrix A_i.
+    ku        [rocblas_int]
+              number of super-diagonals of each A_i
     @param[in]
-    lda         [rocblas_int]
-                specifies the leading dimension of each matrix A_i.
+    alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    x           device array of device pointers storing each vector x_i.
+        A     device array of device pointers storing each banded matrix A_i.
+              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
+              of the banded matrix. The leading diagonal resides in row (ku + 1) with
+              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
+              resides below on the LHS of row ku + 2. This propogates up and down across
+              sub/super-diagonals.
+                Ex: (m = n = 7; ku = 2, kl = 2)
+                1 2 3 0 0 0 0             0 0 3 3 3 3 3
+                4 1 2 3 0 0 0             0 2 2 2 2 2 2
+                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
+                0 5 4 1 2 3 0             4 4 4 4 4 4 0
+                0 0 5 4 1 2 0             5 5 5 5 5 0 0
+                0 0 0 5 4 1 2             0 0 0 0 0 0 0
+                0 0 0 0 5 4 1             0 0 0 0 0 0 0
+              Note that the empty elements which don't correspond to data will not
+              be referenced.
     @param[in]
-    incx        [rocblas_int]
-                specifies the increment for the elements of each vector x_i.
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. Must be >= (kl + ku + 1)
     @param[in]
-    beta        device pointer or host pointer to scalar beta.
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    y           device array of device pointers storing each vector y_i.
+    y         device array of device pointers storing each vector y_i.
     @param[in]
-    incy        [rocblas_int]
-                specifies the increment for the elements of each vector y_i.
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
     @param[in]
     batch_count [rocblas_int]
-                number of instances in the batch
+                specifies the number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zgemv_batched(rocblas_handle                      handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zgbmv_batched(rocblas_handle                      handle,
                                                     rocblas_operation                   trans,
                                                     rocblas_int                         m,
                                                     rocblas_int                         n,
+                                                    rocblas_int                         kl,
+                                                    rocblas_int                         ku,
                                                     const rocblas_double_complex*       alpha,
                                                     const rocblas_double_complex* const A[],
                                                     rocblas_int                         lda,
@@ -3265,61 +3697,67 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemv_batched(rocblas_handle
                                                     rocblas_int                         incy,
                                                     rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_sgemv_strided_batched(rocblas_handle    handle,
-                                                            rocblas_operation transA,
+ROCBLAS_EXPORT rocblas_status rocblas_sgbmv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_operation trans,
                                                             rocblas_int       m,
                                                             rocblas_int       n,
+                                                            rocblas_int       kl,
+                                                            rocblas_int       ku,
                                                             const float*      alpha,
                                                             const float*      A,
                                                             rocblas_int       lda,
-                                                            rocblas_stride    strideA,
+                                                            rocblas_stride    stride_A,
                                                             const float*      x,
                                                             rocblas_int       incx,
-                                                            rocblas_stride    stridex,
+                                                            rocblas_stride    stride_x,
                                                             const float*      beta,
                                                             float*            y,
                                                             rocblas_int       incy,
-                                                            rocblas_stride    stridey,
+                                                            rocblas_stride    stride_y,
                                                             rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dgemv_strided_batched(rocblas_handle    handle,
-                                                            rocblas_operation transA,
+ROCBLAS_EXPORT rocblas_status rocblas_dgbmv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_operation trans,
                                                             rocblas_int       m,
                                                             rocblas_int       n,
+                                                            rocblas_int       kl,
+                                                            rocblas_int       ku,
                                                             const double*     alpha,
                                                             const double*     A,
                                                             rocblas_int       lda,
-                                                            rocblas_stride    strideA,
+                                                            rocblas_stride    stride_A,
                                                             const double*     x,
                                                             rocblas_int       incx,
-                                                            rocblas_stride    stridex,
+                                                            rocblas_stride    stride_x,
                                                             const double*     beta,
                                                             double*           y,
                                                             rocblas_int       incy,
-                                                            rocblas_stride    stridey,
+                                                            rocblas_stride    stride_y,
                                                             rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cgemv_strided_batched(rocblas_handle               handle,
-                                                            rocblas_operation            transA,
+ROCBLAS_EXPORT rocblas_status rocblas_cgbmv_strided_batched(rocblas_handle               handle,
+                                                            rocblas_operation            trans,
                                                             rocblas_int                  m,
                                                             rocblas_int                  n,
+                                                            rocblas_int                  kl,
+                                                            rocblas_int                  ku,
                                                             const rocblas_float_complex* alpha,
                                                             const rocblas_float_complex* A,
                                                             rocblas_int                  lda,
-                                                            rocblas_stride               strideA,
+                                                            rocblas_stride               stride_A,
                                                             const rocblas_float_complex* x,
                                                             rocblas_int                  incx,
-                                                            rocblas_stride               stridex,
+                                                            rocblas_stride               stride_x,
                                                             const rocblas_float_complex* beta,
                                                             rocblas_float_complex*       y,
                                                             rocblas_int                  incy,
-                                                            rocblas_stride               stridey,
+                                                            rocblas_stride               stride_y,
                                                             rocblas_int batch_count);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xGEMV_STRIDED_BATCHED performs a batch of matrix-vector operations
+    xGBMV_STRIDED_BATCHED performs one of the matrix-vector operations
 
         y_i := alpha*A_i*x_i    + beta*y_i,   or
         y_i := alpha*A_i**T*x_i + beta*y_i,   or
@@ -3327,80 +3765,124 @@ ROCBLAS_EXPORT rocblas_status rocblas_cgemv_strided_batched(rocblas_handle
 
     where (A_i, x_i, y_i) is the i-th instance of the batch.
     alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    m by n matrix, for i = 1, ..., batch_count.
+    m by n banded matrix with kl sub-diagonals and ku super-diagonals,
+    for i = 1, ..., batch_count.
 
     @param[in]
-    handle      [rocblas_handle]
-                handle to the rocblas library context queue.
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
     @param[in]
-    transA      [rocblas_operation]
-                indicates whether matrices A_i are tranposed (conjugated) or not
+    trans     [rocblas_operation]
+              indicates whether matrix A is tranposed (conjugated) or not
     @param[in]
-    m           [rocblas_int]
-                number of rows of matrices A_i
+    m         [rocblas_int]
+              number of rows of matrix A
     @param[in]
-    n           [rocblas_int]
-                number of columns of matrices A_i
+    n         [rocblas_int]
+              number of columns of matrix A
     @param[in]
-    alpha       device pointer or host pointer to scalar alpha.
+    kl        [rocblas_int]
+              number of sub-diagonals of A
     @param[in]
-    A           device pointer to the first matrix (A_1) in the batch.
+    ku        [rocblas_int]
+              number of super-diagonals of A
     @param[in]
-    lda         [rocblas_int]
-                specifies the leading dimension of matrices A_i.
+    alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    strideA     [rocblas_stride]
-                stride from the start of one matrix (A_i) and the next one (A_i+1)
+        A     device pointer to first banded matrix (A_1).
+              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
+              of the banded matrix. The leading diagonal resides in row (ku + 1) with
+              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
+              resides below on the LHS of row ku + 2. This propogates up and down across
+              sub/super-diagonals.
+                Ex: (m = n = 7; ku = 2, kl = 2)
+                1 2 3 0 0 0 0             0 0 3 3 3 3 3
+                4 1 2 3 0 0 0             0 2 2 2 2 2 2
+                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
+                0 5 4 1 2 3 0             4 4 4 4 4 4 0
+                0 0 5 4 1 2 0             5 5 5 5 5 0 0
+                0 0 0 5 4 1 2             0 0 0 0 0 0 0
+                0 0 0 0 5 4 1             0 0 0 0 0 0 0
+              Note that the empty elements which don't correspond to data will not
+              be referenced.
     @param[in]
-    x           device pointer to the first vector (x_1) in the batch.
+    lda       [rocblas_int]
+              specifies the leading dimension of A. Must be >= (kl + ku + 1)
     @param[in]
-    incx        [rocblas_int]
-                specifies the increment for the elements of vectors x_i.
+    stride_A  [rocblas_stride]
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
     @param[in]
-    stridex     [rocblas_stride]
-                stride from the start of one vector (x_i) and the next one (x_i+1).
-                There are no restrictions placed on stride_x, however the user should
-                take care to ensure that stride_x is of appropriate size. When trans equals rocblas_operation_none
-                this typically means stride_x >= n * incx, otherwise stride_x >= m * incx.
+    x         device pointer to first vector (x_1).
     @param[in]
-    beta        device pointer or host pointer to scalar beta.
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one vector (x_i) and the next one (x_i+1)
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    y           device pointer to the first vector (y_1) in the batch.
+    y         device pointer to first vector (y_1).
     @param[in]
-    incy        [rocblas_int]
-                specifies the increment for the elements of vectors y_i.
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
     @param[in]
-    stridey     [rocblas_stride]
-                stride from the start of one vector (y_i) and the next one (y_i+1).
-                There are no restrictions placed on stride_y, however the user should
-                take care to ensure that stride_y is of appropriate size. When trans equals rocblas_operation_none
-                this typically means stride_y >= m * incy, otherwise stride_y >= n * incy. stridey should be non zero.
+    stride_y  [rocblas_stride]
+              stride from the start of one vector (y_i) and the next one (x_i+1)
     @param[in]
     batch_count [rocblas_int]
-                number of instances in the batch
+                specifies the number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zgemv_strided_batched(rocblas_handle                handle,
-                                                            rocblas_operation             transA,
+ROCBLAS_EXPORT rocblas_status rocblas_zgbmv_strided_batched(rocblas_handle                handle,
+                                                            rocblas_operation             trans,
                                                             rocblas_int                   m,
                                                             rocblas_int                   n,
+                                                            rocblas_int                   kl,
+                                                            rocblas_int                   ku,
                                                             const rocblas_double_complex* alpha,
                                                             const rocblas_double_complex* A,
                                                             rocblas_int                   lda,
-                                                            rocblas_stride                strideA,
+                                                            rocblas_stride                stride_A,
                                                             const rocblas_double_complex* x,
                                                             rocblas_int                   incx,
-                                                            rocblas_stride                stridex,
+                                                            rocblas_stride                stride_x,
                                                             const rocblas_double_complex* beta,
                                                             rocblas_double_complex*       y,
                                                             rocblas_int                   incy,
-                                                            rocblas_stride                stridey,
+                                                            rocblas_stride                stride_y,
                                                             rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chbmv(rocblas_handle               handle,
-                                            rocblas_fill                 uplo,
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv(rocblas_handle    handle,
+                                            rocblas_operation trans,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            const float*      x,
+                                            rocblas_int       incx,
+                                            const float*      beta,
+                                            float*            y,
+                                            rocblas_int       incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv(rocblas_handle    handle,
+                                            rocblas_operation trans,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            const double*     x,
+                                            rocblas_int       incx,
+                                            const double*     beta,
+                                            double*           y,
+                                            rocblas_int       incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv(rocblas_handle               handle,
+                                            rocblas_operation            trans,
+                                            rocblas_int                  m,
                                             rocblas_int                  n,
-                                            rocblas_int                  k,
                                             const rocblas_float_complex* alpha,
                                             const rocblas_float_complex* A,
                                             rocblas_int                  lda,
@@ -3413,61 +3895,34 @@ ROCBLAS_EXPORT rocblas_status rocblas_chbmv(rocblas_handle               handle,
 /*! \brief BLAS Level 2 API
 
     \details
-    xHBMV performs the matrix-vector operations
+    xGEMV performs one of the matrix-vector operations
 
-        y := alpha*A*x + beta*y
+        y := alpha*A*x    + beta*y,   or
+        y := alpha*A**T*x + beta*y,   or
+        y := alpha*A**H*x + beta*y,
 
-    where alpha and beta are scalars, x and y are n element vectors and A is an
-    n by n Hermitian band matrix, with k super-diagonals.
+    where alpha and beta are scalars, x and y are vectors and A is an
+    m by n matrix.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
-    uplo      [rocblas_fill]
-              rocblas_fill_upper: The upper triangular part of A is being supplied.
-              rocblas_fill_lower: The lower triangular part of A is being supplied.
+    trans     [rocblas_operation]
+              indicates whether matrix A is tranposed (conjugated) or not
     @param[in]
-    n         [rocblas_int]
-              the order of the matrix A.
+    m         [rocblas_int]
+              number of rows of matrix A
     @param[in]
-    k         [rocblas_int]
-              the number of super-diagonals of the matrix A. Must be >= 0.
+    n         [rocblas_int]
+              number of columns of matrix A
     @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    A         device pointer storing matrix A. Of dimension (lda, n).
-              if uplo == rocblas_fill_upper:
-                The leading (k + 1) by n part of A must contain the upper
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (k + 1), the first super-diagonal on the RHS
-                of row k, etc.
-                The top left k by x triangle of A will not be referenced.
-                    Ex (upper, lda = n = 4, k = 1):
-                    A                             Represented matrix
-                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
-                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
-
-              if uplo == rocblas_fill_lower:
-                The leading (k + 1) by n part of A must contain the lower
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (1), the first sub-diagonal on the LHS of
-                row 2, etc.
-                The bottom right k by k triangle of A will not be referenced.
-                    Ex (lower, lda = 2, n = 4, k = 1):
-                    A                               Represented matrix
-                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
-                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
-                                                    (0, 0) (6, 8) (3, 0) (7,-7)
-                                                    (0, 0) (0, 0) (7, 7) (4, 0)
-
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of A will not be referenced and is assumed to be == 0.
+    A         device pointer storing matrix A.
     @param[in]
     lda       [rocblas_int]
-              specifies the leading dimension of A. must be >= k + 1
+              specifies the leading dimension of A.
     @param[in]
     x         device pointer storing vector x.
     @param[in]
@@ -3482,10 +3937,10 @@ ROCBLAS_EXPORT rocblas_status rocblas_chbmv(rocblas_handle               handle,
               specifies the increment for the elements of y.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhbmv(rocblas_handle                handle,
-                                            rocblas_fill                  uplo,
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv(rocblas_handle                handle,
+                                            rocblas_operation             trans,
+                                            rocblas_int                   m,
                                             rocblas_int                   n,
-                                            rocblas_int                   k,
                                             const rocblas_double_complex* alpha,
                                             const rocblas_double_complex* A,
                                             rocblas_int                   lda,
@@ -3495,10 +3950,38 @@ ROCBLAS_EXPORT rocblas_status rocblas_zhbmv(rocblas_handle                handle
                                             rocblas_double_complex*       y,
                                             rocblas_int                   incy);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chbmv_batched(rocblas_handle                     handle,
-                                                    rocblas_fill                       uplo,
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_batched(rocblas_handle     handle,
+                                                    rocblas_operation  trans,
+                                                    rocblas_int        m,
+                                                    rocblas_int        n,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    rocblas_int        lda,
+                                                    const float* const x[],
+                                                    rocblas_int        incx,
+                                                    const float*       beta,
+                                                    float* const       y[],
+                                                    rocblas_int        incy,
+                                                    rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_batched(rocblas_handle      handle,
+                                                    rocblas_operation   trans,
+                                                    rocblas_int         m,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    rocblas_int         lda,
+                                                    const double* const x[],
+                                                    rocblas_int         incx,
+                                                    const double*       beta,
+                                                    double* const       y[],
+                                                    rocblas_int         incy,
+                                                    rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_batched(rocblas_handle                     handle,
+                                                    rocblas_operation                  trans,
+                                                    rocblas_int                        m,
                                                     rocblas_int                        n,
-                                                    rocblas_int                        k,
                                                     const rocblas_float_complex*       alpha,
                                                     const rocblas_float_complex* const A[],
                                                     rocblas_int                        lda,
@@ -3512,82 +3995,56 @@ ROCBLAS_EXPORT rocblas_status rocblas_chbmv_batched(rocblas_handle
 /*! \brief BLAS Level 2 API
 
     \details
-    xHBMV_BATCHED performs one of the matrix-vector operations
+    xGEMV_BATCHED performs a batch of matrix-vector operations
 
-        y_i := alpha*A_i*x_i + beta*y_i
+        y_i := alpha*A_i*x_i    + beta*y_i,   or
+        y_i := alpha*A_i**T*x_i + beta*y_i,   or
+        y_i := alpha*A_i**H*x_i + beta*y_i,
 
-    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian band matrix with k super-diagonals, for each batch in i = [1, batch_count].
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    m by n matrix, for i = 1, ..., batch_count.
 
     @param[in]
-    handle    [rocblas_handle]
-              handle to the rocblas library context queue.
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
     @param[in]
-    uplo      [rocblas_fill]
-              rocblas_fill_upper: The upper triangular part of each A_i is being supplied.
-              rocblas_fill_lower: The lower triangular part of each A_i is being supplied.
+    trans       [rocblas_operation]
+                indicates whether matrices A_i are tranposed (conjugated) or not
     @param[in]
-    n         [rocblas_int]
-              the order of each matrix A_i.
+    m           [rocblas_int]
+                number of rows of each matrix A_i
     @param[in]
-    k         [rocblas_int]
-              the number of super-diagonals of each matrix A_i. Must be >= 0.
+    n           [rocblas_int]
+                number of columns of each matrix A_i
     @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
+    alpha       device pointer or host pointer to scalar alpha.
     @param[in]
-    A         device array of device pointers storing each matrix_i A of dimension (lda, n).
-              if uplo == rocblas_fill_upper:
-                The leading (k + 1) by n part of each A_i must contain the upper
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (k + 1), the first super-diagonal on the RHS
-                of row k, etc.
-                The top left k by x triangle of each A_i will not be referenced.
-                    Ex (upper, lda = n = 4, k = 1):
-                    A                             Represented matrix
-                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
-                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
-
-              if uplo == rocblas_fill_lower:
-                The leading (k + 1) by n part of each A_i must contain the lower
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (1), the first sub-diagonal on the LHS of
-                row 2, etc.
-                The bottom right k by k triangle of each A_i will not be referenced.
-                    Ex (lower, lda = 2, n = 4, k = 1):
-                    A                               Represented matrix
-                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
-                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
-                                                    (0, 0) (6, 8) (3, 0) (7,-7)
-                                                    (0, 0) (0, 0) (7, 7) (4, 0)
-
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of each A_i will not be referenced and is assumed to be == 0.
+    A           device array of device pointers storing each matrix A_i.
     @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of each A_i. must be >= max(1, n)
+    lda         [rocblas_int]
+                specifies the leading dimension of each matrix A_i.
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    x           device array of device pointers storing each vector x_i.
     @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of each x_i.
+    incx        [rocblas_int]
+                specifies the increment for the elements of each vector x_i.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
+    beta        device pointer or host pointer to scalar beta.
     @param[inout]
-    y         device array of device pointers storing each vector y_i.
+    y           device array of device pointers storing each vector y_i.
     @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of y.
+    incy        [rocblas_int]
+                specifies the increment for the elements of each vector y_i.
     @param[in]
     batch_count [rocblas_int]
-                number of instances in the batch.
+                number of instances in the batch
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhbmv_batched(rocblas_handle                      handle,
-                                                    rocblas_fill                        uplo,
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_batched(rocblas_handle                      handle,
+                                                    rocblas_operation                   trans,
+                                                    rocblas_int                         m,
                                                     rocblas_int                         n,
-                                                    rocblas_int                         k,
                                                     const rocblas_double_complex*       alpha,
                                                     const rocblas_double_complex* const A[],
                                                     rocblas_int                         lda,
@@ -3598,395 +4055,557 @@ ROCBLAS_EXPORT rocblas_status rocblas_zhbmv_batched(rocblas_handle
                                                     rocblas_int                         incy,
                                                     rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chbmv_strided_batched(rocblas_handle               handle,
-                                                            rocblas_fill                 uplo,
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_operation transA,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            const float*      alpha,
+                                                            const float*      A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    strideA,
+                                                            const float*      x,
+                                                            rocblas_int       incx,
+                                                            rocblas_stride    stridex,
+                                                            const float*      beta,
+                                                            float*            y,
+                                                            rocblas_int       incy,
+                                                            rocblas_stride    stridey,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_strided_batched(rocblas_handle    handle,
+                                                            rocblas_operation transA,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            const double*     alpha,
+                                                            const double*     A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    strideA,
+                                                            const double*     x,
+                                                            rocblas_int       incx,
+                                                            rocblas_stride    stridex,
+                                                            const double*     beta,
+                                                            double*           y,
+                                                            rocblas_int       incy,
+                                                            rocblas_stride    stridey,
+                                                            rocblas_int       batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_strided_batched(rocblas_handle               handle,
+                                                            rocblas_operation            transA,
+                                                            rocblas_int                  m,
                                                             rocblas_int                  n,
-                                                            rocblas_int                  k,
                                                             const rocblas_float_complex* alpha,
                                                             const rocblas_float_complex* A,
                                                             rocblas_int                  lda,
-                                                            rocblas_stride               stride_A,
+                                                            rocblas_stride               strideA,
                                                             const rocblas_float_complex* x,
                                                             rocblas_int                  incx,
-                                                            rocblas_stride               stride_x,
+                                                            rocblas_stride               stridex,
                                                             const rocblas_float_complex* beta,
                                                             rocblas_float_complex*       y,
                                                             rocblas_int                  incy,
-                                                            rocblas_stride               stride_y,
+                                                            rocblas_stride               stridey,
                                                             rocblas_int batch_count);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHBMV_STRIDED_BATCHED performs one of the matrix-vector operations
+    xGEMV_STRIDED_BATCHED performs a batch of matrix-vector operations
 
-        y_i := alpha*A_i*x_i + beta*y_i
+        y_i := alpha*A_i*x_i    + beta*y_i,   or
+        y_i := alpha*A_i**T*x_i + beta*y_i,   or
+        y_i := alpha*A_i**H*x_i + beta*y_i,
 
-    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian band matrix with k super-diagonals, for each batch in i = [1, batch_count].
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    m by n matrix, for i = 1, ..., batch_count.
 
     @param[in]
-    handle    [rocblas_handle]
-              handle to the rocblas library context queue.
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
     @param[in]
-    uplo      [rocblas_fill]
-              rocblas_fill_upper: The upper triangular part of each A_i is being supplied.
-              rocblas_fill_lower: The lower triangular part of each A_i is being supplied.
+    transA      [rocblas_operation]
+                indicates whether matrices A_i are tranposed (conjugated) or not
     @param[in]
-    n         [rocblas_int]
-              the order of each matrix A_i.
+    m           [rocblas_int]
+                number of rows of matrices A_i
     @param[in]
-    k         [rocblas_int]
-              the number of super-diagonals of each matrix A_i. Must be >= 0.
+    n           [rocblas_int]
+                number of columns of matrices A_i
     @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
+    alpha       device pointer or host pointer to scalar alpha.
     @param[in]
-    A         device array pointing to the first matrix A_1. Each A_i is of dimension (lda, n).
-              if uplo == rocblas_fill_upper:
-                The leading (k + 1) by n part of each A_i must contain the upper
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (k + 1), the first super-diagonal on the RHS
-                of row k, etc.
-                The top left k by x triangle of each A_i will not be referenced.
-                    Ex (upper, lda = n = 4, k = 1):
-                    A                             Represented matrix
-                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
-                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
-
-              if uplo == rocblas_fill_lower:
-                The leading (k + 1) by n part of each A_i must contain the lower
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (1), the first sub-diagonal on the LHS of
-                row 2, etc.
-                The bottom right k by k triangle of each A_i will not be referenced.
-                    Ex (lower, lda = 2, n = 4, k = 1):
-                    A                               Represented matrix
-                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
-                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
-                                                    (0, 0) (6, 8) (3, 0) (7,-7)
-                                                    (0, 0) (0, 0) (7, 7) (4, 0)
-
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of each A_i will not be referenced and is assumed to be == 0.
+    A           device pointer to the first matrix (A_1) in the batch.
     @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of each A_i. must be >= max(1, n)
+    lda         [rocblas_int]
+                specifies the leading dimension of matrices A_i.
     @param[in]
-    stride_A  [rocblas_stride]
-              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    strideA     [rocblas_stride]
+                stride from the start of one matrix (A_i) and the next one (A_i+1)
     @param[in]
-    x         device array pointing to the first vector y_1.
+    x           device pointer to the first vector (x_1) in the batch.
     @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of each x_i.
+    incx        [rocblas_int]
+                specifies the increment for the elements of vectors x_i.
     @param[in]
-    stride_x  [rocblas_stride]
-              stride from the start of one vector (x_i) and the next one (x_i+1)
+    stridex     [rocblas_stride]
+                stride from the start of one vector (x_i) and the next one (x_i+1).
+                There are no restrictions placed on stride_x, however the user should
+                take care to ensure that stride_x is of appropriate size. When trans equals rocblas_operation_none
+                this typically means stride_x >= n * incx, otherwise stride_x >= m * incx.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
+    beta        device pointer or host pointer to scalar beta.
     @param[inout]
-    y         device array pointing to the first vector y_1.
+    y           device pointer to the first vector (y_1) in the batch.
     @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of y.
+    incy        [rocblas_int]
+                specifies the increment for the elements of vectors y_i.
     @param[in]
-    stride_y  [rocblas_stride]
-              stride from the start of one vector (y_i) and the next one (y_i+1)
+    stridey     [rocblas_stride]
+                stride from the start of one vector (y_i) and the next one (y_i+1).
+                There are no restrictions placed on stride_y, however the user should
+                take care to ensure that stride_y is of appropriate size. When trans equals rocblas_operation_none
+                this typically means stride_y >= m * incy, otherwise stride_y >= n * incy. stridey should be non zero.
     @param[in]
     batch_count [rocblas_int]
-                number of instances in the batch.
+                number of instances in the batch
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhbmv_strided_batched(rocblas_handle                handle,
-                                                            rocblas_fill                  uplo,
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_strided_batched(rocblas_handle                handle,
+                                                            rocblas_operation             transA,
+                                                            rocblas_int                   m,
                                                             rocblas_int                   n,
-                                                            rocblas_int                   k,
                                                             const rocblas_double_complex* alpha,
                                                             const rocblas_double_complex* A,
                                                             rocblas_int                   lda,
-                                                            rocblas_stride                stride_A,
+                                                            rocblas_stride                strideA,
                                                             const rocblas_double_complex* x,
                                                             rocblas_int                   incx,
-                                                            rocblas_stride                stride_x,
+                                                            rocblas_stride                stridex,
                                                             const rocblas_double_complex* beta,
                                                             rocblas_double_complex*       y,
                                                             rocblas_int                   incy,
-                                                            rocblas_stride                stride_y,
+                                                            rocblas_stride                stridey,
                                                             rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chemv(rocblas_handle               handle,
-                                            rocblas_fill                 uplo,
-                                            rocblas_int                  n,
-                                            const rocblas_float_complex* alpha,
-                                            const rocblas_float_complex* A,
-                                            rocblas_int                  lda,
-                                            const rocblas_float_complex* x,
-                                            rocblas_int                  incx,
-                                            const rocblas_float_complex* beta,
-                                            rocblas_float_complex*       y,
-                                            rocblas_int                  incy);
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_multi(rocblas_handle    handle,
+                                                  rocblas_operation transA,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  rocblas_int       k,
+                                                  const float*      alpha,
+                                                  const float*      A,
+                                                  rocblas_int       lda,
+                                                  const float*      x,
+                                                  rocblas_int       incx,
+                                                  rocblas_stride    stride_x,
+                                                  const float*      beta,
+                                                  float*            y,
+                                                  rocblas_int       incy,
+                                                  rocblas_stride    stride_y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_multi(rocblas_handle    handle,
+                                                  rocblas_operation transA,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  rocblas_int       k,
+                                                  const double*     alpha,
+                                                  const double*     A,
+                                                  rocblas_int       lda,
+                                                  const double*     x,
+                                                  rocblas_int       incx,
+                                                  rocblas_stride    stride_x,
+                                                  const double*     beta,
+                                                  double*           y,
+                                                  rocblas_int       incy,
+                                                  rocblas_stride    stride_y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_multi(rocblas_handle               handle,
+                                                  rocblas_operation            transA,
+                                                  rocblas_int                  m,
+                                                  rocblas_int                  n,
+                                                  rocblas_int                  k,
+                                                  const rocblas_float_complex* alpha,
+                                                  const rocblas_float_complex* A,
+                                                  rocblas_int                  lda,
+                                                  const rocblas_float_complex* x,
+                                                  rocblas_int                  incx,
+                                                  rocblas_stride               stride_x,
+                                                  const rocblas_float_complex* beta,
+                                                  rocblas_float_complex*       y,
+                                                  rocblas_int                  incy,
+                                                  rocblas_stride               stride_y);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHEMV performs one of the matrix-vector operations
+    xGEMV_MULTI performs the matrix-vector operations
 
-        y := alpha*A*x + beta*y
+        y_j := alpha*A*x_j    + beta*y_j,   or
+        y_j := alpha*A**T*x_j + beta*y_j,   or
+        y_j := alpha*A**H*x_j + beta*y_j,
 
-    where alpha and beta are scalars, x and y are n element vectors and A is an
-    n by n Hermitian matrix.
+    for j = 1, ..., k, with the same m by n matrix A for every vector. alpha and beta
+    are scalars, x_j and y_j are vectors.
+
+    A is read once for up to 16 vectors, so for small k this is faster than k calls to xGEMV,
+    or than xGEMM with a matrix of k columns. x_j and y_j are strided like the vectors of
+    xGEMV_STRIDED_BATCHED, so blocks of vectors stored as the columns of a matrix
+    (incx = 1, stride_x = ldx) or as its rows (incx = ldx, stride_x = 1) are both supported.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
-    uplo      [rocblas_fill]
-              rocblas_fill_upper: the upper triangular part of the Hermitian matrix A is supplied.
-              rocblas_fill_lower: the lower triangular part of the Hermitian matrix A is supplied.
+    transA    [rocblas_operation]
+              indicates whether matrix A is tranposed (conjugated) or not
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrix A
     @param[in]
     n         [rocblas_int]
-              the order of the matrix A.
+              number of columns of matrix A
+    @param[in]
+    k         [rocblas_int]
+              number of vectors x_j and y_j
     @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    A         device pointer storing matrix A. Of dimension (lda, n).
-              if uplo == rocblas_fill_upper:
-                The upper triangular part of A must contain
-                the upper triangular part of a Hermitian matrix. The lower
-                triangular part of A will not be referenced.
-              if uplo == rocblas_fill_lower:
-                The lower triangular part of A must contain
-                the lower triangular part of a Hermitian matrix. The upper
-                triangular part of A will not be referenced.
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of A will not be referenced and is assumed to be == 0.
+    A         device pointer storing matrix A.
     @param[in]
     lda       [rocblas_int]
-              specifies the leading dimension of A. must be >= max(1, n)
+              specifies the leading dimension of A.
     @param[in]
-    x         device pointer storing vector x.
+    x         device pointer to the first vector (x_1).
     @param[in]
     incx      [rocblas_int]
-              specifies the increment for the elements of x.
+              specifies the increment for the elements of vectors x_j.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one vector (x_j) and the next one (x_j+1).
     @param[in]
     beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    y         device pointer storing vector y.
+    y         device pointer to the first vector (y_1).
     @param[in]
     incy      [rocblas_int]
-              specifies the increment for the elements of y.
+              specifies the increment for the elements of vectors y_j.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one vector (y_j) and the next one (y_j+1).
+              The vectors y_j must not overlap.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhemv(rocblas_handle                handle,
-                                            rocblas_fill                  uplo,
-                                            rocblas_int                   n,
-                                            const rocblas_double_complex* alpha,
-                                            const rocblas_double_complex* A,
-                                            rocblas_int                   lda,
-                                            const rocblas_double_complex* x,
-                                            rocblas_int                   incx,
-                                            const rocblas_double_complex* beta,
-                                            rocblas_double_complex*       y,
-                                            rocblas_int                   incy);
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_multi(rocblas_handle                handle,
+                                                  rocblas_operation             transA,
+                                                  rocblas_int                   m,
+                                                  rocblas_int                   n,
+                                                  rocblas_int                   k,
+                                                  const rocblas_double_complex* alpha,
+                                                  const rocblas_double_complex* A,
+                                                  rocblas_int                   lda,
+                                                  const rocblas_double_complex* x,
+                                                  rocblas_int                   incx,
+                                                  rocblas_stride                stride_x,
+                                                  const rocblas_double_complex* beta,
+                                                  rocblas_double_complex*       y,
+                                                  rocblas_int                   incy,
+                                                  rocblas_stride                stride_y);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_grouped(rocblas_handle     handle,
+                                                    rocblas_operation  transA,
+                                                    const rocblas_int* m,
+                                                    const rocblas_int* n,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    const rocblas_int* lda,
+                                                    const float* const x[],
+                                                    const rocblas_int* incx,
+                                                    const float*       beta,
+                                                    float* const       y[],
+                                                    const rocblas_int* incy,
+                                                    rocblas_int        group_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chemv_batched(rocblas_handle                     handle,
-                                                    rocblas_fill                       uplo,
-                                                    rocblas_int                        n,
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_grouped(rocblas_handle      handle,
+                                                    rocblas_operation   transA,
+                                                    const rocblas_int*  m,
+                                                    const rocblas_int*  n,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    const rocblas_int*  lda,
+                                                    const double* const x[],
+                                                    const rocblas_int*  incx,
+                                                    const double*       beta,
+                                                    double* const       y[],
+                                                    const rocblas_int*  incy,
+                                                    rocblas_int         group_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_grouped(rocblas_handle                     handle,
+                                                    rocblas_operation                  transA,
+                                                    const rocblas_int*                 m,
+                                                    const rocblas_int*                 n,
                                                     const rocblas_float_complex*       alpha,
                                                     const rocblas_float_complex* const A[],
-                                                    rocblas_int                        lda,
+                                                    const rocblas_int*                 lda,
                                                     const rocblas_float_complex* const x[],
-                                                    rocblas_int                        incx,
+                                                    const rocblas_int*                 incx,
                                                     const rocblas_float_complex*       beta,
                                                     rocblas_float_complex* const       y[],
-                                                    rocblas_int                        incy,
-                                                    rocblas_int                        batch_count);
+                                                    const rocblas_int*                 incy,
+                                                    rocblas_int                        group_count);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHEMV_BATCHED performs one of the matrix-vector operations
+    xGEMV_GROUPED performs the matrix-vector operations
 
-        y_i := alpha*A_i*x_i + beta*y_i
+        y_p := alpha*A_p*x_p    + beta*y_p,   or
+        y_p := alpha*A_p**T*x_p + beta*y_p,   or
+        y_p := alpha*A_p**H*x_p + beta*y_p,
 
-    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian matrix, for each batch in i = [1, batch_count].
+    for p = 1, ..., group_count, where every problem has its own m_p by n_p matrix A_p and
+    vectors x_p and y_p. alpha and beta are scalars shared by all the problems.
+
+    Unlike xGEMV_BATCHED, the problems may have different sizes. The sizes, leading dimensions,
+    increments and pointers of the problems are read from arrays in device memory, so they can be
+    produced by a previous kernel without a copy to the host, e.g. the per-node problems of a
+    graph or sparse-block computation. All the problems are computed by a single persistent launch
+    which balances the rows (or columns for op(A) = A**T or A**H) of the whole group across the
+    compute units.
+
+    Since the sizes are not known on the host, a problem with m_p < 0, n_p < 0, lda_p < m_p,
+    incx_p == 0 or incy_p == 0 is not reported as an error but skipped, and its y_p is unchanged,
+    as is y_p of a problem with m_p == 0 or n_p == 0.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
-    uplo      [rocblas_fill]
-              rocblas_fill_upper: the upper triangular part of the Hermitian matrix A is supplied.
-              rocblas_fill_lower: the lower triangular part of the Hermitian matrix A is supplied.
+    transA    [rocblas_operation]
+              indicates whether the matrices A_p are tranposed (conjugated) or not
     @param[in]
-    n         [rocblas_int]
-              the order of each matrix A_i.
+    m         device array of group_count rocblas_int, the number of rows of each A_p.
+    @param[in]
+    n         device array of group_count rocblas_int, the number of columns of each A_p.
     @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    A         device array of device pointers storing each matrix A_i of dimension (lda, n).
-              if uplo == rocblas_fill_upper:
-                The upper triangular part of each A_i must contain
-                the upper triangular part of a Hermitian matrix. The lower
-                triangular part of each A_i will not be referenced.
-              if uplo == rocblas_fill_lower:
-                The lower triangular part of each A_i must contain
-                the lower triangular part of a Hermitian matrix. The upper
-                triangular part of each A_i will not be referenced.
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of each A_i will not be referenced and is assumed to be == 0.
+    A         device array of group_count device pointers storing each matrix A_p.
     @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of each A_i. must be >= max(1, n)
+    lda       device array of group_count rocblas_int, the leading dimension of each A_p.
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    x         device array of group_count device pointers storing each vector x_p.
     @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of each x_i.
+    incx      device array of group_count rocblas_int, the increment for the elements of each x_p.
     @param[in]
     beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    y         device array of device pointers storing each vector y_i.
+    y         device array of group_count device pointers storing each vector y_p.
+              The vectors y_p must not overlap.
     @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of y.
+    incy      device array of group_count rocblas_int, the increment for the elements of each y_p.
     @param[in]
-    batch_count [rocblas_int]
-                number of instances in the batch.
+    group_count
+              [rocblas_int]
+              number of problems in the group.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhemv_batched(rocblas_handle                      handle,
-                                                    rocblas_fill                        uplo,
-                                                    rocblas_int                         n,
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_grouped(rocblas_handle                      handle,
+                                                    rocblas_operation                   transA,
+                                                    const rocblas_int*                  m,
+                                                    const rocblas_int*                  n,
                                                     const rocblas_double_complex*       alpha,
                                                     const rocblas_double_complex* const A[],
-                                                    rocblas_int                         lda,
+                                                    const rocblas_int*                  lda,
                                                     const rocblas_double_complex* const x[],
-                                                    rocblas_int                         incx,
+                                                    const rocblas_int*                  incx,
                                                     const rocblas_double_complex*       beta,
                                                     rocblas_double_complex* const       y[],
-                                                    rocblas_int                         incy,
-                                                    rocblas_int batch_count);
+                                                    const rocblas_int*                  incy,
+                                                    rocblas_int group_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chemv_strided_batched(rocblas_handle               handle,
-                                                            rocblas_fill                 uplo,
-                                                            rocblas_int                  n,
-                                                            const rocblas_float_complex* alpha,
-                                                            const rocblas_float_complex* A,
-                                                            rocblas_int                  lda,
-                                                            rocblas_stride               stride_A,
-                                                            const rocblas_float_complex* x,
-                                                            rocblas_int                  incx,
-                                                            rocblas_stride               stride_x,
-                                                            const rocblas_float_complex* beta,
-                                                            rocblas_float_complex*       y,
-                                                            rocblas_int                  incy,
-                                                            rocblas_stride               stride_y,
-                                                            rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_sger_deferred(rocblas_handle      handle,
+                                                    rocblas_rank_update update,
+                                                    rocblas_int         m,
+                                                    rocblas_int         n,
+                                                    const float*        alpha,
+                                                    const float*        x,
+                                                    rocblas_int         incx,
+                                                    const float*        y,
+                                                    rocblas_int         incy,
+                                                    float*              A,
+                                                    rocblas_int         lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_deferred(rocblas_handle      handle,
+                                                    rocblas_rank_update update,
+                                                    rocblas_int         m,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double*       x,
+                                                    rocblas_int         incx,
+                                                    const double*       y,
+                                                    rocblas_int         incy,
+                                                    double*             A,
+                                                    rocblas_int         lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgeru_deferred(rocblas_handle               handle,
+                                                     rocblas_rank_update          update,
+                                                     rocblas_int                  m,
+                                                     rocblas_int                  n,
+                                                     const rocblas_float_complex* alpha,
+                                                     const rocblas_float_complex* x,
+                                                     rocblas_int                  incx,
+                                                     const rocblas_float_complex* y,
+                                                     rocblas_int                  incy,
+                                                     rocblas_float_complex*       A,
+                                                     rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgeru_deferred(rocblas_handle                handle,
+                                                     rocblas_rank_update           update,
+                                                     rocblas_int                   m,
+                                                     rocblas_int                   n,
+                                                     const rocblas_double_complex* alpha,
+                                                     const rocblas_double_complex* x,
+                                                     rocblas_int                   incx,
+                                                     const rocblas_double_complex* y,
+                                                     rocblas_int                   incy,
+                                                     rocblas_double_complex*       A,
+                                                     rocblas_int                   lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgerc_deferred(rocblas_handle               handle,
+                                                     rocblas_rank_update          update,
+                                                     rocblas_int                  m,
+                                                     rocblas_int                  n,
+                                                     const rocblas_float_complex* alpha,
+                                                     const rocblas_float_complex* x,
+                                                     rocblas_int                  incx,
+                                                     const rocblas_float_complex* y,
+                                                     rocblas_int                  incy,
+                                                     rocblas_float_complex*       A,
+                                                     rocblas_int                  lda);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHEMV_STRIDED_BATCHED performs one of the matrix-vector operations
+    xGER_DEFERRED, xGERU_DEFERRED and xGERC_DEFERRED perform the deferred matrix-vector operations
 
-        y_i := alpha*A_i*x_i + beta*y_i
+        A := A + alpha*x*y**T , OR
+        A := A + alpha*x*y**H for xGERC_DEFERRED
 
-    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian matrix, for each batch in i = [1, batch_count].
+    where alpha is a scalar, x and y are vectors, and A is an
+    m by n matrix.
+
+    The update is not applied immediately: the vectors are appended to update, and all its
+    pending updates are applied together as a single rank-k update when k vectors are pending,
+    when an update of another matrix or of another kind is made with update, or by
+    rocblas_rank_update_flush. A must not be accessed by other functions in the meantime,
+    and x and y may be modified as soon as the function returns.
+    Each pending update takes one column of the m by k and n by k panels of update, and the
+    pending updates are applied with xGEMM.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
+    @param[inout]
+    update    [rocblas_rank_update]
+              buffer of the pending updates, created with rocblas_create_rank_update.
     @param[in]
-    uplo      [rocblas_fill]
-              rocblas_fill_upper: the upper triangular part of the Hermitian matrix A is supplied.
-              rocblas_fill_lower: the lower triangular part of the Hermitian matrix A is supplied.
+    m         [rocblas_int]
+              the number of rows of the matrix A.
     @param[in]
     n         [rocblas_int]
-              the order of each matrix A_i.
-    @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
-    @param[in]
-    A         device array of device pointers storing each matrix A_i of dimension (lda, n).
-              if uplo == rocblas_fill_upper:
-                The upper triangular part of each A_i must contain
-                the upper triangular part of a Hermitian matrix. The lower
-                triangular part of each A_i will not be referenced.
-              if uplo == rocblas_fill_lower:
-                The lower triangular part of each A_i must contain
-                the lower triangular part of a Hermitian matrix. The upper
-                triangular part of each A_i will not be referenced.
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of each A_i will not be referenced and is assumed to be == 0.
+              the number of columns of the matrix A.
     @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of each A_i. must be >= max(1, n)
+    alpha
+              device pointer or host pointer to scalar alpha.
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    x         device pointer storing vector x.
     @param[in]
     incx      [rocblas_int]
-              specifies the increment for the elements of each x_i.
+              specifies the increment for the elements of x.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
-    @param[inout]
-    y         device array of device pointers storing each vector y_i.
+    y         device pointer storing vector y.
     @param[in]
     incy      [rocblas_int]
               specifies the increment for the elements of y.
+    @param[inout]
+    A         device pointer storing matrix A.
     @param[in]
-    batch_count [rocblas_int]
-                number of instances in the batch.
-
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhemv_strided_batched(rocblas_handle                handle,
-                                                            rocblas_fill                  uplo,
-                                                            rocblas_int                   n,
-                                                            const rocblas_double_complex* alpha,
-                                                            const rocblas_double_complex* A,
-                                                            rocblas_int                   lda,
-                                                            rocblas_stride                stride_A,
-                                                            const rocblas_double_complex* x,
-                                                            rocblas_int                   incx,
-                                                            rocblas_stride                stride_x,
-                                                            const rocblas_double_complex* beta,
-                                                            rocblas_double_complex*       y,
-                                                            rocblas_int                   incy,
-                                                            rocblas_stride                stride_y,
-                                                            rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zgerc_deferred(rocblas_handle                handle,
+                                                     rocblas_rank_update           update,
+                                                     rocblas_int                   m,
+                                                     rocblas_int                   n,
+                                                     const rocblas_double_complex* alpha,
+                                                     const rocblas_double_complex* x,
+                                                     rocblas_int                   incx,
+                                                     const rocblas_double_complex* y,
+                                                     rocblas_int                   incy,
+                                                     rocblas_double_complex*       A,
+                                                     rocblas_int                   lda);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cher(rocblas_handle               handle,
-                                           rocblas_fill                 uplo,
-                                           rocblas_int                  n,
-                                           const float*                 alpha,
-                                           const rocblas_float_complex* x,
-                                           rocblas_int                  incx,
-                                           rocblas_float_complex*       A,
-                                           rocblas_int                  lda);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr_deferred(rocblas_handle      handle,
+                                                    rocblas_rank_update update,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_int         n,
+                                                    const float*        alpha,
+                                                    const float*        x,
+                                                    rocblas_int         incx,
+                                                    float*              A,
+                                                    rocblas_int         lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr_deferred(rocblas_handle      handle,
+                                                    rocblas_rank_update update,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double*       x,
+                                                    rocblas_int         incx,
+                                                    double*             A,
+                                                    rocblas_int         lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr_deferred(rocblas_handle               handle,
+                                                    rocblas_rank_update          update,
+                                                    rocblas_fill                 uplo,
+                                                    rocblas_int                  n,
+                                                    const rocblas_float_complex* alpha,
+                                                    const rocblas_float_complex* x,
+                                                    rocblas_int                  incx,
+                                                    rocblas_float_complex*       A,
+                                                    rocblas_int                  lda);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHER performs the matrix-vector operations
+    xSYR_DEFERRED performs the deferred matrix-vector operations
 
-        A := A + alpha*x*x**H
+        A := A + alpha*x*x**T
 
-    where alpha is a real scalar, x is a vector, and A is an
-    n by n Hermitian matrix.
+    where alpha is a scalar, x is a vector, and A is an
+    n by n symmetric matrix.
+
+    The update is not applied immediately: the vectors are appended to update, and all its
+    pending updates are applied together as a single rank-k update when k vectors are pending,
+    when an update of another matrix or of another kind is made with update, or by
+    rocblas_rank_update_flush. A must not be accessed by other functions in the meantime,
+    and x may be modified as soon as the function returns.
+    Each pending update takes one column of the n by k panels of update, and the pending updates
+    are applied with xSYRKX.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
+    @param[inout]
+    update    [rocblas_rank_update]
+              buffer of the pending updates, created with rocblas_create_rank_update.
     @param[in]
     uplo      [rocblas_fill]
               specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of A is supplied in A.
-              rocblas_fill_lower: The lower triangular part of A is supplied in A.
+              triangular part of A is updated.
     @param[in]
     n         [rocblas_int]
-              the number of rows and columns of matrix A, must be at least 0.
+              the number of rows and columns of matrix A.
     @param[in]
     alpha
               device pointer or host pointer to scalar alpha.
@@ -3996,205 +4615,228 @@ ROCBLAS_EXPORT rocblas_status rocblas_cher(rocblas_handle               handle,
     incx      [rocblas_int]
               specifies the increment for the elements of x.
     @param[inout]
-    A         device pointer storing the specified triangular portion of
-              the Hermitian matrix A. Of size (lda * n).
-              if uplo == rocblas_fill_upper:
-                The upper triangular portion of the Hermitian matrix A is supplied. The lower
-                triangluar portion will not be touched.
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of the Hermitian matrix A is supplied. The upper
-                triangular portion will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    A         device pointer storing the symmetric matrix A.
     @param[in]
     lda       [rocblas_int]
-              specifies the leading dimension of A. Must be at least max(1, n).
+              specifies the leading dimension of A.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zher(rocblas_handle                handle,
-                                           rocblas_fill                  uplo,
-                                           rocblas_int                   n,
-                                           const double*                 alpha,
-                                           const rocblas_double_complex* x,
-                                           rocblas_int                   incx,
-                                           rocblas_double_complex*       A,
-                                           rocblas_int                   lda);
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr_deferred(rocblas_handle                handle,
+                                                    rocblas_rank_update           update,
+                                                    rocblas_fill                  uplo,
+                                                    rocblas_int                   n,
+                                                    const rocblas_double_complex* alpha,
+                                                    const rocblas_double_complex* x,
+                                                    rocblas_int                   incx,
+                                                    rocblas_double_complex*       A,
+                                                    rocblas_int                   lda);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cher_batched(rocblas_handle                     handle,
-                                                   rocblas_fill                       uplo,
-                                                   rocblas_int                        n,
-                                                   const float*                       alpha,
-                                                   const rocblas_float_complex* const x[],
-                                                   rocblas_int                        incx,
-                                                   rocblas_float_complex* const       A[],
-                                                   rocblas_int                        lda,
-                                                   rocblas_int                        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_cher_deferred(rocblas_handle               handle,
+                                                    rocblas_rank_update          update,
+                                                    rocblas_fill                 uplo,
+                                                    rocblas_int                  n,
+                                                    const float*                 alpha,
+                                                    const rocblas_float_complex* x,
+                                                    rocblas_int                  incx,
+                                                    rocblas_float_complex*       A,
+                                                    rocblas_int                  lda);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHER_BATCHED performs the matrix-vector operations
+    xHER_DEFERRED performs the deferred matrix-vector operations
 
-        A_i := A_i + alpha*x_i*x_i**H
+        A := A + alpha*x*x**H
 
-    where alpha is a real scalar, x_i is a vector, and A_i is an
-    n by n symmetric matrix, for i = 1, ..., batch_count.
+    where alpha is a real scalar, x is a vector, and A is an
+    n by n Hermitian matrix.
+
+    The update is not applied immediately: the vectors are appended to update, and all its
+    pending updates are applied together as a single rank-k update when k vectors are pending,
+    when an update of another matrix or of another kind is made with update, or by
+    rocblas_rank_update_flush. A must not be accessed by other functions in the meantime,
+    and x may be modified as soon as the function returns.
+    Each pending update takes one column of the n by k panels of update, and the pending updates
+    are applied with xHERKX.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
+    @param[inout]
+    update    [rocblas_rank_update]
+              buffer of the pending updates, created with rocblas_create_rank_update.
     @param[in]
     uplo      [rocblas_fill]
               specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of each A_i is supplied in A.
-              rocblas_fill_lower: The lower triangular part of each A_i is supplied in A.
+              triangular part of A is updated.
     @param[in]
     n         [rocblas_int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
+              the number of rows and columns of matrix A.
     @param[in]
     alpha
               device pointer or host pointer to scalar alpha.
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    x         device pointer storing vector x.
     @param[in]
     incx      [rocblas_int]
-              specifies the increment for the elements of each x_i.
+              specifies the increment for the elements of x.
     @param[inout]
-    A         device array of device pointers storing the specified triangular portion of
-              each Hermitian matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batch_count.
-              if uplo == rocblas_fill_upper:
-                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular portion
-                of each A_i will not be touched.
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular portion
-                of each A_i will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    A         device pointer storing the Hermitian matrix A. The imaginary parts of the
+              diagonal elements are not accessed and are assumed to be 0.
     @param[in]
     lda       [rocblas_int]
-              specifies the leading dimension of each A_i. Must be at least max(1, n).
-    @param[in]
-    batch_count [rocblas_int]
-                number of instances in the batch.
+              specifies the leading dimension of A.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zher_batched(rocblas_handle                      handle,
-                                                   rocblas_fill                        uplo,
-                                                   rocblas_int                         n,
-                                                   const double*                       alpha,
-                                                   const rocblas_double_complex* const x[],
-                                                   rocblas_int                         incx,
-                                                   rocblas_double_complex* const       A[],
-                                                   rocblas_int                         lda,
-                                                   rocblas_int                         batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zher_deferred(rocblas_handle                handle,
+                                                    rocblas_rank_update           update,
+                                                    rocblas_fill                  uplo,
+                                                    rocblas_int                   n,
+                                                    const double*                 alpha,
+                                                    const rocblas_double_complex* x,
+                                                    rocblas_int                   incx,
+                                                    rocblas_double_complex*       A,
+                                                    rocblas_int                   lda);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cher_strided_batched(rocblas_handle               handle,
-                                                           rocblas_fill                 uplo,
-                                                           rocblas_int                  n,
-                                                           const float*                 alpha,
-                                                           const rocblas_float_complex* x,
-                                                           rocblas_int                  incx,
-                                                           rocblas_stride               stride_x,
-                                                           rocblas_float_complex*       A,
-                                                           rocblas_int                  lda,
-                                                           rocblas_stride               stride_A,
-                                                           rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2_deferred(rocblas_handle      handle,
+                                                     rocblas_rank_update update,
+                                                     rocblas_fill        uplo,
+                                                     rocblas_int         n,
+                                                     const float*        alpha,
+                                                     const float*        x,
+                                                     rocblas_int         incx,
+                                                     const float*        y,
+                                                     rocblas_int         incy,
+                                                     float*              A,
+                                                     rocblas_int         lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2_deferred(rocblas_handle      handle,
+                                                     rocblas_rank_update update,
+                                                     rocblas_fill        uplo,
+                                                     rocblas_int         n,
+                                                     const double*       alpha,
+                                                     const double*       x,
+                                                     rocblas_int         incx,
+                                                     const double*       y,
+                                                     rocblas_int         incy,
+                                                     double*             A,
+                                                     rocblas_int         lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr2_deferred(rocblas_handle               handle,
+                                                     rocblas_rank_update          update,
+                                                     rocblas_fill                 uplo,
+                                                     rocblas_int                  n,
+                                                     const rocblas_float_complex* alpha,
+                                                     const rocblas_float_complex* x,
+                                                     rocblas_int                  incx,
+                                                     const rocblas_float_complex* y,
+                                                     rocblas_int                  incy,
+                                                     rocblas_float_complex*       A,
+                                                     rocblas_int                  lda);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHER_STRIDED_BATCHED performs the matrix-vector operations
+    xSYR2_DEFERRED performs the deferred matrix-vector operations
 
-        A_i := A_i + alpha*x_i*x_i**H
+        A := A + alpha*x*y**T + alpha*y*x**T
 
-    where alpha is a real scalar, x_i is a vector, and A_i is an
-    n by n Hermitian matrix, for i = 1, ..., batch_count.
+    where alpha is a scalar, x and y are vectors, and A is an
+    n by n symmetric matrix.
+
+    The update is not applied immediately: the vectors are appended to update, and all its
+    pending updates are applied together as a single rank-k update when k vectors are pending,
+    when an update of another matrix or of another kind is made with update, or by
+    rocblas_rank_update_flush. A must not be accessed by other functions in the meantime,
+    and x and y may be modified as soon as the function returns.
+    Each pending update takes two columns of the n by k panels of update, and the pending updates
+    are applied with xSYRKX.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
+    @param[inout]
+    update    [rocblas_rank_update]
+              buffer of the pending updates, created with rocblas_create_rank_update.
     @param[in]
     uplo      [rocblas_fill]
               specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of each A_i is supplied in A.
-              rocblas_fill_lower: The lower triangular part of each A_i is supplied in A.
+              triangular part of A is updated.
     @param[in]
     n         [rocblas_int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
+              the number of rows and columns of matrix A.
     @param[in]
     alpha
               device pointer or host pointer to scalar alpha.
     @param[in]
-    x         device pointer pointing to the first vector (x_1).
+    x         device pointer storing vector x.
     @param[in]
     incx      [rocblas_int]
-              specifies the increment for the elements of each x_i.
+              specifies the increment for the elements of x.
     @param[in]
-    stride_x  [rocblas_stride]
-              stride from the start of one vector (x_i) and the next one (x_i+1).
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
     @param[inout]
-    A         device array of device pointers storing the specified triangular portion of
-              each Hermitian matrix A_i. Points to the first matrix (A_1).
-              if uplo == rocblas_fill_upper:
-                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
-                portion of each A_i will not be touched.
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
-                portion of each A_i will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    A         device pointer storing the symmetric matrix A.
     @param[in]
     lda       [rocblas_int]
-              specifies the leading dimension of each A_i.
-    @param[in]
-    stride_A    [rocblas_stride]
-                stride from the start of one (A_i) and the next (A_i+1)
-    @param[in]
-    batch_count [rocblas_int]
-                number of instances in the batch.
+              specifies the leading dimension of A.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zher_strided_batched(rocblas_handle                handle,
-                                                           rocblas_fill                  uplo,
-                                                           rocblas_int                   n,
-                                                           const double*                 alpha,
-                                                           const rocblas_double_complex* x,
-                                                           rocblas_int                   incx,
-                                                           rocblas_stride                stride_x,
-                                                           rocblas_double_complex*       A,
-                                                           rocblas_int                   lda,
-                                                           rocblas_stride                stride_A,
-                                                           rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_cher2(rocblas_handle               handle,
-                                            rocblas_fill                 uplo,
-                                            rocblas_int                  n,
-                                            const rocblas_float_complex* alpha,
-                                            const rocblas_float_complex* x,
-                                            rocblas_int                  incx,
-                                            const rocblas_float_complex* y,
-                                            rocblas_int                  incy,
-                                            rocblas_float_complex*       A,
-                                            rocblas_int                  lda);
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr2_deferred(rocblas_handle                handle,
+                                                     rocblas_rank_update           update,
+                                                     rocblas_fill                  uplo,
+                                                     rocblas_int                   n,
+                                                     const rocblas_double_complex* alpha,
+                                                     const rocblas_double_complex* x,
+                                                     rocblas_int                   incx,
+                                                     const rocblas_double_complex* y,
+                                                     rocblas_int                   incy,
+                                                     rocblas_double_complex*       A,
+                                                     rocblas_int                   lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher2_deferred(rocblas_handle               handle,
+                                                     rocblas_rank_update          update,
+                                                     rocblas_fill                 uplo,
+                                                     rocblas_int                  n,
+                                                     const rocblas_float_complex* alpha,
+                                                     const rocblas_float_complex* x,
+                                                     rocblas_int                  incx,
+                                                     const rocblas_float_complex* y,
+                                                     rocblas_int                  incy,
+                                                     rocblas_float_complex*       A,
+                                                     rocblas_int                  lda);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHER2 performs the matrix-vector operations
+    xHER2_DEFERRED performs the deferred matrix-vector operations
 
         A := A + alpha*x*y**H + conj(alpha)*y*x**H
 
     where alpha is a complex scalar, x and y are vectors, and A is an
     n by n Hermitian matrix.
 
+    The update is not applied immediately: the vectors are appended to update, and all its
+    pending updates are applied together as a single rank-k update when k vectors are pending,
+    when an update of another matrix or of another kind is made with update, or by
+    rocblas_rank_update_flush. A must not be accessed by other functions in the meantime,
+    and x and y may be modified as soon as the function returns.
+    Each pending update takes two columns of the n by k panels of update, and the pending updates
+    are applied with xHERKX.
+
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
+    @param[inout]
+    update    [rocblas_rank_update]
+              buffer of the pending updates, created with rocblas_create_rank_update.
     @param[in]
     uplo      [rocblas_fill]
               specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of A is supplied.
-              rocblas_fill_lower: The lower triangular part of A is supplied.
+              triangular part of A is updated.
     @param[in]
     n         [rocblas_int]
-              the number of rows and columns of matrix A, must be at least 0.
+              the number of rows and columns of matrix A.
     @param[in]
     alpha
               device pointer or host pointer to scalar alpha.
@@ -4209,203 +4851,31 @@ ROCBLAS_EXPORT rocblas_status rocblas_cher2(rocblas_handle               handle,
     incy      [rocblas_int]
               specifies the increment for the elements of y.
     @param[inout]
-    A         device pointer storing the specified triangular portion of
-              the Hermitian matrix A. Of size (lda, n).
-              if uplo == rocblas_fill_upper:
-                The upper triangular portion of the Hermitian matrix A is supplied. The lower triangular
-                portion of A will not be touched.
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of the Hermitian matrix A is supplied. The upper triangular
-                portion of A will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    A         device pointer storing the Hermitian matrix A. The imaginary parts of the
+              diagonal elements are not accessed and are assumed to be 0.
     @param[in]
     lda       [rocblas_int]
-              specifies the leading dimension of A. Must be at least max(lda, 1).
+              specifies the leading dimension of A.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zher2(rocblas_handle                handle,
-                                            rocblas_fill                  uplo,
-                                            rocblas_int                   n,
-                                            const rocblas_double_complex* alpha,
-                                            const rocblas_double_complex* x,
-                                            rocblas_int                   incx,
-                                            const rocblas_double_complex* y,
-                                            rocblas_int                   incy,
-                                            rocblas_double_complex*       A,
-                                            rocblas_int                   lda);
-
-ROCBLAS_EXPORT rocblas_status rocblas_cher2_batched(rocblas_handle                     handle,
-                                                    rocblas_fill                       uplo,
-                                                    rocblas_int                        n,
-                                                    const rocblas_float_complex*       alpha,
-                                                    const rocblas_float_complex* const x[],
-                                                    rocblas_int                        incx,
-                                                    const rocblas_float_complex* const y[],
-                                                    rocblas_int                        incy,
-                                                    rocblas_float_complex* const       A[],
-                                                    rocblas_int                        lda,
-                                                    rocblas_int                        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zher2_deferred(rocblas_handle                handle,
+                                                     rocblas_rank_update           update,
+                                                     rocblas_fill                  uplo,
+                                                     rocblas_int                   n,
+                                                     const rocblas_double_complex* alpha,
+                                                     const rocblas_double_complex* x,
+                                                     rocblas_int                   incx,
+                                                     const rocblas_double_complex* y,
+                                                     rocblas_int                   incy,
+                                                     rocblas_double_complex*       A,
+                                                     rocblas_int                   lda);
 
-/*! \brief BLAS Level 2 API
-
-    \details
-    xHER2_BATCHED performs the matrix-vector operations
-
-        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
-
-    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
-    n by n Hermitian matrix for each batch in i = [1, batch_count].
-
-    @param[in]
-    handle    [rocblas_handle]
-              handle to the rocblas library context queue.
-    @param[in]
-    uplo      [rocblas_fill]
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of each A_i is supplied.
-              rocblas_fill_lower: The lower triangular part of each A_i is supplied.
-    @param[in]
-    n         [rocblas_int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
-    @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
-    @param[in]
-    x         device array of device pointers storing each vector x_i.
-    @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of x.
-    @param[in]
-    y         device array of device pointers storing each vector y_i.
-    @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of each y_i.
-    @param[inout]
-    A         device array of device pointers storing the specified triangular portion of
-              each Hermitian matrix A_i of size (lda, n).
-              if uplo == rocblas_fill_upper:
-                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
-                portion of each A_i will not be touched.
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
-                portion of each A_i will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
-    @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of each A_i. Must be at least max(lda, 1).
-    @param[in]
-    batch_count [rocblas_int]
-                number of instances in the batch.
-    ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zher2_batched(rocblas_handle                      handle,
-                                                    rocblas_fill                        uplo,
-                                                    rocblas_int                         n,
-                                                    const rocblas_double_complex*       alpha,
-                                                    const rocblas_double_complex* const x[],
-                                                    rocblas_int                         incx,
-                                                    const rocblas_double_complex* const y[],
-                                                    rocblas_int                         incy,
-                                                    rocblas_double_complex* const       A[],
-                                                    rocblas_int                         lda,
-                                                    rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_cher2_strided_batched(rocblas_handle               handle,
-                                                            rocblas_fill                 uplo,
-                                                            rocblas_int                  n,
-                                                            const rocblas_float_complex* alpha,
-                                                            const rocblas_float_complex* x,
-                                                            rocblas_int                  incx,
-                                                            rocblas_stride               stride_x,
-                                                            const rocblas_float_complex* y,
-                                                            rocblas_int                  incy,
-                                                            rocblas_stride               stride_y,
-                                                            rocblas_float_complex*       A,
-                                                            rocblas_int                  lda,
-                                                            rocblas_stride               stride_A,
-                                                            rocblas_int batch_count);
-/*! \brief BLAS Level 2 API
-
-    \details
-    xHER2_STRIDED_BATCHED performs the matrix-vector operations
-
-        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
-
-    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
-    n by n Hermitian matrix for each batch in i = [1, batch_count].
-
-    @param[in]
-    handle    [rocblas_handle]
-              handle to the rocblas library context queue.
-    @param[in]
-    uplo      [rocblas_fill]
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of each A_i is supplied.
-              rocblas_fill_lower: The lower triangular part of each A_i is supplied.
-    @param[in]
-    n         [rocblas_int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
-    @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
-    @param[in]
-    x         device pointer pointing to the first vector x_1.
-    @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of each x_i.
-    @param[in]
-    stride_x  [rocblas_stride]
-              specifies the stride between the beginning of one vector (x_i) and the next (x_i+1).
-    @param[in]
-    y         device pointer pointing to the first vector y_i.
-    @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of each y_i.
-    @param[in]
-    stride_y  [rocblas_stride]
-              specifies the stride between the beginning of one vector (y_i) and the next (y_i+1).
-    @param[inout]
-    A         device pointer pointing to the first matrix (A_1). Stores the specified triangular portion of
-              each Hermitian matrix A_i.
-              if uplo == rocblas_fill_upper:
-                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
-                portion of each A_i will not be touched.
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
-                portion of each A_i will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
-    @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of each A_i. Must be at least max(lda, 1).
-    @param[in]
-    stride_A  [rocblas_stride]
-              specifies the stride between the beginning of one matrix (A_i) and the next (A_i+1).
-    @param[in]
-    batch_count [rocblas_int]
-                number of instances in the batch.
-    ********************************************************************/
-
-ROCBLAS_EXPORT rocblas_status rocblas_zher2_strided_batched(rocblas_handle                handle,
-                                                            rocblas_fill                  uplo,
-                                                            rocblas_int                   n,
-                                                            const rocblas_double_complex* alpha,
-                                                            const rocblas_double_complex* x,
-                                                            rocblas_int                   incx,
-                                                            rocblas_stride                stride_x,
-                                                            const rocblas_double_complex* y,
-                                                            rocblas_int                   incy,
-                                                            rocblas_stride                stride_y,
-                                                            rocblas_double_complex*       A,
-                                                            rocblas_int                   lda,
-                                                            rocblas_stride                stride_A,
-                                                            rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_chpmv(rocblas_handle               handle,
+ROCBLAS_EXPORT rocblas_status rocblas_chbmv(rocblas_handle               handle,
                                             rocblas_fill                 uplo,
                                             rocblas_int                  n,
+                                            rocblas_int                  k,
                                             const rocblas_float_complex* alpha,
-                                            const rocblas_float_complex* AP,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
                                             const rocblas_float_complex* x,
                                             rocblas_int                  incx,
                                             const rocblas_float_complex* beta,
@@ -4415,52 +4885,61 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpmv(rocblas_handle               handle,
 /*! \brief BLAS Level 2 API
 
     \details
-    xHPMV performs the matrix-vector operation
+    xHBMV performs the matrix-vector operations
 
         y := alpha*A*x + beta*y
 
     where alpha and beta are scalars, x and y are n element vectors and A is an
-    n by n Hermitian matrix, supplied in packed form (see description below).
+    n by n Hermitian band matrix, with k super-diagonals.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
     uplo      [rocblas_fill]
-              rocblas_fill_upper: the upper triangular part of the Hermitian matrix A is supplied in AP.
-              rocblas_fill_lower: the lower triangular part of the Hermitian matrix A is supplied in AP.
+              rocblas_fill_upper: The upper triangular part of A is being supplied.
+              rocblas_fill_lower: The lower triangular part of A is being supplied.
     @param[in]
     n         [rocblas_int]
-              the order of the matrix A, must be >= 0.
+              the order of the matrix A.
+    @param[in]
+    k         [rocblas_int]
+              the number of super-diagonals of the matrix A. Must be >= 0.
     @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    AP        device pointer storing the packed version of the specified triangular portion of
-              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
+    A         device pointer storing matrix A. Of dimension (lda, n).
               if uplo == rocblas_fill_upper:
-                The upper triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (rocblas_fill_upper; n = 3)
-                        (1, 0) (2, 1) (3, 2)
-                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
-                        (3,-2) (5, 1) (6, 0)
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (rocblas_fill_lower; n = 3)
-                        (1, 0) (2, 1) (3, 2)
-                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
-                        (3,-2) (5, 1) (6, 0)
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+                The leading (k + 1) by n part of A must contain the upper
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (k + 1), the first super-diagonal on the RHS
+                of row k, etc.
+                The top left k by x triangle of A will not be referenced.
+                    Ex (upper, lda = n = 4, k = 1):
+                    A                             Represented matrix
+                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
+                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
+
+              if uplo == rocblas_fill_lower:
+                The leading (k + 1) by n part of A must contain the lower
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (1), the first sub-diagonal on the LHS of
+                row 2, etc.
+                The bottom right k by k triangle of A will not be referenced.
+                    Ex (lower, lda = 2, n = 4, k = 1):
+                    A                               Represented matrix
+                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
+                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
+                                                    (0, 0) (6, 8) (3, 0) (7,-7)
+                                                    (0, 0) (0, 0) (7, 7) (4, 0)
+
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of A will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A. must be >= k + 1
     @param[in]
     x         device pointer storing vector x.
     @param[in]
@@ -4475,22 +4954,26 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpmv(rocblas_handle               handle,
               specifies the increment for the elements of y.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhpmv(rocblas_handle                handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zhbmv(rocblas_handle                handle,
                                             rocblas_fill                  uplo,
                                             rocblas_int                   n,
+                                            rocblas_int                   k,
                                             const rocblas_double_complex* alpha,
-                                            const rocblas_double_complex* AP,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
                                             const rocblas_double_complex* x,
                                             rocblas_int                   incx,
                                             const rocblas_double_complex* beta,
                                             rocblas_double_complex*       y,
                                             rocblas_int                   incy);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chpmv_batched(rocblas_handle                     handle,
+ROCBLAS_EXPORT rocblas_status rocblas_chbmv_batched(rocblas_handle                     handle,
                                                     rocblas_fill                       uplo,
                                                     rocblas_int                        n,
+                                                    rocblas_int                        k,
                                                     const rocblas_float_complex*       alpha,
-                                                    const rocblas_float_complex* const AP[],
+                                                    const rocblas_float_complex* const A[],
+                                                    rocblas_int                        lda,
                                                     const rocblas_float_complex* const x[],
                                                     rocblas_int                        incx,
                                                     const rocblas_float_complex*       beta,
@@ -4501,53 +4984,61 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpmv_batched(rocblas_handle
 /*! \brief BLAS Level 2 API
 
     \details
-    xHPMV_BATCHED performs the matrix-vector operation
+    xHBMV_BATCHED performs one of the matrix-vector operations
 
         y_i := alpha*A_i*x_i + beta*y_i
 
     where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian matrix, supplied in packed form (see description below),
-    for each batch in i = [1, batch_count].
+    n by n Hermitian band matrix with k super-diagonals, for each batch in i = [1, batch_count].
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
     uplo      [rocblas_fill]
-              rocblas_fill_upper: the upper triangular part of each Hermitian matrix A_i is supplied in AP.
-              rocblas_fill_lower: the lower triangular part of each Hermitian matrix A_i is supplied in AP.
+              rocblas_fill_upper: The upper triangular part of each A_i is being supplied.
+              rocblas_fill_lower: The lower triangular part of each A_i is being supplied.
     @param[in]
     n         [rocblas_int]
               the order of each matrix A_i.
     @param[in]
+    k         [rocblas_int]
+              the number of super-diagonals of each matrix A_i. Must be >= 0.
+    @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    AP      device pointer of device pointers storing the packed version of the specified triangular
-            portion of each Hermitian matrix A_i. Each A_i is of at least size ((n * (n + 1)) / 2).
-            if uplo == rocblas_fill_upper:
-            The upper triangular portion of each Hermitian matrix A_i is supplied.
-            The matrix is compacted so that each AP_i contains the triangular portion column-by-column
-            so that:
-            AP(0) = A(0,0)
-            AP(1) = A(0,1)
-            AP(2) = A(1,1), etc.
-                Ex: (rocblas_fill_upper; n = 3)
-                    (1, 0) (2, 1) (3, 2)
-                    (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
-                    (3,-2) (5, 1) (6, 0)
-        if uplo == rocblas_fill_lower:
-            The lower triangular portion of each Hermitian matrix A_i is supplied.
-            The matrix is compacted so that each AP_i contains the triangular portion column-by-column
-            so that:
-            AP(0) = A(0,0)
-            AP(1) = A(1,0)
-            AP(2) = A(2,1), etc.
-                Ex: (rocblas_fill_lower; n = 3)
-                    (1, 0) (2, 1) (3, 2)
-                    (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
-                    (3,-2) (5, 1) (6, 0)
-        Note that the imaginary part of the diagonal elements are not accessed and are assumed
-        to be 0.
+    A         device array of device pointers storing each matrix_i A of dimension (lda, n).
+              if uplo == rocblas_fill_upper:
+                The leading (k + 1) by n part of each A_i must contain the upper
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (k + 1), the first super-diagonal on the RHS
+                of row k, etc.
+                The top left k by x triangle of each A_i will not be referenced.
+                    Ex (upper, lda = n = 4, k = 1):
+                    A                             Represented matrix
+                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
+                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
+
+              if uplo == rocblas_fill_lower:
+                The leading (k + 1) by n part of each A_i must contain the lower
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (1), the first sub-diagonal on the LHS of
+                row 2, etc.
+                The bottom right k by k triangle of each A_i will not be referenced.
+                    Ex (lower, lda = 2, n = 4, k = 1):
+                    A                               Represented matrix
+                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
+                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
+                                                    (0, 0) (6, 8) (3, 0) (7,-7)
+                                                    (0, 0) (0, 0) (7, 7) (4, 0)
+
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of each A_i will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. must be >= max(1, n)
     @param[in]
     x         device array of device pointers storing each vector x_i.
     @param[in]
@@ -4565,11 +5056,13 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpmv_batched(rocblas_handle
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhpmv_batched(rocblas_handle                      handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zhbmv_batched(rocblas_handle                      handle,
                                                     rocblas_fill                        uplo,
                                                     rocblas_int                         n,
+                                                    rocblas_int                         k,
                                                     const rocblas_double_complex*       alpha,
-                                                    const rocblas_double_complex* const AP[],
+                                                    const rocblas_double_complex* const A[],
+                                                    rocblas_int                         lda,
                                                     const rocblas_double_complex* const x[],
                                                     rocblas_int                         incx,
                                                     const rocblas_double_complex*       beta,
@@ -4577,11 +5070,13 @@ ROCBLAS_EXPORT rocblas_status rocblas_zhpmv_batched(rocblas_handle
                                                     rocblas_int                         incy,
                                                     rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chpmv_strided_batched(rocblas_handle               handle,
+ROCBLAS_EXPORT rocblas_status rocblas_chbmv_strided_batched(rocblas_handle               handle,
                                                             rocblas_fill                 uplo,
                                                             rocblas_int                  n,
+                                                            rocblas_int                  k,
                                                             const rocblas_float_complex* alpha,
-                                                            const rocblas_float_complex* AP,
+                                                            const rocblas_float_complex* A,
+                                                            rocblas_int                  lda,
                                                             rocblas_stride               stride_A,
                                                             const rocblas_float_complex* x,
                                                             rocblas_int                  incx,
@@ -4595,84 +5090,94 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpmv_strided_batched(rocblas_handle
 /*! \brief BLAS Level 2 API
 
     \details
-    xHPMV_STRIDED_BATCHED performs the matrix-vector operation
+    xHBMV_STRIDED_BATCHED performs one of the matrix-vector operations
 
         y_i := alpha*A_i*x_i + beta*y_i
 
     where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian matrix, supplied in packed form (see description below),
-    for each batch in i = [1, batch_count].
+    n by n Hermitian band matrix with k super-diagonals, for each batch in i = [1, batch_count].
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
     uplo      [rocblas_fill]
-              rocblas_fill_upper: the upper triangular part of each Hermitian matrix A_i is supplied in AP.
-              rocblas_fill_lower: the lower triangular part of each Hermitian matrix A_i is supplied in AP.
+              rocblas_fill_upper: The upper triangular part of each A_i is being supplied.
+              rocblas_fill_lower: The lower triangular part of each A_i is being supplied.
     @param[in]
     n         [rocblas_int]
               the order of each matrix A_i.
     @param[in]
+    k         [rocblas_int]
+              the number of super-diagonals of each matrix A_i. Must be >= 0.
+    @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    AP        device pointer pointing to the beginning of the first matrix (AP_1). Stores the packed
-              version of the specified triangular portion of each Hermitian matrix AP_i of size ((n * (n + 1)) / 2).
+    A         device array pointing to the first matrix A_1. Each A_i is of dimension (lda, n).
               if uplo == rocblas_fill_upper:
-                The upper triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that each AP_i contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (rocblas_fill_upper; n = 3)
-                        (1, 0) (2, 1) (3, 2)
-                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
-                        (3,-2) (5, 1) (6, 0)
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that each AP_i contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (rocblas_fill_lower; n = 3)
-                        (1, 0) (2, 1) (3, 2)
-                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
-                        (3,-2) (5, 1) (6, 0)
-        Note that the imaginary part of the diagonal elements are not accessed and are assumed
-        to be 0.
+                The leading (k + 1) by n part of each A_i must contain the upper
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (k + 1), the first super-diagonal on the RHS
+                of row k, etc.
+                The top left k by x triangle of each A_i will not be referenced.
+                    Ex (upper, lda = n = 4, k = 1):
+                    A                             Represented matrix
+                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
+                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
+
+              if uplo == rocblas_fill_lower:
+                The leading (k + 1) by n part of each A_i must contain the lower
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (1), the first sub-diagonal on the LHS of
+                row 2, etc.
+                The bottom right k by k triangle of each A_i will not be referenced.
+                    Ex (lower, lda = 2, n = 4, k = 1):
+                    A                               Represented matrix
+                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
+                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
+                                                    (0, 0) (6, 8) (3, 0) (7,-7)
+                                                    (0, 0) (0, 0) (7, 7) (4, 0)
+
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of each A_i will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. must be >= max(1, n)
     @param[in]
     stride_A  [rocblas_stride]
-              stride from the start of one matrix (AP_i) and the next one (AP_i+1).
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
     @param[in]
-    x         device array pointing to the beginning of the first vector (x_1).
+    x         device array pointing to the first vector y_1.
     @param[in]
     incx      [rocblas_int]
               specifies the increment for the elements of each x_i.
     @param[in]
     stride_x  [rocblas_stride]
-              stride from the start of one vector (x_i) and the next one (x_i+1).
+              stride from the start of one vector (x_i) and the next one (x_i+1)
     @param[in]
     beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    y         device array pointing to the beginning of the first vector (y_1).
+    y         device array pointing to the first vector y_1.
     @param[in]
     incy      [rocblas_int]
               specifies the increment for the elements of y.
     @param[in]
     stride_y  [rocblas_stride]
-              stride from the start of one vector (y_i) and the next one (y_i+1).
+              stride from the start of one vector (y_i) and the next one (y_i+1)
     @param[in]
     batch_count [rocblas_int]
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhpmv_strided_batched(rocblas_handle                handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zhbmv_strided_batched(rocblas_handle                handle,
                                                             rocblas_fill                  uplo,
                                                             rocblas_int                   n,
+                                                            rocblas_int                   k,
                                                             const rocblas_double_complex* alpha,
-                                                            const rocblas_double_complex* AP,
+                                                            const rocblas_double_complex* A,
+                                                            rocblas_int                   lda,
                                                             rocblas_stride                stride_A,
                                                             const rocblas_double_complex* x,
                                                             rocblas_int                   incx,
@@ -4683,264 +5188,265 @@ ROCBLAS_EXPORT rocblas_status rocblas_zhpmv_strided_batched(rocblas_handle
                                                             rocblas_stride                stride_y,
                                                             rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chpr(rocblas_handle               handle,
-                                           rocblas_fill                 uplo,
-                                           rocblas_int                  n,
-                                           const float*                 alpha,
-                                           const rocblas_float_complex* x,
-                                           rocblas_int                  incx,
-                                           rocblas_float_complex*       AP);
+ROCBLAS_EXPORT rocblas_status rocblas_chemv(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex*       y,
+                                            rocblas_int                  incy);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHPR performs the matrix-vector operations
+    xHEMV performs one of the matrix-vector operations
 
-        A := A + alpha*x*x**H
+        y := alpha*A*x + beta*y
 
-    where alpha is a real scalar, x is a vector, and A is an
-    n by n Hermitian matrix, supplied in packed form.
+    where alpha and beta are scalars, x and y are n element vectors and A is an
+    n by n Hermitian matrix.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
     uplo      [rocblas_fill]
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of A is supplied in AP.
-              rocblas_fill_lower: The lower triangular part of A is supplied in AP.
+              rocblas_fill_upper: the upper triangular part of the Hermitian matrix A is supplied.
+              rocblas_fill_lower: the lower triangular part of the Hermitian matrix A is supplied.
     @param[in]
     n         [rocblas_int]
-              the number of rows and columns of matrix A, must be at least 0.
+              the order of the matrix A.
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A. Of dimension (lda, n).
+              if uplo == rocblas_fill_upper:
+                The upper triangular part of A must contain
+                the upper triangular part of a Hermitian matrix. The lower
+                triangular part of A will not be referenced.
+              if uplo == rocblas_fill_lower:
+                The lower triangular part of A must contain
+                the lower triangular part of a Hermitian matrix. The upper
+                triangular part of A will not be referenced.
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of A will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A. must be >= max(1, n)
     @param[in]
     x         device pointer storing vector x.
     @param[in]
     incx      [rocblas_int]
               specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    AP        device pointer storing the packed version of the specified triangular portion of
-              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
-              if uplo == rocblas_fill_upper:
-                The upper triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (rocblas_fill_upper; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (rocblas_fill_lower; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhpr(rocblas_handle                handle,
-                                           rocblas_fill                  uplo,
-                                           rocblas_int                   n,
-                                           const double*                 alpha,
-                                           const rocblas_double_complex* x,
-                                           rocblas_int                   incx,
-                                           rocblas_double_complex*       AP);
+ROCBLAS_EXPORT rocblas_status rocblas_zhemv(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex*       y,
+                                            rocblas_int                   incy);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chpr_batched(rocblas_handle                     handle,
-                                                   rocblas_fill                       uplo,
-                                                   rocblas_int                        n,
-                                                   const float*                       alpha,
-                                                   const rocblas_float_complex* const x[],
-                                                   rocblas_int                        incx,
-                                                   rocblas_float_complex* const       AP[],
-                                                   rocblas_int                        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_chemv_batched(rocblas_handle                     handle,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_int                        n,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const A[],
+                                                    rocblas_int                        lda,
+                                                    const rocblas_float_complex* const x[],
+                                                    rocblas_int                        incx,
+                                                    const rocblas_float_complex*       beta,
+                                                    rocblas_float_complex* const       y[],
+                                                    rocblas_int                        incy,
+                                                    rocblas_int                        batch_count);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHPR_BATCHED performs the matrix-vector operations
+    xHEMV_BATCHED performs one of the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*x_i**H
+        y_i := alpha*A_i*x_i + beta*y_i
 
-    where alpha is a real scalar, x_i is a vector, and A_i is an
-    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batch_count.
+    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
+    n by n Hermitian matrix, for each batch in i = [1, batch_count].
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
     uplo      [rocblas_fill]
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of each A_i is supplied in AP.
-              rocblas_fill_lower: The lower triangular part of each A_i is supplied in AP.
+              rocblas_fill_upper: the upper triangular part of the Hermitian matrix A is supplied.
+              rocblas_fill_lower: the lower triangular part of the Hermitian matrix A is supplied.
     @param[in]
     n         [rocblas_int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
+              the order of each matrix A_i.
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    A         device array of device pointers storing each matrix A_i of dimension (lda, n).
+              if uplo == rocblas_fill_upper:
+                The upper triangular part of each A_i must contain
+                the upper triangular part of a Hermitian matrix. The lower
+                triangular part of each A_i will not be referenced.
+              if uplo == rocblas_fill_lower:
+                The lower triangular part of each A_i must contain
+                the lower triangular part of a Hermitian matrix. The upper
+                triangular part of each A_i will not be referenced.
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of each A_i will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. must be >= max(1, n)
     @param[in]
     x         device array of device pointers storing each vector x_i.
     @param[in]
     incx      [rocblas_int]
               specifies the increment for the elements of each x_i.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    AP        device array of device pointers storing the packed version of the specified triangular portion of
-              each Hermitian matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batch_count.
-              if uplo == rocblas_fill_upper:
-                The upper triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (rocblas_fill_upper; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (rocblas_fill_lower; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
     @param[in]
     batch_count [rocblas_int]
                 number of instances in the batch.
+
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhpr_batched(rocblas_handle                      handle,
-                                                   rocblas_fill                        uplo,
-                                                   rocblas_int                         n,
-                                                   const double*                       alpha,
-                                                   const rocblas_double_complex* const x[],
-                                                   rocblas_int                         incx,
-                                                   rocblas_double_complex* const       AP[],
-                                                   rocblas_int                         batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zhemv_batched(rocblas_handle                      handle,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_int                         n,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const A[],
+                                                    rocblas_int                         lda,
+                                                    const rocblas_double_complex* const x[],
+                                                    rocblas_int                         incx,
+                                                    const rocblas_double_complex*       beta,
+                                                    rocblas_double_complex* const       y[],
+                                                    rocblas_int                         incy,
+                                                    rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chpr_strided_batched(rocblas_handle               handle,
-                                                           rocblas_fill                 uplo,
-                                                           rocblas_int                  n,
-                                                           const float*                 alpha,
-                                                           const rocblas_float_complex* x,
-                                                           rocblas_int                  incx,
-                                                           rocblas_stride               stride_x,
-                                                           rocblas_float_complex*       AP,
-                                                           rocblas_stride               stride_A,
-                                                           rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_chemv_strided_batched(rocblas_handle               handle,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_int                  n,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* A,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               stride_A,
+                                                            const rocblas_float_complex* x,
+                                                            rocblas_int                  incx,
+                                                            rocblas_stride               stride_x,
+                                                            const rocblas_float_complex* beta,
+                                                            rocblas_float_complex*       y,
+                                                            rocblas_int                  incy,
+                                                            rocblas_stride               stride_y,
+                                                            rocblas_int batch_count);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHPR_STRIDED_BATCHED performs the matrix-vector operations
+    xHEMV_STRIDED_BATCHED performs one of the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*x_i**H
+        y_i := alpha*A_i*x_i + beta*y_i
 
-    where alpha is a real scalar, x_i is a vector, and A_i is an
-    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batch_count.
+    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
+    n by n Hermitian matrix, for each batch in i = [1, batch_count].
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
     uplo      [rocblas_fill]
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of each A_i is supplied in AP.
-              rocblas_fill_lower: The lower triangular part of each A_i is supplied in AP.
+              rocblas_fill_upper: the upper triangular part of the Hermitian matrix A is supplied.
+              rocblas_fill_lower: the lower triangular part of the Hermitian matrix A is supplied.
     @param[in]
     n         [rocblas_int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
+              the order of each matrix A_i.
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    x         device pointer pointing to the first vector (x_1).
+    A         device array of device pointers storing each matrix A_i of dimension (lda, n).
+              if uplo == rocblas_fill_upper:
+                The upper triangular part of each A_i must contain
+                the upper triangular part of a Hermitian matrix. The lower
+                triangular part of each A_i will not be referenced.
+              if uplo == rocblas_fill_lower:
+                The lower triangular part of each A_i must contain
+                the lower triangular part of a Hermitian matrix. The upper
+                triangular part of each A_i will not be referenced.
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of each A_i will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. must be >= max(1, n)
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
     @param[in]
     incx      [rocblas_int]
               specifies the increment for the elements of each x_i.
     @param[in]
-    stride_x  [rocblas_stride]
-              stride from the start of one vector (x_i) and the next one (x_i+1).
+    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    AP        device array of device pointers storing the packed version of the specified triangular portion of
-              each Hermitian matrix A_i. Points to the first matrix (A_1).
-              if uplo == rocblas_fill_upper:
-                The upper triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (rocblas_fill_upper; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            if uplo == rocblas_fill_lower:
-                The lower triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (rocblas_fill_lower; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    y         device array of device pointers storing each vector y_i.
     @param[in]
-    stride_A    [rocblas_stride]
-                stride from the start of one (A_i) and the next (A_i+1)
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
     @param[in]
     batch_count [rocblas_int]
                 number of instances in the batch.
+
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhpr_strided_batched(rocblas_handle                handle,
-                                                           rocblas_fill                  uplo,
-                                                           rocblas_int                   n,
-                                                           const double*                 alpha,
-                                                           const rocblas_double_complex* x,
-                                                           rocblas_int                   incx,
-                                                           rocblas_stride                stride_x,
-                                                           rocblas_double_complex*       AP,
-                                                           rocblas_stride                stride_A,
-                                                           rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zhemv_strided_batched(rocblas_handle                handle,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_int                   n,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* A,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                stride_A,
+                                                            const rocblas_double_complex* x,
+                                                            rocblas_int                   incx,
+                                                            rocblas_stride                stride_x,
+                                                            const rocblas_double_complex* beta,
+                                                            rocblas_double_complex*       y,
+                                                            rocblas_int                   incy,
+                                                            rocblas_stride                stride_y,
+                                                            rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chpr2(rocblas_handle               handle,
-                                            rocblas_fill                 uplo,
-                                            rocblas_int                  n,
-                                            const rocblas_float_complex* alpha,
-                                            const rocblas_float_complex* x,
-                                            rocblas_int                  incx,
-                                            const rocblas_float_complex* y,
-                                            rocblas_int                  incy,
-                                            rocblas_float_complex*       AP);
+ROCBLAS_EXPORT rocblas_status rocblas_cher(rocblas_handle               handle,
+                                           rocblas_fill                 uplo,
+                                           rocblas_int                  n,
+                                           const float*                 alpha,
+                                           const rocblas_float_complex* x,
+                                           rocblas_int                  incx,
+                                           rocblas_float_complex*       A,
+                                           rocblas_int                  lda);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHPR2 performs the matrix-vector operations
+    xHER performs the matrix-vector operations
 
-        A := A + alpha*x*y**H + conj(alpha)*y*x**H
+        A := A + alpha*x*x**H
 
-    where alpha is a complex scalar, x and y are vectors, and A is an
-    n by n Hermitian matrix, supplied in packed form.
+    where alpha is a real scalar, x is a vector, and A is an
+    n by n Hermitian matrix.
 
     @param[in]
     handle    [rocblas_handle]
@@ -4948,8 +5454,8 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpr2(rocblas_handle               handle,
     @param[in]
     uplo      [rocblas_fill]
               specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of A is supplied in AP.
-              rocblas_fill_lower: The lower triangular part of A is supplied in AP.
+              rocblas_fill_upper: The upper triangular part of A is supplied in A.
+              rocblas_fill_lower: The lower triangular part of A is supplied in A.
     @param[in]
     n         [rocblas_int]
               the number of rows and columns of matrix A, must be at least 0.
@@ -4961,69 +5467,49 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpr2(rocblas_handle               handle,
     @param[in]
     incx      [rocblas_int]
               specifies the increment for the elements of x.
-    @param[in]
-    y         device pointer storing vector y.
-    @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of y.
     @param[inout]
-    AP        device pointer storing the packed version of the specified triangular portion of
-              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
+    A         device pointer storing the specified triangular portion of
+              the Hermitian matrix A. Of size (lda * n).
               if uplo == rocblas_fill_upper:
-                The upper triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (rocblas_fill_upper; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The upper triangular portion of the Hermitian matrix A is supplied. The lower
+                triangluar portion will not be touched.
             if uplo == rocblas_fill_lower:
-                The lower triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (rocblas_fill_lower; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The lower triangular portion of the Hermitian matrix A is supplied. The upper
+                triangular portion will not be touched.
             Note that the imaginary part of the diagonal elements are not accessed and are assumed
             to be 0.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A. Must be at least max(1, n).
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhpr2(rocblas_handle                handle,
-                                            rocblas_fill                  uplo,
-                                            rocblas_int                   n,
-                                            const rocblas_double_complex* alpha,
-                                            const rocblas_double_complex* x,
-                                            rocblas_int                   incx,
-                                            const rocblas_double_complex* y,
-                                            rocblas_int                   incy,
-                                            rocblas_double_complex*       AP);
+ROCBLAS_EXPORT rocblas_status rocblas_zher(rocblas_handle                handle,
+                                           rocblas_fill                  uplo,
+                                           rocblas_int                   n,
+                                           const double*                 alpha,
+                                           const rocblas_double_complex* x,
+                                           rocblas_int                   incx,
+                                           rocblas_double_complex*       A,
+                                           rocblas_int                   lda);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chpr2_batched(rocblas_handle                     handle,
-                                                    rocblas_fill                       uplo,
-                                                    rocblas_int                        n,
-                                                    const rocblas_float_complex*       alpha,
-                                                    const rocblas_float_complex* const x[],
-                                                    rocblas_int                        incx,
-                                                    const rocblas_float_complex* const y[],
-                                                    rocblas_int                        incy,
-                                                    rocblas_float_complex* const       AP[],
-                                                    rocblas_int                        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_cher_batched(rocblas_handle                     handle,
+                                                   rocblas_fill                       uplo,
+                                                   rocblas_int                        n,
+                                                   const float*                       alpha,
+                                                   const rocblas_float_complex* const x[],
+                                                   rocblas_int                        incx,
+                                                   rocblas_float_complex* const       A[],
+                                                   rocblas_int                        lda,
+                                                   rocblas_int                        batch_count);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    xHPR2_BATCHED performs the matrix-vector operations
+    xHER_BATCHED performs the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+        A_i := A_i + alpha*x_i*x_i**H
 
-    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
-    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batch_count.
+    where alpha is a real scalar, x_i is a vector, and A_i is an
+    n by n symmetric matrix, for i = 1, ..., batch_count.
 
     @param[in]
     handle    [rocblas_handle]
@@ -5031,8 +5517,8 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpr2_batched(rocblas_handle
     @param[in]
     uplo      [rocblas_fill]
               specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of each A_i is supplied in AP.
-              rocblas_fill_lower: The lower triangular part of each A_i is supplied in AP.
+              rocblas_fill_upper: The upper triangular part of each A_i is supplied in A.
+              rocblas_fill_lower: The lower triangular part of each A_i is supplied in A.
     @param[in]
     n         [rocblas_int]
               the number of rows and columns of each matrix A_i, must be at least 0.
@@ -5044,75 +5530,55 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpr2_batched(rocblas_handle
     @param[in]
     incx      [rocblas_int]
               specifies the increment for the elements of each x_i.
-    @param[in]
-    y         device array of device pointers storing each vector y_i.
-    @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of each y_i.
     @param[inout]
-    AP        device array of device pointers storing the packed version of the specified triangular portion of
+    A         device array of device pointers storing the specified triangular portion of
               each Hermitian matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batch_count.
               if uplo == rocblas_fill_upper:
-                The upper triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (rocblas_fill_upper; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular portion
+                of each A_i will not be touched.
             if uplo == rocblas_fill_lower:
-                The lower triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (rocblas_fill_lower; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular portion
+                of each A_i will not be touched.
             Note that the imaginary part of the diagonal elements are not accessed and are assumed
             to be 0.
     @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. Must be at least max(1, n).
+    @param[in]
     batch_count [rocblas_int]
                 number of instances in the batch.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhpr2_batched(rocblas_handle                      handle,
-                                                    rocblas_fill                        uplo,
-                                                    rocblas_int                         n,
-                                                    const rocblas_double_complex*       alpha,
-                                                    const rocblas_double_complex* const x[],
-                                                    rocblas_int                         incx,
-                                                    const rocblas_double_complex* const y[],
-                                                    rocblas_int                         incy,
-                                                    rocblas_double_complex* const       AP[],
-                                                    rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zher_batched(rocblas_handle                      handle,
+                                                   rocblas_fill                        uplo,
+                                                   rocblas_int                         n,
+                                                   const double*                       alpha,
+                                                   const rocblas_double_complex* const x[],
+                                                   rocblas_int                         incx,
+                                                   rocblas_double_complex* const       A[],
+                                                   rocblas_int                         lda,
+                                                   rocblas_int                         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher_strided_batched(rocblas_handle               handle,
+                                                           rocblas_fill                 uplo,
+                                                           rocblas_int                  n,
+                                                           const float*                 alpha,
+                                                           const rocblas_float_complex* x,
+                                                           rocblas_int                  incx,
+                                                           rocblas_stride               stride_x,
+                                                           rocblas_float_complex*       A,
+                                                           rocblas_int                  lda,
+                                                           rocblas_stride               stride_A,
+                                                           rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chpr2_strided_batched(rocblas_handle               handle,
-                                                            rocblas_fill                 uplo,
-                                                            rocblas_int                  n,
-                                                            const rocblas_float_complex* alpha,
-                                                            const rocblas_float_complex* x,
-                                                            rocblas_int                  incx,
-                                                            rocblas_stride               stride_x,
-                                                            const rocblas_float_complex* y,
-                                                            rocblas_int                  incy,
-                                                            rocblas_stride               stride_y,
-                                                            rocblas_float_complex*       AP,
-                                                            rocblas_stride               stride_A,
-                                                            rocblas_int batch_count);
 /*! \brief BLAS Level 2 API
 
     \details
-    xHPR2_STRIDED_BATCHED performs the matrix-vector operations
+    xHER_STRIDED_BATCHED performs the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+        A_i := A_i + alpha*x_i*x_i**H
 
-    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
-    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batch_count.
+    where alpha is a real scalar, x_i is a vector, and A_i is an
+    n by n Hermitian matrix, for i = 1, ..., batch_count.
 
     @param[in]
     handle    [rocblas_handle]
@@ -5120,8 +5586,8 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpr2_strided_batched(rocblas_handle
     @param[in]
     uplo      [rocblas_fill]
               specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              rocblas_fill_upper: The upper triangular part of each A_i is supplied in AP.
-              rocblas_fill_lower: The lower triangular part of each A_i is supplied in AP.
+              rocblas_fill_upper: The upper triangular part of each A_i is supplied in A.
+              rocblas_fill_lower: The lower triangular part of each A_i is supplied in A.
     @param[in]
     n         [rocblas_int]
               the number of rows and columns of each matrix A_i, must be at least 0.
@@ -5136,86 +5602,1092 @@ ROCBLAS_EXPORT rocblas_status rocblas_chpr2_strided_batched(rocblas_handle
     @param[in]
     stride_x  [rocblas_stride]
               stride from the start of one vector (x_i) and the next one (x_i+1).
-    @param[in]
-    y         device pointer pointing to the first vector (y_1).
-    @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of each y_i.
-    @param[in]
-    stride_y  [rocblas_stride]
-              stride from the start of one vector (y_i) and the next one (y_i+1).
     @param[inout]
-    AP        device array of device pointers storing the packed version of the specified triangular portion of
+    A         device array of device pointers storing the specified triangular portion of
               each Hermitian matrix A_i. Points to the first matrix (A_1).
               if uplo == rocblas_fill_upper:
-                The upper triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (rocblas_fill_upper; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
+                portion of each A_i will not be touched.
             if uplo == rocblas_fill_lower:
-                The lower triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (rocblas_fill_lower; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
+                portion of each A_i will not be touched.
             Note that the imaginary part of the diagonal elements are not accessed and are assumed
             to be 0.
     @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i.
+    @param[in]
     stride_A    [rocblas_stride]
                 stride from the start of one (A_i) and the next (A_i+1)
     @param[in]
     batch_count [rocblas_int]
                 number of instances in the batch.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhpr2_strided_batched(rocblas_handle                handle,
-                                                            rocblas_fill                  uplo,
-                                                            rocblas_int                   n,
-                                                            const rocblas_double_complex* alpha,
-                                                            const rocblas_double_complex* x,
-                                                            rocblas_int                   incx,
-                                                            rocblas_stride                stride_x,
-                                                            const rocblas_double_complex* y,
-                                                            rocblas_int                   incy,
-                                                            rocblas_stride                stride_y,
-                                                            rocblas_double_complex*       AP,
-                                                            rocblas_stride                stride_A,
-                                                            rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_strmv(rocblas_handle    handle,
-                                            rocblas_fill      uplo,
-                                            rocblas_operation transA,
-                                            rocblas_diagonal  diag,
-                                            rocblas_int       m,
-                                            const float*      A,
-                                            rocblas_int       lda,
-                                            float*            x,
-                                            rocblas_int       incx);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dtrmv(rocblas_handle    handle,
-                                            rocblas_fill      uplo,
-                                            rocblas_operation transA,
-                                            rocblas_diagonal  diag,
-                                            rocblas_int       m,
-                                            const double*     A,
-                                            rocblas_int       lda,
-                                            double*           x,
-                                            rocblas_int       incx);
+ROCBLAS_EXPORT rocblas_status rocblas_zher_strided_batched(rocblas_handle                handle,
+                                                           rocblas_fill                  uplo,
+                                                           rocblas_int                   n,
+                                                           const double*                 alpha,
+                                                           const rocblas_double_complex* x,
+                                                           rocblas_int                   incx,
+                                                           rocblas_stride                stride_x,
+                                                           rocblas_double_complex*       A,
+                                                           rocblas_int                   lda,
+                                                           rocblas_stride                stride_A,
+                                                           rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ctrmv(rocblas_handle               handle,
+ROCBLAS_EXPORT rocblas_status rocblas_cher2(rocblas_handle               handle,
                                             rocblas_fill                 uplo,
-                                            rocblas_operation            transA,
-                                            rocblas_diagonal             diag,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            const rocblas_float_complex* y,
+                                            rocblas_int                  incy,
+                                            rocblas_float_complex*       A,
+                                            rocblas_int                  lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER2 performs the matrix-vector operations
+
+        A := A + alpha*x*y**H + conj(alpha)*y*x**H
+
+    where alpha is a complex scalar, x and y are vectors, and A is an
+    n by n Hermitian matrix.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              rocblas_fill_upper: The upper triangular part of A is supplied.
+              rocblas_fill_lower: The lower triangular part of A is supplied.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of matrix A, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    A         device pointer storing the specified triangular portion of
+              the Hermitian matrix A. Of size (lda, n).
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of the Hermitian matrix A is supplied. The lower triangular
+                portion of A will not be touched.
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of the Hermitian matrix A is supplied. The upper triangular
+                portion of A will not be touched.
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A. Must be at least max(lda, 1).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zher2(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            const rocblas_double_complex* y,
+                                            rocblas_int                   incy,
+                                            rocblas_double_complex*       A,
+                                            rocblas_int                   lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher2_batched(rocblas_handle                     handle,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_int                        n,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const x[],
+                                                    rocblas_int                        incx,
+                                                    const rocblas_float_complex* const y[],
+                                                    rocblas_int                        incy,
+                                                    rocblas_float_complex* const       A[],
+                                                    rocblas_int                        lda,
+                                                    rocblas_int                        batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER2_BATCHED performs the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+
+    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
+    n by n Hermitian matrix for each batch in i = [1, batch_count].
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              rocblas_fill_upper: The upper triangular part of each A_i is supplied.
+              rocblas_fill_lower: The lower triangular part of each A_i is supplied.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
+    @param[inout]
+    A         device array of device pointers storing the specified triangular portion of
+              each Hermitian matrix A_i of size (lda, n).
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
+                portion of each A_i will not be touched.
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
+                portion of each A_i will not be touched.
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. Must be at least max(lda, 1).
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zher2_batched(rocblas_handle                      handle,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_int                         n,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const x[],
+                                                    rocblas_int                         incx,
+                                                    const rocblas_double_complex* const y[],
+                                                    rocblas_int                         incy,
+                                                    rocblas_double_complex* const       A[],
+                                                    rocblas_int                         lda,
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher2_strided_batched(rocblas_handle               handle,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_int                  n,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* x,
+                                                            rocblas_int                  incx,
+                                                            rocblas_stride               stride_x,
+                                                            const rocblas_float_complex* y,
+                                                            rocblas_int                  incy,
+                                                            rocblas_stride               stride_y,
+                                                            rocblas_float_complex*       A,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               stride_A,
+                                                            rocblas_int batch_count);
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER2_STRIDED_BATCHED performs the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+
+    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
+    n by n Hermitian matrix for each batch in i = [1, batch_count].
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              rocblas_fill_upper: The upper triangular part of each A_i is supplied.
+              rocblas_fill_lower: The lower triangular part of each A_i is supplied.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer pointing to the first vector x_1.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stride_x  [rocblas_stride]
+              specifies the stride between the beginning of one vector (x_i) and the next (x_i+1).
+    @param[in]
+    y         device pointer pointing to the first vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stride_y  [rocblas_stride]
+              specifies the stride between the beginning of one vector (y_i) and the next (y_i+1).
+    @param[inout]
+    A         device pointer pointing to the first matrix (A_1). Stores the specified triangular portion of
+              each Hermitian matrix A_i.
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
+                portion of each A_i will not be touched.
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
+                portion of each A_i will not be touched.
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. Must be at least max(lda, 1).
+    @param[in]
+    stride_A  [rocblas_stride]
+              specifies the stride between the beginning of one matrix (A_i) and the next (A_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher2_strided_batched(rocblas_handle                handle,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_int                   n,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* x,
+                                                            rocblas_int                   incx,
+                                                            rocblas_stride                stride_x,
+                                                            const rocblas_double_complex* y,
+                                                            rocblas_int                   incy,
+                                                            rocblas_stride                stride_y,
+                                                            rocblas_double_complex*       A,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                stride_A,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chpmv(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* AP,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex*       y,
+                                            rocblas_int                  incy);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHPMV performs the matrix-vector operation
+
+        y := alpha*A*x + beta*y
+
+    where alpha and beta are scalars, x and y are n element vectors and A is an
+    n by n Hermitian matrix, supplied in packed form (see description below).
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              rocblas_fill_upper: the upper triangular part of the Hermitian matrix A is supplied in AP.
+              rocblas_fill_lower: the lower triangular part of the Hermitian matrix A is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+              the order of the matrix A, must be >= 0.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    AP        device pointer storing the packed version of the specified triangular portion of
+              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of the Hermitian matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (rocblas_fill_upper; n = 3)
+                        (1, 0) (2, 1) (3, 2)
+                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
+                        (3,-2) (5, 1) (6, 0)
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of the Hermitian matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (rocblas_fill_lower; n = 3)
+                        (1, 0) (2, 1) (3, 2)
+                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
+                        (3,-2) (5, 1) (6, 0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zhpmv(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* AP,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex*       y,
+                                            rocblas_int                   incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chpmv_batched(rocblas_handle                     handle,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_int                        n,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const AP[],
+                                                    const rocblas_float_complex* const x[],
+                                                    rocblas_int                        incx,
+                                                    const rocblas_float_complex*       beta,
+                                                    rocblas_float_complex* const       y[],
+                                                    rocblas_int                        incy,
+                                                    rocblas_int                        batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHPMV_BATCHED performs the matrix-vector operation
+
+        y_i := alpha*A_i*x_i + beta*y_i
+
+    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
+    n by n Hermitian matrix, supplied in packed form (see description below),
+    for each batch in i = [1, batch_count].
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              rocblas_fill_upper: the upper triangular part of each Hermitian matrix A_i is supplied in AP.
+              rocblas_fill_lower: the lower triangular part of each Hermitian matrix A_i is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+              the order of each matrix A_i.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    AP      device pointer of device pointers storing the packed version of the specified triangular
+            portion of each Hermitian matrix A_i. Each A_i is of at least size ((n * (n + 1)) / 2).
+            if uplo == rocblas_fill_upper:
+            The upper triangular portion of each Hermitian matrix A_i is supplied.
+            The matrix is compacted so that each AP_i contains the triangular portion column-by-column
+            so that:
+            AP(0) = A(0,0)
+            AP(1) = A(0,1)
+            AP(2) = A(1,1), etc.
+                Ex: (rocblas_fill_upper; n = 3)
+                    (1, 0) (2, 1) (3, 2)
+                    (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
+                    (3,-2) (5, 1) (6, 0)
+        if uplo == rocblas_fill_lower:
+            The lower triangular portion of each Hermitian matrix A_i is supplied.
+            The matrix is compacted so that each AP_i contains the triangular portion column-by-column
+            so that:
+            AP(0) = A(0,0)
+            AP(1) = A(1,0)
+            AP(2) = A(2,1), etc.
+                Ex: (rocblas_fill_lower; n = 3)
+                    (1, 0) (2, 1) (3, 2)
+                    (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
+                    (3,-2) (5, 1) (6, 0)
+        Note that the imaginary part of the diagonal elements are not accessed and are assumed
+        to be 0.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zhpmv_batched(rocblas_handle                      handle,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_int                         n,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const AP[],
+                                                    const rocblas_double_complex* const x[],
+                                                    rocblas_int                         incx,
+                                                    const rocblas_double_complex*       beta,
+                                                    rocblas_double_complex* const       y[],
+                                                    rocblas_int                         incy,
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chpmv_strided_batched(rocblas_handle               handle,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_int                  n,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* AP,
+                                                            rocblas_stride               stride_A,
+                                                            const rocblas_float_complex* x,
+                                                            rocblas_int                  incx,
+                                                            rocblas_stride               stride_x,
+                                                            const rocblas_float_complex* beta,
+                                                            rocblas_float_complex*       y,
+                                                            rocblas_int                  incy,
+                                                            rocblas_stride               stride_y,
+                                                            rocblas_int batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHPMV_STRIDED_BATCHED performs the matrix-vector operation
+
+        y_i := alpha*A_i*x_i + beta*y_i
+
+    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
+    n by n Hermitian matrix, supplied in packed form (see description below),
+    for each batch in i = [1, batch_count].
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              rocblas_fill_upper: the upper triangular part of each Hermitian matrix A_i is supplied in AP.
+              rocblas_fill_lower: the lower triangular part of each Hermitian matrix A_i is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+              the order of each matrix A_i.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    AP        device pointer pointing to the beginning of the first matrix (AP_1). Stores the packed
+              version of the specified triangular portion of each Hermitian matrix AP_i of size ((n * (n + 1)) / 2).
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that each AP_i contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (rocblas_fill_upper; n = 3)
+                        (1, 0) (2, 1) (3, 2)
+                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
+                        (3,-2) (5, 1) (6, 0)
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that each AP_i contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (rocblas_fill_lower; n = 3)
+                        (1, 0) (2, 1) (3, 2)
+                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
+                        (3,-2) (5, 1) (6, 0)
+        Note that the imaginary part of the diagonal elements are not accessed and are assumed
+        to be 0.
+    @param[in]
+    stride_A  [rocblas_stride]
+              stride from the start of one matrix (AP_i) and the next one (AP_i+1).
+    @param[in]
+    x         device array pointing to the beginning of the first vector (x_1).
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    y         device array pointing to the beginning of the first vector (y_1).
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zhpmv_strided_batched(rocblas_handle                handle,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_int                   n,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* AP,
+                                                            rocblas_stride                stride_A,
+                                                            const rocblas_double_complex* x,
+                                                            rocblas_int                   incx,
+                                                            rocblas_stride                stride_x,
+                                                            const rocblas_double_complex* beta,
+                                                            rocblas_double_complex*       y,
+                                                            rocblas_int                   incy,
+                                                            rocblas_stride                stride_y,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chpr(rocblas_handle               handle,
+                                           rocblas_fill                 uplo,
+                                           rocblas_int                  n,
+                                           const float*                 alpha,
+                                           const rocblas_float_complex* x,
+                                           rocblas_int                  incx,
+                                           rocblas_float_complex*       AP);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHPR performs the matrix-vector operations
+
+        A := A + alpha*x*x**H
+
+    where alpha is a real scalar, x is a vector, and A is an
+    n by n Hermitian matrix, supplied in packed form.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              rocblas_fill_upper: The upper triangular part of A is supplied in AP.
+              rocblas_fill_lower: The lower triangular part of A is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of matrix A, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    AP        device pointer storing the packed version of the specified triangular portion of
+              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of the Hermitian matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (rocblas_fill_upper; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of the Hermitian matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (rocblas_fill_lower; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zhpr(rocblas_handle                handle,
+                                           rocblas_fill                  uplo,
+                                           rocblas_int                   n,
+                                           const double*                 alpha,
+                                           const rocblas_double_complex* x,
+                                           rocblas_int                   incx,
+                                           rocblas_double_complex*       AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chpr_batched(rocblas_handle                     handle,
+                                                   rocblas_fill                       uplo,
+                                                   rocblas_int                        n,
+                                                   const float*                       alpha,
+                                                   const rocblas_float_complex* const x[],
+                                                   rocblas_int                        incx,
+                                                   rocblas_float_complex* const       AP[],
+                                                   rocblas_int                        batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHPR_BATCHED performs the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*x_i**H
+
+    where alpha is a real scalar, x_i is a vector, and A_i is an
+    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              rocblas_fill_upper: The upper triangular part of each A_i is supplied in AP.
+              rocblas_fill_lower: The lower triangular part of each A_i is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[inout]
+    AP        device array of device pointers storing the packed version of the specified triangular portion of
+              each Hermitian matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batch_count.
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (rocblas_fill_upper; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (rocblas_fill_lower; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zhpr_batched(rocblas_handle                      handle,
+                                                   rocblas_fill                        uplo,
+                                                   rocblas_int                         n,
+                                                   const double*                       alpha,
+                                                   const rocblas_double_complex* const x[],
+                                                   rocblas_int                         incx,
+                                                   rocblas_double_complex* const       AP[],
+                                                   rocblas_int                         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chpr_strided_batched(rocblas_handle               handle,
+                                                           rocblas_fill                 uplo,
+                                                           rocblas_int                  n,
+                                                           const float*                 alpha,
+                                                           const rocblas_float_complex* x,
+                                                           rocblas_int                  incx,
+                                                           rocblas_stride               stride_x,
+                                                           rocblas_float_complex*       AP,
+                                                           rocblas_stride               stride_A,
+                                                           rocblas_int batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHPR_STRIDED_BATCHED performs the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*x_i**H
+
+    where alpha is a real scalar, x_i is a vector, and A_i is an
+    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              rocblas_fill_upper: The upper triangular part of each A_i is supplied in AP.
+              rocblas_fill_lower: The lower triangular part of each A_i is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer pointing to the first vector (x_1).
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[inout]
+    AP        device array of device pointers storing the packed version of the specified triangular portion of
+              each Hermitian matrix A_i. Points to the first matrix (A_1).
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (rocblas_fill_upper; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (rocblas_fill_lower; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    stride_A    [rocblas_stride]
+                stride from the start of one (A_i) and the next (A_i+1)
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zhpr_strided_batched(rocblas_handle                handle,
+                                                           rocblas_fill                  uplo,
+                                                           rocblas_int                   n,
+                                                           const double*                 alpha,
+                                                           const rocblas_double_complex* x,
+                                                           rocblas_int                   incx,
+                                                           rocblas_stride                stride_x,
+                                                           rocblas_double_complex*       AP,
+                                                           rocblas_stride                stride_A,
+                                                           rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chpr2(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            const rocblas_float_complex* y,
+                                            rocblas_int                  incy,
+                                            rocblas_float_complex*       AP);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHPR2 performs the matrix-vector operations
+
+        A := A + alpha*x*y**H + conj(alpha)*y*x**H
+
+    where alpha is a complex scalar, x and y are vectors, and A is an
+    n by n Hermitian matrix, supplied in packed form.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              rocblas_fill_upper: The upper triangular part of A is supplied in AP.
+              rocblas_fill_lower: The lower triangular part of A is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of matrix A, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    AP        device pointer storing the packed version of the specified triangular portion of
+              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of the Hermitian matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (rocblas_fill_upper; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of the Hermitian matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (rocblas_fill_lower; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zhpr2(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            const rocblas_double_complex* y,
+                                            rocblas_int                   incy,
+                                            rocblas_double_complex*       AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chpr2_batched(rocblas_handle                     handle,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_int                        n,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const x[],
+                                                    rocblas_int                        incx,
+                                                    const rocblas_float_complex* const y[],
+                                                    rocblas_int                        incy,
+                                                    rocblas_float_complex* const       AP[],
+                                                    rocblas_int                        batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHPR2_BATCHED performs the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+
+    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
+    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              rocblas_fill_upper: The upper triangular part of each A_i is supplied in AP.
+              rocblas_fill_lower: The lower triangular part of each A_i is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
+    @param[inout]
+    AP        device array of device pointers storing the packed version of the specified triangular portion of
+              each Hermitian matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batch_count.
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (rocblas_fill_upper; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (rocblas_fill_lower; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zhpr2_batched(rocblas_handle                      handle,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_int                         n,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const x[],
+                                                    rocblas_int                         incx,
+                                                    const rocblas_double_complex* const y[],
+                                                    rocblas_int                         incy,
+                                                    rocblas_double_complex* const       AP[],
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chpr2_strided_batched(rocblas_handle               handle,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_int                  n,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* x,
+                                                            rocblas_int                  incx,
+                                                            rocblas_stride               stride_x,
+                                                            const rocblas_float_complex* y,
+                                                            rocblas_int                  incy,
+                                                            rocblas_stride               stride_y,
+                                                            rocblas_float_complex*       AP,
+                                                            rocblas_stride               stride_A,
+                                                            rocblas_int batch_count);
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHPR2_STRIDED_BATCHED performs the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+
+    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
+    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              rocblas_fill_upper: The upper triangular part of each A_i is supplied in AP.
+              rocblas_fill_lower: The lower triangular part of each A_i is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer pointing to the first vector (x_1).
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    y         device pointer pointing to the first vector (y_1).
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+    @param[inout]
+    AP        device array of device pointers storing the packed version of the specified triangular portion of
+              each Hermitian matrix A_i. Points to the first matrix (A_1).
+              if uplo == rocblas_fill_upper:
+                The upper triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (rocblas_fill_upper; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            if uplo == rocblas_fill_lower:
+                The lower triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (rocblas_fill_lower; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    stride_A    [rocblas_stride]
+                stride from the start of one (A_i) and the next (A_i+1)
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zhpr2_strided_batched(rocblas_handle                handle,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_int                   n,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* x,
+                                                            rocblas_int                   incx,
+                                                            rocblas_stride                stride_x,
+                                                            const rocblas_double_complex* y,
+                                                            rocblas_int                   incy,
+                                                            rocblas_stride                stride_y,
+                                                            rocblas_double_complex*       AP,
+                                                            rocblas_stride                stride_A,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_strmv(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            float*            x,
+                                            rocblas_int       incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmv(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            double*           x,
+                                            rocblas_int       incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctrmv(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_operation            transA,
+                                            rocblas_diagonal             diag,
                                             rocblas_int                  m,
                                             const rocblas_float_complex* A,
                                             rocblas_int                  lda,
@@ -8809,40 +10281,291 @@ ROCBLAS_EXPORT rocblas_status rocblas_dspr2_strided_batched(rocblas_handle handl
                                                             rocblas_stride stride_A,
                                                             rocblas_int    batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr(rocblas_handle handle,
-                                           rocblas_fill   uplo,
-                                           rocblas_int    n,
-                                           const float*   alpha,
-                                           const float*   x,
-                                           rocblas_int    incx,
-                                           float*         A,
-                                           rocblas_int    lda);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           const float*   alpha,
+                                           const float*   x,
+                                           rocblas_int    incx,
+                                           float*         A,
+                                           rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           const double*  alpha,
+                                           const double*  x,
+                                           rocblas_int    incx,
+                                           double*        A,
+                                           rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr(rocblas_handle               handle,
+                                           rocblas_fill                 uplo,
+                                           rocblas_int                  n,
+                                           const rocblas_float_complex* alpha,
+                                           const rocblas_float_complex* x,
+                                           rocblas_int                  incx,
+                                           rocblas_float_complex*       A,
+                                           rocblas_int                  lda);
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR performs the matrix-vector operations
+
+        A := A + alpha*x*x**T
+
+    where alpha is a scalar, x is a vector, and A is an
+    n by n symmetric matrix.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              if rocblas_fill_upper, the lower part of A is not referenced
+              if rocblas_fill_lower, the upper part of A is not referenced
+
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of matrix A.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr(rocblas_handle                handle,
+                                           rocblas_fill                  uplo,
+                                           rocblas_int                   n,
+                                           const rocblas_double_complex* alpha,
+                                           const rocblas_double_complex* x,
+                                           rocblas_int                   incx,
+                                           rocblas_double_complex*       A,
+                                           rocblas_int                   lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr_batched(rocblas_handle     handle,
+                                                   rocblas_fill       uplo,
+                                                   rocblas_int        n,
+                                                   const float*       alpha,
+                                                   const float* const x[],
+                                                   rocblas_int        incx,
+                                                   float* const       A[],
+                                                   rocblas_int        lda,
+                                                   rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr_batched(rocblas_handle      handle,
+                                                   rocblas_fill        uplo,
+                                                   rocblas_int         n,
+                                                   const double*       alpha,
+                                                   const double* const x[],
+                                                   rocblas_int         incx,
+                                                   double* const       A[],
+                                                   rocblas_int         lda,
+                                                   rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr_batched(rocblas_handle                     handle,
+                                                   rocblas_fill                       uplo,
+                                                   rocblas_int                        n,
+                                                   const rocblas_float_complex*       alpha,
+                                                   const rocblas_float_complex* const x[],
+                                                   rocblas_int                        incx,
+                                                   rocblas_float_complex* const       A[],
+                                                   rocblas_int                        lda,
+                                                   rocblas_int                        batch_count);
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR_batched performs a batch of matrix-vector operations
+
+        A[i] := A[i] + alpha*x[i]*x[i]**T
+
+    where alpha is a scalar, x is an array of vectors, and A is an array of
+    n by n symmetric matrices, for i = 1 , ... , batch_count
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              if rocblas_fill_upper, the lower part of A is not referenced
+              if rocblas_fill_lower, the upper part of A is not referenced
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of matrix A.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[inout]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr_batched(rocblas_handle                      handle,
+                                                   rocblas_fill                        uplo,
+                                                   rocblas_int                         n,
+                                                   const rocblas_double_complex*       alpha,
+                                                   const rocblas_double_complex* const x[],
+                                                   rocblas_int                         incx,
+                                                   rocblas_double_complex* const       A[],
+                                                   rocblas_int                         lda,
+                                                   rocblas_int                         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr_strided_batched(rocblas_handle handle,
+                                                           rocblas_fill   uplo,
+                                                           rocblas_int    n,
+                                                           const float*   alpha,
+                                                           const float*   x,
+                                                           rocblas_int    incx,
+                                                           rocblas_stride stridex,
+                                                           float*         A,
+                                                           rocblas_int    lda,
+                                                           rocblas_stride strideA,
+                                                           rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr_strided_batched(rocblas_handle handle,
+                                                           rocblas_fill   uplo,
+                                                           rocblas_int    n,
+                                                           const double*  alpha,
+                                                           const double*  x,
+                                                           rocblas_int    incx,
+                                                           rocblas_stride stridex,
+                                                           double*        A,
+                                                           rocblas_int    lda,
+                                                           rocblas_stride strideA,
+                                                           rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr_strided_batched(rocblas_handle               handle,
+                                                           rocblas_fill                 uplo,
+                                                           rocblas_int                  n,
+                                                           const rocblas_float_complex* alpha,
+                                                           const rocblas_float_complex* x,
+                                                           rocblas_int                  incx,
+                                                           rocblas_stride               stridex,
+                                                           rocblas_float_complex*       A,
+                                                           rocblas_int                  lda,
+                                                           rocblas_stride               strideA,
+                                                           rocblas_int batch_count);
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR_strided_batched performs the matrix-vector operations
+
+        A[i] := A[i] + alpha*x[i]*x[i]**T
+
+    where alpha is a scalar, vectors, and A is an array of
+    n by n symmetric matrices, for i = 1 , ... , batch_count
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              if rocblas_fill_upper, the lower part of A is not referenced
+              if rocblas_fill_lower, the upper part of A is not referenced
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer to the first vector x_1.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   [rocblas_stride]
+              specifies the pointer increment between vectors (x_i) and (x_i+1).
+    @param[inout]
+    A         device pointer to the first matrix A_1.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA   [rocblas_stride]
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch
+
+    ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr(rocblas_handle handle,
-                                           rocblas_fill   uplo,
-                                           rocblas_int    n,
-                                           const double*  alpha,
-                                           const double*  x,
-                                           rocblas_int    incx,
-                                           double*        A,
-                                           rocblas_int    lda);
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr_strided_batched(rocblas_handle                handle,
+                                                           rocblas_fill                  uplo,
+                                                           rocblas_int                   n,
+                                                           const rocblas_double_complex* alpha,
+                                                           const rocblas_double_complex* x,
+                                                           rocblas_int                   incx,
+                                                           rocblas_stride                stridex,
+                                                           rocblas_double_complex*       A,
+                                                           rocblas_int                   lda,
+                                                           rocblas_stride                strideA,
+                                                           rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyr(rocblas_handle               handle,
-                                           rocblas_fill                 uplo,
-                                           rocblas_int                  n,
-                                           const rocblas_float_complex* alpha,
-                                           const rocblas_float_complex* x,
-                                           rocblas_int                  incx,
-                                           rocblas_float_complex*       A,
-                                           rocblas_int                  lda);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            const float*   alpha,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            const float*   y,
+                                            rocblas_int    incy,
+                                            float*         A,
+                                            rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            const double*  alpha,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            const double*  y,
+                                            rocblas_int    incy,
+                                            double*        A,
+                                            rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr2(rocblas_handle               handle,
+                                            rocblas_fill                 uplo,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int                  incx,
+                                            const rocblas_float_complex* y,
+                                            rocblas_int                  incy,
+                                            rocblas_float_complex*       A,
+                                            rocblas_int                  lda);
 /*! \brief BLAS Level 2 API
 
     \details
-    xSYR performs the matrix-vector operations
+    xSYR2 performs the matrix-vector operations
 
-        A := A + alpha*x*x**T
+        A := A + alpha*x*y**T + alpha*y*x**T
 
-    where alpha is a scalar, x is a vector, and A is an
+    where alpha is a scalar, x and y are vectors, and A is an
     n by n symmetric matrix.
 
     @param[in]
@@ -8865,6 +10588,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr(rocblas_handle               handle,
     @param[in]
     incx      [rocblas_int]
               specifies the increment for the elements of x.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
     @param[inout]
     A         device pointer storing matrix A.
     @param[in]
@@ -8873,53 +10601,61 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr(rocblas_handle               handle,
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_zsyr(rocblas_handle                handle,
-                                           rocblas_fill                  uplo,
-                                           rocblas_int                   n,
-                                           const rocblas_double_complex* alpha,
-                                           const rocblas_double_complex* x,
-                                           rocblas_int                   incx,
-                                           rocblas_double_complex*       A,
-                                           rocblas_int                   lda);
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr2(rocblas_handle                handle,
+                                            rocblas_fill                  uplo,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int                   incx,
+                                            const rocblas_double_complex* y,
+                                            rocblas_int                   incy,
+                                            rocblas_double_complex*       A,
+                                            rocblas_int                   lda);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr_batched(rocblas_handle     handle,
-                                                   rocblas_fill       uplo,
-                                                   rocblas_int        n,
-                                                   const float*       alpha,
-                                                   const float* const x[],
-                                                   rocblas_int        incx,
-                                                   float* const       A[],
-                                                   rocblas_int        lda,
-                                                   rocblas_int        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2_batched(rocblas_handle     handle,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_int        n,
+                                                    const float*       alpha,
+                                                    const float* const x[],
+                                                    rocblas_int        incx,
+                                                    const float* const y[],
+                                                    rocblas_int        incy,
+                                                    float* const       A[],
+                                                    rocblas_int        lda,
+                                                    rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr_batched(rocblas_handle      handle,
-                                                   rocblas_fill        uplo,
-                                                   rocblas_int         n,
-                                                   const double*       alpha,
-                                                   const double* const x[],
-                                                   rocblas_int         incx,
-                                                   double* const       A[],
-                                                   rocblas_int         lda,
-                                                   rocblas_int         batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2_batched(rocblas_handle      handle,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double* const x[],
+                                                    rocblas_int         incx,
+                                                    const double* const y[],
+                                                    rocblas_int         incy,
+                                                    double* const       A[],
+                                                    rocblas_int         lda,
+                                                    rocblas_int         batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyr_batched(rocblas_handle                     handle,
-                                                   rocblas_fill                       uplo,
-                                                   rocblas_int                        n,
-                                                   const rocblas_float_complex*       alpha,
-                                                   const rocblas_float_complex* const x[],
-                                                   rocblas_int                        incx,
-                                                   rocblas_float_complex* const       A[],
-                                                   rocblas_int                        lda,
-                                                   rocblas_int                        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_csyr2_batched(rocblas_handle                     handle,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_int                        n,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const x[],
+                                                    rocblas_int                        incx,
+                                                    const rocblas_float_complex* const y[],
+                                                    rocblas_int                        incy,
+                                                    rocblas_float_complex* const       A[],
+                                                    rocblas_int                        lda,
+                                                    rocblas_int                        batch_count);
 /*! \brief BLAS Level 2 API
 
     \details
-    xSYR_batched performs a batch of matrix-vector operations
+    xSYR2_BATCHED performs a batch of matrix-vector operations
 
-        A[i] := A[i] + alpha*x[i]*x[i]**T
+        A[i] := A[i] + alpha*x[i]*y[i]**T + alpha*y[i]*x[i]**T
 
-    where alpha is a scalar, x is an array of vectors, and A is an array of
-    n by n symmetric matrices, for i = 1 , ... , batch_count
+    where alpha is a scalar, x[i] and y[i] are vectors, and A[i] is a
+    n by n symmetric matrix, for i = 1 , ... , batch_count
 
     @param[in]
     handle    [rocblas_handle]
@@ -8940,6 +10676,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr_batched(rocblas_handle
     @param[in]
     incx      [rocblas_int]
               specifies the increment for the elements of each x_i.
+    @param[in]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
     @param[inout]
     A         device array of device pointers storing each matrix A_i.
     @param[in]
@@ -8951,59 +10692,70 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr_batched(rocblas_handle
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_zsyr_batched(rocblas_handle                      handle,
-                                                   rocblas_fill                        uplo,
-                                                   rocblas_int                         n,
-                                                   const rocblas_double_complex*       alpha,
-                                                   const rocblas_double_complex* const x[],
-                                                   rocblas_int                         incx,
-                                                   rocblas_double_complex* const       A[],
-                                                   rocblas_int                         lda,
-                                                   rocblas_int                         batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr2_batched(rocblas_handle                      handle,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_int                         n,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const x[],
+                                                    rocblas_int                         incx,
+                                                    const rocblas_double_complex* const y[],
+                                                    rocblas_int                         incy,
+                                                    rocblas_double_complex* const       A[],
+                                                    rocblas_int                         lda,
+                                                    rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr_strided_batched(rocblas_handle handle,
-                                                           rocblas_fill   uplo,
-                                                           rocblas_int    n,
-                                                           const float*   alpha,
-                                                           const float*   x,
-                                                           rocblas_int    incx,
-                                                           rocblas_stride stridex,
-                                                           float*         A,
-                                                           rocblas_int    lda,
-                                                           rocblas_stride strideA,
-                                                           rocblas_int    batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            const float*   alpha,
+                                                            const float*   x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const float*   y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            float*         A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride strideA,
+                                                            rocblas_int    batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr_strided_batched(rocblas_handle handle,
-                                                           rocblas_fill   uplo,
-                                                           rocblas_int    n,
-                                                           const double*  alpha,
-                                                           const double*  x,
-                                                           rocblas_int    incx,
-                                                           rocblas_stride stridex,
-                                                           double*        A,
-                                                           rocblas_int    lda,
-                                                           rocblas_stride strideA,
-                                                           rocblas_int    batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            const double*  alpha,
+                                                            const double*  x,
+                                                            rocblas_int    incx,
+                                                            rocblas_stride stridex,
+                                                            const double*  y,
+                                                            rocblas_int    incy,
+                                                            rocblas_stride stridey,
+                                                            double*        A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride strideA,
+                                                            rocblas_int    batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyr_strided_batched(rocblas_handle               handle,
-                                                           rocblas_fill                 uplo,
-                                                           rocblas_int                  n,
-                                                           const rocblas_float_complex* alpha,
-                                                           const rocblas_float_complex* x,
-                                                           rocblas_int                  incx,
-                                                           rocblas_stride               stridex,
-                                                           rocblas_float_complex*       A,
-                                                           rocblas_int                  lda,
-                                                           rocblas_stride               strideA,
-                                                           rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_csyr2_strided_batched(rocblas_handle               handle,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_int                  n,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* x,
+                                                            rocblas_int                  incx,
+                                                            rocblas_stride               stridex,
+                                                            const rocblas_float_complex* y,
+                                                            rocblas_int                  incy,
+                                                            rocblas_stride               stridey,
+                                                            rocblas_float_complex*       A,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               strideA,
+                                                            rocblas_int batch_count);
 /*! \brief BLAS Level 2 API
 
     \details
-    xSYR_strided_batched performs the matrix-vector operations
+    xSYR2_STRIDED_BATCHED the matrix-vector operations
 
-        A[i] := A[i] + alpha*x[i]*x[i]**T
+        A[i] := A[i] + alpha*x[i]*y[i]**T + alpha*y[i]*x[i]**T
 
-    where alpha is a scalar, vectors, and A is an array of
+    where alpha is a scalar, x[i] and y[i] are vectors, and A[i] is a
     n by n symmetric matrices, for i = 1 , ... , batch_count
 
     @param[in]
@@ -9028,6 +10780,14 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr_strided_batched(rocblas_handle
     @param[in]
     stridex   [rocblas_stride]
               specifies the pointer increment between vectors (x_i) and (x_i+1).
+    @param[in]
+    y         device pointer to the first vector y_1.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey   [rocblas_stride]
+              specifies the pointer increment between vectors (y_i) and (y_i+1).
     @param[inout]
     A         device pointer to the first matrix A_1.
     @param[in]
@@ -9042,326 +10802,372 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr_strided_batched(rocblas_handle
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_zsyr_strided_batched(rocblas_handle                handle,
-                                                           rocblas_fill                  uplo,
-                                                           rocblas_int                   n,
-                                                           const rocblas_double_complex* alpha,
-                                                           const rocblas_double_complex* x,
-                                                           rocblas_int                   incx,
-                                                           rocblas_stride                stridex,
-                                                           rocblas_double_complex*       A,
-                                                           rocblas_int                   lda,
-                                                           rocblas_stride                strideA,
-                                                           rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr2(rocblas_handle handle,
-                                            rocblas_fill   uplo,
-                                            rocblas_int    n,
-                                            const float*   alpha,
-                                            const float*   x,
-                                            rocblas_int    incx,
-                                            const float*   y,
-                                            rocblas_int    incy,
-                                            float*         A,
-                                            rocblas_int    lda);
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr2_strided_batched(rocblas_handle                handle,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_int                   n,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* x,
+                                                            rocblas_int                   incx,
+                                                            rocblas_stride                stridex,
+                                                            const rocblas_double_complex* y,
+                                                            rocblas_int                   incy,
+                                                            rocblas_stride                stridey,
+                                                            rocblas_double_complex*       A,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                strideA,
+                                                            rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr2(rocblas_handle handle,
-                                            rocblas_fill   uplo,
-                                            rocblas_int    n,
-                                            const double*  alpha,
-                                            const double*  x,
-                                            rocblas_int    incx,
-                                            const double*  y,
-                                            rocblas_int    incy,
-                                            double*        A,
-                                            rocblas_int    lda);
+/*
+ * ===========================================================================
+ *    level 3 BLAS
+ * ===========================================================================
+ */
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyr2(rocblas_handle               handle,
+ROCBLAS_EXPORT rocblas_status rocblas_chemm(rocblas_handle               handle,
+                                            rocblas_side                 side,
                                             rocblas_fill                 uplo,
                                             rocblas_int                  n,
+                                            rocblas_int                  k,
                                             const rocblas_float_complex* alpha,
-                                            const rocblas_float_complex* x,
-                                            rocblas_int                  incx,
-                                            const rocblas_float_complex* y,
-                                            rocblas_int                  incy,
-                                            rocblas_float_complex*       A,
-                                            rocblas_int                  lda);
-/*! \brief BLAS Level 2 API
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            const rocblas_float_complex* B,
+                                            rocblas_int                  ldb,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex*       C,
+                                            rocblas_int                  ldc);
+
+/*! \brief BLAS Level 3 API
 
     \details
-    xSYR2 performs the matrix-vector operations
 
-        A := A + alpha*x*y**T + alpha*y*x**T
+    hemm performs one of the matrix-matrix operations:
 
-    where alpha is a scalar, x and y are vectors, and A is an
-    n by n symmetric matrix.
+    C := alpha*A*B + beta*C if side == rocblas_side_left,
+    C := alpha*B*A + beta*C if side == rocblas_side_right,
+
+    where alpha and beta are scalars, B and C are m by n matrices, and
+    A is a Hermitian matrix stored as either upper or lower.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
+
     @param[in]
-    uplo      [rocblas_fill]
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              if rocblas_fill_upper, the lower part of A is not referenced
-              if rocblas_fill_lower, the upper part of A is not referenced
+    side  [rocblas_side]
+            rocblas_side_left:      C := alpha*A*B + beta*C
+            rocblas_side_right:     C := alpha*B*A + beta*C
 
     @param[in]
-    n         [rocblas_int]
-              the number of rows and columns of matrix A.
+    uplo    [rocblas_fill]
+            rocblas_fill_upper:  A is an upper triangular matrix
+            rocblas_fill_lower:  A is a  lower triangular matrix
+
+    @param[in]
+    m       [rocblas_int]
+            m specifies the number of rows of B and C. m >= 0.
+
+    @param[in]
+    n       [rocblas_int]
+            n specifies the number of columns of B and C. n >= 0.
+
     @param[in]
     alpha
-              device pointer or host pointer to scalar alpha.
+            alpha specifies the scalar alpha. When alpha is
+            zero then A and B are not referenced.
+
     @param[in]
-    x         device pointer storing vector x.
+    A       pointer storing matrix A on the GPU.
+            A is m by m if side == rocblas_side_left
+            A is n by n if side == rocblas_side_right
+            Only the upper/lower triangular part is accessed.
+            The imaginary component of the diagonal elements is not used.
+
     @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of x.
+    lda     [rocblas_int]
+            lda specifies the first dimension of A.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            otherwise lda >= max( 1, n ).
+
     @param[in]
-    y         device pointer storing vector y.
+    B       pointer storing matrix B on the GPU.
+            Matrix dimension is m by n
+
     @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of y.
-    @param[inout]
-    A         device pointer storing matrix A.
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B. ldb >= max( 1, m )
+
     @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of A.
+    beta
+            beta specifies the scalar beta. When beta is
+            zero then C need not be set before entry.
 
-    ********************************************************************/
+    @param[in]
+    C       pointer storing matrix C on the GPU.
+            Matrix dimension is m by n
 
-ROCBLAS_EXPORT rocblas_status rocblas_zsyr2(rocblas_handle                handle,
+    @param[in]
+    ldc    [rocblas_int]
+           ldc specifies the first dimension of C. ldc >= max( 1, m )
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zhemm(rocblas_handle                handle,
+                                            rocblas_side                  side,
                                             rocblas_fill                  uplo,
                                             rocblas_int                   n,
+                                            rocblas_int                   k,
                                             const rocblas_double_complex* alpha,
-                                            const rocblas_double_complex* x,
-                                            rocblas_int                   incx,
-                                            const rocblas_double_complex* y,
-                                            rocblas_int                   incy,
-                                            rocblas_double_complex*       A,
-                                            rocblas_int                   lda);
-
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr2_batched(rocblas_handle     handle,
-                                                    rocblas_fill       uplo,
-                                                    rocblas_int        n,
-                                                    const float*       alpha,
-                                                    const float* const x[],
-                                                    rocblas_int        incx,
-                                                    const float* const y[],
-                                                    rocblas_int        incy,
-                                                    float* const       A[],
-                                                    rocblas_int        lda,
-                                                    rocblas_int        batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr2_batched(rocblas_handle      handle,
-                                                    rocblas_fill        uplo,
-                                                    rocblas_int         n,
-                                                    const double*       alpha,
-                                                    const double* const x[],
-                                                    rocblas_int         incx,
-                                                    const double* const y[],
-                                                    rocblas_int         incy,
-                                                    double* const       A[],
-                                                    rocblas_int         lda,
-                                                    rocblas_int         batch_count);
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const rocblas_double_complex* B,
+                                            rocblas_int                   ldb,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyr2_batched(rocblas_handle                     handle,
+ROCBLAS_EXPORT rocblas_status rocblas_chemm_batched(rocblas_handle                     handle,
+                                                    rocblas_side                       side,
                                                     rocblas_fill                       uplo,
+                                                    rocblas_int                        m,
                                                     rocblas_int                        n,
                                                     const rocblas_float_complex*       alpha,
-                                                    const rocblas_float_complex* const x[],
-                                                    rocblas_int                        incx,
-                                                    const rocblas_float_complex* const y[],
-                                                    rocblas_int                        incy,
-                                                    rocblas_float_complex* const       A[],
+                                                    const rocblas_float_complex* const A[],
                                                     rocblas_int                        lda,
+                                                    const rocblas_float_complex* const B[],
+                                                    rocblas_int                        ldb,
+                                                    const rocblas_float_complex*       beta,
+                                                    rocblas_float_complex* const       C[],
+                                                    rocblas_int                        ldc,
                                                     rocblas_int                        batch_count);
-/*! \brief BLAS Level 2 API
+
+/*! \brief BLAS Level 3 API
 
     \details
-    xSYR2_BATCHED performs a batch of matrix-vector operations
 
-        A[i] := A[i] + alpha*x[i]*y[i]**T + alpha*y[i]*x[i]**T
+    hemm_batched performs a batch of the matrix-matrix operations:
 
-    where alpha is a scalar, x[i] and y[i] are vectors, and A[i] is a
-    n by n symmetric matrix, for i = 1 , ... , batch_count
+    C_i := alpha*A_i*B_i + beta*C_i if side == rocblas_side_left,
+    C_i := alpha*B_i*A_i + beta*C_i if side == rocblas_side_right,
+
+    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
+    A_i is a Hermitian matrix stored as either upper or lower.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
+
     @param[in]
-    uplo      [rocblas_fill]
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              if rocblas_fill_upper, the lower part of A is not referenced
-              if rocblas_fill_lower, the upper part of A is not referenced
+    side  [rocblas_side]
+            rocblas_side_left:      C_i := alpha*A_i*B_i + beta*C_i
+            rocblas_side_right:     C_i := alpha*B_i*A_i + beta*C_i
+
+    @param[in]
+    uplo    [rocblas_fill]
+            rocblas_fill_upper:  A_i is an upper triangular matrix
+            rocblas_fill_lower:  A_i is a  lower triangular matrix
+
+    @param[in]
+    m       [rocblas_int]
+            m specifies the number of rows of B_i and C_i. m >= 0.
+
     @param[in]
-    n         [rocblas_int]
-              the number of rows and columns of matrix A.
+    n       [rocblas_int]
+            n specifies the number of columns of B_i and C_i. n >= 0.
+
     @param[in]
     alpha
-              device pointer or host pointer to scalar alpha.
+            alpha specifies the scalar alpha. When alpha is
+            zero then A_i and B_i are not referenced.
+
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    A       device array of device pointers storing each matrix A_i on the GPU.
+            A_i is m by m if side == rocblas_side_left
+            A_i is n by n if side == rocblas_side_right
+            Only the upper/lower triangular part is accessed.
+            The imaginary component of the diagonal elements is not used.
+
     @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of each x_i.
+    lda     [rocblas_int]
+            lda specifies the first dimension of A_i.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            otherwise lda >= max( 1, n ).
+
     @param[in]
-    y         device array of device pointers storing each vector y_i.
+    B       device array of device pointers storing each matrix B_i on the GPU.
+            Matrix dimension is m by n
+
     @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of each y_i.
-    @param[inout]
-    A         device array of device pointers storing each matrix A_i.
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B_i. ldb >= max( 1, m )
+
     @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of each A_i.
+    beta
+            beta specifies the scalar beta. When beta is
+            zero then C_i need not be set before entry.
+
+    @param[in]
+    C       device array of device pointers storing each matrix C_i on the GPU.
+            Matrix dimension is m by n
+
+    @param[in]
+    ldc    [rocblas_int]
+           ldc specifies the first dimension of C_i. ldc >= max( 1, m )
+
     @param[in]
     batch_count [rocblas_int]
-                number of instances in the batch
+                number of instances in the batch.
 
     ********************************************************************/
-
-ROCBLAS_EXPORT rocblas_status rocblas_zsyr2_batched(rocblas_handle                      handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zhemm_batched(rocblas_handle                      handle,
+                                                    rocblas_side                        side,
                                                     rocblas_fill                        uplo,
+                                                    rocblas_int                         m,
                                                     rocblas_int                         n,
                                                     const rocblas_double_complex*       alpha,
-                                                    const rocblas_double_complex* const x[],
-                                                    rocblas_int                         incx,
-                                                    const rocblas_double_complex* const y[],
-                                                    rocblas_int                         incy,
-                                                    rocblas_double_complex* const       A[],
+                                                    const rocblas_double_complex* const A[],
                                                     rocblas_int                         lda,
+                                                    const rocblas_double_complex* const B[],
+                                                    rocblas_int                         ldb,
+                                                    const rocblas_double_complex*       beta,
+                                                    rocblas_double_complex* const       C[],
+                                                    rocblas_int                         ldc,
                                                     rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr2_strided_batched(rocblas_handle handle,
-                                                            rocblas_fill   uplo,
-                                                            rocblas_int    n,
-                                                            const float*   alpha,
-                                                            const float*   x,
-                                                            rocblas_int    incx,
-                                                            rocblas_stride stridex,
-                                                            const float*   y,
-                                                            rocblas_int    incy,
-                                                            rocblas_stride stridey,
-                                                            float*         A,
-                                                            rocblas_int    lda,
-                                                            rocblas_stride strideA,
-                                                            rocblas_int    batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr2_strided_batched(rocblas_handle handle,
-                                                            rocblas_fill   uplo,
-                                                            rocblas_int    n,
-                                                            const double*  alpha,
-                                                            const double*  x,
-                                                            rocblas_int    incx,
-                                                            rocblas_stride stridex,
-                                                            const double*  y,
-                                                            rocblas_int    incy,
-                                                            rocblas_stride stridey,
-                                                            double*        A,
-                                                            rocblas_int    lda,
-                                                            rocblas_stride strideA,
-                                                            rocblas_int    batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_csyr2_strided_batched(rocblas_handle               handle,
+ROCBLAS_EXPORT rocblas_status rocblas_chemm_strided_batched(rocblas_handle               handle,
+                                                            rocblas_side                 side,
                                                             rocblas_fill                 uplo,
+                                                            rocblas_int                  m,
                                                             rocblas_int                  n,
                                                             const rocblas_float_complex* alpha,
-                                                            const rocblas_float_complex* x,
-                                                            rocblas_int                  incx,
-                                                            rocblas_stride               stridex,
-                                                            const rocblas_float_complex* y,
-                                                            rocblas_int                  incy,
-                                                            rocblas_stride               stridey,
-                                                            rocblas_float_complex*       A,
+                                                            const rocblas_float_complex* A,
                                                             rocblas_int                  lda,
-                                                            rocblas_stride               strideA,
+                                                            rocblas_stride               stride_A,
+                                                            const rocblas_float_complex* B,
+                                                            rocblas_int                  ldb,
+                                                            rocblas_stride               stride_B,
+                                                            const rocblas_float_complex* beta,
+                                                            rocblas_float_complex*       C,
+                                                            rocblas_int                  ldc,
+                                                            rocblas_stride               stride_C,
                                                             rocblas_int batch_count);
-/*! \brief BLAS Level 2 API
+
+/*! \brief BLAS Level 3 API
 
     \details
-    xSYR2_STRIDED_BATCHED the matrix-vector operations
 
-        A[i] := A[i] + alpha*x[i]*y[i]**T + alpha*y[i]*x[i]**T
+    hemm_strided_batched performs a batch of the matrix-matrix operations:
 
-    where alpha is a scalar, x[i] and y[i] are vectors, and A[i] is a
-    n by n symmetric matrices, for i = 1 , ... , batch_count
+    C_i := alpha*A_i*B_i + beta*C_i if side == rocblas_side_left,
+    C_i := alpha*B_i*A_i + beta*C_i if side == rocblas_side_right,
+
+    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
+    A_i is a Hermitian matrix stored as either upper or lower.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
+
     @param[in]
-    uplo      [rocblas_fill]
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              if rocblas_fill_upper, the lower part of A is not referenced
-              if rocblas_fill_lower, the upper part of A is not referenced
+    side  [rocblas_side]
+            rocblas_side_left:      C_i := alpha*A_i*B_i + beta*C_i
+            rocblas_side_right:     C_i := alpha*B_i*A_i + beta*C_i
+
     @param[in]
-    n         [rocblas_int]
-              the number of rows and columns of each matrix A.
+    uplo    [rocblas_fill]
+            rocblas_fill_upper:  A_i is an upper triangular matrix
+            rocblas_fill_lower:  A_i is a  lower triangular matrix
+
+    @param[in]
+    m       [rocblas_int]
+            m specifies the number of rows of B_i and C_i. m >= 0.
+
+    @param[in]
+    n       [rocblas_int]
+            n specifies the number of columns of B_i and C_i. n >= 0.
+
     @param[in]
     alpha
-              device pointer or host pointer to scalar alpha.
+            alpha specifies the scalar alpha. When alpha is
+            zero then A_i and B_i are not referenced.
+
     @param[in]
-    x         device pointer to the first vector x_1.
+    A       device pointer to first matrix A_1
+            A_i is m by m if side == rocblas_side_left
+            A_i is n by n if side == rocblas_side_right
+            Only the upper/lower triangular part is accessed.
+            The imaginary component of the diagonal elements is not used.
+
     @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of each x_i.
+    lda     [rocblas_int]
+            lda specifies the first dimension of A_i.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            otherwise lda >= max( 1, n ).
+
     @param[in]
-    stridex   [rocblas_stride]
-              specifies the pointer increment between vectors (x_i) and (x_i+1).
+    stride_A  [rocblas_stride]
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
+
     @param[in]
-    y         device pointer to the first vector y_1.
+    B       device pointer to first matrix B_1 of dimension (ldb, n) on the GPU
+
     @param[in]
-    incy      [rocblas_int]
-              specifies the increment for the elements of each y_i.
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B_i.
+            if side = rocblas_operation_none,  ldb >= max( 1, m ),
+            otherwise ldb >= max( 1, n ).
+
     @param[in]
-    stridey   [rocblas_stride]
-              specifies the pointer increment between vectors (y_i) and (y_i+1).
-    @param[inout]
-    A         device pointer to the first matrix A_1.
+    stride_B  [rocblas_stride]
+              stride from the start of one matrix (B_i) and the next one (B_i+1)
+
     @param[in]
-    lda       [rocblas_int]
-              specifies the leading dimension of each A_i.
+    beta
+            beta specifies the scalar beta. When beta is
+            zero then C need not be set before entry.
+
     @param[in]
-    strideA   [rocblas_stride]
-              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    C        device pointer to first matrix C_1 of dimension (ldc, n) on the GPU.
+
+    @param[in]
+    ldc    [rocblas_int]
+           ldc specifies the first dimension of C. ldc >= max( 1, m )
+
+    @param[inout]
+    stride_C  [rocblas_stride]
+              stride from the start of one matrix (C_i) and the next one (C_i+1)
+
     @param[in]
     batch_count [rocblas_int]
-              number of instances in the batch
+                number of instances in the batch
 
     ********************************************************************/
-
-ROCBLAS_EXPORT rocblas_status rocblas_zsyr2_strided_batched(rocblas_handle                handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zhemm_strided_batched(rocblas_handle                handle,
+                                                            rocblas_side                  side,
                                                             rocblas_fill                  uplo,
+                                                            rocblas_int                   m,
                                                             rocblas_int                   n,
                                                             const rocblas_double_complex* alpha,
-                                                            const rocblas_double_complex* x,
-                                                            rocblas_int                   incx,
-                                                            rocblas_stride                stridex,
-                                                            const rocblas_double_complex* y,
-                                                            rocblas_int                   incy,
-                                                            rocblas_stride                stridey,
-                                                            rocblas_double_complex*       A,
+                                                            const rocblas_double_complex* A,
                                                             rocblas_int                   lda,
-                                                            rocblas_stride                strideA,
+                                                            rocblas_stride                stride_A,
+                                                            const rocblas_double_complex* B,
+                                                            rocblas_int                   ldb,
+                                                            rocblas_stride                stride_B,
+                                                            const rocblas_double_complex* beta,
+                                                            rocblas_double_complex*       C,
+                                                            rocblas_int                   ldc,
+                                                            rocblas_stride                stride_C,
                                                             rocblas_int batch_count);
 
-/*
- * ===========================================================================
- *    level 3 BLAS
- * ===========================================================================
- */
-
-ROCBLAS_EXPORT rocblas_status rocblas_chemm(rocblas_handle               handle,
-                                            rocblas_side                 side,
+ROCBLAS_EXPORT rocblas_status rocblas_cherk(rocblas_handle               handle,
                                             rocblas_fill                 uplo,
+                                            rocblas_operation            transA,
                                             rocblas_int                  n,
                                             rocblas_int                  k,
-                                            const rocblas_float_complex* alpha,
+                                            const float*                 alpha,
                                             const rocblas_float_complex* A,
                                             rocblas_int                  lda,
-                                            const rocblas_float_complex* B,
-                                            rocblas_int                  ldb,
-                                            const rocblas_float_complex* beta,
+                                            const float*                 beta,
                                             rocblas_float_complex*       C,
                                             rocblas_int                  ldc);
 
@@ -9369,61 +11175,54 @@ ROCBLAS_EXPORT rocblas_status rocblas_chemm(rocblas_handle               handle,
 
     \details
 
-    hemm performs one of the matrix-matrix operations:
+    herk performs one of the matrix-matrix operations for a Hermitian rank-k update
 
-    C := alpha*A*B + beta*C if side == rocblas_side_left,
-    C := alpha*B*A + beta*C if side == rocblas_side_right,
+    C := alpha*op( A )*op( A )^H + beta*C
 
-    where alpha and beta are scalars, B and C are m by n matrices, and
-    A is a Hermitian matrix stored as either upper or lower.
+    where  alpha and beta are scalars, op(A) is an n by k matrix, and
+    C is a n x n Hermitian matrix stored as either upper or lower.
+
+        op( A ) = A, and A is n by k if transA == rocblas_operation_none
+        op( A ) = A^H and A is k by n if transA == rocblas_operation_conjugate_transpose
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
-    @param[in]
-    side  [rocblas_side]
-            rocblas_side_left:      C := alpha*A*B + beta*C
-            rocblas_side_right:     C := alpha*B*A + beta*C
-
     @param[in]
     uplo    [rocblas_fill]
-            rocblas_fill_upper:  A is an upper triangular matrix
-            rocblas_fill_lower:  A is a  lower triangular matrix
+            rocblas_fill_upper:  C is an upper triangular matrix
+            rocblas_fill_lower:  C is a  lower triangular matrix
 
     @param[in]
-    m       [rocblas_int]
-            m specifies the number of rows of B and C. m >= 0.
+    transA  [rocblas_operation]
+            rocblas_operation_conjugate_transpose:  op(A) = A^H
+            rocblas_operation_none:                 op(A) = A
 
     @param[in]
     n       [rocblas_int]
-            n specifies the number of columns of B and C. n >= 0.
+            n specifies the number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       [rocblas_int]
+            k specifies the number of columns of op(A). k >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A and B are not referenced.
+            zero then A is not referenced and A need not be set before
+            entry.
 
     @param[in]
     A       pointer storing matrix A on the GPU.
-            A is m by m if side == rocblas_side_left
-            A is n by n if side == rocblas_side_right
-            Only the upper/lower triangular part is accessed.
-            The imaginary component of the diagonal elements is not used.
+            Martrix dimension is ( lda, k ) when if transA = rocblas_operation_none, otherwise (lda, n)
+            only the upper/lower triangular part is accessed.
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            otherwise lda >= max( 1, n ).
-
-    @param[in]
-    B       pointer storing matrix B on the GPU.
-            Matrix dimension is m by n
-
-    @param[in]
-    ldb     [rocblas_int]
-            ldb specifies the first dimension of B. ldb >= max( 1, m )
+            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            otherwise lda >= max( 1, k ).
 
     @param[in]
     beta
@@ -9432,38 +11231,34 @@ ROCBLAS_EXPORT rocblas_status rocblas_chemm(rocblas_handle               handle,
 
     @param[in]
     C       pointer storing matrix C on the GPU.
-            Matrix dimension is m by n
+            The imaginary component of the diagonal elements are not used but are set to zero unless quick return.
 
     @param[in]
     ldc    [rocblas_int]
-           ldc specifies the first dimension of C. ldc >= max( 1, m )
+           ldc specifies the first dimension of C. ldc >= max( 1, n ).
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhemm(rocblas_handle                handle,
-                                            rocblas_side                  side,
+ROCBLAS_EXPORT rocblas_status rocblas_zherk(rocblas_handle                handle,
                                             rocblas_fill                  uplo,
+                                            rocblas_operation             transA,
                                             rocblas_int                   n,
                                             rocblas_int                   k,
-                                            const rocblas_double_complex* alpha,
+                                            const double*                 alpha,
                                             const rocblas_double_complex* A,
                                             rocblas_int                   lda,
-                                            const rocblas_double_complex* B,
-                                            rocblas_int                   ldb,
-                                            const rocblas_double_complex* beta,
+                                            const double*                 beta,
                                             rocblas_double_complex*       C,
                                             rocblas_int                   ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chemm_batched(rocblas_handle                     handle,
-                                                    rocblas_side                       side,
+ROCBLAS_EXPORT rocblas_status rocblas_cherk_batched(rocblas_handle                     handle,
                                                     rocblas_fill                       uplo,
-                                                    rocblas_int                        m,
+                                                    rocblas_operation                  transA,
                                                     rocblas_int                        n,
-                                                    const rocblas_float_complex*       alpha,
+                                                    rocblas_int                        k,
+                                                    const float*                       alpha,
                                                     const rocblas_float_complex* const A[],
                                                     rocblas_int                        lda,
-                                                    const rocblas_float_complex* const B[],
-                                                    rocblas_int                        ldb,
-                                                    const rocblas_float_complex*       beta,
+                                                    const float*                       beta,
                                                     rocblas_float_complex* const       C[],
                                                     rocblas_int                        ldc,
                                                     rocblas_int                        batch_count);
@@ -9472,108 +11267,94 @@ ROCBLAS_EXPORT rocblas_status rocblas_chemm_batched(rocblas_handle
 
     \details
 
-    hemm_batched performs a batch of the matrix-matrix operations:
+    herk_batched performs a batch of the matrix-matrix operations for a Hermitian rank-k update
 
-    C_i := alpha*A_i*B_i + beta*C_i if side == rocblas_side_left,
-    C_i := alpha*B_i*A_i + beta*C_i if side == rocblas_side_right,
+    C_i := alpha*op( A_i )*op( A_i )^H + beta*C_i
 
-    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
-    A_i is a Hermitian matrix stored as either upper or lower.
+    where  alpha and beta are scalars, op(A) is an n by k matrix, and
+    C_i is a n x n Hermitian matrix stored as either upper or lower.
+
+        op( A_i ) = A_i, and A_i is n by k if transA == rocblas_operation_none
+        op( A_i ) = A_i^H and A_i is k by n if transA == rocblas_operation_conjugate_transpose
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
-    @param[in]
-    side  [rocblas_side]
-            rocblas_side_left:      C_i := alpha*A_i*B_i + beta*C_i
-            rocblas_side_right:     C_i := alpha*B_i*A_i + beta*C_i
-
     @param[in]
     uplo    [rocblas_fill]
-            rocblas_fill_upper:  A_i is an upper triangular matrix
-            rocblas_fill_lower:  A_i is a  lower triangular matrix
+            rocblas_fill_upper:  C_i is an upper triangular matrix
+            rocblas_fill_lower:  C_i is a  lower triangular matrix
 
     @param[in]
-    m       [rocblas_int]
-            m specifies the number of rows of B_i and C_i. m >= 0.
+    transA  [rocblas_operation]
+            rocblas_operation_conjugate_transpose: op(A) = A^H
+            rocblas_operation_none:                op(A) = A
 
     @param[in]
     n       [rocblas_int]
-            n specifies the number of columns of B_i and C_i. n >= 0.
+            n specifies the number of rows and columns of C_i. n >= 0.
+
+    @param[in]
+    k       [rocblas_int]
+            k specifies the number of columns of op(A). k >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A_i and B_i are not referenced.
+            zero then A is not referenced and A need not be set before
+            entry.
 
     @param[in]
-    A       device array of device pointers storing each matrix A_i on the GPU.
-            A_i is m by m if side == rocblas_side_left
-            A_i is n by n if side == rocblas_side_right
-            Only the upper/lower triangular part is accessed.
-            The imaginary component of the diagonal elements is not used.
+    A       device array of device pointers storing each matrix_i A of dimension (lda, k)
+            when transA is rocblas_operation_none, otherwise of dimension (lda, n)
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A_i.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            otherwise lda >= max( 1, n ).
-
-    @param[in]
-    B       device array of device pointers storing each matrix B_i on the GPU.
-            Matrix dimension is m by n
-
-    @param[in]
-    ldb     [rocblas_int]
-            ldb specifies the first dimension of B_i. ldb >= max( 1, m )
+            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            otherwise lda >= max( 1, k ).
 
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
-            zero then C_i need not be set before entry.
+            zero then C need not be set before entry.
 
     @param[in]
     C       device array of device pointers storing each matrix C_i on the GPU.
-            Matrix dimension is m by n
+            The imaginary component of the diagonal elements are not used but are set to zero unless quick return.
 
     @param[in]
     ldc    [rocblas_int]
-           ldc specifies the first dimension of C_i. ldc >= max( 1, m )
-
+           ldc specifies the first dimension of C. ldc >= max( 1, n ).
     @param[in]
     batch_count [rocblas_int]
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhemm_batched(rocblas_handle                      handle,
-                                                    rocblas_side                        side,
+ROCBLAS_EXPORT rocblas_status rocblas_zherk_batched(rocblas_handle                      handle,
                                                     rocblas_fill                        uplo,
-                                                    rocblas_int                         m,
+                                                    rocblas_operation                   transA,
                                                     rocblas_int                         n,
-                                                    const rocblas_double_complex*       alpha,
+                                                    rocblas_int                         k,
+                                                    const double*                       alpha,
                                                     const rocblas_double_complex* const A[],
                                                     rocblas_int                         lda,
-                                                    const rocblas_double_complex* const B[],
-                                                    rocblas_int                         ldb,
-                                                    const rocblas_double_complex*       beta,
+                                                    const double*                       beta,
                                                     rocblas_double_complex* const       C[],
                                                     rocblas_int                         ldc,
                                                     rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_chemm_strided_batched(rocblas_handle               handle,
-                                                            rocblas_side                 side,
+ROCBLAS_EXPORT rocblas_status rocblas_cherk_strided_batched(rocblas_handle               handle,
                                                             rocblas_fill                 uplo,
-                                                            rocblas_int                  m,
+                                                            rocblas_operation            transA,
                                                             rocblas_int                  n,
-                                                            const rocblas_float_complex* alpha,
+                                                            rocblas_int                  k,
+                                                            const float*                 alpha,
                                                             const rocblas_float_complex* A,
                                                             rocblas_int                  lda,
                                                             rocblas_stride               stride_A,
-                                                            const rocblas_float_complex* B,
-                                                            rocblas_int                  ldb,
-                                                            rocblas_stride               stride_B,
-                                                            const rocblas_float_complex* beta,
+                                                            const float*                 beta,
                                                             rocblas_float_complex*       C,
                                                             rocblas_int                  ldc,
                                                             rocblas_stride               stride_C,
@@ -9583,82 +11364,71 @@ ROCBLAS_EXPORT rocblas_status rocblas_chemm_strided_batched(rocblas_handle
 
     \details
 
-    hemm_strided_batched performs a batch of the matrix-matrix operations:
+    herk_strided_batched performs a batch of the matrix-matrix operations for a Hermitian rank-k update
 
-    C_i := alpha*A_i*B_i + beta*C_i if side == rocblas_side_left,
-    C_i := alpha*B_i*A_i + beta*C_i if side == rocblas_side_right,
+    C_i := alpha*op( A_i )*op( A_i )^H + beta*C_i
+
+    where  alpha and beta are scalars, op(A) is an n by k matrix, and
+    C_i is a n x n Hermitian matrix stored as either upper or lower.
+
+        op( A_i ) = A_i, and A_i is n by k if transA == rocblas_operation_none
+        op( A_i ) = A_i^H and A_i is k by n if transA == rocblas_operation_conjugate_transpose
 
-    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
-    A_i is a Hermitian matrix stored as either upper or lower.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
-    @param[in]
-    side  [rocblas_side]
-            rocblas_side_left:      C_i := alpha*A_i*B_i + beta*C_i
-            rocblas_side_right:     C_i := alpha*B_i*A_i + beta*C_i
-
     @param[in]
     uplo    [rocblas_fill]
-            rocblas_fill_upper:  A_i is an upper triangular matrix
-            rocblas_fill_lower:  A_i is a  lower triangular matrix
+            rocblas_fill_upper:  C_i is an upper triangular matrix
+            rocblas_fill_lower:  C_i is a  lower triangular matrix
 
     @param[in]
-    m       [rocblas_int]
-            m specifies the number of rows of B_i and C_i. m >= 0.
+    transA  [rocblas_operation]
+            rocblas_operation_conjugate_transpose: op(A) = A^H
+            rocblas_operation_none:                op(A) = A
 
     @param[in]
     n       [rocblas_int]
-            n specifies the number of columns of B_i and C_i. n >= 0.
+            n specifies the number of rows and columns of C_i. n >= 0.
+
+    @param[in]
+    k       [rocblas_int]
+            k specifies the number of columns of op(A). k >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A_i and B_i are not referenced.
+            zero then A is not referenced and A need not be set before
+            entry.
 
     @param[in]
-    A       device pointer to first matrix A_1
-            A_i is m by m if side == rocblas_side_left
-            A_i is n by n if side == rocblas_side_right
-            Only the upper/lower triangular part is accessed.
-            The imaginary component of the diagonal elements is not used.
+    A       Device pointer to the first matrix A_1 on the GPU of dimension (lda, k)
+            when transA is rocblas_operation_none, otherwise of dimension (lda, n)
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A_i.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            otherwise lda >= max( 1, n ).
+            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            otherwise lda >= max( 1, k ).
 
     @param[in]
     stride_A  [rocblas_stride]
               stride from the start of one matrix (A_i) and the next one (A_i+1)
 
-    @param[in]
-    B       device pointer to first matrix B_1 of dimension (ldb, n) on the GPU
-
-    @param[in]
-    ldb     [rocblas_int]
-            ldb specifies the first dimension of B_i.
-            if side = rocblas_operation_none,  ldb >= max( 1, m ),
-            otherwise ldb >= max( 1, n ).
-
-    @param[in]
-    stride_B  [rocblas_stride]
-              stride from the start of one matrix (B_i) and the next one (B_i+1)
-
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
             zero then C need not be set before entry.
 
     @param[in]
-    C        device pointer to first matrix C_1 of dimension (ldc, n) on the GPU.
+    C       Device pointer to the first matrix C_1 on the GPU.
+            The imaginary component of the diagonal elements are not used but are set to zero unless quick return.
 
     @param[in]
     ldc    [rocblas_int]
-           ldc specifies the first dimension of C. ldc >= max( 1, m )
+           ldc specifies the first dimension of C. ldc >= max( 1, n ).
 
     @param[inout]
     stride_C  [rocblas_stride]
@@ -9666,52 +11436,51 @@ ROCBLAS_EXPORT rocblas_status rocblas_chemm_strided_batched(rocblas_handle
 
     @param[in]
     batch_count [rocblas_int]
-                number of instances in the batch
+                number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zhemm_strided_batched(rocblas_handle                handle,
-                                                            rocblas_side                  side,
+ROCBLAS_EXPORT rocblas_status rocblas_zherk_strided_batched(rocblas_handle                handle,
                                                             rocblas_fill                  uplo,
-                                                            rocblas_int                   m,
+                                                            rocblas_operation             transA,
                                                             rocblas_int                   n,
-                                                            const rocblas_double_complex* alpha,
+                                                            rocblas_int                   k,
+                                                            const double*                 alpha,
                                                             const rocblas_double_complex* A,
                                                             rocblas_int                   lda,
-                                                            rocblas_stride                stride_A,
-                                                            const rocblas_double_complex* B,
-                                                            rocblas_int                   ldb,
-                                                            rocblas_stride                stride_B,
-                                                            const rocblas_double_complex* beta,
-                                                            rocblas_double_complex*       C,
-                                                            rocblas_int                   ldc,
-                                                            rocblas_stride                stride_C,
-                                                            rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_cherk(rocblas_handle               handle,
-                                            rocblas_fill                 uplo,
-                                            rocblas_operation            transA,
-                                            rocblas_int                  n,
-                                            rocblas_int                  k,
-                                            const float*                 alpha,
-                                            const rocblas_float_complex* A,
-                                            rocblas_int                  lda,
-                                            const float*                 beta,
-                                            rocblas_float_complex*       C,
-                                            rocblas_int                  ldc);
+                                                            rocblas_stride                stride_A,
+                                                            const double*                 beta,
+                                                            rocblas_double_complex*       C,
+                                                            rocblas_int                   ldc,
+                                                            rocblas_stride                stride_C,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher2k(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             rocblas_operation            trans,
+                                             rocblas_int                  n,
+                                             rocblas_int                  k,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* A,
+                                             rocblas_int                  lda,
+                                             const rocblas_float_complex* B,
+                                             rocblas_int                  ldb,
+                                             const float*                 beta,
+                                             rocblas_float_complex*       C,
+                                             rocblas_int                  ldc);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    herk performs one of the matrix-matrix operations for a Hermitian rank-k update
+    her2k performs one of the matrix-matrix operations for a Hermitian rank-2k update
 
-    C := alpha*op( A )*op( A )^H + beta*C
+    C := alpha*op( A )*op( B )^H + conj(alpha)*op( B )*op( A )^H + beta*C
 
-    where  alpha and beta are scalars, op(A) is an n by k matrix, and
+    where  alpha and beta are scalars, op(A) and op(B) are n by k matrices, and
     C is a n x n Hermitian matrix stored as either upper or lower.
 
-        op( A ) = A, and A is n by k if transA == rocblas_operation_none
-        op( A ) = A^H and A is k by n if transA == rocblas_operation_conjugate_transpose
+        op( A ) = A, op( B ) = B, and A and B are n by k if trans == rocblas_operation_none
+        op( A ) = A^H, op( B ) = B^H,  and A and B are k by n if trans == rocblas_operation_conjugate_transpose
 
     @param[in]
     handle    [rocblas_handle]
@@ -9723,9 +11492,9 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherk(rocblas_handle               handle,
             rocblas_fill_lower:  C is a  lower triangular matrix
 
     @param[in]
-    transA  [rocblas_operation]
-            rocblas_operation_conjugate_transpose:  op(A) = A^H
-            rocblas_operation_none:                 op(A) = A
+    trans  [rocblas_operation]
+            rocblas_operation_conjugate_transpose:  op( A ) = A^H, op( B ) = B^H
+            rocblas_operation_none:                 op( A ) = A, op( B ) = B
 
     @param[in]
     n       [rocblas_int]
@@ -9743,16 +11512,25 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherk(rocblas_handle               handle,
 
     @param[in]
     A       pointer storing matrix A on the GPU.
-            Martrix dimension is ( lda, k ) when if transA = rocblas_operation_none, otherwise (lda, n)
+            Martrix dimension is ( lda, k ) when if trans = rocblas_operation_none, otherwise (lda, n)
             only the upper/lower triangular part is accessed.
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A.
-            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            if trans = rocblas_operation_none,  lda >= max( 1, n ),
             otherwise lda >= max( 1, k ).
+    @param[in]
+    B       pointer storing matrix B on the GPU.
+            Martrix dimension is ( ldb, k ) when if trans = rocblas_operation_none, otherwise (ldb, n)
+            only the upper/lower triangular part is accessed.
 
     @param[in]
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B.
+            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
+            otherwise ldb >= max( 1, k ).
+    @param[in]
     beta
             beta specifies the scalar beta. When beta is
             zero then C need not be set before entry.
@@ -9766,44 +11544,48 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherk(rocblas_handle               handle,
            ldc specifies the first dimension of C. ldc >= max( 1, n ).
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zherk(rocblas_handle                handle,
-                                            rocblas_fill                  uplo,
-                                            rocblas_operation             transA,
-                                            rocblas_int                   n,
-                                            rocblas_int                   k,
-                                            const double*                 alpha,
-                                            const rocblas_double_complex* A,
-                                            rocblas_int                   lda,
-                                            const double*                 beta,
-                                            rocblas_double_complex*       C,
-                                            rocblas_int                   ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_zher2k(rocblas_handle                handle,
+                                             rocblas_fill                  uplo,
+                                             rocblas_operation             trans,
+                                             rocblas_int                   n,
+                                             rocblas_int                   k,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* A,
+                                             rocblas_int                   lda,
+                                             const rocblas_double_complex* B,
+                                             rocblas_int                   ldb,
+                                             const double*                 beta,
+                                             rocblas_double_complex*       C,
+                                             rocblas_int                   ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cherk_batched(rocblas_handle                     handle,
-                                                    rocblas_fill                       uplo,
-                                                    rocblas_operation                  transA,
-                                                    rocblas_int                        n,
-                                                    rocblas_int                        k,
-                                                    const float*                       alpha,
-                                                    const rocblas_float_complex* const A[],
-                                                    rocblas_int                        lda,
-                                                    const float*                       beta,
-                                                    rocblas_float_complex* const       C[],
-                                                    rocblas_int                        ldc,
-                                                    rocblas_int                        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_cher2k_batched(rocblas_handle                     handle,
+                                                     rocblas_fill                       uplo,
+                                                     rocblas_operation                  trans,
+                                                     rocblas_int                        n,
+                                                     rocblas_int                        k,
+                                                     const rocblas_float_complex*       alpha,
+                                                     const rocblas_float_complex* const A[],
+                                                     rocblas_int                        lda,
+                                                     const rocblas_float_complex* const B[],
+                                                     rocblas_int                        ldb,
+                                                     const float*                       beta,
+                                                     rocblas_float_complex* const       C[],
+                                                     rocblas_int                        ldc,
+                                                     rocblas_int batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    herk_batched performs a batch of the matrix-matrix operations for a Hermitian rank-k update
+    her2k_batched performs a batch of the matrix-matrix operations for a Hermitian rank-2k update
 
-    C_i := alpha*op( A_i )*op( A_i )^H + beta*C_i
+    C_i := alpha*op( A_i )*op( B_i )^H + conj(alpha)*op( B_i )*op( A_i )^H + beta*C_i
 
-    where  alpha and beta are scalars, op(A) is an n by k matrix, and
+    where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrices, and
     C_i is a n x n Hermitian matrix stored as either upper or lower.
 
-        op( A_i ) = A_i, and A_i is n by k if transA == rocblas_operation_none
-        op( A_i ) = A_i^H and A_i is k by n if transA == rocblas_operation_conjugate_transpose
+        op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
+        op( A_i ) = A_i^H, op( B_i ) = B_i^H,  and A_i and B_i are k by n if trans == rocblas_operation_conjugate_transpose
 
     @param[in]
     handle    [rocblas_handle]
@@ -9815,7 +11597,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherk_batched(rocblas_handle
             rocblas_fill_lower:  C_i is a  lower triangular matrix
 
     @param[in]
-    transA  [rocblas_operation]
+    trans  [rocblas_operation]
             rocblas_operation_conjugate_transpose: op(A) = A^H
             rocblas_operation_none:                op(A) = A
 
@@ -9835,15 +11617,23 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherk_batched(rocblas_handle
 
     @param[in]
     A       device array of device pointers storing each matrix_i A of dimension (lda, k)
-            when transA is rocblas_operation_none, otherwise of dimension (lda, n)
+            when trans is rocblas_operation_none, otherwise of dimension (lda, n)
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A_i.
-            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            if trans = rocblas_operation_none,  lda >= max( 1, n ),
             otherwise lda >= max( 1, k ).
+    @param[in]
+    B       device array of device pointers storing each matrix_i B of dimension (ldb, k)
+            when trans is rocblas_operation_none, otherwise of dimension (ldb, n)
 
     @param[in]
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B_i.
+            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
+            otherwise ldb >= max( 1, k ).
+    @param[in]
     beta
             beta specifies the scalar beta. When beta is
             zero then C need not be set before entry.
@@ -9860,48 +11650,52 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherk_batched(rocblas_handle
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zherk_batched(rocblas_handle                      handle,
-                                                    rocblas_fill                        uplo,
-                                                    rocblas_operation                   transA,
-                                                    rocblas_int                         n,
-                                                    rocblas_int                         k,
-                                                    const double*                       alpha,
-                                                    const rocblas_double_complex* const A[],
-                                                    rocblas_int                         lda,
-                                                    const double*                       beta,
-                                                    rocblas_double_complex* const       C[],
-                                                    rocblas_int                         ldc,
-                                                    rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zher2k_batched(rocblas_handle                      handle,
+                                                     rocblas_fill                        uplo,
+                                                     rocblas_operation                   trans,
+                                                     rocblas_int                         n,
+                                                     rocblas_int                         k,
+                                                     const rocblas_double_complex*       alpha,
+                                                     const rocblas_double_complex* const A[],
+                                                     rocblas_int                         lda,
+                                                     const rocblas_double_complex* const B[],
+                                                     rocblas_int                         ldb,
+                                                     const double*                       beta,
+                                                     rocblas_double_complex* const       C[],
+                                                     rocblas_int                         ldc,
+                                                     rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cherk_strided_batched(rocblas_handle               handle,
-                                                            rocblas_fill                 uplo,
-                                                            rocblas_operation            transA,
-                                                            rocblas_int                  n,
-                                                            rocblas_int                  k,
-                                                            const float*                 alpha,
-                                                            const rocblas_float_complex* A,
-                                                            rocblas_int                  lda,
-                                                            rocblas_stride               stride_A,
-                                                            const float*                 beta,
-                                                            rocblas_float_complex*       C,
-                                                            rocblas_int                  ldc,
-                                                            rocblas_stride               stride_C,
-                                                            rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_cher2k_strided_batched(rocblas_handle               handle,
+                                                             rocblas_fill                 uplo,
+                                                             rocblas_operation            trans,
+                                                             rocblas_int                  n,
+                                                             rocblas_int                  k,
+                                                             const rocblas_float_complex* alpha,
+                                                             const rocblas_float_complex* A,
+                                                             rocblas_int                  lda,
+                                                             rocblas_stride               stride_A,
+                                                             const rocblas_float_complex* B,
+                                                             rocblas_int                  ldb,
+                                                             rocblas_stride               stride_B,
+                                                             const float*                 beta,
+                                                             rocblas_float_complex*       C,
+                                                             rocblas_int                  ldc,
+                                                             rocblas_stride               stride_C,
+                                                             rocblas_int batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    herk_strided_batched performs a batch of the matrix-matrix operations for a Hermitian rank-k update
+    her2k_strided_batched performs a batch of the matrix-matrix operations for a Hermitian rank-2k update
 
-    C_i := alpha*op( A_i )*op( A_i )^H + beta*C_i
+    C_i := alpha*op( A_i )*op( B_i )^H + conj(alpha)*op( B_i )*op( A_i )^H + beta*C_i
 
-    where  alpha and beta are scalars, op(A) is an n by k matrix, and
+    where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrices, and
     C_i is a n x n Hermitian matrix stored as either upper or lower.
 
-        op( A_i ) = A_i, and A_i is n by k if transA == rocblas_operation_none
-        op( A_i ) = A_i^H and A_i is k by n if transA == rocblas_operation_conjugate_transpose
-
+        op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
+        op( A_i ) = A_i^H, op( B_i ) = B_i^H,  and A_i and B_i are k by n if trans == rocblas_operation_conjugate_transpose
 
     @param[in]
     handle    [rocblas_handle]
@@ -9913,9 +11707,9 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherk_strided_batched(rocblas_handle
             rocblas_fill_lower:  C_i is a  lower triangular matrix
 
     @param[in]
-    transA  [rocblas_operation]
-            rocblas_operation_conjugate_transpose: op(A) = A^H
-            rocblas_operation_none:                op(A) = A
+    trans  [rocblas_operation]
+            rocblas_operation_conjugate_transpose: op( A_i ) = A_i^H, op( B_i ) = B_i^H
+            rocblas_operation_none:                op( A_i ) = A_i, op( B_i ) = B_i
 
     @param[in]
     n       [rocblas_int]
@@ -9933,18 +11727,32 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherk_strided_batched(rocblas_handle
 
     @param[in]
     A       Device pointer to the first matrix A_1 on the GPU of dimension (lda, k)
-            when transA is rocblas_operation_none, otherwise of dimension (lda, n)
+            when trans is rocblas_operation_none, otherwise of dimension (lda, n)
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A_i.
-            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            if trans = rocblas_operation_none,  lda >= max( 1, n ),
             otherwise lda >= max( 1, k ).
 
     @param[in]
     stride_A  [rocblas_stride]
               stride from the start of one matrix (A_i) and the next one (A_i+1)
 
+    @param[in]
+    B       Device pointer to the first matrix B_1 on the GPU of dimension (ldb, k)
+            when trans is rocblas_operation_none, otherwise of dimension (ldb, n)
+
+    @param[in]
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B_i.
+            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
+            otherwise ldb >= max( 1, k ).
+
+    @param[in]
+    stride_B  [rocblas_stride]
+              stride from the start of one matrix (B_i) and the next one (B_i+1)
+
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
@@ -9967,22 +11775,25 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherk_strided_batched(rocblas_handle
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zherk_strided_batched(rocblas_handle                handle,
-                                                            rocblas_fill                  uplo,
-                                                            rocblas_operation             transA,
-                                                            rocblas_int                   n,
-                                                            rocblas_int                   k,
-                                                            const double*                 alpha,
-                                                            const rocblas_double_complex* A,
-                                                            rocblas_int                   lda,
-                                                            rocblas_stride                stride_A,
-                                                            const double*                 beta,
-                                                            rocblas_double_complex*       C,
-                                                            rocblas_int                   ldc,
-                                                            rocblas_stride                stride_C,
-                                                            rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zher2k_strided_batched(rocblas_handle                handle,
+                                                             rocblas_fill                  uplo,
+                                                             rocblas_operation             trans,
+                                                             rocblas_int                   n,
+                                                             rocblas_int                   k,
+                                                             const rocblas_double_complex* alpha,
+                                                             const rocblas_double_complex* A,
+                                                             rocblas_int                   lda,
+                                                             rocblas_stride                stride_A,
+                                                             const rocblas_double_complex* B,
+                                                             rocblas_int                   ldb,
+                                                             rocblas_stride                stride_B,
+                                                             const double*                 beta,
+                                                             rocblas_double_complex*       C,
+                                                             rocblas_int                   ldc,
+                                                             rocblas_stride                stride_C,
+                                                             rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cher2k(rocblas_handle               handle,
+ROCBLAS_EXPORT rocblas_status rocblas_cherkx(rocblas_handle               handle,
                                              rocblas_fill                 uplo,
                                              rocblas_operation            trans,
                                              rocblas_int                  n,
@@ -10000,12 +11811,14 @@ ROCBLAS_EXPORT rocblas_status rocblas_cher2k(rocblas_handle               handle
 
     \details
 
-    her2k performs one of the matrix-matrix operations for a Hermitian rank-2k update
+    herkx performs one of the matrix-matrix operations for a Hermitian rank-k update
 
-    C := alpha*op( A )*op( B )^H + conj(alpha)*op( B )*op( A )^H + beta*C
+    C := alpha*op( A )*op( B )^H + beta*C
 
     where  alpha and beta are scalars, op(A) and op(B) are n by k matrices, and
     C is a n x n Hermitian matrix stored as either upper or lower.
+    This routine should only be used when the caller can guarantee that the result of op( A )*op( B )^T will be Hermitian.
+
 
         op( A ) = A, op( B ) = B, and A and B are n by k if trans == rocblas_operation_none
         op( A ) = A^H, op( B ) = B^H,  and A and B are k by n if trans == rocblas_operation_conjugate_transpose
@@ -10072,7 +11885,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_cher2k(rocblas_handle               handle
            ldc specifies the first dimension of C. ldc >= max( 1, n ).
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zher2k(rocblas_handle                handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zherkx(rocblas_handle                handle,
                                              rocblas_fill                  uplo,
                                              rocblas_operation             trans,
                                              rocblas_int                   n,
@@ -10086,7 +11899,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_zher2k(rocblas_handle                handl
                                              rocblas_double_complex*       C,
                                              rocblas_int                   ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cher2k_batched(rocblas_handle                     handle,
+ROCBLAS_EXPORT rocblas_status rocblas_cherkx_batched(rocblas_handle                     handle,
                                                      rocblas_fill                       uplo,
                                                      rocblas_operation                  trans,
                                                      rocblas_int                        n,
@@ -10105,12 +11918,13 @@ ROCBLAS_EXPORT rocblas_status rocblas_cher2k_batched(rocblas_handle
 
     \details
 
-    her2k_batched performs a batch of the matrix-matrix operations for a Hermitian rank-2k update
+    herkx_batched performs a batch of the matrix-matrix operations for a Hermitian rank-k update
 
-    C_i := alpha*op( A_i )*op( B_i )^H + conj(alpha)*op( B_i )*op( A_i )^H + beta*C_i
+    C_i := alpha*op( A_i )*op( B_i )^H + beta*C_i
 
     where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrices, and
     C_i is a n x n Hermitian matrix stored as either upper or lower.
+    This routine should only be used when the caller can guarantee that the result of op( A )*op( B )^T will be Hermitian.
 
         op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
         op( A_i ) = A_i^H, op( B_i ) = B_i^H,  and A_i and B_i are k by n if trans == rocblas_operation_conjugate_transpose
@@ -10152,6 +11966,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_cher2k_batched(rocblas_handle
             lda specifies the first dimension of A_i.
             if trans = rocblas_operation_none,  lda >= max( 1, n ),
             otherwise lda >= max( 1, k ).
+
     @param[in]
     B       device array of device pointers storing each matrix_i B of dimension (ldb, k)
             when trans is rocblas_operation_none, otherwise of dimension (ldb, n)
@@ -10161,6 +11976,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_cher2k_batched(rocblas_handle
             ldb specifies the first dimension of B_i.
             if trans = rocblas_operation_none,  ldb >= max( 1, n ),
             otherwise ldb >= max( 1, k ).
+
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
@@ -10173,12 +11989,13 @@ ROCBLAS_EXPORT rocblas_status rocblas_cher2k_batched(rocblas_handle
     @param[in]
     ldc    [rocblas_int]
            ldc specifies the first dimension of C. ldc >= max( 1, n ).
+
     @param[in]
     batch_count [rocblas_int]
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zher2k_batched(rocblas_handle                      handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zherkx_batched(rocblas_handle                      handle,
                                                      rocblas_fill                        uplo,
                                                      rocblas_operation                   trans,
                                                      rocblas_int                         n,
@@ -10193,7 +12010,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_zher2k_batched(rocblas_handle
                                                      rocblas_int                         ldc,
                                                      rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cher2k_strided_batched(rocblas_handle               handle,
+ROCBLAS_EXPORT rocblas_status rocblas_cherkx_strided_batched(rocblas_handle               handle,
                                                              rocblas_fill                 uplo,
                                                              rocblas_operation            trans,
                                                              rocblas_int                  n,
@@ -10215,12 +12032,13 @@ ROCBLAS_EXPORT rocblas_status rocblas_cher2k_strided_batched(rocblas_handle
 
     \details
 
-    her2k_strided_batched performs a batch of the matrix-matrix operations for a Hermitian rank-2k update
+    herkx_strided_batched performs a batch of the matrix-matrix operations for a Hermitian rank-k update
 
-    C_i := alpha*op( A_i )*op( B_i )^H + conj(alpha)*op( B_i )*op( A_i )^H + beta*C_i
+    C_i := alpha*op( A_i )*op( B_i )^H + beta*C_i
 
     where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrices, and
     C_i is a n x n Hermitian matrix stored as either upper or lower.
+    This routine should only be used when the caller can guarantee that the result of op( A )*op( B )^T will be Hermitian.
 
         op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
         op( A_i ) = A_i^H, op( B_i ) = B_i^H,  and A_i and B_i are k by n if trans == rocblas_operation_conjugate_transpose
@@ -10303,7 +12121,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_cher2k_strided_batched(rocblas_handle
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zher2k_strided_batched(rocblas_handle                handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zherkx_strided_batched(rocblas_handle                handle,
                                                              rocblas_fill                  uplo,
                                                              rocblas_operation             trans,
                                                              rocblas_int                   n,
@@ -10321,84 +12139,107 @@ ROCBLAS_EXPORT rocblas_status rocblas_zher2k_strided_batched(rocblas_handle
                                                              rocblas_stride                stride_C,
                                                              rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cherkx(rocblas_handle               handle,
-                                             rocblas_fill                 uplo,
-                                             rocblas_operation            trans,
-                                             rocblas_int                  n,
-                                             rocblas_int                  k,
-                                             const rocblas_float_complex* alpha,
-                                             const rocblas_float_complex* A,
-                                             rocblas_int                  lda,
-                                             const rocblas_float_complex* B,
-                                             rocblas_int                  ldb,
-                                             const float*                 beta,
-                                             rocblas_float_complex*       C,
-                                             rocblas_int                  ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_ssymm(rocblas_handle handle,
+                                            rocblas_side   side,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    m,
+                                            rocblas_int    n,
+                                            const float*   alpha,
+                                            const float*   A,
+                                            rocblas_int    lda,
+                                            const float*   B,
+                                            rocblas_int    ldb,
+                                            const float*   beta,
+                                            float*         C,
+                                            rocblas_int    ldc);
 
-/*! \brief BLAS Level 3 API
+ROCBLAS_EXPORT rocblas_status rocblas_dsymm(rocblas_handle handle,
+                                            rocblas_side   side,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    m,
+                                            rocblas_int    n,
+                                            const double*  alpha,
+                                            const double*  A,
+                                            rocblas_int    lda,
+                                            const double*  B,
+                                            rocblas_int    ldb,
+                                            const double*  beta,
+                                            double*        C,
+                                            rocblas_int    ldc);
 
-    \details
+ROCBLAS_EXPORT rocblas_status rocblas_csymm(rocblas_handle               handle,
+                                            rocblas_side                 side,
+                                            rocblas_fill                 uplo,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            const rocblas_float_complex* B,
+                                            rocblas_int                  ldb,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex*       C,
+                                            rocblas_int                  ldc);
 
-    herkx performs one of the matrix-matrix operations for a Hermitian rank-k update
+/*! \brief BLAS Level 3 API
 
-    C := alpha*op( A )*op( B )^H + beta*C
+    \details
 
-    where  alpha and beta are scalars, op(A) and op(B) are n by k matrices, and
-    C is a n x n Hermitian matrix stored as either upper or lower.
-    This routine should only be used when the caller can guarantee that the result of op( A )*op( B )^T will be Hermitian.
+    symm performs one of the matrix-matrix operations:
 
+    C := alpha*A*B + beta*C if side == rocblas_side_left,
+    C := alpha*B*A + beta*C if side == rocblas_side_right,
 
-        op( A ) = A, op( B ) = B, and A and B are n by k if trans == rocblas_operation_none
-        op( A ) = A^H, op( B ) = B^H,  and A and B are k by n if trans == rocblas_operation_conjugate_transpose
+    where alpha and beta are scalars, B and C are m by n matrices, and
+    A is a symmetric matrix stored as either upper or lower.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
     @param[in]
-    uplo    [rocblas_fill]
-            rocblas_fill_upper:  C is an upper triangular matrix
-            rocblas_fill_lower:  C is a  lower triangular matrix
+    side  [rocblas_side]
+            rocblas_side_left:      C := alpha*A*B + beta*C
+            rocblas_side_right:     C := alpha*B*A + beta*C
 
     @param[in]
-    trans  [rocblas_operation]
-            rocblas_operation_conjugate_transpose:  op( A ) = A^H, op( B ) = B^H
-            rocblas_operation_none:                 op( A ) = A, op( B ) = B
+    uplo    [rocblas_fill]
+            rocblas_fill_upper:  A is an upper triangular matrix
+            rocblas_fill_lower:  A is a  lower triangular matrix
 
     @param[in]
-    n       [rocblas_int]
-            n specifies the number of rows and columns of C. n >= 0.
+    m       [rocblas_int]
+            m specifies the number of rows of B and C. m >= 0.
 
     @param[in]
-    k       [rocblas_int]
-            k specifies the number of columns of op(A). k >= 0.
+    n       [rocblas_int]
+            n specifies the number of columns of B and C. n >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A is not referenced and A need not be set before
-            entry.
+            zero then A and B are not referenced.
 
     @param[in]
     A       pointer storing matrix A on the GPU.
-            Martrix dimension is ( lda, k ) when if trans = rocblas_operation_none, otherwise (lda, n)
+            A is m by m if side == rocblas_side_left
+            A is n by n if side == rocblas_side_right
             only the upper/lower triangular part is accessed.
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A.
-            if trans = rocblas_operation_none,  lda >= max( 1, n ),
-            otherwise lda >= max( 1, k ).
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            otherwise lda >= max( 1, n ).
+
     @param[in]
     B       pointer storing matrix B on the GPU.
-            Martrix dimension is ( ldb, k ) when if trans = rocblas_operation_none, otherwise (ldb, n)
-            only the upper/lower triangular part is accessed.
+            Matrix dimension is m by n
 
     @param[in]
     ldb     [rocblas_int]
-            ldb specifies the first dimension of B.
-            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
-            otherwise ldb >= max( 1, k ).
+            ldb specifies the first dimension of B. ldb >= max( 1, m )
+
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
@@ -10406,239 +12247,294 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherkx(rocblas_handle               handle
 
     @param[in]
     C       pointer storing matrix C on the GPU.
-            The imaginary component of the diagonal elements are not used but are set to zero unless quick return.
+            Matrix dimension is m by n
 
     @param[in]
     ldc    [rocblas_int]
-           ldc specifies the first dimension of C. ldc >= max( 1, n ).
+           ldc specifies the first dimension of C. ldc >= max( 1, m )
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zherkx(rocblas_handle                handle,
-                                             rocblas_fill                  uplo,
-                                             rocblas_operation             trans,
-                                             rocblas_int                   n,
-                                             rocblas_int                   k,
-                                             const rocblas_double_complex* alpha,
-                                             const rocblas_double_complex* A,
-                                             rocblas_int                   lda,
-                                             const rocblas_double_complex* B,
-                                             rocblas_int                   ldb,
-                                             const double*                 beta,
-                                             rocblas_double_complex*       C,
-                                             rocblas_int                   ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_zsymm(rocblas_handle                handle,
+                                            rocblas_side                  side,
+                                            rocblas_fill                  uplo,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const rocblas_double_complex* B,
+                                            rocblas_int                   ldb,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cherkx_batched(rocblas_handle                     handle,
-                                                     rocblas_fill                       uplo,
-                                                     rocblas_operation                  trans,
-                                                     rocblas_int                        n,
-                                                     rocblas_int                        k,
-                                                     const rocblas_float_complex*       alpha,
-                                                     const rocblas_float_complex* const A[],
-                                                     rocblas_int                        lda,
-                                                     const rocblas_float_complex* const B[],
-                                                     rocblas_int                        ldb,
-                                                     const float*                       beta,
-                                                     rocblas_float_complex* const       C[],
-                                                     rocblas_int                        ldc,
-                                                     rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssymm_batched(rocblas_handle     handle,
+                                                    rocblas_side       side,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_int        m,
+                                                    rocblas_int        n,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    rocblas_int        lda,
+                                                    const float* const B[],
+                                                    rocblas_int        ldb,
+                                                    const float*       beta,
+                                                    float* const       C[],
+                                                    rocblas_int        ldc,
+                                                    rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsymm_batched(rocblas_handle      handle,
+                                                    rocblas_side        side,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_int         m,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    rocblas_int         lda,
+                                                    const double* const B[],
+                                                    rocblas_int         ldb,
+                                                    const double*       beta,
+                                                    double* const       C[],
+                                                    rocblas_int         ldc,
+                                                    rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csymm_batched(rocblas_handle                     handle,
+                                                    rocblas_side                       side,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_int                        m,
+                                                    rocblas_int                        n,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const A[],
+                                                    rocblas_int                        lda,
+                                                    const rocblas_float_complex* const B[],
+                                                    rocblas_int                        ldb,
+                                                    const rocblas_float_complex*       beta,
+                                                    rocblas_float_complex* const       C[],
+                                                    rocblas_int                        ldc,
+                                                    rocblas_int                        batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    herkx_batched performs a batch of the matrix-matrix operations for a Hermitian rank-k update
-
-    C_i := alpha*op( A_i )*op( B_i )^H + beta*C_i
+    symm_batched performs a batch of the matrix-matrix operations:
 
-    where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrices, and
-    C_i is a n x n Hermitian matrix stored as either upper or lower.
-    This routine should only be used when the caller can guarantee that the result of op( A )*op( B )^T will be Hermitian.
+    C_i := alpha*A_i*B_i + beta*C_i if side == rocblas_side_left,
+    C_i := alpha*B_i*A_i + beta*C_i if side == rocblas_side_right,
 
-        op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
-        op( A_i ) = A_i^H, op( B_i ) = B_i^H,  and A_i and B_i are k by n if trans == rocblas_operation_conjugate_transpose
+    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
+    A_i is a symmetric matrix stored as either upper or lower.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
     @param[in]
-    uplo    [rocblas_fill]
-            rocblas_fill_upper:  C_i is an upper triangular matrix
-            rocblas_fill_lower:  C_i is a  lower triangular matrix
+    side  [rocblas_side]
+            rocblas_side_left:      C_i := alpha*A_i*B_i + beta*C_i
+            rocblas_side_right:     C_i := alpha*B_i*A_i + beta*C_i
 
     @param[in]
-    trans  [rocblas_operation]
-            rocblas_operation_conjugate_transpose: op(A) = A^H
-            rocblas_operation_none:                op(A) = A
+    uplo    [rocblas_fill]
+            rocblas_fill_upper:  A_i is an upper triangular matrix
+            rocblas_fill_lower:  A_i is a  lower triangular matrix
 
     @param[in]
-    n       [rocblas_int]
-            n specifies the number of rows and columns of C_i. n >= 0.
+    m       [rocblas_int]
+            m specifies the number of rows of B_i and C_i. m >= 0.
 
     @param[in]
-    k       [rocblas_int]
-            k specifies the number of columns of op(A). k >= 0.
+    n       [rocblas_int]
+            n specifies the number of columns of B_i and C_i. n >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A is not referenced and A need not be set before
-            entry.
+            zero then A_i and B_i are not referenced.
 
     @param[in]
-    A       device array of device pointers storing each matrix_i A of dimension (lda, k)
-            when trans is rocblas_operation_none, otherwise of dimension (lda, n)
+    A       device array of device pointers storing each matrix A_i on the GPU.
+            A_i is m by m if side == rocblas_side_left
+            A_i is n by n if side == rocblas_side_right
+            only the upper/lower triangular part is accessed.
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A_i.
-            if trans = rocblas_operation_none,  lda >= max( 1, n ),
-            otherwise lda >= max( 1, k ).
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            otherwise lda >= max( 1, n ).
 
     @param[in]
-    B       device array of device pointers storing each matrix_i B of dimension (ldb, k)
-            when trans is rocblas_operation_none, otherwise of dimension (ldb, n)
+    B       device array of device pointers storing each matrix B_i on the GPU.
+            Matrix dimension is m by n
 
     @param[in]
     ldb     [rocblas_int]
-            ldb specifies the first dimension of B_i.
-            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
-            otherwise ldb >= max( 1, k ).
+            ldb specifies the first dimension of B_i. ldb >= max( 1, m )
 
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
-            zero then C need not be set before entry.
+            zero then C_i need not be set before entry.
 
     @param[in]
     C       device array of device pointers storing each matrix C_i on the GPU.
-            The imaginary component of the diagonal elements are not used but are set to zero unless quick return.
+            Matrix dimension is m by n
 
     @param[in]
     ldc    [rocblas_int]
-           ldc specifies the first dimension of C. ldc >= max( 1, n ).
+           ldc specifies the first dimension of C_i. ldc >= max( 1, m )
 
     @param[in]
     batch_count [rocblas_int]
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zherkx_batched(rocblas_handle                      handle,
-                                                     rocblas_fill                        uplo,
-                                                     rocblas_operation                   trans,
-                                                     rocblas_int                         n,
-                                                     rocblas_int                         k,
-                                                     const rocblas_double_complex*       alpha,
-                                                     const rocblas_double_complex* const A[],
-                                                     rocblas_int                         lda,
-                                                     const rocblas_double_complex* const B[],
-                                                     rocblas_int                         ldb,
-                                                     const double*                       beta,
-                                                     rocblas_double_complex* const       C[],
-                                                     rocblas_int                         ldc,
-                                                     rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zsymm_batched(rocblas_handle                      handle,
+                                                    rocblas_side                        side,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_int                         m,
+                                                    rocblas_int                         n,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const A[],
+                                                    rocblas_int                         lda,
+                                                    const rocblas_double_complex* const B[],
+                                                    rocblas_int                         ldb,
+                                                    const rocblas_double_complex*       beta,
+                                                    rocblas_double_complex* const       C[],
+                                                    rocblas_int                         ldc,
+                                                    rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_cherkx_strided_batched(rocblas_handle               handle,
-                                                             rocblas_fill                 uplo,
-                                                             rocblas_operation            trans,
-                                                             rocblas_int                  n,
-                                                             rocblas_int                  k,
-                                                             const rocblas_float_complex* alpha,
-                                                             const rocblas_float_complex* A,
-                                                             rocblas_int                  lda,
-                                                             rocblas_stride               stride_A,
-                                                             const rocblas_float_complex* B,
-                                                             rocblas_int                  ldb,
-                                                             rocblas_stride               stride_B,
-                                                             const float*                 beta,
-                                                             rocblas_float_complex*       C,
-                                                             rocblas_int                  ldc,
-                                                             rocblas_stride               stride_C,
-                                                             rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssymm_strided_batched(rocblas_handle handle,
+                                                            rocblas_side   side,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    m,
+                                                            rocblas_int    n,
+                                                            const float*   alpha,
+                                                            const float*   A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride stride_A,
+                                                            const float*   B,
+                                                            rocblas_int    ldb,
+                                                            rocblas_stride stride_B,
+                                                            const float*   beta,
+                                                            float*         C,
+                                                            rocblas_int    ldc,
+                                                            rocblas_stride stride_C,
+                                                            rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsymm_strided_batched(rocblas_handle handle,
+                                                            rocblas_side   side,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    m,
+                                                            rocblas_int    n,
+                                                            const double*  alpha,
+                                                            const double*  A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride stride_A,
+                                                            const double*  B,
+                                                            rocblas_int    ldb,
+                                                            rocblas_stride stride_B,
+                                                            const double*  beta,
+                                                            double*        C,
+                                                            rocblas_int    ldc,
+                                                            rocblas_stride stride_C,
+                                                            rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csymm_strided_batched(rocblas_handle               handle,
+                                                            rocblas_side                 side,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_int                  m,
+                                                            rocblas_int                  n,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* A,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               stride_A,
+                                                            const rocblas_float_complex* B,
+                                                            rocblas_int                  ldb,
+                                                            rocblas_stride               stride_B,
+                                                            const rocblas_float_complex* beta,
+                                                            rocblas_float_complex*       C,
+                                                            rocblas_int                  ldc,
+                                                            rocblas_stride               stride_C,
+                                                            rocblas_int batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    herkx_strided_batched performs a batch of the matrix-matrix operations for a Hermitian rank-k update
-
-    C_i := alpha*op( A_i )*op( B_i )^H + beta*C_i
+    symm_strided_batched performs a batch of the matrix-matrix operations:
 
-    where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrices, and
-    C_i is a n x n Hermitian matrix stored as either upper or lower.
-    This routine should only be used when the caller can guarantee that the result of op( A )*op( B )^T will be Hermitian.
+    C_i := alpha*A_i*B_i + beta*C_i if side == rocblas_side_left,
+    C_i := alpha*B_i*A_i + beta*C_i if side == rocblas_side_right,
 
-        op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
-        op( A_i ) = A_i^H, op( B_i ) = B_i^H,  and A_i and B_i are k by n if trans == rocblas_operation_conjugate_transpose
+    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
+    A_i is a symmetric matrix stored as either upper or lower.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
     @param[in]
-    uplo    [rocblas_fill]
-            rocblas_fill_upper:  C_i is an upper triangular matrix
-            rocblas_fill_lower:  C_i is a  lower triangular matrix
+    side  [rocblas_side]
+            rocblas_side_left:      C_i := alpha*A_i*B_i + beta*C_i
+            rocblas_side_right:     C_i := alpha*B_i*A_i + beta*C_i
 
     @param[in]
-    trans  [rocblas_operation]
-            rocblas_operation_conjugate_transpose: op( A_i ) = A_i^H, op( B_i ) = B_i^H
-            rocblas_operation_none:                op( A_i ) = A_i, op( B_i ) = B_i
+    uplo    [rocblas_fill]
+            rocblas_fill_upper:  A_i is an upper triangular matrix
+            rocblas_fill_lower:  A_i is a  lower triangular matrix
 
     @param[in]
-    n       [rocblas_int]
-            n specifies the number of rows and columns of C_i. n >= 0.
+    m       [rocblas_int]
+            m specifies the number of rows of B_i and C_i. m >= 0.
 
     @param[in]
-    k       [rocblas_int]
-            k specifies the number of columns of op(A). k >= 0.
+    n       [rocblas_int]
+            n specifies the number of columns of B_i and C_i. n >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A is not referenced and A need not be set before
-            entry.
+            zero then A_i and B_i are not referenced.
 
     @param[in]
-    A       Device pointer to the first matrix A_1 on the GPU of dimension (lda, k)
-            when trans is rocblas_operation_none, otherwise of dimension (lda, n)
+    A       device pointer to first matrix A_1
+            A_i is m by m if side == rocblas_side_left
+            A_i is n by n if side == rocblas_side_right
+            only the upper/lower triangular part is accessed.
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A_i.
-            if trans = rocblas_operation_none,  lda >= max( 1, n ),
-            otherwise lda >= max( 1, k ).
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            otherwise lda >= max( 1, n ).
 
     @param[in]
     stride_A  [rocblas_stride]
               stride from the start of one matrix (A_i) and the next one (A_i+1)
 
     @param[in]
-    B       Device pointer to the first matrix B_1 on the GPU of dimension (ldb, k)
-            when trans is rocblas_operation_none, otherwise of dimension (ldb, n)
+    B       device pointer to first matrix B_1 of dimension (ldb, n) on the GPU.
 
     @param[in]
     ldb     [rocblas_int]
-            ldb specifies the first dimension of B_i.
-            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
-            otherwise ldb >= max( 1, k ).
+            ldb specifies the first dimension of B_i. ldb >= max( 1, m )
 
     @param[in]
     stride_B  [rocblas_stride]
               stride from the start of one matrix (B_i) and the next one (B_i+1)
-
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
             zero then C need not be set before entry.
 
     @param[in]
-    C       Device pointer to the first matrix C_1 on the GPU.
-            The imaginary component of the diagonal elements are not used but are set to zero unless quick return.
+    C        device pointer to first matrix C_1 of dimension (ldc, n) on the GPU.
 
     @param[in]
     ldc    [rocblas_int]
-           ldc specifies the first dimension of C. ldc >= max( 1, n ).
+           ldc specifies the first dimension of C. ldc >= max( 1, m ).
 
     @param[inout]
     stride_C  [rocblas_stride]
@@ -10649,124 +12545,115 @@ ROCBLAS_EXPORT rocblas_status rocblas_cherkx_strided_batched(rocblas_handle
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zherkx_strided_batched(rocblas_handle                handle,
-                                                             rocblas_fill                  uplo,
-                                                             rocblas_operation             trans,
-                                                             rocblas_int                   n,
-                                                             rocblas_int                   k,
-                                                             const rocblas_double_complex* alpha,
-                                                             const rocblas_double_complex* A,
-                                                             rocblas_int                   lda,
-                                                             rocblas_stride                stride_A,
-                                                             const rocblas_double_complex* B,
-                                                             rocblas_int                   ldb,
-                                                             rocblas_stride                stride_B,
-                                                             const double*                 beta,
-                                                             rocblas_double_complex*       C,
-                                                             rocblas_int                   ldc,
-                                                             rocblas_stride                stride_C,
-                                                             rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zsymm_strided_batched(rocblas_handle                handle,
+                                                            rocblas_side                  side,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_int                   m,
+                                                            rocblas_int                   n,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* A,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                stride_A,
+                                                            const rocblas_double_complex* B,
+                                                            rocblas_int                   ldb,
+                                                            rocblas_stride                stride_B,
+                                                            const rocblas_double_complex* beta,
+                                                            rocblas_double_complex*       C,
+                                                            rocblas_int                   ldc,
+                                                            rocblas_stride                stride_C,
+                                                            rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssymm(rocblas_handle handle,
-                                            rocblas_side   side,
-                                            rocblas_fill   uplo,
-                                            rocblas_int    m,
-                                            rocblas_int    n,
-                                            const float*   alpha,
-                                            const float*   A,
-                                            rocblas_int    lda,
-                                            const float*   B,
-                                            rocblas_int    ldb,
-                                            const float*   beta,
-                                            float*         C,
-                                            rocblas_int    ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrk(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            const float*      beta,
+                                            float*            C,
+                                            rocblas_int       ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsymm(rocblas_handle handle,
-                                            rocblas_side   side,
-                                            rocblas_fill   uplo,
-                                            rocblas_int    m,
-                                            rocblas_int    n,
-                                            const double*  alpha,
-                                            const double*  A,
-                                            rocblas_int    lda,
-                                            const double*  B,
-                                            rocblas_int    ldb,
-                                            const double*  beta,
-                                            double*        C,
-                                            rocblas_int    ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrk(rocblas_handle    handle,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            const double*     beta,
+                                            double*           C,
+                                            rocblas_int       ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csymm(rocblas_handle               handle,
-                                            rocblas_side                 side,
+ROCBLAS_EXPORT rocblas_status rocblas_csyrk(rocblas_handle               handle,
                                             rocblas_fill                 uplo,
-                                            rocblas_int                  m,
+                                            rocblas_operation            transA,
                                             rocblas_int                  n,
+                                            rocblas_int                  k,
                                             const rocblas_float_complex* alpha,
                                             const rocblas_float_complex* A,
                                             rocblas_int                  lda,
-                                            const rocblas_float_complex* B,
-                                            rocblas_int                  ldb,
                                             const rocblas_float_complex* beta,
                                             rocblas_float_complex*       C,
                                             rocblas_int                  ldc);
-
 /*! \brief BLAS Level 3 API
 
     \details
 
-    symm performs one of the matrix-matrix operations:
+    syrk performs one of the matrix-matrix operations for a symmetric rank-k update
 
-    C := alpha*A*B + beta*C if side == rocblas_side_left,
-    C := alpha*B*A + beta*C if side == rocblas_side_right,
+    C := alpha*op( A )*op( A )^T + beta*C
 
-    where alpha and beta are scalars, B and C are m by n matrices, and
-    A is a symmetric matrix stored as either upper or lower.
+    where  alpha and beta are scalars, op(A) is an n by k matrix, and
+    C is a symmetric n x n matrix stored as either upper or lower.
+
+        op( A ) = A, and A is n by k if transA == rocblas_operation_none
+        op( A ) = A^T and A is k by n if transA == rocblas_operation_transpose
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
-    @param[in]
-    side  [rocblas_side]
-            rocblas_side_left:      C := alpha*A*B + beta*C
-            rocblas_side_right:     C := alpha*B*A + beta*C
-
     @param[in]
     uplo    [rocblas_fill]
-            rocblas_fill_upper:  A is an upper triangular matrix
-            rocblas_fill_lower:  A is a  lower triangular matrix
+            rocblas_fill_upper:  C is an upper triangular matrix
+            rocblas_fill_lower:  C is a  lower triangular matrix
 
     @param[in]
-    m       [rocblas_int]
-            m specifies the number of rows of B and C. m >= 0.
+    transA  [rocblas_operation]
+            rocblas_operation_transpose:           op(A) = A^T
+            rocblas_operation_none:                op(A) = A
+            rocblas_operation_conjugate_transpose: op(A) = A^T
+
+            rocblas_operation_conjugate_transpose is not supported for complex types, see cherk
+            and zherk.
 
     @param[in]
     n       [rocblas_int]
-            n specifies the number of columns of B and C. n >= 0.
+            n specifies the number of rows and columns of C. n >= 0.
+
+    @param[in]
+    k       [rocblas_int]
+            k specifies the number of columns of op(A). k >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A and B are not referenced.
+            zero then A is not referenced and A need not be set before
+            entry.
 
     @param[in]
     A       pointer storing matrix A on the GPU.
-            A is m by m if side == rocblas_side_left
-            A is n by n if side == rocblas_side_right
+            Martrix dimension is ( lda, k ) when if transA = rocblas_operation_none, otherwise (lda, n)
             only the upper/lower triangular part is accessed.
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            otherwise lda >= max( 1, n ).
-
-    @param[in]
-    B       pointer storing matrix B on the GPU.
-            Matrix dimension is m by n
-
-    @param[in]
-    ldb     [rocblas_int]
-            ldb specifies the first dimension of B. ldb >= max( 1, m )
+            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            otherwise lda >= max( 1, k ).
 
     @param[in]
     beta
@@ -10775,67 +12662,59 @@ ROCBLAS_EXPORT rocblas_status rocblas_csymm(rocblas_handle               handle,
 
     @param[in]
     C       pointer storing matrix C on the GPU.
-            Matrix dimension is m by n
 
     @param[in]
     ldc    [rocblas_int]
-           ldc specifies the first dimension of C. ldc >= max( 1, m )
+           ldc specifies the first dimension of C. ldc >= max( 1, n ).
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsymm(rocblas_handle                handle,
-                                            rocblas_side                  side,
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrk(rocblas_handle                handle,
                                             rocblas_fill                  uplo,
-                                            rocblas_int                   m,
+                                            rocblas_operation             transA,
                                             rocblas_int                   n,
+                                            rocblas_int                   k,
                                             const rocblas_double_complex* alpha,
                                             const rocblas_double_complex* A,
                                             rocblas_int                   lda,
-                                            const rocblas_double_complex* B,
-                                            rocblas_int                   ldb,
                                             const rocblas_double_complex* beta,
                                             rocblas_double_complex*       C,
                                             rocblas_int                   ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssymm_batched(rocblas_handle     handle,
-                                                    rocblas_side       side,
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrk_batched(rocblas_handle     handle,
                                                     rocblas_fill       uplo,
-                                                    rocblas_int        m,
+                                                    rocblas_operation  transA,
                                                     rocblas_int        n,
+                                                    rocblas_int        k,
                                                     const float*       alpha,
                                                     const float* const A[],
                                                     rocblas_int        lda,
-                                                    const float* const B[],
-                                                    rocblas_int        ldb,
                                                     const float*       beta,
                                                     float* const       C[],
                                                     rocblas_int        ldc,
                                                     rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsymm_batched(rocblas_handle      handle,
-                                                    rocblas_side        side,
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrk_batched(rocblas_handle      handle,
                                                     rocblas_fill        uplo,
-                                                    rocblas_int         m,
+                                                    rocblas_operation   transA,
                                                     rocblas_int         n,
+                                                    rocblas_int         k,
                                                     const double*       alpha,
                                                     const double* const A[],
                                                     rocblas_int         lda,
-                                                    const double* const B[],
-                                                    rocblas_int         ldb,
                                                     const double*       beta,
                                                     double* const       C[],
                                                     rocblas_int         ldc,
                                                     rocblas_int         batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csymm_batched(rocblas_handle                     handle,
-                                                    rocblas_side                       side,
+ROCBLAS_EXPORT rocblas_status rocblas_csyrk_batched(rocblas_handle                     handle,
                                                     rocblas_fill                       uplo,
-                                                    rocblas_int                        m,
+                                                    rocblas_operation                  transA,
                                                     rocblas_int                        n,
+                                                    rocblas_int                        k,
                                                     const rocblas_float_complex*       alpha,
                                                     const rocblas_float_complex* const A[],
                                                     rocblas_int                        lda,
-                                                    const rocblas_float_complex* const B[],
-                                                    rocblas_int                        ldb,
                                                     const rocblas_float_complex*       beta,
                                                     rocblas_float_complex* const       C[],
                                                     rocblas_int                        ldc,
@@ -10845,142 +12724,126 @@ ROCBLAS_EXPORT rocblas_status rocblas_csymm_batched(rocblas_handle
 
     \details
 
-    symm_batched performs a batch of the matrix-matrix operations:
+    syrk_batched performs a batch of the matrix-matrix operations for a symmetric rank-k update
 
-    C_i := alpha*A_i*B_i + beta*C_i if side == rocblas_side_left,
-    C_i := alpha*B_i*A_i + beta*C_i if side == rocblas_side_right,
+    C_i := alpha*op( A_i )*op( A_i )^T + beta*C_i
 
-    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
-    A_i is a symmetric matrix stored as either upper or lower.
+    where  alpha and beta are scalars, op(A_i) is an n by k matrix, and
+    C_i is a symmetric n x n matrix stored as either upper or lower.
+
+        op( A_i ) = A_i, and A_i is n by k if transA == rocblas_operation_none
+        op( A_i ) = A_i^T and A_i is k by n if transA == rocblas_operation_transpose
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
-    @param[in]
-    side  [rocblas_side]
-            rocblas_side_left:      C_i := alpha*A_i*B_i + beta*C_i
-            rocblas_side_right:     C_i := alpha*B_i*A_i + beta*C_i
-
     @param[in]
     uplo    [rocblas_fill]
-            rocblas_fill_upper:  A_i is an upper triangular matrix
-            rocblas_fill_lower:  A_i is a  lower triangular matrix
+            rocblas_fill_upper:  C_i is an upper triangular matrix
+            rocblas_fill_lower:  C_i is a  lower triangular matrix
 
     @param[in]
-    m       [rocblas_int]
-            m specifies the number of rows of B_i and C_i. m >= 0.
+    transA  [rocblas_operation]
+            rocblas_operation_transpose:           op(A) = A^T
+            rocblas_operation_none:                op(A) = A
+            rocblas_operation_conjugate_transpose: op(A) = A^T
+
+            rocblas_operation_conjugate_transpose is not supported for complex types, see cherk
+            and zherk.
 
     @param[in]
     n       [rocblas_int]
-            n specifies the number of columns of B_i and C_i. n >= 0.
+            n specifies the number of rows and columns of C_i. n >= 0.
+
+    @param[in]
+    k       [rocblas_int]
+            k specifies the number of columns of op(A). k >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A_i and B_i are not referenced.
+            zero then A is not referenced and A need not be set before
+            entry.
 
     @param[in]
-    A       device array of device pointers storing each matrix A_i on the GPU.
-            A_i is m by m if side == rocblas_side_left
-            A_i is n by n if side == rocblas_side_right
-            only the upper/lower triangular part is accessed.
+    A       device array of device pointers storing each matrix_i A of dimension (lda, k)
+            when transA is rocblas_operation_none, otherwise of dimension (lda, n)
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A_i.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            otherwise lda >= max( 1, n ).
-
-    @param[in]
-    B       device array of device pointers storing each matrix B_i on the GPU.
-            Matrix dimension is m by n
-
-    @param[in]
-    ldb     [rocblas_int]
-            ldb specifies the first dimension of B_i. ldb >= max( 1, m )
+            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            otherwise lda >= max( 1, k ).
 
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
-            zero then C_i need not be set before entry.
+            zero then C need not be set before entry.
 
     @param[in]
     C       device array of device pointers storing each matrix C_i on the GPU.
-            Matrix dimension is m by n
 
     @param[in]
     ldc    [rocblas_int]
-           ldc specifies the first dimension of C_i. ldc >= max( 1, m )
-
+           ldc specifies the first dimension of C. ldc >= max( 1, n ).
     @param[in]
     batch_count [rocblas_int]
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsymm_batched(rocblas_handle                      handle,
-                                                    rocblas_side                        side,
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrk_batched(rocblas_handle                      handle,
                                                     rocblas_fill                        uplo,
-                                                    rocblas_int                         m,
+                                                    rocblas_operation                   transA,
                                                     rocblas_int                         n,
+                                                    rocblas_int                         k,
                                                     const rocblas_double_complex*       alpha,
                                                     const rocblas_double_complex* const A[],
                                                     rocblas_int                         lda,
-                                                    const rocblas_double_complex* const B[],
-                                                    rocblas_int                         ldb,
                                                     const rocblas_double_complex*       beta,
                                                     rocblas_double_complex* const       C[],
                                                     rocblas_int                         ldc,
                                                     rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssymm_strided_batched(rocblas_handle handle,
-                                                            rocblas_side   side,
-                                                            rocblas_fill   uplo,
-                                                            rocblas_int    m,
-                                                            rocblas_int    n,
-                                                            const float*   alpha,
-                                                            const float*   A,
-                                                            rocblas_int    lda,
-                                                            rocblas_stride stride_A,
-                                                            const float*   B,
-                                                            rocblas_int    ldb,
-                                                            rocblas_stride stride_B,
-                                                            const float*   beta,
-                                                            float*         C,
-                                                            rocblas_int    ldc,
-                                                            rocblas_stride stride_C,
-                                                            rocblas_int    batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrk_strided_batched(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const float*      alpha,
+                                                            const float*      A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_A,
+                                                            const float*      beta,
+                                                            float*            C,
+                                                            rocblas_int       ldc,
+                                                            rocblas_stride    stride_C,
+                                                            rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsymm_strided_batched(rocblas_handle handle,
-                                                            rocblas_side   side,
-                                                            rocblas_fill   uplo,
-                                                            rocblas_int    m,
-                                                            rocblas_int    n,
-                                                            const double*  alpha,
-                                                            const double*  A,
-                                                            rocblas_int    lda,
-                                                            rocblas_stride stride_A,
-                                                            const double*  B,
-                                                            rocblas_int    ldb,
-                                                            rocblas_stride stride_B,
-                                                            const double*  beta,
-                                                            double*        C,
-                                                            rocblas_int    ldc,
-                                                            rocblas_stride stride_C,
-                                                            rocblas_int    batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrk_strided_batched(rocblas_handle    handle,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transA,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const double*     alpha,
+                                                            const double*     A,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_A,
+                                                            const double*     beta,
+                                                            double*           C,
+                                                            rocblas_int       ldc,
+                                                            rocblas_stride    stride_C,
+                                                            rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csymm_strided_batched(rocblas_handle               handle,
-                                                            rocblas_side                 side,
+ROCBLAS_EXPORT rocblas_status rocblas_csyrk_strided_batched(rocblas_handle               handle,
                                                             rocblas_fill                 uplo,
-                                                            rocblas_int                  m,
+                                                            rocblas_operation            transA,
                                                             rocblas_int                  n,
+                                                            rocblas_int                  k,
                                                             const rocblas_float_complex* alpha,
                                                             const rocblas_float_complex* A,
                                                             rocblas_int                  lda,
                                                             rocblas_stride               stride_A,
-                                                            const rocblas_float_complex* B,
-                                                            rocblas_int                  ldb,
-                                                            rocblas_stride               stride_B,
                                                             const rocblas_float_complex* beta,
                                                             rocblas_float_complex*       C,
                                                             rocblas_int                  ldc,
@@ -10991,78 +12854,73 @@ ROCBLAS_EXPORT rocblas_status rocblas_csymm_strided_batched(rocblas_handle
 
     \details
 
-    symm_strided_batched performs a batch of the matrix-matrix operations:
+    syrk_strided_batched performs a batch of the matrix-matrix operations for a symmetric rank-k update
 
-    C_i := alpha*A_i*B_i + beta*C_i if side == rocblas_side_left,
-    C_i := alpha*B_i*A_i + beta*C_i if side == rocblas_side_right,
+    C_i := alpha*op( A_i )*op( A_i )^T + beta*C_i
 
-    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
-    A_i is a symmetric matrix stored as either upper or lower.
+    where  alpha and beta are scalars, op(A_i) is an n by k matrix, and
+    C_i is a symmetric n x n matrix stored as either upper or lower.
+
+        op( A_i ) = A_i, and A_i is n by k if transA == rocblas_operation_none
+        op( A_i ) = A_i^T and A_i is k by n if transA == rocblas_operation_transpose
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
-    @param[in]
-    side  [rocblas_side]
-            rocblas_side_left:      C_i := alpha*A_i*B_i + beta*C_i
-            rocblas_side_right:     C_i := alpha*B_i*A_i + beta*C_i
-
     @param[in]
     uplo    [rocblas_fill]
-            rocblas_fill_upper:  A_i is an upper triangular matrix
-            rocblas_fill_lower:  A_i is a  lower triangular matrix
+            rocblas_fill_upper:  C_i is an upper triangular matrix
+            rocblas_fill_lower:  C_i is a  lower triangular matrix
 
     @param[in]
-    m       [rocblas_int]
-            m specifies the number of rows of B_i and C_i. m >= 0.
+    transA  [rocblas_operation]
+            rocblas_operation_transpose:           op(A) = A^T
+            rocblas_operation_none:                op(A) = A
+            rocblas_operation_conjugate_transpose: op(A) = A^T
+
+            rocblas_operation_conjugate_transpose is not supported for complex types, see cherk
+            and zherk.
 
     @param[in]
     n       [rocblas_int]
-            n specifies the number of columns of B_i and C_i. n >= 0.
+            n specifies the number of rows and columns of C_i. n >= 0.
+
+    @param[in]
+    k       [rocblas_int]
+            k specifies the number of columns of op(A). k >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A_i and B_i are not referenced.
+            zero then A is not referenced and A need not be set before
+            entry.
 
     @param[in]
-    A       device pointer to first matrix A_1
-            A_i is m by m if side == rocblas_side_left
-            A_i is n by n if side == rocblas_side_right
-            only the upper/lower triangular part is accessed.
+    A       Device pointer to the first matrix A_1 on the GPU of dimension (lda, k)
+            when transA is rocblas_operation_none, otherwise of dimension (lda, n)
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A_i.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            otherwise lda >= max( 1, n ).
+            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            otherwise lda >= max( 1, k ).
 
     @param[in]
     stride_A  [rocblas_stride]
               stride from the start of one matrix (A_i) and the next one (A_i+1)
 
     @param[in]
-    B       device pointer to first matrix B_1 of dimension (ldb, n) on the GPU.
-
-    @param[in]
-    ldb     [rocblas_int]
-            ldb specifies the first dimension of B_i. ldb >= max( 1, m )
-
-    @param[in]
-    stride_B  [rocblas_stride]
-              stride from the start of one matrix (B_i) and the next one (B_i+1)
-    @param[in]
     beta
             beta specifies the scalar beta. When beta is
             zero then C need not be set before entry.
 
     @param[in]
-    C        device pointer to first matrix C_1 of dimension (ldc, n) on the GPU.
+    C       Device pointer to the first matrix C_1 on the GPU. on the GPU.
 
     @param[in]
     ldc    [rocblas_int]
-           ldc specifies the first dimension of C. ldc >= max( 1, m ).
+           ldc specifies the first dimension of C. ldc >= max( 1, n ).
 
     @param[inout]
     stride_C  [rocblas_stride]
@@ -11073,72 +12931,76 @@ ROCBLAS_EXPORT rocblas_status rocblas_csymm_strided_batched(rocblas_handle
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsymm_strided_batched(rocblas_handle                handle,
-                                                            rocblas_side                  side,
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrk_strided_batched(rocblas_handle                handle,
                                                             rocblas_fill                  uplo,
-                                                            rocblas_int                   m,
+                                                            rocblas_operation             transA,
                                                             rocblas_int                   n,
+                                                            rocblas_int                   k,
                                                             const rocblas_double_complex* alpha,
                                                             const rocblas_double_complex* A,
                                                             rocblas_int                   lda,
                                                             rocblas_stride                stride_A,
-                                                            const rocblas_double_complex* B,
-                                                            rocblas_int                   ldb,
-                                                            rocblas_stride                stride_B,
                                                             const rocblas_double_complex* beta,
                                                             rocblas_double_complex*       C,
                                                             rocblas_int                   ldc,
                                                             rocblas_stride                stride_C,
                                                             rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyrk(rocblas_handle    handle,
-                                            rocblas_fill      uplo,
-                                            rocblas_operation transA,
-                                            rocblas_int       n,
-                                            rocblas_int       k,
-                                            const float*      alpha,
-                                            const float*      A,
-                                            rocblas_int       lda,
-                                            const float*      beta,
-                                            float*            C,
-                                            rocblas_int       ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k(rocblas_handle    handle,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation trans,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const float*      alpha,
+                                             const float*      A,
+                                             rocblas_int       lda,
+                                             const float*      B,
+                                             rocblas_int       ldb,
+                                             const float*      beta,
+                                             float*            C,
+                                             rocblas_int       ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyrk(rocblas_handle    handle,
-                                            rocblas_fill      uplo,
-                                            rocblas_operation transA,
-                                            rocblas_int       n,
-                                            rocblas_int       k,
-                                            const double*     alpha,
-                                            const double*     A,
-                                            rocblas_int       lda,
-                                            const double*     beta,
-                                            double*           C,
-                                            rocblas_int       ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k(rocblas_handle    handle,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation trans,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const double*     alpha,
+                                             const double*     A,
+                                             rocblas_int       lda,
+                                             const double*     B,
+                                             rocblas_int       ldb,
+                                             const double*     beta,
+                                             double*           C,
+                                             rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr2k(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             rocblas_operation            trans,
+                                             rocblas_int                  n,
+                                             rocblas_int                  k,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* A,
+                                             rocblas_int                  lda,
+                                             const rocblas_float_complex* B,
+                                             rocblas_int                  ldb,
+                                             const rocblas_float_complex* beta,
+                                             rocblas_float_complex*       C,
+                                             rocblas_int                  ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyrk(rocblas_handle               handle,
-                                            rocblas_fill                 uplo,
-                                            rocblas_operation            transA,
-                                            rocblas_int                  n,
-                                            rocblas_int                  k,
-                                            const rocblas_float_complex* alpha,
-                                            const rocblas_float_complex* A,
-                                            rocblas_int                  lda,
-                                            const rocblas_float_complex* beta,
-                                            rocblas_float_complex*       C,
-                                            rocblas_int                  ldc);
 /*! \brief BLAS Level 3 API
 
     \details
 
-    syrk performs one of the matrix-matrix operations for a symmetric rank-k update
+    syr2k performs one of the matrix-matrix operations for a symmetric rank-2k update
 
-    C := alpha*op( A )*op( A )^T + beta*C
+    C := alpha*(op( A )*op( B )^T + op( B )*op( A )^T) + beta*C
 
-    where  alpha and beta are scalars, op(A) is an n by k matrix, and
+    where  alpha and beta are scalars, op(A) and op(B) are n by k matrix, and
     C is a symmetric n x n matrix stored as either upper or lower.
 
-        op( A ) = A, and A is n by k if transA == rocblas_operation_none
-        op( A ) = A^T and A is k by n if transA == rocblas_operation_transpose
+        op( A ) = A, op( B ) = B, and A and B are n by k if trans == rocblas_operation_none
+        op( A ) = A^T, op( B ) = B^T,  and A and B are k by n if trans == rocblas_operation_transpose
 
     @param[in]
     handle    [rocblas_handle]
@@ -11150,13 +13012,9 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyrk(rocblas_handle               handle,
             rocblas_fill_lower:  C is a  lower triangular matrix
 
     @param[in]
-    transA  [rocblas_operation]
-            rocblas_operation_transpose:           op(A) = A^T
-            rocblas_operation_none:                op(A) = A
-            rocblas_operation_conjugate_transpose: op(A) = A^T
-
-            rocblas_operation_conjugate_transpose is not supported for complex types, see cherk
-            and zherk.
+    trans  [rocblas_operation]
+            rocblas_operation_transpose:      op( A ) = A^T, op( B ) = B^T
+            rocblas_operation_none:           op( A ) = A, op( B ) = B
 
     @param[in]
     n       [rocblas_int]
@@ -11164,7 +13022,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyrk(rocblas_handle               handle,
 
     @param[in]
     k       [rocblas_int]
-            k specifies the number of columns of op(A). k >= 0.
+            k specifies the number of columns of op(A) and op(B). k >= 0.
 
     @param[in]
     alpha
@@ -11174,16 +13032,25 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyrk(rocblas_handle               handle,
 
     @param[in]
     A       pointer storing matrix A on the GPU.
-            Martrix dimension is ( lda, k ) when if transA = rocblas_operation_none, otherwise (lda, n)
+            Martrix dimension is ( lda, k ) when if trans = rocblas_operation_none, otherwise (lda, n)
             only the upper/lower triangular part is accessed.
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A.
-            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            if trans = rocblas_operation_none,  lda >= max( 1, n ),
             otherwise lda >= max( 1, k ).
+    @param[in]
+    B       pointer storing matrix B on the GPU.
+            Martrix dimension is ( ldb, k ) when if trans = rocblas_operation_none, otherwise (ldb, n)
+            only the upper/lower triangular part is accessed.
 
     @param[in]
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B.
+            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
+            otherwise ldb >= max( 1, k ).
+    @param[in]
     beta
             beta specifies the scalar beta. When beta is
             zero then C need not be set before entry.
@@ -11196,71 +13063,78 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyrk(rocblas_handle               handle,
            ldc specifies the first dimension of C. ldc >= max( 1, n ).
 
     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k(rocblas_handle                handle,
+                                             rocblas_fill                  uplo,
+                                             rocblas_operation             trans,
+                                             rocblas_int                   n,
+                                             rocblas_int                   k,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* A,
+                                             rocblas_int                   lda,
+                                             const rocblas_double_complex* B,
+                                             rocblas_int                   ldb,
+                                             const rocblas_double_complex* beta,
+                                             rocblas_double_complex*       C,
+                                             rocblas_int                   ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_zsyrk(rocblas_handle                handle,
-                                            rocblas_fill                  uplo,
-                                            rocblas_operation             transA,
-                                            rocblas_int                   n,
-                                            rocblas_int                   k,
-                                            const rocblas_double_complex* alpha,
-                                            const rocblas_double_complex* A,
-                                            rocblas_int                   lda,
-                                            const rocblas_double_complex* beta,
-                                            rocblas_double_complex*       C,
-                                            rocblas_int                   ldc);
-
-ROCBLAS_EXPORT rocblas_status rocblas_ssyrk_batched(rocblas_handle     handle,
-                                                    rocblas_fill       uplo,
-                                                    rocblas_operation  transA,
-                                                    rocblas_int        n,
-                                                    rocblas_int        k,
-                                                    const float*       alpha,
-                                                    const float* const A[],
-                                                    rocblas_int        lda,
-                                                    const float*       beta,
-                                                    float* const       C[],
-                                                    rocblas_int        ldc,
-                                                    rocblas_int        batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dsyrk_batched(rocblas_handle      handle,
-                                                    rocblas_fill        uplo,
-                                                    rocblas_operation   transA,
-                                                    rocblas_int         n,
-                                                    rocblas_int         k,
-                                                    const double*       alpha,
-                                                    const double* const A[],
-                                                    rocblas_int         lda,
-                                                    const double*       beta,
-                                                    double* const       C[],
-                                                    rocblas_int         ldc,
-                                                    rocblas_int         batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k_batched(rocblas_handle     handle,
+                                                     rocblas_fill       uplo,
+                                                     rocblas_operation  trans,
+                                                     rocblas_int        n,
+                                                     rocblas_int        k,
+                                                     const float*       alpha,
+                                                     const float* const A[],
+                                                     rocblas_int        lda,
+                                                     const float* const B[],
+                                                     rocblas_int        ldb,
+                                                     const float*       beta,
+                                                     float* const       C[],
+                                                     rocblas_int        ldc,
+                                                     rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyrk_batched(rocblas_handle                     handle,
-                                                    rocblas_fill                       uplo,
-                                                    rocblas_operation                  transA,
-                                                    rocblas_int                        n,
-                                                    rocblas_int                        k,
-                                                    const rocblas_float_complex*       alpha,
-                                                    const rocblas_float_complex* const A[],
-                                                    rocblas_int                        lda,
-                                                    const rocblas_float_complex*       beta,
-                                                    rocblas_float_complex* const       C[],
-                                                    rocblas_int                        ldc,
-                                                    rocblas_int                        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k_batched(rocblas_handle      handle,
+                                                     rocblas_fill        uplo,
+                                                     rocblas_operation   trans,
+                                                     rocblas_int         n,
+                                                     rocblas_int         k,
+                                                     const double*       alpha,
+                                                     const double* const A[],
+                                                     rocblas_int         lda,
+                                                     const double* const B[],
+                                                     rocblas_int         ldb,
+                                                     const double*       beta,
+                                                     double* const       C[],
+                                                     rocblas_int         ldc,
+                                                     rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_batched(rocblas_handle                     handle,
+                                                     rocblas_fill                       uplo,
+                                                     rocblas_operation                  trans,
+                                                     rocblas_int                        n,
+                                                     rocblas_int                        k,
+                                                     const rocblas_float_complex*       alpha,
+                                                     const rocblas_float_complex* const A[],
+                                                     rocblas_int                        lda,
+                                                     const rocblas_float_complex* const B[],
+                                                     rocblas_int                        ldb,
+                                                     const rocblas_float_complex*       beta,
+                                                     rocblas_float_complex* const       C[],
+                                                     rocblas_int                        ldc,
+                                                     rocblas_int batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    syrk_batched performs a batch of the matrix-matrix operations for a symmetric rank-k update
+    syr2k_batched performs a batch of the matrix-matrix operations for a symmetric rank-2k update
 
-    C_i := alpha*op( A_i )*op( A_i )^T + beta*C_i
+    C_i := alpha*(op( A_i )*op( B_i )^T + op( B_i )*op( A_i )^T) + beta*C_i
 
-    where  alpha and beta are scalars, op(A_i) is an n by k matrix, and
+    where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrix, and
     C_i is a symmetric n x n matrix stored as either upper or lower.
 
-        op( A_i ) = A_i, and A_i is n by k if transA == rocblas_operation_none
-        op( A_i ) = A_i^T and A_i is k by n if transA == rocblas_operation_transpose
+        op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
+        op( A_i ) = A_i^T, op( B_i ) = B_i^T,  and A_i and B_i are k by n if trans == rocblas_operation_transpose
 
     @param[in]
     handle    [rocblas_handle]
@@ -11272,13 +13146,9 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyrk_batched(rocblas_handle
             rocblas_fill_lower:  C_i is a  lower triangular matrix
 
     @param[in]
-    transA  [rocblas_operation]
-            rocblas_operation_transpose:           op(A) = A^T
-            rocblas_operation_none:                op(A) = A
-            rocblas_operation_conjugate_transpose: op(A) = A^T
-
-            rocblas_operation_conjugate_transpose is not supported for complex types, see cherk
-            and zherk.
+    trans  [rocblas_operation]
+            rocblas_operation_transpose:      op( A_i ) = A_i^T, op( B_i ) = B_i^T
+            rocblas_operation_none:           op( A_i ) = A_i, op( B_i ) = B_i
 
     @param[in]
     n       [rocblas_int]
@@ -11296,14 +13166,21 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyrk_batched(rocblas_handle
 
     @param[in]
     A       device array of device pointers storing each matrix_i A of dimension (lda, k)
-            when transA is rocblas_operation_none, otherwise of dimension (lda, n)
+            when trans is rocblas_operation_none, otherwise of dimension (lda, n)
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A_i.
-            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            if trans = rocblas_operation_none,  lda >= max( 1, n ),
             otherwise lda >= max( 1, k ).
-
+    @param[in]
+    B       device array of device pointers storing each matrix_i B of dimension (ldb, k)
+            when trans is rocblas_operation_none, otherwise of dimension (ldb, n)
+    @param[in]
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B.
+            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
+            otherwise ldb >= max( 1, k ).
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
@@ -11320,77 +13197,88 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyrk_batched(rocblas_handle
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsyrk_batched(rocblas_handle                      handle,
-                                                    rocblas_fill                        uplo,
-                                                    rocblas_operation                   transA,
-                                                    rocblas_int                         n,
-                                                    rocblas_int                         k,
-                                                    const rocblas_double_complex*       alpha,
-                                                    const rocblas_double_complex* const A[],
-                                                    rocblas_int                         lda,
-                                                    const rocblas_double_complex*       beta,
-                                                    rocblas_double_complex* const       C[],
-                                                    rocblas_int                         ldc,
-                                                    rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k_batched(rocblas_handle                      handle,
+                                                     rocblas_fill                        uplo,
+                                                     rocblas_operation                   trans,
+                                                     rocblas_int                         n,
+                                                     rocblas_int                         k,
+                                                     const rocblas_double_complex*       alpha,
+                                                     const rocblas_double_complex* const A[],
+                                                     rocblas_int                         lda,
+                                                     const rocblas_double_complex* const B[],
+                                                     rocblas_int                         ldb,
+                                                     const rocblas_double_complex*       beta,
+                                                     rocblas_double_complex* const       C[],
+                                                     rocblas_int                         ldc,
+                                                     rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyrk_strided_batched(rocblas_handle    handle,
-                                                            rocblas_fill      uplo,
-                                                            rocblas_operation transA,
-                                                            rocblas_int       n,
-                                                            rocblas_int       k,
-                                                            const float*      alpha,
-                                                            const float*      A,
-                                                            rocblas_int       lda,
-                                                            rocblas_stride    stride_A,
-                                                            const float*      beta,
-                                                            float*            C,
-                                                            rocblas_int       ldc,
-                                                            rocblas_stride    stride_C,
-                                                            rocblas_int       batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k_strided_batched(rocblas_handle    handle,
+                                                             rocblas_fill      uplo,
+                                                             rocblas_operation trans,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             const float*      alpha,
+                                                             const float*      A,
+                                                             rocblas_int       lda,
+                                                             rocblas_stride    stride_A,
+                                                             const float*      B,
+                                                             rocblas_int       ldb,
+                                                             rocblas_stride    stride_B,
+                                                             const float*      beta,
+                                                             float*            C,
+                                                             rocblas_int       ldc,
+                                                             rocblas_stride    stride_C,
+                                                             rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyrk_strided_batched(rocblas_handle    handle,
-                                                            rocblas_fill      uplo,
-                                                            rocblas_operation transA,
-                                                            rocblas_int       n,
-                                                            rocblas_int       k,
-                                                            const double*     alpha,
-                                                            const double*     A,
-                                                            rocblas_int       lda,
-                                                            rocblas_stride    stride_A,
-                                                            const double*     beta,
-                                                            double*           C,
-                                                            rocblas_int       ldc,
-                                                            rocblas_stride    stride_C,
-                                                            rocblas_int       batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k_strided_batched(rocblas_handle    handle,
+                                                             rocblas_fill      uplo,
+                                                             rocblas_operation trans,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             const double*     alpha,
+                                                             const double*     A,
+                                                             rocblas_int       lda,
+                                                             rocblas_stride    stride_A,
+                                                             const double*     B,
+                                                             rocblas_int       ldb,
+                                                             rocblas_stride    stride_B,
+                                                             const double*     beta,
+                                                             double*           C,
+                                                             rocblas_int       ldc,
+                                                             rocblas_stride    stride_C,
+                                                             rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyrk_strided_batched(rocblas_handle               handle,
-                                                            rocblas_fill                 uplo,
-                                                            rocblas_operation            transA,
-                                                            rocblas_int                  n,
-                                                            rocblas_int                  k,
-                                                            const rocblas_float_complex* alpha,
-                                                            const rocblas_float_complex* A,
-                                                            rocblas_int                  lda,
-                                                            rocblas_stride               stride_A,
-                                                            const rocblas_float_complex* beta,
-                                                            rocblas_float_complex*       C,
-                                                            rocblas_int                  ldc,
-                                                            rocblas_stride               stride_C,
-                                                            rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_strided_batched(rocblas_handle               handle,
+                                                             rocblas_fill                 uplo,
+                                                             rocblas_operation            trans,
+                                                             rocblas_int                  n,
+                                                             rocblas_int                  k,
+                                                             const rocblas_float_complex* alpha,
+                                                             const rocblas_float_complex* A,
+                                                             rocblas_int                  lda,
+                                                             rocblas_stride               stride_A,
+                                                             const rocblas_float_complex* B,
+                                                             rocblas_int                  ldb,
+                                                             rocblas_stride               stride_B,
+                                                             const rocblas_float_complex* beta,
+                                                             rocblas_float_complex*       C,
+                                                             rocblas_int                  ldc,
+                                                             rocblas_stride               stride_C,
+                                                             rocblas_int batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    syrk_strided_batched performs a batch of the matrix-matrix operations for a symmetric rank-k update
+    syr2k_strided_batched performs a batch of the matrix-matrix operations for a symmetric rank-2k update
 
-    C_i := alpha*op( A_i )*op( A_i )^T + beta*C_i
+    C_i := alpha*(op( A_i )*op( B_i )^T + op( B_i )*op( A_i )^T) + beta*C_i
 
-    where  alpha and beta are scalars, op(A_i) is an n by k matrix, and
+    where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrix, and
     C_i is a symmetric n x n matrix stored as either upper or lower.
 
-        op( A_i ) = A_i, and A_i is n by k if transA == rocblas_operation_none
-        op( A_i ) = A_i^T and A_i is k by n if transA == rocblas_operation_transpose
+        op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
+        op( A_i ) = A_i^T, op( B_i ) = B_i^T,  and A_i and B_i are k by n if trans == rocblas_operation_transpose
 
     @param[in]
     handle    [rocblas_handle]
@@ -11402,13 +13290,9 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyrk_strided_batched(rocblas_handle
             rocblas_fill_lower:  C_i is a  lower triangular matrix
 
     @param[in]
-    transA  [rocblas_operation]
-            rocblas_operation_transpose:           op(A) = A^T
-            rocblas_operation_none:                op(A) = A
-            rocblas_operation_conjugate_transpose: op(A) = A^T
-
-            rocblas_operation_conjugate_transpose is not supported for complex types, see cherk
-            and zherk.
+    trans  [rocblas_operation]
+            rocblas_operation_transpose:      op( A_i ) = A_i^T, op( B_i ) = B_i^T
+            rocblas_operation_none:           op( A_i ) = A_i, op( B_i ) = B_i
 
     @param[in]
     n       [rocblas_int]
@@ -11426,25 +13310,39 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyrk_strided_batched(rocblas_handle
 
     @param[in]
     A       Device pointer to the first matrix A_1 on the GPU of dimension (lda, k)
-            when transA is rocblas_operation_none, otherwise of dimension (lda, n)
+            when trans is rocblas_operation_none, otherwise of dimension (lda, n)
 
     @param[in]
     lda     [rocblas_int]
             lda specifies the first dimension of A_i.
-            if transA = rocblas_operation_none,  lda >= max( 1, n ),
+            if trans = rocblas_operation_none,  lda >= max( 1, n ),
             otherwise lda >= max( 1, k ).
 
     @param[in]
     stride_A  [rocblas_stride]
               stride from the start of one matrix (A_i) and the next one (A_i+1)
 
+    @param[in]
+    B       Device pointer to the first matrix B_1 on the GPU of dimension (ldb, k)
+            when trans is rocblas_operation_none, otherwise of dimension (ldb, n)
+
+    @param[in]
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B_i.
+            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
+            otherwise ldb >= max( 1, k ).
+
+    @param[in]
+    stride_B  [rocblas_stride]
+              stride from the start of one matrix (B_i) and the next one (B_i+1)
+
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
             zero then C need not be set before entry.
 
     @param[in]
-    C       Device pointer to the first matrix C_1 on the GPU. on the GPU.
+    C       Device pointer to the first matrix C_1 on the GPU.
 
     @param[in]
     ldc    [rocblas_int]
@@ -11459,22 +13357,25 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyrk_strided_batched(rocblas_handle
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsyrk_strided_batched(rocblas_handle                handle,
-                                                            rocblas_fill                  uplo,
-                                                            rocblas_operation             transA,
-                                                            rocblas_int                   n,
-                                                            rocblas_int                   k,
-                                                            const rocblas_double_complex* alpha,
-                                                            const rocblas_double_complex* A,
-                                                            rocblas_int                   lda,
-                                                            rocblas_stride                stride_A,
-                                                            const rocblas_double_complex* beta,
-                                                            rocblas_double_complex*       C,
-                                                            rocblas_int                   ldc,
-                                                            rocblas_stride                stride_C,
-                                                            rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k_strided_batched(rocblas_handle                handle,
+                                                             rocblas_fill                  uplo,
+                                                             rocblas_operation             trans,
+                                                             rocblas_int                   n,
+                                                             rocblas_int                   k,
+                                                             const rocblas_double_complex* alpha,
+                                                             const rocblas_double_complex* A,
+                                                             rocblas_int                   lda,
+                                                             rocblas_stride                stride_A,
+                                                             const rocblas_double_complex* B,
+                                                             rocblas_int                   ldb,
+                                                             rocblas_stride                stride_B,
+                                                             const rocblas_double_complex* beta,
+                                                             rocblas_double_complex*       C,
+                                                             rocblas_int                   ldc,
+                                                             rocblas_stride                stride_C,
+                                                             rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k(rocblas_handle    handle,
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrkx(rocblas_handle    handle,
                                              rocblas_fill      uplo,
                                              rocblas_operation trans,
                                              rocblas_int       n,
@@ -11488,7 +13389,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k(rocblas_handle    handle,
                                              float*            C,
                                              rocblas_int       ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k(rocblas_handle    handle,
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrkx(rocblas_handle    handle,
                                              rocblas_fill      uplo,
                                              rocblas_operation trans,
                                              rocblas_int       n,
@@ -11502,7 +13403,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k(rocblas_handle    handle,
                                              double*           C,
                                              rocblas_int       ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyr2k(rocblas_handle               handle,
+ROCBLAS_EXPORT rocblas_status rocblas_csyrkx(rocblas_handle               handle,
                                              rocblas_fill                 uplo,
                                              rocblas_operation            trans,
                                              rocblas_int                  n,
@@ -11520,12 +13421,13 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr2k(rocblas_handle               handle
 
     \details
 
-    syr2k performs one of the matrix-matrix operations for a symmetric rank-2k update
+    syrkx performs one of the matrix-matrix operations for a symmetric rank-k update
 
-    C := alpha*(op( A )*op( B )^T + op( B )*op( A )^T) + beta*C
+    C := alpha*op( A )*op( B )^T + beta*C
 
     where  alpha and beta are scalars, op(A) and op(B) are n by k matrix, and
     C is a symmetric n x n matrix stored as either upper or lower.
+    This routine should only be used when the caller can guarantee that the result of op( A )*op( B )^T will be symmetric.
 
         op( A ) = A, op( B ) = B, and A and B are n by k if trans == rocblas_operation_none
         op( A ) = A^T, op( B ) = B^T,  and A and B are k by n if trans == rocblas_operation_transpose
@@ -11568,6 +13470,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr2k(rocblas_handle               handle
             lda specifies the first dimension of A.
             if trans = rocblas_operation_none,  lda >= max( 1, n ),
             otherwise lda >= max( 1, k ).
+
     @param[in]
     B       pointer storing matrix B on the GPU.
             Martrix dimension is ( ldb, k ) when if trans = rocblas_operation_none, otherwise (ldb, n)
@@ -11578,6 +13481,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr2k(rocblas_handle               handle
             ldb specifies the first dimension of B.
             if trans = rocblas_operation_none,  ldb >= max( 1, n ),
             otherwise ldb >= max( 1, k ).
+
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
@@ -11591,7 +13495,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr2k(rocblas_handle               handle
            ldc specifies the first dimension of C. ldc >= max( 1, n ).
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k(rocblas_handle                handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrkx(rocblas_handle                handle,
                                              rocblas_fill                  uplo,
                                              rocblas_operation             trans,
                                              rocblas_int                   n,
@@ -11605,7 +13509,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k(rocblas_handle                handl
                                              rocblas_double_complex*       C,
                                              rocblas_int                   ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k_batched(rocblas_handle     handle,
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrkx_batched(rocblas_handle     handle,
                                                      rocblas_fill       uplo,
                                                      rocblas_operation  trans,
                                                      rocblas_int        n,
@@ -11620,7 +13524,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k_batched(rocblas_handle     handle,
                                                      rocblas_int        ldc,
                                                      rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k_batched(rocblas_handle      handle,
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrkx_batched(rocblas_handle      handle,
                                                      rocblas_fill        uplo,
                                                      rocblas_operation   trans,
                                                      rocblas_int         n,
@@ -11635,7 +13539,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k_batched(rocblas_handle      handle,
                                                      rocblas_int         ldc,
                                                      rocblas_int         batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_batched(rocblas_handle                     handle,
+ROCBLAS_EXPORT rocblas_status rocblas_csyrkx_batched(rocblas_handle                     handle,
                                                      rocblas_fill                       uplo,
                                                      rocblas_operation                  trans,
                                                      rocblas_int                        n,
@@ -11654,12 +13558,13 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_batched(rocblas_handle
 
     \details
 
-    syr2k_batched performs a batch of the matrix-matrix operations for a symmetric rank-2k update
+    syrkx_batched performs a batch of the matrix-matrix operations for a symmetric rank-k update
 
-    C_i := alpha*(op( A_i )*op( B_i )^T + op( B_i )*op( A_i )^T) + beta*C_i
+    C_i := alpha*op( A_i )*op( B_i )^T + beta*C_i
 
     where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrix, and
     C_i is a symmetric n x n matrix stored as either upper or lower.
+    This routine should only be used when the caller can guarantee that the result of op( A_i )*op( B_i )^T will be symmetric.
 
         op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
         op( A_i ) = A_i^T, op( B_i ) = B_i^T,  and A_i and B_i are k by n if trans == rocblas_operation_transpose
@@ -11701,14 +13606,17 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_batched(rocblas_handle
             lda specifies the first dimension of A_i.
             if trans = rocblas_operation_none,  lda >= max( 1, n ),
             otherwise lda >= max( 1, k ).
+
     @param[in]
     B       device array of device pointers storing each matrix_i B of dimension (ldb, k)
             when trans is rocblas_operation_none, otherwise of dimension (ldb, n)
+
     @param[in]
     ldb     [rocblas_int]
             ldb specifies the first dimension of B.
             if trans = rocblas_operation_none,  ldb >= max( 1, n ),
             otherwise ldb >= max( 1, k ).
+
     @param[in]
     beta
             beta specifies the scalar beta. When beta is
@@ -11720,12 +13628,13 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_batched(rocblas_handle
     @param[in]
     ldc    [rocblas_int]
            ldc specifies the first dimension of C. ldc >= max( 1, n ).
+
     @param[in]
     batch_count [rocblas_int]
-                number of instances in the batch.
+            number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k_batched(rocblas_handle                      handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrkx_batched(rocblas_handle                      handle,
                                                      rocblas_fill                        uplo,
                                                      rocblas_operation                   trans,
                                                      rocblas_int                         n,
@@ -11740,7 +13649,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k_batched(rocblas_handle
                                                      rocblas_int                         ldc,
                                                      rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k_strided_batched(rocblas_handle    handle,
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrkx_strided_batched(rocblas_handle    handle,
                                                              rocblas_fill      uplo,
                                                              rocblas_operation trans,
                                                              rocblas_int       n,
@@ -11758,7 +13667,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k_strided_batched(rocblas_handle    h
                                                              rocblas_stride    stride_C,
                                                              rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k_strided_batched(rocblas_handle    handle,
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrkx_strided_batched(rocblas_handle    handle,
                                                              rocblas_fill      uplo,
                                                              rocblas_operation trans,
                                                              rocblas_int       n,
@@ -11776,7 +13685,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k_strided_batched(rocblas_handle    h
                                                              rocblas_stride    stride_C,
                                                              rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_strided_batched(rocblas_handle               handle,
+ROCBLAS_EXPORT rocblas_status rocblas_csyrkx_strided_batched(rocblas_handle               handle,
                                                              rocblas_fill                 uplo,
                                                              rocblas_operation            trans,
                                                              rocblas_int                  n,
@@ -11798,12 +13707,13 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_strided_batched(rocblas_handle
 
     \details
 
-    syr2k_strided_batched performs a batch of the matrix-matrix operations for a symmetric rank-2k update
+    syrkx_strided_batched performs a batch of the matrix-matrix operations for a symmetric rank-k update
 
-    C_i := alpha*(op( A_i )*op( B_i )^T + op( B_i )*op( A_i )^T) + beta*C_i
+    C_i := alpha*op( A_i )*op( B_i )^T + beta*C_i
 
     where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrix, and
     C_i is a symmetric n x n matrix stored as either upper or lower.
+    This routine should only be used when the caller can guarantee that the result of op( A_i )*op( B_i )^T will be symmetric.
 
         op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
         op( A_i ) = A_i^T, op( B_i ) = B_i^T,  and A_i and B_i are k by n if trans == rocblas_operation_transpose
@@ -11885,7 +13795,7 @@ ROCBLAS_EXPORT rocblas_status rocblas_csyr2k_strided_batched(rocblas_handle
                 number of instances in the batch.
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k_strided_batched(rocblas_handle                handle,
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrkx_strided_batched(rocblas_handle                handle,
                                                              rocblas_fill                  uplo,
                                                              rocblas_operation             trans,
                                                              rocblas_int                   n,
@@ -11903,496 +13813,530 @@ ROCBLAS_EXPORT rocblas_status rocblas_zsyr2k_strided_batched(rocblas_handle
                                                              rocblas_stride                stride_C,
                                                              rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyrkx(rocblas_handle    handle,
-                                             rocblas_fill      uplo,
-                                             rocblas_operation trans,
-                                             rocblas_int       n,
-                                             rocblas_int       k,
-                                             const float*      alpha,
-                                             const float*      A,
-                                             rocblas_int       lda,
-                                             const float*      B,
-                                             rocblas_int       ldb,
-                                             const float*      beta,
-                                             float*            C,
-                                             rocblas_int       ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_strmm(rocblas_handle    handle,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            rocblas_int       lda,
+                                            float*            B,
+                                            rocblas_int       ldb);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyrkx(rocblas_handle    handle,
-                                             rocblas_fill      uplo,
-                                             rocblas_operation trans,
-                                             rocblas_int       n,
-                                             rocblas_int       k,
-                                             const double*     alpha,
-                                             const double*     A,
-                                             rocblas_int       lda,
-                                             const double*     B,
-                                             rocblas_int       ldb,
-                                             const double*     beta,
-                                             double*           C,
-                                             rocblas_int       ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmm(rocblas_handle    handle,
+                                            rocblas_side      side,
+                                            rocblas_fill      uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal  diag,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            rocblas_int       lda,
+                                            double*           B,
+                                            rocblas_int       ldb);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyrkx(rocblas_handle               handle,
-                                             rocblas_fill                 uplo,
-                                             rocblas_operation            trans,
-                                             rocblas_int                  n,
-                                             rocblas_int                  k,
-                                             const rocblas_float_complex* alpha,
-                                             const rocblas_float_complex* A,
-                                             rocblas_int                  lda,
-                                             const rocblas_float_complex* B,
-                                             rocblas_int                  ldb,
-                                             const rocblas_float_complex* beta,
-                                             rocblas_float_complex*       C,
-                                             rocblas_int                  ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_ctrmm(rocblas_handle               handle,
+                                            rocblas_side                 side,
+                                            rocblas_fill                 uplo,
+                                            rocblas_operation            transA,
+                                            rocblas_diagonal             diag,
+                                            rocblas_int                  m,
+                                            rocblas_int                  n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int                  lda,
+                                            rocblas_float_complex*       B,
+                                            rocblas_int                  ldb);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    syrkx performs one of the matrix-matrix operations for a symmetric rank-k update
+    trmm performs one of the matrix-matrix operations
 
-    C := alpha*op( A )*op( B )^T + beta*C
+    B := alpha*op( A )*B,   or   B := alpha*B*op( A )
 
-    where  alpha and beta are scalars, op(A) and op(B) are n by k matrix, and
-    C is a symmetric n x n matrix stored as either upper or lower.
-    This routine should only be used when the caller can guarantee that the result of op( A )*op( B )^T will be symmetric.
+    where  alpha  is a scalar,  B  is an m by n matrix,  A  is a unit, or
+    non-unit,  upper or lower triangular matrix  and  op( A )  is one  of
 
-        op( A ) = A, op( B ) = B, and A and B are n by k if trans == rocblas_operation_none
-        op( A ) = A^T, op( B ) = B^T,  and A and B are k by n if trans == rocblas_operation_transpose
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
+    @param[in]
+    side    [rocblas_side]
+            Specifies whether op(A) multiplies B from the left or right as follows:
+            rocblas_side_left:       B := alpha*op( A )*B.
+            rocblas_side_right:      B := alpha*B*op( A ).
+
     @param[in]
     uplo    [rocblas_fill]
-            rocblas_fill_upper:  C is an upper triangular matrix
-            rocblas_fill_lower:  C is a  lower triangular matrix
+            Specifies whether the matrix A is an uppoer or lower triangular matrix as follows:
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
 
     @param[in]
-    trans  [rocblas_operation]
-            rocblas_operation_transpose:      op( A ) = A^T, op( B ) = B^T
-            rocblas_operation_none:           op( A ) = A, op( B ) = B
+    transA  [rocblas_operation]
+            Specifies the form of op(A) to be used in the matrix multiplication as follows:
+            rocblas_operation_none:    op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
 
     @param[in]
-    n       [rocblas_int]
-            n specifies the number of rows and columns of C. n >= 0.
+    diag    [rocblas_diagonal]
+            Specifies whether or not A is unit triangular as follows:
+            rocblas_diagonal_unit:      A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
 
     @param[in]
-    k       [rocblas_int]
-            k specifies the number of columns of op(A) and op(B). k >= 0.
+    m       [rocblas_int]
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       [rocblas_int]
+            n specifies the number of columns of B. n >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A is not referenced and A need not be set before
+            zero then A is not referenced and B need not be set before
             entry.
 
     @param[in]
-    A       pointer storing matrix A on the GPU.
-            Martrix dimension is ( lda, k ) when if trans = rocblas_operation_none, otherwise (lda, n)
-            only the upper/lower triangular part is accessed.
+    A       Device pointer to matrix A on the GPU.
+            A has dimension ( lda, k ), where k is m
+            when  side == rocblas_side_left  and
+            is  n  when  side == rocblas_side_right.
 
-    @param[in]
-    lda     [rocblas_int]
-            lda specifies the first dimension of A.
-            if trans = rocblas_operation_none,  lda >= max( 1, n ),
-            otherwise lda >= max( 1, k ).
+        When uplo == rocblas_fill_upper the  leading  k by k
+        upper triangular part of the array  A must contain the upper
+        triangular matrix  and the strictly lower triangular part of
+        A is not referenced.
 
-    @param[in]
-    B       pointer storing matrix B on the GPU.
-            Martrix dimension is ( ldb, k ) when if trans = rocblas_operation_none, otherwise (ldb, n)
-            only the upper/lower triangular part is accessed.
+        When uplo == rocblas_fill_lower the  leading  k by k
+        lower triangular part of the array  A must contain the lower
+        triangular matrix  and the strictly upper triangular part of
+        A is not referenced.
 
-    @param[in]
-    ldb     [rocblas_int]
-            ldb specifies the first dimension of B.
-            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
-            otherwise ldb >= max( 1, k ).
+        Note that when  diag == rocblas_diagonal_unit  the diagonal elements of
+        A  are not referenced either,  but are assumed to be  unity.
 
     @param[in]
-    beta
-            beta specifies the scalar beta. When beta is
-            zero then C need not be set before entry.
+    lda     [rocblas_int]
+            lda specifies the first dimension of A.
+            if side == rocblas_side_left,  lda >= max( 1, m ),
+            if side == rocblas_side_right, lda >= max( 1, n ).
 
     @param[in]
-    C       pointer storing matrix C on the GPU.
+    B       Device pointer to the first matrix B_0 on the GPU.
+            On entry,  the leading  m by n part of the array  B must
+           contain the matrix  B,  and  on exit  is overwritten  by the
+           transformed matrix.
 
     @param[in]
-    ldc    [rocblas_int]
-           ldc specifies the first dimension of C. ldc >= max( 1, n ).
+    ldb    [rocblas_int]
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
 
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsyrkx(rocblas_handle                handle,
-                                             rocblas_fill                  uplo,
-                                             rocblas_operation             trans,
-                                             rocblas_int                   n,
-                                             rocblas_int                   k,
-                                             const rocblas_double_complex* alpha,
-                                             const rocblas_double_complex* A,
-                                             rocblas_int                   lda,
-                                             const rocblas_double_complex* B,
-                                             rocblas_int                   ldb,
-                                             const rocblas_double_complex* beta,
-                                             rocblas_double_complex*       C,
-                                             rocblas_int                   ldc);
-
-ROCBLAS_EXPORT rocblas_status rocblas_ssyrkx_batched(rocblas_handle     handle,
-                                                     rocblas_fill       uplo,
-                                                     rocblas_operation  trans,
-                                                     rocblas_int        n,
-                                                     rocblas_int        k,
-                                                     const float*       alpha,
-                                                     const float* const A[],
-                                                     rocblas_int        lda,
-                                                     const float* const B[],
-                                                     rocblas_int        ldb,
-                                                     const float*       beta,
-                                                     float* const       C[],
-                                                     rocblas_int        ldc,
-                                                     rocblas_int        batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ztrmm(rocblas_handle                handle,
+                                            rocblas_side                  side,
+                                            rocblas_fill                  uplo,
+                                            rocblas_operation             transA,
+                                            rocblas_diagonal              diag,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            rocblas_double_complex*       B,
+                                            rocblas_int                   ldb);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyrkx_batched(rocblas_handle      handle,
-                                                     rocblas_fill        uplo,
-                                                     rocblas_operation   trans,
-                                                     rocblas_int         n,
-                                                     rocblas_int         k,
-                                                     const double*       alpha,
-                                                     const double* const A[],
-                                                     rocblas_int         lda,
-                                                     const double* const B[],
-                                                     rocblas_int         ldb,
-                                                     const double*       beta,
-                                                     double* const       C[],
-                                                     rocblas_int         ldc,
-                                                     rocblas_int         batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_strmm_batched(rocblas_handle     handle,
+                                                    rocblas_side       side,
+                                                    rocblas_fill       uplo,
+                                                    rocblas_operation  transa,
+                                                    rocblas_diagonal   diag,
+                                                    rocblas_int        m,
+                                                    rocblas_int        n,
+                                                    const float*       alpha,
+                                                    const float* const a[],
+                                                    rocblas_int        lda,
+                                                    float* const       c[],
+                                                    rocblas_int        ldc,
+                                                    rocblas_int        batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyrkx_batched(rocblas_handle                     handle,
-                                                     rocblas_fill                       uplo,
-                                                     rocblas_operation                  trans,
-                                                     rocblas_int                        n,
-                                                     rocblas_int                        k,
-                                                     const rocblas_float_complex*       alpha,
-                                                     const rocblas_float_complex* const A[],
-                                                     rocblas_int                        lda,
-                                                     const rocblas_float_complex* const B[],
-                                                     rocblas_int                        ldb,
-                                                     const rocblas_float_complex*       beta,
-                                                     rocblas_float_complex* const       C[],
-                                                     rocblas_int                        ldc,
-                                                     rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmm_batched(rocblas_handle      handle,
+                                                    rocblas_side        side,
+                                                    rocblas_fill        uplo,
+                                                    rocblas_operation   transa,
+                                                    rocblas_diagonal    diag,
+                                                    rocblas_int         m,
+                                                    rocblas_int         n,
+                                                    const double*       alpha,
+                                                    const double* const a[],
+                                                    rocblas_int         lda,
+                                                    double* const       c[],
+                                                    rocblas_int         ldc,
+                                                    rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_batched(rocblas_handle                     handle,
+                                                    rocblas_side                       side,
+                                                    rocblas_fill                       uplo,
+                                                    rocblas_operation                  transa,
+                                                    rocblas_diagonal                   diag,
+                                                    rocblas_int                        m,
+                                                    rocblas_int                        n,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const a[],
+                                                    rocblas_int                        lda,
+                                                    rocblas_float_complex* const       c[],
+                                                    rocblas_int                        ldc,
+                                                    rocblas_int                        batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    syrkx_batched performs a batch of the matrix-matrix operations for a symmetric rank-k update
+    trmm_batched performs one of the batched matrix-matrix operations
 
-    C_i := alpha*op( A_i )*op( B_i )^T + beta*C_i
+    B_i := alpha*op( A_i )*B_i,   or   B_i := alpha*B_i*op( A_i )  for i = 0, 1, ... batch_count -1
 
-    where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrix, and
-    C_i is a symmetric n x n matrix stored as either upper or lower.
-    This routine should only be used when the caller can guarantee that the result of op( A_i )*op( B_i )^T will be symmetric.
+    where  alpha  is a scalar,  B_i  is an m by n matrix,  A_i  is a unit, or
+    non-unit,  upper or lower triangular matrix  and  op( A_i )  is one  of
 
-        op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
-        op( A_i ) = A_i^T, op( B_i ) = B_i^T,  and A_i and B_i are k by n if trans == rocblas_operation_transpose
+        op( A_i ) = A_i   or   op( A_i ) = A_i^T   or   op( A_i ) = A_i^H.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
+    @param[in]
+    side    [rocblas_side]
+            Specifies whether op(A_i) multiplies B_i from the left or right as follows:
+            rocblas_side_left:       B_i := alpha*op( A_i )*B_i.
+            rocblas_side_right:      B_i := alpha*B_i*op( A_i ).
+
     @param[in]
     uplo    [rocblas_fill]
-            rocblas_fill_upper:  C_i is an upper triangular matrix
-            rocblas_fill_lower:  C_i is a  lower triangular matrix
+            Specifies whether the matrix A is an uppoer or lower triangular matrix as follows:
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
 
     @param[in]
-    trans  [rocblas_operation]
-            rocblas_operation_transpose:      op( A_i ) = A_i^T, op( B_i ) = B_i^T
-            rocblas_operation_none:           op( A_i ) = A_i, op( B_i ) = B_i
+    transA  [rocblas_operation]
+            Specifies the form of op(A_i) to be used in the matrix multiplication as follows:
+            rocblas_operation_none:    op(A_i) = A_i.
+            rocblas_operation_transpose:      op(A_i) = A_i^T.
+            rocblas_operation_conjugate_transpose:  op(A_i) = A_i^H.
 
     @param[in]
-    n       [rocblas_int]
-            n specifies the number of rows and columns of C_i. n >= 0.
+    diag    [rocblas_diagonal]
+            Specifies whether or not A_i is unit triangular as follows:
+            rocblas_diagonal_unit:      A_i is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A_i is not assumed to be unit triangular.
 
     @param[in]
-    k       [rocblas_int]
-            k specifies the number of columns of op(A). k >= 0.
+    m       [rocblas_int]
+            m specifies the number of rows of B_i. m >= 0.
+
+    @param[in]
+    n       [rocblas_int]
+            n specifies the number of columns of B_i. n >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A is not referenced and A need not be set before
+            zero then A_i is not referenced and B_i need not be set before
             entry.
 
     @param[in]
-    A       device array of device pointers storing each matrix_i A of dimension (lda, k)
-            when trans is rocblas_operation_none, otherwise of dimension (lda, n)
+    A       Device array of device pointers storing each matrix A_i on the GPU.
+            Each A_i is of dimension ( lda, k ), where k is m
+            when  side == rocblas_side_left  and
+            is  n  when  side == rocblas_side_right.
 
-    @param[in]
-    lda     [rocblas_int]
-            lda specifies the first dimension of A_i.
-            if trans = rocblas_operation_none,  lda >= max( 1, n ),
-            otherwise lda >= max( 1, k ).
+        When uplo == rocblas_fill_upper the  leading  k by k
+        upper triangular part of the array  A must contain the upper
+        triangular matrix  and the strictly lower triangular part of
+        A is not referenced.
 
-    @param[in]
-    B       device array of device pointers storing each matrix_i B of dimension (ldb, k)
-            when trans is rocblas_operation_none, otherwise of dimension (ldb, n)
+        When uplo == rocblas_fill_lower the  leading  k by k
+        lower triangular part of the array  A must contain the lower
+        triangular matrix  and the strictly upper triangular part of
+        A is not referenced.
 
-    @param[in]
-    ldb     [rocblas_int]
-            ldb specifies the first dimension of B.
-            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
-            otherwise ldb >= max( 1, k ).
+        Note that when  diag == rocblas_diagonal_unit  the diagonal elements of
+        A_i  are not referenced either,  but are assumed to be  unity.
 
     @param[in]
-    beta
-            beta specifies the scalar beta. When beta is
-            zero then C need not be set before entry.
+    lda     [rocblas_int]
+            lda specifies the first dimension of A.
+            if side == rocblas_side_left,  lda >= max( 1, m ),
+            if side == rocblas_side_right, lda >= max( 1, n ).
 
     @param[in]
-    C       device array of device pointers storing each matrix C_i on the GPU.
+    B       device array of device pointers storing each matrix B_i on the GPU.
+            On entry,  the leading  m by n part of the array  B_i must
+           contain the matrix  B_i,  and  on exit  is overwritten  by the
+           transformed matrix.
 
     @param[in]
-    ldc    [rocblas_int]
-           ldc specifies the first dimension of C. ldc >= max( 1, n ).
+    ldb    [rocblas_int]
+           ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
 
     @param[in]
     batch_count [rocblas_int]
-            number of instances in the batch.
-
+                number of instances i in the batch.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsyrkx_batched(rocblas_handle                      handle,
-                                                     rocblas_fill                        uplo,
-                                                     rocblas_operation                   trans,
-                                                     rocblas_int                         n,
-                                                     rocblas_int                         k,
-                                                     const rocblas_double_complex*       alpha,
-                                                     const rocblas_double_complex* const A[],
-                                                     rocblas_int                         lda,
-                                                     const rocblas_double_complex* const B[],
-                                                     rocblas_int                         ldb,
-                                                     const rocblas_double_complex*       beta,
-                                                     rocblas_double_complex* const       C[],
-                                                     rocblas_int                         ldc,
-                                                     rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ztrmm_batched(rocblas_handle                      handle,
+                                                    rocblas_side                        side,
+                                                    rocblas_fill                        uplo,
+                                                    rocblas_operation                   transa,
+                                                    rocblas_diagonal                    diag,
+                                                    rocblas_int                         m,
+                                                    rocblas_int                         n,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const a[],
+                                                    rocblas_int                         lda,
+                                                    rocblas_double_complex* const       c[],
+                                                    rocblas_int                         ldc,
+                                                    rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyrkx_strided_batched(rocblas_handle    handle,
-                                                             rocblas_fill      uplo,
-                                                             rocblas_operation trans,
-                                                             rocblas_int       n,
-                                                             rocblas_int       k,
-                                                             const float*      alpha,
-                                                             const float*      A,
-                                                             rocblas_int       lda,
-                                                             rocblas_stride    stride_A,
-                                                             const float*      B,
-                                                             rocblas_int       ldb,
-                                                             rocblas_stride    stride_B,
-                                                             const float*      beta,
-                                                             float*            C,
-                                                             rocblas_int       ldc,
-                                                             rocblas_stride    stride_C,
-                                                             rocblas_int       batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_strmm_strided_batched(rocblas_handle    handle,
+                                                            rocblas_side      side,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transa,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            const float*      alpha,
+                                                            const float*      a,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_a,
+                                                            float*            c,
+                                                            rocblas_int       ldc,
+                                                            rocblas_stride    stride_c,
+                                                            rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyrkx_strided_batched(rocblas_handle    handle,
-                                                             rocblas_fill      uplo,
-                                                             rocblas_operation trans,
-                                                             rocblas_int       n,
-                                                             rocblas_int       k,
-                                                             const double*     alpha,
-                                                             const double*     A,
-                                                             rocblas_int       lda,
-                                                             rocblas_stride    stride_A,
-                                                             const double*     B,
-                                                             rocblas_int       ldb,
-                                                             rocblas_stride    stride_B,
-                                                             const double*     beta,
-                                                             double*           C,
-                                                             rocblas_int       ldc,
-                                                             rocblas_stride    stride_C,
-                                                             rocblas_int       batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmm_strided_batched(rocblas_handle    handle,
+                                                            rocblas_side      side,
+                                                            rocblas_fill      uplo,
+                                                            rocblas_operation transa,
+                                                            rocblas_diagonal  diag,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            const double*     alpha,
+                                                            const double*     a,
+                                                            rocblas_int       lda,
+                                                            rocblas_stride    stride_a,
+                                                            double*           c,
+                                                            rocblas_int       ldc,
+                                                            rocblas_stride    stride_c,
+                                                            rocblas_int       batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_csyrkx_strided_batched(rocblas_handle               handle,
-                                                             rocblas_fill                 uplo,
-                                                             rocblas_operation            trans,
-                                                             rocblas_int                  n,
-                                                             rocblas_int                  k,
-                                                             const rocblas_float_complex* alpha,
-                                                             const rocblas_float_complex* A,
-                                                             rocblas_int                  lda,
-                                                             rocblas_stride               stride_A,
-                                                             const rocblas_float_complex* B,
-                                                             rocblas_int                  ldb,
-                                                             rocblas_stride               stride_B,
-                                                             const rocblas_float_complex* beta,
-                                                             rocblas_float_complex*       C,
-                                                             rocblas_int                  ldc,
-                                                             rocblas_stride               stride_C,
-                                                             rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_strided_batched(rocblas_handle               handle,
+                                                            rocblas_side                 side,
+                                                            rocblas_fill                 uplo,
+                                                            rocblas_operation            transa,
+                                                            rocblas_diagonal             diag,
+                                                            rocblas_int                  m,
+                                                            rocblas_int                  n,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* a,
+                                                            rocblas_int                  lda,
+                                                            rocblas_stride               stride_a,
+                                                            rocblas_float_complex*       c,
+                                                            rocblas_int                  ldc,
+                                                            rocblas_stride               stride_c,
+                                                            rocblas_int batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    syrkx_strided_batched performs a batch of the matrix-matrix operations for a symmetric rank-k update
+    trmm_strided_batched performs one of the strided_batched matrix-matrix operations
 
-    C_i := alpha*op( A_i )*op( B_i )^T + beta*C_i
+    B_i := alpha*op( A_i )*B_i,   or   B_i := alpha*B_i*op( A_i )  for i = 0, 1, ... batch_count -1
 
-    where  alpha and beta are scalars, op(A_i) and op(B_i) are n by k matrix, and
-    C_i is a symmetric n x n matrix stored as either upper or lower.
-    This routine should only be used when the caller can guarantee that the result of op( A_i )*op( B_i )^T will be symmetric.
+    where  alpha  is a scalar,  B_i  is an m by n matrix,  A_i  is a unit, or
+    non-unit,  upper or lower triangular matrix  and  op( A_i )  is one  of
 
-        op( A_i ) = A_i, op( B_i ) = B_i, and A_i and B_i are n by k if trans == rocblas_operation_none
-        op( A_i ) = A_i^T, op( B_i ) = B_i^T,  and A_i and B_i are k by n if trans == rocblas_operation_transpose
+        op( A_i ) = A_i   or   op( A_i ) = A_i^T   or   op( A_i ) = A_i^H.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
 
+    @param[in]
+    side    [rocblas_side]
+            Specifies whether op(A_i) multiplies B_i from the left or right as follows:
+            rocblas_side_left:       B_i := alpha*op( A_i )*B_i.
+            rocblas_side_right:      B_i := alpha*B_i*op( A_i ).
+
     @param[in]
     uplo    [rocblas_fill]
-            rocblas_fill_upper:  C_i is an upper triangular matrix
-            rocblas_fill_lower:  C_i is a  lower triangular matrix
+            Specifies whether the matrix A is an uppoer or lower triangular matrix as follows:
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
 
     @param[in]
-    trans  [rocblas_operation]
-            rocblas_operation_transpose:      op( A_i ) = A_i^T, op( B_i ) = B_i^T
-            rocblas_operation_none:           op( A_i ) = A_i, op( B_i ) = B_i
+    transA  [rocblas_operation]
+            Specifies the form of op(A_i) to be used in the matrix multiplication as follows:
+            rocblas_operation_none:    op(A_i) = A_i.
+            rocblas_operation_transpose:      op(A_i) = A_i^T.
+            rocblas_operation_conjugate_transpose:  op(A_i) = A_i^H.
 
     @param[in]
-    n       [rocblas_int]
-            n specifies the number of rows and columns of C_i. n >= 0.
+    diag    [rocblas_diagonal]
+            Specifies whether or not A_i is unit triangular as follows:
+            rocblas_diagonal_unit:      A_i is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A_i is not assumed to be unit triangular.
 
     @param[in]
-    k       [rocblas_int]
-            k specifies the number of columns of op(A). k >= 0.
+    m       [rocblas_int]
+            m specifies the number of rows of B_i. m >= 0.
+
+    @param[in]
+    n       [rocblas_int]
+            n specifies the number of columns of B_i. n >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A is not referenced and A need not be set before
+            zero then A_i is not referenced and B_i need not be set before
             entry.
 
     @param[in]
-    A       Device pointer to the first matrix A_1 on the GPU of dimension (lda, k)
-            when trans is rocblas_operation_none, otherwise of dimension (lda, n)
+    A       Device pointer to the first matrix A_0 on the GPU.
+            Each A_i is of dimension ( lda, k ), where k is m
+            when  side == rocblas_side_left  and
+            is  n  when  side == rocblas_side_right.
+
+        When uplo == rocblas_fill_upper the  leading  k by k
+        upper triangular part of the array  A must contain the upper
+        triangular matrix  and the strictly lower triangular part of
+        A is not referenced.
+
+        When uplo == rocblas_fill_lower the  leading  k by k
+        lower triangular part of the array  A must contain the lower
+        triangular matrix  and the strictly upper triangular part of
+        A is not referenced.
+
+        Note that when  diag == rocblas_diagonal_unit  the diagonal elements of
+        A_i  are not referenced either,  but are assumed to be  unity.
 
     @param[in]
     lda     [rocblas_int]
-            lda specifies the first dimension of A_i.
-            if trans = rocblas_operation_none,  lda >= max( 1, n ),
-            otherwise lda >= max( 1, k ).
+            lda specifies the first dimension of A.
+            if side == rocblas_side_left,  lda >= max( 1, m ),
+            if side == rocblas_side_right, lda >= max( 1, n ).
 
     @param[in]
     stride_A  [rocblas_stride]
               stride from the start of one matrix (A_i) and the next one (A_i+1)
 
     @param[in]
-    B       Device pointer to the first matrix B_1 on the GPU of dimension (ldb, k)
-            when trans is rocblas_operation_none, otherwise of dimension (ldb, n)
+    B       Device pointer to the first matrix B_0 on the GPU.
+            On entry,  the leading  m by n part of the array  B_i must
+           contain the matrix  B_i,  and  on exit  is overwritten  by the
+           transformed matrix.
 
     @param[in]
-    ldb     [rocblas_int]
-            ldb specifies the first dimension of B_i.
-            if trans = rocblas_operation_none,  ldb >= max( 1, n ),
-            otherwise ldb >= max( 1, k ).
+    ldb    [rocblas_int]
+           ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
 
-    @param[in]
+           @param[in]
     stride_B  [rocblas_stride]
               stride from the start of one matrix (B_i) and the next one (B_i+1)
-
-    @param[in]
-    beta
-            beta specifies the scalar beta. When beta is
-            zero then C need not be set before entry.
-
-    @param[in]
-    C       Device pointer to the first matrix C_1 on the GPU.
-
-    @param[in]
-    ldc    [rocblas_int]
-           ldc specifies the first dimension of C. ldc >= max( 1, n ).
-
-    @param[inout]
-    stride_C  [rocblas_stride]
-              stride from the start of one matrix (C_i) and the next one (C_i+1)
-
     @param[in]
     batch_count [rocblas_int]
-                number of instances in the batch.
-
+                number of instances i in the batch.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_zsyrkx_strided_batched(rocblas_handle                handle,
-                                                             rocblas_fill                  uplo,
-                                                             rocblas_operation             trans,
-                                                             rocblas_int                   n,
-                                                             rocblas_int                   k,
-                                                             const rocblas_double_complex* alpha,
-                                                             const rocblas_double_complex* A,
-                                                             rocblas_int                   lda,
-                                                             rocblas_stride                stride_A,
-                                                             const rocblas_double_complex* B,
-                                                             rocblas_int                   ldb,
-                                                             rocblas_stride                stride_B,
-                                                             const rocblas_double_complex* beta,
-                                                             rocblas_double_complex*       C,
-                                                             rocblas_int                   ldc,
-                                                             rocblas_stride                stride_C,
-                                                             rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_strmm(rocblas_handle    handle,
-                                            rocblas_side      side,
-                                            rocblas_fill      uplo,
-                                            rocblas_operation transA,
-                                            rocblas_diagonal  diag,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            const float*      alpha,
-                                            const float*      A,
-                                            rocblas_int       lda,
-                                            float*            B,
-                                            rocblas_int       ldb);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dtrmm(rocblas_handle    handle,
-                                            rocblas_side      side,
-                                            rocblas_fill      uplo,
-                                            rocblas_operation transA,
-                                            rocblas_diagonal  diag,
-                                            rocblas_int       m,
-                                            rocblas_int       n,
-                                            const double*     alpha,
-                                            const double*     A,
-                                            rocblas_int       lda,
-                                            double*           B,
-                                            rocblas_int       ldb);
+ROCBLAS_EXPORT rocblas_status rocblas_ztrmm_strided_batched(rocblas_handle                handle,
+                                                            rocblas_side                  side,
+                                                            rocblas_fill                  uplo,
+                                                            rocblas_operation             transa,
+                                                            rocblas_diagonal              diag,
+                                                            rocblas_int                   m,
+                                                            rocblas_int                   n,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* a,
+                                                            rocblas_int                   lda,
+                                                            rocblas_stride                stride_a,
+                                                            rocblas_double_complex*       c,
+                                                            rocblas_int                   ldc,
+                                                            rocblas_stride                stride_c,
+                                                            rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ctrmm(rocblas_handle               handle,
-                                            rocblas_side                 side,
-                                            rocblas_fill                 uplo,
-                                            rocblas_operation            transA,
-                                            rocblas_diagonal             diag,
-                                            rocblas_int                  m,
-                                            rocblas_int                  n,
-                                            const rocblas_float_complex* alpha,
-                                            const rocblas_float_complex* A,
-                                            rocblas_int                  lda,
-                                            rocblas_float_complex*       B,
-                                            rocblas_int                  ldb);
+ROCBLAS_EXPORT rocblas_status rocblas_strmm_outofplace(rocblas_handle    handle,
+                                                       rocblas_side      side,
+                                                       rocblas_fill      uplo,
+                                                       rocblas_operation transA,
+                                                       rocblas_diagonal  diag,
+                                                       rocblas_int       m,
+                                                       rocblas_int       n,
+                                                       const float*      alpha,
+                                                       const float*      A,
+                                                       rocblas_int       lda,
+                                                       const float*      B,
+                                                       rocblas_int       ldb,
+                                                       float*            C,
+                                                       rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmm_outofplace(rocblas_handle    handle,
+                                                       rocblas_side      side,
+                                                       rocblas_fill      uplo,
+                                                       rocblas_operation transA,
+                                                       rocblas_diagonal  diag,
+                                                       rocblas_int       m,
+                                                       rocblas_int       n,
+                                                       const double*     alpha,
+                                                       const double*     A,
+                                                       rocblas_int       lda,
+                                                       const double*     B,
+                                                       rocblas_int       ldb,
+                                                       double*           C,
+                                                       rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_outofplace(rocblas_handle               handle,
+                                                       rocblas_side                 side,
+                                                       rocblas_fill                 uplo,
+                                                       rocblas_operation            transA,
+                                                       rocblas_diagonal             diag,
+                                                       rocblas_int                  m,
+                                                       rocblas_int                  n,
+                                                       const rocblas_float_complex* alpha,
+                                                       const rocblas_float_complex* A,
+                                                       rocblas_int                  lda,
+                                                       const rocblas_float_complex* B,
+                                                       rocblas_int                  ldb,
+                                                       rocblas_float_complex*       C,
+                                                       rocblas_int                  ldc);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    trmm performs one of the matrix-matrix operations
+    trmm_outofplace performs one of the matrix-matrix operations
 
-    B := alpha*op( A )*B,   or   B := alpha*B*op( A )
+    C := alpha*op( A )*B,   or   C := alpha*B*op( A )
 
-    where  alpha  is a scalar,  B  is an m by n matrix,  A  is a unit, or
+    where  alpha  is a scalar,  B  and  C  are m by n matrices,  A  is a unit, or
     non-unit,  upper or lower triangular matrix  and  op( A )  is one  of
 
         op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
 
+    Unlike trmm, B is not overwritten. The triangle of op( A ) is split recursively, the
+    off-diagonal blocks being multiplied by gemm, and as B is only read the blocks of C are
+    computed without the ordering constraints of the in-place product. C must not overlap A or
+    B, except that C may be B with ldc == ldb, which computes trmm in place.
+
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
@@ -12400,12 +14344,12 @@ ROCBLAS_EXPORT rocblas_status rocblas_ctrmm(rocblas_handle               handle,
     @param[in]
     side    [rocblas_side]
             Specifies whether op(A) multiplies B from the left or right as follows:
-            rocblas_side_left:       B := alpha*op( A )*B.
-            rocblas_side_right:      B := alpha*B*op( A ).
+            rocblas_side_left:       C := alpha*op( A )*B.
+            rocblas_side_right:      C := alpha*B*op( A ).
 
     @param[in]
     uplo    [rocblas_fill]
-            Specifies whether the matrix A is an uppoer or lower triangular matrix as follows:
+            Specifies whether the matrix A is an upper or lower triangular matrix as follows:
             rocblas_fill_upper:  A is an upper triangular matrix.
             rocblas_fill_lower:  A is a  lower triangular matrix.
 
@@ -12424,17 +14368,16 @@ ROCBLAS_EXPORT rocblas_status rocblas_ctrmm(rocblas_handle               handle,
 
     @param[in]
     m       [rocblas_int]
-            m specifies the number of rows of B. m >= 0.
+            m specifies the number of rows of B and C. m >= 0.
 
     @param[in]
     n       [rocblas_int]
-            n specifies the number of columns of B. n >= 0.
+            n specifies the number of columns of B and C. n >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A is not referenced and B need not be set before
-            entry.
+            zero then A and B are not referenced and C is set to zero.
 
     @param[in]
     A       Device pointer to matrix A on the GPU.
@@ -12459,87 +14402,105 @@ ROCBLAS_EXPORT rocblas_status rocblas_ctrmm(rocblas_handle               handle,
     lda     [rocblas_int]
             lda specifies the first dimension of A.
             if side == rocblas_side_left,  lda >= max( 1, m ),
-            if side == rocblas_side_right, lda >= max( 1, n ).
-
-    @param[in]
-    B       Device pointer to the first matrix B_0 on the GPU.
-            On entry,  the leading  m by n part of the array  B must
-           contain the matrix  B,  and  on exit  is overwritten  by the
-           transformed matrix.
-
-    @param[in]
-    ldb    [rocblas_int]
-           ldb specifies the first dimension of B. ldb >= max( 1, m ).
-
-    ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_ztrmm(rocblas_handle                handle,
-                                            rocblas_side                  side,
-                                            rocblas_fill                  uplo,
-                                            rocblas_operation             transA,
-                                            rocblas_diagonal              diag,
-                                            rocblas_int                   m,
-                                            rocblas_int                   n,
-                                            const rocblas_double_complex* alpha,
-                                            const rocblas_double_complex* A,
-                                            rocblas_int                   lda,
-                                            rocblas_double_complex*       B,
-                                            rocblas_int                   ldb);
-
-ROCBLAS_EXPORT rocblas_status rocblas_strmm_batched(rocblas_handle     handle,
-                                                    rocblas_side       side,
-                                                    rocblas_fill       uplo,
-                                                    rocblas_operation  transa,
-                                                    rocblas_diagonal   diag,
-                                                    rocblas_int        m,
-                                                    rocblas_int        n,
-                                                    const float*       alpha,
-                                                    const float* const a[],
-                                                    rocblas_int        lda,
-                                                    float* const       c[],
-                                                    rocblas_int        ldc,
-                                                    rocblas_int        batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dtrmm_batched(rocblas_handle      handle,
-                                                    rocblas_side        side,
-                                                    rocblas_fill        uplo,
-                                                    rocblas_operation   transa,
-                                                    rocblas_diagonal    diag,
-                                                    rocblas_int         m,
-                                                    rocblas_int         n,
-                                                    const double*       alpha,
-                                                    const double* const a[],
-                                                    rocblas_int         lda,
-                                                    double* const       c[],
-                                                    rocblas_int         ldc,
-                                                    rocblas_int         batch_count);
+            if side == rocblas_side_right, lda >= max( 1, n ).
 
-ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_batched(rocblas_handle                     handle,
-                                                    rocblas_side                       side,
-                                                    rocblas_fill                       uplo,
-                                                    rocblas_operation                  transa,
-                                                    rocblas_diagonal                   diag,
-                                                    rocblas_int                        m,
-                                                    rocblas_int                        n,
-                                                    const rocblas_float_complex*       alpha,
-                                                    const rocblas_float_complex* const a[],
-                                                    rocblas_int                        lda,
-                                                    rocblas_float_complex* const       c[],
-                                                    rocblas_int                        ldc,
-                                                    rocblas_int                        batch_count);
+    @param[in]
+    B       Device pointer to matrix B on the GPU.
+            The leading  m by n part of the array  B must contain the matrix  B.
+
+    @param[in]
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    @param[out]
+    C       Device pointer to matrix C on the GPU.
+            On exit, the leading  m by n part of the array  C  holds the product.
+
+    @param[in]
+    ldc     [rocblas_int]
+            ldc specifies the first dimension of C. ldc >= max( 1, m ).
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ztrmm_outofplace(rocblas_handle                handle,
+                                                       rocblas_side                  side,
+                                                       rocblas_fill                  uplo,
+                                                       rocblas_operation             transA,
+                                                       rocblas_diagonal              diag,
+                                                       rocblas_int                   m,
+                                                       rocblas_int                   n,
+                                                       const rocblas_double_complex* alpha,
+                                                       const rocblas_double_complex* A,
+                                                       rocblas_int                   lda,
+                                                       const rocblas_double_complex* B,
+                                                       rocblas_int                   ldb,
+                                                       rocblas_double_complex*       C,
+                                                       rocblas_int                   ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_strmm_outofplace_batched(rocblas_handle     handle,
+                                                               rocblas_side       side,
+                                                               rocblas_fill       uplo,
+                                                               rocblas_operation  transA,
+                                                               rocblas_diagonal   diag,
+                                                               rocblas_int        m,
+                                                               rocblas_int        n,
+                                                               const float*       alpha,
+                                                               const float* const A[],
+                                                               rocblas_int        lda,
+                                                               const float* const B[],
+                                                               rocblas_int        ldb,
+                                                               float* const       C[],
+                                                               rocblas_int        ldc,
+                                                               rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmm_outofplace_batched(rocblas_handle      handle,
+                                                               rocblas_side        side,
+                                                               rocblas_fill        uplo,
+                                                               rocblas_operation   transA,
+                                                               rocblas_diagonal    diag,
+                                                               rocblas_int         m,
+                                                               rocblas_int         n,
+                                                               const double*       alpha,
+                                                               const double* const A[],
+                                                               rocblas_int         lda,
+                                                               const double* const B[],
+                                                               rocblas_int         ldb,
+                                                               double* const       C[],
+                                                               rocblas_int         ldc,
+                                                               rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_ctrmm_outofplace_batched(rocblas_handle                     handle,
+                                     rocblas_side                       side,
+                                     rocblas_fill                       uplo,
+                                     rocblas_operation                  transA,
+                                     rocblas_diagonal                   diag,
+                                     rocblas_int                        m,
+                                     rocblas_int                        n,
+                                     const rocblas_float_complex*       alpha,
+                                     const rocblas_float_complex* const A[],
+                                     rocblas_int                        lda,
+                                     const rocblas_float_complex* const B[],
+                                     rocblas_int                        ldb,
+                                     rocblas_float_complex* const       C[],
+                                     rocblas_int                        ldc,
+                                     rocblas_int                        batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    trmm_batched performs one of the batched matrix-matrix operations
+    trmm_outofplace_batched performs one of the batched matrix-matrix operations
 
-    B_i := alpha*op( A_i )*B_i,   or   B_i := alpha*B_i*op( A_i )  for i = 0, 1, ... batch_count -1
+    C_i := alpha*op( A_i )*B_i,   or   C_i := alpha*B_i*op( A_i )  for i = 0, 1, ... batch_count -1
 
-    where  alpha  is a scalar,  B_i  is an m by n matrix,  A_i  is a unit, or
+    where  alpha  is a scalar,  B_i  and  C_i  are m by n matrices,  A_i  is a unit, or
     non-unit,  upper or lower triangular matrix  and  op( A_i )  is one  of
 
         op( A_i ) = A_i   or   op( A_i ) = A_i^T   or   op( A_i ) = A_i^H.
 
+    See trmm_outofplace. C_i must not overlap A_i or B_i, except that C may be the same array
+    as B with ldc == ldb, which computes trmm_batched in place.
+
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
@@ -12547,12 +14508,12 @@ ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_batched(rocblas_handle
     @param[in]
     side    [rocblas_side]
             Specifies whether op(A_i) multiplies B_i from the left or right as follows:
-            rocblas_side_left:       B_i := alpha*op( A_i )*B_i.
-            rocblas_side_right:      B_i := alpha*B_i*op( A_i ).
+            rocblas_side_left:       C_i := alpha*op( A_i )*B_i.
+            rocblas_side_right:      C_i := alpha*B_i*op( A_i ).
 
     @param[in]
     uplo    [rocblas_fill]
-            Specifies whether the matrix A is an uppoer or lower triangular matrix as follows:
+            Specifies whether the matrix A is an upper or lower triangular matrix as follows:
             rocblas_fill_upper:  A is an upper triangular matrix.
             rocblas_fill_lower:  A is a  lower triangular matrix.
 
@@ -12571,17 +14532,16 @@ ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_batched(rocblas_handle
 
     @param[in]
     m       [rocblas_int]
-            m specifies the number of rows of B_i. m >= 0.
+            m specifies the number of rows of B_i and C_i. m >= 0.
 
     @param[in]
     n       [rocblas_int]
-            n specifies the number of columns of B_i. n >= 0.
+            n specifies the number of columns of B_i and C_i. n >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A_i is not referenced and B_i need not be set before
-            entry.
+            zero then A_i and B_i are not referenced and C_i is set to zero.
 
     @param[in]
     A       Device array of device pointers storing each matrix A_i on the GPU.
@@ -12609,94 +14569,114 @@ ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_batched(rocblas_handle
             if side == rocblas_side_right, lda >= max( 1, n ).
 
     @param[in]
-    B       device array of device pointers storing each matrix B_i on the GPU.
-            On entry,  the leading  m by n part of the array  B_i must
-           contain the matrix  B_i,  and  on exit  is overwritten  by the
-           transformed matrix.
+    B       Device array of device pointers storing each matrix B_i on the GPU.
 
     @param[in]
-    ldb    [rocblas_int]
-           ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
+
+    @param[out]
+    C       Device array of device pointers storing each matrix C_i on the GPU.
+
+    @param[in]
+    ldc     [rocblas_int]
+            ldc specifies the first dimension of C_i. ldc >= max( 1, m ).
 
     @param[in]
     batch_count [rocblas_int]
                 number of instances i in the batch.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_ztrmm_batched(rocblas_handle                      handle,
-                                                    rocblas_side                        side,
-                                                    rocblas_fill                        uplo,
-                                                    rocblas_operation                   transa,
-                                                    rocblas_diagonal                    diag,
-                                                    rocblas_int                         m,
-                                                    rocblas_int                         n,
-                                                    const rocblas_double_complex*       alpha,
-                                                    const rocblas_double_complex* const a[],
-                                                    rocblas_int                         lda,
-                                                    rocblas_double_complex* const       c[],
-                                                    rocblas_int                         ldc,
-                                                    rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_strmm_strided_batched(rocblas_handle    handle,
-                                                            rocblas_side      side,
-                                                            rocblas_fill      uplo,
-                                                            rocblas_operation transa,
-                                                            rocblas_diagonal  diag,
-                                                            rocblas_int       m,
-                                                            rocblas_int       n,
-                                                            const float*      alpha,
-                                                            const float*      a,
-                                                            rocblas_int       lda,
-                                                            rocblas_stride    stride_a,
-                                                            float*            c,
-                                                            rocblas_int       ldc,
-                                                            rocblas_stride    stride_c,
-                                                            rocblas_int       batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dtrmm_strided_batched(rocblas_handle    handle,
-                                                            rocblas_side      side,
-                                                            rocblas_fill      uplo,
-                                                            rocblas_operation transa,
-                                                            rocblas_diagonal  diag,
-                                                            rocblas_int       m,
-                                                            rocblas_int       n,
-                                                            const double*     alpha,
-                                                            const double*     a,
-                                                            rocblas_int       lda,
-                                                            rocblas_stride    stride_a,
-                                                            double*           c,
-                                                            rocblas_int       ldc,
-                                                            rocblas_stride    stride_c,
-                                                            rocblas_int       batch_count);
+ROCBLAS_EXPORT rocblas_status
+    rocblas_ztrmm_outofplace_batched(rocblas_handle                      handle,
+                                     rocblas_side                        side,
+                                     rocblas_fill                        uplo,
+                                     rocblas_operation                   transA,
+                                     rocblas_diagonal                    diag,
+                                     rocblas_int                         m,
+                                     rocblas_int                         n,
+                                     const rocblas_double_complex*       alpha,
+                                     const rocblas_double_complex* const A[],
+                                     rocblas_int                         lda,
+                                     const rocblas_double_complex* const B[],
+                                     rocblas_int                         ldb,
+                                     rocblas_double_complex* const       C[],
+                                     rocblas_int                         ldc,
+                                     rocblas_int                         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_strmm_outofplace_strided_batched(rocblas_handle    handle,
+                                                                       rocblas_side      side,
+                                                                       rocblas_fill      uplo,
+                                                                       rocblas_operation transA,
+                                                                       rocblas_diagonal  diag,
+                                                                       rocblas_int       m,
+                                                                       rocblas_int       n,
+                                                                       const float*      alpha,
+                                                                       const float*      A,
+                                                                       rocblas_int       lda,
+                                                                       rocblas_stride    stride_A,
+                                                                       const float*      B,
+                                                                       rocblas_int       ldb,
+                                                                       rocblas_stride    stride_B,
+                                                                       float*            C,
+                                                                       rocblas_int       ldc,
+                                                                       rocblas_stride    stride_C,
+                                                                       rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrmm_outofplace_strided_batched(rocblas_handle    handle,
+                                                                       rocblas_side      side,
+                                                                       rocblas_fill      uplo,
+                                                                       rocblas_operation transA,
+                                                                       rocblas_diagonal  diag,
+                                                                       rocblas_int       m,
+                                                                       rocblas_int       n,
+                                                                       const double*     alpha,
+                                                                       const double*     A,
+                                                                       rocblas_int       lda,
+                                                                       rocblas_stride    stride_A,
+                                                                       const double*     B,
+                                                                       rocblas_int       ldb,
+                                                                       rocblas_stride    stride_B,
+                                                                       double*           C,
+                                                                       rocblas_int       ldc,
+                                                                       rocblas_stride    stride_C,
+                                                                       rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_strided_batched(rocblas_handle               handle,
-                                                            rocblas_side                 side,
-                                                            rocblas_fill                 uplo,
-                                                            rocblas_operation            transa,
-                                                            rocblas_diagonal             diag,
-                                                            rocblas_int                  m,
-                                                            rocblas_int                  n,
-                                                            const rocblas_float_complex* alpha,
-                                                            const rocblas_float_complex* a,
-                                                            rocblas_int                  lda,
-                                                            rocblas_stride               stride_a,
-                                                            rocblas_float_complex*       c,
-                                                            rocblas_int                  ldc,
-                                                            rocblas_stride               stride_c,
-                                                            rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status
+    rocblas_ctrmm_outofplace_strided_batched(rocblas_handle               handle,
+                                             rocblas_side                 side,
+                                             rocblas_fill                 uplo,
+                                             rocblas_operation            transA,
+                                             rocblas_diagonal             diag,
+                                             rocblas_int                  m,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* A,
+                                             rocblas_int                  lda,
+                                             rocblas_stride               stride_A,
+                                             const rocblas_float_complex* B,
+                                             rocblas_int                  ldb,
+                                             rocblas_stride               stride_B,
+                                             rocblas_float_complex*       C,
+                                             rocblas_int                  ldc,
+                                             rocblas_stride               stride_C,
+                                             rocblas_int                  batch_count);
 
 /*! \brief BLAS Level 3 API
 
     \details
 
-    trmm_strided_batched performs one of the strided_batched matrix-matrix operations
+    trmm_outofplace_strided_batched performs one of the strided_batched matrix-matrix operations
 
-    B_i := alpha*op( A_i )*B_i,   or   B_i := alpha*B_i*op( A_i )  for i = 0, 1, ... batch_count -1
+    C_i := alpha*op( A_i )*B_i,   or   C_i := alpha*B_i*op( A_i )  for i = 0, 1, ... batch_count -1
 
-    where  alpha  is a scalar,  B_i  is an m by n matrix,  A_i  is a unit, or
+    where  alpha  is a scalar,  B_i  and  C_i  are m by n matrices,  A_i  is a unit, or
     non-unit,  upper or lower triangular matrix  and  op( A_i )  is one  of
 
         op( A_i ) = A_i   or   op( A_i ) = A_i^T   or   op( A_i ) = A_i^H.
 
+    See trmm_outofplace. C_i must not overlap A_i or B_i, except that C may be B with
+    ldc == ldb and stride_C == stride_B, which computes trmm_strided_batched in place.
+
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
@@ -12704,12 +14684,12 @@ ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_strided_batched(rocblas_handle
     @param[in]
     side    [rocblas_side]
             Specifies whether op(A_i) multiplies B_i from the left or right as follows:
-            rocblas_side_left:       B_i := alpha*op( A_i )*B_i.
-            rocblas_side_right:      B_i := alpha*B_i*op( A_i ).
+            rocblas_side_left:       C_i := alpha*op( A_i )*B_i.
+            rocblas_side_right:      C_i := alpha*B_i*op( A_i ).
 
     @param[in]
     uplo    [rocblas_fill]
-            Specifies whether the matrix A is an uppoer or lower triangular matrix as follows:
+            Specifies whether the matrix A is an upper or lower triangular matrix as follows:
             rocblas_fill_upper:  A is an upper triangular matrix.
             rocblas_fill_lower:  A is a  lower triangular matrix.
 
@@ -12728,17 +14708,16 @@ ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_strided_batched(rocblas_handle
 
     @param[in]
     m       [rocblas_int]
-            m specifies the number of rows of B_i. m >= 0.
+            m specifies the number of rows of B_i and C_i. m >= 0.
 
     @param[in]
     n       [rocblas_int]
-            n specifies the number of columns of B_i. n >= 0.
+            n specifies the number of columns of B_i and C_i. n >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A_i is not referenced and B_i need not be set before
-            entry.
+            zero then A_i and B_i are not referenced and C_i is set to zero.
 
     @param[in]
     A       Device pointer to the first matrix A_0 on the GPU.
@@ -12771,36 +14750,49 @@ ROCBLAS_EXPORT rocblas_status rocblas_ctrmm_strided_batched(rocblas_handle
 
     @param[in]
     B       Device pointer to the first matrix B_0 on the GPU.
-            On entry,  the leading  m by n part of the array  B_i must
-           contain the matrix  B_i,  and  on exit  is overwritten  by the
-           transformed matrix.
 
     @param[in]
-    ldb    [rocblas_int]
-           ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
+    ldb     [rocblas_int]
+            ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
 
-           @param[in]
+    @param[in]
     stride_B  [rocblas_stride]
               stride from the start of one matrix (B_i) and the next one (B_i+1)
+
+    @param[out]
+    C       Device pointer to the first matrix C_0 on the GPU.
+
+    @param[in]
+    ldc     [rocblas_int]
+            ldc specifies the first dimension of C_i. ldc >= max( 1, m ).
+
+    @param[in]
+    stride_C  [rocblas_stride]
+              stride from the start of one matrix (C_i) and the next one (C_i+1)
+
     @param[in]
     batch_count [rocblas_int]
                 number of instances i in the batch.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_ztrmm_strided_batched(rocblas_handle                handle,
-                                                            rocblas_side                  side,
-                                                            rocblas_fill                  uplo,
-                                                            rocblas_operation             transa,
-                                                            rocblas_diagonal              diag,
-                                                            rocblas_int                   m,
-                                                            rocblas_int                   n,
-                                                            const rocblas_double_complex* alpha,
-                                                            const rocblas_double_complex* a,
-                                                            rocblas_int                   lda,
-                                                            rocblas_stride                stride_a,
-                                                            rocblas_double_complex*       c,
-                                                            rocblas_int                   ldc,
-                                                            rocblas_stride                stride_c,
-                                                            rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status
+    rocblas_ztrmm_outofplace_strided_batched(rocblas_handle                handle,
+                                             rocblas_side                  side,
+                                             rocblas_fill                  uplo,
+                                             rocblas_operation             transA,
+                                             rocblas_diagonal              diag,
+                                             rocblas_int                   m,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* A,
+                                             rocblas_int                   lda,
+                                             rocblas_stride                stride_A,
+                                             const rocblas_double_complex* B,
+                                             rocblas_int                   ldb,
+                                             rocblas_stride                stride_B,
+                                             rocblas_double_complex*       C,
+                                             rocblas_int                   ldc,
+                                             rocblas_stride                stride_C,
+                                             rocblas_int                   batch_count);
 
 ROCBLAS_EXPORT rocblas_status rocblas_strtri(rocblas_handle   handle,
                                              rocblas_fill     uplo,
@@ -13942,6 +15934,151 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemm_strided_batched(rocblas_handle
                                                             rocblas_stride                stride_c,
                                                             rocblas_int batch_count);
 
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_grouped(rocblas_handle       handle,
+                                                    rocblas_pointer_mode array_mode,
+                                                    rocblas_operation    transA,
+                                                    rocblas_operation    transB,
+                                                    const rocblas_int*   m,
+                                                    const rocblas_int*   n,
+                                                    const rocblas_int*   k,
+                                                    const float*         alpha,
+                                                    const float* const   A[],
+                                                    const rocblas_int*   lda,
+                                                    const float* const   B[],
+                                                    const rocblas_int*   ldb,
+                                                    const float*         beta,
+                                                    float* const         C[],
+                                                    const rocblas_int*   ldc,
+                                                    rocblas_int          group_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_grouped(rocblas_handle       handle,
+                                                    rocblas_pointer_mode array_mode,
+                                                    rocblas_operation    transA,
+                                                    rocblas_operation    transB,
+                                                    const rocblas_int*   m,
+                                                    const rocblas_int*   n,
+                                                    const rocblas_int*   k,
+                                                    const double*        alpha,
+                                                    const double* const  A[],
+                                                    const rocblas_int*   lda,
+                                                    const double* const  B[],
+                                                    const rocblas_int*   ldb,
+                                                    const double*        beta,
+                                                    double* const        C[],
+                                                    const rocblas_int*   ldc,
+                                                    rocblas_int          group_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_grouped(rocblas_handle                     handle,
+                                                    rocblas_pointer_mode               array_mode,
+                                                    rocblas_operation                  transA,
+                                                    rocblas_operation                  transB,
+                                                    const rocblas_int*                 m,
+                                                    const rocblas_int*                 n,
+                                                    const rocblas_int*                 k,
+                                                    const rocblas_float_complex*       alpha,
+                                                    const rocblas_float_complex* const A[],
+                                                    const rocblas_int*                 lda,
+                                                    const rocblas_float_complex* const B[],
+                                                    const rocblas_int*                 ldb,
+                                                    const rocblas_float_complex*       beta,
+                                                    rocblas_float_complex* const       C[],
+                                                    const rocblas_int*                 ldc,
+                                                    rocblas_int                        group_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xGEMM_GROUPED performs the matrix-matrix operations
+
+        C_p = alpha*op( A_p )*op( B_p ) + beta*C_p, for p = 1, ..., group_count,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    and every problem has its own sizes, with op( A_p ) an m_p by k_p matrix, op( B_p ) a k_p by
+    n_p matrix and C_p an m_p by n_p matrix. alpha and beta are scalars shared by all the problems.
+
+    Unlike xGEMM_BATCHED, the problems may have different sizes and leading dimensions, e.g. the
+    different numbers of tokens routed to each expert of a mixture-of-experts layer. The tiles of
+    C of all the problems are balanced across the compute units by a single persistent launch.
+
+    The sizes, leading dimensions and pointers of the problems are read from arrays in host or
+    device memory, as given by array_mode:
+
+    - rocblas_pointer_mode_host: the arrays are checked like the arguments of xGEMM, and the
+      problems large enough to fill the device on their own are computed one after the other by
+      the gemm backend, the others by the grouped launch after a copy of their arrays to the
+      device.
+    - rocblas_pointer_mode_device: the arrays can be produced by a previous kernel without a copy
+      to the host. Since the sizes are not known on the host, a problem with m_p < 0, n_p < 0,
+      k_p < 0, or a leading dimension smaller than the rows of its matrix, is not reported as an
+      error but skipped, and its C_p is unchanged.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    array_mode
+              [rocblas_pointer_mode]
+              whether m, n, k, A, lda, B, ldb, C and ldc are host or device arrays. The pointers
+              they hold always point to device memory. alpha and beta follow the pointer mode of
+              the handle.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A_p ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B_p ).
+    @param[in]
+    m         array of group_count rocblas_int, the number of rows of each op( A_p ) and C_p.
+    @param[in]
+    n         array of group_count rocblas_int, the number of columns of each op( B_p ) and C_p.
+    @param[in]
+    k         array of group_count rocblas_int, the number of columns of each op( A_p ) and
+              rows of each op( B_p ).
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         array of group_count device pointers storing each matrix A_p.
+    @param[in]
+    lda       array of group_count rocblas_int, the leading dimension of each A_p.
+    @param[in]
+    B         array of group_count device pointers storing each matrix B_p.
+    @param[in]
+    ldb       array of group_count rocblas_int, the leading dimension of each B_p.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         array of group_count device pointers storing each matrix C_p.
+              The matrices C_p must not overlap.
+    @param[in]
+    ldc       array of group_count rocblas_int, the leading dimension of each C_p.
+    @param[in]
+    group_count
+              [rocblas_int]
+              number of problems in the group.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_grouped(rocblas_handle                      handle,
+                                                    rocblas_pointer_mode                array_mode,
+                                                    rocblas_operation                   transA,
+                                                    rocblas_operation                   transB,
+                                                    const rocblas_int*                  m,
+                                                    const rocblas_int*                  n,
+                                                    const rocblas_int*                  k,
+                                                    const rocblas_double_complex*       alpha,
+                                                    const rocblas_double_complex* const A[],
+                                                    const rocblas_int*                  lda,
+                                                    const rocblas_double_complex* const B[],
+                                                    const rocblas_int*                  ldb,
+                                                    const rocblas_double_complex*       beta,
+                                                    rocblas_double_complex* const       C[],
+                                                    const rocblas_int*                  ldc,
+                                                    rocblas_int group_count);
+
 ROCBLAS_EXPORT rocblas_status rocblas_sdgmm(rocblas_handle handle,
                                             rocblas_side   side,
                                             rocblas_int    m,
@@ -14880,6 +17017,53 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex(rocblas_handle    handle,
                         flags)
 // clang-format on
 
+/*! \brief BLAS EX API
+
+    \details
+    GEMM_EX_EPILOGUE performs the matrix-matrix operation of rocblas_gemm_ex, followed by the
+    element-wise operations of epilogue on D
+
+        D = saturate(activation(scale .* D + bias)),
+
+    where scale and bias are vectors indexed by the row or by the column of D, in a single pass
+    over D, instead of one pass per operation. The epilogue is supported for the real floating
+    point d_type, and rocblas_status_not_implemented is returned for the other types unless
+    epilogue does nothing.
+
+    The arguments are the ones of rocblas_gemm_ex, followed by
+
+    @param[in]
+    epilogue  [rocblas_gemm_epilogue]
+              the operations applied to D, created with rocblas_create_gemm_epilogue, or nullptr
+              for none. Its bias and scale vectors are device arrays of compute_type.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_epilogue(rocblas_handle        handle,
+                                                       rocblas_operation     transA,
+                                                       rocblas_operation     transB,
+                                                       rocblas_int           m,
+                                                       rocblas_int           n,
+                                                       rocblas_int           k,
+                                                       const void*           alpha,
+                                                       const void*           a,
+                                                       rocblas_datatype      a_type,
+                                                       rocblas_int           lda,
+                                                       const void*           b,
+                                                       rocblas_datatype      b_type,
+                                                       rocblas_int           ldb,
+                                                       const void*           beta,
+                                                       const void*           c,
+                                                       rocblas_datatype      c_type,
+                                                       rocblas_int           ldc,
+                                                       void*                 d,
+                                                       rocblas_datatype      d_type,
+                                                       rocblas_int           ldd,
+                                                       rocblas_datatype      compute_type,
+                                                       rocblas_gemm_algo     algo,
+                                                       int32_t               solution_index,
+                                                       uint32_t              flags,
+                                                       rocblas_gemm_epilogue epilogue);
+
 /*! \brief BLAS EX API
     \details
     GEMM_BATCHED_EX performs one of the batched matrix-matrix operations
@@ -15476,6 +17660,55 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_ext2(rocblas_handle    handle,
                                                 int32_t           solution_index,
                                                 uint32_t          flags);
 
+/*! \brief BLAS EX API
+
+    \details
+    GEMM_EXT2_EPILOGUE performs the matrix-matrix operation of rocblas_gemm_ext2, followed by the
+    element-wise operations of epilogue on D
+
+        D = saturate(activation(scale .* D + bias)),
+
+    where scale and bias are vectors indexed by the row or by the column of D, in a single pass
+    over D, instead of one pass per operation. The epilogue is supported for the real floating
+    point d_type, and rocblas_status_not_implemented is returned for the other types unless
+    epilogue does nothing.
+
+    The arguments are the ones of rocblas_gemm_ext2, followed by
+
+    @param[in]
+    epilogue  [rocblas_gemm_epilogue]
+              the operations applied to D, created with rocblas_create_gemm_epilogue, or nullptr
+              for none. Its bias and scale vectors are device arrays of compute_type.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ext2_epilogue(rocblas_handle        handle,
+                                                         rocblas_int           m,
+                                                         rocblas_int           n,
+                                                         rocblas_int           k,
+                                                         const void*           alpha,
+                                                         const void*           a,
+                                                         rocblas_datatype      a_type,
+                                                         rocblas_stride        row_stride_a,
+                                                         rocblas_stride        col_stride_a,
+                                                         const void*           b,
+                                                         rocblas_datatype      b_type,
+                                                         rocblas_stride        row_stride_b,
+                                                         rocblas_stride        col_stride_b,
+                                                         const void*           beta,
+                                                         const void*           c,
+                                                         rocblas_datatype      c_type,
+                                                         rocblas_stride        row_stride_c,
+                                                         rocblas_stride        col_stride_c,
+                                                         void*                 d,
+                                                         rocblas_datatype      d_type,
+                                                         rocblas_stride        row_stride_d,
+                                                         rocblas_stride        col_stride_d,
+                                                         rocblas_datatype      compute_type,
+                                                         rocblas_gemm_algo     algo,
+                                                         int32_t               solution_index,
+                                                         uint32_t              flags,
+                                                         rocblas_gemm_epilogue epilogue);
+
 /*! BLAS EX API
 
     \details
@@ -40,6 +40,19 @@
  */
 typedef struct _rocblas_handle* rocblas_handle;
 
+/*! \brief rocblas_rank_update buffers rank-1 and rank-2 updates of a matrix,
+ * see rocblas_sger_deferred. It must be initialized using rocblas_create_rank_update()
+ * and destroyed using rocblas_destroy_rank_update().
+ */
+typedef struct _rocblas_rank_update* rocblas_rank_update;
+
+/*! \brief rocblas_gemm_epilogue describes the bias, scaling, activation and saturation applied
+ * to the result of rocblas_gemm_ex_epilogue and rocblas_gemm_ext2_epilogue. It must be
+ * initialized using rocblas_create_gemm_epilogue() and destroyed using
+ * rocblas_destroy_gemm_epilogue().
+ */
+typedef struct _rocblas_gemm_epilogue* rocblas_gemm_epilogue;
+
 // Forward declaration of hipStream_t
 typedef struct ihipStream_t* hipStream_t;
 
@@ -211,6 +224,39 @@ typedef enum rocblas_atomics_mode_
     rocblas_atomics_allowed = 1,
 } rocblas_atomics_mode;
 
+/*! \brief Indicates if reductions must produce bitwise reproducible results. Reproducible
+*    reductions sum in a fixed order which does not depend on the launch configuration or
+*    batch_count, at a cost of performance */
+typedef enum rocblas_reduction_mode_
+{
+    /*! \brief Reductions use the fastest available summation order */
+    rocblas_reduction_default = 0,
+    /*! \brief Reductions use a fixed-order pairwise tree and are bitwise reproducible */
+    rocblas_reduction_reproducible = 1,
+} rocblas_reduction_mode;
+
+/*! \brief Indicates how sums are accumulated by the dot, asum and nrm2 reductions. Compensated
+*    summation carries the rounding error of every addition alongside the sum, so the error no
+*    longer grows with n, at a cost of performance */
+typedef enum rocblas_accuracy_mode_
+{
+    /*! \brief Reductions accumulate in the computation type */
+    rocblas_accuracy_default = 0,
+    /*! \brief Reductions accumulate (sum, compensation) pairs with error-free additions */
+    rocblas_accuracy_compensated = 1,
+} rocblas_accuracy_mode;
+
+/*! \brief Indicates how spmv, hpmv, tpmv and tpsv read the packed matrix AP. Unpacking copies AP
+*    into n x n full storage in the device memory of the handle on every call, and then runs
+*    symv, hemv, trmv or trsv on the copy, whose columns are read with coalesced accesses */
+typedef enum rocblas_packed_mode_
+{
+    /*! \brief Packed routines index the packed triangle directly */
+    rocblas_packed_default = 0,
+    /*! \brief Packed routines unpack AP into workspace and run the full storage kernels */
+    rocblas_packed_unpack = 1,
+} rocblas_packed_mode;
+
 /*! \brief Indicates which performance metric Tensile uses when selecting the optimal
 *    solution for gemm problems.  */
 typedef enum rocblas_performance_metric_
@@ -257,6 +303,26 @@ typedef enum rocblas_gemm_flags_
     rocblas_gemm_flags_use_cu_efficiency = 0x2
 } rocblas_gemm_flags;
 
+/*! \brief Activation function applied by a rocblas_gemm_epilogue */
+typedef enum rocblas_activation_
+{
+    /*! \brief No activation */
+    rocblas_activation_none = 0,
+    /*! \brief max(x, 0) */
+    rocblas_activation_relu = 1,
+    /*! \brief 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))) */
+    rocblas_activation_gelu = 2,
+} rocblas_activation;
+
+/*! \brief Indexing of the bias and scale vectors of a rocblas_gemm_epilogue */
+typedef enum rocblas_epilogue_vector_
+{
+    /*! \brief One element per row of D, m elements */
+    rocblas_epilogue_vector_per_row = 0,
+    /*! \brief One element per column of D, n elements */
+    rocblas_epilogue_vector_per_column = 1,
+} rocblas_epilogue_vector;
+
 /*! \brief Union for representing scalar values */
 typedef union rocblas_union_u
 {
@@ -285,6 +351,81 @@ typedef enum rocblas_check_numerics_mode_
     //Return 'rocblas_status_check_numeric_fail' status if there is NaN or Inf
     rocblas_check_numerics_mode_fail = 0x4,
 
+    //Record magnitude range, denormal count and exponent histogram, aggregated per function
+    rocblas_check_numerics_mode_stats = 0x8,
+
+    //Do not synchronize; NaN or Inf are reported later by 'rocblas_check_numerics_poll'
+    rocblas_check_numerics_mode_deferred = 0x10,
+
 } rocblas_check_numerics_mode;
 
+/*! \brief Number of bins in the exponent histogram of rocblas_check_numerics_stats */
+#define ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS 320
+
+/*! \brief Binary exponent counted in bin 0 of the exponent histogram of rocblas_check_numerics_stats */
+#define ROCBLAS_CHECK_NUMERICS_EXPONENT_MIN (-160)
+
+/*****************************************************************************************************************************************
+* \brief Statistics gathered by rocblas_check_numerics_mode_stats for the Input or Output vectors/matrices of one rocBLAS function.
+*        Statistics are aggregated across all calls made with the same handle. Complex values are counted per real and imaginary part.
+******************************************************************************************************************************************/
+typedef struct rocblas_check_numerics_stats_
+{
+    /*! \brief Number of checked calls which contributed to these statistics */
+    uint64_t num_calls;
+
+    /*! \brief Number of real values checked */
+    uint64_t num_elements;
+
+    /*! \brief Number of zeros */
+    uint64_t num_zero;
+
+    /*! \brief Number of denormal (subnormal) values for the data type of the operand */
+    uint64_t num_denormal;
+
+    /*! \brief Number of NaNs */
+    uint64_t num_NaN;
+
+    /*! \brief Number of infinities */
+    uint64_t num_Inf;
+
+    /*! \brief Smallest magnitude of the finite, nonzero values, or 0 if there are none */
+    double min_magnitude;
+
+    /*! \brief Largest magnitude of the finite values */
+    double max_magnitude;
+
+    /*! \brief exponent_histogram[i] counts the finite, nonzero values x with ilogb(|x|) == i + ROCBLAS_CHECK_NUMERICS_EXPONENT_MIN.
+     *  The first and the last bins also count the exponents below and above the range of the histogram */
+    uint64_t exponent_histogram[ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS];
+} rocblas_check_numerics_stats;
+
+/*****************************************************************************************************************************************
+* \brief First NaN or Inf found by rocblas_check_numerics_mode_deferred since the previous call to rocblas_check_numerics_poll.
+******************************************************************************************************************************************/
+typedef struct rocblas_check_numerics_report_
+{
+    /*! \brief Name of the rocBLAS function which had a NaN or an Inf, or NULL if none was found.
+     *  The string remains valid for the lifetime of the handle */
+    const char* function_name;
+
+    /*! \brief true if the offending vector/matrix is an Input, false if it is an Output */
+    bool is_input;
+
+    /*! \brief true if the offending element is a NaN */
+    bool has_NaN;
+
+    /*! \brief true if the offending element is an Infinity */
+    bool has_Inf;
+
+    /*! \brief Device pointer of the offending vector/matrix, as passed to the function (the array of pointers for batched functions) */
+    const void* operand;
+
+    /*! \brief Batch instance containing the offending element */
+    rocblas_int batch_index;
+
+    /*! \brief Offset in elements of the offending element from the start of its vector/matrix */
+    int64_t element_index;
+} rocblas_check_numerics_report;
+
 #endif
@@ -94,6 +94,17 @@ module rocblas_enums
         enumerator :: rocblas_gemm_algo_standard = 0
     end enum
 
+    enum, bind(c)
+        enumerator :: rocblas_activation_none = 0
+        enumerator :: rocblas_activation_relu = 1
+        enumerator :: rocblas_activation_gelu = 2
+    end enum
+
+    enum, bind(c)
+        enumerator :: rocblas_epilogue_vector_per_row = 0
+        enumerator :: rocblas_epilogue_vector_per_column = 1
+    end enum
+
 end module rocblas_enums
 
 module rocblas
@@ -317,6 +328,156 @@ module rocblas
         end function rocblas_set_start_stop_events
     end interface
 
+    interface
+        function rocblas_create_rank_update(update, k) &
+                result(c_int) &
+                bind(c, name = 'rocblas_create_rank_update')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: update
+            integer(c_int), value :: k
+        end function rocblas_create_rank_update
+    end interface
+
+    interface
+        function rocblas_destroy_rank_update(update) &
+                result(c_int) &
+                bind(c, name = 'rocblas_destroy_rank_update')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: update
+        end function rocblas_destroy_rank_update
+    end interface
+
+    interface
+        function rocblas_rank_update_flush(handle, update) &
+                result(c_int) &
+                bind(c, name = 'rocblas_rank_update_flush')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+        end function rocblas_rank_update_flush
+    end interface
+
+    interface
+        function rocblas_create_gemm_epilogue(epilogue) &
+                result(c_int) &
+                bind(c, name = 'rocblas_create_gemm_epilogue')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: epilogue
+        end function rocblas_create_gemm_epilogue
+    end interface
+
+    interface
+        function rocblas_destroy_gemm_epilogue(epilogue) &
+                result(c_int) &
+                bind(c, name = 'rocblas_destroy_gemm_epilogue')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: epilogue
+        end function rocblas_destroy_gemm_epilogue
+    end interface
+
+    interface
+        function rocblas_gemm_epilogue_set_bias(epilogue, bias, vector) &
+                result(c_int) &
+                bind(c, name = 'rocblas_gemm_epilogue_set_bias')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: epilogue
+            type(c_ptr), value :: bias
+            integer(kind(rocblas_epilogue_vector_per_row)), value :: vector
+        end function rocblas_gemm_epilogue_set_bias
+    end interface
+
+    interface
+        function rocblas_gemm_epilogue_set_scale(epilogue, scale, vector) &
+                result(c_int) &
+                bind(c, name = 'rocblas_gemm_epilogue_set_scale')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: epilogue
+            type(c_ptr), value :: scale
+            integer(kind(rocblas_epilogue_vector_per_row)), value :: vector
+        end function rocblas_gemm_epilogue_set_scale
+    end interface
+
+    interface
+        function rocblas_gemm_epilogue_set_activation(epilogue, activation) &
+                result(c_int) &
+                bind(c, name = 'rocblas_gemm_epilogue_set_activation')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: epilogue
+            integer(kind(rocblas_activation_none)), value :: activation
+        end function rocblas_gemm_epilogue_set_activation
+    end interface
+
+    interface
+        function rocblas_gemm_epilogue_set_saturation(epilogue, saturate) &
+                result(c_int) &
+                bind(c, name = 'rocblas_gemm_epilogue_set_saturation')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: epilogue
+            logical(c_bool), value :: saturate
+        end function rocblas_gemm_epilogue_set_saturation
+    end interface
+
+    interface
+        function rocblas_gemm_epilogue_set_dequantization(epilogue, row_scale, column_scale, &
+                row_offset, column_offset) &
+                result(c_int) &
+                bind(c, name = 'rocblas_gemm_epilogue_set_dequantization')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: epilogue
+            type(c_ptr), value :: row_scale
+            type(c_ptr), value :: column_scale
+            type(c_ptr), value :: row_offset
+            type(c_ptr), value :: column_offset
+        end function rocblas_gemm_epilogue_set_dequantization
+    end interface
+
+    interface
+        function rocblas_unpack(handle, uplo, n, elem_size, AP, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_unpack')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: elem_size
+            type(c_ptr), value :: AP
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_unpack
+    end interface
+
+    interface
+        function rocblas_pack(handle, uplo, n, elem_size, A, lda, AP) &
+                result(c_int) &
+                bind(c, name = 'rocblas_pack')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: elem_size
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: AP
+        end function rocblas_pack
+    end interface
+
     !!!!!!!!!!!!!!!!!!!!!!!
     ! rocblas-functions.h !
     !!!!!!!!!!!!!!!!!!!!!!!
@@ -3156,804 +3317,2100 @@ module rocblas
         end function rocblas_drotmg_strided_batched
     end interface
 
-    !--------!
-    ! blas 2 !
-    !--------!
-
-    ! gbmv
+    ! dot_nrm2
     interface
-        function rocblas_sgbmv(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy) &
+        function rocblas_sdot_nrm2(handle, n, x, incx, y, incy, dot_result, nrm2_result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_sgbmv')
+                bind(c, name = 'rocblas_sdot_nrm2')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_sgbmv
+            type(c_ptr), value :: dot_result
+            type(c_ptr), value :: nrm2_result
+        end function rocblas_sdot_nrm2
     end interface
 
     interface
-        function rocblas_dgbmv(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy) &
+        function rocblas_ddot_nrm2(handle, n, x, incx, y, incy, dot_result, nrm2_result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dgbmv')
+                bind(c, name = 'rocblas_ddot_nrm2')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_dgbmv
+            type(c_ptr), value :: dot_result
+            type(c_ptr), value :: nrm2_result
+        end function rocblas_ddot_nrm2
     end interface
 
     interface
-        function rocblas_cgbmv(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy) &
+        function rocblas_cdotc_nrm2(handle, n, x, incx, y, incy, dot_result, nrm2_result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cgbmv')
+                bind(c, name = 'rocblas_cdotc_nrm2')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_cgbmv
+            type(c_ptr), value :: dot_result
+            type(c_ptr), value :: nrm2_result
+        end function rocblas_cdotc_nrm2
     end interface
 
     interface
-        function rocblas_zgbmv(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy) &
+        function rocblas_zdotc_nrm2(handle, n, x, incx, y, incy, dot_result, nrm2_result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zgbmv')
+                bind(c, name = 'rocblas_zdotc_nrm2')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_zgbmv
+            type(c_ptr), value :: dot_result
+            type(c_ptr), value :: nrm2_result
+        end function rocblas_zdotc_nrm2
     end interface
 
-    ! gbmv_batched
+    ! dot_nrm2_batched
     interface
-        function rocblas_sgbmv_batched(handle, trans, m, n, kl, ku, alpha, A, lda, &
-                x, incx, beta, y, incy, batch_count) &
+        function rocblas_sdot_nrm2_batched(handle, n, x, incx, y, incy, batch_count, dot_results, &
+             nrm2_results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_sgbmv_batched')
+                bind(c, name = 'rocblas_sdot_nrm2_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
             integer(c_int), value :: batch_count
-        end function rocblas_sgbmv_batched
+            type(c_ptr), value :: dot_results
+            type(c_ptr), value :: nrm2_results
+        end function rocblas_sdot_nrm2_batched
     end interface
 
     interface
-        function rocblas_dgbmv_batched(handle, trans, m, n, kl, ku, alpha, A, lda, &
-                x, incx, beta, y, incy, batch_count) &
+        function rocblas_ddot_nrm2_batched(handle, n, x, incx, y, incy, batch_count, dot_results, &
+             nrm2_results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dgbmv_batched')
+                bind(c, name = 'rocblas_ddot_nrm2_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
             integer(c_int), value :: batch_count
-        end function rocblas_dgbmv_batched
+            type(c_ptr), value :: dot_results
+            type(c_ptr), value :: nrm2_results
+        end function rocblas_ddot_nrm2_batched
     end interface
 
     interface
-        function rocblas_cgbmv_batched(handle, trans, m, n, kl, ku, alpha, A, lda, &
-                x, incx, beta, y, incy, batch_count) &
+        function rocblas_cdotc_nrm2_batched(handle, n, x, incx, y, incy, batch_count, dot_results, &
+             nrm2_results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cgbmv_batched')
+                bind(c, name = 'rocblas_cdotc_nrm2_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
             integer(c_int), value :: batch_count
-        end function rocblas_cgbmv_batched
+            type(c_ptr), value :: dot_results
+            type(c_ptr), value :: nrm2_results
+        end function rocblas_cdotc_nrm2_batched
     end interface
 
     interface
-        function rocblas_zgbmv_batched(handle, trans, m, n, kl, ku, alpha, A, lda, &
-                x, incx, beta, y, incy, batch_count) &
+        function rocblas_zdotc_nrm2_batched(handle, n, x, incx, y, incy, batch_count, dot_results, &
+             nrm2_results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zgbmv_batched')
+                bind(c, name = 'rocblas_zdotc_nrm2_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
             integer(c_int), value :: batch_count
-        end function rocblas_zgbmv_batched
+            type(c_ptr), value :: dot_results
+            type(c_ptr), value :: nrm2_results
+        end function rocblas_zdotc_nrm2_batched
     end interface
 
-    ! gbmv_strided_batched
+    ! dot_nrm2_strided_batched
     interface
-        function rocblas_sgbmv_strided_batched(handle, trans, m, n, kl, ku, alpha, A, lda, stride_A, &
-                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+        function rocblas_sdot_nrm2_strided_batched(handle, n, x, incx, stridex, y, incy, stridey, &
+             batch_count, dot_results, nrm2_results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_sgbmv_strided_batched')
+                bind(c, name = 'rocblas_sdot_nrm2_strided_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stridex
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
+            integer(c_int64_t), value :: stridey
             integer(c_int), value :: batch_count
-        end function rocblas_sgbmv_strided_batched
+            type(c_ptr), value :: dot_results
+            type(c_ptr), value :: nrm2_results
+        end function rocblas_sdot_nrm2_strided_batched
     end interface
 
     interface
-        function rocblas_dgbmv_strided_batched(handle, trans, m, n, kl, ku, alpha, A, lda, stride_A, &
-                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+        function rocblas_ddot_nrm2_strided_batched(handle, n, x, incx, stridex, y, incy, stridey, &
+             batch_count, dot_results, nrm2_results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dgbmv_strided_batched')
+                bind(c, name = 'rocblas_ddot_nrm2_strided_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stridex
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
+            integer(c_int64_t), value :: stridey
             integer(c_int), value :: batch_count
-        end function rocblas_dgbmv_strided_batched
+            type(c_ptr), value :: dot_results
+            type(c_ptr), value :: nrm2_results
+        end function rocblas_ddot_nrm2_strided_batched
     end interface
 
     interface
-        function rocblas_cgbmv_strided_batched(handle, trans, m, n, kl, ku, alpha, A, lda, stride_A, &
-                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+        function rocblas_cdotc_nrm2_strided_batched(handle, n, x, incx, stridex, y, incy, stridey, &
+             batch_count, dot_results, nrm2_results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cgbmv_strided_batched')
+                bind(c, name = 'rocblas_cdotc_nrm2_strided_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stridex
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
+            integer(c_int64_t), value :: stridey
             integer(c_int), value :: batch_count
-        end function rocblas_cgbmv_strided_batched
+            type(c_ptr), value :: dot_results
+            type(c_ptr), value :: nrm2_results
+        end function rocblas_cdotc_nrm2_strided_batched
     end interface
 
     interface
-        function rocblas_zgbmv_strided_batched(handle, trans, m, n, kl, ku, alpha, A, lda, stride_A, &
-                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+        function rocblas_zdotc_nrm2_strided_batched(handle, n, x, incx, stridex, y, incy, stridey, &
+             batch_count, dot_results, nrm2_results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zgbmv_strided_batched')
+                bind(c, name = 'rocblas_zdotc_nrm2_strided_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kl
-            integer(c_int), value :: ku
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stridex
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
+            integer(c_int64_t), value :: stridey
             integer(c_int), value :: batch_count
-        end function rocblas_zgbmv_strided_batched
+            type(c_ptr), value :: dot_results
+            type(c_ptr), value :: nrm2_results
+        end function rocblas_zdotc_nrm2_strided_batched
     end interface
 
-    ! gemv
+    ! axpy_dot
     interface
-        function rocblas_sgemv(handle, trans, m, n, alpha, A, lda, &
-                x, incx, beta, y, incy) &
+        function rocblas_saxpy_dot(handle, n, alpha, x, incx, y, incy, z, incz, result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_sgemv')
+                bind(c, name = 'rocblas_saxpy_dot')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_sgemv
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
+            type(c_ptr), value :: result
+        end function rocblas_saxpy_dot
     end interface
 
     interface
-        function rocblas_dgemv(handle, trans, m, n, alpha, A, lda, &
-                x, incx, beta, y, incy) &
+        function rocblas_daxpy_dot(handle, n, alpha, x, incx, y, incy, z, incz, result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dgemv')
+                bind(c, name = 'rocblas_daxpy_dot')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_dgemv
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
+            type(c_ptr), value :: result
+        end function rocblas_daxpy_dot
     end interface
 
     interface
-        function rocblas_cgemv(handle, trans, m, n, alpha, A, lda, &
-                x, incx, beta, y, incy) &
+        function rocblas_caxpy_dotc(handle, n, alpha, x, incx, y, incy, z, incz, result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cgemv')
+                bind(c, name = 'rocblas_caxpy_dotc')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_cgemv
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
+            type(c_ptr), value :: result
+        end function rocblas_caxpy_dotc
     end interface
 
     interface
-        function rocblas_zgemv(handle, trans, m, n, alpha, A, lda, &
-                x, incx, beta, y, incy) &
+        function rocblas_zaxpy_dotc(handle, n, alpha, x, incx, y, incy, z, incz, result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zgemv')
+                bind(c, name = 'rocblas_zaxpy_dotc')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_zgemv
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
+            type(c_ptr), value :: result
+        end function rocblas_zaxpy_dotc
     end interface
 
-    ! gemv_batched
+    ! axpy_dot_batched
     interface
-        function rocblas_sgemv_batched(handle, trans, m, n, alpha, A, lda, &
-                x, incx, beta, y, incy, batch_count) &
+        function rocblas_saxpy_dot_batched(handle, n, alpha, x, incx, y, incy, z, incz, &
+             batch_count, results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_sgemv_batched')
+                bind(c, name = 'rocblas_saxpy_dot_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
             integer(c_int), value :: batch_count
-        end function rocblas_sgemv_batched
+            type(c_ptr), value :: results
+        end function rocblas_saxpy_dot_batched
     end interface
 
     interface
-        function rocblas_dgemv_batched(handle, trans, m, n, alpha, A, lda, &
-                x, incx, beta, y, incy, batch_count) &
+        function rocblas_daxpy_dot_batched(handle, n, alpha, x, incx, y, incy, z, incz, &
+             batch_count, results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dgemv_batched')
+                bind(c, name = 'rocblas_daxpy_dot_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
             integer(c_int), value :: batch_count
-        end function rocblas_dgemv_batched
+            type(c_ptr), value :: results
+        end function rocblas_daxpy_dot_batched
     end interface
 
     interface
-        function rocblas_cgemv_batched(handle, trans, m, n, alpha, A, lda, &
-                x, incx, beta, y, incy, batch_count) &
+        function rocblas_caxpy_dotc_batched(handle, n, alpha, x, incx, y, incy, z, incz, &
+             batch_count, results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cgemv_batched')
+                bind(c, name = 'rocblas_caxpy_dotc_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
             integer(c_int), value :: batch_count
-        end function rocblas_cgemv_batched
+            type(c_ptr), value :: results
+        end function rocblas_caxpy_dotc_batched
     end interface
 
     interface
-        function rocblas_zgemv_batched(handle, trans, m, n, alpha, A, lda, &
-                x, incx, beta, y, incy, batch_count) &
+        function rocblas_zaxpy_dotc_batched(handle, n, alpha, x, incx, y, incy, z, incz, &
+             batch_count, results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zgemv_batched')
+                bind(c, name = 'rocblas_zaxpy_dotc_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
             integer(c_int), value :: batch_count
-        end function rocblas_zgemv_batched
+            type(c_ptr), value :: results
+        end function rocblas_zaxpy_dotc_batched
     end interface
 
-    ! gemv_strided_batched
+    ! axpy_dot_strided_batched
     interface
-        function rocblas_sgemv_strided_batched(handle, trans, m, n, alpha, A, lda, stride_A, &
-                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+        function rocblas_saxpy_dot_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+             stridey, z, incz, stridez, batch_count, results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_sgemv_strided_batched')
+                bind(c, name = 'rocblas_saxpy_dot_strided_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stridex
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
+            integer(c_int64_t), value :: stridey
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
+            integer(c_int64_t), value :: stridez
             integer(c_int), value :: batch_count
-        end function rocblas_sgemv_strided_batched
+            type(c_ptr), value :: results
+        end function rocblas_saxpy_dot_strided_batched
     end interface
 
     interface
-        function rocblas_dgemv_strided_batched(handle, trans, m, n, alpha, A, lda, stride_A, &
-                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+        function rocblas_daxpy_dot_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+             stridey, z, incz, stridez, batch_count, results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dgemv_strided_batched')
+                bind(c, name = 'rocblas_daxpy_dot_strided_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stridex
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
+            integer(c_int64_t), value :: stridey
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
+            integer(c_int64_t), value :: stridez
             integer(c_int), value :: batch_count
-        end function rocblas_dgemv_strided_batched
+            type(c_ptr), value :: results
+        end function rocblas_daxpy_dot_strided_batched
     end interface
 
     interface
-        function rocblas_cgemv_strided_batched(handle, trans, m, n, alpha, A, lda, stride_A, &
-                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+        function rocblas_caxpy_dotc_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+             stridey, z, incz, stridez, batch_count, results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cgemv_strided_batched')
+                bind(c, name = 'rocblas_caxpy_dotc_strided_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stridex
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
+            integer(c_int64_t), value :: stridey
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
+            integer(c_int64_t), value :: stridez
             integer(c_int), value :: batch_count
-        end function rocblas_cgemv_strided_batched
+            type(c_ptr), value :: results
+        end function rocblas_caxpy_dotc_strided_batched
     end interface
 
     interface
-        function rocblas_zgemv_strided_batched(handle, trans, m, n, alpha, A, lda, stride_A, &
-                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+        function rocblas_zaxpy_dotc_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+             stridey, z, incz, stridez, batch_count, results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zgemv_strided_batched')
+                bind(c, name = 'rocblas_zaxpy_dotc_strided_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_operation_none)), value :: trans
-            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stridex
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
+            integer(c_int64_t), value :: stridey
+            type(c_ptr), value :: z
+            integer(c_int), value :: incz
+            integer(c_int64_t), value :: stridez
             integer(c_int), value :: batch_count
-        end function rocblas_zgemv_strided_batched
+            type(c_ptr), value :: results
+        end function rocblas_zaxpy_dotc_strided_batched
     end interface
 
-    ! hbmv
+    ! axpy_nrm2
     interface
-        function rocblas_chbmv(handle, uplo, n, k, alpha, A, lda, &
-                x, incx, beta, y, incy) &
+        function rocblas_saxpy_nrm2(handle, n, alpha, x, incx, y, incy, result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_chbmv')
+                bind(c, name = 'rocblas_saxpy_nrm2')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_chbmv
+            type(c_ptr), value :: result
+        end function rocblas_saxpy_nrm2
     end interface
 
     interface
-        function rocblas_zhbmv(handle, uplo, n, k, alpha, A, lda, &
-                x, incx, beta, y, incy) &
+        function rocblas_daxpy_nrm2(handle, n, alpha, x, incx, y, incy, result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zhbmv')
+                bind(c, name = 'rocblas_daxpy_nrm2')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_zhbmv
+            type(c_ptr), value :: result
+        end function rocblas_daxpy_nrm2
     end interface
 
-    ! hbmv_batched
     interface
-        function rocblas_chbmv_batched(handle, uplo, n, k, alpha, A, lda, &
-                x, incx, beta, y, incy, batch_count) &
+        function rocblas_caxpy_nrm2(handle, n, alpha, x, incx, y, incy, result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_chbmv_batched')
+                bind(c, name = 'rocblas_caxpy_nrm2')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int), value :: batch_count
-        end function rocblas_chbmv_batched
+            type(c_ptr), value :: result
+        end function rocblas_caxpy_nrm2
     end interface
 
     interface
-        function rocblas_zhbmv_batched(handle, uplo, n, k, alpha, A, lda, &
-                x, incx, beta, y, incy, batch_count) &
+        function rocblas_zaxpy_nrm2(handle, n, alpha, x, incx, y, incy, result) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zhbmv_batched')
+                bind(c, name = 'rocblas_zaxpy_nrm2')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int), value :: batch_count
-        end function rocblas_zhbmv_batched
+            type(c_ptr), value :: result
+        end function rocblas_zaxpy_nrm2
     end interface
 
-    ! hbmv_strided_batched
+    ! axpy_nrm2_batched
     interface
-        function rocblas_chbmv_strided_batched(handle, uplo, n, k, alpha, A, lda, stride_A, &
-                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+        function rocblas_saxpy_nrm2_batched(handle, n, alpha, x, incx, y, incy, batch_count, &
+             results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_chbmv_strided_batched')
+                bind(c, name = 'rocblas_saxpy_nrm2_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
             integer(c_int), value :: batch_count
-        end function rocblas_chbmv_strided_batched
+            type(c_ptr), value :: results
+        end function rocblas_saxpy_nrm2_batched
     end interface
 
     interface
-        function rocblas_zhbmv_strided_batched(handle, uplo, n, k, alpha, A, lda, stride_A, &
-                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+        function rocblas_daxpy_nrm2_batched(handle, n, alpha, x, incx, y, incy, batch_count, &
+             results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zhbmv_strided_batched')
+                bind(c, name = 'rocblas_daxpy_nrm2_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
             integer(c_int), value :: batch_count
-        end function rocblas_zhbmv_strided_batched
+            type(c_ptr), value :: results
+        end function rocblas_daxpy_nrm2_batched
     end interface
 
-    ! hemv
     interface
-        function rocblas_chemv(handle, uplo, n, alpha, A, lda, &
-                x, incx, beta, y, incy) &
+        function rocblas_caxpy_nrm2_batched(handle, n, alpha, x, incx, y, incy, batch_count, &
+             results) &
                 result(c_int) &
-                bind(c, name = 'rocblas_chemv')
+                bind(c, name = 'rocblas_caxpy_nrm2_batched')
             use iso_c_binding
-            use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: beta
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function rocblas_chemv
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: results
+        end function rocblas_caxpy_nrm2_batched
     end interface
 
     interface
-        function rocblas_zhemv(handle, uplo, n, alpha, A, lda, &
+        function rocblas_zaxpy_nrm2_batched(handle, n, alpha, x, incx, y, incy, batch_count, &
+             results) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zaxpy_nrm2_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: results
+        end function rocblas_zaxpy_nrm2_batched
+    end interface
+
+    ! axpy_nrm2_strided_batched
+    interface
+        function rocblas_saxpy_nrm2_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+             stridey, batch_count, results) &
+                result(c_int) &
+                bind(c, name = 'rocblas_saxpy_nrm2_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: results
+        end function rocblas_saxpy_nrm2_strided_batched
+    end interface
+
+    interface
+        function rocblas_daxpy_nrm2_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+             stridey, batch_count, results) &
+                result(c_int) &
+                bind(c, name = 'rocblas_daxpy_nrm2_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: results
+        end function rocblas_daxpy_nrm2_strided_batched
+    end interface
+
+    interface
+        function rocblas_caxpy_nrm2_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+             stridey, batch_count, results) &
+                result(c_int) &
+                bind(c, name = 'rocblas_caxpy_nrm2_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: results
+        end function rocblas_caxpy_nrm2_strided_batched
+    end interface
+
+    interface
+        function rocblas_zaxpy_nrm2_strided_batched(handle, n, alpha, x, incx, stridex, y, incy, &
+             stridey, batch_count, results) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zaxpy_nrm2_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: results
+        end function rocblas_zaxpy_nrm2_strided_batched
+    end interface
+
+    !--------!
+    ! blas 2 !
+    !--------!
+
+    ! gbmv
+    interface
+        function rocblas_sgbmv(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sgbmv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_sgbmv
+    end interface
+
+    interface
+        function rocblas_dgbmv(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dgbmv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_dgbmv
+    end interface
+
+    interface
+        function rocblas_cgbmv(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgbmv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_cgbmv
+    end interface
+
+    interface
+        function rocblas_zgbmv(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgbmv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_zgbmv
+    end interface
+
+    ! gbmv_batched
+    interface
+        function rocblas_sgbmv_batched(handle, trans, m, n, kl, ku, alpha, A, lda, &
+                x, incx, beta, y, incy, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sgbmv_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function rocblas_sgbmv_batched
+    end interface
+
+    interface
+        function rocblas_dgbmv_batched(handle, trans, m, n, kl, ku, alpha, A, lda, &
+                x, incx, beta, y, incy, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dgbmv_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function rocblas_dgbmv_batched
+    end interface
+
+    interface
+        function rocblas_cgbmv_batched(handle, trans, m, n, kl, ku, alpha, A, lda, &
+                x, incx, beta, y, incy, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgbmv_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function rocblas_cgbmv_batched
+    end interface
+
+    interface
+        function rocblas_zgbmv_batched(handle, trans, m, n, kl, ku, alpha, A, lda, &
+                x, incx, beta, y, incy, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgbmv_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function rocblas_zgbmv_batched
+    end interface
+
+    ! gbmv_strided_batched
+    interface
+        function rocblas_sgbmv_strided_batched(handle, trans, m, n, kl, ku, alpha, A, lda, stride_A, &
+                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sgbmv_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocblas_sgbmv_strided_batched
+    end interface
+
+    interface
+        function rocblas_dgbmv_strided_batched(handle, trans, m, n, kl, ku, alpha, A, lda, stride_A, &
+                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dgbmv_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocblas_dgbmv_strided_batched
+    end interface
+
+    interface
+        function rocblas_cgbmv_strided_batched(handle, trans, m, n, kl, ku, alpha, A, lda, stride_A, &
+                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgbmv_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocblas_cgbmv_strided_batched
+    end interface
+
+    interface
+        function rocblas_zgbmv_strided_batched(handle, trans, m, n, kl, ku, alpha, A, lda, stride_A, &
+                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgbmv_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: kl
+            integer(c_int), value :: ku
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocblas_zgbmv_strided_batched
+    end interface
+
+    ! gemv
+    interface
+        function rocblas_sgemv(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sgemv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_sgemv
+    end interface
+
+    interface
+        function rocblas_dgemv(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dgemv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_dgemv
+    end interface
+
+    interface
+        function rocblas_cgemv(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgemv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_cgemv
+    end interface
+
+    interface
+        function rocblas_zgemv(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgemv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_zgemv
+    end interface
+
+    ! gemv_batched
+    interface
+        function rocblas_sgemv_batched(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sgemv_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function rocblas_sgemv_batched
+    end interface
+
+    interface
+        function rocblas_dgemv_batched(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dgemv_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function rocblas_dgemv_batched
+    end interface
+
+    interface
+        function rocblas_cgemv_batched(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgemv_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function rocblas_cgemv_batched
+    end interface
+
+    interface
+        function rocblas_zgemv_batched(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgemv_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function rocblas_zgemv_batched
+    end interface
+
+    ! gemv_strided_batched
+    interface
+        function rocblas_sgemv_strided_batched(handle, trans, m, n, alpha, A, lda, stride_A, &
+                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sgemv_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocblas_sgemv_strided_batched
+    end interface
+
+    interface
+        function rocblas_dgemv_strided_batched(handle, trans, m, n, alpha, A, lda, stride_A, &
+                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dgemv_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocblas_dgemv_strided_batched
+    end interface
+
+    interface
+        function rocblas_cgemv_strided_batched(handle, trans, m, n, alpha, A, lda, stride_A, &
+                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgemv_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocblas_cgemv_strided_batched
+    end interface
+
+    interface
+        function rocblas_zgemv_strided_batched(handle, trans, m, n, alpha, A, lda, stride_A, &
+                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgemv_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocblas_zgemv_strided_batched
+    end interface
+
+    ! gemv_multi
+    interface
+        function rocblas_sgemv_multi(handle, trans, m, n, k, alpha, A, lda, &
+                x, incx, stride_x, beta, y, incy, stride_y) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sgemv_multi')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+        end function rocblas_sgemv_multi
+    end interface
+
+    interface
+        function rocblas_dgemv_multi(handle, trans, m, n, k, alpha, A, lda, &
+                x, incx, stride_x, beta, y, incy, stride_y) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dgemv_multi')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+        end function rocblas_dgemv_multi
+    end interface
+
+    interface
+        function rocblas_cgemv_multi(handle, trans, m, n, k, alpha, A, lda, &
+                x, incx, stride_x, beta, y, incy, stride_y) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgemv_multi')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+        end function rocblas_cgemv_multi
+    end interface
+
+    interface
+        function rocblas_zgemv_multi(handle, trans, m, n, k, alpha, A, lda, &
+                x, incx, stride_x, beta, y, incy, stride_y) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgemv_multi')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+        end function rocblas_zgemv_multi
+    end interface
+
+    ! gemv_grouped
+    interface
+        function rocblas_sgemv_grouped(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy, group_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sgemv_grouped')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: x
+            type(c_ptr), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: incy
+            integer(c_int), value :: group_count
+        end function rocblas_sgemv_grouped
+    end interface
+
+    interface
+        function rocblas_dgemv_grouped(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy, group_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dgemv_grouped')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: x
+            type(c_ptr), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: incy
+            integer(c_int), value :: group_count
+        end function rocblas_dgemv_grouped
+    end interface
+
+    interface
+        function rocblas_cgemv_grouped(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy, group_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgemv_grouped')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: x
+            type(c_ptr), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: incy
+            integer(c_int), value :: group_count
+        end function rocblas_cgemv_grouped
+    end interface
+
+    interface
+        function rocblas_zgemv_grouped(handle, trans, m, n, alpha, A, lda, &
+                x, incx, beta, y, incy, group_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgemv_grouped')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: trans
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: x
+            type(c_ptr), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: incy
+            integer(c_int), value :: group_count
+        end function rocblas_zgemv_grouped
+    end interface
+
+    ! ger_deferred, syr_deferred, her_deferred, syr2_deferred, her2_deferred
+    interface
+        function rocblas_sger_deferred(handle, update, m, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sger_deferred')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_sger_deferred
+    end interface
+
+    interface
+        function rocblas_dger_deferred(handle, update, m, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dger_deferred')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_dger_deferred
+    end interface
+
+    interface
+        function rocblas_cgeru_deferred(handle, update, m, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgeru_deferred')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_cgeru_deferred
+    end interface
+
+    interface
+        function rocblas_zgeru_deferred(handle, update, m, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgeru_deferred')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_zgeru_deferred
+    end interface
+
+    interface
+        function rocblas_cgerc_deferred(handle, update, m, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgerc_deferred')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_cgerc_deferred
+    end interface
+
+    interface
+        function rocblas_zgerc_deferred(handle, update, m, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgerc_deferred')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_zgerc_deferred
+    end interface
+
+    interface
+        function rocblas_ssyr_deferred(handle, update, uplo, n, alpha, x, incx, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_ssyr_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_ssyr_deferred
+    end interface
+
+    interface
+        function rocblas_dsyr_deferred(handle, update, uplo, n, alpha, x, incx, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dsyr_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_dsyr_deferred
+    end interface
+
+    interface
+        function rocblas_csyr_deferred(handle, update, uplo, n, alpha, x, incx, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_csyr_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_csyr_deferred
+    end interface
+
+    interface
+        function rocblas_zsyr_deferred(handle, update, uplo, n, alpha, x, incx, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zsyr_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_zsyr_deferred
+    end interface
+
+    interface
+        function rocblas_cher_deferred(handle, update, uplo, n, alpha, x, incx, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cher_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_cher_deferred
+    end interface
+
+    interface
+        function rocblas_zher_deferred(handle, update, uplo, n, alpha, x, incx, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zher_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_zher_deferred
+    end interface
+
+    interface
+        function rocblas_ssyr2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_ssyr2_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_ssyr2_deferred
+    end interface
+
+    interface
+        function rocblas_dsyr2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dsyr2_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_dsyr2_deferred
+    end interface
+
+    interface
+        function rocblas_csyr2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_csyr2_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_csyr2_deferred
+    end interface
+
+    interface
+        function rocblas_zsyr2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zsyr2_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_zsyr2_deferred
+    end interface
+
+    interface
+        function rocblas_cher2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cher2_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_cher2_deferred
+    end interface
+
+    interface
+        function rocblas_zher2_deferred(handle, update, uplo, n, alpha, x, incx, y, incy, &
+                A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zher2_deferred')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: update
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_zher2_deferred
+    end interface
+
+    ! hbmv
+    interface
+        function rocblas_chbmv(handle, uplo, n, k, alpha, A, lda, &
+                x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_chbmv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_chbmv
+    end interface
+
+    interface
+        function rocblas_zhbmv(handle, uplo, n, k, alpha, A, lda, &
+                x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zhbmv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_zhbmv
+    end interface
+
+    ! hbmv_batched
+    interface
+        function rocblas_chbmv_batched(handle, uplo, n, k, alpha, A, lda, &
+                x, incx, beta, y, incy, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_chbmv_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function rocblas_chbmv_batched
+    end interface
+
+    interface
+        function rocblas_zhbmv_batched(handle, uplo, n, k, alpha, A, lda, &
+                x, incx, beta, y, incy, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zhbmv_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function rocblas_zhbmv_batched
+    end interface
+
+    ! hbmv_strided_batched
+    interface
+        function rocblas_chbmv_strided_batched(handle, uplo, n, k, alpha, A, lda, stride_A, &
+                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_chbmv_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocblas_chbmv_strided_batched
+    end interface
+
+    interface
+        function rocblas_zhbmv_strided_batched(handle, uplo, n, k, alpha, A, lda, stride_A, &
+                x, incx, stride_x, beta, y, incy, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zhbmv_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocblas_zhbmv_strided_batched
+    end interface
+
+    ! hemv
+    interface
+        function rocblas_chemv(handle, uplo, n, alpha, A, lda, &
+                x, incx, beta, y, incy) &
+                result(c_int) &
+                bind(c, name = 'rocblas_chemv')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function rocblas_chemv
+    end interface
+
+    interface
+        function rocblas_zhemv(handle, uplo, n, alpha, A, lda, &
                 x, incx, beta, y, incy) &
                 result(c_int) &
                 bind(c, name = 'rocblas_zhemv')
@@ -7477,15 +8934,258 @@ module rocblas
             type(c_ptr), value :: AP
             integer(c_int64_t), value :: stride_AP
             integer(c_int), value :: batch_count
-        end function rocblas_zspr_strided_batched
+        end function rocblas_zspr_strided_batched
+    end interface
+
+    ! spr2
+    interface
+        function rocblas_sspr2(handle, uplo, n, alpha, x, incx, &
+                y, incy, AP) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sspr2')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: AP
+        end function rocblas_sspr2
+    end interface
+
+    interface
+        function rocblas_dspr2(handle, uplo, n, alpha, x, incx, &
+                y, incy, AP) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dspr2')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: AP
+        end function rocblas_dspr2
+    end interface
+
+    ! spr2_batched
+    interface
+        function rocblas_sspr2_batched(handle, uplo, n, alpha, x, incx, &
+                y, incy, AP, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sspr2_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: AP
+            integer(c_int), value :: batch_count
+        end function rocblas_sspr2_batched
+    end interface
+
+    interface
+        function rocblas_dspr2_batched(handle, uplo, n, alpha, x, incx, &
+                y, incy, AP, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dspr2_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            type(c_ptr), value :: AP
+            integer(c_int), value :: batch_count
+        end function rocblas_dspr2_batched
+    end interface
+
+    ! spr2_strided_batched
+    interface
+        function rocblas_sspr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
+                y, incy, stride_y, AP, stride_AP, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sspr2_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            type(c_ptr), value :: AP
+            integer(c_int64_t), value :: stride_AP
+            integer(c_int), value :: batch_count
+        end function rocblas_sspr2_strided_batched
+    end interface
+
+    interface
+        function rocblas_dspr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
+                y, incy, stride_y, AP, stride_AP, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dspr2_strided_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            type(c_ptr), value :: AP
+            integer(c_int64_t), value :: stride_AP
+            integer(c_int), value :: batch_count
+        end function rocblas_dspr2_strided_batched
+    end interface
+
+    ! syr
+    interface
+        function rocblas_ssyr(handle, uplo, n, alpha, x, incx, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_ssyr')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_ssyr
+    end interface
+
+    interface
+        function rocblas_dsyr(handle, uplo, n, alpha, x, incx, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dsyr')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_dsyr
+    end interface
+
+    interface
+        function rocblas_csyr(handle, uplo, n, alpha, x, incx, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_csyr')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_csyr
+    end interface
+
+    interface
+        function rocblas_zsyr(handle, uplo, n, alpha, x, incx, A, lda) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zsyr')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+        end function rocblas_zsyr
+    end interface
+
+    ! syr_batched
+    interface
+        function rocblas_ssyr_batched(handle, uplo, n, alpha, x, incx, A, lda, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_ssyr_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: batch_count
+        end function rocblas_ssyr_batched
+    end interface
+
+    interface
+        function rocblas_dsyr_batched(handle, uplo, n, alpha, x, incx, A, lda, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dsyr_batched')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_fill_full)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: batch_count
+        end function rocblas_dsyr_batched
     end interface
 
-    ! spr2
     interface
-        function rocblas_sspr2(handle, uplo, n, alpha, x, incx, &
-                y, incy, AP) &
+        function rocblas_csyr_batched(handle, uplo, n, alpha, x, incx, A, lda, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_sspr2')
+                bind(c, name = 'rocblas_csyr_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7495,17 +9195,16 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
-            type(c_ptr), value :: AP
-        end function rocblas_sspr2
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: batch_count
+        end function rocblas_csyr_batched
     end interface
 
     interface
-        function rocblas_dspr2(handle, uplo, n, alpha, x, incx, &
-                y, incy, AP) &
+        function rocblas_zsyr_batched(handle, uplo, n, alpha, x, incx, A, lda, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dspr2')
+                bind(c, name = 'rocblas_zsyr_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7515,18 +9214,18 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
-            type(c_ptr), value :: AP
-        end function rocblas_dspr2
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: batch_count
+        end function rocblas_zsyr_batched
     end interface
 
-    ! spr2_batched
+    ! syr_strided_batched
     interface
-        function rocblas_sspr2_batched(handle, uplo, n, alpha, x, incx, &
-                y, incy, AP, batch_count) &
+        function rocblas_ssyr_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
+                A, lda, stride_A, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_sspr2_batched')
+                bind(c, name = 'rocblas_ssyr_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7536,18 +9235,19 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
-            type(c_ptr), value :: AP
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
             integer(c_int), value :: batch_count
-        end function rocblas_sspr2_batched
+        end function rocblas_ssyr_strided_batched
     end interface
 
     interface
-        function rocblas_dspr2_batched(handle, uplo, n, alpha, x, incx, &
-                y, incy, AP, batch_count) &
+        function rocblas_dsyr_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
+                A, lda, stride_A, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dspr2_batched')
+                bind(c, name = 'rocblas_dsyr_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7557,19 +9257,19 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
-            type(c_ptr), value :: AP
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
             integer(c_int), value :: batch_count
-        end function rocblas_dspr2_batched
+        end function rocblas_dsyr_strided_batched
     end interface
 
-    ! spr2_strided_batched
     interface
-        function rocblas_sspr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
-                y, incy, stride_y, AP, stride_AP, batch_count) &
+        function rocblas_csyr_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
+                A, lda, stride_A, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_sspr2_strided_batched')
+                bind(c, name = 'rocblas_csyr_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7580,20 +9280,18 @@ module rocblas
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
-            type(c_ptr), value :: AP
-            integer(c_int64_t), value :: stride_AP
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
             integer(c_int), value :: batch_count
-        end function rocblas_sspr2_strided_batched
+        end function rocblas_csyr_strided_batched
     end interface
 
     interface
-        function rocblas_dspr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
-                y, incy, stride_y, AP, stride_AP, batch_count) &
+        function rocblas_zsyr_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
+                A, lda, stride_A, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dspr2_strided_batched')
+                bind(c, name = 'rocblas_zsyr_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7604,20 +9302,19 @@ module rocblas
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
-            type(c_ptr), value :: AP
-            integer(c_int64_t), value :: stride_AP
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
             integer(c_int), value :: batch_count
-        end function rocblas_dspr2_strided_batched
+        end function rocblas_zsyr_strided_batched
     end interface
 
-    ! syr
+    ! syr2
     interface
-        function rocblas_ssyr(handle, uplo, n, alpha, x, incx, A, lda) &
+        function rocblas_ssyr2(handle, uplo, n, alpha, x, incx, &
+                y, incy, A, lda) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyr')
+                bind(c, name = 'rocblas_ssyr2')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7627,15 +9324,18 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-        end function rocblas_ssyr
+        end function rocblas_ssyr2
     end interface
 
     interface
-        function rocblas_dsyr(handle, uplo, n, alpha, x, incx, A, lda) &
+        function rocblas_dsyr2(handle, uplo, n, alpha, x, incx, &
+                y, incy, A, lda) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyr')
+                bind(c, name = 'rocblas_dsyr2')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7645,15 +9345,18 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-        end function rocblas_dsyr
+        end function rocblas_dsyr2
     end interface
 
     interface
-        function rocblas_csyr(handle, uplo, n, alpha, x, incx, A, lda) &
+        function rocblas_csyr2(handle, uplo, n, alpha, x, incx, &
+                y, incy, A, lda) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyr')
+                bind(c, name = 'rocblas_csyr2')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7663,15 +9366,18 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-        end function rocblas_csyr
+        end function rocblas_csyr2
     end interface
 
     interface
-        function rocblas_zsyr(handle, uplo, n, alpha, x, incx, A, lda) &
+        function rocblas_zsyr2(handle, uplo, n, alpha, x, incx, &
+                y, incy, A, lda) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyr')
+                bind(c, name = 'rocblas_zsyr2')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7681,16 +9387,19 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-        end function rocblas_zsyr
+        end function rocblas_zsyr2
     end interface
 
-    ! syr_batched
+    ! syr2_batched
     interface
-        function rocblas_ssyr_batched(handle, uplo, n, alpha, x, incx, A, lda, batch_count) &
+        function rocblas_ssyr2_batched(handle, uplo, n, alpha, x, incx, &
+                y, incy, A, lda, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyr_batched')
+                bind(c, name = 'rocblas_ssyr2_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7700,16 +9409,19 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int), value :: batch_count
-        end function rocblas_ssyr_batched
+        end function rocblas_ssyr2_batched
     end interface
 
     interface
-        function rocblas_dsyr_batched(handle, uplo, n, alpha, x, incx, A, lda, batch_count) &
+        function rocblas_dsyr2_batched(handle, uplo, n, alpha, x, incx, &
+                y, incy, A, lda, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyr_batched')
+                bind(c, name = 'rocblas_dsyr2_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7719,16 +9431,19 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int), value :: batch_count
-        end function rocblas_dsyr_batched
+        end function rocblas_dsyr2_batched
     end interface
 
     interface
-        function rocblas_csyr_batched(handle, uplo, n, alpha, x, incx, A, lda, batch_count) &
+        function rocblas_csyr2_batched(handle, uplo, n, alpha, x, incx, &
+                y, incy, A, lda, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyr_batched')
+                bind(c, name = 'rocblas_csyr2_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7738,16 +9453,19 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int), value :: batch_count
-        end function rocblas_csyr_batched
+        end function rocblas_csyr2_batched
     end interface
 
     interface
-        function rocblas_zsyr_batched(handle, uplo, n, alpha, x, incx, A, lda, batch_count) &
+        function rocblas_zsyr2_batched(handle, uplo, n, alpha, x, incx, &
+                y, incy, A, lda, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyr_batched')
+                bind(c, name = 'rocblas_zsyr2_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7757,18 +9475,20 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: x
             integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int), value :: batch_count
-        end function rocblas_zsyr_batched
+        end function rocblas_zsyr2_batched
     end interface
 
-    ! syr_strided_batched
+    ! syr2_strided_batched
     interface
-        function rocblas_ssyr_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
-                A, lda, stride_A, batch_count) &
+        function rocblas_ssyr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
+                y, incy, stride_y, A, lda, stride_A, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyr_strided_batched')
+                bind(c, name = 'rocblas_ssyr2_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7779,18 +9499,21 @@ module rocblas
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
             integer(c_int), value :: batch_count
-        end function rocblas_ssyr_strided_batched
+        end function rocblas_ssyr2_strided_batched
     end interface
 
     interface
-        function rocblas_dsyr_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
-                A, lda, stride_A, batch_count) &
+        function rocblas_dsyr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
+                y, incy, stride_y, A, lda, stride_A, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyr_strided_batched')
+                bind(c, name = 'rocblas_dsyr2_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7801,18 +9524,21 @@ module rocblas
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
             integer(c_int), value :: batch_count
-        end function rocblas_dsyr_strided_batched
+        end function rocblas_dsyr2_strided_batched
     end interface
 
     interface
-        function rocblas_csyr_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
-                A, lda, stride_A, batch_count) &
+        function rocblas_csyr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
+                y, incy, stride_y, A, lda, stride_A, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyr_strided_batched')
+                bind(c, name = 'rocblas_csyr2_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7823,18 +9549,21 @@ module rocblas
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
             integer(c_int), value :: batch_count
-        end function rocblas_csyr_strided_batched
+        end function rocblas_csyr2_strided_batched
     end interface
 
     interface
-        function rocblas_zsyr_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
-                A, lda, stride_A, batch_count) &
+        function rocblas_zsyr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
+                y, incy, stride_y, A, lda, stride_A, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyr_strided_batched')
+                bind(c, name = 'rocblas_zsyr2_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -7845,304 +9574,332 @@ module rocblas
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
             integer(c_int), value :: batch_count
-        end function rocblas_zsyr_strided_batched
+        end function rocblas_zsyr2_strided_batched
     end interface
 
-    ! syr2
+    !--------!
+    ! blas 3 !
+    !--------!
+
+    ! hemm
     interface
-        function rocblas_ssyr2(handle, uplo, n, alpha, x, incx, &
-                y, incy, A, lda) &
+        function rocblas_chemm(handle, side, uplo, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyr2')
+                bind(c, name = 'rocblas_chemm')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-        end function rocblas_ssyr2
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_chemm
     end interface
 
     interface
-        function rocblas_dsyr2(handle, uplo, n, alpha, x, incx, &
-                y, incy, A, lda) &
+        function rocblas_zhemm(handle, side, uplo, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyr2')
+                bind(c, name = 'rocblas_zhemm')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-        end function rocblas_dsyr2
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_zhemm
     end interface
 
+    ! hemm_batched
     interface
-        function rocblas_csyr2(handle, uplo, n, alpha, x, incx, &
-                y, incy, A, lda) &
+        function rocblas_chemm_batched(handle, side, uplo, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyr2')
+                bind(c, name = 'rocblas_chemm_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-        end function rocblas_csyr2
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function rocblas_chemm_batched
     end interface
 
     interface
-        function rocblas_zsyr2(handle, uplo, n, alpha, x, incx, &
-                y, incy, A, lda) &
+        function rocblas_zhemm_batched(handle, side, uplo, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyr2')
+                bind(c, name = 'rocblas_zhemm_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-        end function rocblas_zsyr2
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function rocblas_zhemm_batched
     end interface
 
-    ! syr2_batched
+    ! hemm_strided_batched
     interface
-        function rocblas_ssyr2_batched(handle, uplo, n, alpha, x, incx, &
-                y, incy, A, lda, batch_count) &
+        function rocblas_chemm_strided_batched(handle, side, uplo, n, k, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyr2_batched')
+                bind(c, name = 'rocblas_chemm_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_ssyr2_batched
+        end function rocblas_chemm_strided_batched
     end interface
 
     interface
-        function rocblas_dsyr2_batched(handle, uplo, n, alpha, x, incx, &
-                y, incy, A, lda, batch_count) &
+        function rocblas_zhemm_strided_batched(handle, side, uplo, n, k, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyr2_batched')
+                bind(c, name = 'rocblas_zhemm_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_dsyr2_batched
+        end function rocblas_zhemm_strided_batched
     end interface
 
+    ! herk
     interface
-        function rocblas_csyr2_batched(handle, uplo, n, alpha, x, incx, &
-                y, incy, A, lda, batch_count) &
+        function rocblas_cherk(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyr2_batched')
+                bind(c, name = 'rocblas_cherk')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int), value :: batch_count
-        end function rocblas_csyr2_batched
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_cherk
     end interface
 
     interface
-        function rocblas_zsyr2_batched(handle, uplo, n, alpha, x, incx, &
-                y, incy, A, lda, batch_count) &
+        function rocblas_zherk(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyr2_batched')
+                bind(c, name = 'rocblas_zherk')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int), value :: batch_count
-        end function rocblas_zsyr2_batched
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_zherk
     end interface
 
-    ! syr2_strided_batched
+    ! herk_batched
     interface
-        function rocblas_ssyr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
-                y, incy, stride_y, A, lda, stride_A, batch_count) &
+        function rocblas_cherk_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyr2_strided_batched')
+                bind(c, name = 'rocblas_cherk_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_ssyr2_strided_batched
+        end function rocblas_cherk_batched
     end interface
 
     interface
-        function rocblas_dsyr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
-                y, incy, stride_y, A, lda, stride_A, batch_count) &
+        function rocblas_zherk_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyr2_strided_batched')
+                bind(c, name = 'rocblas_zherk_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_dsyr2_strided_batched
+        end function rocblas_zherk_batched
     end interface
 
+    ! herk_strided_batched
     interface
-        function rocblas_csyr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
-                y, incy, stride_y, A, lda, stride_A, batch_count) &
+        function rocblas_cherk_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyr2_strided_batched')
+                bind(c, name = 'rocblas_cherk_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_csyr2_strided_batched
+        end function rocblas_cherk_strided_batched
     end interface
 
     interface
-        function rocblas_zsyr2_strided_batched(handle, uplo, n, alpha, x, incx, stride_x, &
-                y, incy, stride_y, A, lda, stride_A, batch_count) &
+        function rocblas_zherk_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyr2_strided_batched')
+                bind(c, name = 'rocblas_zherk_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: y
-            integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_zsyr2_strided_batched
+        end function rocblas_zherk_strided_batched
     end interface
 
-    !--------!
-    ! blas 3 !
-    !--------!
-
-    ! hemm
+    ! her2k
     interface
-        function rocblas_chemm(handle, side, uplo, n, k, alpha, &
+        function rocblas_cher2k(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_chemm')
+                bind(c, name = 'rocblas_cher2k')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
@@ -8153,20 +9910,20 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_chemm
+        end function rocblas_cher2k
     end interface
 
     interface
-        function rocblas_zhemm(handle, side, uplo, n, k, alpha, &
+        function rocblas_zher2k(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zhemm')
+                bind(c, name = 'rocblas_zher2k')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
@@ -8177,21 +9934,21 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_zhemm
+        end function rocblas_zher2k
     end interface
 
-    ! hemm_batched
+    ! her2k_batched
     interface
-        function rocblas_chemm_batched(handle, side, uplo, n, k, alpha, &
+        function rocblas_cher2k_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_chemm_batched')
+                bind(c, name = 'rocblas_cher2k_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
@@ -8203,20 +9960,20 @@ module rocblas
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_chemm_batched
+        end function rocblas_cher2k_batched
     end interface
 
     interface
-        function rocblas_zhemm_batched(handle, side, uplo, n, k, alpha, &
+        function rocblas_zher2k_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zhemm_batched')
+                bind(c, name = 'rocblas_zher2k_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
@@ -8228,21 +9985,21 @@ module rocblas
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_zhemm_batched
+        end function rocblas_zher2k_batched
     end interface
 
-    ! hemm_strided_batched
+    ! her2k_strided_batched
     interface
-        function rocblas_chemm_strided_batched(handle, side, uplo, n, k, alpha, &
+        function rocblas_cher2k_strided_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_chemm_strided_batched')
+                bind(c, name = 'rocblas_cher2k_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
@@ -8257,20 +10014,20 @@ module rocblas
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_chemm_strided_batched
+        end function rocblas_cher2k_strided_batched
     end interface
 
     interface
-        function rocblas_zhemm_strided_batched(handle, side, uplo, n, k, alpha, &
+        function rocblas_zher2k_strided_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zhemm_strided_batched')
+                bind(c, name = 'rocblas_zher2k_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
@@ -8285,15 +10042,15 @@ module rocblas
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_zhemm_strided_batched
+        end function rocblas_zher2k_strided_batched
     end interface
 
-    ! herk
+    ! herkx
     interface
-        function rocblas_cherk(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc) &
+        function rocblas_cherkx(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cherk')
+                bind(c, name = 'rocblas_cherkx')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -8305,17 +10062,19 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_cherk
+        end function rocblas_cherkx
     end interface
 
     interface
-        function rocblas_zherk(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc) &
+        function rocblas_zherkx(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zherk')
+                bind(c, name = 'rocblas_zherkx')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -8327,18 +10086,20 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_zherk
+        end function rocblas_zherkx
     end interface
 
-    ! herk_batched
+    ! herkx_batched
     interface
-        function rocblas_cherk_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc, batch_count) &
+        function rocblas_cherkx_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cherk_batched')
+                bind(c, name = 'rocblas_cherkx_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -8350,18 +10111,20 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_cherk_batched
+        end function rocblas_cherkx_batched
     end interface
 
     interface
-        function rocblas_zherk_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc, batch_count) &
+        function rocblas_zherkx_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zherk_batched')
+                bind(c, name = 'rocblas_zherkx_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -8373,19 +10136,21 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_zherk_batched
+        end function rocblas_zherkx_batched
     end interface
 
-    ! herk_strided_batched
+    ! herkx_strided_batched
     interface
-        function rocblas_cherk_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_cherkx_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cherk_strided_batched')
+                bind(c, name = 'rocblas_cherkx_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -8398,19 +10163,22 @@ module rocblas
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_cherk_strided_batched
+        end function rocblas_cherkx_strided_batched
     end interface
 
     interface
-        function rocblas_zherk_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_zherkx_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zherk_strided_batched')
+                bind(c, name = 'rocblas_zherkx_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -8423,28 +10191,31 @@ module rocblas
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_zherk_strided_batched
+        end function rocblas_zherkx_strided_batched
     end interface
 
-    ! her2k
+    ! symm
     interface
-        function rocblas_cher2k(handle, uplo, transA, n, k, alpha, &
+        function rocblas_ssymm(handle, side, uplo, m, n, alpha, &
                 A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cher2k')
+                bind(c, name = 'rocblas_ssymm')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -8453,22 +10224,22 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_cher2k
+        end function rocblas_ssymm
     end interface
 
     interface
-        function rocblas_zher2k(handle, uplo, transA, n, k, alpha, &
+        function rocblas_dsymm(handle, side, uplo, m, n, alpha, &
                 A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zher2k')
+                bind(c, name = 'rocblas_dsymm')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -8477,23 +10248,22 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_zher2k
+        end function rocblas_dsymm
     end interface
 
-    ! her2k_batched
     interface
-        function rocblas_cher2k_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_csymm(handle, side, uplo, m, n, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cher2k_batched')
+                bind(c, name = 'rocblas_csymm')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -8502,23 +10272,22 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function rocblas_cher2k_batched
+        end function rocblas_csymm
     end interface
 
     interface
-        function rocblas_zher2k_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_zsymm(handle, side, uplo, m, n, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zher2k_batched')
+                bind(c, name = 'rocblas_zsymm')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -8527,81 +10296,73 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function rocblas_zher2k_batched
+        end function rocblas_zsymm
     end interface
 
-    ! her2k_strided_batched
+    ! symm_batched
     interface
-        function rocblas_cher2k_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_ssymm_batched(handle, side, uplo, m, n, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cher2k_strided_batched')
+                bind(c, name = 'rocblas_ssymm_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_cher2k_strided_batched
+        end function rocblas_ssymm_batched
     end interface
 
     interface
-        function rocblas_zher2k_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_dsymm_batched(handle, side, uplo, m, n, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zher2k_strided_batched')
+                bind(c, name = 'rocblas_dsymm_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_zher2k_strided_batched
+        end function rocblas_dsymm_batched
     end interface
 
-    ! herkx
     interface
-        function rocblas_cherkx(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc) &
+        function rocblas_csymm_batched(handle, side, uplo, m, n, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cherkx')
+                bind(c, name = 'rocblas_csymm_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -8610,22 +10371,23 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_cherkx
+            integer(c_int), value :: batch_count
+        end function rocblas_csymm_batched
     end interface
 
     interface
-        function rocblas_zherkx(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc) &
+        function rocblas_zsymm_batched(handle, side, uplo, m, n, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zherkx')
+                bind(c, name = 'rocblas_zsymm_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -8634,74 +10396,80 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_zherkx
+            integer(c_int), value :: batch_count
+        end function rocblas_zsymm_batched
     end interface
 
-    ! herkx_batched
+    ! symm_strided_batched
     interface
-        function rocblas_cherkx_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_ssymm_strided_batched(handle, side, uplo, m, n, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cherkx_batched')
+                bind(c, name = 'rocblas_ssymm_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_cherkx_batched
+        end function rocblas_ssymm_strided_batched
     end interface
 
     interface
-        function rocblas_zherkx_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_dsymm_strided_batched(handle, side, uplo, m, n, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zherkx_batched')
+                bind(c, name = 'rocblas_dsymm_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_zherkx_batched
+        end function rocblas_dsymm_strided_batched
     end interface
 
-    ! herkx_strided_batched
     interface
-        function rocblas_cherkx_strided_batched(handle, uplo, transA, n, k, alpha, &
+        function rocblas_csymm_strided_batched(handle, side, uplo, m, n, alpha, &
                 A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_cherkx_strided_batched')
+                bind(c, name = 'rocblas_csymm_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -8714,22 +10482,22 @@ module rocblas
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_cherkx_strided_batched
+        end function rocblas_csymm_strided_batched
     end interface
 
     interface
-        function rocblas_zherkx_strided_batched(handle, uplo, transA, n, k, alpha, &
+        function rocblas_zsymm_strided_batched(handle, side, uplo, m, n, alpha, &
                 A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zherkx_strided_batched')
+                bind(c, name = 'rocblas_zsymm_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(kind(rocblas_operation_none)), value :: transA
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -8742,326 +10510,298 @@ module rocblas
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_zherkx_strided_batched
+        end function rocblas_zsymm_strided_batched
     end interface
 
-    ! symm
+    ! syrk
     interface
-        function rocblas_ssymm(handle, side, uplo, m, n, alpha, &
-                A, lda, B, ldb, beta, C, ldc) &
+        function rocblas_ssyrk(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssymm')
+                bind(c, name = 'rocblas_ssyrk')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_ssymm
+        end function rocblas_ssyrk
     end interface
 
     interface
-        function rocblas_dsymm(handle, side, uplo, m, n, alpha, &
-                A, lda, B, ldb, beta, C, ldc) &
+        function rocblas_dsyrk(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsymm')
+                bind(c, name = 'rocblas_dsyrk')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_dsymm
+        end function rocblas_dsyrk
     end interface
 
     interface
-        function rocblas_csymm(handle, side, uplo, m, n, alpha, &
-                A, lda, B, ldb, beta, C, ldc) &
+        function rocblas_csyrk(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csymm')
+                bind(c, name = 'rocblas_csyrk')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_csymm
+        end function rocblas_csyrk
     end interface
 
     interface
-        function rocblas_zsymm(handle, side, uplo, m, n, alpha, &
-                A, lda, B, ldb, beta, C, ldc) &
+        function rocblas_zsyrk(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsymm')
+                bind(c, name = 'rocblas_zsyrk')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_zsymm
+        end function rocblas_zsyrk
     end interface
 
-    ! symm_batched
+    ! syrk_batched
     interface
-        function rocblas_ssymm_batched(handle, side, uplo, m, n, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_ssyrk_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssymm_batched')
+                bind(c, name = 'rocblas_ssyrk_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_ssymm_batched
+        end function rocblas_ssyrk_batched
     end interface
 
     interface
-        function rocblas_dsymm_batched(handle, side, uplo, m, n, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_dsyrk_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsymm_batched')
+                bind(c, name = 'rocblas_dsyrk_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_dsymm_batched
+        end function rocblas_dsyrk_batched
     end interface
 
     interface
-        function rocblas_csymm_batched(handle, side, uplo, m, n, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_csyrk_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csymm_batched')
+                bind(c, name = 'rocblas_csyrk_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_csymm_batched
+        end function rocblas_csyrk_batched
     end interface
 
     interface
-        function rocblas_zsymm_batched(handle, side, uplo, m, n, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_zsyrk_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsymm_batched')
+                bind(c, name = 'rocblas_zsyrk_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_zsymm_batched
+        end function rocblas_zsyrk_batched
     end interface
 
-    ! symm_strided_batched
+    ! syrk_strided_batched
     interface
-        function rocblas_ssymm_strided_batched(handle, side, uplo, m, n, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_ssyrk_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssymm_strided_batched')
+                bind(c, name = 'rocblas_ssyrk_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_ssymm_strided_batched
+        end function rocblas_ssyrk_strided_batched
     end interface
 
     interface
-        function rocblas_dsymm_strided_batched(handle, side, uplo, m, n, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_dsyrk_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsymm_strided_batched')
+                bind(c, name = 'rocblas_dsyrk_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_dsymm_strided_batched
+        end function rocblas_dsyrk_strided_batched
     end interface
 
     interface
-        function rocblas_csymm_strided_batched(handle, side, uplo, m, n, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_csyrk_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csymm_strided_batched')
+                bind(c, name = 'rocblas_csyrk_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_csymm_strided_batched
+        end function rocblas_csyrk_strided_batched
     end interface
 
     interface
-        function rocblas_zsymm_strided_batched(handle, side, uplo, m, n, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_zsyrk_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsymm_strided_batched')
+                bind(c, name = 'rocblas_zsyrk_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
-            integer(c_int), value :: m
+            integer(kind(rocblas_operation_none)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_zsymm_strided_batched
+        end function rocblas_zsyrk_strided_batched
     end interface
 
-    ! syrk
+    ! syr2k
     interface
-        function rocblas_ssyrk(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc) &
+        function rocblas_ssyr2k(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyrk')
+                bind(c, name = 'rocblas_ssyr2k')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9073,17 +10813,19 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_ssyrk
+        end function rocblas_ssyr2k
     end interface
 
     interface
-        function rocblas_dsyrk(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc) &
+        function rocblas_dsyr2k(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyrk')
+                bind(c, name = 'rocblas_dsyr2k')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9095,17 +10837,19 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_dsyrk
+        end function rocblas_dsyr2k
     end interface
 
     interface
-        function rocblas_csyrk(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc) &
+        function rocblas_csyr2k(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyrk')
+                bind(c, name = 'rocblas_csyr2k')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9117,17 +10861,19 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_csyrk
+        end function rocblas_csyr2k
     end interface
 
     interface
-        function rocblas_zsyrk(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc) &
+        function rocblas_zsyr2k(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyrk')
+                bind(c, name = 'rocblas_zsyr2k')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9139,18 +10885,20 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_zsyrk
+        end function rocblas_zsyr2k
     end interface
 
-    ! syrk_batched
+    ! syr2k_batched
     interface
-        function rocblas_ssyrk_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc, batch_count) &
+        function rocblas_ssyr2k_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyrk_batched')
+                bind(c, name = 'rocblas_ssyr2k_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9162,18 +10910,20 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_ssyrk_batched
+        end function rocblas_ssyr2k_batched
     end interface
 
     interface
-        function rocblas_dsyrk_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc, batch_count) &
+        function rocblas_dsyr2k_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyrk_batched')
+                bind(c, name = 'rocblas_dsyr2k_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9185,18 +10935,20 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_dsyrk_batched
+        end function rocblas_dsyr2k_batched
     end interface
 
     interface
-        function rocblas_csyrk_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc, batch_count) &
+        function rocblas_csyr2k_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyrk_batched')
+                bind(c, name = 'rocblas_csyr2k_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9208,18 +10960,20 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_csyrk_batched
+        end function rocblas_csyr2k_batched
     end interface
 
     interface
-        function rocblas_zsyrk_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, beta, C, ldc, batch_count) &
+        function rocblas_zsyr2k_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyrk_batched')
+                bind(c, name = 'rocblas_zsyr2k_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9231,19 +10985,21 @@ module rocblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_zsyrk_batched
+        end function rocblas_zsyr2k_batched
     end interface
 
-    ! syrk_strided_batched
+    ! syr2k_strided_batched
     interface
-        function rocblas_ssyrk_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_ssyr2k_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyrk_strided_batched')
+                bind(c, name = 'rocblas_ssyr2k_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9256,19 +11012,22 @@ module rocblas
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_ssyrk_strided_batched
+        end function rocblas_ssyr2k_strided_batched
     end interface
 
     interface
-        function rocblas_dsyrk_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_dsyr2k_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyrk_strided_batched')
+                bind(c, name = 'rocblas_dsyr2k_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9281,19 +11040,22 @@ module rocblas
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_dsyrk_strided_batched
+        end function rocblas_dsyr2k_strided_batched
     end interface
 
     interface
-        function rocblas_csyrk_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_csyr2k_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyrk_strided_batched')
+                bind(c, name = 'rocblas_csyr2k_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9306,19 +11068,22 @@ module rocblas
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_csyrk_strided_batched
+        end function rocblas_csyr2k_strided_batched
     end interface
 
     interface
-        function rocblas_zsyrk_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_zsyr2k_strided_batched(handle, uplo, transA, n, k, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyrk_strided_batched')
+                bind(c, name = 'rocblas_zsyr2k_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9331,20 +11096,23 @@ module rocblas
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_zsyrk_strided_batched
+        end function rocblas_zsyr2k_strided_batched
     end interface
 
-    ! syr2k
+    ! syrkx
     interface
-        function rocblas_ssyr2k(handle, uplo, transA, n, k, alpha, &
+        function rocblas_ssyrkx(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyr2k')
+                bind(c, name = 'rocblas_ssyrkx')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9361,14 +11129,14 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_ssyr2k
+        end function rocblas_ssyrkx
     end interface
 
     interface
-        function rocblas_dsyr2k(handle, uplo, transA, n, k, alpha, &
+        function rocblas_dsyrkx(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyr2k')
+                bind(c, name = 'rocblas_dsyrkx')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9385,14 +11153,14 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_dsyr2k
+        end function rocblas_dsyrkx
     end interface
 
     interface
-        function rocblas_csyr2k(handle, uplo, transA, n, k, alpha, &
+        function rocblas_csyrkx(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyr2k')
+                bind(c, name = 'rocblas_csyrkx')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9409,14 +11177,14 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_csyr2k
+        end function rocblas_csyrkx
     end interface
 
     interface
-        function rocblas_zsyr2k(handle, uplo, transA, n, k, alpha, &
+        function rocblas_zsyrkx(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyr2k')
+                bind(c, name = 'rocblas_zsyrkx')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9433,15 +11201,15 @@ module rocblas
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocblas_zsyr2k
+        end function rocblas_zsyrkx
     end interface
 
-    ! syr2k_batched
+    ! syrkx_batched
     interface
-        function rocblas_ssyr2k_batched(handle, uplo, transA, n, k, alpha, &
+        function rocblas_ssyrkx_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyr2k_batched')
+                bind(c, name = 'rocblas_ssyrkx_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9459,14 +11227,14 @@ module rocblas
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_ssyr2k_batched
+        end function rocblas_ssyrkx_batched
     end interface
 
     interface
-        function rocblas_dsyr2k_batched(handle, uplo, transA, n, k, alpha, &
+        function rocblas_dsyrkx_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyr2k_batched')
+                bind(c, name = 'rocblas_dsyrkx_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9484,14 +11252,14 @@ module rocblas
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_dsyr2k_batched
+        end function rocblas_dsyrkx_batched
     end interface
 
     interface
-        function rocblas_csyr2k_batched(handle, uplo, transA, n, k, alpha, &
+        function rocblas_csyrkx_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyr2k_batched')
+                bind(c, name = 'rocblas_csyrkx_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9509,14 +11277,14 @@ module rocblas
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_csyr2k_batched
+        end function rocblas_csyrkx_batched
     end interface
 
     interface
-        function rocblas_zsyr2k_batched(handle, uplo, transA, n, k, alpha, &
+        function rocblas_zsyrkx_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, B, ldb, beta, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyr2k_batched')
+                bind(c, name = 'rocblas_zsyrkx_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9534,15 +11302,15 @@ module rocblas
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_zsyr2k_batched
+        end function rocblas_zsyrkx_batched
     end interface
 
-    ! syr2k_strided_batched
+    ! syrkx_strided_batched
     interface
-        function rocblas_ssyr2k_strided_batched(handle, uplo, transA, n, k, alpha, &
+        function rocblas_ssyrkx_strided_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyr2k_strided_batched')
+                bind(c, name = 'rocblas_ssyrkx_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9563,14 +11331,14 @@ module rocblas
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_ssyr2k_strided_batched
+        end function rocblas_ssyrkx_strided_batched
     end interface
 
     interface
-        function rocblas_dsyr2k_strided_batched(handle, uplo, transA, n, k, alpha, &
+        function rocblas_dsyrkx_strided_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyr2k_strided_batched')
+                bind(c, name = 'rocblas_dsyrkx_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9591,14 +11359,14 @@ module rocblas
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_dsyr2k_strided_batched
+        end function rocblas_dsyrkx_strided_batched
     end interface
 
     interface
-        function rocblas_csyr2k_strided_batched(handle, uplo, transA, n, k, alpha, &
+        function rocblas_csyrkx_strided_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyr2k_strided_batched')
+                bind(c, name = 'rocblas_csyrkx_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9619,14 +11387,14 @@ module rocblas
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_csyr2k_strided_batched
+        end function rocblas_csyrkx_strided_batched
     end interface
 
     interface
-        function rocblas_zsyr2k_strided_batched(handle, uplo, transA, n, k, alpha, &
+        function rocblas_zsyrkx_strided_batched(handle, uplo, transA, n, k, alpha, &
                 A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyr2k_strided_batched')
+                bind(c, name = 'rocblas_zsyrkx_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9647,221 +11415,215 @@ module rocblas
             integer(c_int), value :: ldc
             integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_zsyr2k_strided_batched
+        end function rocblas_zsyrkx_strided_batched
     end interface
 
-    ! syrkx
+    ! trmm
     interface
-        function rocblas_ssyrkx(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc) &
+        function rocblas_strmm(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyrkx')
+                bind(c, name = 'rocblas_strmm')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocblas_ssyrkx
+        end function rocblas_strmm
     end interface
 
     interface
-        function rocblas_dsyrkx(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc) &
+        function rocblas_dtrmm(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyrkx')
+                bind(c, name = 'rocblas_dtrmm')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocblas_dsyrkx
+        end function rocblas_dtrmm
     end interface
 
     interface
-        function rocblas_csyrkx(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc) &
+        function rocblas_ctrmm(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyrkx')
+                bind(c, name = 'rocblas_ctrmm')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocblas_csyrkx
+        end function rocblas_ctrmm
     end interface
 
     interface
-        function rocblas_zsyrkx(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc) &
+        function rocblas_ztrmm(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyrkx')
+                bind(c, name = 'rocblas_ztrmm')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocblas_zsyrkx
+        end function rocblas_ztrmm
     end interface
 
-    ! syrkx_batched
+    ! trmm_batched
     interface
-        function rocblas_ssyrkx_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_strmm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyrkx_batched')
+                bind(c, name = 'rocblas_strmm_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_ssyrkx_batched
+        end function rocblas_strmm_batched
     end interface
 
     interface
-        function rocblas_dsyrkx_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_dtrmm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyrkx_batched')
+                bind(c, name = 'rocblas_dtrmm_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_dsyrkx_batched
+        end function rocblas_dtrmm_batched
     end interface
 
     interface
-        function rocblas_csyrkx_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_ctrmm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyrkx_batched')
+                bind(c, name = 'rocblas_ctrmm_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_csyrkx_batched
+        end function rocblas_ctrmm_batched
     end interface
 
     interface
-        function rocblas_zsyrkx_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, B, ldb, beta, C, ldc, batch_count) &
+        function rocblas_ztrmm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyrkx_batched')
+                bind(c, name = 'rocblas_ztrmm_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_zsyrkx_batched
+        end function rocblas_ztrmm_batched
     end interface
 
-    ! syrkx_strided_batched
+    ! trmm_strided_batched
     interface
-        function rocblas_ssyrkx_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_strmm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ssyrkx_strided_batched')
+                bind(c, name = 'rocblas_strmm_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -9869,27 +11631,25 @@ module rocblas
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             integer(c_int64_t), value :: stride_B
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_ssyrkx_strided_batched
+        end function rocblas_strmm_strided_batched
     end interface
 
     interface
-        function rocblas_dsyrkx_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_dtrmm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dsyrkx_strided_batched')
+                bind(c, name = 'rocblas_dtrmm_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -9897,27 +11657,25 @@ module rocblas
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             integer(c_int64_t), value :: stride_B
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_dsyrkx_strided_batched
+        end function rocblas_dtrmm_strided_batched
     end interface
 
     interface
-        function rocblas_csyrkx_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_ctrmm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_csyrkx_strided_batched')
+                bind(c, name = 'rocblas_ctrmm_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -9925,27 +11683,25 @@ module rocblas
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             integer(c_int64_t), value :: stride_B
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_csyrkx_strided_batched
+        end function rocblas_ctrmm_strided_batched
     end interface
 
     interface
-        function rocblas_zsyrkx_strided_batched(handle, uplo, transA, n, k, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+        function rocblas_ztrmm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_zsyrkx_strided_batched')
+                bind(c, name = 'rocblas_ztrmm_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(rocblas_side_left)), value :: side
             integer(kind(rocblas_fill_full)), value :: uplo
             integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_diagonal_unit)), value :: diag
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -9953,20 +11709,16 @@ module rocblas
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             integer(c_int64_t), value :: stride_B
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_zsyrkx_strided_batched
+        end function rocblas_ztrmm_strided_batched
     end interface
 
-    ! trmm
+    ! trmm_outofplace
     interface
-        function rocblas_strmm(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, B, ldb) &
+        function rocblas_strmm_outofplace(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_strmm')
+                bind(c, name = 'rocblas_strmm_outofplace')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -9982,14 +11734,16 @@ module rocblas
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-        end function rocblas_strmm
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_strmm_outofplace
     end interface
 
     interface
-        function rocblas_dtrmm(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, B, ldb) &
+        function rocblas_dtrmm_outofplace(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dtrmm')
+                bind(c, name = 'rocblas_dtrmm_outofplace')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10005,14 +11759,16 @@ module rocblas
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-        end function rocblas_dtrmm
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_dtrmm_outofplace
     end interface
 
     interface
-        function rocblas_ctrmm(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, B, ldb) &
+        function rocblas_ctrmm_outofplace(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ctrmm')
+                bind(c, name = 'rocblas_ctrmm_outofplace')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10028,14 +11784,16 @@ module rocblas
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-        end function rocblas_ctrmm
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_ctrmm_outofplace
     end interface
 
     interface
-        function rocblas_ztrmm(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, B, ldb) &
+        function rocblas_ztrmm_outofplace(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, C, ldc) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ztrmm')
+                bind(c, name = 'rocblas_ztrmm_outofplace')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10051,15 +11809,17 @@ module rocblas
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-        end function rocblas_ztrmm
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocblas_ztrmm_outofplace
     end interface
 
-    ! trmm_batched
+    ! trmm_outofplace_batched
     interface
-        function rocblas_strmm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, B, ldb, batch_count) &
+        function rocblas_strmm_outofplace_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_strmm_batched')
+                bind(c, name = 'rocblas_strmm_outofplace_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10075,15 +11835,17 @@ module rocblas
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_strmm_batched
+        end function rocblas_strmm_outofplace_batched
     end interface
 
     interface
-        function rocblas_dtrmm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, B, ldb, batch_count) &
+        function rocblas_dtrmm_outofplace_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dtrmm_batched')
+                bind(c, name = 'rocblas_dtrmm_outofplace_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10099,15 +11861,17 @@ module rocblas
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_dtrmm_batched
+        end function rocblas_dtrmm_outofplace_batched
     end interface
 
     interface
-        function rocblas_ctrmm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, B, ldb, batch_count) &
+        function rocblas_ctrmm_outofplace_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ctrmm_batched')
+                bind(c, name = 'rocblas_ctrmm_outofplace_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10123,15 +11887,17 @@ module rocblas
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_ctrmm_batched
+        end function rocblas_ctrmm_outofplace_batched
     end interface
 
     interface
-        function rocblas_ztrmm_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, B, ldb, batch_count) &
+        function rocblas_ztrmm_outofplace_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, B, ldb, C, ldc, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ztrmm_batched')
+                bind(c, name = 'rocblas_ztrmm_outofplace_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10147,16 +11913,18 @@ module rocblas
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function rocblas_ztrmm_batched
+        end function rocblas_ztrmm_outofplace_batched
     end interface
 
-    ! trmm_strided_batched
+    ! trmm_outofplace_strided_batched
     interface
-        function rocblas_strmm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, batch_count) &
+        function rocblas_strmm_outofplace_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_strmm_strided_batched')
+                bind(c, name = 'rocblas_strmm_outofplace_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10174,15 +11942,18 @@ module rocblas
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_strmm_strided_batched
+        end function rocblas_strmm_outofplace_strided_batched
     end interface
 
     interface
-        function rocblas_dtrmm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, batch_count) &
+        function rocblas_dtrmm_outofplace_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_dtrmm_strided_batched')
+                bind(c, name = 'rocblas_dtrmm_outofplace_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10200,15 +11971,18 @@ module rocblas
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_dtrmm_strided_batched
+        end function rocblas_dtrmm_outofplace_strided_batched
     end interface
 
     interface
-        function rocblas_ctrmm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, batch_count) &
+        function rocblas_ctrmm_outofplace_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ctrmm_strided_batched')
+                bind(c, name = 'rocblas_ctrmm_outofplace_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10226,15 +12000,18 @@ module rocblas
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_ctrmm_strided_batched
+        end function rocblas_ctrmm_outofplace_strided_batched
     end interface
 
     interface
-        function rocblas_ztrmm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
-                A, lda, stride_A, B, ldb, stride_B, batch_count) &
+        function rocblas_ztrmm_outofplace_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, &
+                A, lda, stride_A, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
                 result(c_int) &
-                bind(c, name = 'rocblas_ztrmm_strided_batched')
+                bind(c, name = 'rocblas_ztrmm_outofplace_strided_batched')
             use iso_c_binding
             use rocblas_enums
             implicit none
@@ -10252,8 +12029,11 @@ module rocblas
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function rocblas_ztrmm_strided_batched
+        end function rocblas_ztrmm_outofplace_strided_batched
     end interface
 
     ! trtri
@@ -11201,6 +12981,115 @@ module rocblas
         end function rocblas_zgemm_strided_batched
     end interface
 
+    ! gemm_grouped
+    interface
+        function rocblas_sgemm_grouped(handle, array_mode, transA, transB, m, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, group_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_sgemm_grouped')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_pointer_mode_host)), value :: array_mode
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: B
+            type(c_ptr), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            type(c_ptr), value :: ldc
+            integer(c_int), value :: group_count
+        end function rocblas_sgemm_grouped
+    end interface
+
+    interface
+        function rocblas_dgemm_grouped(handle, array_mode, transA, transB, m, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, group_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_dgemm_grouped')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_pointer_mode_host)), value :: array_mode
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: B
+            type(c_ptr), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            type(c_ptr), value :: ldc
+            integer(c_int), value :: group_count
+        end function rocblas_dgemm_grouped
+    end interface
+
+    interface
+        function rocblas_cgemm_grouped(handle, array_mode, transA, transB, m, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, group_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_cgemm_grouped')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_pointer_mode_host)), value :: array_mode
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: B
+            type(c_ptr), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            type(c_ptr), value :: ldc
+            integer(c_int), value :: group_count
+        end function rocblas_cgemm_grouped
+    end interface
+
+    interface
+        function rocblas_zgemm_grouped(handle, array_mode, transA, transB, m, n, k, alpha, &
+                A, lda, B, ldb, beta, C, ldc, group_count) &
+                result(c_int) &
+                bind(c, name = 'rocblas_zgemm_grouped')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_pointer_mode_host)), value :: array_mode
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            type(c_ptr), value :: m
+            type(c_ptr), value :: n
+            type(c_ptr), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            type(c_ptr), value :: lda
+            type(c_ptr), value :: B
+            type(c_ptr), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            type(c_ptr), value :: ldc
+            integer(c_int), value :: group_count
+        end function rocblas_zgemm_grouped
+    end interface
+
     ! dgmm
     interface
         function rocblas_sdgmm(handle, side, m, n, &
@@ -12236,6 +14125,43 @@ module rocblas
         end function rocblas_gemm_ex
     end interface
 
+    interface
+        function rocblas_gemm_ex_epilogue(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
+                b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
+                compute_type, algo, solution_index, flags, epilogue) &
+                result(c_int) &
+                bind(c, name = 'rocblas_gemm_ex_epilogue')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: a
+            integer(kind(rocblas_datatype_f16_r)), value :: a_type
+            integer(c_int), value :: lda
+            type(c_ptr), value :: b
+            integer(kind(rocblas_datatype_f16_r)), value :: b_type
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: c
+            integer(kind(rocblas_datatype_f16_r)), value :: c_type
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: d
+            integer(kind(rocblas_datatype_f16_r)), value :: d_type
+            integer(c_int), value :: ldd
+            integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+            integer(kind(rocblas_gemm_algo_standard)), value :: algo
+            integer(c_int32_t), value :: solution_index
+            integer(c_int32_t), value :: flags
+            type(c_ptr), value :: epilogue
+        end function rocblas_gemm_ex_epilogue
+    end interface
+
     interface
         function rocblas_gemm_batched_ex(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
                 b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
@@ -12354,6 +14280,42 @@ module rocblas
         end function rocblas_gemm_ext2
     end interface
 
+    interface
+        function rocblas_gemm_ext2_epilogue(handle, m, n, k, alpha, a, a_type, row_stride_a, &
+             col_stride_a, b, b_type, row_stride_b, col_stride_b, beta, c, c_type, row_stride_c, &
+             col_stride_c, d, d_type, row_stride_d, col_stride_d, compute_type, algo, &
+             solution_index, flags, epilogue) &
+                result(c_int) &
+                bind(c, name = 'rocblas_gemm_ext2_epilogue')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: a
+            integer(kind(rocblas_datatype_f16_r)), value :: a_type
+            integer(c_int64_t), value :: row_stride_a, col_stride_a
+            type(c_ptr), value :: b
+            integer(kind(rocblas_datatype_f16_r)), value :: b_type
+            integer(c_int64_t), value :: row_stride_b, col_stride_b
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: c
+            integer(kind(rocblas_datatype_f16_r)), value :: c_type
+            integer(c_int64_t), value :: row_stride_c, col_stride_c
+            type(c_ptr), value :: d
+            integer(kind(rocblas_datatype_f16_r)), value :: d_type
+            integer(c_int64_t), value :: row_stride_d, col_stride_d
+            integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+            integer(kind(rocblas_gemm_algo_standard)), value :: algo
+            integer(c_int32_t), value :: solution_index
+            integer(c_int32_t), value :: flags
+            type(c_ptr), value :: epilogue
+        end function rocblas_gemm_ext2_epilogue
+    end interface
+
     ! trsm_ex
     interface
         function rocblas_trsm_ex(handle, side, uplo, transA, diag, m, n, alpha, A, lda, &
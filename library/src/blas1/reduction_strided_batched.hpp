@@ -6,7 +6,9 @@
 
 #include "handle.hpp"
 #include "rocblas.h"
+#include "rocblas_vector_access.hpp"
 #include "utility.hpp"
+#include <algorithm>
 #include <type_traits>
 #include <utility>
 
@@ -151,6 +153,73 @@ struct rocblas_default_value
     }
 };
 
+// Compensated reductions (rocblas_accuracy_compensated) accumulate (sum, err) pairs, where err
+// collects the rounding error of every addition into sum. The error of each addition is recovered
+// exactly with Knuth's TwoSum, which unlike Fast2Sum/Neumaier needs no magnitude comparison and
+// so does not diverge within a wavefront. The final result is sum + err.
+template <typename T>
+struct rocblas_compensated_sum
+{
+    T sum;
+    T err;
+};
+
+template <typename T>
+__forceinline__ __device__ void rocblas_two_sum(T& __restrict__ sum, T& __restrict__ err, T v)
+{
+    T t  = sum + v;
+    T bv = t - sum;
+    err += (sum - (t - bv)) + (v - bv);
+    sum = t;
+}
+
+// complex sums are compensated component by component
+template <typename T>
+__forceinline__ __device__ void rocblas_two_sum(rocblas_complex_num<T>& __restrict__ sum,
+                                                rocblas_complex_num<T>& __restrict__ err,
+                                                rocblas_complex_num<T> v)
+{
+    T sum_r = sum.real(), sum_i = sum.imag();
+    T err_r = err.real(), err_i = err.imag();
+    rocblas_two_sum(sum_r, err_r, v.real());
+    rocblas_two_sum(sum_i, err_i, v.imag());
+    sum = rocblas_complex_num<T>(sum_r, sum_i);
+    err = rocblas_complex_num<T>(err_r, err_i);
+}
+
+struct rocblas_reduce_compensated_sum
+{
+    template <typename T>
+    __forceinline__ __device__ void operator()(rocblas_compensated_sum<T>& __restrict__ a,
+                                               const rocblas_compensated_sum<T>& __restrict__ b)
+    {
+        rocblas_two_sum(a.sum, a.err, b.sum);
+        a.err += b.err;
+    }
+};
+
+// Wraps the FETCH of a summation so that it starts a (sum, err) pair of type Tw
+template <typename FETCH, typename Tw>
+struct rocblas_fetch_compensated
+{
+    template <typename Ti>
+    __forceinline__ __device__ rocblas_compensated_sum<Tw> operator()(Ti x, ptrdiff_t tid)
+    {
+        return {Tw(FETCH{}(x, tid)), Tw(0)};
+    }
+};
+
+// Adds the accumulated error to the sum before applying the FINALIZE of the summation
+template <typename FINALIZE>
+struct rocblas_finalize_compensated
+{
+    template <typename T>
+    __forceinline__ __host__ __device__ auto operator()(const rocblas_compensated_sum<T>& x)
+    {
+        return FINALIZE{}(x.sum + x.err);
+    }
+};
+
 inline size_t rocblas_reduction_kernel_block_count(rocblas_int n, rocblas_int NB)
 {
     if(n <= 0)
@@ -158,8 +227,29 @@ inline size_t rocblas_reduction_kernel_block_count(rocblas_int n, rocblas_int NB
     return size_t(n - 1) / NB + 1;
 }
 
+// Reproducible reductions (rocblas_reduction_reproducible) split each vector into chunks of
+// 2 * rocblas_reproducible_reduction_NB elements, reduce every chunk with the same fixed-order
+// pairwise tree, and then reduce the chunk results level by level with that tree again. The
+// summation order depends only on n, never on the NB of the calling routine, the grid size,
+// the wavefront size or batch_count, so results are bitwise identical across those.
+static constexpr rocblas_int rocblas_reproducible_reduction_NB = 512;
+
+// Number of partial results per batch instance stored by all levels of the reproducible tree
+// except the last one, which writes the final result
+inline size_t rocblas_reproducible_reduction_partials(rocblas_int n)
+{
+    static constexpr rocblas_int chunk = 2 * rocblas_reproducible_reduction_NB;
+
+    size_t partials = 0;
+    for(rocblas_int m = rocblas_reduction_kernel_block_count(n, chunk); m > 1;
+        m             = rocblas_reduction_kernel_block_count(m, chunk))
+        partials += m;
+    return partials;
+}
+
 /*! \brief rocblas_reduction_batched_kernel_workspace_size
-    Work area for reduction must be at lease sizeof(To) * (blocks + 1) * batch_count
+    Work area for reduction must be at lease sizeof(To) * (blocks + 1) * batch_count, doubled in
+    the rocblas_accuracy_compensated mode, which reduces (sum, err) pairs
 
     @param[in]
     outputType To*
@@ -167,20 +257,31 @@ inline size_t rocblas_reduction_kernel_block_count(rocblas_int n, rocblas_int NB
     @param[in]
     batch_count rocblas_int
         Number of batches
+    @param[in]
+    accuracy_mode rocblas_accuracy_mode
+        Accuracy mode of the handle
     ********************************************************************/
 template <rocblas_int NB, typename To>
-size_t rocblas_reduction_kernel_workspace_size(rocblas_int n, rocblas_int batch_count = 1)
+size_t rocblas_reduction_kernel_workspace_size(rocblas_int           n,
+                                               rocblas_int           batch_count,
+                                               rocblas_accuracy_mode accuracy_mode)
 {
     if(n <= 0)
         n = 1; // allow for return value of empty set
     if(batch_count <= 0)
         batch_count = 1;
     auto blocks = rocblas_reduction_kernel_block_count(n, NB);
-    return sizeof(To) * (blocks + 1) * batch_count;
+    // also large enough for the tree used when the handle requests reproducible reductions
+    blocks = std::max(blocks, rocblas_reproducible_reduction_partials(n));
+    size_t size = accuracy_mode == rocblas_accuracy_compensated
+                      ? sizeof(rocblas_compensated_sum<To>)
+                      : sizeof(To);
+    return size * (blocks + 1) * batch_count;
 }
 
 /*! \brief rocblas_reduction_batched_kernel_workspace_size
-    Work area for reduction must be at lease sizeof(To) * (blocks + 1) * batch_count
+    Work area for reduction must be at lease sizeof(To) * (blocks + 1) * batch_count, doubled in
+    the rocblas_accuracy_compensated mode
 
     @param[in]
     outputType To*
@@ -188,33 +289,43 @@ size_t rocblas_reduction_kernel_workspace_size(rocblas_int n, rocblas_int batch_
     @param[in]
     batch_count rocblas_int
         Number of batches
+    @param[in]
+    accuracy_mode rocblas_accuracy_mode
+        Accuracy mode of the handle
     ********************************************************************/
 template <rocblas_int NB, typename To>
-size_t
-    rocblas_reduction_kernel_workspace_size(rocblas_int n, rocblas_int batch_count, To* output_type)
+size_t rocblas_reduction_kernel_workspace_size(rocblas_int           n,
+                                               rocblas_int           batch_count,
+                                               To*                   output_type,
+                                               rocblas_accuracy_mode accuracy_mode)
 {
-    return rocblas_reduction_kernel_workspace_size<NB, To>(n, batch_count);
+    return rocblas_reduction_kernel_workspace_size<NB, To>(n, batch_count, accuracy_mode);
 }
 
 template <rocblas_int NB>
-size_t rocblas_reduction_kernel_workspace_size(rocblas_int      n,
-                                               rocblas_int      batch_count,
-                                               rocblas_datatype type)
+size_t rocblas_reduction_kernel_workspace_size(rocblas_int           n,
+                                               rocblas_int           batch_count,
+                                               rocblas_datatype      type,
+                                               rocblas_accuracy_mode accuracy_mode)
 {
     switch(type)
     {
     case rocblas_datatype_f16_r:
-        return rocblas_reduction_kernel_workspace_size<NB, rocblas_half>(n, batch_count);
+        return rocblas_reduction_kernel_workspace_size<NB, rocblas_half>(
+            n, batch_count, accuracy_mode);
     case rocblas_datatype_bf16_r:
-        return rocblas_reduction_kernel_workspace_size<NB, rocblas_bfloat16>(n, batch_count);
+        return rocblas_reduction_kernel_workspace_size<NB, rocblas_bfloat16>(
+            n, batch_count, accuracy_mode);
     case rocblas_datatype_f32_r:
-        return rocblas_reduction_kernel_workspace_size<NB, float>(n, batch_count);
+        return rocblas_reduction_kernel_workspace_size<NB, float>(n, batch_count, accuracy_mode);
     case rocblas_datatype_f64_r:
-        return rocblas_reduction_kernel_workspace_size<NB, double>(n, batch_count);
+        return rocblas_reduction_kernel_workspace_size<NB, double>(n, batch_count, accuracy_mode);
     case rocblas_datatype_f32_c:
-        return rocblas_reduction_kernel_workspace_size<NB, rocblas_float_complex>(n, batch_count);
+        return rocblas_reduction_kernel_workspace_size<NB, rocblas_float_complex>(
+            n, batch_count, accuracy_mode);
     case rocblas_datatype_f64_c:
-        return rocblas_reduction_kernel_workspace_size<NB, rocblas_double_complex>(n, batch_count);
+        return rocblas_reduction_kernel_workspace_size<NB, rocblas_double_complex>(
+            n, batch_count, accuracy_mode);
     default:
         return 0;
     }
@@ -255,6 +366,53 @@ ROCBLAS_KERNEL void
         workspace[hipBlockIdx_y * nblocks + hipBlockIdx_x] = tmp[0];
 }
 
+// unit stride variant of kernel 1 for sums, where each thread reduces one vector of
+// rocblas_vec_width elements before the block reduction
+template <rocblas_int NB,
+          typename FETCH,
+          typename REDUCE = rocblas_reduce_sum,
+          typename TPtrX,
+          typename To>
+__attribute__((amdgpu_flat_work_group_size((NB < 128) ? NB : 128, (NB > 256) ? NB : 256)))
+ROCBLAS_KERNEL void
+    rocblas_reduction_strided_batched_kernel_part1_inc1(rocblas_int    n,
+                                                        rocblas_int    nblocks,
+                                                        TPtrX          xvec,
+                                                        rocblas_int    shiftx,
+                                                        rocblas_stride stridex,
+                                                        To*            workspace)
+{
+    constexpr rocblas_int VW = rocblas_vec_width<rocblas_vec_elem_t<TPtrX>>;
+
+    ptrdiff_t     tx  = hipThreadIdx_x;
+    ptrdiff_t     tid = hipBlockIdx_x * hipBlockDim_x + tx;
+    ptrdiff_t     nv  = n / VW;
+    __shared__ To tmp[NB];
+
+    const auto* x = load_ptr_batch(xvec, hipBlockIdx_y, shiftx, stridex);
+
+    To sum = rocblas_default_value<To>{}();
+    if(tid < nv)
+    {
+        auto v = rocblas_vec_load(x, tid, rocblas_vec_aligned(x));
+#pragma unroll
+        for(rocblas_int k = 0; k < VW; k++)
+            REDUCE{}(sum, FETCH{}(v[k], tid * VW + k));
+    }
+
+    // peeled remainder of the n % VW last elements
+    ptrdiff_t i = nv * VW + tid;
+    if(i < n)
+        REDUCE{}(sum, FETCH{}(x[i], i));
+
+    tmp[tx] = sum;
+
+    rocblas_reduction<NB, REDUCE>(tx, tmp);
+
+    if(tx == 0)
+        workspace[hipBlockIdx_y * nblocks + hipBlockIdx_x] = tmp[0];
+}
+
 // kernel 2 is used from non-strided reduction_batched see include file
 // kernel 2 gathers all the partial results in workspace and finishes the final reduction;
 // number of threads (NB) loop blocks
@@ -304,6 +462,159 @@ ROCBLAS_KERNEL void
         result[hipBlockIdx_y] = Tr(FINALIZE{}(tmp[0]));
 }
 
+// Identity fetch used by the upper levels of the reproducible reduction tree
+struct rocblas_fetch_identity
+{
+    template <typename T>
+    __forceinline__ __device__ T operator()(T x, ptrdiff_t)
+    {
+        return x;
+    }
+};
+
+// each block reduces a chunk of 2 * NB elements with a fixed-order pairwise tree: element i is
+// paired with element i + NB, and the NB sums are then reduced by rocblas_reduction. A level with
+// a single block per batch instance is the last one and finalizes its result into output
+template <rocblas_int NB,
+          typename FETCH,
+          typename REDUCE,
+          typename FINALIZE,
+          typename TPtrX,
+          typename To,
+          typename Tr>
+__attribute__((amdgpu_flat_work_group_size((NB < 128) ? NB : 128, (NB > 256) ? NB : 256)))
+ROCBLAS_KERNEL void rocblas_reproducible_reduction_kernel(rocblas_int    n,
+                                                          TPtrX          xvec,
+                                                          rocblas_int    shiftx,
+                                                          rocblas_int    incx,
+                                                          rocblas_stride stridex,
+                                                          To*            partials,
+                                                          Tr*            output)
+{
+    ptrdiff_t     tx = hipThreadIdx_x;
+    ptrdiff_t     i  = ptrdiff_t(hipBlockIdx_x) * 2 * NB + tx;
+    __shared__ To tmp[NB];
+
+    const auto* x = load_ptr_batch(xvec, hipBlockIdx_y, shiftx, stridex);
+
+    // pad with default value so that the tree shape only depends on the chunk size
+    To upper = i + NB < n ? FETCH{}(x[(i + NB) * incx], i + NB) : rocblas_default_value<To>{}();
+    tmp[tx]  = i < n ? FETCH{}(x[i * incx], i) : rocblas_default_value<To>{}();
+    REDUCE{}(tmp[tx], upper);
+
+    rocblas_reduction<NB, REDUCE>(tx, tmp);
+
+    if(tx == 0)
+    {
+        if(hipGridDim_x == 1)
+            output[hipBlockIdx_y] = Tr(FINALIZE{}(tmp[0]));
+        else
+            partials[hipBlockIdx_y * hipGridDim_x + hipBlockIdx_x] = tmp[0];
+    }
+}
+
+/*! \brief
+
+    \details
+    rocblas_reproducible_reduction_finish reduces the chunk results of the first level of a
+              reproducible reduction, level by level, until a single result per batch instance remains.
+    @param[in]
+    blocks    rocblas_int
+              number of chunk results per batch instance written by the first level.
+    @param[in]
+    partials  To*
+              workspace holding the first level results, followed by room for the upper levels.
+    @param[in]
+    output    Tr*
+              results on the device: result itself in device pointer mode, otherwise the
+              workspace slot following all partial results.
+    @param[out]
+    result    Tr*
+              pointer to array of batch_count size for results. either on the host CPU or device GPU.
+              results are copied from output to the host when result differs from output.
+    ********************************************************************/
+template <rocblas_int NB, typename REDUCE, typename FINALIZE, typename To, typename Tr>
+rocblas_status rocblas_reproducible_reduction_finish(rocblas_handle __restrict__ handle,
+                                                     rocblas_int blocks,
+                                                     rocblas_int batch_count,
+                                                     To*         partials,
+                                                     Tr*         output,
+                                                     Tr*         result)
+{
+    while(blocks > 1)
+    {
+        rocblas_int next          = rocblas_reduction_kernel_block_count(blocks, 2 * NB);
+        To*         next_partials = partials + size_t(blocks) * batch_count;
+
+        hipLaunchKernelGGL(
+            (rocblas_reproducible_reduction_kernel<NB, rocblas_fetch_identity, REDUCE, FINALIZE>),
+            dim3(next, batch_count),
+            NB,
+            0,
+            handle->get_stream(),
+            blocks,
+            (const To*)partials,
+            0,
+            1,
+            rocblas_stride(blocks),
+            next_partials,
+            output);
+
+        partials = next_partials;
+        blocks   = next;
+    }
+
+    // the last level always finalizes on the device, so both pointer modes give identical bits
+    if(result != output)
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(result, output, batch_count * sizeof(Tr), hipMemcpyDeviceToHost));
+
+    return rocblas_status_success;
+}
+
+// reproducible variant of rocblas_reduction_strided_batched_kernel; the workspace size returned by
+// rocblas_reduction_kernel_workspace_size for any NB is sufficient
+template <typename FETCH,
+          typename REDUCE,
+          typename FINALIZE,
+          typename TPtrX,
+          typename To,
+          typename Tr>
+rocblas_status
+    rocblas_reproducible_reduction_strided_batched_kernel(rocblas_handle __restrict__ handle,
+                                                          rocblas_int    n,
+                                                          TPtrX          x,
+                                                          rocblas_int    shiftx,
+                                                          rocblas_int    incx,
+                                                          rocblas_stride stridex,
+                                                          rocblas_int    batch_count,
+                                                          To*            workspace,
+                                                          Tr*            result)
+{
+    static constexpr rocblas_int NB = rocblas_reproducible_reduction_NB;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, 2 * NB);
+    Tr*         output = result;
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+        output = (Tr*)(workspace + rocblas_reproducible_reduction_partials(n) * batch_count);
+
+    hipLaunchKernelGGL((rocblas_reproducible_reduction_kernel<NB, FETCH, REDUCE, FINALIZE>),
+                       dim3(blocks, batch_count),
+                       NB,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex,
+                       workspace,
+                       output);
+
+    return rocblas_reproducible_reduction_finish<NB, REDUCE, FINALIZE>(
+        handle, blocks, batch_count, workspace, output, result);
+}
+
 /*! \brief
 
     \details
@@ -336,7 +647,7 @@ ROCBLAS_KERNEL void
     workspace To*
               temporary GPU buffer for inidividual block results for each batch
               and results buffer in case result pointer is to host memory
-              Size must be (blocks+1)*batch_count*sizeof(To)
+              Size must be (blocks+1)*batch_count*sizeof(To), doubled for compensated sums
     @param[out]
     result
               pointers to array of batch_count size for results. either on the host CPU or device GPU.
@@ -359,20 +670,60 @@ rocblas_status rocblas_reduction_strided_batched_kernel(rocblas_handle __restric
                                                         To*            workspace,
                                                         Tr*            result)
 {
-    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
+    // compensated sums run through the same kernels on (sum, err) pairs, reinterpreting the
+    // workspace which rocblas_reduction_kernel_workspace_size sized for them in this mode
+    if constexpr(std::is_same<REDUCE, rocblas_reduce_sum>{})
+    {
+        if(handle->accuracy_mode == rocblas_accuracy_compensated)
+            return rocblas_reduction_strided_batched_kernel<NB,
+                                                            rocblas_fetch_compensated<FETCH, To>,
+                                                            rocblas_reduce_compensated_sum,
+                                                            rocblas_finalize_compensated<FINALIZE>>(
+                handle,
+                n,
+                x,
+                shiftx,
+                incx,
+                stridex,
+                batch_count,
+                (rocblas_compensated_sum<To>*)workspace,
+                result);
+    }
 
-    hipLaunchKernelGGL((rocblas_reduction_strided_batched_kernel_part1<NB, FETCH, REDUCE>),
-                       dim3(blocks, batch_count),
-                       NB,
-                       0,
-                       handle->get_stream(),
-                       n,
-                       blocks,
-                       x,
-                       shiftx,
-                       incx,
-                       stridex,
-                       workspace);
+    if(handle->reduction_mode == rocblas_reduction_reproducible)
+        return rocblas_reproducible_reduction_strided_batched_kernel<FETCH, REDUCE, FINALIZE>(
+            handle, n, x, shiftx, incx, stridex, batch_count, workspace, result);
+
+    // sums of unit stride vectors load one vector of rocblas_vec_width elements per thread
+    bool        inc1_sum = std::is_same<REDUCE, rocblas_reduce_sum>{} && incx == 1;
+    rocblas_int chunk    = inc1_sum ? NB * rocblas_vec_width<rocblas_vec_elem_t<TPtrX>> : NB;
+    rocblas_int blocks   = rocblas_reduction_kernel_block_count(n, chunk);
+
+    if(inc1_sum)
+        hipLaunchKernelGGL((rocblas_reduction_strided_batched_kernel_part1_inc1<NB, FETCH, REDUCE>),
+                           dim3(blocks, batch_count),
+                           NB,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           blocks,
+                           x,
+                           shiftx,
+                           stridex,
+                           workspace);
+    else
+        hipLaunchKernelGGL((rocblas_reduction_strided_batched_kernel_part1<NB, FETCH, REDUCE>),
+                           dim3(blocks, batch_count),
+                           NB,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           blocks,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           workspace);
 
     if(handle->pointer_mode == rocblas_pointer_mode_device)
     {
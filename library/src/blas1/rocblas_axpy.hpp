@@ -7,6 +7,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
+#include "rocblas_vector_access.hpp"
 
 //!
 //! @brief General kernel (batched, strided batched) of axpy.
@@ -41,20 +42,22 @@ ROCBLAS_KERNEL __launch_bounds__(NB) void axpy_kernel(rocblas_int    n,
 }
 
 //!
-//! @brief Optimized kernel for the AXPY floating points.
+//! @brief Unit stride kernel of AXPY, each thread updates one vector of rocblas_vec_width elements.
 //! @remark Increment are required to be equal to one, that's why they are unspecified.
 //!
 template <rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
-ROCBLAS_KERNEL __launch_bounds__(NB) void saxpy_2_kernel(rocblas_int    n,
-                                                         Ta             alpha_device_host,
-                                                         rocblas_stride stride_alpha,
-                                                         Tx __restrict__ x,
-                                                         ptrdiff_t      offset_x,
-                                                         rocblas_stride stride_x,
-                                                         Ty __restrict__ y,
-                                                         ptrdiff_t      offset_y,
-                                                         rocblas_stride stride_y)
+ROCBLAS_KERNEL __launch_bounds__(NB) void axpy_vec_kernel(rocblas_int    n,
+                                                          Ta             alpha_device_host,
+                                                          rocblas_stride stride_alpha,
+                                                          Tx __restrict__ x,
+                                                          ptrdiff_t      offset_x,
+                                                          rocblas_stride stride_x,
+                                                          Ty __restrict__ y,
+                                                          ptrdiff_t      offset_y,
+                                                          rocblas_stride stride_y)
 {
+    constexpr rocblas_int VW = rocblas_vec_width<rocblas_vec_elem_t<Ty>>;
+
     auto alpha = load_scalar(alpha_device_host, hipBlockIdx_y, stride_alpha);
     if(!alpha)
     {
@@ -63,21 +66,27 @@ ROCBLAS_KERNEL __launch_bounds__(NB) void saxpy_2_kernel(rocblas_int    n,
     auto* tx = load_ptr_batch(x, hipBlockIdx_y, offset_x, stride_x);
     auto* ty = load_ptr_batch(y, hipBlockIdx_y, offset_y, stride_y);
 
-    ptrdiff_t tid = (hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x) * 2;
+    ptrdiff_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    ptrdiff_t nv  = n / VW;
 
-    if(tid < n - 1)
+    if(tid < nv)
     {
-        // Each thread access contiguous elements for example Thread '0' access indices '0' and '1' of the vectors `x` and `y`
-        for(rocblas_int j = 0; j < 2; ++j)
+        bool aligned = rocblas_vec_aligned(tx) && rocblas_vec_aligned(ty);
+        auto vx      = rocblas_vec_load(tx, tid, aligned);
+        auto vy      = rocblas_vec_load(ty, tid, aligned);
+#pragma unroll
+        for(rocblas_int k = 0; k < VW; k++)
         {
-            ty[tid + j] = ty[tid + j] + Tex(alpha) * tx[tid + j];
+            vy[k] = vy[k] + Tex(alpha) * vx[k];
         }
+        rocblas_vec_store(ty, tid, vy, aligned);
     }
 
-    // If `n` is odd then the computation of last element in the vectors is covered below.
-    if(n % 2 != 0 && tid == n - 1)
+    // peeled remainder of the n % VW last elements
+    ptrdiff_t i = nv * VW + tid;
+    if(i < n)
     {
-        ty[tid] = ty[tid] + Tex(alpha) * tx[tid];
+        ty[i] = ty[i] + Tex(alpha) * tx[i];
     }
 }
 
@@ -260,9 +269,9 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     static constexpr bool using_rocblas_half
         = std::is_same<Ta, rocblas_half>::value && std::is_same<Tex, rocblas_half>::value;
 
-    // Using float ?
-    static constexpr bool using_rocblas_float
-        = std::is_same<Ty, rocblas_float*>{} || std::is_same<Ty, rocblas_float* const*>{};
+    // Same element type in x and y ?
+    static constexpr bool using_same_type
+        = std::is_same<rocblas_vec_elem_t<Tx>, rocblas_vec_elem_t<Ty>>{};
 
     static constexpr rocblas_stride stride_0 = 0;
 
@@ -319,27 +328,31 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         }
     }
 
-    else if(using_rocblas_float && unit_inc && batch_count <= 8192)
+    else if(using_same_type && unit_inc && batch_count <= 8192)
     {
-        // Optimized kernel for float Datatype when incx==1 && incy==1 && batch_count <= 8192
-        dim3 blocks(1 + ((n - 1) / (NB * 2)), batch_count);
+        // 128-bit accesses when incx==1 && incy==1 && batch_count <= 8192
+        dim3 blocks(rocblas_vec_blocks<rocblas_vec_elem_t<Ty>>(n, NB), batch_count);
         dim3 threads(NB);
 
-        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        // axpy_vec_kernel is only instantiated when x and y have the same element type
+        if constexpr(using_same_type)
         {
-            // clang-format off
-            hipLaunchKernelGGL((saxpy_2_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
-                               stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y);
-            // clang-format on
-        }
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+            {
+                // clang-format off
+                hipLaunchKernelGGL((axpy_vec_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
+                                   stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y);
+                // clang-format on
+            }
 
-        else
-        {
-            // Note: We do not support batched alpha on host.
-            // clang-format off
-            hipLaunchKernelGGL((saxpy_2_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
-                               stride_0, x, offset_x, stride_x, y, offset_y, stride_y);
-            // clang-format on
+            else
+            {
+                // Note: We do not support batched alpha on host.
+                // clang-format off
+                hipLaunchKernelGGL((axpy_vec_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
+                                   stride_0, x, offset_x, stride_x, y, offset_y, stride_y);
+                // clang-format on
+            }
         }
     }
 
@@ -0,0 +1,241 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_fused_level1.hpp"
+#include "utility.hpp"
+
+namespace
+{
+
+    template <typename T>
+    rocblas_status rocblas_axpy_dot_batched_impl(rocblas_handle  handle,
+                                                 rocblas_int     n,
+                                                 const T*        alpha,
+                                                 const T* const* x,
+                                                 rocblas_int     incx,
+                                                 T* const*       y,
+                                                 rocblas_int     incy,
+                                                 const T* const* z,
+                                                 rocblas_int     incz,
+                                                 rocblas_int     batch_count,
+                                                 T*              results,
+                                                 const char*     name,
+                                                 const char*     bench_name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_fused_level1_workspace_size<T>(n, batch_count);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      name,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      x,
+                      incx,
+                      y,
+                      incy,
+                      z,
+                      incz,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench",
+                      "-f",
+                      bench_name,
+                      "-r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--incx",
+                      incx,
+                      "--incy",
+                      incy,
+                      "--incd",
+                      incz,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "incy",
+                        incy,
+                        "incz",
+                        incz,
+                        "batch_count",
+                        batch_count);
+
+        // Quick return if possible.
+        if(batch_count <= 0)
+            return rocblas_status_success;
+
+        if(!results)
+            return rocblas_status_invalid_pointer;
+
+        if(n <= 0)
+        {
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                    results, 0, sizeof(*results) * batch_count, handle->get_stream()));
+            else
+                memset(results, 0, sizeof(*results) * batch_count);
+            return rocblas_status_success;
+        }
+
+        if(!alpha || !x || !y || !z)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status check_numerics_status
+                = rocblas_axpy_dot_check_numerics(name,
+                                                  handle,
+                                                  n,
+                                                  x,
+                                                  0,
+                                                  incx,
+                                                  0,
+                                                  y,
+                                                  0,
+                                                  incy,
+                                                  0,
+                                                  z,
+                                                  0,
+                                                  incz,
+                                                  0,
+                                                  batch_count,
+                                                  check_numerics,
+                                                  is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_axpy_dot_template<true>(handle,
+                                                                         n,
+                                                                         alpha,
+                                                                         x,
+                                                                         0,
+                                                                         incx,
+                                                                         0,
+                                                                         y,
+                                                                         0,
+                                                                         incy,
+                                                                         0,
+                                                                         z,
+                                                                         0,
+                                                                         incz,
+                                                                         0,
+                                                                         batch_count,
+                                                                         results,
+                                                                         (T*)w_mem);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status check_numerics_status
+                = rocblas_axpy_dot_check_numerics(name,
+                                                  handle,
+                                                  n,
+                                                  x,
+                                                  0,
+                                                  incx,
+                                                  0,
+                                                  y,
+                                                  0,
+                                                  incy,
+                                                  0,
+                                                  z,
+                                                  0,
+                                                  incz,
+                                                  0,
+                                                  batch_count,
+                                                  check_numerics,
+                                                  is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                   \
+    rocblas_status routine_name_(rocblas_handle  handle,          \
+                                 rocblas_int     n,               \
+                                 const T_*       alpha,           \
+                                 const T_* const x[],             \
+                                 rocblas_int     incx,            \
+                                 T_* const       y[],             \
+                                 rocblas_int     incy,            \
+                                 const T_* const z[],             \
+                                 rocblas_int     incz,            \
+                                 rocblas_int     batch_count,     \
+                                 T_*             results)         \
+    try                                                           \
+    {                                                             \
+        return rocblas_axpy_dot_batched_impl(handle,              \
+                                             n,                   \
+                                             alpha,               \
+                                             x,                   \
+                                             incx,                \
+                                             y,                   \
+                                             incy,                \
+                                             z,                   \
+                                             incz,                \
+                                             batch_count,         \
+                                             results,             \
+                                             #routine_name_,      \
+                                             "axpy_dot_batched"); \
+    }                                                             \
+    catch(...)                                                    \
+    {                                                             \
+        return exception_to_rocblas_status();                     \
+    }
+
+IMPL(rocblas_saxpy_dot_batched, float);
+IMPL(rocblas_daxpy_dot_batched, double);
+IMPL(rocblas_caxpy_dotc_batched, rocblas_float_complex);
+IMPL(rocblas_zaxpy_dotc_batched, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_fused_level1.hpp"
+#include "utility.hpp"
+
+namespace
+{
+
+    template <typename T>
+    rocblas_status rocblas_axpy_nrm2_impl(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       alpha,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          T*             y,
+                                          rocblas_int    incy,
+                                          real_t<T>*     result,
+                                          const char*    name,
+                                          const char*    bench_name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_fused_level1_workspace_size<real_t<T>>(n, 1);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, n, LOG_TRACE_SCALAR_VALUE(handle, alpha), x, incx, y, incy);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench",
+                      "-f",
+                      bench_name,
+                      "-r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--incx",
+                      incx,
+                      "--incy",
+                      incy);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "N", n, "incx", incx, "incy", incy);
+
+        if(!result)
+            return rocblas_status_invalid_pointer;
+
+        // Quick return if possible.
+        if(n <= 0)
+        {
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(
+                    hipMemsetAsync(result, 0, sizeof(*result), handle->get_stream()));
+            else
+                *result = real_t<T>(0);
+            return rocblas_status_success;
+        }
+
+        if(!alpha || !x || !y)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status check_numerics_status
+                = rocblas_axpy_check_numerics(name,
+                                              handle,
+                                              n,
+                                              x,
+                                              0,
+                                              incx,
+                                              0,
+                                              y,
+                                              0,
+                                              incy,
+                                              0,
+                                              1,
+                                              check_numerics,
+                                              is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_axpy_nrm2_template(handle,
+                                                                    n,
+                                                                    alpha,
+                                                                    x,
+                                                                    0,
+                                                                    incx,
+                                                                    0,
+                                                                    y,
+                                                                    0,
+                                                                    incy,
+                                                                    0,
+                                                                    1,
+                                                                    result,
+                                                                    (real_t<T>*)w_mem);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status check_numerics_status
+                = rocblas_axpy_check_numerics(name,
+                                              handle,
+                                              n,
+                                              x,
+                                              0,
+                                              incx,
+                                              0,
+                                              y,
+                                              0,
+                                              incy,
+                                              0,
+                                              1,
+                                              check_numerics,
+                                              is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                         \
+    rocblas_status routine_name_(rocblas_handle handle, \
+                                 rocblas_int    n,      \
+                                 const T_*      alpha,  \
+                                 const T_*      x,      \
+                                 rocblas_int    incx,   \
+                                 T_*            y,      \
+                                 rocblas_int    incy,   \
+                                 real_t<T_>*    result) \
+    try                                                 \
+    {                                                   \
+        return rocblas_axpy_nrm2_impl(handle,           \
+                                      n,                \
+                                      alpha,            \
+                                      x,                \
+                                      incx,             \
+                                      y,                \
+                                      incy,             \
+                                      result,           \
+                                      #routine_name_,   \
+                                      "axpy_nrm2");     \
+    }                                                   \
+    catch(...)                                          \
+    {                                                   \
+        return exception_to_rocblas_status();           \
+    }
+
+IMPL(rocblas_saxpy_nrm2, float);
+IMPL(rocblas_daxpy_nrm2, double);
+IMPL(rocblas_caxpy_nrm2, rocblas_float_complex);
+IMPL(rocblas_zaxpy_nrm2, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
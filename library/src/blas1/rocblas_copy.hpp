@@ -6,6 +6,7 @@
 
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "rocblas_vector_access.hpp"
 
 template <bool CONJ, typename U, typename V>
 ROCBLAS_KERNEL void copy_kernel(rocblas_int    n,
@@ -28,29 +29,40 @@ ROCBLAS_KERNEL void copy_kernel(rocblas_int    n,
     }
 }
 
-//! @brief Optimized kernel for the floating points.
+//! @brief Unit stride kernel, each thread copies one vector of rocblas_vec_width elements.
 //!
-template <rocblas_int NB, typename U, typename V>
-ROCBLAS_KERNEL __launch_bounds__(NB) void scopy_2_kernel(rocblas_int n,
-                                                         const U __restrict xa,
-                                                         ptrdiff_t      shiftx,
-                                                         rocblas_stride stridex,
-                                                         V __restrict ya,
-                                                         ptrdiff_t      shifty,
-                                                         rocblas_stride stridey)
+template <bool CONJ, rocblas_int NB, typename U, typename V>
+ROCBLAS_KERNEL __launch_bounds__(NB) void copy_vec_kernel(rocblas_int n,
+                                                          const U __restrict xa,
+                                                          ptrdiff_t      shiftx,
+                                                          rocblas_stride stridex,
+                                                          V __restrict ya,
+                                                          ptrdiff_t      shifty,
+                                                          rocblas_stride stridey)
 {
-    ptrdiff_t   tid = (hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x) * 2;
+    constexpr rocblas_int VW = rocblas_vec_width<rocblas_vec_elem_t<V>>;
+
+    ptrdiff_t   tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    ptrdiff_t   nv  = n / VW;
     const auto* x   = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
     auto*       y   = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
-    if(tid < n - 1)
+    if(tid < nv)
     {
-        for(rocblas_int j = 0; j < 2; ++j)
+        bool aligned = rocblas_vec_aligned(x) && rocblas_vec_aligned(y);
+        auto v       = rocblas_vec_load(x, tid, aligned);
+        if(CONJ)
         {
-            y[tid + j] = x[tid + j];
+#pragma unroll
+            for(rocblas_int k = 0; k < VW; k++)
+                v[k] = conj(v[k]);
         }
+        rocblas_vec_store(y, tid, v, aligned);
     }
-    if(n % 2 != 0 && tid == n - 1)
-        y[tid] = x[tid];
+
+    // peeled remainder of the n % VW last elements
+    ptrdiff_t i = nv * VW + tid;
+    if(i < n)
+        y[i] = CONJ ? conj(x[i]) : x[i];
 }
 
 template <bool CONJ, rocblas_int NB, typename U, typename V>
@@ -73,10 +85,7 @@ rocblas_status rocblas_copy_template(rocblas_handle handle,
     if(!x || !y)
         return rocblas_status_invalid_pointer;
 
-    static constexpr bool using_rocblas_float
-        = std::is_same<V, rocblas_float*>{} || std::is_same<V, rocblas_float* const*>{};
-
-    if(!using_rocblas_float || incx != 1 || incy != 1)
+    if(incx != 1 || incy != 1)
     {
         // In case of negative inc shift pointer to end of data for negative indexing tid*inc
         ptrdiff_t shiftx = offsetx - ((incx < 0) ? ptrdiff_t(incx) * (n - 1) : 0);
@@ -103,28 +112,22 @@ rocblas_status rocblas_copy_template(rocblas_handle handle,
     }
     else
     {
-        // Kernel function for improving the performance of SCOPY when incx==1 and incy==1
-
-        // In case of negative inc shift pointer to end of data for negative indexing tid*inc
-        ptrdiff_t shiftx = offsetx - 0;
-        ptrdiff_t shifty = offsety - 0;
-
-        int         blocks = 1 + ((n - 1) / (NB * 2));
-        dim3        grid(blocks, batch_count);
-        dim3        threads(NB);
-        hipStream_t scopy_stream = handle->get_stream();
+        // 128-bit accesses when incx == 1 and incy == 1
+        int  blocks = rocblas_vec_blocks<rocblas_vec_elem_t<V>>(n, NB);
+        dim3 grid(blocks, batch_count);
+        dim3 threads(NB);
 
-        hipLaunchKernelGGL(scopy_2_kernel<NB>,
+        hipLaunchKernelGGL((copy_vec_kernel<CONJ, NB>),
                            grid,
                            threads,
                            0,
-                           scopy_stream,
+                           handle->get_stream(),
                            n,
                            x,
-                           shiftx,
+                           ptrdiff_t(offsetx),
                            stridex,
                            y,
-                           shifty,
+                           ptrdiff_t(offsety),
                            stridey);
     }
     return rocblas_status_success;
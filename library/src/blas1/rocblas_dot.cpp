@@ -47,7 +47,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB * WIN, T2>(n);
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB * WIN, T2>(
+            n, 1, handle->accuracy_mode);
         if(handle->is_device_memory_size_query())
         {
             if(n <= 0)
@@ -8,6 +8,7 @@
 #include "handle.hpp"
 #include "logging.hpp"
 #include "reduction_strided_batched.hpp"
+#include "rocblas_vector_access.hpp"
 #include "utility.hpp"
 #include <hip/hip_runtime.h>
 
@@ -143,6 +144,7 @@ __inline__ __device__ void
     }
 }
 
+// unit stride kernel, each thread sums WIN vectors of rocblas_vec_width<T> elements
 template <bool        ONE_BLOCK,
           rocblas_int NB,
           rocblas_int WIN,
@@ -160,108 +162,36 @@ ROCBLAS_KERNEL __launch_bounds__(NB) void rocblas_dot_kernel_inc1(rocblas_int n,
                                                                   V* __restrict__ workspace,
                                                                   T* __restrict__ out)
 {
-    const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
-    const T* y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
-
-    int i = !ONE_BLOCK ? hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x : hipThreadIdx_x;
-
-    V sum = 0;
-
-    // sum WIN elements per thread
-    int inc = !ONE_BLOCK ? hipBlockDim_x * hipGridDim_x : hipBlockDim_x;
-    for(int j = 0; j < WIN && i < n; j++, i += inc)
-    {
-        sum += V(y[i]) * V(CONJ ? conj(x[i]) : x[i]);
-    }
-
-    sum = rocblas_dot_block_reduce<NB>(sum);
+    constexpr rocblas_int VW = rocblas_vec_width<T>;
 
-    rocblas_dot_save_sum<ONE_BLOCK>(sum, workspace, out);
-}
-
-template <bool        ONE_BLOCK,
-          rocblas_int NB,
-          rocblas_int WIN,
-          bool        CONJ,
-          typename T,
-          typename U,
-          typename V,
-          std::enable_if_t<!std::is_same<T, rocblas_half>{} && !std::is_same<T, rocblas_bfloat16>{}
-                               && !std::is_same<T, rocblas_float>{},
-                           int> = 0>
-ROCBLAS_KERNEL __launch_bounds__(NB) void rocblas_dot_kernel_inc1by2(rocblas_int n,
-                                                                     const U __restrict__ xa,
-                                                                     ptrdiff_t      shiftx,
-                                                                     rocblas_stride stridex,
-                                                                     const U __restrict__ ya,
-                                                                     ptrdiff_t   shifty,
-                                                                     rocblas_int stridey,
-                                                                     V* __restrict__ workspace,
-                                                                     T* __restrict__ out)
-{
     const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
     const T* y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
 
-    int i = !ONE_BLOCK ? hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x : hipThreadIdx_x;
+    int i  = !ONE_BLOCK ? hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x : hipThreadIdx_x;
+    int nv = n / VW;
 
     V sum = 0;
 
-    // sum WIN elements per thread
-    int inc = !ONE_BLOCK ? hipBlockDim_x * hipGridDim_x : hipBlockDim_x;
-    for(int j = 0; j < WIN && i < n; j++, i += inc)
+    // peeled remainder of the n % VW last elements
+    if(i < n - nv * VW)
     {
-        sum += V(y[i]) * V(CONJ ? conj(x[i]) : x[i]);
+        int r = nv * VW + i;
+        sum += V(y[r]) * V(CONJ ? conj(x[r]) : x[r]);
     }
 
-    sum = rocblas_dot_block_reduce<NB>(sum);
-
-    rocblas_dot_save_sum<ONE_BLOCK>(sum, workspace, out);
-}
-
-template <bool        ONE_BLOCK,
-          rocblas_int NB,
-          rocblas_int WIN,
-          bool        CONJ,
-          typename T,
-          typename U,
-          typename V,
-          std::enable_if_t<std::is_same<T, rocblas_half>{} || std::is_same<T, rocblas_bfloat16>{}
-                               || std::is_same<T, rocblas_float>{},
-                           int> = 0>
-ROCBLAS_KERNEL __launch_bounds__(NB) void rocblas_dot_kernel_inc1by2(rocblas_int n,
-                                                                     const U __restrict__ xa,
-                                                                     ptrdiff_t      shiftx,
-                                                                     rocblas_stride stridex,
-                                                                     const U __restrict__ ya,
-                                                                     ptrdiff_t   shifty,
-                                                                     rocblas_int stridey,
-                                                                     V* __restrict__ workspace,
-                                                                     T* __restrict__ out)
-{
-    const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
-    const T* y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
-
-    int i = !ONE_BLOCK ? hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x : hipThreadIdx_x;
-    i *= 2;
-
-    V sum = 0;
-
-    // sum WIN elements per thread
-    int inc = !ONE_BLOCK ? hipBlockDim_x * hipGridDim_x : hipBlockDim_x;
-    inc *= 2;
-    for(int j = 0; j < WIN && i < n - 1; j++, i += inc)
+    // sum WIN vectors per thread
+    bool aligned = rocblas_vec_aligned(x) && rocblas_vec_aligned(y);
+    int  inc     = !ONE_BLOCK ? hipBlockDim_x * hipGridDim_x : hipBlockDim_x;
+    for(int j = 0; j < WIN && i < nv; j++, i += inc)
     {
+        auto vx = rocblas_vec_load(x, i, aligned);
+        auto vy = rocblas_vec_load(y, i, aligned);
 #pragma unroll
-        for(rocblas_int k = 0; k < 2; ++k)
+        for(rocblas_int k = 0; k < VW; ++k)
         {
-            sum += V(y[i + k]) * V(CONJ ? conj(x[i + k]) : x[i + k]);
+            sum += V(vy[k]) * V(CONJ ? conj(vx[k]) : vx[k]);
         }
     }
-    // If `n` is odd then the computation of last element is covered below.
-    if(n % 2 && i == n - 1)
-    {
-        sum += V(y[i]) * V(CONJ ? conj(x[i]) : x[i]);
-    }
 
     sum = rocblas_dot_block_reduce<NB>(sum);
 
@@ -367,6 +297,97 @@ ROCBLAS_KERNEL __launch_bounds__(NB) void rocblas_dot_kernel_reduce(rocblas_int
         out[hipBlockIdx_y] = T(sum);
 }
 
+// reproducible dot: each block forms the products of a chunk of 2 * NB elements and sums them
+// with the fixed-order pairwise tree of rocblas_reproducible_reduction_kernel. The products of
+// type V are fetched into partial results of type W, which are (sum, err) pairs when compensated
+template <rocblas_int NB,
+          bool        CONJ,
+          typename FETCH,
+          typename REDUCE,
+          typename FINALIZE,
+          typename T,
+          typename V,
+          typename U,
+          typename W>
+ROCBLAS_KERNEL __launch_bounds__(NB) void rocblas_dot_reproducible_kernel(rocblas_int n,
+                                                                          const U __restrict__ xa,
+                                                                          ptrdiff_t      shiftx,
+                                                                          rocblas_int    incx,
+                                                                          rocblas_stride stridex,
+                                                                          const U __restrict__ ya,
+                                                                          ptrdiff_t      shifty,
+                                                                          rocblas_int    incy,
+                                                                          rocblas_stride stridey,
+                                                                          W* __restrict__ partials,
+                                                                          T* __restrict__ output)
+{
+    const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+    const T* y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+
+    ptrdiff_t    tx = hipThreadIdx_x;
+    ptrdiff_t    i  = ptrdiff_t(hipBlockIdx_x) * 2 * NB + tx;
+    ptrdiff_t    j  = i + NB;
+    __shared__ W tmp[NB];
+
+    W upper = rocblas_default_value<W>{}();
+    if(j < n)
+        upper = FETCH{}(V(y[j * incy]) * V(CONJ ? conj(x[j * incx]) : x[j * incx]), j);
+
+    W lower = rocblas_default_value<W>{}();
+    if(i < n)
+        lower = FETCH{}(V(y[i * incy]) * V(CONJ ? conj(x[i * incx]) : x[i * incx]), i);
+
+    tmp[tx] = lower;
+    REDUCE{}(tmp[tx], upper);
+
+    rocblas_reduction<NB, REDUCE>(tx, tmp);
+
+    if(tx == 0)
+    {
+        if(hipGridDim_x == 1)
+            output[hipBlockIdx_y] = T(FINALIZE{}(tmp[0]));
+        else
+            partials[hipBlockIdx_y * hipGridDim_x + hipBlockIdx_x] = tmp[0];
+    }
+}
+
+// compensated dot: each thread accumulates WIN products into a (sum, err) pair with error-free
+// additions, and the pairs of a block are reduced with the shared memory tree
+template <rocblas_int NB, rocblas_int WIN, bool CONJ, typename T, typename U, typename V>
+ROCBLAS_KERNEL __launch_bounds__(NB) void
+    rocblas_dot_compensated_kernel(rocblas_int n,
+                                   const U __restrict__ xa,
+                                   ptrdiff_t      shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   const U __restrict__ ya,
+                                   ptrdiff_t      shifty,
+                                   rocblas_int    incy,
+                                   rocblas_stride stridey,
+                                   rocblas_compensated_sum<V>* __restrict__ workspace)
+{
+    const T* x = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+    const T* y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+
+    ptrdiff_t                             tx = hipThreadIdx_x;
+    ptrdiff_t                             i  = ptrdiff_t(hipBlockIdx_x) * NB + tx;
+    __shared__ rocblas_compensated_sum<V> tmp[NB];
+
+    rocblas_compensated_sum<V> sum = rocblas_default_value<rocblas_compensated_sum<V>>{}();
+
+    // sum WIN elements per thread
+    ptrdiff_t inc = ptrdiff_t(NB) * hipGridDim_x;
+    for(int j = 0; j < WIN && i < n; j++, i += inc)
+        rocblas_two_sum(
+            sum.sum, sum.err, V(y[i * incy]) * V(CONJ ? conj(x[i * incx]) : x[i * incx]));
+
+    tmp[tx] = sum;
+    rocblas_reduction<NB, rocblas_reduce_compensated_sum>(tx, tmp);
+
+    if(tx == 0)
+        workspace[hipBlockIdx_y * hipGridDim_x + hipBlockIdx_x] = tmp[0];
+}
+
 // work item number (WIN) of elements to process
 template <typename T>
 constexpr int rocblas_dot_WIN()
@@ -393,6 +414,121 @@ constexpr int rocblas_dot_WIN(size_t nb)
     return n;
 }
 
+// dot with the reproducible chunking of rocblas_reproducible_reduction_strided_batched_kernel;
+// FETCH, REDUCE and FINALIZE select plain or compensated sums of the products
+template <bool CONJ,
+          typename FETCH,
+          typename REDUCE,
+          typename FINALIZE,
+          typename T,
+          typename V,
+          typename U,
+          typename W>
+rocblas_status rocblas_dot_reproducible_template(rocblas_handle __restrict__ handle,
+                                                 rocblas_int n,
+                                                 const U __restrict__ x,
+                                                 ptrdiff_t      shiftx,
+                                                 rocblas_int    incx,
+                                                 rocblas_stride stridex,
+                                                 const U __restrict__ y,
+                                                 ptrdiff_t      shifty,
+                                                 rocblas_int    incy,
+                                                 rocblas_stride stridey,
+                                                 rocblas_int    batch_count,
+                                                 T* __restrict__ results,
+                                                 W* __restrict__ workspace)
+{
+    // fixed chunking independent of NB, WIN and the one block threshold of the default path
+    static constexpr rocblas_int RNB = rocblas_reproducible_reduction_NB;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, 2 * RNB);
+    T*          output = results;
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+        output = (T*)(workspace + rocblas_reproducible_reduction_partials(n) * batch_count);
+
+    hipLaunchKernelGGL(
+        (rocblas_dot_reproducible_kernel<RNB, CONJ, FETCH, REDUCE, FINALIZE, T, V>),
+        dim3(blocks, batch_count),
+        RNB,
+        0,
+        handle->get_stream(),
+        n,
+        x,
+        shiftx,
+        incx,
+        stridex,
+        y,
+        shifty,
+        incy,
+        stridey,
+        workspace,
+        output);
+
+    return rocblas_reproducible_reduction_finish<RNB, REDUCE, FINALIZE>(
+        handle, blocks, batch_count, workspace, output, results);
+}
+
+// compensated dot; the per-block (sum, err) pairs are finished by the generic reduction part2
+template <rocblas_int NB, rocblas_int WIN, bool CONJ, typename T, typename U, typename V>
+rocblas_status rocblas_dot_compensated_template(rocblas_handle __restrict__ handle,
+                                                rocblas_int n,
+                                                const U __restrict__ x,
+                                                ptrdiff_t      shiftx,
+                                                rocblas_int    incx,
+                                                rocblas_stride stridex,
+                                                const U __restrict__ y,
+                                                ptrdiff_t      shifty,
+                                                rocblas_int    incy,
+                                                rocblas_stride stridey,
+                                                rocblas_int    batch_count,
+                                                T* __restrict__ results,
+                                                rocblas_compensated_sum<V>* __restrict__ workspace)
+{
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+    T*          output = results;
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+        output = (T*)(workspace + size_t(batch_count) * blocks);
+
+    hipLaunchKernelGGL((rocblas_dot_compensated_kernel<NB, WIN, CONJ, T>),
+                       dim3(blocks, batch_count),
+                       NB,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex,
+                       y,
+                       shifty,
+                       incy,
+                       stridey,
+                       workspace);
+
+    hipLaunchKernelGGL((rocblas_reduction_strided_batched_kernel_part2<
+                           NB,
+                           rocblas_reduce_compensated_sum,
+                           rocblas_finalize_compensated<rocblas_finalize_identity>>),
+                       dim3(1, batch_count),
+                       NB,
+                       0,
+                       handle->get_stream(),
+                       blocks,
+                       workspace,
+                       output);
+
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
+                                           output,
+                                           sizeof(T) * batch_count,
+                                           hipMemcpyDeviceToHost,
+                                           handle->get_stream()));
+    }
+
+    return rocblas_status_success;
+}
+
 // assume workspace has already been allocated, recommended for repeated calling of dot_strided_batched product
 // routine
 template <rocblas_int NB, bool CONJ, typename T, typename U, typename V = T>
@@ -442,6 +578,70 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
+    // in the compensated mode, rocblas_reduction_kernel_workspace_size sizes the workspace for
+    // (sum, err) pairs
+    bool compensated = handle->accuracy_mode == rocblas_accuracy_compensated;
+    auto pairs       = (rocblas_compensated_sum<V>*)workspace;
+
+    if(handle->reduction_mode == rocblas_reduction_reproducible)
+    {
+        if(compensated)
+            return rocblas_dot_reproducible_template<
+                CONJ,
+                rocblas_fetch_compensated<rocblas_fetch_identity, V>,
+                rocblas_reduce_compensated_sum,
+                rocblas_finalize_compensated<rocblas_finalize_identity>,
+                T,
+                V>(handle,
+                   n,
+                   x,
+                   shiftx,
+                   incx,
+                   stridex,
+                   y,
+                   shifty,
+                   incy,
+                   stridey,
+                   batch_count,
+                   results,
+                   pairs);
+        else
+            return rocblas_dot_reproducible_template<CONJ,
+                                                     rocblas_fetch_identity,
+                                                     rocblas_reduce_sum,
+                                                     rocblas_finalize_identity,
+                                                     T,
+                                                     V>(handle,
+                                                        n,
+                                                        x,
+                                                        shiftx,
+                                                        incx,
+                                                        stridex,
+                                                        y,
+                                                        shifty,
+                                                        incy,
+                                                        stridey,
+                                                        batch_count,
+                                                        results,
+                                                        workspace);
+    }
+
+    // the one block and inc1 kernels below accumulate plain sums
+    if(compensated)
+        return rocblas_dot_compensated_template<NB, WIN, CONJ>(handle,
+                                                               n,
+                                                               x,
+                                                               shiftx,
+                                                               incx,
+                                                               stridex,
+                                                               y,
+                                                               shifty,
+                                                               incy,
+                                                               stridey,
+                                                               batch_count,
+                                                               results,
+                                                               pairs);
+
     int single_block_threshold = 32768;
     if(std::is_same<T, float>{})
         single_block_threshold = 31000;
@@ -477,7 +677,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         {
             if(incx == 1 && incy == 1)
             {
-                hipLaunchKernelGGL((rocblas_dot_kernel_inc1by2<ONE_BLOCK, NB_OB, WIN_OB, CONJ, T>),
+                hipLaunchKernelGGL((rocblas_dot_kernel_inc1<ONE_BLOCK, NB_OB, WIN_OB, CONJ, T>),
                                    grid,
                                    threads,
                                    0,
@@ -540,19 +740,24 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     else
     {
         static constexpr bool ONE_BLOCK = false;
-        rocblas_int           blocks    = rocblas_reduction_kernel_block_count(n, NB * WIN);
-        dim3                  grid(blocks, batch_count);
-        dim3                  threads(NB);
-        size_t                offset = size_t(batch_count) * blocks;
-        T*                    output = results;
+
+        // the unit stride kernel sums WIN vectors per thread, so it needs fewer blocks
+        bool        not_magsq = x != y || incx != incy || offsetx != offsety || stridex != stridey;
+        bool        inc1      = not_magsq && incx == 1 && incy == 1;
+        rocblas_int chunk     = inc1 ? NB * WIN * rocblas_vec_width<T> : NB * WIN;
+        rocblas_int blocks    = rocblas_reduction_kernel_block_count(n, chunk);
+        dim3        grid(blocks, batch_count);
+        dim3        threads(NB);
+        size_t      offset = size_t(batch_count) * blocks;
+        T*          output = results;
         if(handle->pointer_mode != rocblas_pointer_mode_device)
         {
             output = (T*)(workspace + offset);
         }
 
-        if(x != y || incx != incy || offsetx != offsety || stridex != stridey)
+        if(not_magsq)
         {
-            if(incx == 1 && incy == 1)
+            if(inc1)
             {
                 hipLaunchKernelGGL((rocblas_dot_kernel_inc1<ONE_BLOCK, NB, WIN, CONJ, T>),
                                    grid,
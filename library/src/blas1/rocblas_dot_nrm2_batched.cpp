@@ -0,0 +1,191 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_fused_level1.hpp"
+#include "utility.hpp"
+
+namespace
+{
+
+    template <typename T>
+    rocblas_status rocblas_dot_nrm2_batched_impl(rocblas_handle  handle,
+                                                 rocblas_int     n,
+                                                 const T* const* x,
+                                                 rocblas_int     incx,
+                                                 const T* const* y,
+                                                 rocblas_int     incy,
+                                                 rocblas_int     batch_count,
+                                                 T*              dot_results,
+                                                 real_t<T>*      nrm2_results,
+                                                 const char*     name,
+                                                 const char*     bench_name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes
+            = rocblas_fused_level1_workspace_size<rocblas_dot_nrm2_sums<T>>(n, batch_count);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, n, x, incx, y, incy, batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench",
+                      "-f",
+                      bench_name,
+                      "-r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      "--incx",
+                      incx,
+                      "--incy",
+                      incy,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "incy",
+                        incy,
+                        "batch_count",
+                        batch_count);
+
+        // Quick return if possible.
+        if(batch_count <= 0)
+            return rocblas_status_success;
+
+        if(!dot_results || !nrm2_results)
+            return rocblas_status_invalid_pointer;
+
+        if(n <= 0)
+        {
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+            {
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                    dot_results, 0, sizeof(*dot_results) * batch_count, handle->get_stream()));
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                    nrm2_results, 0, sizeof(*nrm2_results) * batch_count, handle->get_stream()));
+            }
+            else
+            {
+                memset(dot_results, 0, sizeof(*dot_results) * batch_count);
+                memset(nrm2_results, 0, sizeof(*nrm2_results) * batch_count);
+            }
+            return rocblas_status_success;
+        }
+
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status check_numerics_status
+                = rocblas_dot_check_numerics(name,
+                                             handle,
+                                             n,
+                                             x,
+                                             0,
+                                             incx,
+                                             0,
+                                             y,
+                                             0,
+                                             incy,
+                                             0,
+                                             batch_count,
+                                             check_numerics,
+                                             is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        return rocblas_internal_dot_nrm2_template<true>(handle,
+                                                        n,
+                                                        x,
+                                                        0,
+                                                        incx,
+                                                        0,
+                                                        y,
+                                                        0,
+                                                        incy,
+                                                        0,
+                                                        batch_count,
+                                                        dot_results,
+                                                        nrm2_results,
+                                                        (rocblas_dot_nrm2_sums<T>*)w_mem);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                   \
+    rocblas_status routine_name_(rocblas_handle  handle,          \
+                                 rocblas_int     n,               \
+                                 const T_* const x[],             \
+                                 rocblas_int     incx,            \
+                                 const T_* const y[],             \
+                                 rocblas_int     incy,            \
+                                 rocblas_int     batch_count,     \
+                                 T_*             dot_results,     \
+                                 real_t<T_>*     nrm2_results)    \
+    try                                                           \
+    {                                                             \
+        return rocblas_dot_nrm2_batched_impl(handle,              \
+                                             n,                   \
+                                             x,                   \
+                                             incx,                \
+                                             y,                   \
+                                             incy,                \
+                                             batch_count,         \
+                                             dot_results,         \
+                                             nrm2_results,        \
+                                             #routine_name_,      \
+                                             "dot_nrm2_batched"); \
+    }                                                             \
+    catch(...)                                                    \
+    {                                                             \
+        return exception_to_rocblas_status();                     \
+    }
+
+IMPL(rocblas_sdot_nrm2_batched, float);
+IMPL(rocblas_ddot_nrm2_batched, double);
+IMPL(rocblas_cdotc_nrm2_batched, rocblas_float_complex);
+IMPL(rocblas_zdotc_nrm2_batched, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
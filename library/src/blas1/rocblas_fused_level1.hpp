@@ -0,0 +1,614 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "fetch_template.hpp"
+#include "handle.hpp"
+#include "reduction_strided_batched.hpp"
+#include "rocblas_axpy.hpp"
+#include "rocblas_dot.hpp"
+#include "rocblas_nrm2.hpp"
+#include <memory>
+
+/*
+ * ===========================================================================
+ *    Fused level 1 routines: dot_nrm2, axpy_dot and axpy_nrm2
+ * ===========================================================================
+ */
+
+// Iterative solvers call dot, nrm2 and axpy back to back on the same vectors. The fused
+// routines read every vector once and reduce all results in one pass. Each block handles a
+// chunk of 2 * NB elements with the fixed-order pairwise tree of
+// rocblas_reproducible_reduction_kernel, so the partial results can be finished either by
+// the default part2 kernel or, in rocblas_reduction_reproducible mode, by
+// rocblas_reproducible_reduction_finish, giving the same bits as the unfused reproducible
+// dot and nrm2.
+static constexpr rocblas_int rocblas_fused_level1_NB = rocblas_reproducible_reduction_NB;
+
+// The dot product and sum of squares of rocblas_dot_nrm2, reduced together
+template <typename T>
+struct rocblas_dot_nrm2_sums
+{
+    T         dot;
+    real_t<T> ssq;
+};
+
+struct rocblas_reduce_dot_nrm2
+{
+    template <typename T>
+    __forceinline__ __device__ void operator()(rocblas_dot_nrm2_sums<T>& __restrict__ a,
+                                               const rocblas_dot_nrm2_sums<T>& __restrict__ b)
+    {
+        a.dot += b.dot;
+        a.ssq += b.ssq;
+    }
+};
+
+struct rocblas_finalize_dot_nrm2
+{
+    template <typename T>
+    __forceinline__ __device__ rocblas_dot_nrm2_sums<T> operator()(rocblas_dot_nrm2_sums<T> x)
+    {
+        x.ssq = sqrt(x.ssq);
+        return x;
+    }
+};
+
+/*! \brief rocblas_fused_level1_workspace_size
+    Work area for the partial results of every level of the reduction tree, followed by
+    batch_count finalized results
+
+    @param[in]
+    n           rocblas_int
+    @param[in]
+    batch_count rocblas_int
+    ********************************************************************/
+template <typename To>
+size_t rocblas_fused_level1_workspace_size(rocblas_int n, rocblas_int batch_count)
+{
+    if(batch_count <= 0)
+        batch_count = 1;
+    return sizeof(To) * (rocblas_reproducible_reduction_partials(n) + 1) * batch_count;
+}
+
+// combines the value of each thread with its upper half partner, reduces the block and stores
+// the block result; a single block per batch instance finalizes directly into output
+template <rocblas_int NB, typename REDUCE, typename FINALIZE, typename To, typename Tr>
+__forceinline__ __device__ void
+    rocblas_fused_level1_block_reduce(To* tmp, const To& upper, To* partials, Tr* output)
+{
+    rocblas_int tx = hipThreadIdx_x;
+    REDUCE{}(tmp[tx], upper);
+
+    rocblas_reduction<NB, REDUCE>(tx, tmp);
+
+    if(tx == 0)
+    {
+        if(hipGridDim_x == 1)
+            output[hipBlockIdx_y] = Tr(FINALIZE{}(tmp[0]));
+        else
+            partials[hipBlockIdx_y * hipGridDim_x + hipBlockIdx_x] = tmp[0];
+    }
+}
+
+// dot = x^T y (x^H y if CONJ) and ssq = sum |x_i|^2
+template <rocblas_int NB, bool CONJ, typename TPtrX, typename TPtrY, typename T>
+__attribute__((amdgpu_flat_work_group_size((NB < 128) ? NB : 128, (NB > 256) ? NB : 256)))
+ROCBLAS_KERNEL void rocblas_dot_nrm2_kernel(rocblas_int               n,
+                                            TPtrX                     xvec,
+                                            ptrdiff_t                 shiftx,
+                                            rocblas_int               incx,
+                                            rocblas_stride            stridex,
+                                            TPtrY                     yvec,
+                                            ptrdiff_t                 shifty,
+                                            rocblas_int               incy,
+                                            rocblas_stride            stridey,
+                                            rocblas_dot_nrm2_sums<T>* partials,
+                                            rocblas_dot_nrm2_sums<T>* output)
+{
+    ptrdiff_t tx = hipThreadIdx_x;
+    ptrdiff_t i  = ptrdiff_t(hipBlockIdx_x) * 2 * NB + tx;
+    ptrdiff_t j  = i + NB;
+
+    __shared__ rocblas_dot_nrm2_sums<T> tmp[NB];
+
+    const auto* x = load_ptr_batch(xvec, hipBlockIdx_y, shiftx, stridex);
+    const auto* y = load_ptr_batch(yvec, hipBlockIdx_y, shifty, stridey);
+
+    rocblas_dot_nrm2_sums<T> upper{};
+    if(j < n)
+    {
+        T xj      = x[j * incx];
+        upper.dot = y[j * incy] * (CONJ ? conj(xj) : xj);
+        upper.ssq = fetch_abs2(xj);
+    }
+
+    rocblas_dot_nrm2_sums<T> lower{};
+    if(i < n)
+    {
+        T xi      = x[i * incx];
+        lower.dot = y[i * incy] * (CONJ ? conj(xi) : xi);
+        lower.ssq = fetch_abs2(xi);
+    }
+    tmp[tx] = lower;
+
+    rocblas_fused_level1_block_reduce<NB, rocblas_reduce_dot_nrm2, rocblas_finalize_dot_nrm2>(
+        tmp, upper, partials, output);
+}
+
+// y := alpha * x + y, then dot = y^T z (y^H z if CONJ) using the updated y
+template <rocblas_int NB,
+          bool        CONJ,
+          typename Ta,
+          typename TPtrX,
+          typename TPtrY,
+          typename TPtrZ,
+          typename T>
+__attribute__((amdgpu_flat_work_group_size((NB < 128) ? NB : 128, (NB > 256) ? NB : 256)))
+ROCBLAS_KERNEL void rocblas_axpy_dot_kernel(rocblas_int    n,
+                                            Ta             alpha_device_host,
+                                            TPtrX          xvec,
+                                            ptrdiff_t      shiftx,
+                                            rocblas_int    incx,
+                                            rocblas_stride stridex,
+                                            TPtrY          yvec,
+                                            ptrdiff_t      shifty,
+                                            rocblas_int    incy,
+                                            rocblas_stride stridey,
+                                            TPtrZ          zvec,
+                                            ptrdiff_t      shiftz,
+                                            rocblas_int    incz,
+                                            rocblas_stride stridez,
+                                            T*             partials,
+                                            T*             output)
+{
+    ptrdiff_t tx = hipThreadIdx_x;
+    ptrdiff_t i  = ptrdiff_t(hipBlockIdx_x) * 2 * NB + tx;
+    ptrdiff_t j  = i + NB;
+
+    __shared__ T tmp[NB];
+
+    auto        alpha = load_scalar(alpha_device_host);
+    const auto* x     = load_ptr_batch(xvec, hipBlockIdx_y, shiftx, stridex);
+    auto*       y     = load_ptr_batch(yvec, hipBlockIdx_y, shifty, stridey);
+    const auto* z     = load_ptr_batch(zvec, hipBlockIdx_y, shiftz, stridez);
+
+    T upper{};
+    if(j < n)
+    {
+        T yj        = y[j * incy] + alpha * x[j * incx];
+        y[j * incy] = yj;
+        upper       = z[j * incz] * (CONJ ? conj(yj) : yj);
+    }
+
+    T lower{};
+    if(i < n)
+    {
+        T yi        = y[i * incy] + alpha * x[i * incx];
+        y[i * incy] = yi;
+        lower       = z[i * incz] * (CONJ ? conj(yi) : yi);
+    }
+    tmp[tx] = lower;
+
+    rocblas_fused_level1_block_reduce<NB, rocblas_reduce_sum, rocblas_finalize_identity>(
+        tmp, upper, partials, output);
+}
+
+// y := alpha * x + y, then ssq = sum |y_i|^2 using the updated y
+template <rocblas_int NB, typename Ta, typename TPtrX, typename TPtrY, typename Tr>
+__attribute__((amdgpu_flat_work_group_size((NB < 128) ? NB : 128, (NB > 256) ? NB : 256)))
+ROCBLAS_KERNEL void rocblas_axpy_nrm2_kernel(rocblas_int    n,
+                                             Ta             alpha_device_host,
+                                             TPtrX          xvec,
+                                             ptrdiff_t      shiftx,
+                                             rocblas_int    incx,
+                                             rocblas_stride stridex,
+                                             TPtrY          yvec,
+                                             ptrdiff_t      shifty,
+                                             rocblas_int    incy,
+                                             rocblas_stride stridey,
+                                             Tr*            partials,
+                                             Tr*            output)
+{
+    ptrdiff_t tx = hipThreadIdx_x;
+    ptrdiff_t i  = ptrdiff_t(hipBlockIdx_x) * 2 * NB + tx;
+    ptrdiff_t j  = i + NB;
+
+    __shared__ Tr tmp[NB];
+
+    auto        alpha = load_scalar(alpha_device_host);
+    const auto* x     = load_ptr_batch(xvec, hipBlockIdx_y, shiftx, stridex);
+    auto*       y     = load_ptr_batch(yvec, hipBlockIdx_y, shifty, stridey);
+
+    Tr upper{};
+    if(j < n)
+    {
+        auto yj     = y[j * incy] + alpha * x[j * incx];
+        y[j * incy] = yj;
+        upper       = fetch_abs2(yj);
+    }
+
+    Tr lower{};
+    if(i < n)
+    {
+        auto yi     = y[i * incy] + alpha * x[i * incx];
+        y[i * incy] = yi;
+        lower       = fetch_abs2(yi);
+    }
+    tmp[tx] = lower;
+
+    rocblas_fused_level1_block_reduce<NB, rocblas_reduce_sum, rocblas_finalize_nrm2>(
+        tmp, upper, partials, output);
+}
+
+// scatters the finalized dot_nrm2 results into the two result arrays on the device
+template <rocblas_int NB, typename T>
+ROCBLAS_KERNEL __launch_bounds__(NB) void rocblas_dot_nrm2_store_kernel(
+    rocblas_int batch_count, const rocblas_dot_nrm2_sums<T>* sums, T* dot, real_t<T>* nrm2)
+{
+    rocblas_int b = hipBlockIdx_x * NB + hipThreadIdx_x;
+    if(b < batch_count)
+    {
+        dot[b]  = sums[b].dot;
+        nrm2[b] = sums[b].ssq;
+    }
+}
+
+/*! \brief
+
+    \details
+    rocblas_fused_level1_finish reduces the per-block partial results written by a fused
+              level 1 kernel into output, with the default part2 kernel or, in
+              rocblas_reduction_reproducible mode, level by level with the fixed-order tree.
+    @param[in]
+    blocks    rocblas_int
+              number of blocks per batch instance launched for the fused kernel.
+    @param[in]
+    partials  To*
+              workspace of rocblas_fused_level1_workspace_size.
+    @param[out]
+    output    Tr*
+              device array of batch_count finalized results.
+    ********************************************************************/
+template <typename REDUCE, typename FINALIZE, typename To, typename Tr>
+rocblas_status rocblas_fused_level1_finish(rocblas_handle __restrict__ handle,
+                                           rocblas_int blocks,
+                                           rocblas_int batch_count,
+                                           To*         partials,
+                                           Tr*         output)
+{
+    static constexpr rocblas_int NB = rocblas_fused_level1_NB;
+
+    // a single block already finalized its result
+    if(blocks == 1)
+        return rocblas_status_success;
+
+    if(handle->reduction_mode == rocblas_reduction_reproducible)
+        return rocblas_reproducible_reduction_finish<NB, REDUCE, FINALIZE>(
+            handle, blocks, batch_count, partials, output, output);
+
+    hipLaunchKernelGGL((rocblas_reduction_strided_batched_kernel_part2<NB, REDUCE, FINALIZE>),
+                       dim3(1, batch_count),
+                       NB,
+                       0,
+                       handle->get_stream(),
+                       blocks,
+                       partials,
+                       output);
+
+    return rocblas_status_success;
+}
+
+// copies batch_count results of a fused routine to result when it lives in host memory
+template <typename Tr>
+rocblas_status rocblas_fused_level1_copy_result(rocblas_handle handle,
+                                                rocblas_int    batch_count,
+                                                const Tr*      output,
+                                                Tr*            result)
+{
+    if(result != output)
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(result, output, batch_count * sizeof(Tr), hipMemcpyDeviceToHost));
+    return rocblas_status_success;
+}
+
+/*! \brief rocblas_internal_dot_nrm2_template
+    computes dot_results = x^T y (x^H y if CONJ) and nrm2_results = ||x||_2 for every batch
+    instance, reading x and y once. workspace must hold
+    rocblas_fused_level1_workspace_size<rocblas_dot_nrm2_sums<T>>(n, batch_count) bytes.
+    ********************************************************************/
+template <bool CONJ, typename T, typename U>
+rocblas_status rocblas_internal_dot_nrm2_template(rocblas_handle            handle,
+                                                  rocblas_int               n,
+                                                  U                         x,
+                                                  rocblas_int               offsetx,
+                                                  rocblas_int               incx,
+                                                  rocblas_stride            stridex,
+                                                  U                         y,
+                                                  rocblas_int               offsety,
+                                                  rocblas_int               incy,
+                                                  rocblas_stride            stridey,
+                                                  rocblas_int               batch_count,
+                                                  T*                        dot_results,
+                                                  real_t<T>*                nrm2_results,
+                                                  rocblas_dot_nrm2_sums<T>* workspace)
+{
+    static constexpr rocblas_int NB = rocblas_fused_level1_NB;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+    auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
+
+    rocblas_int               blocks = rocblas_reduction_kernel_block_count(n, 2 * NB);
+    rocblas_dot_nrm2_sums<T>* output
+        = workspace + rocblas_reproducible_reduction_partials(n) * batch_count;
+
+    hipLaunchKernelGGL((rocblas_dot_nrm2_kernel<NB, CONJ>),
+                       dim3(blocks, batch_count),
+                       NB,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex,
+                       y,
+                       shifty,
+                       incy,
+                       stridey,
+                       workspace,
+                       output);
+
+    rocblas_status status = rocblas_fused_level1_finish<rocblas_reduce_dot_nrm2,
+                                                        rocblas_finalize_dot_nrm2>(
+        handle, blocks, batch_count, workspace, output);
+    if(status != rocblas_status_success)
+        return status;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((rocblas_dot_nrm2_store_kernel<NB>),
+                           dim3((batch_count - 1) / NB + 1),
+                           NB,
+                           0,
+                           handle->get_stream(),
+                           batch_count,
+                           output,
+                           dot_results,
+                           nrm2_results);
+    }
+    else
+    {
+        auto sums = std::make_unique<rocblas_dot_nrm2_sums<T>[]>(batch_count);
+        RETURN_IF_HIP_ERROR(hipMemcpy(&sums[0],
+                                      output,
+                                      batch_count * sizeof(rocblas_dot_nrm2_sums<T>),
+                                      hipMemcpyDeviceToHost));
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            dot_results[b]  = sums[b].dot;
+            nrm2_results[b] = sums[b].ssq;
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*! \brief rocblas_internal_axpy_dot_template
+    computes y := alpha * x + y and then results = y^T z (y^H z if CONJ) for every batch
+    instance, reading x, y and z and writing y once. workspace must hold
+    rocblas_fused_level1_workspace_size<T>(n, batch_count) bytes.
+    ********************************************************************/
+template <bool CONJ, typename T, typename Ux, typename Uy>
+rocblas_status rocblas_internal_axpy_dot_template(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  const T*       alpha,
+                                                  Ux             x,
+                                                  rocblas_int    offsetx,
+                                                  rocblas_int    incx,
+                                                  rocblas_stride stridex,
+                                                  Uy             y,
+                                                  rocblas_int    offsety,
+                                                  rocblas_int    incy,
+                                                  rocblas_stride stridey,
+                                                  Ux             z,
+                                                  rocblas_int    offsetz,
+                                                  rocblas_int    incz,
+                                                  rocblas_stride stridez,
+                                                  rocblas_int    batch_count,
+                                                  T*             results,
+                                                  T*             workspace)
+{
+    static constexpr rocblas_int NB = rocblas_fused_level1_NB;
+
+    auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+    auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
+    auto shiftz = incz < 0 ? offsetz - ptrdiff_t(incz) * (n - 1) : offsetz;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, 2 * NB);
+    T*          output = results;
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+        output = workspace + rocblas_reproducible_reduction_partials(n) * batch_count;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((rocblas_axpy_dot_kernel<NB, CONJ>),
+                           dim3(blocks, batch_count),
+                           NB,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           alpha,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           z,
+                           shiftz,
+                           incz,
+                           stridez,
+                           workspace,
+                           output);
+    else
+        hipLaunchKernelGGL((rocblas_axpy_dot_kernel<NB, CONJ>),
+                           dim3(blocks, batch_count),
+                           NB,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           *alpha,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           z,
+                           shiftz,
+                           incz,
+                           stridez,
+                           workspace,
+                           output);
+
+    rocblas_status status
+        = rocblas_fused_level1_finish<rocblas_reduce_sum, rocblas_finalize_identity>(
+            handle, blocks, batch_count, workspace, output);
+    if(status != rocblas_status_success)
+        return status;
+
+    return rocblas_fused_level1_copy_result(handle, batch_count, output, results);
+}
+
+/*! \brief rocblas_internal_axpy_nrm2_template
+    computes y := alpha * x + y and then results = ||y||_2 for every batch instance, reading x
+    and y and writing y once. workspace must hold
+    rocblas_fused_level1_workspace_size<real_t<T>>(n, batch_count) bytes.
+    ********************************************************************/
+template <typename T, typename Ux, typename Uy>
+rocblas_status rocblas_internal_axpy_nrm2_template(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   const T*       alpha,
+                                                   Ux             x,
+                                                   rocblas_int    offsetx,
+                                                   rocblas_int    incx,
+                                                   rocblas_stride stridex,
+                                                   Uy             y,
+                                                   rocblas_int    offsety,
+                                                   rocblas_int    incy,
+                                                   rocblas_stride stridey,
+                                                   rocblas_int    batch_count,
+                                                   real_t<T>*     results,
+                                                   real_t<T>*     workspace)
+{
+    static constexpr rocblas_int NB = rocblas_fused_level1_NB;
+
+    auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
+    auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, 2 * NB);
+    real_t<T>*  output = results;
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+        output = workspace + rocblas_reproducible_reduction_partials(n) * batch_count;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((rocblas_axpy_nrm2_kernel<NB>),
+                           dim3(blocks, batch_count),
+                           NB,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           alpha,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           workspace,
+                           output);
+    else
+        hipLaunchKernelGGL((rocblas_axpy_nrm2_kernel<NB>),
+                           dim3(blocks, batch_count),
+                           NB,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           *alpha,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           workspace,
+                           output);
+
+    rocblas_status status = rocblas_fused_level1_finish<rocblas_reduce_sum, rocblas_finalize_nrm2>(
+        handle, blocks, batch_count, workspace, output);
+    if(status != rocblas_status_success)
+        return status;
+
+    return rocblas_fused_level1_copy_result(handle, batch_count, output, results);
+}
+
+// checks x, y and z of axpy_dot; z is only read, so it is checked once if is_input is true
+template <typename Tx, typename Ty>
+rocblas_status rocblas_axpy_dot_check_numerics(const char*    function_name,
+                                               rocblas_handle handle,
+                                               rocblas_int    n,
+                                               Tx             x,
+                                               ptrdiff_t      offset_x,
+                                               rocblas_int    inc_x,
+                                               rocblas_stride stride_x,
+                                               Ty             y,
+                                               ptrdiff_t      offset_y,
+                                               rocblas_int    inc_y,
+                                               rocblas_stride stride_y,
+                                               Tx             z,
+                                               ptrdiff_t      offset_z,
+                                               rocblas_int    inc_z,
+                                               rocblas_stride stride_z,
+                                               rocblas_int    batch_count,
+                                               const int      check_numerics,
+                                               bool           is_input)
+{
+    rocblas_status check_numerics_status = rocblas_axpy_check_numerics(function_name,
+                                                                       handle,
+                                                                       n,
+                                                                       x,
+                                                                       offset_x,
+                                                                       inc_x,
+                                                                       stride_x,
+                                                                       y,
+                                                                       offset_y,
+                                                                       inc_y,
+                                                                       stride_y,
+                                                                       batch_count,
+                                                                       check_numerics,
+                                                                       is_input);
+    if(check_numerics_status != rocblas_status_success || !is_input)
+        return check_numerics_status;
+
+    return rocblas_internal_check_numerics_vector_template(function_name,
+                                                           handle,
+                                                           n,
+                                                           z,
+                                                           offset_z,
+                                                           inc_z,
+                                                           stride_z,
+                                                           batch_count,
+                                                           check_numerics,
+                                                           is_input);
+}
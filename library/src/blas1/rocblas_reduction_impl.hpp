@@ -155,7 +155,8 @@ inline rocblas_status rocblas_reduction_setup(rocblas_handle handle,
         return rocblas_status_invalid_handle;
     }
 
-    size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB, Tw>(n, batch_count);
+    size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB, Tw>(
+        n, batch_count, handle->accuracy_mode);
 
     if(handle->is_device_memory_size_query())
     {
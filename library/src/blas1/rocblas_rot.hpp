@@ -6,6 +6,7 @@
 
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "rocblas_vector_access.hpp"
 
 template <typename Tex,
           typename Tx,
@@ -74,6 +75,63 @@ ROCBLAS_KERNEL void rot_kernel(rocblas_int    n,
     rot_kernel_calc<Tex>(n, x, incx, y, incy, c, s);
 }
 
+//! @brief Unit stride kernel, each thread rotates one vector of rocblas_vec_width elements.
+//!
+template <rocblas_int NB, typename Tex, typename Tx, typename Ty, typename Tc, typename Ts>
+ROCBLAS_KERNEL __launch_bounds__(NB) void rot_vec_kernel(rocblas_int    n,
+                                                         Tx             x_in,
+                                                         ptrdiff_t      offset_x,
+                                                         rocblas_stride stride_x,
+                                                         Ty             y_in,
+                                                         ptrdiff_t      offset_y,
+                                                         rocblas_stride stride_y,
+                                                         Tc             c_in,
+                                                         rocblas_stride c_stride,
+                                                         Ts             s_in,
+                                                         rocblas_stride s_stride)
+{
+    using T                  = rocblas_vec_elem_t<Tx>;
+    constexpr rocblas_int VW = rocblas_vec_width<T>;
+
+    auto c = std::real(load_scalar(c_in, hipBlockIdx_y, c_stride));
+    auto s = load_scalar(s_in, hipBlockIdx_y, s_stride);
+    auto x = load_ptr_batch(x_in, hipBlockIdx_y, offset_x, stride_x);
+    auto y = load_ptr_batch(y_in, hipBlockIdx_y, offset_y, stride_y);
+
+    // y is updated with conj(s), which is s itself in the real case
+    auto s_conj = conj(s);
+
+    ptrdiff_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    ptrdiff_t nv  = n / VW;
+
+    if(tid < nv)
+    {
+        bool aligned = rocblas_vec_aligned(x) && rocblas_vec_aligned(y);
+        auto vx      = rocblas_vec_load(x, tid, aligned);
+        auto vy      = rocblas_vec_load(y, tid, aligned);
+#pragma unroll
+        for(rocblas_int k = 0; k < VW; k++)
+        {
+            Tex tempx = Tex(c * vx[k]) + Tex(s * vy[k]);
+            Tex tempy = Tex(c * vy[k]) - Tex(s_conj * vx[k]);
+            vy[k]     = T(tempy);
+            vx[k]     = T(tempx);
+        }
+        rocblas_vec_store(x, tid, vx, aligned);
+        rocblas_vec_store(y, tid, vy, aligned);
+    }
+
+    // peeled remainder of the n % VW last elements
+    ptrdiff_t i = nv * VW + tid;
+    if(i < n)
+    {
+        Tex tempx = Tex(c * x[i]) + Tex(s * y[i]);
+        Tex tempy = Tex(c * y[i]) - Tex(s_conj * x[i]);
+        y[i]      = T(tempy);
+        x[i]      = T(tempx);
+    }
+}
+
 template <rocblas_int NB, typename Tex, typename Tx, typename Ty, typename Tc, typename Ts>
 rocblas_status rocblas_rot_template(rocblas_handle handle,
                                     rocblas_int    n,
@@ -102,6 +160,52 @@ rocblas_status rocblas_rot_template(rocblas_handle handle,
     dim3        threads(NB);
     hipStream_t rocblas_stream = handle->get_stream();
 
+    if constexpr(std::is_same<rocblas_vec_elem_t<Tx>, rocblas_vec_elem_t<Ty>>{})
+    {
+        if(incx == 1 && incy == 1)
+        {
+            // 128-bit accesses when incx == 1 and incy == 1
+            dim3 vec_blocks(rocblas_vec_blocks<rocblas_vec_elem_t<Tx>>(n, NB), batch_count);
+
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                hipLaunchKernelGGL((rot_vec_kernel<NB, Tex>),
+                                   vec_blocks,
+                                   threads,
+                                   0,
+                                   rocblas_stream,
+                                   n,
+                                   x,
+                                   shiftx,
+                                   stride_x,
+                                   y,
+                                   shifty,
+                                   stride_y,
+                                   c,
+                                   c_stride,
+                                   s,
+                                   s_stride);
+            else // c and s are on host
+                hipLaunchKernelGGL((rot_vec_kernel<NB, Tex>),
+                                   vec_blocks,
+                                   threads,
+                                   0,
+                                   rocblas_stream,
+                                   n,
+                                   x,
+                                   shiftx,
+                                   stride_x,
+                                   y,
+                                   shifty,
+                                   stride_y,
+                                   *c,
+                                   c_stride,
+                                   *s,
+                                   s_stride);
+
+            return rocblas_status_success;
+        }
+    }
+
     if(rocblas_pointer_mode_device == handle->pointer_mode)
         hipLaunchKernelGGL(rot_kernel<Tex>,
                            blocks,
@@ -6,6 +6,7 @@
 
 #include "handle.hpp"
 #include "rocblas.h"
+#include "rocblas_vector_access.hpp"
 
 template <typename Tex, typename Ta, typename Tx>
 ROCBLAS_KERNEL void rocblas_scal_kernel(rocblas_int    n,
@@ -29,94 +30,43 @@ ROCBLAS_KERNEL void rocblas_scal_kernel(rocblas_int    n,
 }
 
 //!
-//! @brief Optimized kernel for the SCAL floating points.
+//! @brief Unit stride kernel of SCAL, each thread scales one vector of rocblas_vec_width elements.
 //! @remark Increment are required to be equal to one, that's why they are unspecified.
 //!
 template <rocblas_int NB, typename Tex, typename Ta, typename Tx>
-ROCBLAS_KERNEL __launch_bounds__(NB) void sscal_2_kernel(rocblas_int    n,
-                                                         Ta             alpha_device_host,
-                                                         rocblas_stride stride_alpha,
-                                                         Tx __restrict__ xa,
-                                                         ptrdiff_t      offset_x,
-                                                         rocblas_stride stride_x)
+ROCBLAS_KERNEL __launch_bounds__(NB) void rocblas_scal_vec_kernel(rocblas_int    n,
+                                                                  Ta             alpha_device_host,
+                                                                  rocblas_stride stride_alpha,
+                                                                  Tx __restrict__ xa,
+                                                                  ptrdiff_t      offset_x,
+                                                                  rocblas_stride stride_x)
 {
+    constexpr rocblas_int VW = rocblas_vec_width<rocblas_vec_elem_t<Tx>>;
+
     auto*     x     = load_ptr_batch(xa, hipBlockIdx_y, offset_x, stride_x);
     auto      alpha = load_scalar(alpha_device_host, hipBlockIdx_y, stride_alpha);
-    ptrdiff_t tid   = (hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x) * 2;
+    ptrdiff_t tid   = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    ptrdiff_t nv    = n / VW;
 
-    if(tid < n - 1)
+    if(tid < nv)
     {
-        // Each thread access contiguous elements for example Thread '0' access indices '0' and '1' of the vector `x`
-        for(rocblas_int j = 0; j < 2; ++j)
+        bool aligned = rocblas_vec_aligned(x);
+        auto v       = rocblas_vec_load(x, tid, aligned);
+#pragma unroll
+        for(rocblas_int k = 0; k < VW; k++)
         {
-            Tex res    = (Tex)x[tid + j] * alpha;
-            x[tid + j] = res;
+            Tex res = (Tex)v[k] * alpha;
+            v[k]    = res;
         }
+        rocblas_vec_store(x, tid, v, aligned);
     }
 
-    // If `n` is odd then the computation of last element in the vector `x` is covered below.
-    if(n % 2 != 0 && tid == n - 1)
+    // peeled remainder of the n % VW last elements
+    ptrdiff_t i = nv * VW + tid;
+    if(i < n)
     {
-        Tex res = (Tex)x[tid] * alpha;
-        x[tid]  = res;
-    }
-}
-
-//!
-//! @brief Optimized kernel for the SCAL half points.
-//! @remark Increments are required to be equal to one, that's why they are unspecified.
-//!
-template <rocblas_int NB, typename Ta, typename Tx>
-ROCBLAS_KERNEL __launch_bounds__(NB) void hscal_mlt_4_kernel(rocblas_int    n,
-                                                             rocblas_int    n_mod_4,
-                                                             rocblas_int    n_mlt_4,
-                                                             Ta             alpha_device_host,
-                                                             rocblas_stride stride_alpha,
-                                                             Tx __restrict__ xa,
-                                                             ptrdiff_t      offset_x,
-                                                             rocblas_stride stride_x)
-{
-
-    auto alpha = load_scalar(alpha_device_host, hipBlockIdx_y, stride_alpha);
-
-    rocblas_half2 x0, x1;
-    rocblas_half2 z0, z1;
-
-    ptrdiff_t tid = (hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x) * 4;
-
-    if(tid < n - 3)
-    {
-        rocblas_half4* x
-            = (rocblas_half4*)load_ptr_batch(xa, hipBlockIdx_y, offset_x + tid, stride_x);
-
-        x0[0] = (*x)[0];
-        x0[1] = (*x)[1];
-        x1[0] = (*x)[2];
-        x1[1] = (*x)[3];
-
-        z0[0] = alpha * x0[0];
-        z0[1] = alpha * x0[1];
-        z1[0] = alpha * x1[0];
-        z1[1] = alpha * x1[1];
-
-        (*x)[0] = z0[0];
-        (*x)[1] = z0[1];
-        (*x)[2] = z1[0];
-        (*x)[3] = z1[1];
-    }
-
-    // If `n_mod_4` is true then the computation of last few element in the vector `x` is covered below.
-    if(n_mod_4)
-    {
-        //The last ThreadID which is a multiple of 4 should complete the computation of last few elements of vector `x`
-        if(tid == n_mlt_4)
-        {
-            auto* x = load_ptr_batch(xa, hipBlockIdx_y, offset_x, stride_x);
-            for(rocblas_int j = 0; j < n_mod_4; ++j)
-            {
-                x[tid + j] = x[tid + j] * alpha;
-            }
-        }
+        Tex res = (Tex)x[i] * alpha;
+        x[i]    = res;
     }
 }
 
@@ -138,22 +88,15 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_success;
     }
 
-    static constexpr bool using_rocblas_float
-        = std::is_same<Tx, rocblas_float*>{} || std::is_same<Tx, rocblas_float* const*>{};
-
-    // Using rocblas_half ?
-    static constexpr bool using_rocblas_half
-        = std::is_same<Ta, rocblas_half>{} && std::is_same<Tex, rocblas_half>{};
-
-    if(using_rocblas_float && incx == 1)
+    if(incx == 1)
     {
-        // Kernel function for improving the performance of SSCAL when incx==1
-        int  blocks = 1 + ((n - 1) / (NB * 2));
+        // 128-bit accesses when incx == 1
+        int  blocks = rocblas_vec_blocks<rocblas_vec_elem_t<Tx>>(n, NB);
         dim3 grid(blocks, batch_count);
         dim3 threads(NB);
 
         if(rocblas_pointer_mode_device == handle->pointer_mode)
-            hipLaunchKernelGGL((sscal_2_kernel<NB, Tex>),
+            hipLaunchKernelGGL((rocblas_scal_vec_kernel<NB, Tex>),
                                grid,
                                threads,
                                0,
@@ -165,7 +108,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                offset_x,
                                stride_x);
         else // single alpha is on host
-            hipLaunchKernelGGL((sscal_2_kernel<NB, Tex>),
+            hipLaunchKernelGGL((rocblas_scal_vec_kernel<NB, Tex>),
                                grid,
                                threads,
                                0,
@@ -177,44 +120,6 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                offset_x,
                                stride_x);
     }
-    else if(using_rocblas_half && incx == 1)
-    {
-        // Kernel function for improving the performance of HSCAL when incx==1
-        rocblas_int n_mod_4 = n & 3; // n mod 4
-        rocblas_int n_mlt_4 = n & ~(rocblas_int)3; // multiple of 4
-        int         blocks  = 1 + ((n - 1) / (NB * 4));
-        dim3        grid(blocks, batch_count);
-        dim3        threads(NB);
-
-        if(rocblas_pointer_mode_device == handle->pointer_mode)
-            hipLaunchKernelGGL((hscal_mlt_4_kernel<NB>),
-                               grid,
-                               threads,
-                               0,
-                               handle->get_stream(),
-                               n,
-                               n_mod_4,
-                               n_mlt_4,
-                               (const rocblas_half*)alpha,
-                               stride_alpha,
-                               x,
-                               offset_x,
-                               stride_x);
-        else // single alpha is on host
-            hipLaunchKernelGGL((hscal_mlt_4_kernel<NB>),
-                               grid,
-                               threads,
-                               0,
-                               handle->get_stream(),
-                               n,
-                               n_mod_4,
-                               n_mlt_4,
-                               load_scalar((const rocblas_half*)alpha),
-                               stride_alpha,
-                               x,
-                               offset_x,
-                               stride_x);
-    }
     else
     {
         int  blocks = (n - 1) / NB + 1;
@@ -6,6 +6,7 @@
 
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "rocblas_vector_access.hpp"
 
 template <typename T>
 __forceinline__ __device__ __host__ void rocblas_swap_vals(T* __restrict__ x, T* __restrict__ y)
@@ -36,30 +37,37 @@ ROCBLAS_KERNEL void rocblas_swap_kernel(rocblas_int    n,
     }
 }
 
-//! @brief Optimized kernel for the floating points.
+//! @brief Unit stride kernel, each thread swaps one vector of rocblas_vec_width elements.
 //!
 template <rocblas_int NB, typename UPtr>
-ROCBLAS_KERNEL __launch_bounds__(NB) void sswap_2_kernel(rocblas_int n,
-                                                         UPtr __restrict__ xa,
-                                                         ptrdiff_t      offsetx,
-                                                         rocblas_stride stridex,
-                                                         UPtr __restrict__ ya,
-                                                         ptrdiff_t      offsety,
-                                                         rocblas_stride stridey)
+ROCBLAS_KERNEL __launch_bounds__(NB) void rocblas_swap_vec_kernel(rocblas_int n,
+                                                                  UPtr __restrict__ xa,
+                                                                  ptrdiff_t      offsetx,
+                                                                  rocblas_stride stridex,
+                                                                  UPtr __restrict__ ya,
+                                                                  ptrdiff_t      offsety,
+                                                                  rocblas_stride stridey)
 {
-    ptrdiff_t tid = (hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x) * 2;
+    constexpr rocblas_int VW = rocblas_vec_width<rocblas_vec_elem_t<UPtr>>;
+
+    ptrdiff_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    ptrdiff_t nv  = n / VW;
     auto*     x   = load_ptr_batch(xa, hipBlockIdx_y, offsetx, stridex);
     auto*     y   = load_ptr_batch(ya, hipBlockIdx_y, offsety, stridey);
-    if(tid < n - 1)
+    if(tid < nv)
     {
-        for(rocblas_int j = 0; j < 2; ++j)
-        {
-            rocblas_swap_vals(x + tid + j, y + tid + j);
-        }
+        bool aligned = rocblas_vec_aligned(x) && rocblas_vec_aligned(y);
+        auto vx      = rocblas_vec_load(x, tid, aligned);
+        auto vy      = rocblas_vec_load(y, tid, aligned);
+        rocblas_vec_store(x, tid, vy, aligned);
+        rocblas_vec_store(y, tid, vx, aligned);
     }
-    if(n % 2 != 0 && tid == n - 1)
+
+    // peeled remainder of the n % VW last elements
+    ptrdiff_t i = nv * VW + tid;
+    if(i < n)
     {
-        rocblas_swap_vals(x + tid, y + tid);
+        rocblas_swap_vals(x + i, y + i);
     }
 }
 
@@ -80,10 +88,7 @@ rocblas_status rocblas_swap_template(rocblas_handle handle,
     if(n <= 0 || batch_count <= 0)
         return rocblas_status_success;
 
-    static constexpr bool using_rocblas_float
-        = std::is_same<U, rocblas_float*>{} || std::is_same<U, rocblas_float* const*>{};
-
-    if(!using_rocblas_float || incx != 1 || incy != 1)
+    if(incx != 1 || incy != 1)
     {
         // in case of negative inc shift pointer to end of data for negative indexing tid*inc
         ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
@@ -109,25 +114,22 @@ rocblas_status rocblas_swap_template(rocblas_handle handle,
     }
     else
     {
-        // Kernel function for improving the performance of SSWAP when incx==1 and incy==1
-        ptrdiff_t shiftx = offsetx - 0;
-        ptrdiff_t shifty = offsety - 0;
-
-        int  blocks = 1 + ((n - 1) / (NB * 2));
+        // 128-bit accesses when incx == 1 and incy == 1
+        int  blocks = rocblas_vec_blocks<rocblas_vec_elem_t<U>>(n, NB);
         dim3 grid(blocks, batch_count);
         dim3 threads(NB);
 
-        hipLaunchKernelGGL(sswap_2_kernel<NB>,
+        hipLaunchKernelGGL(rocblas_swap_vec_kernel<NB>,
                            grid,
                            threads,
                            0,
                            handle->get_stream(),
                            n,
                            x,
-                           shiftx,
+                           ptrdiff_t(offsetx),
                            stridex,
                            y,
-                           shifty,
+                           ptrdiff_t(offsety),
                            stridey);
     }
     return rocblas_status_success;
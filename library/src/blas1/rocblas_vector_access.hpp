@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*
+ * ===========================================================================
+ *    This file provides the 128-bit accesses of unit stride vectors used by
+ *    the level 1 kernels when incx == incy == 1. A thread handles a vector of
+ *    rocblas_vec_width<T> consecutive elements, which is loaded and stored
+ *    with a single 16 byte access when the batch instance is 16 byte aligned
+ *    and element by element otherwise. The n % rocblas_vec_width<T> last
+ *    elements are handled by a peeled scalar remainder in each kernel.
+ * ===========================================================================
+ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <cstdint>
+#include <type_traits>
+
+static constexpr size_t rocblas_vec_bytes = 16;
+
+// number of elements of type T in a 16 byte access, 1 when T does not divide 16 bytes
+template <typename T>
+static constexpr rocblas_int rocblas_vec_width
+    = sizeof(T) <= rocblas_vec_bytes && rocblas_vec_bytes % sizeof(T) == 0
+          ? rocblas_vec_bytes / sizeof(T)
+          : 1;
+
+template <typename T>
+static constexpr size_t rocblas_vec_align
+    = rocblas_vec_bytes % sizeof(T) == 0 ? rocblas_vec_bytes : alignof(T);
+
+// element type of the vector, or of the array of batch vectors, U of a level 1 routine
+template <typename U>
+using rocblas_vec_elem_t
+    = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<U>>>>;
+
+template <typename T>
+struct alignas(rocblas_vec_align<T>) rocblas_vec
+{
+    T val[rocblas_vec_width<T>];
+
+    __device__ __host__ T& operator[](rocblas_int k)
+    {
+        return val[k];
+    }
+
+    __device__ __host__ const T& operator[](rocblas_int k) const
+    {
+        return val[k];
+    }
+};
+
+template <typename T>
+__device__ __host__ inline bool rocblas_vec_aligned(const T* x)
+{
+    return uintptr_t(x) % rocblas_vec_align<T> == 0;
+}
+
+// loads the vector v of x, made of the elements v * rocblas_vec_width<T> onwards
+template <typename T>
+__device__ inline rocblas_vec<T> rocblas_vec_load(const T* x, ptrdiff_t v, bool aligned)
+{
+    if(aligned)
+        return reinterpret_cast<const rocblas_vec<T>*>(x)[v];
+
+    rocblas_vec<T> r;
+#pragma unroll
+    for(rocblas_int k = 0; k < rocblas_vec_width<T>; k++)
+        r[k] = x[v * rocblas_vec_width<T> + k];
+    return r;
+}
+
+template <typename T>
+__device__ inline void rocblas_vec_store(T* x, ptrdiff_t v, const rocblas_vec<T>& r, bool aligned)
+{
+    if(aligned)
+    {
+        reinterpret_cast<rocblas_vec<T>*>(x)[v] = r;
+        return;
+    }
+
+#pragma unroll
+    for(rocblas_int k = 0; k < rocblas_vec_width<T>; k++)
+        x[v * rocblas_vec_width<T> + k] = r[k];
+}
+
+// number of blocks of NB threads covering n elements with one vector per thread
+template <typename T>
+inline rocblas_int rocblas_vec_blocks(rocblas_int n, rocblas_int NB)
+{
+    return (n - 1) / (NB * rocblas_vec_width<T>) + 1;
+}
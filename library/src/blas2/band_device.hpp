@@ -0,0 +1,346 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+
+// Treatment of the main diagonal of A by the band-tiled kernels
+enum class rocblas_band_diag
+{
+    stored, // the diagonal in band storage
+    real, // the real part of the diagonal in band storage, for Hermitian A
+    unit, // ones, the diagonal is not referenced
+};
+
+/*! \brief rocblas_band_tiled_min_bandwidth
+
+    \details
+    Smallest bandwidth kl + ku + 1 for which gbmv, sbmv, hbmv and tbmv launch the band-tiled
+    kernels instead of the kernels with one thread per row or column. Defaults to 32 and is
+    overridden by the environment variable ROCBLAS_BAND_TILED_MIN_BANDWIDTH, which is read once
+    per process. scripts/performance/blas/band_tiled_sweep.py measures the crossover.
+    ********************************************************************/
+rocblas_int rocblas_band_tiled_min_bandwidth();
+
+inline bool rocblas_band_use_tiled(rocblas_int kl, rocblas_int ku)
+{
+    return kl + ku + 1 >= rocblas_band_tiled_min_bandwidth();
+}
+
+// Diagonal element of Hermitian A, whose imaginary part is assumed to be 0
+template <typename T>
+__device__ T band_tiled_real(const T& a)
+{
+    if constexpr(is_complex<T>)
+        return std::real(a);
+    else
+        return a;
+}
+
+/**
+  *  Band-tiled matrix-vector product of the DIM_X consecutive outputs of a block, for A in
+  *  band storage with kl sub-diagonals and ku super-diagonals, A(i, j) = A[ku + i - j + j * lda].
+  *
+  *  N_PART sums A(r, j) * x_j over the band of row r. The columns of the band of the block are
+  *  walked in tiles of DIM_X, staging each x segment in LDS. For a given column the rows of the
+  *  block are consecutive in band storage, so every read of A is coalesced.
+  *
+  *  T_PART sums op(A(i, r)) * x_i over the band of column r, with op the conjugate if CONJ.
+  *  Tiles of B_TILE band rows of the DIM_X columns of the block, a diagonal tile of A, are read
+  *  along the columns into LDS together with their x segment, and transposed out of LDS so that
+  *  each thread reduces one column.
+  *
+  *  With both parts, as for symmetric and Hermitian A stored as one triangle, the diagonal is
+  *  only summed by N_PART. The complete sum is returned in the threads with hipThreadIdx_y == 0.
+  */
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int B_TILE,
+          bool        N_PART,
+          bool        T_PART,
+          bool        CONJ,
+          typename T>
+__device__ T band_tiled_kernel_calc(rocblas_int       m,
+                                    rocblas_int       n,
+                                    rocblas_int       kl,
+                                    rocblas_int       ku,
+                                    rocblas_band_diag diag,
+                                    const T*          A,
+                                    rocblas_int       lda,
+                                    const T*          x,
+                                    rocblas_int       incx)
+{
+    rocblas_int tx        = hipThreadIdx_x;
+    rocblas_int ty        = hipThreadIdx_y;
+    rocblas_int thread_id = tx + ty * DIM_X;
+    rocblas_int r0        = hipBlockIdx_x * DIM_X;
+    rocblas_int r         = r0 + tx;
+
+    __shared__ T sx[DIM_X + B_TILE];
+    __shared__ T sA[DIM_X][B_TILE + 1];
+    __shared__ T sdata[DIM_X * DIM_Y];
+
+    T res = 0;
+
+    if(N_PART)
+    {
+        rocblas_int j_begin = max(r0 - kl, 0);
+        rocblas_int j_end   = min(r0 + DIM_X + ku, n);
+
+        for(rocblas_int j0 = j_begin; j0 < j_end; j0 += DIM_X)
+        {
+            if(thread_id < DIM_X && j0 + thread_id < j_end)
+                sx[thread_id] = x[(j0 + thread_id) * ptrdiff_t(incx)];
+            __syncthreads();
+
+            if(r < m)
+            {
+                for(rocblas_int jj = ty; jj < DIM_X && j0 + jj < j_end; jj += DIM_Y)
+                {
+                    rocblas_int j = j0 + jj;
+                    rocblas_int b = ku + r - j; // band row of A(r, j)
+
+                    if(b < 0 || b > kl + ku)
+                        continue;
+
+                    T a;
+                    if(b == ku && diag == rocblas_band_diag::unit)
+                        a = 1;
+                    else if(b == ku && diag == rocblas_band_diag::real)
+                        a = band_tiled_real(A[b + size_t(j) * lda]);
+                    else
+                        a = A[b + size_t(j) * lda];
+
+                    res += a * sx[jj];
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    if(T_PART)
+    {
+        for(rocblas_int b0 = 0; b0 <= kl + ku; b0 += B_TILE)
+        {
+            // A(i, r) is on band row b = ku + i - r, so the tile needs x_i from i0 onwards
+            rocblas_int i0 = r0 + b0 - ku;
+
+            for(rocblas_int t = thread_id; t < DIM_X + B_TILE; t += DIM_X * DIM_Y)
+                if(i0 + t >= 0 && i0 + t < m)
+                    sx[t] = x[(i0 + t) * ptrdiff_t(incx)];
+
+            for(rocblas_int t = thread_id; t < DIM_X * B_TILE; t += DIM_X * DIM_Y)
+            {
+                rocblas_int bb = t % B_TILE;
+                rocblas_int c  = t / B_TILE;
+                if(b0 + bb <= kl + ku && r0 + c < n)
+                    sA[c][bb] = A[b0 + bb + size_t(r0 + c) * lda];
+            }
+            __syncthreads();
+
+            if(r < n)
+            {
+                for(rocblas_int bb = ty; bb < B_TILE; bb += DIM_Y)
+                {
+                    rocblas_int b = b0 + bb;
+                    rocblas_int i = r + b - ku;
+
+                    if(b > kl + ku || i < 0 || i >= m || (N_PART && b == ku))
+                        continue;
+
+                    T a;
+                    if(b == ku && diag == rocblas_band_diag::unit)
+                        a = 1;
+                    else if(b == ku && diag == rocblas_band_diag::real)
+                        a = band_tiled_real(sA[tx][bb]);
+                    else
+                        a = CONJ ? conj(sA[tx][bb]) : sA[tx][bb];
+
+                    res += a * sx[tx + bb];
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    // Add the partial sums of the DIM_Y threads of each output
+    sdata[thread_id] = res;
+    __syncthreads();
+
+    if(ty == 0)
+        for(rocblas_int i = 1; i < DIM_Y; i++)
+            res += sdata[thread_id + DIM_X * i];
+
+    return res;
+}
+
+/**
+  *  y := alpha * op(A) * x + beta * y with the band-tiled product, y has m elements with
+  *  N_PART and n elements otherwise.
+  *
+  *  U is either: const T* OR T
+  *  V is either: const T* OR const T* const*
+  *  W is either:       T* OR       T* const*
+  */
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int B_TILE,
+          bool        N_PART,
+          bool        T_PART,
+          bool        CONJ,
+          typename U,
+          typename V,
+          typename W>
+ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void
+    band_tiled_kernel(rocblas_int       m,
+                      rocblas_int       n,
+                      rocblas_int       kl,
+                      rocblas_int       ku,
+                      rocblas_band_diag diag,
+                      U                 alpha_device_host,
+                      rocblas_stride    stride_alpha,
+                      V                 Aa,
+                      ptrdiff_t         shifta,
+                      rocblas_int       lda,
+                      rocblas_stride    strideA,
+                      V                 xa,
+                      ptrdiff_t         shiftx,
+                      rocblas_int       incx,
+                      rocblas_stride    stridex,
+                      U                 beta_device_host,
+                      rocblas_stride    stride_beta,
+                      W                 ya,
+                      ptrdiff_t         shifty,
+                      rocblas_int       incy,
+                      rocblas_stride    stridey)
+{
+    auto alpha = load_scalar(alpha_device_host, hipBlockIdx_y, stride_alpha);
+    auto beta  = load_scalar(beta_device_host, hipBlockIdx_y, stride_beta);
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, hipBlockIdx_y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, hipBlockIdx_y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, hipBlockIdx_y, shifty, stridey);
+
+    using T = std::remove_cv_t<std::remove_pointer_t<decltype(A)>>;
+
+    // alpha is the same in the whole block, so all of its threads reach the barriers
+    T res = alpha ? band_tiled_kernel_calc<DIM_X, DIM_Y, B_TILE, N_PART, T_PART, CONJ>(
+                m, n, kl, ku, diag, A, lda, x, incx)
+                  : T(0);
+
+    rocblas_int ind = hipBlockIdx_x * DIM_X + hipThreadIdx_x;
+    if(hipThreadIdx_y == 0 && ind < (N_PART ? m : n))
+    {
+        if(beta != 0)
+            y[ind * ptrdiff_t(incy)] = alpha ? alpha * res + beta * y[ind * ptrdiff_t(incy)]
+                                             : beta * y[ind * ptrdiff_t(incy)];
+        else
+            y[ind * ptrdiff_t(incy)] = alpha ? alpha * res : 0;
+    }
+}
+
+// Block shape of the band-tiled kernels: DIM_X outputs per block, DIM_Y threads per output and
+// B_TILE band rows per diagonal tile, 42.5 KB of LDS for rocblas_double_complex
+static constexpr rocblas_int ROCBLAS_BAND_TILED_DIM_X  = 64;
+static constexpr rocblas_int ROCBLAS_BAND_TILED_DIM_Y  = 8;
+static constexpr rocblas_int ROCBLAS_BAND_TILED_B_TILE = 32;
+
+/**
+  *  Launches band_tiled_kernel, x and y already shifted for negative increments.
+  *  alpha and beta are host or device pointers according to the pointer mode of handle.
+  */
+template <bool N_PART, bool T_PART, bool CONJ, typename S, typename V, typename W>
+rocblas_status rocblas_band_tiled_launcher(rocblas_handle    handle,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       kl,
+                                           rocblas_int       ku,
+                                           rocblas_band_diag diag,
+                                           const S*          alpha,
+                                           rocblas_stride    stride_alpha,
+                                           V                 A,
+                                           ptrdiff_t         shifta,
+                                           rocblas_int       lda,
+                                           rocblas_stride    strideA,
+                                           V                 x,
+                                           ptrdiff_t         shiftx,
+                                           rocblas_int       incx,
+                                           rocblas_stride    stridex,
+                                           const S*          beta,
+                                           rocblas_stride    stride_beta,
+                                           W                 y,
+                                           ptrdiff_t         shifty,
+                                           rocblas_int       incy,
+                                           rocblas_stride    stridey,
+                                           rocblas_int       batch_count)
+{
+    static constexpr rocblas_int DIM_X  = ROCBLAS_BAND_TILED_DIM_X;
+    static constexpr rocblas_int DIM_Y  = ROCBLAS_BAND_TILED_DIM_Y;
+    static constexpr rocblas_int B_TILE = ROCBLAS_BAND_TILED_B_TILE;
+
+    rocblas_int len = N_PART ? m : n;
+    dim3        grid((len - 1) / DIM_X + 1, batch_count);
+    dim3        threads(DIM_X, DIM_Y);
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((band_tiled_kernel<DIM_X, DIM_Y, B_TILE, N_PART, T_PART, CONJ>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           m,
+                           n,
+                           kl,
+                           ku,
+                           diag,
+                           alpha,
+                           stride_alpha,
+                           A,
+                           shifta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           beta,
+                           stride_beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey);
+    else
+        hipLaunchKernelGGL((band_tiled_kernel<DIM_X, DIM_Y, B_TILE, N_PART, T_PART, CONJ>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           m,
+                           n,
+                           kl,
+                           ku,
+                           diag,
+                           *alpha,
+                           stride_alpha,
+                           A,
+                           shifta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           *beta,
+                           stride_beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey);
+
+    return rocblas_status_success;
+}
@@ -670,3 +670,441 @@ ROCBLAS_KERNEL __launch_bounds__(NB_X) void gemvtsm_kernel(rocblas_int    m,
 
     gemvtsm_kernel_calc<CONJ, NB_X>(m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
+
+// Multi-vector gemvn: y_j = alpha * A * x_j + beta * y_j for kv <= K vectors x_j = x + j * stridex,
+// y_j = y + j * stridey. Each thread owns one row and keeps K accumulators, so every element of A
+// is read once for all the vectors.
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int K,
+          typename T_lda,
+          typename T,
+          typename U>
+ROCBLAS_KERNEL_ILF void gemvn_multi_kernel_calc(rocblas_int    m,
+                                                rocblas_int    n,
+                                                rocblas_int    kv,
+                                                U              alpha,
+                                                const T*       A,
+                                                T_lda          lda,
+                                                const T*       x,
+                                                rocblas_int    incx,
+                                                rocblas_stride stridex,
+                                                U              beta,
+                                                T*             y,
+                                                rocblas_int    incy,
+                                                rocblas_stride stridey)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int ty  = hipThreadIdx_y;
+    rocblas_int ind = hipBlockIdx_x * DIM_X + tx;
+
+    if(!alpha)
+    {
+        if(ty == 0 && ind < m)
+            for(rocblas_int j = 0; j < K; j++)
+                if(j < kv)
+                {
+                    T* yj          = y + j * stridey;
+                    yj[ind * incy] = beta ? beta * yj[ind * incy] : 0;
+                }
+        return;
+    }
+
+    T res[K];
+    for(rocblas_int j = 0; j < K; j++)
+        res[j] = T{0};
+
+    if(ind < m)
+    {
+        for(rocblas_int col = ty; col < n; col += DIM_Y)
+        {
+            T        a  = A[ind + col * lda];
+            const T* xc = x + col * ptrdiff_t(incx);
+            for(rocblas_int j = 0; j < K; j++)
+                if(j < kv)
+                    res[j] += a * xc[j * stridex];
+        }
+    }
+
+    __shared__ T sdata[DIM_X * DIM_Y];
+
+    // kv is uniform across the block so every thread reaches the barriers
+    for(rocblas_int j = 0; j < K; j++)
+    {
+        if(j >= kv)
+            break;
+
+        sdata[tx + ty * DIM_X] = res[j];
+        __syncthreads();
+
+        if(ty == 0 && ind < m)
+        {
+            T sum = sdata[tx];
+            for(rocblas_int i = 1; i < DIM_Y; i++)
+                sum += sdata[tx + DIM_X * i];
+
+            T* yj          = y + j * stridey;
+            yj[ind * incy] = beta ? alpha * sum + beta * yj[ind * incy] : alpha * sum;
+        }
+        __syncthreads();
+    }
+}
+
+// Multi-vector gemvt: y_j = alpha * op(A) * x_j + beta * y_j, one block per column of A
+template <bool CONJ, rocblas_int NB_X, rocblas_int K, typename T_lda, typename T, typename U>
+ROCBLAS_KERNEL_ILF void gemvt_multi_kernel_calc(rocblas_int    m,
+                                                rocblas_int    n,
+                                                rocblas_int    kv,
+                                                U              alpha,
+                                                const T* __restrict__ A,
+                                                T_lda lda,
+                                                const T* __restrict__ x,
+                                                rocblas_int    incx,
+                                                rocblas_stride stridex,
+                                                U              beta,
+                                                T* __restrict__ y,
+                                                rocblas_int    incy,
+                                                rocblas_stride stridey)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int col = hipBlockIdx_x;
+
+    if(!alpha)
+    {
+        if(tx < kv)
+        {
+            T* yj          = y + tx * stridey;
+            yj[col * incy] = beta ? beta * yj[col * incy] : 0;
+        }
+        return;
+    }
+
+    A += col * size_t(lda);
+
+    T res[K];
+    for(rocblas_int j = 0; j < K; j++)
+        res[j] = T{0};
+
+    for(rocblas_int row = tx; row < m; row += NB_X)
+    {
+        T        a  = CONJ ? conj(A[row]) : A[row];
+        const T* xr = x + row * ptrdiff_t(incx);
+        for(rocblas_int j = 0; j < K; j++)
+            if(j < kv)
+                res[j] += a * xr[j * stridex];
+    }
+
+    for(rocblas_int j = 0; j < K; j++)
+    {
+        if(j >= kv)
+            break;
+
+        T sum = rocblas_dot_block_reduce<NB_X>(res[j]);
+
+        if(tx == 0)
+        {
+            // !alpha handled earlier by early return
+            T* yj          = y + j * stridey;
+            yj[col * incy] = beta ? alpha * sum + beta * yj[col * incy] : alpha * sum;
+        }
+    }
+}
+
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int K,
+          typename T_lda,
+          typename T,
+          typename U>
+ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void
+    gemvn_multi_kernel(rocblas_int    m,
+                       rocblas_int    n,
+                       rocblas_int    kv,
+                       U              alpha_device_host,
+                       const T*       A,
+                       T_lda          lda,
+                       const T*       x,
+                       rocblas_int    incx,
+                       rocblas_stride stridex,
+                       U              beta_device_host,
+                       T*             y,
+                       rocblas_int    incy,
+                       rocblas_stride stridey)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    gemvn_multi_kernel_calc<DIM_X, DIM_Y, K>(
+        m, n, kv, alpha, A, lda, x, incx, stridex, beta, y, incy, stridey);
+}
+
+template <bool CONJ, rocblas_int NB_X, rocblas_int K, typename T_lda, typename T, typename U>
+ROCBLAS_KERNEL __launch_bounds__(NB_X) void
+    gemvt_multi_kernel(rocblas_int    m,
+                       rocblas_int    n,
+                       rocblas_int    kv,
+                       U              alpha_device_host,
+                       const T*       A,
+                       T_lda          lda,
+                       const T*       x,
+                       rocblas_int    incx,
+                       rocblas_stride stridex,
+                       U              beta_device_host,
+                       T*             y,
+                       rocblas_int    incy,
+                       rocblas_stride stridey)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    gemvt_multi_kernel_calc<CONJ, NB_X, K>(
+        m, n, kv, alpha, A, lda, x, incx, stridex, beta, y, incy, stridey);
+}
+
+// Grouped gemv: problem p of a group has its own sizes, increments and A, x and y pointers, all
+// in device memory. The output of every problem is cut into tiles of DIM_X rows of y for
+// transA == none, or of DIM_Y columns of A otherwise, and a persistent grid takes tiles from a
+// work counter until all the problems of the group are done.
+template <rocblas_int DIM_X, rocblas_int DIM_Y>
+__device__ __host__ inline rocblas_int gemv_grouped_tile_count(rocblas_operation transA,
+                                                               rocblas_int       m,
+                                                               rocblas_int       n,
+                                                               rocblas_int       lda,
+                                                               rocblas_int       incx,
+                                                               rocblas_int       incy)
+{
+    // problems with invalid sizes are skipped
+    if(m <= 0 || n <= 0 || lda < m || !incx || !incy)
+        return 0;
+    return transA == rocblas_operation_none ? (m - 1) / DIM_X + 1 : (n - 1) / DIM_Y + 1;
+}
+
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T, typename U>
+ROCBLAS_KERNEL_ILF void gemvn_grouped_tile_calc(rocblas_int tile,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                U           alpha,
+                                                const T*    A,
+                                                rocblas_int lda,
+                                                const T*    x,
+                                                rocblas_int incx,
+                                                U           beta,
+                                                T*          y,
+                                                rocblas_int incy,
+                                                T*          sdata)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int ty  = hipThreadIdx_y;
+    rocblas_int ind = tile * DIM_X + tx;
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    if(incx < 0)
+        x -= ptrdiff_t(incx) * (n - 1);
+    if(incy < 0)
+        y -= ptrdiff_t(incy) * (m - 1);
+
+    T res = 0;
+    if(alpha && ind < m)
+        for(rocblas_int col = ty; col < n; col += DIM_Y)
+            res += A[ind + col * size_t(lda)] * x[col * ptrdiff_t(incx)];
+
+    sdata[tx + ty * DIM_X] = res;
+    __syncthreads();
+
+    if(ty == 0 && ind < m)
+    {
+        T sum = sdata[tx];
+        for(rocblas_int i = 1; i < DIM_Y; i++)
+            sum += sdata[tx + DIM_X * i];
+
+        T* yi = y + ind * ptrdiff_t(incy);
+        *yi   = beta ? alpha * sum + beta * *yi : alpha * sum;
+    }
+    __syncthreads();
+}
+
+template <bool CONJ, rocblas_int DIM_X, rocblas_int DIM_Y, typename T, typename U>
+ROCBLAS_KERNEL_ILF void gemvt_grouped_tile_calc(rocblas_int tile,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                U           alpha,
+                                                const T*    A,
+                                                rocblas_int lda,
+                                                const T*    x,
+                                                rocblas_int incx,
+                                                U           beta,
+                                                T*          y,
+                                                rocblas_int incy,
+                                                T*          sdata)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int ty  = hipThreadIdx_y;
+    rocblas_int col = tile * DIM_Y + ty;
+
+    if(incx < 0)
+        x -= ptrdiff_t(incx) * (m - 1);
+    if(incy < 0)
+        y -= ptrdiff_t(incy) * (n - 1);
+
+    // each row of threads computes the dot product of one column of A with x
+    T res = 0;
+    if(alpha && col < n)
+    {
+        A += col * size_t(lda);
+        for(rocblas_int row = tx; row < m; row += DIM_X)
+            res += (CONJ ? conj(A[row]) : A[row]) * x[row * ptrdiff_t(incx)];
+    }
+
+    sdata[tx + ty * DIM_X] = res;
+    __syncthreads();
+
+    for(rocblas_int s = DIM_X / 2; s > 0; s /= 2)
+    {
+        if(tx < s)
+            sdata[tx + ty * DIM_X] += sdata[tx + s + ty * DIM_X];
+        __syncthreads();
+    }
+
+    if(tx == 0 && col < n)
+    {
+        T  sum = sdata[ty * DIM_X];
+        T* yi  = y + col * ptrdiff_t(incy);
+        *yi    = beta ? alpha * sum + beta * *yi : alpha * sum;
+    }
+    __syncthreads();
+}
+
+// Exclusive prefix sum of the tile counts of the problems of a group, in a single block. Also
+// resets the work counter of gemv_grouped_kernel.
+template <rocblas_int NB, rocblas_int DIM_X, rocblas_int DIM_Y>
+ROCBLAS_KERNEL __launch_bounds__(NB) void
+    gemv_grouped_tiles_kernel(rocblas_operation   transA,
+                              const rocblas_int*  m,
+                              const rocblas_int*  n,
+                              const rocblas_int*  lda,
+                              const rocblas_int*  incx,
+                              const rocblas_int*  incy,
+                              rocblas_int         group_count,
+                              int64_t*            tile_offsets,
+                              unsigned long long* tile_counter)
+{
+    rocblas_int tid   = hipThreadIdx_x;
+    rocblas_int chunk = (group_count - 1) / NB + 1;
+    rocblas_int first = min(tid * chunk, group_count);
+    rocblas_int last  = min(first + chunk, group_count);
+
+    // each thread sums the tiles of a contiguous chunk of problems
+    auto tiles = [&](rocblas_int p) {
+        return gemv_grouped_tile_count<DIM_X, DIM_Y>(transA, m[p], n[p], lda[p], incx[p], incy[p]);
+    };
+
+    int64_t sum = 0;
+    for(rocblas_int p = first; p < last; p++)
+        sum += tiles(p);
+
+    __shared__ int64_t sdata[NB];
+    sdata[tid] = sum;
+    __syncthreads();
+
+    // inclusive Hillis-Steele scan of the chunk sums
+    for(rocblas_int s = 1; s < NB; s *= 2)
+    {
+        int64_t v = tid >= s ? sdata[tid - s] : 0;
+        __syncthreads();
+        sdata[tid] += v;
+        __syncthreads();
+    }
+
+    int64_t offset = sdata[tid] - sum;
+    for(rocblas_int p = first; p < last; p++)
+    {
+        tile_offsets[p] = offset;
+        offset += tiles(p);
+    }
+
+    if(tid == NB - 1)
+    {
+        tile_offsets[group_count] = sdata[tid];
+        *tile_counter             = 0;
+    }
+}
+
+template <bool CONJ, rocblas_int DIM_X, rocblas_int DIM_Y, typename T, typename U>
+ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void
+    gemv_grouped_kernel(rocblas_operation   transA,
+                        const rocblas_int*  m,
+                        const rocblas_int*  n,
+                        U                   alpha_device_host,
+                        const T* const*     A,
+                        const rocblas_int*  lda,
+                        const T* const*     x,
+                        const rocblas_int*  incx,
+                        U                   beta_device_host,
+                        T* const*           y,
+                        const rocblas_int*  incy,
+                        rocblas_int         group_count,
+                        const int64_t*      tile_offsets,
+                        unsigned long long* tile_counter,
+                        bool                atomics)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    __shared__ T       sdata[DIM_X * DIM_Y];
+    __shared__ int64_t next_tile;
+
+    rocblas_int tid         = hipThreadIdx_x + hipThreadIdx_y * DIM_X;
+    int64_t     total_tiles = tile_offsets[group_count];
+
+    // With atomics, the blocks take the next tile from the work counter. Otherwise block b takes
+    // the tiles b, b + gridDim.x, ... Each tile is computed by one block either way, so only the
+    // balance of the work depends on the mode.
+    for(int64_t step = hipBlockIdx_x;; step += hipGridDim_x)
+    {
+        int64_t tile = step;
+        if(atomics)
+        {
+            if(tid == 0)
+                next_tile = atomicAdd(tile_counter, 1ull);
+            __syncthreads();
+            tile = next_tile;
+            __syncthreads();
+        }
+
+        if(tile >= total_tiles)
+            break;
+
+        // the problem of the tile is the last one whose first tile is not after it
+        rocblas_int lo = 0, hi = group_count - 1;
+        while(lo < hi)
+        {
+            rocblas_int mid = (lo + hi + 1) / 2;
+            if(tile_offsets[mid] <= tile)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+        rocblas_int p = lo;
+        rocblas_int t = rocblas_int(tile - tile_offsets[p]);
+
+        // A and x may be nullptr when alpha is 0
+        const T* Ap = cond_load_ptr_batch(alpha, A, p, 0, 0);
+        const T* xp = cond_load_ptr_batch(alpha, x, p, 0, 0);
+
+        if(transA == rocblas_operation_none)
+            gemvn_grouped_tile_calc<DIM_X, DIM_Y>(
+                t, m[p], n[p], alpha, Ap, lda[p], xp, incx[p], beta, y[p], incy[p], sdata);
+        else
+            gemvt_grouped_tile_calc<CONJ, DIM_X, DIM_Y>(
+                t, m[p], n[p], alpha, Ap, lda[p], xp, incx[p], beta, y[p], incy[p], sdata);
+    }
+}
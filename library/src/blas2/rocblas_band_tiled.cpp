@@ -0,0 +1,15 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "band_device.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+rocblas_int rocblas_band_tiled_min_bandwidth()
+{
+    static const rocblas_int min_bandwidth = [] {
+        const char* env = read_env("ROCBLAS_BAND_TILED_MIN_BANDWIDTH");
+        return env && *env ? std::max(atoi(env), 0) : 32;
+    }();
+    return min_bandwidth;
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../blas1/rocblas_copy.hpp"
+#include "band_device.hpp"
 #include "check_numerics_matrix.hpp"
 #include "check_numerics_vector.hpp"
 
@@ -275,6 +276,28 @@ rocblas_status rocblas_gbmv_template(rocblas_handle    handle,
         = incy < 0 ? offsety - ptrdiff_t(incy) * (transA == rocblas_operation_none ? m - 1 : n - 1)
                    : offsety;
 
+    // wide bands reuse x and read A coalesced through LDS tiles
+    if(rocblas_band_use_tiled(kl, ku))
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha && *beta == 1)
+            return rocblas_status_success;
+
+#define gbmv_tiled_ARGS                                                                     \
+    handle, m, n, kl, ku, rocblas_band_diag::stored, alpha, 0, A, offseta, lda, strideA, x, \
+        shiftx, incx, stridex, beta, 0, y, shifty, incy, stridey, batch_count
+
+        rocblas_status status;
+        if(transA == rocblas_operation_none)
+            status = rocblas_band_tiled_launcher<true, false, false>(gbmv_tiled_ARGS);
+        else if(transA == rocblas_operation_transpose)
+            status = rocblas_band_tiled_launcher<false, true, false>(gbmv_tiled_ARGS);
+        else
+            status = rocblas_band_tiled_launcher<false, true, true>(gbmv_tiled_ARGS);
+#undef gbmv_tiled_ARGS
+
+        return status;
+    }
+
     // (gemv) GBMVX_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
     rocblas_int          block_dim   = transA == rocblas_operation_none ? m : n;
     static constexpr int GBMVX_DIM_X = 64;
@@ -8,7 +8,8 @@
 #include "check_numerics_vector.hpp"
 #include "gemv_device.hpp"
 #include "handle.hpp"
-#include "rocblas_gemv_threshold.hpp"
+#include "rocblas_gemv_selection.hpp"
+#include "tiny_batched_device.hpp"
 
 // gemvt_sn is skinny n matrix optimizations
 constexpr int rocblas_gemvt_sn_WIN()
@@ -131,15 +132,39 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                    : offsety;
     bool i64_indices = n * size_t(lda) > std::numeric_limits<rocblas_int>::max();
 
-    //Identifying the precision to have an appropriate optimization
-    bool is_float          = std::is_same<T, float>{};
-    bool is_double         = std::is_same<T, double>{};
-    bool is_complex_float  = std::is_same<T, rocblas_float_complex>{};
-    bool is_complex_double = std::is_same<T, rocblas_double_complex>{};
-
-    //Identifying the architecture to have an appropriate optimization
-    bool is_gfx908 = handle->getArch() == 908 ? true : false;
-    bool is_gfx906 = handle->getArch() == 906 ? true : false;
+    // many tiny problems run in a persistent kernel instead of one grid row per problem
+    if(rocblas_use_tiny_batched(m, n, batch_count))
+        return rocblas_gemv_tiny_batched_launcher<T>(handle,
+                                                     transA,
+                                                     m,
+                                                     n,
+                                                     alpha,
+                                                     stride_alpha,
+                                                     A,
+                                                     offseta,
+                                                     lda,
+                                                     strideA,
+                                                     x,
+                                                     shiftx,
+                                                     incx,
+                                                     stridex,
+                                                     beta,
+                                                     stride_beta,
+                                                     y,
+                                                     shifty,
+                                                     incy,
+                                                     stridey,
+                                                     batch_count);
+
+    // per-architecture kernel selection, see rocblas_gemv_select_variant
+    rocblas_gemv_variant variant
+        = rocblas_gemv_select_variant(handle->getArch(),
+                                      rocblas_precision_string<T>,
+                                      transA,
+                                      m,
+                                      n,
+                                      batch_count,
+                                      workspace && rocblas_gemvt_skinny_n<T>(transA, m, n));
 
     if(transA == rocblas_operation_none)
     {
@@ -147,7 +172,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     gemvn_grid, gemvn_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
         strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey
 
-        if(n <= 128 && m >= 2048 * n)
+        if(variant == rocblas_gemv_variant::gemvn_64x4)
         {
             // skinny tuned block size
 
@@ -182,21 +207,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
             }
         }
         //optimized gemvn kernel for gfx906 and gfx908.
-        else if((is_gfx908
-                 && (((is_float || is_double || is_complex_float) && m <= gemvn_gfx908_threshold
-                      && n <= gemvn_gfx908_threshold)
-                     || (is_complex_double && m <= zgemvn_gfx908_threshold
-                         && n <= zgemvn_gfx908_threshold)))
-
-                || (is_gfx906
-                    && (is_complex_float
-                        || ((is_float || is_double) && m <= gemvn_gfx906_threshold
-                            && n <= gemvn_gfx906_threshold)
-                        || (is_double
-                            && ((m >= dgemvn_gfx906_lower_threshold
-                                 && n >= dgemvn_gfx906_lower_threshold)
-                                || (m <= dgemvn_gfx906_upper_threshold
-                                    && n <= dgemvn_gfx906_upper_threshold))))))
+        else if(variant == rocblas_gemv_variant::gemvn_32x16)
         {
             static constexpr int GEMVN_DIM_X = 32;
             static constexpr int GEMVN_DIM_Y = 16;
@@ -267,7 +278,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     {
         // transpose
         static constexpr bool CONJ = false;
-        if(m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
+        if(variant == rocblas_gemv_variant::gemvt_sm) // few rows, e.g. qmcpack
         {
             // number of columns on the y-dim of the grid
             static constexpr int NB = 256;
@@ -329,7 +340,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    stridey);
             }
         }
-        else if(workspace && rocblas_gemvt_skinny_n<T>(transA, m, n))
+        else if(variant == rocblas_gemv_variant::gemvt_sn)
         {
             static constexpr int NB     = rocblas_gemvt_sn_NB();
             static constexpr int WIN    = rocblas_gemvt_sn_WIN();
@@ -397,7 +408,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
         strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey
         //Having 256 threads per block for single precision GEMV (transpose) for better performance
-        else if(is_float)
+        else if(variant == rocblas_gemv_variant::gemvt_256)
         {
             // number of columns on the y-dim of the grid
             static constexpr int NB = 256;
@@ -462,7 +473,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         static constexpr bool CONJ = true;
         // conjugate transpose
 
-        if(m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
+        if(variant == rocblas_gemv_variant::gemvt_sm) // few rows, e.g. qmcpack
         {
             // number of columns on the y-dim of the grid
             static constexpr int NB = 256;
@@ -524,7 +535,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    stridey);
             }
         }
-        else if(workspace && rocblas_gemvt_skinny_n<T>(transA, m, n))
+        else if(variant == rocblas_gemv_variant::gemvt_sn)
         {
             static constexpr int NB     = rocblas_gemvt_sn_NB();
             static constexpr int WIN    = rocblas_gemvt_sn_WIN();
@@ -592,7 +603,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
         strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey
         //Having 256 threads per block for single precision GEMV (transpose) for better performance
-        else if(is_float)
+        else if(variant == rocblas_gemv_variant::gemvt_256)
         {
             static constexpr int NB = 256;
             dim3                 gemvt_grid(n, batch_count);
@@ -0,0 +1,271 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_gemv_grouped.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemv_grouped_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemv_grouped_name<float>[] = "rocblas_sgemv_grouped";
+    template <>
+    constexpr char rocblas_gemv_grouped_name<double>[] = "rocblas_dgemv_grouped";
+    template <>
+    constexpr char rocblas_gemv_grouped_name<rocblas_float_complex>[] = "rocblas_cgemv_grouped";
+    template <>
+    constexpr char rocblas_gemv_grouped_name<rocblas_double_complex>[] = "rocblas_zgemv_grouped";
+
+    template <typename T>
+    rocblas_status rocblas_gemv_grouped_impl(rocblas_handle     handle,
+                                             rocblas_operation  transA,
+                                             const rocblas_int* m,
+                                             const rocblas_int* n,
+                                             const T*           alpha,
+                                             const T* const     A[],
+                                             const rocblas_int* lda,
+                                             const T* const     x[],
+                                             const rocblas_int* incx,
+                                             const T*           beta,
+                                             T* const           y[],
+                                             const rocblas_int* incy,
+                                             rocblas_int        group_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_gemv_grouped_workspace_size(group_count);
+        if(handle->is_device_memory_size_query())
+        {
+            if(group_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto transA_letter = rocblas_transpose_letter(transA);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_gemv_grouped_name<T>,
+                          transA,
+                          m,
+                          n,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          A,
+                          lda,
+                          x,
+                          incx,
+                          LOG_TRACE_SCALAR_VALUE(handle, beta),
+                          y,
+                          incy,
+                          group_count);
+
+            // the sizes are in device memory, so no rocblas-bench command can reproduce the call
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_gemv_grouped_name<T>,
+                            "transA",
+                            transA_letter,
+                            "group_count",
+                            group_count);
+        }
+
+        if(group_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!group_count)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha)
+        {
+            if(*beta == 1)
+                return rocblas_status_success;
+        }
+        else
+        {
+            if(!A || !x)
+                return rocblas_status_invalid_pointer;
+        }
+
+        if(!m || !n || !lda || !incx || !incy || !y)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status gemv_grouped_check_numerics_status
+                = rocblas_gemv_grouped_check_numerics(rocblas_gemv_grouped_name<T>,
+                                                      handle,
+                                                      transA,
+                                                      m,
+                                                      n,
+                                                      A,
+                                                      lda,
+                                                      x,
+                                                      incx,
+                                                      y,
+                                                      incy,
+                                                      group_count,
+                                                      check_numerics,
+                                                      is_input);
+            if(gemv_grouped_check_numerics_status != rocblas_status_success)
+                return gemv_grouped_check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_gemv_grouped_template(handle,
+                                                              transA,
+                                                              m,
+                                                              n,
+                                                              alpha,
+                                                              A,
+                                                              lda,
+                                                              x,
+                                                              incx,
+                                                              beta,
+                                                              y,
+                                                              incy,
+                                                              group_count,
+                                                              (void*)w_mem);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status gemv_grouped_check_numerics_status
+                = rocblas_gemv_grouped_check_numerics(rocblas_gemv_grouped_name<T>,
+                                                      handle,
+                                                      transA,
+                                                      m,
+                                                      n,
+                                                      A,
+                                                      lda,
+                                                      x,
+                                                      incx,
+                                                      y,
+                                                      incy,
+                                                      group_count,
+                                                      check_numerics,
+                                                      is_input);
+            if(gemv_grouped_check_numerics_status != rocblas_status_success)
+                return gemv_grouped_check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+* ===========================================================================
+*    C wrapper
+* ===========================================================================
+*/
+
+extern "C" {
+
+rocblas_status rocblas_sgemv_grouped(rocblas_handle     handle,
+                                     rocblas_operation  transA,
+                                     const rocblas_int* m,
+                                     const rocblas_int* n,
+                                     const float*       alpha,
+                                     const float* const A[],
+                                     const rocblas_int* lda,
+                                     const float* const x[],
+                                     const rocblas_int* incx,
+                                     const float*       beta,
+                                     float* const       y[],
+                                     const rocblas_int* incy,
+                                     rocblas_int        group_count)
+try
+{
+    return rocblas_gemv_grouped_impl(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, group_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_dgemv_grouped(rocblas_handle      handle,
+                                     rocblas_operation   transA,
+                                     const rocblas_int*  m,
+                                     const rocblas_int*  n,
+                                     const double*       alpha,
+                                     const double* const A[],
+                                     const rocblas_int*  lda,
+                                     const double* const x[],
+                                     const rocblas_int*  incx,
+                                     const double*       beta,
+                                     double* const       y[],
+                                     const rocblas_int*  incy,
+                                     rocblas_int         group_count)
+try
+{
+    return rocblas_gemv_grouped_impl(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, group_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_cgemv_grouped(rocblas_handle                     handle,
+                                     rocblas_operation                  transA,
+                                     const rocblas_int*                 m,
+                                     const rocblas_int*                 n,
+                                     const rocblas_float_complex*       alpha,
+                                     const rocblas_float_complex* const A[],
+                                     const rocblas_int*                 lda,
+                                     const rocblas_float_complex* const x[],
+                                     const rocblas_int*                 incx,
+                                     const rocblas_float_complex*       beta,
+                                     rocblas_float_complex* const       y[],
+                                     const rocblas_int*                 incy,
+                                     rocblas_int                        group_count)
+try
+{
+    return rocblas_gemv_grouped_impl(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, group_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_zgemv_grouped(rocblas_handle                      handle,
+                                     rocblas_operation                   transA,
+                                     const rocblas_int*                  m,
+                                     const rocblas_int*                  n,
+                                     const rocblas_double_complex*       alpha,
+                                     const rocblas_double_complex* const A[],
+                                     const rocblas_int*                  lda,
+                                     const rocblas_double_complex* const x[],
+                                     const rocblas_int*                  incx,
+                                     const rocblas_double_complex*       beta,
+                                     rocblas_double_complex* const       y[],
+                                     const rocblas_int*                  incy,
+                                     rocblas_int                         group_count)
+try
+{
+    return rocblas_gemv_grouped_impl(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, group_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,209 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "gemv_device.hpp"
+#include "handle.hpp"
+#include "rocblas_gemv.hpp"
+#include <vector>
+
+// threads of a gemv_grouped_kernel block, and the tile sizes of its rows and columns
+constexpr rocblas_int rocblas_gemv_grouped_dim_x()
+{
+    return 64;
+}
+
+constexpr rocblas_int rocblas_gemv_grouped_dim_y()
+{
+    return 4;
+}
+
+// resident blocks of gemv_grouped_kernel per compute unit
+constexpr rocblas_int rocblas_gemv_grouped_blocks_per_cu()
+{
+    return 8;
+}
+
+// workspace of the tile offsets of the problems and the work counter
+inline size_t rocblas_gemv_grouped_workspace_size(rocblas_int group_count)
+{
+    return sizeof(int64_t) * (size_t(group_count) + 1) + sizeof(unsigned long long);
+}
+
+/*! \brief rocblas_gemv_grouped_template
+    y_p := alpha * op(A_p) * x_p + beta * y_p for the group_count problems p, whose sizes,
+    increments and pointers are read from device arrays. A first kernel computes the offsets of
+    the tiles of every problem, then a persistent kernel with a fixed number of blocks per compute
+    unit balances the tiles of all the problems across the device, so a group of many small
+    problems of different sizes runs as two launches. Unless atomics are allowed, the blocks take
+    the tiles in a fixed round robin order instead of from an atomic counter. workspace holds
+    rocblas_gemv_grouped_workspace_size(group_count) bytes.
+    ********************************************************************/
+template <typename T, typename U>
+rocblas_status rocblas_gemv_grouped_template(rocblas_handle     handle,
+                                             rocblas_operation  transA,
+                                             const rocblas_int* m,
+                                             const rocblas_int* n,
+                                             const U*           alpha,
+                                             const T* const     A[],
+                                             const rocblas_int* lda,
+                                             const T* const     x[],
+                                             const rocblas_int* incx,
+                                             const U*           beta,
+                                             T* const           y[],
+                                             const rocblas_int* incy,
+                                             rocblas_int        group_count,
+                                             void*              workspace)
+{
+    // quick return
+    if(!group_count)
+        return rocblas_status_success;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha && *beta == 1)
+        return rocblas_status_success;
+
+    static constexpr int DIM_X = rocblas_gemv_grouped_dim_x();
+    static constexpr int DIM_Y = rocblas_gemv_grouped_dim_y();
+    static constexpr int NB    = 1024;
+
+    hipStream_t rocblas_stream = handle->get_stream();
+    auto        tile_offsets   = (int64_t*)workspace;
+    auto        tile_counter   = (unsigned long long*)(tile_offsets + group_count + 1);
+
+    hipLaunchKernelGGL((gemv_grouped_tiles_kernel<NB, DIM_X, DIM_Y>),
+                       dim3(1),
+                       dim3(NB),
+                       0,
+                       rocblas_stream,
+                       transA,
+                       m,
+                       n,
+                       lda,
+                       incx,
+                       incy,
+                       group_count,
+                       tile_offsets,
+                       tile_counter);
+
+    // the total number of tiles is only known on the device, so the grid fills the device once,
+    // with at least one block on a device of unknown CU count, 0
+    dim3 grid(std::max(1, handle->getCUCount() * rocblas_gemv_grouped_blocks_per_cu()));
+    dim3 threads(DIM_X, DIM_Y);
+    bool atomics = handle->atomics_mode == rocblas_atomics_allowed;
+
+#define gemv_grouped_KARGS(alpha_, beta_)                                                     \
+    grid, threads, 0, rocblas_stream, transA, m, n, alpha_, A, lda, x, incx, beta_, y, incy, \
+        group_count, tile_offsets, tile_counter, atomics
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        if(transA == rocblas_operation_conjugate_transpose)
+            hipLaunchKernelGGL((gemv_grouped_kernel<true, DIM_X, DIM_Y>),
+                               gemv_grouped_KARGS(alpha, beta));
+        else
+            hipLaunchKernelGGL((gemv_grouped_kernel<false, DIM_X, DIM_Y>),
+                               gemv_grouped_KARGS(alpha, beta));
+    }
+    else
+    {
+        if(transA == rocblas_operation_conjugate_transpose)
+            hipLaunchKernelGGL((gemv_grouped_kernel<true, DIM_X, DIM_Y>),
+                               gemv_grouped_KARGS(*alpha, *beta));
+        else
+            hipLaunchKernelGGL((gemv_grouped_kernel<false, DIM_X, DIM_Y>),
+                               gemv_grouped_KARGS(*alpha, *beta));
+    }
+#undef gemv_grouped_KARGS
+
+    return rocblas_status_success;
+}
+
+/*! \brief Checks the A, x and y of every problem of a group for NaN and Inf, A and x being
+    skipped when they are nullptr, as they may be when alpha is 0. The sizes and pointers of the
+    problems are in device memory, so they are copied to the host and each problem of a valid
+    size is checked as a gemv.
+    ********************************************************************/
+template <typename T>
+rocblas_status rocblas_gemv_grouped_check_numerics(const char*        function_name,
+                                                   rocblas_handle     handle,
+                                                   rocblas_operation  transA,
+                                                   const rocblas_int* m,
+                                                   const rocblas_int* n,
+                                                   const T* const     A[],
+                                                   const rocblas_int* lda,
+                                                   const T* const     x[],
+                                                   const rocblas_int* incx,
+                                                   T* const           y[],
+                                                   const rocblas_int* incy,
+                                                   rocblas_int        group_count,
+                                                   const int          check_numerics,
+                                                   bool               is_input)
+{
+    std::vector<rocblas_int> h_m(group_count), h_n(group_count), h_lda(group_count),
+        h_incx(group_count), h_incy(group_count);
+    std::vector<const T*> h_A(group_count), h_x(group_count);
+    std::vector<T*>       h_y(group_count);
+
+    hipStream_t rocblas_stream = handle->get_stream();
+    auto        copy           = [&](auto& dst, const auto* src) {
+        size_t bytes = sizeof(dst[0]) * group_count;
+        return src ? hipMemcpyAsync(dst.data(), src, bytes, hipMemcpyDeviceToHost, rocblas_stream)
+                   : hipSuccess;
+    };
+    RETURN_IF_HIP_ERROR(copy(h_m, m));
+    RETURN_IF_HIP_ERROR(copy(h_n, n));
+    RETURN_IF_HIP_ERROR(copy(h_lda, lda));
+    RETURN_IF_HIP_ERROR(copy(h_incx, incx));
+    RETURN_IF_HIP_ERROR(copy(h_incy, incy));
+    RETURN_IF_HIP_ERROR(copy(h_A, A));
+    RETURN_IF_HIP_ERROR(copy(h_x, x));
+    RETURN_IF_HIP_ERROR(copy(h_y, y));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(rocblas_stream));
+
+    for(rocblas_int p = 0; p < group_count; p++)
+    {
+        // problems with invalid sizes are skipped by the kernels
+        if(h_m[p] <= 0 || h_n[p] <= 0 || h_lda[p] < h_m[p] || !h_incx[p] || !h_incy[p])
+            continue;
+
+        rocblas_status check_numerics_status;
+        if(h_A[p] && h_x[p])
+            check_numerics_status = rocblas_gemv_check_numerics(function_name,
+                                                                handle,
+                                                                transA,
+                                                                h_m[p],
+                                                                h_n[p],
+                                                                h_A[p],
+                                                                0,
+                                                                h_lda[p],
+                                                                0,
+                                                                h_x[p],
+                                                                0,
+                                                                h_incx[p],
+                                                                0,
+                                                                h_y[p],
+                                                                0,
+                                                                h_incy[p],
+                                                                0,
+                                                                1,
+                                                                check_numerics,
+                                                                is_input);
+        else
+            check_numerics_status = rocblas_internal_check_numerics_vector_template(
+                function_name,
+                handle,
+                transA == rocblas_operation_none ? h_m[p] : h_n[p],
+                h_y[p],
+                0,
+                h_incy[p],
+                0,
+                1,
+                check_numerics,
+                is_input);
+        if(check_numerics_status != rocblas_status_success)
+            return check_numerics_status;
+    }
+    return rocblas_status_success;
+}
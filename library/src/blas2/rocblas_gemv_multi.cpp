@@ -0,0 +1,304 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_gemv_multi.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemv_multi_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemv_multi_name<float>[] = "rocblas_sgemv_multi";
+    template <>
+    constexpr char rocblas_gemv_multi_name<double>[] = "rocblas_dgemv_multi";
+    template <>
+    constexpr char rocblas_gemv_multi_name<rocblas_float_complex>[] = "rocblas_cgemv_multi";
+    template <>
+    constexpr char rocblas_gemv_multi_name<rocblas_double_complex>[] = "rocblas_zgemv_multi";
+
+    template <typename T>
+    rocblas_status rocblas_gemv_multi_impl(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          x,
+                                           rocblas_int       incx,
+                                           rocblas_stride    stride_x,
+                                           const T*          beta,
+                                           T*                y,
+                                           rocblas_int       incy,
+                                           rocblas_stride    stride_y)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto transA_letter = rocblas_transpose_letter(transA);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_gemv_multi_name<T>,
+                          transA,
+                          m,
+                          n,
+                          k,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          A,
+                          lda,
+                          x,
+                          incx,
+                          stride_x,
+                          LOG_TRACE_SCALAR_VALUE(handle, beta),
+                          y,
+                          incy,
+                          stride_y);
+
+            if(layer_mode & rocblas_layer_mode_log_bench)
+                log_bench(handle,
+                          "./rocblas-bench -f gemv_multi -r",
+                          rocblas_precision_string<T>,
+                          "--transposeA",
+                          transA_letter,
+                          "-m",
+                          m,
+                          "-n",
+                          n,
+                          "-k",
+                          k,
+                          LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                          "--lda",
+                          lda,
+                          "--incx",
+                          incx,
+                          "--stride_x",
+                          stride_x,
+                          LOG_BENCH_SCALAR_VALUE(handle, beta),
+                          "--incy",
+                          incy,
+                          "--stride_y",
+                          stride_y);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_gemv_multi_name<T>,
+                            "transA",
+                            transA_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "lda",
+                            lda,
+                            "incx",
+                            incx,
+                            "stride_x",
+                            stride_x,
+                            "incy",
+                            incy,
+                            "stride_y",
+                            stride_y);
+        }
+
+        if(m < 0 || n < 0 || k < 0 || lda < m || lda < 1 || !incx || !incy)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !k)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha)
+        {
+            if(*beta == 1)
+                return rocblas_status_success;
+        }
+        else
+        {
+            if(!A || !x)
+                return rocblas_status_invalid_pointer;
+        }
+
+        if(!y)
+            return rocblas_status_invalid_pointer;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status gemv_multi_check_numerics_status
+                = rocblas_gemv_multi_check_numerics(rocblas_gemv_multi_name<T>,
+                                                    handle,
+                                                    transA,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    A,
+                                                    lda,
+                                                    x,
+                                                    incx,
+                                                    stride_x,
+                                                    y,
+                                                    incy,
+                                                    stride_y,
+                                                    check_numerics,
+                                                    is_input);
+            if(gemv_multi_check_numerics_status != rocblas_status_success)
+                return gemv_multi_check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_gemv_multi_template(
+            handle, transA, m, n, k, alpha, A, lda, x, incx, stride_x, beta, y, incy, stride_y);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status gemv_multi_check_numerics_status
+                = rocblas_gemv_multi_check_numerics(rocblas_gemv_multi_name<T>,
+                                                    handle,
+                                                    transA,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    A,
+                                                    lda,
+                                                    x,
+                                                    incx,
+                                                    stride_x,
+                                                    y,
+                                                    incy,
+                                                    stride_y,
+                                                    check_numerics,
+                                                    is_input);
+            if(gemv_multi_check_numerics_status != rocblas_status_success)
+                return gemv_multi_check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+* ===========================================================================
+*    C wrapper
+* ===========================================================================
+*/
+
+extern "C" {
+
+rocblas_status rocblas_sgemv_multi(rocblas_handle    handle,
+                                   rocblas_operation transA,
+                                   rocblas_int       m,
+                                   rocblas_int       n,
+                                   rocblas_int       k,
+                                   const float*      alpha,
+                                   const float*      A,
+                                   rocblas_int       lda,
+                                   const float*      x,
+                                   rocblas_int       incx,
+                                   rocblas_stride    stride_x,
+                                   const float*      beta,
+                                   float*            y,
+                                   rocblas_int       incy,
+                                   rocblas_stride    stride_y)
+try
+{
+    return rocblas_gemv_multi_impl(
+        handle, transA, m, n, k, alpha, A, lda, x, incx, stride_x, beta, y, incy, stride_y);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_dgemv_multi(rocblas_handle    handle,
+                                   rocblas_operation transA,
+                                   rocblas_int       m,
+                                   rocblas_int       n,
+                                   rocblas_int       k,
+                                   const double*     alpha,
+                                   const double*     A,
+                                   rocblas_int       lda,
+                                   const double*     x,
+                                   rocblas_int       incx,
+                                   rocblas_stride    stride_x,
+                                   const double*     beta,
+                                   double*           y,
+                                   rocblas_int       incy,
+                                   rocblas_stride    stride_y)
+try
+{
+    return rocblas_gemv_multi_impl(
+        handle, transA, m, n, k, alpha, A, lda, x, incx, stride_x, beta, y, incy, stride_y);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_cgemv_multi(rocblas_handle               handle,
+                                   rocblas_operation            transA,
+                                   rocblas_int                  m,
+                                   rocblas_int                  n,
+                                   rocblas_int                  k,
+                                   const rocblas_float_complex* alpha,
+                                   const rocblas_float_complex* A,
+                                   rocblas_int                  lda,
+                                   const rocblas_float_complex* x,
+                                   rocblas_int                  incx,
+                                   rocblas_stride               stride_x,
+                                   const rocblas_float_complex* beta,
+                                   rocblas_float_complex*       y,
+                                   rocblas_int                  incy,
+                                   rocblas_stride               stride_y)
+try
+{
+    return rocblas_gemv_multi_impl(
+        handle, transA, m, n, k, alpha, A, lda, x, incx, stride_x, beta, y, incy, stride_y);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_zgemv_multi(rocblas_handle                handle,
+                                   rocblas_operation             transA,
+                                   rocblas_int                   m,
+                                   rocblas_int                   n,
+                                   rocblas_int                   k,
+                                   const rocblas_double_complex* alpha,
+                                   const rocblas_double_complex* A,
+                                   rocblas_int                   lda,
+                                   const rocblas_double_complex* x,
+                                   rocblas_int                   incx,
+                                   rocblas_stride                stride_x,
+                                   const rocblas_double_complex* beta,
+                                   rocblas_double_complex*       y,
+                                   rocblas_int                   incy,
+                                   rocblas_stride                stride_y)
+try
+{
+    return rocblas_gemv_multi_impl(
+        handle, transA, m, n, k, alpha, A, lda, x, incx, stride_x, beta, y, incy, stride_y);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_gemv.hpp"
+
+// maximum number of vectors, and accumulators per thread, of one gemv_multi kernel launch
+constexpr rocblas_int rocblas_gemv_multi_max_vectors()
+{
+    return 16;
+}
+
+template <rocblas_int K, typename T, typename U>
+rocblas_status rocblas_gemv_multi_launcher(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       kv,
+                                           U                 alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          x,
+                                           rocblas_int       incx,
+                                           rocblas_stride    stride_x,
+                                           U                 beta,
+                                           T*                y,
+                                           rocblas_int       incy,
+                                           rocblas_stride    stride_y)
+{
+    hipStream_t rocblas_stream = handle->get_stream();
+    bool        i64_indices    = n * size_t(lda) > std::numeric_limits<rocblas_int>::max();
+
+#define gemv_multi_KARGS                                                                        \
+    grid, threads, 0, rocblas_stream, m, n, kv, alpha, A, lda, x, incx, stride_x, beta, y, incy, \
+        stride_y
+
+    if(transA == rocblas_operation_none)
+    {
+        static constexpr int GEMVN_DIM_X = 64;
+        static constexpr int GEMVN_DIM_Y = 8;
+        dim3                 grid((m - 1) / GEMVN_DIM_X + 1);
+        dim3                 threads(GEMVN_DIM_X, GEMVN_DIM_Y);
+
+        if(!i64_indices)
+            hipLaunchKernelGGL((gemvn_multi_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, K, rocblas_int>),
+                               gemv_multi_KARGS);
+        else
+            hipLaunchKernelGGL((gemvn_multi_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, K, size_t>),
+                               gemv_multi_KARGS);
+    }
+    else
+    {
+        // lda always cast to size_t so single kernel
+        static constexpr int NB = 256;
+        dim3                 grid(n);
+        dim3                 threads(NB);
+
+        if(transA == rocblas_operation_transpose)
+            hipLaunchKernelGGL((gemvt_multi_kernel<false, NB, K, rocblas_int>), gemv_multi_KARGS);
+        else
+            hipLaunchKernelGGL((gemvt_multi_kernel<true, NB, K, rocblas_int>), gemv_multi_KARGS);
+    }
+#undef gemv_multi_KARGS
+
+    return rocblas_status_success;
+}
+
+/*! \brief rocblas_gemv_multi_template
+    y_j := alpha * op(A) * x_j + beta * y_j for the k vectors x_j = x + j * stride_x and
+    y_j = y + j * stride_y. Vectors are processed in chunks of rocblas_gemv_multi_max_vectors(),
+    each chunk streaming A once with one accumulator per vector in every thread.
+    ********************************************************************/
+template <typename T, typename U>
+rocblas_status rocblas_gemv_multi_template(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const U*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          x,
+                                           rocblas_int       incx,
+                                           rocblas_stride    stride_x,
+                                           const U*          beta,
+                                           T*                y,
+                                           rocblas_int       incy,
+                                           rocblas_stride    stride_y)
+{
+    // quick return
+    if(!m || !n || !k)
+        return rocblas_status_success;
+
+    // a single vector gains nothing from sharing A, so use the tuned gemv kernels
+    if(k == 1)
+        return rocblas_internal_gemv_template<T>(handle,
+                                                 transA,
+                                                 m,
+                                                 n,
+                                                 alpha,
+                                                 0,
+                                                 A,
+                                                 0,
+                                                 lda,
+                                                 0,
+                                                 x,
+                                                 0,
+                                                 incx,
+                                                 0,
+                                                 beta,
+                                                 0,
+                                                 y,
+                                                 0,
+                                                 incy,
+                                                 0,
+                                                 1,
+                                                 (T*)nullptr);
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    if(incx < 0)
+        x -= ptrdiff_t(incx) * (transA == rocblas_operation_none ? n - 1 : m - 1);
+    if(incy < 0)
+        y -= ptrdiff_t(incy) * (transA == rocblas_operation_none ? m - 1 : n - 1);
+
+    for(rocblas_int j = 0; j < k; j += rocblas_gemv_multi_max_vectors())
+    {
+        rocblas_int    kv = std::min(k - j, rocblas_gemv_multi_max_vectors());
+        const T*       xj = x + j * stride_x;
+        T*             yj = y + j * stride_y;
+        rocblas_status status;
+
+#define gemv_multi_ARGS(alpha_, beta_) \
+    handle, transA, m, n, kv, alpha_, A, lda, xj, incx, stride_x, beta_, yj, incy, stride_y
+
+        // smallest number of accumulators that holds the chunk
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            if(kv <= 4)
+                status = rocblas_gemv_multi_launcher<4>(gemv_multi_ARGS(alpha, beta));
+            else if(kv <= 8)
+                status = rocblas_gemv_multi_launcher<8>(gemv_multi_ARGS(alpha, beta));
+            else
+                status = rocblas_gemv_multi_launcher<16>(gemv_multi_ARGS(alpha, beta));
+        }
+        else
+        {
+            if(!*alpha && *beta == 1)
+                return rocblas_status_success;
+
+            if(kv <= 4)
+                status = rocblas_gemv_multi_launcher<4>(gemv_multi_ARGS(*alpha, *beta));
+            else if(kv <= 8)
+                status = rocblas_gemv_multi_launcher<8>(gemv_multi_ARGS(*alpha, *beta));
+            else
+                status = rocblas_gemv_multi_launcher<16>(gemv_multi_ARGS(*alpha, *beta));
+        }
+#undef gemv_multi_ARGS
+
+        if(status != rocblas_status_success)
+            return status;
+    }
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocblas_gemv_multi_check_numerics(const char*       function_name,
+                                                 rocblas_handle    handle,
+                                                 rocblas_operation trans_a,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const T*          A,
+                                                 rocblas_int       lda,
+                                                 const T*          x,
+                                                 rocblas_int       inc_x,
+                                                 rocblas_stride    stride_x,
+                                                 T*                y,
+                                                 rocblas_int       inc_y,
+                                                 rocblas_stride    stride_y,
+                                                 const int         check_numerics,
+                                                 bool              is_input)
+{
+    // A is shared by all vectors so it is checked once, the vectors as a batch of k
+    rocblas_status check_numerics_status
+        = rocblas_internal_check_numerics_ge_matrix_template(function_name,
+                                                             handle,
+                                                             rocblas_operation_none,
+                                                             m,
+                                                             n,
+                                                             A,
+                                                             0,
+                                                             lda,
+                                                             0,
+                                                             1,
+                                                             check_numerics,
+                                                             is_input);
+    if(check_numerics_status != rocblas_status_success)
+        return check_numerics_status;
+
+    rocblas_int n_x = trans_a == rocblas_operation_none ? n : m;
+
+    check_numerics_status = rocblas_internal_check_numerics_vector_template(function_name,
+                                                                            handle,
+                                                                            n_x,
+                                                                            x,
+                                                                            0,
+                                                                            inc_x,
+                                                                            stride_x,
+                                                                            k,
+                                                                            check_numerics,
+                                                                            is_input);
+    if(check_numerics_status != rocblas_status_success)
+        return check_numerics_status;
+
+    rocblas_int n_y = trans_a == rocblas_operation_none ? m : n;
+
+    return rocblas_internal_check_numerics_vector_template(function_name,
+                                                           handle,
+                                                           n_y,
+                                                           y,
+                                                           0,
+                                                           inc_y,
+                                                           stride_y,
+                                                           k,
+                                                           check_numerics,
+                                                           is_input);
+}
@@ -0,0 +1,249 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_gemv_selection.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Built-in rules, in the format of ROCBLAS_GEMV_SELECTION_TABLE. The gfx906 and gfx908 rules
+    // are the thresholds of (m, n) below which 512 threads per block or less perform better.
+    constexpr char rocblas_gemv_builtin_rules[] = R"(
+# arch precisions        ops  m_min m_max n_min n_max batch_min batch_max m_over_n variant
+*      *                 N    *     *     *     128   *         *         2048     gemvn_64x4
+908    f32_r,f64_r,f32_c N    *     15000 *     15000 *         *         *        gemvn_32x16
+908    f64_c             N    *     18000 *     18000 *         *         *        gemvn_32x16
+906    f32_c             N    *     *     *     *     *         *         *        gemvn_32x16
+906    f32_r,f64_r       N    *     6000  *     6000  *         *         *        gemvn_32x16
+906    f64_r             N    15000 *     15000 *     *         *         *        gemvn_32x16
+906    f64_r             N    *     24000 *     24000 *         *         *        gemvn_32x16
+*      *                 N    *     *     *     *     *         *         *        gemvn_64x16
+*      *                 T,C  *     64    *     *     9         *         *        gemvt_sm
+*      *                 T,C  *     *     *     *     *         *         *        gemvt_sn
+*      f32_r             T,C  *     *     *     *     *         *         *        gemvt_256
+*      *                 T,C  *     *     *     *     *         *         *        gemvt_1024
+)";
+
+    constexpr std::pair<const char*, rocblas_gemv_variant> rocblas_gemv_variant_names[] = {
+        {"gemvn_64x4", rocblas_gemv_variant::gemvn_64x4},
+        {"gemvn_32x16", rocblas_gemv_variant::gemvn_32x16},
+        {"gemvn_64x16", rocblas_gemv_variant::gemvn_64x16},
+        {"gemvt_sm", rocblas_gemv_variant::gemvt_sm},
+        {"gemvt_sn", rocblas_gemv_variant::gemvt_sn},
+        {"gemvt_256", rocblas_gemv_variant::gemvt_256},
+        {"gemvt_1024", rocblas_gemv_variant::gemvt_1024},
+    };
+
+    struct rocblas_gemv_rule
+    {
+        rocblas_int              arch = -1; // -1 matches any architecture
+        std::vector<std::string> precisions; // empty matches any precision
+        std::string              operations; // empty matches any operation
+        rocblas_int              m_min = 0, m_max = INT_MAX;
+        rocblas_int              n_min = 0, n_max = INT_MAX;
+        rocblas_int              batch_min = 0, batch_max = INT_MAX;
+        rocblas_int              m_over_n  = 0;
+        rocblas_gemv_variant     variant;
+    };
+
+    bool parse_int(const std::string& token, rocblas_int& value)
+    {
+        if(token == "*")
+            return true;
+        char* end;
+        long  v = strtol(token.c_str(), &end, 10);
+        if(*end || v < 0 || v > INT_MAX)
+            return false;
+        value = rocblas_int(v);
+        return true;
+    }
+
+    bool parse_rule(const std::string& line, rocblas_gemv_rule& rule)
+    {
+        std::istringstream       is(line);
+        std::vector<std::string> tokens;
+        for(std::string token; is >> token;)
+            tokens.push_back(token);
+        if(tokens.size() != 11)
+            return false;
+
+        if(tokens[1] != "*")
+        {
+            std::istringstream precisions(tokens[1]);
+            for(std::string precision; std::getline(precisions, precision, ',');)
+                rule.precisions.push_back(precision);
+        }
+
+        if(tokens[2] != "*")
+        {
+            std::istringstream operations(tokens[2]);
+            for(std::string operation; std::getline(operations, operation, ',');)
+            {
+                if(operation != "N" && operation != "T" && operation != "C")
+                    return false;
+                rule.operations += operation;
+            }
+        }
+
+        for(auto& name : rocblas_gemv_variant_names)
+            if(tokens[10] == name.first)
+            {
+                rule.variant = name.second;
+                return parse_int(tokens[0], rule.arch) && parse_int(tokens[3], rule.m_min)
+                       && parse_int(tokens[4], rule.m_max) && parse_int(tokens[5], rule.n_min)
+                       && parse_int(tokens[6], rule.n_max) && parse_int(tokens[7], rule.batch_min)
+                       && parse_int(tokens[8], rule.batch_max)
+                       && parse_int(tokens[9], rule.m_over_n);
+            }
+
+        return false;
+    }
+
+    // returns the number of malformed rules
+    size_t parse_rules(std::istream&                   is,
+                       const char*                     source,
+                       std::vector<rocblas_gemv_rule>& rules)
+    {
+        size_t malformed   = 0;
+        size_t line_number = 0;
+        for(std::string line; std::getline(is, line);)
+        {
+            line_number++;
+            line = line.substr(0, line.find('#'));
+            if(line.find_first_not_of(" \t\r") == std::string::npos)
+                continue;
+
+            rocblas_gemv_rule rule;
+            if(parse_rule(line, rule))
+                rules.push_back(rule);
+            else
+            {
+                malformed++;
+                rocblas_cerr << "rocBLAS warning: ignoring malformed gemv selection rule at "
+                             << source << ":" << line_number << std::endl;
+            }
+        }
+        return malformed;
+    }
+
+    // Rules of ROCBLAS_GEMV_SELECTION_TABLE followed by the built-in rules
+    std::vector<rocblas_gemv_rule> load_rules()
+    {
+        std::vector<rocblas_gemv_rule> rules;
+
+        const char* path = read_env("ROCBLAS_GEMV_SELECTION_TABLE");
+        if(path && *path)
+        {
+            std::ifstream file(path);
+            if(file)
+                parse_rules(file, path, rules);
+            else
+                rocblas_cerr << "rocBLAS warning: cannot open gemv selection table " << path
+                             << std::endl;
+        }
+
+        std::istringstream builtin(rocblas_gemv_builtin_rules);
+        parse_rules(builtin, "built-in", rules);
+        return rules;
+    }
+
+    bool variant_applies(rocblas_gemv_variant variant,
+                         rocblas_operation    transA,
+                         rocblas_int          m,
+                         bool                 skinny_workspace)
+    {
+        switch(variant)
+        {
+        case rocblas_gemv_variant::gemvn_64x4:
+        case rocblas_gemv_variant::gemvn_32x16:
+        case rocblas_gemv_variant::gemvn_64x16:
+            return transA == rocblas_operation_none;
+        case rocblas_gemv_variant::gemvt_sm:
+            return transA != rocblas_operation_none && m <= 64;
+        case rocblas_gemv_variant::gemvt_sn:
+            return transA != rocblas_operation_none && skinny_workspace;
+        case rocblas_gemv_variant::gemvt_256:
+        case rocblas_gemv_variant::gemvt_1024:
+            return transA != rocblas_operation_none;
+        }
+        return false;
+    }
+
+    // the variant of the first matching rule which applies to the problem
+    rocblas_gemv_variant select_variant(const std::vector<rocblas_gemv_rule>& rules,
+                                        rocblas_int                           arch,
+                                        const char*                           precision,
+                                        rocblas_operation                     transA,
+                                        rocblas_int                           m,
+                                        rocblas_int                           n,
+                                        rocblas_int                           batch_count,
+                                        bool                                  skinny_workspace)
+    {
+        char operation = transA == rocblas_operation_none        ? 'N'
+                         : transA == rocblas_operation_transpose ? 'T'
+                                                                 : 'C';
+
+        for(auto& rule : rules)
+        {
+            if(rule.arch != -1 && rule.arch != arch)
+                continue;
+            if(!rule.precisions.empty()
+               && std::find(rule.precisions.begin(), rule.precisions.end(), precision)
+                      == rule.precisions.end())
+                continue;
+            if(!rule.operations.empty() && rule.operations.find(operation) == std::string::npos)
+                continue;
+            if(m < rule.m_min || m > rule.m_max || n < rule.n_min || n > rule.n_max
+               || batch_count < rule.batch_min || batch_count > rule.batch_max
+               || int64_t(m) < int64_t(rule.m_over_n) * n)
+                continue;
+            if(variant_applies(rule.variant, transA, m, skinny_workspace))
+                return rule.variant;
+        }
+
+        // unreachable with the built-in catch-all rules
+        return transA == rocblas_operation_none ? rocblas_gemv_variant::gemvn_64x16
+                                                : rocblas_gemv_variant::gemvt_1024;
+    }
+}
+
+rocblas_gemv_variant rocblas_gemv_select_variant(rocblas_int       arch,
+                                                 const char*       precision,
+                                                 rocblas_operation transA,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       batch_count,
+                                                 bool              skinny_workspace)
+{
+    // thread-safe initialization on first use
+    static const std::vector<rocblas_gemv_rule> rules = load_rules();
+    return select_variant(rules, arch, precision, transA, m, n, batch_count, skinny_workspace);
+}
+
+rocblas_gemv_variant rocblas_internal_gemv_select_variant(const char*       table,
+                                                          size_t*           malformed_rules,
+                                                          rocblas_int       arch,
+                                                          const char*       precision,
+                                                          rocblas_operation transA,
+                                                          rocblas_int       m,
+                                                          rocblas_int       n,
+                                                          rocblas_int       batch_count,
+                                                          bool              skinny_workspace)
+{
+    std::vector<rocblas_gemv_rule> rules;
+    std::istringstream             is(table ? table : "");
+    size_t                         malformed = parse_rules(is, "table", rules);
+    if(malformed_rules)
+        *malformed_rules = malformed;
+
+    std::istringstream builtin(rocblas_gemv_builtin_rules);
+    parse_rules(builtin, "built-in", rules);
+    return select_variant(rules, arch, precision, transA, m, n, batch_count, skinny_workspace);
+}
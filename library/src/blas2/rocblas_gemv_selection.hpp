@@ -0,0 +1,77 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#include "rocblas.h"
+
+// Kernel variants which rocblas_internal_gemv_template can launch
+enum class rocblas_gemv_variant
+{
+    gemvn_64x4, // gemvn_kernel with 64 x 4 threads, tuned for skinny A
+    gemvn_32x16, // gemvn_kernel with 32 x 16 threads
+    gemvn_64x16, // gemvn_kernel with 64 x 16 threads
+    gemvt_sm, // gemvtsm_kernel, one block per batch instance, m <= 64 only
+    gemvt_sn, // gemvt_sn_kernel and rocblas_gemvt_sn_reduce, needs the skinny n workspace
+    gemvt_256, // gemvt_kernel with 256 threads per column
+    gemvt_1024, // gemvt_kernel with 1024 threads per column
+};
+
+/*! \brief rocblas_gemv_select_variant
+
+    \details
+    Selects the gemv kernel variant from a table of rules, replacing hardcoded per-architecture
+    thresholds. Each rule matches an architecture, a set of precisions, a set of operations and
+    ranges of m, n, batch_count and m / n; the first matching rule whose variant is applicable to
+    the problem wins.
+
+    The rules of the file named by the environment variable ROCBLAS_GEMV_SELECTION_TABLE are
+    tried first, followed by the built-in rules, which are tuned for gfx906 and gfx908 and end
+    with catch-all defaults. The file is read once per process, when gemv first selects a
+    variant. scripts/performance/blas/gemv_selection_sweep.py generates it with rocblas-bench.
+
+    The table file has one rule per line, '#' starts a comment and '*' matches anything:
+
+        arch precisions operations m_min m_max n_min n_max batch_min batch_max m_over_n variant
+
+    e.g. "908 f32_r,f64_r N * 15000 * 15000 * * * gemvn_32x16". precisions are the rocblas-bench
+    precision strings, operations are N, T and C, bounds are inclusive, and m_over_n is the
+    minimum of m / n. Malformed rules are reported on stderr and ignored.
+
+    @param[in]
+    arch      rocblas_int
+              gcnArch of the device of the handle, e.g. 906.
+    @param[in]
+    precision const char*
+              rocblas_precision_string of the data type.
+    @param[in]
+    skinny_workspace bool
+              the workspace of rocblas_internal_gemv_kernel_workspace_size is available, which
+              gemvt_sn requires.
+    ********************************************************************/
+rocblas_gemv_variant rocblas_gemv_select_variant(rocblas_int       arch,
+                                                 const char*       precision,
+                                                 rocblas_operation transA,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       batch_count,
+                                                 bool              skinny_workspace);
+
+/*! \brief rocblas_internal_gemv_select_variant
+
+    \details
+    For internal use during testing. Selects the variant like rocblas_gemv_select_variant, with
+    the rules of table, in the format of ROCBLAS_GEMV_SELECTION_TABLE, instead of the rules of the
+    file, followed by the built-in rules. The number of malformed rules of table, which are
+    ignored, is returned in malformed_rules unless it is nullptr.
+    ********************************************************************/
+ROCBLAS_INTERNAL_EXPORT rocblas_gemv_variant
+    rocblas_internal_gemv_select_variant(const char*       table,
+                                         size_t*           malformed_rules,
+                                         rocblas_int       arch,
+                                         const char*       precision,
+                                         rocblas_operation transA,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       batch_count,
+                                         bool              skinny_workspace);
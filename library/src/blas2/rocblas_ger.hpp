@@ -7,6 +7,7 @@
 #include "check_numerics_matrix.hpp"
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "tiny_batched_device.hpp"
 
 template <rocblas_int DIM_X,
           rocblas_int DIM_Y,
@@ -141,6 +142,27 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (m - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
+    // many tiny problems run in a persistent kernel instead of one grid slice per problem
+    if(rocblas_use_tiny_batched(m, n, batch_count))
+        return rocblas_ger_tiny_batched_launcher<CONJ, T>(handle,
+                                                          m,
+                                                          n,
+                                                          alpha,
+                                                          stride_alpha,
+                                                          x,
+                                                          shiftx,
+                                                          incx,
+                                                          stridex,
+                                                          y,
+                                                          shifty,
+                                                          incy,
+                                                          stridey,
+                                                          A,
+                                                          offsetA,
+                                                          lda,
+                                                          strideA,
+                                                          batch_count);
+
     static constexpr int DIM_X = 32;
     static constexpr int DIM_Y = 32;
     static constexpr int WIN
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "band_device.hpp"
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 
@@ -205,6 +206,41 @@ rocblas_status rocblas_hbmv_template(rocblas_handle handle,
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
+    // wide bands reuse x and read A coalesced through LDS tiles, the stored triangle is summed
+    // as a band of A and the strict triangle once more as a band of A**H
+    if(rocblas_band_use_tiled(0, k))
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha && *beta == 1)
+            return rocblas_status_success;
+
+        rocblas_int kl = uplo == rocblas_fill_upper ? 0 : k;
+        rocblas_int ku = uplo == rocblas_fill_upper ? k : 0;
+
+        return rocblas_band_tiled_launcher<true, true, true>(handle,
+                                                              n,
+                                                              n,
+                                                              kl,
+                                                              ku,
+                                                              rocblas_band_diag::real,
+                                                              alpha,
+                                                              0,
+                                                              A,
+                                                              offseta,
+                                                              lda,
+                                                              strideA,
+                                                              x,
+                                                              shiftx,
+                                                              incx,
+                                                              stridex,
+                                                              beta,
+                                                              0,
+                                                              y,
+                                                              shifty,
+                                                              incy,
+                                                              stridey,
+                                                              batch_count);
+    }
+
     // hbmvN_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
     static constexpr int hbmvN_DIM_X = 64;
     static constexpr int hbmvN_DIM_Y = 16;
@@ -1,7 +1,9 @@
 /* ************************************************************************
  * Copyright 2016-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
+#include "rocblas_hemv.hpp"
 #include "rocblas_hpmv.hpp"
+#include "rocblas_packed.hpp"
 #include "logging.hpp"
 
 namespace
@@ -27,7 +29,23 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // in the unpack mode, AP is unpacked into device memory for hemv, unless the handle's
+        // packed unpack cache holds its unpacked copy
+        bool     unpack     = handle->packed_mode == rocblas_packed_unpack && n > 0;
+        auto     unpack_key = rocblas_packed_unpack_key(handle, AP, n, uplo);
+        const T* cached_A
+            = unpack ? rocblas_packed_unpack_cache_find<T>(handle, unpack_key) : nullptr;
+
+        size_t full_bytes
+            = unpack && !cached_A ? rocblas_packed_unpack_workspace_size<T>(n, 1) : 0;
+        size_t hemv_bytes = unpack ? rocblas_internal_hemv_symv_kernel_workspace_size<T>(n) : 0;
+        if(handle->is_device_memory_size_query())
+        {
+            if(!unpack)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(full_bytes, hemv_bytes);
+        }
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
@@ -104,6 +122,11 @@ namespace
         constexpr rocblas_int    offset_A = 0, offset_x = 0, offset_y = 0, batch_count = 1;
         constexpr rocblas_stride stride_A = 0, stride_x = 0, stride_y = 0;
 
+        // without the device memory of the unpack mode, AP is indexed directly
+        auto w_mem = handle->device_malloc(full_bytes, hemv_bytes);
+        if(!w_mem)
+            unpack = false;
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -129,23 +152,59 @@ namespace
                 return hpmv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_hpmv_template(handle,
-                                                      uplo,
-                                                      n,
-                                                      alpha,
-                                                      AP,
-                                                      offset_A,
-                                                      stride_A,
-                                                      x,
-                                                      offset_x,
-                                                      incx,
-                                                      stride_x,
-                                                      beta,
-                                                      y,
-                                                      offset_y,
-                                                      incy,
-                                                      stride_y,
-                                                      batch_count);
+        // AP is not read, and may be null, when alpha is zero
+        rocblas_status status;
+        if(unpack && (handle->pointer_mode == rocblas_pointer_mode_device || *alpha))
+        {
+            const T* A_full = cached_A;
+            if(!A_full)
+            {
+                RETURN_IF_ROCBLAS_ERROR(rocblas_internal_unpack_template(
+                    handle, uplo, n, 1, AP, offset_A, stride_A, (T*)w_mem[0], 0, n, 0, 1));
+                A_full = (const T*)w_mem[0];
+                handle->packed_unpack_cache.insert(
+                    unpack_key, A_full, full_bytes, handle->get_stream());
+            }
+            status = rocblas_internal_hemv_symv_template<true>(handle,
+                                                               uplo,
+                                                               n,
+                                                               alpha,
+                                                               0,
+                                                               A_full,
+                                                               0,
+                                                               n,
+                                                               0,
+                                                               x,
+                                                               offset_x,
+                                                               incx,
+                                                               stride_x,
+                                                               beta,
+                                                               0,
+                                                               y,
+                                                               offset_y,
+                                                               incy,
+                                                               stride_y,
+                                                               1,
+                                                               (T*)w_mem[1]);
+        }
+        else
+            status = rocblas_hpmv_template(handle,
+                                           uplo,
+                                           n,
+                                           alpha,
+                                           AP,
+                                           offset_A,
+                                           stride_A,
+                                           x,
+                                           offset_x,
+                                           incx,
+                                           stride_x,
+                                           beta,
+                                           y,
+                                           offset_y,
+                                           incy,
+                                           stride_y,
+                                           batch_count);
         if(status != rocblas_status_success)
             return status;
 
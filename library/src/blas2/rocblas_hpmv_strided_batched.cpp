@@ -2,7 +2,9 @@
  * Copyright 2016-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 #include "logging.hpp"
+#include "rocblas_hemv.hpp"
 #include "rocblas_hpmv.hpp"
+#include "rocblas_packed.hpp"
 
 namespace
 {
@@ -31,7 +33,19 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // in the unpack mode, AP is unpacked into device memory for hemv
+        bool unpack = handle->packed_mode == rocblas_packed_unpack && n > 0 && batch_count > 0;
+
+        size_t full_bytes = unpack ? rocblas_packed_unpack_workspace_size<T>(n, batch_count) : 0;
+        size_t hemv_bytes
+            = unpack ? rocblas_internal_hemv_symv_kernel_workspace_size<T>(n, batch_count) : 0;
+        if(handle->is_device_memory_size_query())
+        {
+            if(!unpack)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(full_bytes, hemv_bytes);
+        }
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
@@ -127,6 +141,11 @@ namespace
 
         constexpr rocblas_int offset_A = 0, offset_x = 0, offset_y = 0;
 
+        // without the device memory of the unpack mode, the packed matrices are indexed directly
+        auto w_mem = handle->device_malloc(full_bytes, hemv_bytes);
+        if(!w_mem)
+            unpack = false;
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -152,23 +171,64 @@ namespace
                 return hpmv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_hpmv_template(handle,
-                                                      uplo,
-                                                      n,
-                                                      alpha,
-                                                      AP,
-                                                      offset_A,
-                                                      stride_A,
-                                                      x,
-                                                      offset_x,
-                                                      incx,
-                                                      stride_x,
-                                                      beta,
-                                                      y,
-                                                      offset_y,
-                                                      incy,
-                                                      stride_y,
-                                                      batch_count);
+        // AP is not read, and may be null, when alpha is zero
+        rocblas_status status;
+        if(unpack && (handle->pointer_mode == rocblas_pointer_mode_device || *alpha))
+        {
+            rocblas_stride stride_full = rocblas_stride(n) * n;
+            RETURN_IF_ROCBLAS_ERROR(rocblas_internal_unpack_template(handle,
+                                                                     uplo,
+                                                                     n,
+                                                                     1,
+                                                                     AP,
+                                                                     offset_A,
+                                                                     stride_A,
+                                                                     (T*)w_mem[0],
+                                                                     0,
+                                                                     n,
+                                                                     stride_full,
+                                                                     batch_count));
+            const T* A_full = (const T*)w_mem[0];
+            status = rocblas_internal_hemv_symv_template<true>(handle,
+                                                               uplo,
+                                                               n,
+                                                               alpha,
+                                                               0,
+                                                               A_full,
+                                                               0,
+                                                               n,
+                                                               stride_full,
+                                                               x,
+                                                               offset_x,
+                                                               incx,
+                                                               stride_x,
+                                                               beta,
+                                                               0,
+                                                               y,
+                                                               offset_y,
+                                                               incy,
+                                                               stride_y,
+                                                               batch_count,
+                                                               (T*)w_mem[1]);
+        }
+        else
+            status = rocblas_hpmv_template(handle,
+                                           uplo,
+                                           n,
+                                           alpha,
+                                           AP,
+                                           offset_A,
+                                           stride_A,
+                                           x,
+                                           offset_x,
+                                           incx,
+                                           stride_x,
+                                           beta,
+                                           y,
+                                           offset_y,
+                                           incy,
+                                           stride_y,
+                                           batch_count);
         if(status != rocblas_status_success)
             return status;
 
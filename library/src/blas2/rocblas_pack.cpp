@@ -0,0 +1,122 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_packed.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // Elements are copied as elem_size / sizeof(W) words of type W
+    template <bool PACK, typename W>
+    rocblas_status rocblas_pack_unpack_words(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             rocblas_int    elem_size,
+                                             const void*    src,
+                                             void*          dst,
+                                             rocblas_int    lda)
+    {
+        rocblas_int words = elem_size / sizeof(W);
+        if constexpr(PACK)
+            return rocblas_internal_pack_template(
+                handle, uplo, n, words, (const W*)src, 0, lda, 0, (W*)dst, 0, 0, 1);
+        else
+            return rocblas_internal_unpack_template(
+                handle, uplo, n, words, (const W*)src, 0, 0, (W*)dst, 0, lda, 0, 1);
+    }
+
+    template <bool PACK>
+    rocblas_status rocblas_pack_unpack_impl(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            rocblas_int    elem_size,
+                                            const void*    src,
+                                            void*          dst,
+                                            rocblas_int    lda)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            if(PACK)
+                log_trace(handle, "rocblas_pack", uplo, n, elem_size, src, lda, dst);
+            else
+                log_trace(handle, "rocblas_unpack", uplo, n, elem_size, src, dst, lda);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+
+        if(n < 0 || elem_size <= 0 || lda < n || lda < 1)
+            return rocblas_status_invalid_size;
+
+        if(!n)
+            return rocblas_status_success;
+
+        if(!src || !dst)
+            return rocblas_status_invalid_pointer;
+
+        // copy with the widest words which divide the element size
+        if(elem_size % sizeof(uint64_t) == 0)
+            return rocblas_pack_unpack_words<PACK, uint64_t>(
+                handle, uplo, n, elem_size, src, dst, lda);
+        else if(elem_size % sizeof(uint32_t) == 0)
+            return rocblas_pack_unpack_words<PACK, uint32_t>(
+                handle, uplo, n, elem_size, src, dst, lda);
+        else if(elem_size % sizeof(uint16_t) == 0)
+            return rocblas_pack_unpack_words<PACK, uint16_t>(
+                handle, uplo, n, elem_size, src, dst, lda);
+        else
+            return rocblas_pack_unpack_words<PACK, uint8_t>(
+                handle, uplo, n, elem_size, src, dst, lda);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_unpack(rocblas_handle handle,
+                              rocblas_fill   uplo,
+                              rocblas_int    n,
+                              rocblas_int    elem_size,
+                              const void*    AP,
+                              void*          A,
+                              rocblas_int    lda)
+try
+{
+    return rocblas_pack_unpack_impl<false>(handle, uplo, n, elem_size, AP, A, lda);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_pack(rocblas_handle handle,
+                            rocblas_fill   uplo,
+                            rocblas_int    n,
+                            rocblas_int    elem_size,
+                            const void*    A,
+                            rocblas_int    lda,
+                            void*          AP)
+try
+{
+    return rocblas_pack_unpack_impl<true>(handle, uplo, n, elem_size, A, AP, lda);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+
+/**
+  *  Copies the triangle of an n x n matrix between packed storage AP and full storage A, in the
+  *  direction given by PACK. Each element is made of words consecutive values of the pointed type,
+  *  so that rocblas_pack and rocblas_unpack handle any element size. The x dimension of the grid
+  *  runs down the words of a column, which are contiguous in both AP and A.
+  */
+template <rocblas_int DIM_X, rocblas_int DIM_Y, bool PACK, typename UP, typename UA>
+ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void
+    rocblas_pack_unpack_kernel(bool           upper,
+                               rocblas_int    n,
+                               rocblas_int    words,
+                               UP             APa,
+                               ptrdiff_t      shift_AP,
+                               rocblas_stride stride_AP,
+                               UA             Aa,
+                               ptrdiff_t      shift_A,
+                               rocblas_int    lda,
+                               rocblas_stride stride_A)
+{
+    size_t      r = hipBlockIdx_x * size_t(DIM_X) + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * DIM_Y + hipThreadIdx_y;
+    if(j >= n || r >= size_t(n) * words)
+        return;
+
+    rocblas_int i = r / words;
+    rocblas_int w = r % words;
+    if(upper ? i > j : i < j)
+        return;
+
+    // column j starts at j * (j + 1) / 2 in the upper triangle and at j * (2n - j + 1) / 2 in the
+    // lower one, where its first element is row j
+    size_t p = upper ? size_t(j) * (j + 1) / 2 + i : size_t(j) * (2 * size_t(n) - j - 1) / 2 + i;
+    size_t f = i + size_t(lda) * j;
+
+    auto AP = load_ptr_batch(APa, hipBlockIdx_z, shift_AP, stride_AP);
+    auto A  = load_ptr_batch(Aa, hipBlockIdx_z, shift_A, stride_A);
+
+    if constexpr(PACK)
+        AP[p * words + w] = A[f * words + w];
+    else
+        A[f * words + w] = AP[p * words + w];
+}
+
+template <bool PACK, typename UP, typename UA>
+rocblas_status rocblas_pack_unpack_launcher(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            rocblas_int    words,
+                                            UP             AP,
+                                            rocblas_int    offset_AP,
+                                            rocblas_stride stride_AP,
+                                            UA             A,
+                                            rocblas_int    offset_A,
+                                            rocblas_int    lda,
+                                            rocblas_stride stride_A,
+                                            rocblas_int    batch_count)
+{
+    if(!n || !batch_count)
+        return rocblas_status_success;
+
+    static constexpr int packed_DIM_X = 64;
+    static constexpr int packed_DIM_Y = 4;
+    rocblas_int          blocks_x     = (size_t(n) * words - 1) / packed_DIM_X + 1;
+    rocblas_int          blocks_y     = (n - 1) / packed_DIM_Y + 1;
+    dim3                 grid(blocks_x, blocks_y, batch_count);
+    dim3                 threads(packed_DIM_X, packed_DIM_Y);
+
+    hipLaunchKernelGGL((rocblas_pack_unpack_kernel<packed_DIM_X, packed_DIM_Y, PACK>),
+                       grid,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       uplo == rocblas_fill_upper,
+                       n,
+                       words,
+                       AP,
+                       offset_AP,
+                       stride_AP,
+                       A,
+                       offset_A,
+                       lda,
+                       stride_A);
+
+    return rocblas_status_success;
+}
+
+/**
+  *  Copies the packed triangles AP into the same triangles of the full matrices A. The offsets
+  *  and strides count values of the pointed types, which hold words values per element.
+  */
+template <typename TConstPtr, typename TPtr>
+rocblas_status rocblas_internal_unpack_template(rocblas_handle handle,
+                                                rocblas_fill   uplo,
+                                                rocblas_int    n,
+                                                rocblas_int    words,
+                                                TConstPtr      AP,
+                                                rocblas_int    offset_AP,
+                                                rocblas_stride stride_AP,
+                                                TPtr           A,
+                                                rocblas_int    offset_A,
+                                                rocblas_int    lda,
+                                                rocblas_stride stride_A,
+                                                rocblas_int    batch_count)
+{
+    return rocblas_pack_unpack_launcher<false>(
+        handle, uplo, n, words, AP, offset_AP, stride_AP, A, offset_A, lda, stride_A, batch_count);
+}
+
+/**
+  *  Copies the triangles of the full matrices A into the packed matrices AP.
+  */
+template <typename TConstPtr, typename TPtr>
+rocblas_status rocblas_internal_pack_template(rocblas_handle handle,
+                                              rocblas_fill   uplo,
+                                              rocblas_int    n,
+                                              rocblas_int    words,
+                                              TConstPtr      A,
+                                              rocblas_int    offset_A,
+                                              rocblas_int    lda,
+                                              rocblas_stride stride_A,
+                                              TPtr           AP,
+                                              rocblas_int    offset_AP,
+                                              rocblas_stride stride_AP,
+                                              rocblas_int    batch_count)
+{
+    return rocblas_pack_unpack_launcher<true>(
+        handle, uplo, n, words, AP, offset_AP, stride_AP, A, offset_A, lda, stride_A, batch_count);
+}
+
+/**
+  *  In the rocblas_packed_unpack mode, the packed routines unpack AP into n x n matrices with
+  *  lda = n in device memory, before each call of the full storage routine. Without this device
+  *  memory, they index AP directly.
+  */
+template <typename T>
+inline size_t rocblas_packed_unpack_workspace_size(rocblas_int n, rocblas_int batch_count)
+{
+    return sizeof(T) * n * n * batch_count;
+}
+
+/**
+  *  Identifies the unpacked copy of the packed matrix AP in the handle's packed unpack cache.
+  */
+template <typename T>
+inline rocblas_unpack_key
+    rocblas_packed_unpack_key(rocblas_handle handle, const T* AP, rocblas_int n, rocblas_fill uplo)
+{
+    return {AP, n, uplo, rocblas_precision_string<T>, handle->packed_unpack_cache.version};
+}
+
+/**
+  *  The unpacked copy of key kept by the handle's packed unpack cache for the non-batched packed
+  *  routines, or nullptr on a miss or when the cache is disabled. A size query assumes a miss,
+  *  which needs the most device memory.
+  */
+template <typename T>
+inline const T* rocblas_packed_unpack_cache_find(rocblas_handle            handle,
+                                                 const rocblas_unpack_key& key)
+{
+    if(!handle->packed_unpack_cache.size || handle->is_device_memory_size_query())
+        return nullptr;
+    return (const T*)handle->packed_unpack_cache.find(key);
+}
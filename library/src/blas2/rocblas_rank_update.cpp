@@ -0,0 +1,443 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_rank_update.hpp"
+#include "logging.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    template <rocblas_rank_update_kind, bool, typename>
+    constexpr char rocblas_rank_update_name[] = "unknown";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::general, false, float>[]
+        = "rocblas_sger_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::general, false, double>[]
+        = "rocblas_dger_deferred";
+    template <>
+    constexpr char
+        rocblas_rank_update_name<rocblas_rank_update_kind::general, false, rocblas_float_complex>[]
+        = "rocblas_cgeru_deferred";
+    template <>
+    constexpr char
+        rocblas_rank_update_name<rocblas_rank_update_kind::general, false, rocblas_double_complex>[]
+        = "rocblas_zgeru_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::general_conj,
+                                            false,
+                                            rocblas_float_complex>[]
+        = "rocblas_cgerc_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::general_conj,
+                                            false,
+                                            rocblas_double_complex>[]
+        = "rocblas_zgerc_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::symmetric, false, float>[]
+        = "rocblas_ssyr_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::symmetric, false, double>[]
+        = "rocblas_dsyr_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::symmetric,
+                                            false,
+                                            rocblas_float_complex>[]
+        = "rocblas_csyr_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::symmetric,
+                                            false,
+                                            rocblas_double_complex>[]
+        = "rocblas_zsyr_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::hermitian,
+                                            false,
+                                            rocblas_float_complex>[]
+        = "rocblas_cher_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::hermitian,
+                                            false,
+                                            rocblas_double_complex>[]
+        = "rocblas_zher_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::symmetric, true, float>[]
+        = "rocblas_ssyr2_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::symmetric, true, double>[]
+        = "rocblas_dsyr2_deferred";
+    template <>
+    constexpr char
+        rocblas_rank_update_name<rocblas_rank_update_kind::symmetric, true, rocblas_float_complex>[]
+        = "rocblas_csyr2_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::symmetric,
+                                            true,
+                                            rocblas_double_complex>[]
+        = "rocblas_zsyr2_deferred";
+    template <>
+    constexpr char
+        rocblas_rank_update_name<rocblas_rank_update_kind::hermitian, true, rocblas_float_complex>[]
+        = "rocblas_cher2_deferred";
+    template <>
+    constexpr char rocblas_rank_update_name<rocblas_rank_update_kind::hermitian,
+                                            true,
+                                            rocblas_double_complex>[]
+        = "rocblas_zher2_deferred";
+
+    rocblas_status rocblas_rank_update_flush_impl(rocblas_handle handle, rocblas_rank_update update)
+    {
+        switch(update->type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_rank_update_flush_template<float>(handle, update);
+        case rocblas_datatype_f64_r:
+            return rocblas_rank_update_flush_template<double>(handle, update);
+        case rocblas_datatype_f32_c:
+            return rocblas_rank_update_flush_template<rocblas_float_complex>(handle, update);
+        case rocblas_datatype_f64_c:
+            return rocblas_rank_update_flush_template<rocblas_double_complex>(handle, update);
+        default:
+            return rocblas_status_internal_error;
+        }
+    }
+
+    /*
+     * Appends alpha * x and y (ger, geru and gerc), alpha * x and x (syr and her), or
+     * alpha * x, alpha * y (conj(alpha) * y for her2) and y, x (syr2 and her2) to the panels.
+     * For syr, her, syr2 and her2, m == n and y is unused by the rank-1 updates.
+     */
+    template <rocblas_rank_update_kind KIND, bool RANK2, typename T, typename U>
+    rocblas_status rocblas_rank_update_impl(rocblas_handle      handle,
+                                            rocblas_rank_update update,
+                                            rocblas_fill        uplo,
+                                            rocblas_int         m,
+                                            rocblas_int         n,
+                                            const U*            alpha,
+                                            const T*            x,
+                                            rocblas_int         incx,
+                                            const T*            y,
+                                            rocblas_int         incy,
+                                            T*                  A,
+                                            rocblas_int         lda)
+    {
+        static constexpr bool GENERAL = KIND == rocblas_rank_update_kind::general
+                                        || KIND == rocblas_rank_update_kind::general_conj;
+        static constexpr bool HAS_Y = GENERAL || RANK2;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+        {
+            if(GENERAL)
+                log_trace(handle,
+                          rocblas_rank_update_name<KIND, RANK2, T>,
+                          update,
+                          m,
+                          n,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          x,
+                          incx,
+                          y,
+                          incy,
+                          A,
+                          lda);
+            else if(RANK2)
+                log_trace(handle,
+                          rocblas_rank_update_name<KIND, RANK2, T>,
+                          update,
+                          uplo,
+                          n,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          x,
+                          incx,
+                          y,
+                          incy,
+                          A,
+                          lda);
+            else
+                log_trace(handle,
+                          rocblas_rank_update_name<KIND, RANK2, T>,
+                          update,
+                          uplo,
+                          n,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          x,
+                          incx,
+                          A,
+                          lda);
+        }
+
+        if(!GENERAL && uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+
+        if(m < 0 || n < 0 || !incx || (HAS_Y && !incy) || lda < m || lda < 1)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!update || !alpha || !x || (HAS_Y && !y) || !A)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && !*alpha)
+            return rocblas_status_success;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status check_numerics_status
+                = rocblas_internal_check_numerics_vector_template(
+                    rocblas_rank_update_name<KIND, RANK2, T>,
+                    handle,
+                    m,
+                    x,
+                    0,
+                    incx,
+                    0,
+                    1,
+                    check_numerics,
+                    is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+
+            if(HAS_Y)
+            {
+                check_numerics_status = rocblas_internal_check_numerics_vector_template(
+                    rocblas_rank_update_name<KIND, RANK2, T>,
+                    handle,
+                    n,
+                    y,
+                    0,
+                    incy,
+                    0,
+                    1,
+                    check_numerics,
+                    is_input);
+                if(check_numerics_status != rocblas_status_success)
+                    return check_numerics_status;
+            }
+        }
+
+        static constexpr rocblas_int rank = RANK2 ? 2 : 1;
+        static constexpr auto        type = rocblas_datatype_from_type<T>;
+
+        // the pending updates of another target are applied first
+        bool same_target = update->k && update->kind == KIND && update->type == type
+                           && update->uplo == uplo && update->m == m && update->n == n
+                           && update->lda == lda && update->A == A;
+        if(!same_target || update->k + rank > update->k_max)
+            RETURN_IF_ROCBLAS_ERROR(rocblas_rank_update_flush_impl(handle, update));
+
+        // grow the panels, hipFree waits for the flushes which may still read them
+        size_t panel_bytes = sizeof(T) * std::max(m, n) * update->k_max;
+        if(panel_bytes > update->panel_bytes)
+        {
+            (hipFree)(update->X);
+            (hipFree)(update->Y);
+            update->X           = nullptr;
+            update->Y           = nullptr;
+            update->panel_bytes = 0;
+            if((hipMalloc)(&update->X, panel_bytes) != hipSuccess
+               || (hipMalloc)(&update->Y, panel_bytes) != hipSuccess)
+                return rocblas_status_memory_error;
+            update->panel_bytes = panel_bytes;
+        }
+
+        update->kind = KIND;
+        update->type = type;
+        update->uplo = uplo;
+        update->m    = m;
+        update->n    = n;
+        update->lda  = lda;
+        update->A    = A;
+
+        T* X = (T*)update->X + size_t(m) * update->k;
+        T* Y = (T*)update->Y + size_t(n) * update->k;
+
+        static constexpr bool CONJ_Y = KIND == rocblas_rank_update_kind::hermitian;
+        RETURN_IF_ROCBLAS_ERROR(
+            (rocblas_rank_update_append_column<false>)(handle, m, alpha, x, incx, X));
+        if(RANK2)
+            RETURN_IF_ROCBLAS_ERROR(
+                (rocblas_rank_update_append_column<CONJ_Y>)(handle, n, alpha, y, incy, X + m));
+
+        {
+            static const T one = T(1);
+
+            auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+            RETURN_IF_ROCBLAS_ERROR((rocblas_rank_update_append_column<false>)(
+                handle, n, &one, HAS_Y ? y : x, HAS_Y ? incy : incx, Y));
+            if(RANK2)
+                RETURN_IF_ROCBLAS_ERROR(
+                    (rocblas_rank_update_append_column<false>)(handle, m, &one, x, incx, Y + n));
+        }
+
+        update->k += rank;
+
+        if(update->k == update->k_max)
+            return rocblas_rank_update_flush_template<T>(handle, update);
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_create_rank_update(rocblas_rank_update* update, rocblas_int k)
+try
+{
+    if(!update)
+        return rocblas_status_invalid_pointer;
+
+    if(k < 2)
+        return rocblas_status_invalid_size;
+
+    *update = new _rocblas_rank_update(k);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_destroy_rank_update(rocblas_rank_update update)
+try
+{
+    delete update;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_rank_update_flush(rocblas_handle handle, rocblas_rank_update update)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_rank_update_flush", update);
+
+    if(!update)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_rank_update_flush_impl(handle, update);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, KIND_, T_)                                                 \
+    rocblas_status routine_name_(rocblas_handle      handle,                           \
+                                 rocblas_rank_update update,                           \
+                                 rocblas_int         m,                                \
+                                 rocblas_int         n,                                \
+                                 const T_*           alpha,                            \
+                                 const T_*           x,                                \
+                                 rocblas_int         incx,                             \
+                                 const T_*           y,                                \
+                                 rocblas_int         incy,                             \
+                                 T_*                 A,                                \
+                                 rocblas_int         lda)                              \
+    try                                                                                \
+    {                                                                                  \
+        return rocblas_rank_update_impl<rocblas_rank_update_kind::KIND_, false>(       \
+            handle, update, rocblas_fill_full, m, n, alpha, x, incx, y, incy, A, lda); \
+    }                                                                                  \
+    catch(...)                                                                         \
+    {                                                                                  \
+        return exception_to_rocblas_status();                                          \
+    }
+
+IMPL(rocblas_sger_deferred, general, float);
+IMPL(rocblas_dger_deferred, general, double);
+IMPL(rocblas_cgeru_deferred, general, rocblas_float_complex);
+IMPL(rocblas_zgeru_deferred, general, rocblas_double_complex);
+IMPL(rocblas_cgerc_deferred, general_conj, rocblas_float_complex);
+IMPL(rocblas_zgerc_deferred, general_conj, rocblas_double_complex);
+
+#undef IMPL
+
+#define IMPL(routine_name_, KIND_, T_, U_)                                              \
+    rocblas_status routine_name_(rocblas_handle      handle,                            \
+                                 rocblas_rank_update update,                            \
+                                 rocblas_fill        uplo,                              \
+                                 rocblas_int         n,                                 \
+                                 const U_*           alpha,                             \
+                                 const T_*           x,                                 \
+                                 rocblas_int         incx,                              \
+                                 T_*                 A,                                 \
+                                 rocblas_int         lda)                               \
+    try                                                                                 \
+    {                                                                                   \
+        return rocblas_rank_update_impl<rocblas_rank_update_kind::KIND_, false>(        \
+            handle, update, uplo, n, n, alpha, x, incx, (const T_*)nullptr, 0, A, lda); \
+    }                                                                                   \
+    catch(...)                                                                          \
+    {                                                                                   \
+        return exception_to_rocblas_status();                                           \
+    }
+
+IMPL(rocblas_ssyr_deferred, symmetric, float, float);
+IMPL(rocblas_dsyr_deferred, symmetric, double, double);
+IMPL(rocblas_csyr_deferred, symmetric, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zsyr_deferred, symmetric, rocblas_double_complex, rocblas_double_complex);
+IMPL(rocblas_cher_deferred, hermitian, rocblas_float_complex, float);
+IMPL(rocblas_zher_deferred, hermitian, rocblas_double_complex, double);
+
+#undef IMPL
+
+#define IMPL(routine_name_, KIND_, T_)                                          \
+    rocblas_status routine_name_(rocblas_handle      handle,                    \
+                                 rocblas_rank_update update,                    \
+                                 rocblas_fill        uplo,                      \
+                                 rocblas_int         n,                         \
+                                 const T_*           alpha,                     \
+                                 const T_*           x,                         \
+                                 rocblas_int         incx,                      \
+                                 const T_*           y,                         \
+                                 rocblas_int         incy,                      \
+                                 T_*                 A,                         \
+                                 rocblas_int         lda)                       \
+    try                                                                         \
+    {                                                                           \
+        return rocblas_rank_update_impl<rocblas_rank_update_kind::KIND_, true>( \
+            handle, update, uplo, n, n, alpha, x, incx, y, incy, A, lda);       \
+    }                                                                           \
+    catch(...)                                                                  \
+    {                                                                           \
+        return exception_to_rocblas_status();                                   \
+    }
+
+IMPL(rocblas_ssyr2_deferred, symmetric, float);
+IMPL(rocblas_dsyr2_deferred, symmetric, double);
+IMPL(rocblas_csyr2_deferred, symmetric, rocblas_float_complex);
+IMPL(rocblas_zsyr2_deferred, symmetric, rocblas_double_complex);
+IMPL(rocblas_cher2_deferred, hermitian, rocblas_float_complex);
+IMPL(rocblas_zher2_deferred, hermitian, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,236 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "../blas3/Tensile/gemm.hpp"
+#include "../blas3/rocblas_her2k.hpp"
+#include "../blas3/rocblas_syrkx.hpp"
+#include "check_numerics_matrix.hpp"
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+
+// Kinds of the updates buffered by a rocblas_rank_update, each flushed by a different level 3
+// function
+enum class rocblas_rank_update_kind
+{
+    general, // ger and geru, A += X * Y**T with gemm
+    general_conj, // gerc, A += X * Y**H with gemm
+    symmetric, // syr and syr2, the triangle of A += X * Y**T with syrkx
+    hermitian, // her and her2, the triangle of A += X * Y**H with herkx
+};
+
+/*! \brief rocblas_rank_update
+
+    \details
+    Deferred rank-1 and rank-2 updates of a matrix A. Every update appends its scaled vectors as
+    columns of the m by k_max panel X and the n by k_max panel Y, and the k pending columns are
+    applied as a single rank-k update of A when the panels are full, when an update targets a
+    different matrix or kind, or on rocblas_rank_update_flush. alpha is folded into X, so the
+    flush is always A += 1 * X * op(Y) with beta = 1.
+    ********************************************************************/
+struct _rocblas_rank_update
+{
+    rocblas_int k_max;
+    rocblas_int k = 0; // number of pending columns of the panels
+
+    // target of the pending updates
+    rocblas_rank_update_kind kind = rocblas_rank_update_kind::general;
+    rocblas_datatype         type = rocblas_datatype_f32_r;
+    rocblas_fill             uplo = rocblas_fill_full;
+    rocblas_int              m = 0, n = 0, lda = 0;
+    void*                    A = nullptr;
+
+    // panels in device memory, reallocated when a target needs more than panel_bytes each
+    void*  X           = nullptr;
+    void*  Y           = nullptr;
+    size_t panel_bytes = 0;
+
+    explicit _rocblas_rank_update(rocblas_int k_max)
+        : k_max(k_max)
+    {
+    }
+
+    // hipFree waits for the flushes which may still read the panels
+    ~_rocblas_rank_update()
+    {
+        (hipFree)(X);
+        (hipFree)(Y);
+    }
+
+    _rocblas_rank_update(const _rocblas_rank_update&) = delete;
+    _rocblas_rank_update& operator=(const _rocblas_rank_update&) = delete;
+};
+
+// Copies column = alpha * x, or conj(alpha) * x
+template <rocblas_int NB, bool CONJ, typename T, typename U>
+ROCBLAS_KERNEL __launch_bounds__(NB) void rank_update_append_kernel(rocblas_int n,
+                                                                     U           alpha_device_host,
+                                                                     const T* __restrict__ x,
+                                                                     rocblas_int incx,
+                                                                     T* __restrict__ column)
+{
+    auto      alpha = load_scalar(alpha_device_host);
+    ptrdiff_t tid   = hipBlockIdx_x * ptrdiff_t(NB) + hipThreadIdx_x;
+
+    if(tid < n)
+        column[tid] = (CONJ ? conj(alpha) : alpha) * x[tid * incx];
+}
+
+template <bool CONJ, typename T, typename U>
+rocblas_status rocblas_rank_update_append_column(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 const U*       alpha,
+                                                 const T*       x,
+                                                 rocblas_int    incx,
+                                                 T*             column)
+{
+    static constexpr rocblas_int NB = 256;
+
+    hipStream_t rocblas_stream = handle->get_stream();
+    dim3        grid((n - 1) / NB + 1);
+    dim3        threads(NB);
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    if(incx < 0)
+        x -= ptrdiff_t(incx) * (n - 1);
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((rank_update_append_kernel<NB, CONJ>),
+                           grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           n,
+                           alpha,
+                           x,
+                           incx,
+                           column);
+    else
+        hipLaunchKernelGGL((rank_update_append_kernel<NB, CONJ>),
+                           grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           n,
+                           *alpha,
+                           x,
+                           incx,
+                           column);
+
+    return rocblas_status_success;
+}
+
+/*! \brief rocblas_rank_update_flush_template
+    Applies the k pending columns of the panels of update to its matrix A, of element type T.
+    ********************************************************************/
+template <typename T>
+rocblas_status rocblas_rank_update_flush_template(rocblas_handle       handle,
+                                                  _rocblas_rank_update* update)
+{
+    if(!update->k)
+        return rocblas_status_success;
+
+    static constexpr rocblas_int MIN_NB = std::is_same<T, float>{} ? 16 : 32;
+    static const T               one    = T(1);
+
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    rocblas_int    m      = update->m;
+    rocblas_int    n      = update->n;
+    rocblas_int    k      = update->k;
+    const T*       X      = (const T*)update->X;
+    const T*       Y      = (const T*)update->Y;
+    T*             A      = (T*)update->A;
+    rocblas_status status = rocblas_status_success;
+
+    switch(update->kind)
+    {
+    case rocblas_rank_update_kind::general:
+    case rocblas_rank_update_kind::general_conj:
+        status = rocblas_internal_gemm_template<false>(
+            handle,
+            rocblas_operation_none,
+            update->kind == rocblas_rank_update_kind::general
+                ? rocblas_operation_transpose
+                : rocblas_operation_conjugate_transpose,
+            m,
+            n,
+            k,
+            &one,
+            X,
+            0,
+            m,
+            0,
+            Y,
+            0,
+            n,
+            0,
+            &one,
+            A,
+            0,
+            update->lda,
+            0,
+            1);
+        break;
+
+    case rocblas_rank_update_kind::symmetric:
+        status = rocblas_internal_syrkx_template<MIN_NB, false, T>(handle,
+                                                                   update->uplo,
+                                                                   rocblas_operation_none,
+                                                                   n,
+                                                                   k,
+                                                                   &one,
+                                                                   X,
+                                                                   0,
+                                                                   n,
+                                                                   0,
+                                                                   Y,
+                                                                   0,
+                                                                   n,
+                                                                   0,
+                                                                   &one,
+                                                                   A,
+                                                                   0,
+                                                                   update->lda,
+                                                                   0,
+                                                                   1);
+        break;
+
+    case rocblas_rank_update_kind::hermitian:
+        if constexpr(is_complex<T>)
+        {
+            static const real_t<T> real_one = 1;
+
+            static constexpr bool TWOK = false; // herkx
+            status = rocblas_internal_her2k_template<TWOK>(handle,
+                                                           update->uplo,
+                                                           rocblas_operation_none,
+                                                           n,
+                                                           k,
+                                                           &one,
+                                                           X,
+                                                           0,
+                                                           n,
+                                                           0,
+                                                           Y,
+                                                           0,
+                                                           n,
+                                                           0,
+                                                           &real_one,
+                                                           A,
+                                                           0,
+                                                           update->lda,
+                                                           0,
+                                                           1);
+        }
+        else
+            status = rocblas_status_internal_error;
+        break;
+    }
+
+    if(status == rocblas_status_success)
+        update->k = 0;
+    return status;
+}
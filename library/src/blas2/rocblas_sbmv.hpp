@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "band_device.hpp"
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 
@@ -229,6 +230,42 @@ rocblas_status rocblas_sbmv_template(rocblas_handle handle,
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - ptrdiff_t(incy) * (n - 1) : offsety;
 
+    // wide bands reuse x and read A coalesced through LDS tiles, the stored triangle is summed
+    // as a band of A and the strict triangle once more as a band of A**T
+    if(rocblas_band_use_tiled(0, k))
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_host && batch_count == 1 && !*alpha
+           && *beta == 1)
+            return rocblas_status_success;
+
+        rocblas_int kl = uplo == rocblas_fill_upper ? 0 : k;
+        rocblas_int ku = uplo == rocblas_fill_upper ? k : 0;
+
+        return rocblas_band_tiled_launcher<true, true, false>(handle,
+                                                               n,
+                                                               n,
+                                                               kl,
+                                                               ku,
+                                                               rocblas_band_diag::stored,
+                                                               alpha,
+                                                               stride_alpha,
+                                                               A,
+                                                               offseta,
+                                                               lda,
+                                                               strideA,
+                                                               x,
+                                                               shiftx,
+                                                               incx,
+                                                               stridex,
+                                                               beta,
+                                                               stride_beta,
+                                                               y,
+                                                               shifty,
+                                                               incy,
+                                                               stridey,
+                                                               batch_count);
+    }
+
     static constexpr int sbmv_DIM_X = 64;
     static constexpr int sbmv_DIM_Y = 16;
     rocblas_int          blocks     = (n - 1) / (sbmv_DIM_X) + 1;
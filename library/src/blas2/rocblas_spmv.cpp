@@ -4,6 +4,8 @@
 
 #include "rocblas_spmv.hpp"
 #include "logging.hpp"
+#include "rocblas_packed.hpp"
+#include "rocblas_symv.hpp"
 #include "utility.hpp"
 
 namespace
@@ -29,7 +31,22 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // in the unpack mode, A is unpacked into device memory for symv, unless the handle's
+        // packed unpack cache holds its unpacked copy
+        bool     unpack     = handle->packed_mode == rocblas_packed_unpack && n > 0;
+        auto     unpack_key = rocblas_packed_unpack_key(handle, A, n, uplo);
+        const T* cached_A
+            = unpack ? rocblas_packed_unpack_cache_find<T>(handle, unpack_key) : nullptr;
+        size_t full_bytes
+            = unpack && !cached_A ? rocblas_packed_unpack_workspace_size<T>(n, 1) : 0;
+        size_t symv_bytes = unpack ? rocblas_internal_hemv_symv_kernel_workspace_size<T>(n) : 0;
+        if(handle->is_device_memory_size_query())
+        {
+            if(!unpack)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(full_bytes, symv_bytes);
+        }
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
@@ -85,6 +102,11 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+        // without the device memory of the unpack mode, A is indexed directly
+        auto w_mem = handle->device_malloc(full_bytes, symv_bytes);
+        if(!w_mem)
+            unpack = false;
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -110,8 +132,44 @@ namespace
                 return spmv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_spmv_template<T>(
-            handle, uplo, n, alpha, 0, A, 0, 0, x, 0, incx, 0, beta, 0, y, 0, incy, 0, 1);
+        // A is not read when alpha is zero
+        rocblas_status status;
+        if(unpack && (handle->pointer_mode == rocblas_pointer_mode_device || *alpha))
+        {
+            const T* A_full = cached_A;
+            if(!A_full)
+            {
+                RETURN_IF_ROCBLAS_ERROR(rocblas_internal_unpack_template(
+                    handle, uplo, n, 1, A, 0, 0, (T*)w_mem[0], 0, n, 0, 1));
+                A_full = (const T*)w_mem[0];
+                handle->packed_unpack_cache.insert(
+                    unpack_key, A_full, full_bytes, handle->get_stream());
+            }
+            status = rocblas_internal_symv_template<T>(handle,
+                                                       uplo,
+                                                       n,
+                                                       alpha,
+                                                       0,
+                                                       A_full,
+                                                       0,
+                                                       n,
+                                                       0,
+                                                       x,
+                                                       0,
+                                                       incx,
+                                                       0,
+                                                       beta,
+                                                       0,
+                                                       y,
+                                                       0,
+                                                       incy,
+                                                       0,
+                                                       1,
+                                                       (T*)w_mem[1]);
+        }
+        else
+            status = rocblas_spmv_template<T>(
+                handle, uplo, n, alpha, 0, A, 0, 0, x, 0, incx, 0, beta, 0, y, 0, incy, 0, 1);
         if(status != rocblas_status_success)
             return status;
 
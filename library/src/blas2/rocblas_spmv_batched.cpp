@@ -2,7 +2,9 @@
  * Copyright 2016-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 #include "logging.hpp"
+#include "rocblas_packed.hpp"
 #include "rocblas_spmv.hpp"
+#include "rocblas_symv.hpp"
 #include "utility.hpp"
 
 namespace
@@ -29,7 +31,20 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // in the unpack mode, A is unpacked into device memory for symv
+        bool unpack = handle->packed_mode == rocblas_packed_unpack && n > 0 && batch_count > 0;
+
+        size_t full_bytes = unpack ? rocblas_packed_unpack_workspace_size<T>(n, batch_count) : 0;
+        size_t arr_bytes  = unpack ? sizeof(T*) * batch_count : 0;
+        size_t symv_bytes
+            = unpack ? rocblas_internal_hemv_symv_kernel_workspace_size<T>(n, batch_count) : 0;
+        if(handle->is_device_memory_size_query())
+        {
+            if(!unpack)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(full_bytes, arr_bytes, symv_bytes);
+        }
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
@@ -90,6 +105,11 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+        // without the device memory of the unpack mode, the packed matrices are indexed directly
+        auto w_mem = handle->device_malloc(full_bytes, arr_bytes, symv_bytes);
+        if(!w_mem)
+            unpack = false;
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -115,8 +135,59 @@ namespace
                 return spmv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_spmv_template<T>(
-            handle, uplo, n, alpha, 0, A, 0, 0, x, 0, incx, 0, beta, 0, y, 0, incy, 0, batch_count);
+        // A is not read when alpha is zero
+        rocblas_status status;
+        if(unpack && (handle->pointer_mode == rocblas_pointer_mode_device || *alpha))
+        {
+            // symv reads A and x through arrays of pointers of the same type
+            rocblas_stride stride_full = rocblas_stride(n) * n;
+            RETURN_IF_ROCBLAS_ERROR(rocblas_internal_unpack_template(
+                handle, uplo, n, 1, A, 0, 0, (T*)w_mem[0], 0, n, stride_full, batch_count));
+            setup_batched_array<1>(
+                handle->get_stream(), (T*)w_mem[0], stride_full, (T**)w_mem[1], batch_count);
+            const U* A_full = (const U*)w_mem[1];
+            status = rocblas_internal_symv_template<T>(handle,
+                                                       uplo,
+                                                       n,
+                                                       alpha,
+                                                       0,
+                                                       A_full,
+                                                       0,
+                                                       n,
+                                                       0,
+                                                       x,
+                                                       0,
+                                                       incx,
+                                                       0,
+                                                       beta,
+                                                       0,
+                                                       y,
+                                                       0,
+                                                       incy,
+                                                       0,
+                                                       batch_count,
+                                                       (T*)w_mem[2]);
+        }
+        else
+            status = rocblas_spmv_template<T>(handle,
+                                              uplo,
+                                              n,
+                                              alpha,
+                                              0,
+                                              A,
+                                              0,
+                                              0,
+                                              x,
+                                              0,
+                                              incx,
+                                              0,
+                                              beta,
+                                              0,
+                                              y,
+                                              0,
+                                              incy,
+                                              0,
+                                              batch_count);
         if(status != rocblas_status_success)
             return status;
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../blas1/rocblas_copy.hpp"
+#include "band_device.hpp"
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 
@@ -255,6 +256,44 @@ ROCBLAS_KERNEL void tbmvx_kernel(rocblas_operation transA,
     tbmvx_kernel_calc<DIM_X, DIM_Y>(transA, upper, diag, m, k, A, lda, w_x_copy, x, incx);
 }
 
+/**
+  *  x := op(A) * w_x_copy with the band-tiled product of band_device.hpp, for wide bands.
+  *  A is a triangular band with kl sub-diagonals and ku super-diagonals, one of them 0.
+  */
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int B_TILE,
+          bool        N_PART,
+          bool        CONJ,
+          typename U,
+          typename V>
+ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void
+    tbmv_tiled_kernel(rocblas_int       m,
+                      rocblas_int       kl,
+                      rocblas_int       ku,
+                      rocblas_band_diag diag,
+                      U                 Aa,
+                      ptrdiff_t         shifta,
+                      rocblas_int       lda,
+                      rocblas_stride    strideA,
+                      U                 w_xa_copy,
+                      V                 xa,
+                      ptrdiff_t         shiftx,
+                      rocblas_int       incx,
+                      rocblas_stride    stridex)
+{
+    const auto* A        = load_ptr_batch(Aa, hipBlockIdx_y, shifta, strideA);
+    const auto* w_x_copy = load_ptr_batch(w_xa_copy, hipBlockIdx_y, 0, m);
+    auto*       x        = load_ptr_batch(xa, hipBlockIdx_y, shiftx, stridex);
+
+    auto res = band_tiled_kernel_calc<DIM_X, DIM_Y, B_TILE, N_PART, !N_PART, CONJ>(
+        m, m, kl, ku, diag, A, lda, w_x_copy, 1);
+
+    rocblas_int ind = hipBlockIdx_x * DIM_X + hipThreadIdx_x;
+    if(hipThreadIdx_y == 0 && ind < m)
+        x[ind * ptrdiff_t(incx)] = res;
+}
+
 /**
   *  First, makes a copy of 'x', then uses a modified gemv algorithm
   *  to perform x := transA(A) * w_x_copy
@@ -299,6 +338,38 @@ rocblas_status rocblas_tbmv_template(rocblas_handle    handle,
     // in case of negative inc shift pointer to end of data for negative indexing tid*inc
     ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (m - 1) : offsetx;
 
+    // wide bands reuse x and read A coalesced through LDS tiles
+    if(rocblas_band_use_tiled(0, k))
+    {
+        static constexpr rocblas_int DIM_X  = ROCBLAS_BAND_TILED_DIM_X;
+        static constexpr rocblas_int DIM_Y  = ROCBLAS_BAND_TILED_DIM_Y;
+        static constexpr rocblas_int B_TILE = ROCBLAS_BAND_TILED_B_TILE;
+
+        dim3              grid((m - 1) / DIM_X + 1, batch_count);
+        dim3              threads(DIM_X, DIM_Y);
+        rocblas_int       kl = uplo == rocblas_fill_upper ? 0 : k;
+        rocblas_int       ku = uplo == rocblas_fill_upper ? k : 0;
+        rocblas_band_diag band_diag
+            = diag == rocblas_diagonal_unit ? rocblas_band_diag::unit : rocblas_band_diag::stored;
+
+#define tbmv_tiled_KARGS                                                                    \
+    grid, threads, 0, handle->get_stream(), m, kl, ku, band_diag, A, offseta, lda, strideA, \
+        (U)w_x_copy, x, shiftx, incx, stridex
+
+        if(transA == rocblas_operation_none)
+            hipLaunchKernelGGL((tbmv_tiled_kernel<DIM_X, DIM_Y, B_TILE, true, false>),
+                               tbmv_tiled_KARGS);
+        else if(transA == rocblas_operation_transpose)
+            hipLaunchKernelGGL((tbmv_tiled_kernel<DIM_X, DIM_Y, B_TILE, false, false>),
+                               tbmv_tiled_KARGS);
+        else
+            hipLaunchKernelGGL((tbmv_tiled_kernel<DIM_X, DIM_Y, B_TILE, false, true>),
+                               tbmv_tiled_KARGS);
+#undef tbmv_tiled_KARGS
+
+        return rocblas_status_success;
+    }
+
     // (gemv) TBMVX_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
     static constexpr int TBMVX_DIM_X = 64;
     static constexpr int TBMVX_DIM_Y = 16;
@@ -0,0 +1,15 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "tiny_batched_device.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+rocblas_int rocblas_tiny_batched_min_batch_count()
+{
+    static const rocblas_int min_batch_count = [] {
+        const char* env = read_env("ROCBLAS_TINY_BATCHED_MIN_BATCH_COUNT");
+        return env && *env ? std::max(atoi(env), 0) : 1024;
+    }();
+    return min_batch_count;
+}
@@ -5,6 +5,8 @@
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
+#include "rocblas_packed.hpp"
+#include "rocblas_trmv.hpp"
 #include "utility.hpp"
 
 namespace
@@ -101,14 +103,28 @@ namespace
             return rocblas_status_success;
         }
 
+        // in the unpack mode, A is also unpacked into device memory for trmv, unless the handle's
+        // packed unpack cache holds its unpacked copy
+        bool     unpack     = handle->packed_mode == rocblas_packed_unpack;
+        auto     unpack_key = rocblas_packed_unpack_key(handle, A, m, uplo);
+        const T* cached_A
+            = unpack ? rocblas_packed_unpack_cache_find<T>(handle, unpack_key) : nullptr;
         size_t dev_bytes = m * sizeof(T);
+        size_t full_bytes
+            = unpack && !cached_A ? rocblas_packed_unpack_workspace_size<T>(m, 1) : 0;
         if(handle->is_device_memory_size_query())
-            return handle->set_optimal_device_memory_size(dev_bytes);
+            return handle->set_optimal_device_memory_size(dev_bytes, full_bytes);
 
         if(!A || !x)
             return rocblas_status_invalid_pointer;
 
-        auto w_mem = handle->device_malloc(dev_bytes);
+        // without the device memory of the unpack mode, A is indexed directly
+        auto w_mem = handle->device_malloc(dev_bytes, full_bytes);
+        if(!w_mem && full_bytes)
+        {
+            unpack = false;
+            w_mem  = handle->device_malloc(dev_bytes);
+        }
         if(!w_mem)
             return rocblas_status_memory_error;
 
@@ -134,8 +150,37 @@ namespace
                 return tpmv_check_numerics_status;
         }
 
-        rocblas_status status
-            = rocblas_tpmv_template(handle, uplo, transA, diag, m, A, x, incx, (T*)w_mem);
+        rocblas_status status;
+        if(unpack)
+        {
+            const T* A_full = cached_A;
+            if(!A_full)
+            {
+                RETURN_IF_ROCBLAS_ERROR(rocblas_internal_unpack_template(
+                    handle, uplo, m, 1, A, 0, 0, (T*)w_mem[1], 0, m, 0, 1));
+                A_full = (const T*)w_mem[1];
+                handle->packed_unpack_cache.insert(
+                    unpack_key, A_full, full_bytes, handle->get_stream());
+            }
+            status = rocblas_internal_trmv_template(handle,
+                                                    uplo,
+                                                    transA,
+                                                    diag,
+                                                    m,
+                                                    A_full,
+                                                    0,
+                                                    m,
+                                                    0,
+                                                    x,
+                                                    0,
+                                                    incx,
+                                                    0,
+                                                    (T*)w_mem[0],
+                                                    0,
+                                                    1);
+        }
+        else
+            status = rocblas_tpmv_template(handle, uplo, transA, diag, m, A, x, incx, (T*)w_mem[0]);
         if(status != rocblas_status_success)
             return status;
 
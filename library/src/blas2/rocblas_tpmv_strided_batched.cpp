@@ -5,6 +5,8 @@
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
+#include "rocblas_packed.hpp"
+#include "rocblas_trmv.hpp"
 #include "utility.hpp"
 
 namespace
@@ -130,14 +132,23 @@ namespace
             return rocblas_status_success;
         }
 
-        size_t dev_bytes = m * batch_count * sizeof(T);
+        // in the unpack mode, A is also unpacked into device memory for trmv
+        bool   unpack     = handle->packed_mode == rocblas_packed_unpack;
+        size_t dev_bytes  = m * batch_count * sizeof(T);
+        size_t full_bytes = unpack ? rocblas_packed_unpack_workspace_size<T>(m, batch_count) : 0;
         if(handle->is_device_memory_size_query())
-            return handle->set_optimal_device_memory_size(dev_bytes);
+            return handle->set_optimal_device_memory_size(dev_bytes, full_bytes);
 
         if(!a || !x)
             return rocblas_status_invalid_pointer;
 
-        auto w_mem = handle->device_malloc(dev_bytes);
+        // without the device memory of the unpack mode, the packed matrices are indexed directly
+        auto w_mem = handle->device_malloc(dev_bytes, full_bytes);
+        if(!w_mem && full_bytes)
+        {
+            unpack = false;
+            w_mem  = handle->device_malloc(dev_bytes);
+        }
         if(!w_mem)
             return rocblas_status_memory_error;
 
@@ -163,19 +174,45 @@ namespace
         }
 
         rocblas_stride stridew = m;
-        rocblas_status status  = rocblas_tpmv_strided_batched_template(handle,
-                                                                      uplo,
-                                                                      transa,
-                                                                      diag,
-                                                                      m,
-                                                                      a,
-                                                                      stridea,
-                                                                      x,
-                                                                      incx,
-                                                                      stridex,
-                                                                      (T*)w_mem,
-                                                                      stridew,
-                                                                      batch_count);
+
+        rocblas_status status;
+        if(unpack)
+        {
+            rocblas_stride stride_full = rocblas_stride(m) * m;
+            const T*       A_full      = (const T*)w_mem[1];
+            RETURN_IF_ROCBLAS_ERROR(rocblas_internal_unpack_template(
+                handle, uplo, m, 1, a, 0, stridea, (T*)w_mem[1], 0, m, stride_full, batch_count));
+            status = rocblas_internal_trmv_template(handle,
+                                                    uplo,
+                                                    transa,
+                                                    diag,
+                                                    m,
+                                                    A_full,
+                                                    0,
+                                                    m,
+                                                    stride_full,
+                                                    x,
+                                                    0,
+                                                    incx,
+                                                    stridex,
+                                                    (T*)w_mem[0],
+                                                    stridew,
+                                                    batch_count);
+        }
+        else
+            status = rocblas_tpmv_strided_batched_template(handle,
+                                                           uplo,
+                                                           transa,
+                                                           diag,
+                                                           m,
+                                                           a,
+                                                           stridea,
+                                                           x,
+                                                           incx,
+                                                           stridex,
+                                                           (T*)w_mem[0],
+                                                           stridew,
+                                                           batch_count);
         if(status != rocblas_status_success)
             return status;
 
@@ -285,6 +285,13 @@ rocblas_status rocblas_tpsv_template(rocblas_handle    handle,
     return rocblas_status_success;
 }
 
+// Block size of the trsv substitution run by tpsv in the rocblas_packed_unpack mode, as in trsv
+template <typename T>
+constexpr rocblas_int rocblas_tpsv_unpack_dim_x()
+{
+    return std::is_same<T, rocblas_double_complex>{} ? 32 : 64;
+}
+
 //TODO :-Add rocblas_check_numerics_tp_matrix_template for checking Matrix `AP` which is a Triangular Packed Matrix
 template <typename T, typename U>
 rocblas_status rocblas_tpsv_check_numerics(const char*    function_name,
@@ -5,7 +5,9 @@
 #include "logging.hpp"
 #include "rocblas.h"
 #include "rocblas_gemv.hpp"
+#include "rocblas_packed.hpp"
 #include "rocblas_tpsv.hpp"
+#include "rocblas_trsv_substitution.hpp"
 #include "utility.hpp"
 
 namespace
@@ -42,6 +44,19 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // in the unpack mode, AP is unpacked into device memory for the trsv substitution, which
+        // keeps track of its completed sections in device memory
+        bool unpack = handle->packed_mode == rocblas_packed_unpack && n > 0 && batch_count > 0;
+
+        size_t full_bytes = unpack ? rocblas_packed_unpack_workspace_size<T>(n, batch_count) : 0;
+        size_t sec_bytes  = unpack ? sizeof(rocblas_int) * batch_count : 0;
+        if(handle->is_device_memory_size_query())
+        {
+            if(!unpack)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(full_bytes, sec_bytes);
+        }
+
         auto layer_mode = handle->layer_mode;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
@@ -117,6 +132,11 @@ namespace
         if(!AP || !x)
             return rocblas_status_invalid_pointer;
 
+        // without the device memory of the unpack mode, the packed matrices are indexed directly
+        auto w_mem = handle->device_malloc(full_bytes, sec_bytes);
+        if(!w_mem)
+            unpack = false;
+
         auto check_numerics = handle->check_numerics;
         if(check_numerics)
         {
@@ -139,8 +159,33 @@ namespace
                 return tpsv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_tpsv_template<BLOCK>(
-            handle, uplo, transA, diag, n, AP, 0, stride_A, x, 0, incx, stride_x, batch_count);
+        rocblas_status status;
+        if(unpack)
+        {
+            static constexpr rocblas_int DIM_X = rocblas_tpsv_unpack_dim_x<T>();
+            rocblas_stride stride_full = rocblas_stride(n) * n;
+            const T*       A_full      = (const T*)w_mem[0];
+            RETURN_IF_ROCBLAS_ERROR(rocblas_internal_unpack_template(
+                handle, uplo, n, 1, AP, 0, stride_A, (T*)w_mem[0], 0, n, stride_full, batch_count));
+            status = rocblas_internal_trsv_substitution_template<DIM_X, T>(handle,
+                                                                           uplo,
+                                                                           transA,
+                                                                           diag,
+                                                                           n,
+                                                                           A_full,
+                                                                           0,
+                                                                           n,
+                                                                           stride_full,
+                                                                           x,
+                                                                           0,
+                                                                           incx,
+                                                                           stride_x,
+                                                                           batch_count,
+                                                                           (rocblas_int*)w_mem[1]);
+        }
+        else
+            status = rocblas_tpsv_template<BLOCK>(
+                handle, uplo, transA, diag, n, AP, 0, stride_A, x, 0, incx, stride_x, batch_count);
         if(status != rocblas_status_success)
             return status;
 
@@ -7,6 +7,7 @@
 #include "../blas1/rocblas_copy.hpp"
 #include "../blas1/rocblas_dot.hpp"
 #include "rocblas.h"
+#include "tiny_batched_device.hpp"
 #include <cstddef>
 
 template <rocblas_int DIM_X, rocblas_int DIM_Y, bool LOWER, bool UNIT, typename T>
@@ -177,6 +178,26 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
     ptrdiff_t shiftx = incx < 0 ? offsetx + ptrdiff_t(incx) * (1 - m) : offsetx;
 
+    // many tiny problems run in place in a persistent kernel, without the workspace
+    if(rocblas_use_tiny_batched(m, m, batch_count))
+    {
+        using T = std::remove_pointer_t<W>;
+        return rocblas_trmv_trsv_tiny_batched_launcher<false, T>(handle,
+                                                                 uplo,
+                                                                 transA,
+                                                                 diag,
+                                                                 m,
+                                                                 a,
+                                                                 offseta,
+                                                                 lda,
+                                                                 stridea,
+                                                                 x,
+                                                                 shiftx,
+                                                                 incx,
+                                                                 stridex,
+                                                                 batch_count);
+    }
+
     // NOTE: NB is currently hardcoded as 512
     constexpr int TRMVT_NB    = 512;
     constexpr int TRMVN_DIM_X = 64;
@@ -4,6 +4,7 @@
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
+#include "../blas_ex/rocblas_trsv_inverse.hpp"
 #include "rocblas_trsv_substitution.hpp"
 #include "utility.hpp"
 
@@ -14,6 +15,9 @@ namespace
     constexpr rocblas_int CTRSV_BLOCK = 64;
     constexpr rocblas_int ZTRSV_BLOCK = 32;
 
+    // diagonal block size of the inverses kept by the trsv inverse cache, as in trsv_ex
+    constexpr rocblas_int TRSV_INVERSE_CACHE_BLOCK = 128;
+
     template <typename>
     constexpr char rocblas_trsv_name[] = "unknown";
     template <>
@@ -25,6 +29,136 @@ namespace
     template <>
     constexpr char rocblas_trsv_name<rocblas_double_complex>[] = "rocblas_ztrsv";
 
+    // Solves with the inverses of the diagonal blocks of A, taken from the handle's trsv inverse
+    // cache or computed and then added to it
+    template <typename T>
+    rocblas_status rocblas_trsv_inverse_cache_impl(rocblas_handle    handle,
+                                                   rocblas_fill      uplo,
+                                                   rocblas_operation transA,
+                                                   rocblas_diagonal  diag,
+                                                   rocblas_int       m,
+                                                   const T*          A,
+                                                   rocblas_int       lda,
+                                                   T*                B,
+                                                   rocblas_int       incx)
+    {
+        static constexpr rocblas_int BLOCK = TRSV_INVERSE_CACHE_BLOCK;
+
+        rocblas_inverse_key key{A,
+                                m,
+                                lda,
+                                uplo,
+                                diag,
+                                BLOCK,
+                                rocblas_precision_string<T>,
+                                handle->trsv_inverse_cache.version};
+
+        // a size query assumes a miss, which needs the most workspace
+        const T* cached_invA = handle->is_device_memory_size_query()
+                                   ? nullptr
+                                   : (const T*)handle->trsv_inverse_cache.find(key);
+        rocblas_int cached_invA_size = cached_invA ? BLOCK * m : 0;
+
+        // Proxy object holds the allocation. It must stay alive as long as mem_* pointers below are alive.
+        auto  w_mem = handle->device_malloc(0);
+        void* w_mem_x_temp;
+        void* w_mem_x_temp_arr;
+        void* w_mem_invA;
+        void* w_mem_invA_arr;
+
+        rocblas_status perf_status
+            = rocblas_internal_trsv_inverse_template_mem<BLOCK, false, T>(handle,
+                                                                          m,
+                                                                          1,
+                                                                          w_mem,
+                                                                          w_mem_x_temp,
+                                                                          w_mem_x_temp_arr,
+                                                                          w_mem_invA,
+                                                                          w_mem_invA_arr,
+                                                                          cached_invA,
+                                                                          cached_invA_size);
+
+        // If this was a device memory query or an error occurred, return status
+        if(perf_status != rocblas_status_success)
+            return perf_status;
+
+        auto check_numerics = handle->check_numerics;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status trsv_check_numerics_status
+                = rocblas_internal_trsv_check_numerics(rocblas_trsv_name<T>,
+                                                       handle,
+                                                       m,
+                                                       A,
+                                                       0,
+                                                       lda,
+                                                       0,
+                                                       B,
+                                                       0,
+                                                       incx,
+                                                       0,
+                                                       1,
+                                                       check_numerics,
+                                                       is_input);
+            if(trsv_check_numerics_status != rocblas_status_success)
+                return trsv_check_numerics_status;
+        }
+
+        rocblas_status status
+            = rocblas_internal_trsv_inverse_template<BLOCK, false, T>(handle,
+                                                                      uplo,
+                                                                      transA,
+                                                                      diag,
+                                                                      m,
+                                                                      A,
+                                                                      0,
+                                                                      lda,
+                                                                      0,
+                                                                      B,
+                                                                      0,
+                                                                      incx,
+                                                                      0,
+                                                                      1,
+                                                                      w_mem_x_temp,
+                                                                      w_mem_x_temp_arr,
+                                                                      w_mem_invA,
+                                                                      w_mem_invA_arr,
+                                                                      cached_invA,
+                                                                      cached_invA_size);
+        if(status != rocblas_status_success)
+            return status;
+
+        // keep the inverses computed in the workspace for the next solves
+        if(!cached_invA)
+            handle->trsv_inverse_cache.insert(
+                key, w_mem_invA, sizeof(T) * BLOCK * m, handle->get_stream());
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status trsv_check_numerics_status
+                = rocblas_internal_trsv_check_numerics(rocblas_trsv_name<T>,
+                                                       handle,
+                                                       m,
+                                                       A,
+                                                       0,
+                                                       lda,
+                                                       0,
+                                                       B,
+                                                       0,
+                                                       incx,
+                                                       0,
+                                                       1,
+                                                       check_numerics,
+                                                       is_input);
+            if(trsv_check_numerics_status != rocblas_status_success)
+                return trsv_check_numerics_status;
+        }
+        return status;
+    }
+
     template <rocblas_int BLOCK, typename T>
     rocblas_status rocblas_trsv_impl(rocblas_handle    handle,
                                      rocblas_fill      uplo,
@@ -106,6 +240,9 @@ namespace
         if(!A || !B)
             return rocblas_status_invalid_pointer;
 
+        if(handle->trsv_inverse_cache.size)
+            return rocblas_trsv_inverse_cache_impl(handle, uplo, transA, diag, m, A, lda, B, incx);
+
         // Need one int worth of global memory to keep track of completed sections
         size_t dev_bytes_completed_sec = sizeof(rocblas_int);
         if(handle->is_device_memory_size_query())
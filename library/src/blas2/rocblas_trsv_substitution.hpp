@@ -5,6 +5,7 @@
 #pragma once
 
 #include "check_numerics_vector.hpp"
+#include "tiny_batched_device.hpp"
 
 // Copyright 2014-2021, The Science and Technology Facilities Council (STFC)
 // All rights reserved.
@@ -775,6 +776,23 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
     offset_x = incx < 0 ? offset_x + ptrdiff_t(incx) * (1 - m) : offset_x;
 
+    // many tiny problems are solved in a persistent kernel, without w_completed_sec
+    if(rocblas_use_tiny_batched(m, m, batch_count))
+        return rocblas_trmv_trsv_tiny_batched_launcher<true, T>(handle,
+                                                                uplo,
+                                                                transA,
+                                                                diag,
+                                                                m,
+                                                                dA,
+                                                                offset_A,
+                                                                lda,
+                                                                stride_A,
+                                                                dx,
+                                                                offset_x,
+                                                                incx,
+                                                                stride_x,
+                                                                batch_count);
+
     constexpr rocblas_int DIM_Y  = 4;
     rocblas_int           blocks = (m + DIM_X - 1) / DIM_X;
     dim3                  threads(DIM_X, DIM_Y, 1);
@@ -0,0 +1,500 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include <algorithm>
+
+/*! \brief rocblas_tiny_batched_min_batch_count
+
+    \details
+    Smallest batch_count for which batched gemv, trmv, trsv and ger with m and n of at most
+    rocblas_tiny_batched_max_n() launch the persistent tiny batched kernels instead of giving every
+    problem its own blocks. Batched trsm and trtri with triangles of at most
+    ROCBLAS_TINY_TRIANGLE_MAX_N use the same threshold for their register resident kernels.
+    Defaults to 1024 and is overridden by the environment variable
+    ROCBLAS_TINY_BATCHED_MIN_BATCH_COUNT, which is read once per process.
+    scripts/performance/blas/tiny_batched_sweep.py measures the crossover.
+    ********************************************************************/
+rocblas_int rocblas_tiny_batched_min_batch_count();
+
+// threads per problem, the largest m and n of a tiny problem
+constexpr rocblas_int rocblas_tiny_batched_max_n()
+{
+    return 64;
+}
+
+// problems of a block, one per thread row
+constexpr rocblas_int rocblas_tiny_batched_problems_per_block()
+{
+    return 4;
+}
+
+// resident blocks of the tiny batched kernels per compute unit
+constexpr rocblas_int rocblas_tiny_batched_blocks_per_cu()
+{
+    return 8;
+}
+
+inline bool rocblas_use_tiny_batched(rocblas_int m, rocblas_int n, rocblas_int batch_count)
+{
+    return m <= rocblas_tiny_batched_max_n() && n <= rocblas_tiny_batched_max_n()
+           && batch_count >= rocblas_tiny_batched_min_batch_count();
+}
+
+/**
+  *  The persistent grid of the tiny batched kernels, which fills the device once. Each block takes
+  *  the groups of rocblas_tiny_batched_problems_per_block() consecutive problems
+  *  blockIdx.x, blockIdx.x + gridDim.x, ... so every problem is computed by one thread row.
+  *  A device of unknown CU count, 0, gets a single block.
+  */
+inline dim3 rocblas_tiny_batched_grid(rocblas_handle handle, rocblas_int batch_count)
+{
+    rocblas_int groups = (batch_count - 1) / rocblas_tiny_batched_problems_per_block() + 1;
+    rocblas_int blocks = std::max(1, handle->getCUCount() * rocblas_tiny_batched_blocks_per_cu());
+    return dim3(std::min(groups, blocks));
+}
+
+// Element (i, j) of op(A)
+template <typename T>
+__device__ T tiny_batched_op_element(
+    rocblas_operation transA, const T* A, rocblas_int lda, rocblas_int i, rocblas_int j)
+{
+    if(transA == rocblas_operation_none)
+        return A[i + size_t(lda) * j];
+    else if(transA == rocblas_operation_conjugate_transpose)
+        return conj(A[j + size_t(lda) * i]);
+    else
+        return A[j + size_t(lda) * i];
+}
+
+/**
+  *  y := alpha * op(A) * x + beta * y for batch_count problems of at most NB rows and columns.
+  *  Thread row ty computes one problem, staging x in LDS, and thread tx computes y_tx.
+  */
+template <rocblas_int NB, rocblas_int PROBLEMS, typename T, typename U, typename V, typename W>
+ROCBLAS_KERNEL __launch_bounds__(NB* PROBLEMS) void
+    gemv_tiny_batched_kernel(rocblas_operation transA,
+                             rocblas_int       m,
+                             rocblas_int       n,
+                             U                 alpha_device_host,
+                             rocblas_stride    stride_alpha,
+                             const V*          Aa,
+                             ptrdiff_t         shifta,
+                             rocblas_int       lda,
+                             rocblas_stride    strideA,
+                             const V*          xa,
+                             ptrdiff_t         shiftx,
+                             rocblas_int       incx,
+                             rocblas_stride    stridex,
+                             U                 beta_device_host,
+                             rocblas_stride    stride_beta,
+                             W*                ya,
+                             ptrdiff_t         shifty,
+                             rocblas_int       incy,
+                             rocblas_stride    stridey,
+                             rocblas_int       batch_count)
+{
+    __shared__ T sx[PROBLEMS][NB];
+
+    rocblas_int tx    = hipThreadIdx_x;
+    rocblas_int ty    = hipThreadIdx_y;
+    rocblas_int x_len = transA == rocblas_operation_none ? n : m;
+    rocblas_int y_len = transA == rocblas_operation_none ? m : n;
+
+    // the bound only depends on the block, so every thread of the block reaches the barriers
+    for(rocblas_int first = hipBlockIdx_x * PROBLEMS; first < batch_count;
+        first += hipGridDim_x * PROBLEMS)
+    {
+        rocblas_int batch  = first + ty;
+        bool        active = batch < batch_count;
+
+        T alpha = 0, beta = 1;
+        if(active)
+        {
+            alpha = load_scalar(alpha_device_host, batch, stride_alpha);
+            beta  = load_scalar(beta_device_host, batch, stride_beta);
+        }
+
+        const T* A = nullptr;
+        if(active && alpha)
+        {
+            A          = load_ptr_batch(Aa, batch, shifta, strideA);
+            const T* x = load_ptr_batch(xa, batch, shiftx, stridex);
+            if(tx < x_len)
+                sx[ty][tx] = x[tx * ptrdiff_t(incx)];
+        }
+        __syncthreads();
+
+        if(active && tx < y_len && (alpha || beta != 1))
+        {
+            T sum = 0;
+            if(alpha)
+                for(rocblas_int k = 0; k < x_len; k++)
+                    sum += tiny_batched_op_element(transA, A, lda, tx, k) * sx[ty][k];
+
+            T* y  = load_ptr_batch(ya, batch, shifty, stridey);
+            T& yi = y[tx * ptrdiff_t(incy)];
+            yi    = beta ? alpha * sum + beta * yi : alpha * sum;
+        }
+        __syncthreads();
+    }
+}
+
+/**
+  *  x := op(A) * x for batch_count triangular A of order m <= NB. Thread row ty computes one
+  *  problem, staging x in LDS, and thread tx computes x_tx over the triangle of op(A), which is
+  *  lower when A is lower and not transposed or upper and transposed.
+  */
+template <rocblas_int NB, rocblas_int PROBLEMS, typename T, typename A, typename X>
+ROCBLAS_KERNEL __launch_bounds__(NB* PROBLEMS) void
+    trmv_tiny_batched_kernel(rocblas_fill      uplo,
+                             rocblas_operation transA,
+                             rocblas_diagonal  diag,
+                             rocblas_int       m,
+                             A                 Aa,
+                             ptrdiff_t         shifta,
+                             rocblas_int       lda,
+                             rocblas_stride    strideA,
+                             X                 xa,
+                             ptrdiff_t         shiftx,
+                             rocblas_int       incx,
+                             rocblas_stride    stridex,
+                             rocblas_int       batch_count)
+{
+    __shared__ T sx[PROBLEMS][NB];
+
+    rocblas_int tx    = hipThreadIdx_x;
+    rocblas_int ty    = hipThreadIdx_y;
+    bool        lower = (uplo == rocblas_fill_lower) == (transA == rocblas_operation_none);
+    bool        unit  = diag == rocblas_diagonal_unit;
+
+    for(rocblas_int first = hipBlockIdx_x * PROBLEMS; first < batch_count;
+        first += hipGridDim_x * PROBLEMS)
+    {
+        rocblas_int batch  = first + ty;
+        bool        active = batch < batch_count && tx < m;
+
+        const T* a = nullptr;
+        T*       x = nullptr;
+        if(active)
+        {
+            a          = load_ptr_batch(Aa, batch, shifta, strideA);
+            x          = load_ptr_batch(xa, batch, shiftx, stridex);
+            sx[ty][tx] = x[tx * ptrdiff_t(incx)];
+        }
+        __syncthreads();
+
+        if(active)
+        {
+            T sum = sx[ty][tx];
+            if(!unit)
+                sum *= tiny_batched_op_element(transA, a, lda, tx, tx);
+
+            rocblas_int begin = lower ? 0 : tx + 1;
+            rocblas_int end   = lower ? tx : m;
+            for(rocblas_int k = begin; k < end; k++)
+                sum += tiny_batched_op_element(transA, a, lda, tx, k) * sx[ty][k];
+            x[tx * ptrdiff_t(incx)] = sum;
+        }
+        __syncthreads();
+    }
+}
+
+/**
+  *  Solves op(A) * x = b for batch_count triangular A of order m <= NB, overwriting b with x.
+  *  Thread row ty solves one problem and thread tx holds x_tx. Column k of op(A) is eliminated
+  *  once x_k is solved and published in LDS, in the order of the substitution.
+  */
+template <rocblas_int NB, rocblas_int PROBLEMS, typename T, typename A, typename X>
+ROCBLAS_KERNEL __launch_bounds__(NB* PROBLEMS) void
+    trsv_tiny_batched_kernel(rocblas_fill      uplo,
+                             rocblas_operation transA,
+                             rocblas_diagonal  diag,
+                             rocblas_int       m,
+                             A                 Aa,
+                             ptrdiff_t         shifta,
+                             rocblas_int       lda,
+                             rocblas_stride    strideA,
+                             X                 xa,
+                             ptrdiff_t         shiftx,
+                             rocblas_int       incx,
+                             rocblas_stride    stridex,
+                             rocblas_int       batch_count)
+{
+    __shared__ T sx[PROBLEMS][NB];
+
+    rocblas_int tx    = hipThreadIdx_x;
+    rocblas_int ty    = hipThreadIdx_y;
+    bool        lower = (uplo == rocblas_fill_lower) == (transA == rocblas_operation_none);
+    bool        unit  = diag == rocblas_diagonal_unit;
+
+    for(rocblas_int first = hipBlockIdx_x * PROBLEMS; first < batch_count;
+        first += hipGridDim_x * PROBLEMS)
+    {
+        rocblas_int batch  = first + ty;
+        bool        active = batch < batch_count && tx < m;
+
+        const T* a  = nullptr;
+        T*       x  = nullptr;
+        T        xi = 0;
+        if(active)
+        {
+            a  = load_ptr_batch(Aa, batch, shifta, strideA);
+            x  = load_ptr_batch(xa, batch, shiftx, stridex);
+            xi = x[tx * ptrdiff_t(incx)];
+        }
+
+        // forward substitution for lower op(A), backward for upper
+        for(rocblas_int step = 0; step < m; step++)
+        {
+            rocblas_int k = lower ? step : m - 1 - step;
+            if(active && tx == k)
+            {
+                if(!unit)
+                    xi = xi / tiny_batched_op_element(transA, a, lda, k, k);
+                sx[ty][k] = xi;
+            }
+            __syncthreads();
+
+            if(active && (lower ? tx > k : tx < k))
+                xi -= tiny_batched_op_element(transA, a, lda, tx, k) * sx[ty][k];
+        }
+
+        if(active)
+            x[tx * ptrdiff_t(incx)] = xi;
+        __syncthreads();
+    }
+}
+
+/**
+  *  A := A + alpha * x * y**T, or y**H if CONJ, for batch_count problems of at most NB rows and
+  *  columns. Thread row ty updates one problem, staging y in LDS, and thread tx updates row tx.
+  */
+template <rocblas_int NB,
+          rocblas_int PROBLEMS,
+          bool        CONJ,
+          typename T,
+          typename U,
+          typename V,
+          typename W>
+ROCBLAS_KERNEL __launch_bounds__(NB* PROBLEMS) void
+    ger_tiny_batched_kernel(rocblas_int    m,
+                            rocblas_int    n,
+                            W              alpha_device_host,
+                            rocblas_stride stride_alpha,
+                            const U __restrict__ xa,
+                            ptrdiff_t      shiftx,
+                            rocblas_int    incx,
+                            rocblas_stride stridex,
+                            const U __restrict__ ya,
+                            ptrdiff_t      shifty,
+                            rocblas_int    incy,
+                            rocblas_stride stridey,
+                            V              Aa,
+                            ptrdiff_t      shifta,
+                            rocblas_int    lda,
+                            rocblas_stride strideA,
+                            rocblas_int    batch_count)
+{
+    __shared__ T sy[PROBLEMS][NB];
+
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int ty = hipThreadIdx_y;
+
+    for(rocblas_int first = hipBlockIdx_x * PROBLEMS; first < batch_count;
+        first += hipGridDim_x * PROBLEMS)
+    {
+        rocblas_int batch  = first + ty;
+        bool        active = batch < batch_count;
+
+        T alpha = 0;
+        if(active)
+            alpha = load_scalar(alpha_device_host, batch, stride_alpha);
+
+        if(active && alpha && tx < n)
+        {
+            const T* y = load_ptr_batch(ya, batch, shifty, stridey);
+            sy[ty][tx] = CONJ ? conj(y[tx * ptrdiff_t(incy)]) : y[tx * ptrdiff_t(incy)];
+        }
+        __syncthreads();
+
+        if(active && alpha && tx < m)
+        {
+            const T* x  = load_ptr_batch(xa, batch, shiftx, stridex);
+            T*       A  = load_ptr_batch(Aa, batch, shifta, strideA);
+            T        xi = alpha * x[tx * ptrdiff_t(incx)];
+            for(rocblas_int j = 0; j < n; j++)
+                A[tx + size_t(lda) * j] += xi * sy[ty][j];
+        }
+        __syncthreads();
+    }
+}
+
+template <typename T, typename U, typename V, typename W>
+rocblas_status rocblas_gemv_tiny_batched_launcher(rocblas_handle    handle,
+                                                  rocblas_operation transA,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  const U*          alpha,
+                                                  rocblas_stride    stride_alpha,
+                                                  const V*          A,
+                                                  ptrdiff_t         shifta,
+                                                  rocblas_int       lda,
+                                                  rocblas_stride    strideA,
+                                                  const V*          x,
+                                                  ptrdiff_t         shiftx,
+                                                  rocblas_int       incx,
+                                                  rocblas_stride    stridex,
+                                                  const U*          beta,
+                                                  rocblas_stride    stride_beta,
+                                                  W*                y,
+                                                  ptrdiff_t         shifty,
+                                                  rocblas_int       incy,
+                                                  rocblas_stride    stridey,
+                                                  rocblas_int       batch_count)
+{
+    static constexpr rocblas_int NB       = rocblas_tiny_batched_max_n();
+    static constexpr rocblas_int PROBLEMS = rocblas_tiny_batched_problems_per_block();
+
+    dim3 grid = rocblas_tiny_batched_grid(handle, batch_count);
+    dim3 threads(NB, PROBLEMS);
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((gemv_tiny_batched_kernel<NB, PROBLEMS, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           transA,
+                           m,
+                           n,
+                           alpha,
+                           stride_alpha,
+                           A,
+                           shifta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           beta,
+                           stride_beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           batch_count);
+    else
+    {
+        if(!*alpha && *beta == 1)
+            return rocblas_status_success;
+
+        hipLaunchKernelGGL((gemv_tiny_batched_kernel<NB, PROBLEMS, T>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           transA,
+                           m,
+                           n,
+                           *alpha,
+                           stride_alpha,
+                           A,
+                           shifta,
+                           lda,
+                           strideA,
+                           x,
+                           shiftx,
+                           incx,
+                           stridex,
+                           *beta,
+                           stride_beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           batch_count);
+    }
+
+    return rocblas_status_success;
+}
+
+template <bool SOLVE, typename T, typename A, typename X>
+rocblas_status rocblas_trmv_trsv_tiny_batched_launcher(rocblas_handle    handle,
+                                                       rocblas_fill      uplo,
+                                                       rocblas_operation transA,
+                                                       rocblas_diagonal  diag,
+                                                       rocblas_int       m,
+                                                       A                 a,
+                                                       ptrdiff_t         shifta,
+                                                       rocblas_int       lda,
+                                                       rocblas_stride    strideA,
+                                                       X                 x,
+                                                       ptrdiff_t         shiftx,
+                                                       rocblas_int       incx,
+                                                       rocblas_stride    stridex,
+                                                       rocblas_int       batch_count)
+{
+    static constexpr rocblas_int NB       = rocblas_tiny_batched_max_n();
+    static constexpr rocblas_int PROBLEMS = rocblas_tiny_batched_problems_per_block();
+
+    dim3 grid = rocblas_tiny_batched_grid(handle, batch_count);
+    dim3 threads(NB, PROBLEMS);
+
+#define tiny_batched_KARGS                                                                        \
+    grid, threads, 0, handle->get_stream(), uplo, transA, diag, m, a, shifta, lda, strideA, x, \
+        shiftx, incx, stridex, batch_count
+
+    if(SOLVE)
+        hipLaunchKernelGGL((trsv_tiny_batched_kernel<NB, PROBLEMS, T>), tiny_batched_KARGS);
+    else
+        hipLaunchKernelGGL((trmv_tiny_batched_kernel<NB, PROBLEMS, T>), tiny_batched_KARGS);
+#undef tiny_batched_KARGS
+
+    return rocblas_status_success;
+}
+
+template <bool CONJ, typename T, typename U, typename V, typename W>
+rocblas_status rocblas_ger_tiny_batched_launcher(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 const W*       alpha,
+                                                 rocblas_stride stride_alpha,
+                                                 const U*       x,
+                                                 ptrdiff_t      shiftx,
+                                                 rocblas_int    incx,
+                                                 rocblas_stride stridex,
+                                                 const U*       y,
+                                                 ptrdiff_t      shifty,
+                                                 rocblas_int    incy,
+                                                 rocblas_stride stridey,
+                                                 V*             A,
+                                                 ptrdiff_t      shifta,
+                                                 rocblas_int    lda,
+                                                 rocblas_stride strideA,
+                                                 rocblas_int    batch_count)
+{
+    static constexpr rocblas_int NB       = rocblas_tiny_batched_max_n();
+    static constexpr rocblas_int PROBLEMS = rocblas_tiny_batched_problems_per_block();
+
+    dim3 grid = rocblas_tiny_batched_grid(handle, batch_count);
+    dim3 threads(NB, PROBLEMS);
+
+#define ger_tiny_batched_KARGS(alpha_)                                                        \
+    grid, threads, 0, handle->get_stream(), m, n, alpha_, stride_alpha, x, shiftx, incx, \
+        stridex, y, shifty, incy, stridey, A, shifta, lda, strideA, batch_count
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((ger_tiny_batched_kernel<NB, PROBLEMS, CONJ, T>),
+                           ger_tiny_batched_KARGS(alpha));
+    else
+        hipLaunchKernelGGL((ger_tiny_batched_kernel<NB, PROBLEMS, CONJ, T>),
+                           ger_tiny_batched_KARGS(*alpha));
+#undef ger_tiny_batched_KARGS
+
+    return rocblas_status_success;
+}
@@ -2,6 +2,7 @@
  * Copyright 2018-2021 Advanced Micro Devices, Inc.
  ************************************************************************** */
 #include "gemm.hpp"
+#include "gemm_split_k.hpp"
 #include "logging.hpp"
 
 namespace
@@ -41,7 +42,19 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        // a k much larger than m and n is split so that more workgroups than the tiles of C share
+        // the gemm, half precision partial products losing too much accuracy to be summed
+        rocblas_int splits = std::is_same<T, rocblas_half>{}
+                                 ? 1
+                                 : rocblas_gemm_split_k_count(handle, m, n, k);
+
+        if(handle->is_device_memory_size_query())
+        {
+            if(splits < 2)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(
+                rocblas_gemm_split_k_workspace_size<T>(m, n, splits));
+        }
 
         // Copy alpha and beta to host if on device
         T alpha_h, beta_h;
@@ -159,27 +172,56 @@ namespace
                 return gemm_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_internal_gemm_template<false>(handle,
-                                                                      trans_a,
-                                                                      trans_b,
-                                                                      m,
-                                                                      n,
-                                                                      k,
-                                                                      alpha,
-                                                                      A,
-                                                                      0,
-                                                                      ld_a,
-                                                                      0,
-                                                                      B,
-                                                                      0,
-                                                                      ld_b,
-                                                                      0,
-                                                                      beta,
-                                                                      C,
-                                                                      0,
-                                                                      ld_c,
-                                                                      0,
-                                                                      1);
+        // without device memory for the partial products, k is not split
+        rocblas_status status = rocblas_status_continue;
+        if constexpr(!std::is_same<T, rocblas_half>{})
+        {
+            if(splits > 1 && *alpha != T(0))
+            {
+                auto w_mem = handle->device_malloc(
+                    rocblas_gemm_split_k_workspace_size<T>(m, n, splits));
+                if(w_mem)
+                    status = rocblas_gemm_split_k_template(handle,
+                                                           trans_a,
+                                                           trans_b,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           ld_a,
+                                                           B,
+                                                           ld_b,
+                                                           beta,
+                                                           C,
+                                                           ld_c,
+                                                           splits,
+                                                           (T*)w_mem);
+            }
+        }
+
+        if(status == rocblas_status_continue)
+            status = rocblas_internal_gemm_template<false>(handle,
+                                                           trans_a,
+                                                           trans_b,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           0,
+                                                           ld_a,
+                                                           0,
+                                                           B,
+                                                           0,
+                                                           ld_b,
+                                                           0,
+                                                           beta,
+                                                           C,
+                                                           0,
+                                                           ld_c,
+                                                           0,
+                                                           1);
         if(status != rocblas_status_success)
             return status;
 
@@ -0,0 +1,34 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "gemm_split_k.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+rocblas_int rocblas_gemm_split_k_min_k()
+{
+    static const rocblas_int min_k = [] {
+        const char* env = read_env("ROCBLAS_GEMM_SPLIT_K_MIN_K");
+        return env && *env ? std::max(atoi(env), 1) : 8192;
+    }();
+    return min_k;
+}
+
+rocblas_int
+    rocblas_gemm_split_k_count(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    if(m <= 0 || n <= 0 || k < rocblas_gemm_split_k_min_k() || k / 16 < std::max(m, n))
+        return 1;
+
+    // a device of unknown CU count, 0, is not split
+    int                   cu_count = handle->getCUCount();
+    constexpr rocblas_int tile     = rocblas_gemm_split_k_tile();
+    int64_t               tiles    = int64_t((m - 1) / tile + 1) * ((n - 1) / tile + 1);
+    if(tiles * 2 > cu_count)
+        return 1;
+
+    int64_t splits = std::min({int64_t(cu_count) / tiles,
+                               int64_t(k / rocblas_gemm_split_k_min_depth()),
+                               int64_t(rocblas_gemm_split_k_max_splits())});
+    return std::max(rocblas_int(splits), 1);
+}
@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "gemm.hpp"
+#include "handle.hpp"
+
+/*! \brief rocblas_gemm_split_k_min_k
+
+    \details
+    Smallest k for which rocblas_Xgemm may split k across several gemms whose partial products
+    are summed in device memory of the handle, see rocblas_gemm_split_k_count. Defaults to 8192
+    and is overridden by the environment variable ROCBLAS_GEMM_SPLIT_K_MIN_K, which is read once
+    per process. scripts/performance/blas/gemm_split_k_sweep.py measures the crossover.
+    ********************************************************************/
+rocblas_int rocblas_gemm_split_k_min_k();
+
+// rows and columns of the tiles of C by which the parallelism of a gemm is estimated
+constexpr rocblas_int rocblas_gemm_split_k_tile()
+{
+    return 64;
+}
+
+// smallest depth of the k range of a split
+constexpr rocblas_int rocblas_gemm_split_k_min_depth()
+{
+    return 1024;
+}
+
+constexpr rocblas_int rocblas_gemm_split_k_max_splits()
+{
+    return 64;
+}
+
+/*! \brief rocblas_gemm_split_k_count
+
+    \details
+    Number of splits of k for an m by n by k gemm, or 1 when it is not split. k is split when it
+    is at least rocblas_gemm_split_k_min_k() and 16 times m and n, and when the tiles of C occupy
+    at most half of the compute units of the device of handle. The splits then fill the compute
+    units, with k ranges of at least rocblas_gemm_split_k_min_depth().
+    ********************************************************************/
+rocblas_int
+    rocblas_gemm_split_k_count(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int k);
+
+// device memory of the partial products of a split gemm
+template <typename T>
+size_t rocblas_gemm_split_k_workspace_size(rocblas_int m, rocblas_int n, rocblas_int splits)
+{
+    return sizeof(T) * splits * size_t(m) * n;
+}
+
+/**
+ *  C := alpha * (W_0 + W_1 + ... + W_{splits - 1}) + beta * C, the m by n partial products W_s
+ *  being consecutive in W. The partial products are summed in the same order by every thread,
+ *  so that the result does not depend on the atomics mode or on the launch.
+ */
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
+ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void gemm_split_k_reduce_kernel(rocblas_int m,
+                                                                              rocblas_int n,
+                                                                              rocblas_int splits,
+                                                                              const T*    W,
+                                                                              T           alpha,
+                                                                              T           beta,
+                                                                              T*          C,
+                                                                              rocblas_int ldc)
+{
+    rocblas_int i = hipBlockIdx_x * DIM_X + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * DIM_Y + hipThreadIdx_y;
+    if(i >= m || j >= n)
+        return;
+
+    size_t   mn  = size_t(m) * n;
+    const T* w   = W + i + size_t(j) * m;
+    T        sum = w[0];
+    for(rocblas_int s = 1; s < splits; s++)
+        sum += w[s * mn];
+
+    T& c = C[i + size_t(j) * ldc];
+    c    = beta == T(0) ? alpha * sum : alpha * sum + beta * c;
+}
+
+/*! \brief C := alpha * op(A) * op(B) + beta * C with k split into splits ranges.
+
+    The partial products of the ranges are computed by one strided batched gemm into W, the
+    remainder of k being added to the first one by a second gemm, and summed by
+    gemm_split_k_reduce_kernel. alpha and beta are on the host, alpha is not 0 and W
+    holds rocblas_gemm_split_k_workspace_size<T>(m, n, splits) bytes.
+    ********************************************************************/
+template <typename T>
+rocblas_status rocblas_gemm_split_k_template(rocblas_handle    handle,
+                                             rocblas_operation trans_a,
+                                             rocblas_operation trans_b,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const T*          alpha,
+                                             const T*          A,
+                                             rocblas_int       ld_a,
+                                             const T*          B,
+                                             rocblas_int       ld_b,
+                                             const T*          beta,
+                                             T*                C,
+                                             rocblas_int       ld_c,
+                                             rocblas_int       splits,
+                                             T*                W)
+{
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    const T     one = 1, zero = 0;
+    rocblas_int depth = k / splits;
+    rocblas_int rest  = k - depth * splits;
+
+    // A and B of consecutive ranges of k are stride_a and stride_b elements apart
+    rocblas_stride stride_a
+        = trans_a == rocblas_operation_none ? rocblas_stride(depth) * ld_a : depth;
+    rocblas_stride stride_b
+        = trans_b == rocblas_operation_none ? depth : rocblas_stride(depth) * ld_b;
+    rocblas_stride stride_w = rocblas_stride(m) * n;
+
+    // W_s := op(A) * op(B) on the range [s * depth, (s + 1) * depth) of k
+    RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemm_template<false>(handle,
+                                                                  trans_a,
+                                                                  trans_b,
+                                                                  m,
+                                                                  n,
+                                                                  depth,
+                                                                  &one,
+                                                                  A,
+                                                                  0,
+                                                                  ld_a,
+                                                                  stride_a,
+                                                                  B,
+                                                                  0,
+                                                                  ld_b,
+                                                                  stride_b,
+                                                                  &zero,
+                                                                  W,
+                                                                  0,
+                                                                  m,
+                                                                  stride_w,
+                                                                  splits));
+
+    // W_0 += op(A) * op(B) on the rest of k
+    if(rest)
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemm_template<false>(handle,
+                                                                      trans_a,
+                                                                      trans_b,
+                                                                      m,
+                                                                      n,
+                                                                      rest,
+                                                                      &one,
+                                                                      A + splits * stride_a,
+                                                                      0,
+                                                                      ld_a,
+                                                                      stride_a,
+                                                                      B + splits * stride_b,
+                                                                      0,
+                                                                      ld_b,
+                                                                      stride_b,
+                                                                      &one,
+                                                                      W,
+                                                                      0,
+                                                                      m,
+                                                                      stride_w,
+                                                                      1));
+
+    static constexpr int GEMM_SPLIT_K_DIM_X = 64;
+    static constexpr int GEMM_SPLIT_K_DIM_Y = 4;
+    dim3                 grid((m - 1) / GEMM_SPLIT_K_DIM_X + 1, (n - 1) / GEMM_SPLIT_K_DIM_Y + 1);
+    dim3                 threads(GEMM_SPLIT_K_DIM_X, GEMM_SPLIT_K_DIM_Y);
+
+    hipLaunchKernelGGL((gemm_split_k_reduce_kernel<GEMM_SPLIT_K_DIM_X, GEMM_SPLIT_K_DIM_Y>),
+                       grid,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       m,
+                       n,
+                       splits,
+                       (const T*)W,
+                       *alpha,
+                       *beta,
+                       C,
+                       ld_c);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,505 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_gemm_grouped.hpp"
+#include "Tensile/gemm.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_grouped_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_grouped_name<float>[] = "rocblas_sgemm_grouped";
+    template <>
+    constexpr char rocblas_gemm_grouped_name<double>[] = "rocblas_dgemm_grouped";
+    template <>
+    constexpr char rocblas_gemm_grouped_name<rocblas_float_complex>[] = "rocblas_cgemm_grouped";
+    template <>
+    constexpr char rocblas_gemm_grouped_name<rocblas_double_complex>[] = "rocblas_zgemm_grouped";
+
+    // Computes a group whose arguments are validated, with host or device arrays
+    template <typename T>
+    rocblas_status rocblas_gemm_grouped_launch(rocblas_handle     handle,
+                                               bool               host_arrays,
+                                               size_t             dev_bytes,
+                                               rocblas_operation  transA,
+                                               rocblas_operation  transB,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               const rocblas_int* k,
+                                               const T*           alpha,
+                                               const T* const     A[],
+                                               const rocblas_int* lda,
+                                               const T* const     B[],
+                                               const rocblas_int* ldb,
+                                               const T*           beta,
+                                               T* const           C[],
+                                               const rocblas_int* ldc,
+                                               rocblas_int        group_count)
+    {
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(!host_arrays)
+            return rocblas_gemm_grouped_template(handle,
+                                                 transA,
+                                                 transB,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 A,
+                                                 lda,
+                                                 B,
+                                                 ldb,
+                                                 beta,
+                                                 C,
+                                                 ldc,
+                                                 group_count,
+                                                 (void*)w_mem);
+
+        // Problems large enough to fill the device are computed by Tensile, one after the other.
+        // The other problems are copied to the device arrays of the workspace and computed by
+        // the grouped kernels, with the problems of Tensile given no rows so they are skipped.
+        auto ptrs    = std::make_unique<const void*[]>(3 * size_t(group_count));
+        auto sizes   = std::make_unique<rocblas_int[]>(6 * size_t(group_count));
+        bool grouped = false;
+
+        for(rocblas_int p = 0; p < group_count; p++)
+        {
+            const T* Ap    = A ? A[p] : nullptr;
+            const T* Bp    = B ? B[p] : nullptr;
+            int64_t  flops = int64_t(m[p]) * n[p] * k[p];
+            bool     large = flops >= rocblas_gemm_grouped_tensile_min_flops();
+            if(large)
+            {
+                // clang-format off
+                RETURN_IF_ROCBLAS_ERROR((rocblas_internal_gemm_template<false>(
+                    handle, transA, transB, m[p], n[p], k[p], alpha,
+                    Ap,   0, lda[p], 0,
+                    Bp,   0, ldb[p], 0, beta,
+                    C[p], 0, ldc[p], 0, 1)));
+                // clang-format on
+            }
+            else if(m[p] && n[p])
+                grouped = true;
+
+            ptrs[p]                    = Ap;
+            ptrs[group_count + p]      = Bp;
+            ptrs[2 * group_count + p]  = C[p];
+            sizes[p]                   = large ? 0 : m[p];
+            sizes[group_count + p]     = n[p];
+            sizes[2 * group_count + p] = k[p];
+            sizes[3 * group_count + p] = lda[p];
+            sizes[4 * group_count + p] = ldb[p];
+            sizes[5 * group_count + p] = ldc[p];
+        }
+
+        if(!grouped)
+            return rocblas_status_success;
+
+        // the arrays follow the tile offsets and the work counter
+        char* w_arrays = (char*)w_mem + rocblas_gemm_grouped_workspace_size(group_count, false);
+        auto  w_ptrs   = (const void**)w_arrays;
+        auto  w_sizes  = (rocblas_int*)(w_ptrs + 3 * size_t(group_count));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(w_ptrs,
+                                           &ptrs[0],
+                                           3 * size_t(group_count) * sizeof(void*),
+                                           hipMemcpyHostToDevice,
+                                           handle->get_stream()));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(w_sizes,
+                                           &sizes[0],
+                                           6 * size_t(group_count) * sizeof(rocblas_int),
+                                           hipMemcpyHostToDevice,
+                                           handle->get_stream()));
+
+        return rocblas_gemm_grouped_template(handle,
+                                             transA,
+                                             transB,
+                                             w_sizes,
+                                             w_sizes + group_count,
+                                             w_sizes + 2 * group_count,
+                                             alpha,
+                                             (const T* const*)w_ptrs,
+                                             w_sizes + 3 * group_count,
+                                             (const T* const*)(w_ptrs + group_count),
+                                             w_sizes + 4 * group_count,
+                                             beta,
+                                             (T* const*)(w_ptrs + 2 * group_count),
+                                             w_sizes + 5 * group_count,
+                                             group_count,
+                                             (void*)w_mem);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemm_grouped_impl(rocblas_handle       handle,
+                                             rocblas_pointer_mode array_mode,
+                                             rocblas_operation    transA,
+                                             rocblas_operation    transB,
+                                             const rocblas_int*   m,
+                                             const rocblas_int*   n,
+                                             const rocblas_int*   k,
+                                             const T*             alpha,
+                                             const T* const       A[],
+                                             const rocblas_int*   lda,
+                                             const T* const       B[],
+                                             const rocblas_int*   ldb,
+                                             const T*             beta,
+                                             T* const             C[],
+                                             const rocblas_int*   ldc,
+                                             rocblas_int          group_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        bool   host_arrays = array_mode == rocblas_pointer_mode_host;
+        size_t dev_bytes   = rocblas_gemm_grouped_workspace_size(group_count, host_arrays);
+        if(handle->is_device_memory_size_query())
+        {
+            if(group_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto transA_letter = rocblas_transpose_letter(transA);
+            auto transB_letter = rocblas_transpose_letter(transB);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_gemm_grouped_name<T>,
+                          array_mode,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          A,
+                          lda,
+                          B,
+                          ldb,
+                          LOG_TRACE_SCALAR_VALUE(handle, beta),
+                          C,
+                          ldc,
+                          group_count);
+
+            // the bench command only reproduces the group count, not the sizes of the problems
+            if(layer_mode & rocblas_layer_mode_log_bench)
+                log_bench(handle,
+                          "./rocblas-bench -f gemm_grouped -r",
+                          rocblas_precision_string<T>,
+                          "--transposeA",
+                          transA_letter,
+                          "--transposeB",
+                          transB_letter,
+                          LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                          LOG_BENCH_SCALAR_VALUE(handle, beta),
+                          "--batch_count",
+                          group_count);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_gemm_grouped_name<T>,
+                            "transA",
+                            transA_letter,
+                            "transB",
+                            transB_letter,
+                            "group_count",
+                            group_count);
+        }
+
+        if(array_mode != rocblas_pointer_mode_host && array_mode != rocblas_pointer_mode_device)
+            return rocblas_status_invalid_value;
+
+        if(group_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!group_count)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        // A and B are not read when alpha is zero
+        bool alpha_zero = handle->pointer_mode == rocblas_pointer_mode_host && !*alpha;
+        if(alpha_zero && *beta == 1)
+            return rocblas_status_success;
+
+        if(!m || !n || !k || !lda || !ldb || !ldc || !C || (!alpha_zero && (!A || !B)))
+            return rocblas_status_invalid_pointer;
+
+        // device arrays are not read on the host, so problems with invalid sizes are skipped by
+        // the kernels, host arrays are checked like the arguments of rocblas_Xgemm
+        if(host_arrays)
+        {
+            for(rocblas_int p = 0; p < group_count; p++)
+            {
+                rocblas_int rows_a = transA == rocblas_operation_none ? m[p] : k[p];
+                rocblas_int rows_b = transB == rocblas_operation_none ? k[p] : n[p];
+                if(m[p] < 0 || n[p] < 0 || k[p] < 0 || lda[p] < rows_a || ldb[p] < rows_b
+                   || ldc[p] < m[p])
+                    return rocblas_status_invalid_size;
+            }
+
+            for(rocblas_int p = 0; p < group_count; p++)
+            {
+                if(!m[p] || !n[p])
+                    continue;
+                if(!C[p] || (k[p] && !alpha_zero && (!A[p] || !B[p])))
+                    return rocblas_status_invalid_pointer;
+            }
+        }
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status gemm_grouped_check_numerics_status
+                = rocblas_gemm_grouped_check_numerics(rocblas_gemm_grouped_name<T>,
+                                                      handle,
+                                                      host_arrays,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      C,
+                                                      ldc,
+                                                      group_count,
+                                                      check_numerics,
+                                                      is_input);
+            if(gemm_grouped_check_numerics_status != rocblas_status_success)
+                return gemm_grouped_check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_gemm_grouped_launch(handle,
+                                                            host_arrays,
+                                                            dev_bytes,
+                                                            transA,
+                                                            transB,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            lda,
+                                                            B,
+                                                            ldb,
+                                                            beta,
+                                                            C,
+                                                            ldc,
+                                                            group_count);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status gemm_grouped_check_numerics_status
+                = rocblas_gemm_grouped_check_numerics(rocblas_gemm_grouped_name<T>,
+                                                      handle,
+                                                      host_arrays,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      A,
+                                                      lda,
+                                                      B,
+                                                      ldb,
+                                                      C,
+                                                      ldc,
+                                                      group_count,
+                                                      check_numerics,
+                                                      is_input);
+            if(gemm_grouped_check_numerics_status != rocblas_status_success)
+                return gemm_grouped_check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+* ===========================================================================
+*    C wrapper
+* ===========================================================================
+*/
+
+extern "C" {
+
+rocblas_status rocblas_sgemm_grouped(rocblas_handle       handle,
+                                     rocblas_pointer_mode array_mode,
+                                     rocblas_operation    transA,
+                                     rocblas_operation    transB,
+                                     const rocblas_int*   m,
+                                     const rocblas_int*   n,
+                                     const rocblas_int*   k,
+                                     const float*         alpha,
+                                     const float* const   A[],
+                                     const rocblas_int*   lda,
+                                     const float* const   B[],
+                                     const rocblas_int*   ldb,
+                                     const float*         beta,
+                                     float* const         C[],
+                                     const rocblas_int*   ldc,
+                                     rocblas_int          group_count)
+try
+{
+    return rocblas_gemm_grouped_impl(handle,
+                                     array_mode,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     B,
+                                     ldb,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     group_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_dgemm_grouped(rocblas_handle       handle,
+                                     rocblas_pointer_mode array_mode,
+                                     rocblas_operation    transA,
+                                     rocblas_operation    transB,
+                                     const rocblas_int*   m,
+                                     const rocblas_int*   n,
+                                     const rocblas_int*   k,
+                                     const double*        alpha,
+                                     const double* const  A[],
+                                     const rocblas_int*   lda,
+                                     const double* const  B[],
+                                     const rocblas_int*   ldb,
+                                     const double*        beta,
+                                     double* const        C[],
+                                     const rocblas_int*   ldc,
+                                     rocblas_int          group_count)
+try
+{
+    return rocblas_gemm_grouped_impl(handle,
+                                     array_mode,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     B,
+                                     ldb,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     group_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_cgemm_grouped(rocblas_handle                     handle,
+                                     rocblas_pointer_mode               array_mode,
+                                     rocblas_operation                  transA,
+                                     rocblas_operation                  transB,
+                                     const rocblas_int*                 m,
+                                     const rocblas_int*                 n,
+                                     const rocblas_int*                 k,
+                                     const rocblas_float_complex*       alpha,
+                                     const rocblas_float_complex* const A[],
+                                     const rocblas_int*                 lda,
+                                     const rocblas_float_complex* const B[],
+                                     const rocblas_int*                 ldb,
+                                     const rocblas_float_complex*       beta,
+                                     rocblas_float_complex* const       C[],
+                                     const rocblas_int*                 ldc,
+                                     rocblas_int                        group_count)
+try
+{
+    return rocblas_gemm_grouped_impl(handle,
+                                     array_mode,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     B,
+                                     ldb,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     group_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_zgemm_grouped(rocblas_handle                      handle,
+                                     rocblas_pointer_mode                array_mode,
+                                     rocblas_operation                   transA,
+                                     rocblas_operation                   transB,
+                                     const rocblas_int*                  m,
+                                     const rocblas_int*                  n,
+                                     const rocblas_int*                  k,
+                                     const rocblas_double_complex*       alpha,
+                                     const rocblas_double_complex* const A[],
+                                     const rocblas_int*                  lda,
+                                     const rocblas_double_complex* const B[],
+                                     const rocblas_int*                  ldb,
+                                     const rocblas_double_complex*       beta,
+                                     rocblas_double_complex* const       C[],
+                                     const rocblas_int*                  ldc,
+                                     rocblas_int                         group_count)
+try
+{
+    return rocblas_gemm_grouped_impl(handle,
+                                     array_mode,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     B,
+                                     ldb,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     group_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
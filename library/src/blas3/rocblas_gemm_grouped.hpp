@@ -0,0 +1,513 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "Tensile/gemm.hpp"
+#include "handle.hpp"
+#include "utility.hpp"
+#include <vector>
+
+// threads of a gemm_grouped_kernel block in each dimension
+constexpr rocblas_int rocblas_gemm_grouped_dim()
+{
+    return 16;
+}
+
+// rows and columns of C of a tile, each thread computing (tile / dim)^2 elements
+constexpr rocblas_int rocblas_gemm_grouped_tile()
+{
+    return 64;
+}
+
+// columns of op(A), and rows of op(B), staged in shared memory at once
+constexpr rocblas_int rocblas_gemm_grouped_depth()
+{
+    return 16;
+}
+
+// resident blocks of gemm_grouped_kernel per compute unit
+constexpr rocblas_int rocblas_gemm_grouped_blocks_per_cu()
+{
+    return 4;
+}
+
+// with host arrays, problems of at least this many multiply-adds are computed by Tensile alone
+constexpr int64_t rocblas_gemm_grouped_tensile_min_flops()
+{
+    return int64_t(1) << 21;
+}
+
+// workspace of the tile offsets of the problems and the work counter, followed with host arrays
+// by the device copies of the pointers, sizes and leading dimensions of the problems
+inline size_t rocblas_gemm_grouped_workspace_size(rocblas_int group_count, bool host_arrays)
+{
+    size_t size = sizeof(int64_t) * (size_t(group_count) + 1) + sizeof(unsigned long long);
+    if(host_arrays)
+        size += (3 * sizeof(void*) + 6 * sizeof(rocblas_int)) * size_t(group_count);
+    return size;
+}
+
+// Grouped gemm: problem p of a group has its own sizes, leading dimensions and A, B and C
+// pointers. C of every problem is cut into tiles of TILE x TILE elements, and a persistent grid
+// takes tiles from a work counter until all the problems of the group are done.
+template <rocblas_int TILE>
+__device__ __host__ inline int64_t gemm_grouped_tile_count(rocblas_operation transA,
+                                                           rocblas_operation transB,
+                                                           rocblas_int       m,
+                                                           rocblas_int       n,
+                                                           rocblas_int       k,
+                                                           rocblas_int       lda,
+                                                           rocblas_int       ldb,
+                                                           rocblas_int       ldc)
+{
+    rocblas_int rows_a = transA == rocblas_operation_none ? m : k;
+    rocblas_int rows_b = transB == rocblas_operation_none ? k : n;
+
+    // problems with invalid sizes are skipped
+    if(m <= 0 || n <= 0 || k < 0 || lda < rows_a || ldb < rows_b || ldc < m)
+        return 0;
+    return int64_t((m - 1) / TILE + 1) * ((n - 1) / TILE + 1);
+}
+
+// C := alpha * op(A) * op(B) + beta * C on the tile of C of index tile, the tiles of a problem
+// being numbered down its columns. op(A) and op(B) are staged DEPTH columns and rows at a time in
+// sA and sB, of DEPTH * TILE elements each.
+template <rocblas_int DIM, rocblas_int TILE, rocblas_int DEPTH, typename T>
+ROCBLAS_KERNEL_ILF void gemm_grouped_tile_calc(int64_t           tile,
+                                               rocblas_operation transA,
+                                               rocblas_operation transB,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               T                 alpha,
+                                               const T*          A,
+                                               rocblas_int       lda,
+                                               const T*          B,
+                                               rocblas_int       ldb,
+                                               T                 beta,
+                                               T*                C,
+                                               rocblas_int       ldc,
+                                               T*                sA,
+                                               T*                sB)
+{
+    static constexpr rocblas_int W = TILE / DIM;
+
+    rocblas_int tx      = hipThreadIdx_x;
+    rocblas_int ty      = hipThreadIdx_y;
+    rocblas_int tid     = tx + ty * DIM;
+    int64_t     tiles_m = (m - 1) / TILE + 1;
+    rocblas_int row0    = rocblas_int(tile % tiles_m) * TILE;
+    rocblas_int col0    = rocblas_int(tile / tiles_m) * TILE;
+
+    // thread (tx, ty) computes the rows row0 + tx + i * DIM and columns col0 + ty + j * DIM
+    T acc[W][W];
+    for(rocblas_int i = 0; i < W; i++)
+        for(rocblas_int j = 0; j < W; j++)
+            acc[i][j] = T(0);
+
+    bool trans_a = transA != rocblas_operation_none;
+    bool trans_b = transB != rocblas_operation_none;
+    bool conj_a  = transA == rocblas_operation_conjugate_transpose;
+    bool conj_b  = transB == rocblas_operation_conjugate_transpose;
+
+    // A and B are not read when alpha is zero
+    for(rocblas_int l0 = 0; alpha != T(0) && l0 < k; l0 += DEPTH)
+    {
+        // consecutive threads read consecutive elements of A and B in memory
+        for(rocblas_int e = tid; e < TILE * DEPTH; e += DIM * DIM)
+        {
+            rocblas_int r = trans_a ? e / DEPTH : e % TILE;
+            rocblas_int l = trans_a ? e % DEPTH : e / TILE;
+            rocblas_int i = row0 + r;
+            rocblas_int j = l0 + l;
+            T           a = T(0);
+            if(i < m && j < k)
+            {
+                a = trans_a ? A[j + size_t(i) * lda] : A[i + size_t(j) * lda];
+                if(conj_a)
+                    a = conj(a);
+            }
+            sA[l * TILE + r] = a;
+        }
+
+        for(rocblas_int e = tid; e < TILE * DEPTH; e += DIM * DIM)
+        {
+            rocblas_int c = trans_b ? e % TILE : e / DEPTH;
+            rocblas_int l = trans_b ? e / TILE : e % DEPTH;
+            rocblas_int i = l0 + l;
+            rocblas_int j = col0 + c;
+            T           b = T(0);
+            if(i < k && j < n)
+            {
+                b = trans_b ? B[j + size_t(i) * ldb] : B[i + size_t(j) * ldb];
+                if(conj_b)
+                    b = conj(b);
+            }
+            sB[l * TILE + c] = b;
+        }
+        __syncthreads();
+
+        for(rocblas_int l = 0; l < DEPTH; l++)
+        {
+            T a[W], b[W];
+            for(rocblas_int i = 0; i < W; i++)
+                a[i] = sA[l * TILE + tx + i * DIM];
+            for(rocblas_int j = 0; j < W; j++)
+                b[j] = sB[l * TILE + ty + j * DIM];
+            for(rocblas_int i = 0; i < W; i++)
+                for(rocblas_int j = 0; j < W; j++)
+                    acc[i][j] += a[i] * b[j];
+        }
+        __syncthreads();
+    }
+
+    for(rocblas_int j = 0; j < W; j++)
+    {
+        rocblas_int col = col0 + ty + j * DIM;
+        for(rocblas_int i = 0; i < W; i++)
+        {
+            rocblas_int row = row0 + tx + i * DIM;
+            if(row < m && col < n)
+            {
+                T& c = C[row + size_t(col) * ldc];
+                c    = beta == T(0) ? alpha * acc[i][j] : alpha * acc[i][j] + beta * c;
+            }
+        }
+    }
+}
+
+// Computes the offset of the first tile of every problem in tile_offsets, whose last element is
+// the total number of tiles of the group, with one block of NB threads, and resets the work
+// counter of gemm_grouped_kernel.
+template <rocblas_int NB, rocblas_int TILE>
+ROCBLAS_KERNEL __launch_bounds__(NB) void
+    gemm_grouped_tiles_kernel(rocblas_operation   transA,
+                              rocblas_operation   transB,
+                              const rocblas_int*  m,
+                              const rocblas_int*  n,
+                              const rocblas_int*  k,
+                              const rocblas_int*  lda,
+                              const rocblas_int*  ldb,
+                              const rocblas_int*  ldc,
+                              rocblas_int         group_count,
+                              int64_t*            tile_offsets,
+                              unsigned long long* tile_counter)
+{
+    rocblas_int tid   = hipThreadIdx_x;
+    rocblas_int chunk = (group_count - 1) / NB + 1;
+    rocblas_int first = min(tid * chunk, group_count);
+    rocblas_int last  = min(first + chunk, group_count);
+
+    // each thread sums the tiles of a contiguous chunk of problems
+    auto tiles = [&](rocblas_int p) {
+        return gemm_grouped_tile_count<TILE>(
+            transA, transB, m[p], n[p], k[p], lda[p], ldb[p], ldc[p]);
+    };
+
+    int64_t sum = 0;
+    for(rocblas_int p = first; p < last; p++)
+        sum += tiles(p);
+
+    __shared__ int64_t sdata[NB];
+    sdata[tid] = sum;
+    __syncthreads();
+
+    // inclusive Hillis-Steele scan of the chunk sums
+    for(rocblas_int s = 1; s < NB; s *= 2)
+    {
+        int64_t v = tid >= s ? sdata[tid - s] : 0;
+        __syncthreads();
+        sdata[tid] += v;
+        __syncthreads();
+    }
+
+    int64_t offset = sdata[tid] - sum;
+    for(rocblas_int p = first; p < last; p++)
+    {
+        tile_offsets[p] = offset;
+        offset += tiles(p);
+    }
+
+    if(tid == NB - 1)
+    {
+        tile_offsets[group_count] = sdata[tid];
+        *tile_counter             = 0;
+    }
+}
+
+template <rocblas_int DIM, rocblas_int TILE, rocblas_int DEPTH, typename T, typename U>
+ROCBLAS_KERNEL __launch_bounds__(DIM* DIM) void
+    gemm_grouped_kernel(rocblas_operation   transA,
+                        rocblas_operation   transB,
+                        const rocblas_int*  m,
+                        const rocblas_int*  n,
+                        const rocblas_int*  k,
+                        U                   alpha_device_host,
+                        const T* const*     A,
+                        const rocblas_int*  lda,
+                        const T* const*     B,
+                        const rocblas_int*  ldb,
+                        U                   beta_device_host,
+                        T* const*           C,
+                        const rocblas_int*  ldc,
+                        rocblas_int         group_count,
+                        const int64_t*      tile_offsets,
+                        unsigned long long* tile_counter,
+                        bool                atomics)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    if(alpha == T(0) && beta == T(1))
+        return;
+
+    __shared__ T       sA[DEPTH * TILE];
+    __shared__ T       sB[DEPTH * TILE];
+    __shared__ int64_t next_tile;
+
+    rocblas_int tid         = hipThreadIdx_x + hipThreadIdx_y * DIM;
+    int64_t     total_tiles = tile_offsets[group_count];
+
+    // With atomics, the blocks take the next tile from the work counter. Otherwise block b takes
+    // the tiles b, b + gridDim.x, ... Each tile is computed by one block either way, so only the
+    // balance of the work depends on the mode.
+    for(int64_t step = hipBlockIdx_x;; step += hipGridDim_x)
+    {
+        int64_t tile = step;
+        if(atomics)
+        {
+            if(tid == 0)
+                next_tile = atomicAdd(tile_counter, 1ull);
+            __syncthreads();
+            tile = next_tile;
+            __syncthreads();
+        }
+
+        if(tile >= total_tiles)
+            break;
+
+        // the problem of the tile is the last one whose first tile is not after it
+        rocblas_int lo = 0, hi = group_count - 1;
+        while(lo < hi)
+        {
+            rocblas_int mid = (lo + hi + 1) / 2;
+            if(tile_offsets[mid] <= tile)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+        rocblas_int p = lo;
+
+        // A and B may be nullptr when alpha is 0
+        bool     load_ab = alpha != T(0);
+        const T* Ap      = cond_load_ptr_batch(load_ab, A, p, 0, 0);
+        const T* Bp      = cond_load_ptr_batch(load_ab, B, p, 0, 0);
+
+        gemm_grouped_tile_calc<DIM, TILE, DEPTH>(tile - tile_offsets[p],
+                                                 transA,
+                                                 transB,
+                                                 m[p],
+                                                 n[p],
+                                                 k[p],
+                                                 alpha,
+                                                 Ap,
+                                                 lda[p],
+                                                 Bp,
+                                                 ldb[p],
+                                                 beta,
+                                                 C[p],
+                                                 ldc[p],
+                                                 sA,
+                                                 sB);
+    }
+}
+
+/*! \brief rocblas_gemm_grouped_template
+    C_p := alpha * op(A_p) * op(B_p) + beta * C_p for the group_count problems p, whose sizes,
+    leading dimensions and pointers are read from device arrays. A first kernel computes the
+    offsets of the tiles of C of every problem, then a persistent kernel with a fixed number of
+    blocks per compute unit balances the tiles of all the problems across the device, so a group
+    of problems of different sizes runs as two launches. Unless atomics are allowed, the blocks
+    take the tiles in a fixed round robin order instead of from an atomic counter. workspace holds
+    rocblas_gemm_grouped_workspace_size(group_count, false) bytes.
+    ********************************************************************/
+template <typename T, typename U>
+rocblas_status rocblas_gemm_grouped_template(rocblas_handle     handle,
+                                             rocblas_operation  transA,
+                                             rocblas_operation  transB,
+                                             const rocblas_int* m,
+                                             const rocblas_int* n,
+                                             const rocblas_int* k,
+                                             const U*           alpha,
+                                             const T* const     A[],
+                                             const rocblas_int* lda,
+                                             const T* const     B[],
+                                             const rocblas_int* ldb,
+                                             const U*           beta,
+                                             T* const           C[],
+                                             const rocblas_int* ldc,
+                                             rocblas_int        group_count,
+                                             void*              workspace)
+{
+    // quick return
+    if(!group_count)
+        return rocblas_status_success;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == 0 && *beta == 1)
+        return rocblas_status_success;
+
+    static constexpr int DIM   = rocblas_gemm_grouped_dim();
+    static constexpr int TILE  = rocblas_gemm_grouped_tile();
+    static constexpr int DEPTH = rocblas_gemm_grouped_depth();
+    static constexpr int NB    = 1024;
+
+    hipStream_t rocblas_stream = handle->get_stream();
+    auto        tile_offsets   = (int64_t*)workspace;
+    auto        tile_counter   = (unsigned long long*)(tile_offsets + group_count + 1);
+
+    hipLaunchKernelGGL((gemm_grouped_tiles_kernel<NB, TILE>),
+                       dim3(1),
+                       dim3(NB),
+                       0,
+                       rocblas_stream,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       lda,
+                       ldb,
+                       ldc,
+                       group_count,
+                       tile_offsets,
+                       tile_counter);
+
+    // the total number of tiles is only known on the device, so the grid fills the device once,
+    // with at least one block on a device of unknown CU count, 0
+    dim3 grid(std::max(1, handle->getCUCount() * rocblas_gemm_grouped_blocks_per_cu()));
+    dim3 threads(DIM, DIM);
+    bool atomics = handle->atomics_mode == rocblas_atomics_allowed;
+
+#define gemm_grouped_KARGS(alpha_, beta_)                                                    \
+    grid, threads, 0, rocblas_stream, transA, transB, m, n, k, alpha_, A, lda, B, ldb, beta_, \
+        C, ldc, group_count, tile_offsets, tile_counter, atomics
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((gemm_grouped_kernel<DIM, TILE, DEPTH>),
+                           gemm_grouped_KARGS(alpha, beta));
+    else
+        hipLaunchKernelGGL((gemm_grouped_kernel<DIM, TILE, DEPTH>),
+                           gemm_grouped_KARGS(*alpha, *beta));
+#undef gemm_grouped_KARGS
+
+    return rocblas_status_success;
+}
+
+/*! \brief Checks the A, B and C of every problem of a group for NaN and Inf, A and B being
+    skipped when they are nullptr, as they may be when alpha is 0. With device arrays, the sizes
+    and pointers of the problems are copied to the host first. Each problem of a valid size is
+    checked as a gemm.
+    ********************************************************************/
+template <typename T>
+rocblas_status rocblas_gemm_grouped_check_numerics(const char*        function_name,
+                                                   rocblas_handle     handle,
+                                                   bool               host_arrays,
+                                                   rocblas_operation  transA,
+                                                   rocblas_operation  transB,
+                                                   const rocblas_int* m,
+                                                   const rocblas_int* n,
+                                                   const rocblas_int* k,
+                                                   const T* const     A[],
+                                                   const rocblas_int* lda,
+                                                   const T* const     B[],
+                                                   const rocblas_int* ldb,
+                                                   T* const           C[],
+                                                   const rocblas_int* ldc,
+                                                   rocblas_int        group_count,
+                                                   const int          check_numerics,
+                                                   bool               is_input)
+{
+    std::vector<rocblas_int> h_m, h_n, h_k, h_lda, h_ldb, h_ldc;
+    std::vector<const T*>    h_A, h_B;
+    std::vector<T*>          h_C;
+
+    if(!host_arrays)
+    {
+        hipStream_t rocblas_stream = handle->get_stream();
+        auto        copy           = [&](auto& dst, const auto* src) {
+            dst.resize(group_count);
+            size_t bytes = sizeof(dst[0]) * group_count;
+            return src ? hipMemcpyAsync(
+                       dst.data(), src, bytes, hipMemcpyDeviceToHost, rocblas_stream)
+                       : hipSuccess;
+        };
+        RETURN_IF_HIP_ERROR(copy(h_m, m));
+        RETURN_IF_HIP_ERROR(copy(h_n, n));
+        RETURN_IF_HIP_ERROR(copy(h_k, k));
+        RETURN_IF_HIP_ERROR(copy(h_lda, lda));
+        RETURN_IF_HIP_ERROR(copy(h_ldb, ldb));
+        RETURN_IF_HIP_ERROR(copy(h_ldc, ldc));
+        RETURN_IF_HIP_ERROR(copy(h_A, A));
+        RETURN_IF_HIP_ERROR(copy(h_B, B));
+        RETURN_IF_HIP_ERROR(copy(h_C, C));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(rocblas_stream));
+
+        m   = h_m.data();
+        n   = h_n.data();
+        k   = h_k.data();
+        lda = h_lda.data();
+        ldb = h_ldb.data();
+        ldc = h_ldc.data();
+        A   = A ? h_A.data() : nullptr;
+        B   = B ? h_B.data() : nullptr;
+        C   = h_C.data();
+    }
+
+    for(rocblas_int p = 0; p < group_count; p++)
+    {
+        // problems with invalid sizes are skipped by the kernels
+        if(!gemm_grouped_tile_count<1>(transA, transB, m[p], n[p], k[p], lda[p], ldb[p], ldc[p]))
+            continue;
+
+        rocblas_status check_numerics_status;
+        if(k[p] && A && B && A[p] && B[p])
+            check_numerics_status = rocblas_gemm_check_numerics(function_name,
+                                                                handle,
+                                                                transA,
+                                                                transB,
+                                                                m[p],
+                                                                n[p],
+                                                                k[p],
+                                                                A[p],
+                                                                lda[p],
+                                                                0,
+                                                                B[p],
+                                                                ldb[p],
+                                                                0,
+                                                                C[p],
+                                                                ldc[p],
+                                                                0,
+                                                                1,
+                                                                check_numerics,
+                                                                is_input);
+        else
+            check_numerics_status
+                = rocblas_internal_check_numerics_ge_matrix_template(function_name,
+                                                                     handle,
+                                                                     rocblas_operation_none,
+                                                                     m[p],
+                                                                     n[p],
+                                                                     C[p],
+                                                                     0,
+                                                                     ldc[p],
+                                                                     0,
+                                                                     1,
+                                                                     check_numerics,
+                                                                     is_input);
+        if(check_numerics_status != rocblas_status_success)
+            return check_numerics_status;
+    }
+    return rocblas_status_success;
+}
@@ -105,6 +105,60 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!n || !batch_count)
         return rocblas_status_success;
 
+#if BUILD_WITH_TENSILE
+    if(rocblas_use_syrk_herk_gemm(trans, n, k, offsetA, lda, offsetB, ldb, offsetC, ldc))
+    {
+        auto diag = [&](auto        alpha_h,
+                        auto        beta_h,
+                        rocblas_int nd,
+                        rocblas_int offA,
+                        rocblas_int offB,
+                        rocblas_int offC) {
+            return rocblas_internal_her2k_template<TWOK>(handle,
+                                                         uplo,
+                                                         trans,
+                                                         nd,
+                                                         k,
+                                                         alpha_h,
+                                                         AP,
+                                                         offA,
+                                                         lda,
+                                                         strideA,
+                                                         BP,
+                                                         offB,
+                                                         ldb,
+                                                         strideB,
+                                                         beta_h,
+                                                         CP,
+                                                         offC,
+                                                         ldc,
+                                                         strideC,
+                                                         batch_count);
+        };
+        return rocblas_syrk_herk_gemm_template<true, TWOK>(handle,
+                                                           uplo,
+                                                           trans,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           AP,
+                                                           offsetA,
+                                                           lda,
+                                                           strideA,
+                                                           BP,
+                                                           offsetB,
+                                                           ldb,
+                                                           strideB,
+                                                           beta,
+                                                           CP,
+                                                           offsetC,
+                                                           ldc,
+                                                           strideC,
+                                                           batch_count,
+                                                           diag);
+    }
+#endif
+
     static constexpr int her2k_SCALE_DIM_X = 128;
     static constexpr int her2k_SCALE_DIM_Y = 8;
     rocblas_int          gx                = (n - 1) / (her2k_SCALE_DIM_X) + 1;
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 #include "logging.hpp"
 #include "rocblas_symm.hpp"
+#include "rocblas_symm_hemm_gemm.hpp"
 #include "utility.hpp"
 
 namespace
@@ -37,7 +38,17 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        // large problems multiply a full copy of A with gemm when the device memory allows it
+        bool   use_gemm  = rocblas_use_symm_hemm_gemm(m, n, batch_count);
+        size_t arr_bytes = use_gemm ? sizeof(T*) * batch_count : 0;
+        size_t full_bytes
+            = use_gemm ? rocblas_symm_hemm_gemm_workspace_size<T>(side, m, n, batch_count) : 0;
+        if(handle->is_device_memory_size_query())
+        {
+            if(!use_gemm)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(full_bytes, arr_bytes);
+        }
 
         auto layer_mode = handle->layer_mode;
         if(layer_mode
@@ -134,6 +145,37 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
+#if BUILD_WITH_TENSILE
+        if(use_gemm)
+        {
+            // the tiled kernel runs when the device memory cannot hold the full copies of A
+            auto w_mem = handle->device_malloc(full_bytes, arr_bytes);
+            if(w_mem)
+                return rocblas_symm_hemm_gemm_template<false>(handle,
+                                                              side,
+                                                              uplo,
+                                                              m,
+                                                              n,
+                                                              alpha,
+                                                              A,
+                                                              offset_A,
+                                                              lda,
+                                                              stride_A,
+                                                              B,
+                                                              offset_B,
+                                                              ldb,
+                                                              stride_B,
+                                                              beta,
+                                                              C,
+                                                              offset_C,
+                                                              ldc,
+                                                              stride_C,
+                                                              batch_count,
+                                                              (T*)w_mem[0],
+                                                              (T**)w_mem[1]);
+        }
+#endif
+
         return rocblas_internal_symm_template<false>(handle,
                                                      side,
                                                      uplo,
@@ -0,0 +1,15 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_symm_hemm_gemm.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+rocblas_int rocblas_symm_hemm_gemm_min_size()
+{
+    static const rocblas_int min_size = [] {
+        const char* env = read_env("ROCBLAS_SYMM_HEMM_GEMM_MIN_SIZE");
+        return env && *env ? std::max(atoi(env), 1) : 256;
+    }();
+    return min_size;
+}
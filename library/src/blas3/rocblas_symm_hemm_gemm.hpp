@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas_symm.hpp"
+#include "utility.hpp"
+
+#if BUILD_WITH_TENSILE
+#include "Tensile/gemm.hpp"
+#endif
+
+/*! \brief rocblas_symm_hemm_gemm_min_size
+
+    \details
+    Smallest m and n for which symm and hemm, with their batched and strided_batched variants,
+    copy the triangle of A into a full matrix in device memory and multiply it with gemm instead
+    of running the tiled symm_hemm_kernel. The tiled kernel is still used when the device memory
+    of the handle cannot hold the full copies of A. Defaults to 256 and is overridden by the
+    environment variable ROCBLAS_SYMM_HEMM_GEMM_MIN_SIZE, which is read once per process.
+    scripts/performance/blas/symm_hemm_gemm_sweep.py measures the crossover.
+    ********************************************************************/
+rocblas_int rocblas_symm_hemm_gemm_min_size();
+
+inline bool rocblas_use_symm_hemm_gemm(rocblas_int m, rocblas_int n, rocblas_int batch_count)
+{
+#if BUILD_WITH_TENSILE
+    rocblas_int min_size = rocblas_symm_hemm_gemm_min_size();
+    return batch_count > 0 && m >= min_size && n >= min_size;
+#else
+    // without Tensile the tiled kernel always runs
+    return false;
+#endif
+}
+
+// bytes of the full copies of A, which is m x m on the left and n x n on the right
+template <typename T>
+inline size_t rocblas_symm_hemm_gemm_workspace_size(rocblas_side side,
+                                                    rocblas_int  m,
+                                                    rocblas_int  n,
+                                                    rocblas_int  batch_count)
+{
+    size_t k = side == rocblas_side_left ? m : n;
+    return sizeof(T) * k * k * batch_count;
+}
+
+#if BUILD_WITH_TENSILE
+
+/**
+  *  Writes the full n x n matrix W, with leading dimension n, of the symmetric, or Hermitian when
+  *  HERM, matrix stored in the uplo triangle of A. When HERM the imaginary part of the diagonal is
+  *  set to zero, as it is not referenced by hemm.
+  */
+template <bool HERM, rocblas_int DIM_X, rocblas_int DIM_Y, typename TConstPtr, typename T>
+ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void
+    rocblas_symm_hemm_symmetrize_kernel(bool           upper,
+                                        rocblas_int    n,
+                                        TConstPtr      AP_array,
+                                        ptrdiff_t      shift_a,
+                                        rocblas_int    lda,
+                                        rocblas_stride stride_a,
+                                        T*             W,
+                                        rocblas_stride stride_w)
+{
+    rocblas_int i = hipBlockIdx_x * DIM_X + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * DIM_Y + hipThreadIdx_y;
+    if(i >= n || j >= n)
+        return;
+
+    auto A = load_ptr_batch(AP_array, hipBlockIdx_z, shift_a, stride_a);
+    W += hipBlockIdx_z * stride_w;
+
+    // elements outside the stored triangle are read from their mirror
+    bool stored = upper ? i <= j : i >= j;
+    T    e      = stored ? A[i + size_t(j) * lda] : A[j + size_t(i) * lda];
+    if(HERM)
+    {
+        if(i == j)
+            e = std::real(e);
+        else if(!stored)
+            e = conj(e);
+    }
+
+    W[i + size_t(j) * n] = e;
+}
+
+/**
+  *  GEMM-backed path of symm and hemm for large m and n. The uplo triangle of A is copied into
+  *  the full matrices w_full, which are multiplied with B by gemm. In the batched variants, the
+  *  array w_arr of batch_count device pointers is set to the matrices of w_full.
+  */
+template <bool HERM, typename TScal, typename TConstPtr, typename TPtr, typename T>
+rocblas_status rocblas_symm_hemm_gemm_template(rocblas_handle handle,
+                                               rocblas_side   side,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    m,
+                                               rocblas_int    n,
+                                               TScal          alpha,
+                                               TConstPtr      AP,
+                                               rocblas_int    offsetA,
+                                               rocblas_int    lda,
+                                               rocblas_stride strideA,
+                                               TConstPtr      BP,
+                                               rocblas_int    offsetB,
+                                               rocblas_int    ldb,
+                                               rocblas_stride strideB,
+                                               TScal          beta,
+                                               TPtr           CP,
+                                               rocblas_int    offsetC,
+                                               rocblas_int    ldc,
+                                               rocblas_stride strideC,
+                                               rocblas_int    batch_count,
+                                               T*             w_full,
+                                               T**            w_arr)
+{
+    static constexpr bool BATCHED = std::is_pointer<std::remove_pointer_t<TConstPtr>>{};
+
+    // the symmetrize kernel is not needed when gemm returns early
+    if(handle->pointer_mode == rocblas_pointer_mode_host && *beta == 1 && *alpha == 0)
+        return rocblas_status_success;
+
+    bool           left        = side == rocblas_side_left;
+    rocblas_int    k           = left ? m : n;
+    rocblas_stride stride_full = rocblas_stride(k) * k;
+
+    static constexpr int symm_SYMMETRIZE_DIM_X = 64;
+    static constexpr int symm_SYMMETRIZE_DIM_Y = 4;
+    rocblas_int          gx                    = (k - 1) / symm_SYMMETRIZE_DIM_X + 1;
+    rocblas_int          gy                    = (k - 1) / symm_SYMMETRIZE_DIM_Y + 1;
+    dim3                 grid(gx, gy, batch_count);
+    dim3                 threads(symm_SYMMETRIZE_DIM_X, symm_SYMMETRIZE_DIM_Y);
+
+    hipLaunchKernelGGL(
+        (rocblas_symm_hemm_symmetrize_kernel<HERM, symm_SYMMETRIZE_DIM_X, symm_SYMMETRIZE_DIM_Y>),
+        grid,
+        threads,
+        0,
+        handle->get_stream(),
+        uplo == rocblas_fill_upper,
+        k,
+        AP,
+        offsetA,
+        lda,
+        strideA,
+        w_full,
+        stride_full);
+
+    // gemm reads the full A through the same pointer type as B
+    TConstPtr WP;
+    if constexpr(BATCHED)
+    {
+        setup_batched_array<256>(handle->get_stream(), w_full, stride_full, w_arr, batch_count);
+        WP = w_arr;
+    }
+    else
+        WP = w_full;
+
+    // clang-format off
+    if(left)
+        return rocblas_internal_gemm_template<BATCHED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, m, n, k, alpha,
+            WP, 0,       k,   stride_full,
+            BP, offsetB, ldb, strideB, beta,
+            CP, offsetC, ldc, strideC, batch_count);
+    else
+        return rocblas_internal_gemm_template<BATCHED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, m, n, k, alpha,
+            BP, offsetB, ldb, strideB,
+            WP, 0,       k,   stride_full, beta,
+            CP, offsetC, ldc, strideC, batch_count);
+    // clang-format on
+}
+
+#endif // BUILD_WITH_TENSILE
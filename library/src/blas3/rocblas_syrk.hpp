@@ -5,6 +5,7 @@
 #pragma once
 
 #include "handle.hpp"
+#include "rocblas_syrk_herk_gemm.hpp"
 
 template <typename T, typename U>
 ROCBLAS_KERNEL_ILF void syrk_scale_device(bool upper, rocblas_int n, T beta, U* C, rocblas_int ldc)
@@ -227,6 +228,56 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!n || !batch_count)
         return rocblas_status_success;
 
+#if BUILD_WITH_TENSILE
+    if(rocblas_use_syrk_herk_gemm(transA, n, k, offsetA, lda, offsetA, lda, offsetC, ldc))
+    {
+        auto diag = [&](auto        alpha_h,
+                        auto        beta_h,
+                        rocblas_int nd,
+                        rocblas_int offA,
+                        rocblas_int,
+                        rocblas_int offC) {
+            return rocblas_internal_syrk_template(handle,
+                                                  uplo,
+                                                  transA,
+                                                  nd,
+                                                  k,
+                                                  alpha_h,
+                                                  AP,
+                                                  offA,
+                                                  lda,
+                                                  strideA,
+                                                  beta_h,
+                                                  CP,
+                                                  offC,
+                                                  ldc,
+                                                  strideC,
+                                                  batch_count);
+        };
+        return rocblas_syrk_herk_gemm_template<false, false>(handle,
+                                                             uplo,
+                                                             transA,
+                                                             n,
+                                                             k,
+                                                             alpha,
+                                                             AP,
+                                                             offsetA,
+                                                             lda,
+                                                             strideA,
+                                                             AP,
+                                                             offsetA,
+                                                             lda,
+                                                             strideA,
+                                                             beta,
+                                                             CP,
+                                                             offsetC,
+                                                             ldc,
+                                                             strideC,
+                                                             batch_count,
+                                                             diag);
+    }
+#endif
+
     static constexpr int SYRK_SCALE_DIM_X = 128;
     static constexpr int SYRK_SCALE_DIM_Y = 8;
     rocblas_int          gx               = (n - 1) / (SYRK_SCALE_DIM_X) + 1;
@@ -0,0 +1,25 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_syrk_herk_gemm.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+rocblas_int rocblas_syrk_herk_gemm_min_n()
+{
+    static const rocblas_int min_n = [] {
+        const char* env = read_env("ROCBLAS_SYRK_HERK_GEMM_MIN_N");
+        return env && *env ? std::max(atoi(env), 0) : 1024;
+    }();
+    return min_n;
+}
+
+rocblas_int rocblas_syrk_herk_gemm_min_k()
+{
+    // k = 0 only scales C, which the syrk and herk kernels do in one pass
+    static const rocblas_int min_k = [] {
+        const char* env = read_env("ROCBLAS_SYRK_HERK_GEMM_MIN_K");
+        return env && *env ? std::max(atoi(env), 1) : 128;
+    }();
+    return min_k;
+}
@@ -0,0 +1,279 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "utility.hpp"
+#include <limits>
+
+#if BUILD_WITH_TENSILE
+#include "Tensile/gemm.hpp"
+#endif
+
+/*! \brief rocblas_syrk_herk_gemm_min_n
+
+    \details
+    Smallest n for which syrk, herk, syr2k, her2k and herkx, with their batched and
+    strided_batched variants, decompose C into diagonal blocks computed by their own kernels and
+    off-diagonal blocks computed by gemm, as long as k is at least rocblas_syrk_herk_gemm_min_k().
+    Defaults to 1024 and is overridden by the environment variable ROCBLAS_SYRK_HERK_GEMM_MIN_N,
+    which is read once per process. scripts/performance/blas/syrk_herk_gemm_sweep.py measures the
+    crossover.
+    ********************************************************************/
+rocblas_int rocblas_syrk_herk_gemm_min_n();
+
+/*! \brief rocblas_syrk_herk_gemm_min_k
+
+    \details
+    Smallest k for which the gemm decomposition of rocblas_syrk_herk_gemm_min_n() is used.
+    Defaults to 128 and is overridden by the environment variable ROCBLAS_SYRK_HERK_GEMM_MIN_K.
+    ********************************************************************/
+rocblas_int rocblas_syrk_herk_gemm_min_k();
+
+// largest diagonal block left to the syrk and herk kernels
+constexpr rocblas_int rocblas_syrk_herk_gemm_nb()
+{
+    return 256;
+}
+
+inline bool rocblas_use_syrk_herk_gemm(rocblas_operation trans,
+                                       rocblas_int       n,
+                                       rocblas_int       k,
+                                       rocblas_int       offsetA,
+                                       rocblas_int       lda,
+                                       rocblas_int       offsetB,
+                                       rocblas_int       ldb,
+                                       rocblas_int       offsetC,
+                                       rocblas_int       ldc)
+{
+    // the offsets of the blocks passed to gemm are rocblas_int
+    size_t      max_offset = std::numeric_limits<rocblas_int>::max();
+    rocblas_int cols       = trans == rocblas_operation_none ? k : n;
+    return n > rocblas_syrk_herk_gemm_nb() && n >= rocblas_syrk_herk_gemm_min_n()
+           && k >= rocblas_syrk_herk_gemm_min_k() && offsetA + size_t(cols) * lda <= max_offset
+           && offsetB + size_t(cols) * ldb <= max_offset
+           && offsetC + size_t(n) * ldc <= max_offset;
+}
+
+#if BUILD_WITH_TENSILE
+
+/**
+  *  Computes the uplo triangle of C = alpha * op(A) * op(B)**T + beta * C, where **T is **H when
+  *  HERM, and with TWOK adds alpha2 * op(B) * op(A)**T, alpha2 being conj(alpha) when HERM.
+  *  The triangle is split into two diagonal blocks, which are computed the same way, and the
+  *  off-diagonal block, computed by gemm. Diagonal blocks of at most rocblas_syrk_herk_gemm_nb()
+  *  are left to diag(nd, offsetA, offsetB, offsetC). alpha and beta are on the host.
+  */
+template <bool HERM, bool TWOK, typename T, typename TConstPtr, typename TPtr, typename DIAG>
+rocblas_status rocblas_syrk_herk_gemm_recursive(rocblas_handle    handle,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation trans,
+                                                rocblas_int       n,
+                                                rocblas_int       k,
+                                                const T*          alpha,
+                                                TConstPtr         AP,
+                                                rocblas_int       offsetA,
+                                                rocblas_int       lda,
+                                                rocblas_stride    strideA,
+                                                TConstPtr         BP,
+                                                rocblas_int       offsetB,
+                                                rocblas_int       ldb,
+                                                rocblas_stride    strideB,
+                                                const T*          beta,
+                                                TPtr              CP,
+                                                rocblas_int       offsetC,
+                                                rocblas_int       ldc,
+                                                rocblas_stride    strideC,
+                                                rocblas_int       batch_count,
+                                                DIAG&             diag)
+{
+    static constexpr rocblas_int nb = rocblas_syrk_herk_gemm_nb();
+    if(n <= nb)
+        return diag(n, offsetA, offsetB, offsetC);
+
+    rocblas_int a_s1 = trans == rocblas_operation_none ? 1 : lda;
+    rocblas_int b_s1 = trans == rocblas_operation_none ? 1 : ldb;
+
+    // the first diagonal block is a multiple of nb, so that only the last one is partial
+    rocblas_int n1 = ((n / 2 - 1) / nb + 1) * nb;
+    rocblas_int n2 = n - n1;
+
+    RETURN_IF_ROCBLAS_ERROR((rocblas_syrk_herk_gemm_recursive<HERM, TWOK>(handle,
+                                                                           uplo,
+                                                                           trans,
+                                                                           n1,
+                                                                           k,
+                                                                           alpha,
+                                                                           AP,
+                                                                           offsetA,
+                                                                           lda,
+                                                                           strideA,
+                                                                           BP,
+                                                                           offsetB,
+                                                                           ldb,
+                                                                           strideB,
+                                                                           beta,
+                                                                           CP,
+                                                                           offsetC,
+                                                                           ldc,
+                                                                           strideC,
+                                                                           batch_count,
+                                                                           diag)));
+
+    RETURN_IF_ROCBLAS_ERROR(
+        (rocblas_syrk_herk_gemm_recursive<HERM, TWOK>(handle,
+                                                      uplo,
+                                                      trans,
+                                                      n2,
+                                                      k,
+                                                      alpha,
+                                                      AP,
+                                                      offsetA + n1 * a_s1,
+                                                      lda,
+                                                      strideA,
+                                                      BP,
+                                                      offsetB + n1 * b_s1,
+                                                      ldb,
+                                                      strideB,
+                                                      beta,
+                                                      CP,
+                                                      offsetC + n1 + n1 * ldc,
+                                                      ldc,
+                                                      strideC,
+                                                      batch_count,
+                                                      diag)));
+
+    static constexpr bool BATCHED = std::is_pointer<std::remove_pointer_t<TConstPtr>>{};
+
+    rocblas_operation op
+        = HERM ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+    rocblas_operation trans_a = trans == rocblas_operation_none ? rocblas_operation_none : op;
+    rocblas_operation trans_b = trans == rocblas_operation_none ? op : rocblas_operation_none;
+
+    // the off-diagonal block is C[n1 : n, 0 : n1] in the lower triangle and C[0 : n1, n1 : n] in
+    // the upper one, the rows come from op(A) and the columns from op(B)
+    bool        lower = uplo == rocblas_fill_lower;
+    rocblas_int m     = lower ? n2 : n1;
+    rocblas_int nc    = lower ? n1 : n2;
+    rocblas_int row   = lower ? n1 : 0;
+    rocblas_int col   = lower ? 0 : n1;
+
+    // clang-format off
+    RETURN_IF_ROCBLAS_ERROR((rocblas_internal_gemm_template<BATCHED, T>(
+        handle, trans_a, trans_b, m, nc, k, alpha,
+        AP, offsetA + row * a_s1,           lda, strideA,
+        BP, offsetB + col * b_s1,           ldb, strideB, beta,
+        CP, offsetC + row + col * ldc,      ldc, strideC, batch_count)));
+    // clang-format on
+
+    if constexpr(TWOK)
+    {
+        const T alpha2 = HERM ? conj(*alpha) : *alpha;
+        const T one    = 1;
+
+        // clang-format off
+        RETURN_IF_ROCBLAS_ERROR((rocblas_internal_gemm_template<BATCHED, T>(
+            handle, trans_a, trans_b, m, nc, k, &alpha2,
+            BP, offsetB + row * b_s1,       ldb, strideB,
+            AP, offsetA + col * a_s1,       lda, strideA, &one,
+            CP, offsetC + row + col * ldc,  ldc, strideC, batch_count)));
+        // clang-format on
+    }
+
+    return rocblas_status_success;
+}
+
+/**
+  *  GEMM-backed path of syrk, herk, syr2k, her2k and herkx for large n and k, see
+  *  rocblas_syrk_herk_gemm_recursive. alpha and beta, which are real for herk and beta real for
+  *  her2k and herkx, are copied to the host in device pointer mode. diag(alpha, beta, nd,
+  *  offsetA, offsetB, offsetC) runs the routine's own kernels on a diagonal block of size nd, with
+  *  alpha and beta on the host.
+  */
+template <bool HERM,
+          bool TWOK,
+          typename TScal,
+          typename UScal,
+          typename TConstPtr,
+          typename TPtr,
+          typename DIAG>
+rocblas_status rocblas_syrk_herk_gemm_template(rocblas_handle    handle,
+                                               rocblas_fill      uplo,
+                                               rocblas_operation trans,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               TScal             alpha,
+                                               TConstPtr         AP,
+                                               rocblas_int       offsetA,
+                                               rocblas_int       lda,
+                                               rocblas_stride    strideA,
+                                               TConstPtr         BP,
+                                               rocblas_int       offsetB,
+                                               rocblas_int       ldb,
+                                               rocblas_stride    strideB,
+                                               UScal             beta,
+                                               TPtr              CP,
+                                               rocblas_int       offsetC,
+                                               rocblas_int       ldc,
+                                               rocblas_stride    strideC,
+                                               rocblas_int       batch_count,
+                                               DIAG              diag)
+{
+    using T
+        = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<TPtr>>>>;
+    using Ta = std::remove_cv_t<std::remove_pointer_t<TScal>>;
+    using Tb = std::remove_cv_t<std::remove_pointer_t<UScal>>;
+
+    Ta alpha_h = 0;
+    Tb beta_h;
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        if(k)
+            RETURN_IF_HIP_ERROR(hipMemcpy(&alpha_h, alpha, sizeof(Ta), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(&beta_h, beta, sizeof(Tb), hipMemcpyDeviceToHost));
+    }
+    else
+    {
+        if(k)
+            alpha_h = *alpha;
+        beta_h = *beta;
+    }
+
+    if((!alpha_h || !k) && beta_h == 1)
+        return rocblas_status_success;
+
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    const T alpha_t = alpha_h;
+    const T beta_t  = beta_h;
+
+    auto diag_block = [&](rocblas_int nd, rocblas_int offA, rocblas_int offB, rocblas_int offC) {
+        return diag((const Ta*)&alpha_h, (const Tb*)&beta_h, nd, offA, offB, offC);
+    };
+
+    return rocblas_syrk_herk_gemm_recursive<HERM, TWOK>(handle,
+                                                        uplo,
+                                                        trans,
+                                                        n,
+                                                        k,
+                                                        &alpha_t,
+                                                        AP,
+                                                        offsetA,
+                                                        lda,
+                                                        strideA,
+                                                        BP,
+                                                        offsetB,
+                                                        ldb,
+                                                        strideB,
+                                                        &beta_t,
+                                                        CP,
+                                                        offsetC,
+                                                        ldc,
+                                                        strideC,
+                                                        batch_count,
+                                                        diag_block);
+}
+
+#endif // BUILD_WITH_TENSILE
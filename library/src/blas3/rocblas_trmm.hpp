@@ -136,10 +136,14 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_lNx_kernel(rocblas_fi
                                                                       T_lda          offset_a,
                                                                       T_lda          ldda,
                                                                       rocblas_stride stride_a,
-                                                                      TPtr*          B_arg,
+                                                                      TConstPtr*     B_arg,
                                                                       T_lda          offset_b,
                                                                       T_lda          lddb,
-                                                                      rocblas_stride stride_b)
+                                                                      rocblas_stride stride_b,
+                                                                      TPtr*          C_arg,
+                                                                      T_lda          offset_c,
+                                                                      T_lda          lddc,
+                                                                      rocblas_stride stride_c)
 {
     const int tx = threadIdx.x;
     const int ty = threadIdx.y;
@@ -150,10 +154,12 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_lNx_kernel(rocblas_fi
         return;
     auto* A = load_ptr_batch(A_arg, hipBlockIdx_z, offset_a, stride_a);
     auto* B = load_ptr_batch(B_arg, hipBlockIdx_z, offset_b, stride_b);
+    auto* C = load_ptr_batch(C_arg, hipBlockIdx_z, offset_c, stride_c);
 
     const int nblocks = (n + NB - 1) / NB;
     const int nn      = (bx < nblocks - 1) ? NB : n - (nblocks - 1) * NB;
     B += bx * NB * lddb;
+    C += bx * NB * lddc;
 
     __shared__ T sA[NB * NB];
     __shared__ T sB[NB * NB];
@@ -194,7 +200,7 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_lNx_kernel(rocblas_fi
         accumulator += sA[i * NB + tx] * sB[ty * NB + i];
     accumulator *= alpha;
     if(ty < nn && tx < m)
-        B[ty * lddb + tx] = accumulator;
+        C[ty * lddc + tx] = accumulator;
 }
 
 // left, Trans|ConjTrans
@@ -215,10 +221,14 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_lTx_kernel(rocblas_fi
                                                                       T_lda          offset_a,
                                                                       T_lda          ldda,
                                                                       rocblas_stride stride_a,
-                                                                      TPtr*          B_arg,
+                                                                      TConstPtr*     B_arg,
                                                                       T_lda          offset_b,
                                                                       T_lda          lddb,
-                                                                      rocblas_stride stride_b)
+                                                                      rocblas_stride stride_b,
+                                                                      TPtr*          C_arg,
+                                                                      T_lda          offset_c,
+                                                                      T_lda          lddc,
+                                                                      rocblas_stride stride_c)
 {
     const int tx = threadIdx.x;
     const int ty = threadIdx.y;
@@ -229,10 +239,12 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_lTx_kernel(rocblas_fi
         return;
     auto* A = load_ptr_batch(A_arg, hipBlockIdx_z, offset_a, stride_a);
     auto* B = load_ptr_batch(B_arg, hipBlockIdx_z, offset_b, stride_b);
+    auto* C = load_ptr_batch(C_arg, hipBlockIdx_z, offset_c, stride_c);
 
     const int nblocks = (n + NB - 1) / NB;
     const int nn      = (bx < nblocks - 1) ? NB : n - (nblocks - 1) * NB;
     B += bx * NB * lddb;
+    C += bx * NB * lddc;
 
     __shared__ T sA[NB * NB];
     __shared__ T sB[NB * NB];
@@ -284,9 +296,9 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_lTx_kernel(rocblas_fi
         accumulator += sA[i * NB + tx] * sB[ty * NB + i];
     accumulator *= alpha;
 
-    // write B
+    // write C
     if(ty < nn && tx < m)
-        B[ty * lddb + tx] = accumulator;
+        C[ty * lddc + tx] = accumulator;
 }
 
 // right NoTrans
@@ -306,10 +318,14 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_rNx_kernel(rocblas_fi
                                                                       T_lda          offset_a,
                                                                       T_lda          ldda,
                                                                       rocblas_stride stride_a,
-                                                                      TPtr*          B_arg,
+                                                                      TConstPtr*     B_arg,
                                                                       T_lda          offset_b,
                                                                       T_lda          lddb,
-                                                                      rocblas_stride stride_b)
+                                                                      rocblas_stride stride_b,
+                                                                      TPtr*          C_arg,
+                                                                      T_lda          offset_c,
+                                                                      T_lda          lddc,
+                                                                      rocblas_stride stride_c)
 {
     const int tx = threadIdx.x;
     const int ty = threadIdx.y;
@@ -320,10 +336,12 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_rNx_kernel(rocblas_fi
         return;
     auto* A = load_ptr_batch(A_arg, hipBlockIdx_z, offset_a, stride_a);
     auto* B = load_ptr_batch(B_arg, hipBlockIdx_z, offset_b, stride_b);
+    auto* C = load_ptr_batch(C_arg, hipBlockIdx_z, offset_c, stride_c);
 
     const int nblocks = (m + NB - 1) / NB;
     const int mm      = (bx < nblocks - 1) ? NB : m - (nblocks - 1) * NB;
     B += bx * NB;
+    C += bx * NB;
 
     __shared__ T sA[NB * NB];
     __shared__ T sB[NB * NB];
@@ -363,9 +381,9 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_rNx_kernel(rocblas_fi
     for(int i = 0; i < NB; i++)
         accumulator += sB[i * NB + tx] * sA[ty * NB + i];
     accumulator *= alpha;
-    // write B
+    // write C
     if(ty < n && tx < mm)
-        B[ty * lddb + tx] = accumulator;
+        C[ty * lddc + tx] = accumulator;
 }
 
 // right, transpose_and_conjugate_transpose
@@ -386,10 +404,14 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_rTx_kernel(rocblas_fi
                                                                       T_lda          offset_a,
                                                                       T_lda          ldda,
                                                                       rocblas_stride stride_a,
-                                                                      TPtr*          B_arg,
+                                                                      TConstPtr*     B_arg,
                                                                       T_lda          offset_b,
                                                                       T_lda          lddb,
-                                                                      rocblas_stride stride_b)
+                                                                      rocblas_stride stride_b,
+                                                                      TPtr*          C_arg,
+                                                                      T_lda          offset_c,
+                                                                      T_lda          lddc,
+                                                                      rocblas_stride stride_c)
 {
     const int tx = threadIdx.x;
     const int ty = threadIdx.y;
@@ -400,10 +422,12 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_rTx_kernel(rocblas_fi
         return;
     auto* A = load_ptr_batch(A_arg, hipBlockIdx_z, offset_a, stride_a);
     auto* B = load_ptr_batch(B_arg, hipBlockIdx_z, offset_b, stride_b);
+    auto* C = load_ptr_batch(C_arg, hipBlockIdx_z, offset_c, stride_c);
 
     const int nblocks = (m + NB - 1) / NB;
     const int mm      = (bx < nblocks - 1) ? NB : m - (nblocks - 1) * NB;
     B += bx * NB;
+    C += bx * NB;
 
     __shared__ T sA[NB * NB];
     __shared__ T sB[NB * NB];
@@ -452,9 +476,9 @@ ROCBLAS_KERNEL __launch_bounds__(NB* NB) void rocblas_trmm_rTx_kernel(rocblas_fi
     for(int i = 0; i < NB; i++)
         accumulator += sB[i * NB + tx] * sA[i * NB + ty];
     accumulator *= alpha;
-    // write B
+    // write C
     if(ty < n && tx < mm)
-        B[ty * lddb + tx] = accumulator;
+        C[ty * lddc + tx] = accumulator;
 }
 
 // clang-format off
@@ -468,7 +492,8 @@ rocblas_status trmm_template_lNx(rocblas_handle   handle,
                        TScal*           alpha,
                        rocblas_stride   stride_alpha,
                        TConstPtr*       dA, T_lda offset_a, T_lda ldda, rocblas_stride stride_a,
-                       TPtr*            dB, T_lda offset_b, T_lda lddb, rocblas_stride stride_b,
+                       TConstPtr*       dB, T_lda offset_b, T_lda lddb, rocblas_stride stride_b,
+                       TPtr*            dC, T_lda offset_c, T_lda lddc, rocblas_stride stride_c,
                        rocblas_int      batch_count)
 {
     hipStream_t rocblas_stream = handle->get_stream();
@@ -481,13 +506,15 @@ rocblas_status trmm_template_lNx(rocblas_handle   handle,
                            uplo, diag,
                            m, n, alpha, stride_alpha,
                            dA, offset_a, ldda, stride_a,
-                           dB, offset_b, lddb, stride_b);
+                           dB, offset_b, lddb, stride_b,
+                           dC, offset_c, lddc, stride_c);
     else
         hipLaunchKernelGGL((rocblas_trmm_lNx_kernel<NB, T>), grid, threads, 0, rocblas_stream,
                            uplo, diag,
                            m, n, *alpha, stride_alpha,
                            dA, offset_a, ldda, stride_a,
-                           dB, offset_b, lddb, stride_b);
+                           dB, offset_b, lddb, stride_b,
+                           dC, offset_c, lddc, stride_c);
 
     return rocblas_status_success;
 }
@@ -502,7 +529,8 @@ rocblas_status trmm_template_lTx(rocblas_handle   handle,
                        TScal*           alpha,
                        rocblas_stride   stride_alpha,
                        TConstPtr*       dA, T_lda offset_a, T_lda ldda, rocblas_stride stride_a,
-                       TPtr*            dB, T_lda offset_b, T_lda lddb, rocblas_stride stride_b,
+                       TConstPtr*       dB, T_lda offset_b, T_lda lddb, rocblas_stride stride_b,
+                       TPtr*            dC, T_lda offset_c, T_lda lddc, rocblas_stride stride_c,
                        rocblas_int      batch_count)
 {
     hipStream_t rocblas_stream = handle->get_stream();
@@ -515,13 +543,15 @@ rocblas_status trmm_template_lTx(rocblas_handle   handle,
                            uplo, diag,
                            m, n, alpha, stride_alpha,
                            dA, offset_a, ldda, stride_a,
-                           dB, offset_b, lddb, stride_b);
+                           dB, offset_b, lddb, stride_b,
+                           dC, offset_c, lddc, stride_c);
     else
         hipLaunchKernelGGL((rocblas_trmm_lTx_kernel<NB, CONJ, T>), grid, threads, 0, rocblas_stream,
                            uplo, diag,
                            m, n, *alpha, stride_alpha,
                            dA, offset_a, ldda, stride_a,
-                           dB, offset_b, lddb, stride_b);
+                           dB, offset_b, lddb, stride_b,
+                           dC, offset_c, lddc, stride_c);
 
     return rocblas_status_success;
 }
@@ -536,7 +566,8 @@ rocblas_status trmm_template_rNx(rocblas_handle   handle,
                        TScal*           alpha,
                        rocblas_stride   stride_alpha,
                        TConstPtr*       dA, T_lda offset_a, T_lda ldda, rocblas_stride stride_a,
-                       TPtr*            dB, T_lda offset_b, T_lda lddb, rocblas_stride stride_b,
+                       TConstPtr*       dB, T_lda offset_b, T_lda lddb, rocblas_stride stride_b,
+                       TPtr*            dC, T_lda offset_c, T_lda lddc, rocblas_stride stride_c,
                        rocblas_int      batch_count)
 {
     hipStream_t rocblas_stream = handle->get_stream();
@@ -549,13 +580,15 @@ rocblas_status trmm_template_rNx(rocblas_handle   handle,
                            uplo, diag,
                            m, n, alpha, stride_alpha,
                            dA, offset_a, ldda, stride_a,
-                           dB, offset_b, lddb, stride_b);
+                           dB, offset_b, lddb, stride_b,
+                           dC, offset_c, lddc, stride_c);
     else
         hipLaunchKernelGGL((rocblas_trmm_rNx_kernel<NB, T>), grid, threads, 0, rocblas_stream,
                            uplo, diag,
                            m, n, *alpha, stride_alpha,
                            dA, offset_a, ldda, stride_a,
-                           dB, offset_b, lddb, stride_b);
+                           dB, offset_b, lddb, stride_b,
+                           dC, offset_c, lddc, stride_c);
 
     return rocblas_status_success;
 }
@@ -570,7 +603,8 @@ rocblas_status trmm_template_rTx(rocblas_handle   handle,
                        TScal*           alpha,
                        rocblas_stride   stride_alpha,
                        TConstPtr*       dA, T_lda offset_a, T_lda ldda, rocblas_stride stride_a,
-                       TPtr*            dB, T_lda offset_b, T_lda lddb, rocblas_stride stride_b,
+                       TConstPtr*       dB, T_lda offset_b, T_lda lddb, rocblas_stride stride_b,
+                       TPtr*            dC, T_lda offset_c, T_lda lddc, rocblas_stride stride_c,
                        rocblas_int      batch_count)
 {
     hipStream_t rocblas_stream = handle->get_stream();
@@ -583,13 +617,15 @@ rocblas_status trmm_template_rTx(rocblas_handle   handle,
                            uplo, diag,
                            m, n, alpha, stride_alpha,
                            dA, offset_a, ldda, stride_a,
-                           dB, offset_b, lddb, stride_b);
+                           dB, offset_b, lddb, stride_b,
+                           dC, offset_c, lddc, stride_c);
     else
         hipLaunchKernelGGL((rocblas_trmm_rTx_kernel<NB, CONJ, T>), grid, threads, 0, rocblas_stream,
                            uplo, diag,
                            m, n, *alpha, stride_alpha,
                            dA, offset_a, ldda, stride_a,
-                           dB, offset_b, lddb, stride_b);
+                           dB, offset_b, lddb, stride_b,
+                           dC, offset_c, lddc, stride_c);
 
     return rocblas_status_success;
 }
@@ -605,7 +641,8 @@ rocblas_status rocblas_trmm_small(rocblas_handle    handle,
                         TScal*            alpha,
                         rocblas_stride    stride_alpha,
                         TConstPtr*        dA, T_lda offset_a, T_lda ldda, rocblas_stride stride_a,
-                        TPtr*             dB, T_lda offset_b, T_lda lddb, rocblas_stride stride_b,
+                        TConstPtr*        dB, T_lda offset_b, T_lda lddb, rocblas_stride stride_b,
+                        TPtr*             dC, T_lda offset_c, T_lda lddc, rocblas_stride stride_c,
                         rocblas_int       batch_count)
 {
     rocblas_int shape = -1;
@@ -626,32 +663,38 @@ rocblas_status rocblas_trmm_small(rocblas_handle    handle,
         return trmm_template_lNx<STOPPING_NB, T>(handle, uplo, diag,
                                                m, n, alpha, stride_alpha,
                                                dA, offset_a, ldda, stride_a,
-                                               dB, offset_b, lddb, stride_b, batch_count);
+                                               dB, offset_b, lddb, stride_b,
+                                               dC, offset_c, lddc, stride_c, batch_count);
     else if (shape == 1) // lTx, left, Transpose
         return trmm_template_lTx<STOPPING_NB, false, T>(handle, uplo, diag,
                                                m, n, alpha, stride_alpha,
                                                dA, offset_a, ldda, stride_a,
-                                               dB, offset_b, lddb, stride_b, batch_count);
+                                               dB, offset_b, lddb, stride_b,
+                                               dC, offset_c, lddc, stride_c, batch_count);
     else if (shape == 2) // lCx, left, ConjTrans
         return trmm_template_lTx<STOPPING_NB, true, T>(handle, uplo, diag,
                                                m, n, alpha, stride_alpha,
                                                dA, offset_a, ldda, stride_a,
-                                               dB, offset_b, lddb, stride_b, batch_count);
+                                               dB, offset_b, lddb, stride_b,
+                                               dC, offset_c, lddc, stride_c, batch_count);
     else if (shape == 3) // rNx, right, NoTrans
         return trmm_template_rNx<STOPPING_NB, T>(handle, uplo, diag,
                                                m, n, alpha, stride_alpha,
                                                dA, offset_a, ldda, stride_a,
-                                               dB, offset_b, lddb, stride_b, batch_count);
+                                               dB, offset_b, lddb, stride_b,
+                                               dC, offset_c, lddc, stride_c, batch_count);
     else if (shape == 4) // rTx, right, Transpose
         return trmm_template_rTx<STOPPING_NB, false, T>(handle, uplo, diag,
                                                m, n, alpha, stride_alpha,
                                                dA, offset_a, ldda, stride_a,
-                                               dB, offset_b, lddb, stride_b, batch_count);
+                                               dB, offset_b, lddb, stride_b,
+                                               dC, offset_c, lddc, stride_c, batch_count);
     else if (shape == 5) // rCx, right, ConjTrans
         return trmm_template_rTx<STOPPING_NB, true, T>(handle, uplo, diag,
                                                m, n, alpha, stride_alpha,
                                                dA, offset_a, ldda, stride_a,
-                                               dB, offset_b, lddb, stride_b, batch_count);
+                                               dB, offset_b, lddb, stride_b,
+                                               dC, offset_c, lddc, stride_c, batch_count);
     else
         return rocblas_status_internal_error;
 }
@@ -689,6 +732,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status rocblas_internal_trmm_recursive_
         return rocblas_trmm_small<STOPPING_NB, T>(handle, side, uplo, trans_a, diag,
                                                   m, n, alpha, stride_alpha,
                                                   dA, offset_a, ldda, stride_a,
+                                     (TConstPtr*) dB, offset_b, lddb, stride_b,
                                                   dB, offset_b, lddb, stride_b, batch_count);
     }
 
@@ -893,4 +937,181 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status rocblas_internal_trmm_recursive_
     }
     return status;
 }
+
+/**
+  *  Out-of-place trmm, C = alpha * op(A) * B or C = alpha * B * op(A), B being left unchanged. The
+  *  triangle of op(A) is split into its two diagonal blocks and its off-diagonal block. Each block
+  *  of C is first written by the trmm of its diagonal block of A, recursively down to the
+  *  STOPPING_NB kernels, and then updated by the gemm of the off-diagonal block. As B is only read,
+  *  the blocks do not depend on each other, unlike the in-place recursion which must consume each
+  *  block of B before overwriting it. alpha is on the host and C must not overlap A or B.
+  */
+template <int STOPPING_NB, bool BATCHED, typename T, typename TScal, typename TConstPtr, typename TPtr, typename T_lda>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status rocblas_internal_trmm_outofplace_template(rocblas_handle    handle,
+                                     rocblas_side      side,
+                                     rocblas_fill      uplo,
+                                     rocblas_operation trans_a,
+                                     rocblas_diagonal  diag,
+                                     rocblas_int       m,
+                                     rocblas_int       n,
+                                     TScal*            alpha,
+                                     rocblas_stride    stride_alpha,
+                                     TConstPtr*        dA,
+                                     T_lda             offset_a,
+                                     T_lda             ldda,
+                                     rocblas_stride    stride_a,
+                                     TConstPtr*        dB,
+                                     T_lda             offset_b,
+                                     T_lda             lddb,
+                                     rocblas_stride    stride_b,
+                                     TPtr*             dC,
+                                     T_lda             offset_c,
+                                     T_lda             lddc,
+                                     rocblas_stride    stride_c,
+                                     rocblas_int       batch_count)
+{
+    const T one = 1.0;
+
+    bool        left   = side == rocblas_side_left;
+    rocblas_int nrow_a = left ? m : n;
+    // stopping condition
+    if(nrow_a <= STOPPING_NB)
+    {
+        return rocblas_trmm_small<STOPPING_NB, T>(handle, side, uplo, trans_a, diag,
+                                                  m, n, alpha, stride_alpha,
+                                                  dA, offset_a, ldda, stride_a,
+                                                  dB, offset_b, lddb, stride_b,
+                                                  dC, offset_c, lddc, stride_c, batch_count);
+    }
+
+    // op(A) is lower triangular for lN and lT/lC of an upper A, upper triangular otherwise
+    bool op_lower = (uplo == rocblas_fill_lower) == (trans_a == rocblas_operation_none);
+
+    const rocblas_int k1 = rocblas_get_trmm_recursive_nb(nrow_a);
+    const rocblas_int k2 = nrow_a - k1;
+
+    // op(A)[i : i + ., j : j + .] starts at A[i, j], or at A[j, i] when op transposes A
+    auto op_offset_a = [&](T_lda i, T_lda j) {
+        return trans_a == rocblas_operation_none ? offset_a + i + j * ldda
+                                                 : offset_a + j + i * ldda;
+    };
+
+    // rows of B and C in left mode, columns in right mode
+    auto offset_bc = [&](T_lda offset, T_lda ld, T_lda k) {
+        return left ? offset + k : offset + k * ld;
+    };
+
+    RETURN_IF_ROCBLAS_ERROR((rocblas_internal_trmm_outofplace_template<STOPPING_NB, BATCHED, T>(handle, side, uplo, trans_a, diag,
+                                 left ? k1 : m, left ? n : k1, alpha, stride_alpha,
+                                 dA, offset_a, ldda, stride_a,
+                                 dB, offset_b, lddb, stride_b,
+                                 dC, offset_c, lddc, stride_c, batch_count)));
+
+    RETURN_IF_ROCBLAS_ERROR((rocblas_internal_trmm_outofplace_template<STOPPING_NB, BATCHED, T>(handle, side, uplo, trans_a, diag,
+                                 left ? k2 : m, left ? n : k2, alpha, stride_alpha,
+                                 dA, offset_a + k1 + k1 * ldda, ldda, stride_a,
+                                 dB, offset_bc(offset_b, lddb, k1), lddb, stride_b,
+                                 dC, offset_bc(offset_c, lddc, k1), lddc, stride_c, batch_count)));
+
+    // the off-diagonal block op(A)[r0 : r0 + kr, c0 : c0 + kc] is below the diagonal when op(A)
+    // is lower triangular and above it otherwise
+    rocblas_int r0 = op_lower ? k1 : 0;
+    rocblas_int c0 = op_lower ? 0 : k1;
+    rocblas_int kr = op_lower ? k2 : k1;
+    rocblas_int kc = op_lower ? k1 : k2;
+
+    if(left)
+    {
+        // C[r0 : r0 + kr, :] += alpha * op(A)[r0 : r0 + kr, c0 : c0 + kc] * B[c0 : c0 + kc, :]
+        RETURN_IF_ROCBLAS_ERROR((rocblas_internal_gemm_template<BATCHED, T>(handle, trans_a, rocblas_operation_none,
+                                     kr, n, kc, alpha,
+                                     dA, op_offset_a(r0, c0),           ldda, stride_a,
+                                     dB, offset_bc(offset_b, lddb, c0), lddb, stride_b, &one,
+                                     dC, offset_bc(offset_c, lddc, r0), lddc, stride_c, batch_count)));
+    }
+    else
+    {
+        // C[:, c0 : c0 + kc] += alpha * B[:, r0 : r0 + kr] * op(A)[r0 : r0 + kr, c0 : c0 + kc]
+        RETURN_IF_ROCBLAS_ERROR((rocblas_internal_gemm_template<BATCHED, T>(handle, rocblas_operation_none, trans_a,
+                                     m, kc, kr, alpha,
+                                     dB, offset_bc(offset_b, lddb, r0), lddb, stride_b,
+                                     dA, op_offset_a(r0, c0),           ldda, stride_a, &one,
+                                     dC, offset_bc(offset_c, lddc, c0), lddc, stride_c, batch_count)));
+    }
+
+    return rocblas_status_success;
+}
 // clang-format on
+
+/**
+  *  Runs the out-of-place trmm, or the in-place one when C is B, which requires ldb == ldc and
+  *  stride_b == stride_c. alpha is on the host and is not 0.
+  */
+template <int STOPPING_NB,
+          bool BATCHED,
+          typename T,
+          typename TConstPtr,
+          typename TPtr,
+          typename T_lda>
+rocblas_status rocblas_trmm_outofplace_template(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation trans_a,
+                                                rocblas_diagonal  diag,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                const T*          alpha,
+                                                TConstPtr*        dA,
+                                                T_lda             ldda,
+                                                rocblas_stride    stride_a,
+                                                TConstPtr*        dB,
+                                                T_lda             lddb,
+                                                rocblas_stride    stride_b,
+                                                TPtr*             dC,
+                                                T_lda             lddc,
+                                                rocblas_stride    stride_c,
+                                                rocblas_int       batch_count)
+{
+    if((const void*)dB == (const void*)dC)
+        return rocblas_internal_trmm_recursive_template<STOPPING_NB, BATCHED, T>(handle,
+                                                                                 side,
+                                                                                 uplo,
+                                                                                 trans_a,
+                                                                                 diag,
+                                                                                 m,
+                                                                                 n,
+                                                                                 alpha,
+                                                                                 0,
+                                                                                 dA,
+                                                                                 T_lda(0),
+                                                                                 ldda,
+                                                                                 stride_a,
+                                                                                 dC,
+                                                                                 T_lda(0),
+                                                                                 lddc,
+                                                                                 stride_c,
+                                                                                 batch_count);
+
+    return rocblas_internal_trmm_outofplace_template<STOPPING_NB, BATCHED, T>(handle,
+                                                                              side,
+                                                                              uplo,
+                                                                              trans_a,
+                                                                              diag,
+                                                                              m,
+                                                                              n,
+                                                                              alpha,
+                                                                              0,
+                                                                              dA,
+                                                                              T_lda(0),
+                                                                              ldda,
+                                                                              stride_a,
+                                                                              dB,
+                                                                              T_lda(0),
+                                                                              lddb,
+                                                                              stride_b,
+                                                                              dC,
+                                                                              T_lda(0),
+                                                                              lddc,
+                                                                              stride_c,
+                                                                              batch_count);
+}
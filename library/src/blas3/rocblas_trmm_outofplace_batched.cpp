@@ -0,0 +1,277 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_trmm.hpp"
+#include "utility.hpp"
+
+#define STRMM_OUTOFPLACE_BATCHED_STOPPING_NB 32
+#define DTRMM_OUTOFPLACE_BATCHED_STOPPING_NB 32
+#define CTRMM_OUTOFPLACE_BATCHED_STOPPING_NB 16
+#define ZTRMM_OUTOFPLACE_BATCHED_STOPPING_NB 16
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_trmm_outofplace_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_trmm_outofplace_batched_name<float>[]
+        = "rocblas_strmm_outofplace_batched";
+    template <>
+    constexpr char rocblas_trmm_outofplace_batched_name<double>[]
+        = "rocblas_dtrmm_outofplace_batched";
+    template <>
+    constexpr char rocblas_trmm_outofplace_batched_name<rocblas_float_complex>[]
+        = "rocblas_ctrmm_outofplace_batched";
+    template <>
+    constexpr char rocblas_trmm_outofplace_batched_name<rocblas_double_complex>[]
+        = "rocblas_ztrmm_outofplace_batched";
+
+    template <int STOPPING_NB, typename T>
+    rocblas_status rocblas_trmm_outofplace_batched_impl(rocblas_handle    handle,
+                                                        rocblas_side      side,
+                                                        rocblas_fill      uplo,
+                                                        rocblas_operation transa,
+                                                        rocblas_diagonal  diag,
+                                                        rocblas_int       m,
+                                                        rocblas_int       n,
+                                                        const T*          alpha,
+                                                        const T* const    a[],
+                                                        rocblas_int       lda,
+                                                        const T* const    b[],
+                                                        rocblas_int       ldb,
+                                                        T* const          c[],
+                                                        rocblas_int       ldc,
+                                                        rocblas_int       batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // Copy alpha and beta to host if on device. This is because gemm is called and it
+        // requires alpha and beta to be on host
+        T        alpha_h, beta_h;
+        const T* beta = nullptr;
+        RETURN_IF_ROCBLAS_ERROR(
+            copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, m && n));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+               & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                  | rocblas_layer_mode_log_profile)
+           && (!handle->is_device_memory_size_query()))
+        {
+            auto side_letter   = rocblas_side_letter(side);
+            auto uplo_letter   = rocblas_fill_letter(uplo);
+            auto transa_letter = rocblas_transpose_letter(transa);
+            auto diag_letter   = rocblas_diag_letter(diag);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_trmm_outofplace_batched_name<T>,
+                          side,
+                          uplo,
+                          transa,
+                          diag,
+                          m,
+                          n,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          a,
+                          lda,
+                          b,
+                          ldb,
+                          c,
+                          ldc,
+                          batch_count);
+
+            if(layer_mode & rocblas_layer_mode_log_bench)
+                log_bench(handle,
+                          "./rocblas-bench -f trmm_outofplace_batched -r",
+                          rocblas_precision_string<T>,
+                          "--side",
+                          side_letter,
+                          "--uplo",
+                          uplo_letter,
+                          "--transposeA",
+                          transa_letter,
+                          "--diag",
+                          diag_letter,
+                          "-m",
+                          m,
+                          "-n",
+                          n,
+                          LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                          "--lda",
+                          lda,
+                          "--ldb",
+                          ldb,
+                          "--ldc",
+                          ldc,
+                          "--batch_count",
+                          batch_count);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_trmm_outofplace_batched_name<T>,
+                            "side",
+                            side_letter,
+                            "uplo",
+                            uplo_letter,
+                            "transa",
+                            transa_letter,
+                            "diag",
+                            diag_letter,
+                            "m",
+                            m,
+                            "n",
+                            n,
+                            "lda",
+                            lda,
+                            "ldb",
+                            ldb,
+                            "ldc",
+                            ldc,
+                            "batch_count",
+                            batch_count);
+        }
+
+        rocblas_int nrowa = rocblas_side_left == side ? m : n;
+
+        if(m < 0 || n < 0 || lda < nrowa || ldb < m || ldc < m || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(m == 0 || n == 0 || batch_count == 0)
+            return rocblas_status_success;
+
+        if(!alpha || !c)
+            return rocblas_status_invalid_pointer;
+
+        // C may only alias B as a whole, which is the in-place trmm
+        if(b == c && ldb != ldc)
+            return rocblas_status_invalid_value;
+
+        rocblas_stride stride_a = 0;
+        rocblas_stride stride_b = 0;
+        rocblas_stride stride_c = 0;
+
+        if(*alpha == 0)
+            return set_matrix_zero_if_alpha_zero_template(
+                handle, m, n, alpha, 0, c, 0, ldc, stride_c, batch_count);
+
+        if(!a || !b)
+            return rocblas_status_invalid_pointer;
+
+        rocblas_int a_row       = rocblas_side_left == side ? m : n;
+        bool        i64_indices = (a_row * size_t(lda) > std::numeric_limits<rocblas_int>::max())
+                           || (n * size_t(ldb) > std::numeric_limits<rocblas_int>::max())
+                           || (n * size_t(ldc) > std::numeric_limits<rocblas_int>::max());
+
+        if(i64_indices)
+            return rocblas_trmm_outofplace_template<STOPPING_NB, true, T>(handle,
+                                                                          side,
+                                                                          uplo,
+                                                                          transa,
+                                                                          diag,
+                                                                          m,
+                                                                          n,
+                                                                          alpha,
+                                                                          a,
+                                                                          size_t(lda),
+                                                                          stride_a,
+                                                                          b,
+                                                                          size_t(ldb),
+                                                                          stride_b,
+                                                                          c,
+                                                                          size_t(ldc),
+                                                                          stride_c,
+                                                                          batch_count);
+        else
+            return rocblas_trmm_outofplace_template<STOPPING_NB, true, T>(handle,
+                                                                          side,
+                                                                          uplo,
+                                                                          transa,
+                                                                          diag,
+                                                                          m,
+                                                                          n,
+                                                                          alpha,
+                                                                          a,
+                                                                          lda,
+                                                                          stride_a,
+                                                                          b,
+                                                                          ldb,
+                                                                          stride_b,
+                                                                          c,
+                                                                          ldc,
+                                                                          stride_c,
+                                                                          batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_, STOPPING_NB_)                                   \
+    rocblas_status routine_name_(rocblas_handle    handle,                      \
+                                 rocblas_side      side,                        \
+                                 rocblas_fill      uplo,                        \
+                                 rocblas_operation transa,                      \
+                                 rocblas_diagonal  diag,                        \
+                                 rocblas_int       m,                           \
+                                 rocblas_int       n,                           \
+                                 const T_*         alpha,                       \
+                                 const T_* const   a[],                         \
+                                 rocblas_int       lda,                         \
+                                 const T_* const   b[],                         \
+                                 rocblas_int       ldb,                         \
+                                 T_* const         c[],                         \
+                                 rocblas_int       ldc,                         \
+                                 rocblas_int       batch_count)                 \
+    try                                                                         \
+    {                                                                           \
+        return rocblas_trmm_outofplace_batched_impl<STOPPING_NB_>(handle,       \
+                                                                  side,         \
+                                                                  uplo,         \
+                                                                  transa,       \
+                                                                  diag,         \
+                                                                  m,            \
+                                                                  n,            \
+                                                                  alpha,        \
+                                                                  a,            \
+                                                                  lda,          \
+                                                                  b,            \
+                                                                  ldb,          \
+                                                                  c,            \
+                                                                  ldc,          \
+                                                                  batch_count); \
+    }                                                                           \
+    catch(...)                                                                  \
+    {                                                                           \
+        return exception_to_rocblas_status();                                   \
+    }
+
+IMPL(rocblas_strmm_outofplace_batched, float, STRMM_OUTOFPLACE_BATCHED_STOPPING_NB);
+IMPL(rocblas_dtrmm_outofplace_batched, double, DTRMM_OUTOFPLACE_BATCHED_STOPPING_NB);
+IMPL(rocblas_ctrmm_outofplace_batched, rocblas_float_complex, CTRMM_OUTOFPLACE_BATCHED_STOPPING_NB);
+IMPL(rocblas_ztrmm_outofplace_batched,
+     rocblas_double_complex,
+     ZTRMM_OUTOFPLACE_BATCHED_STOPPING_NB);
+
+#undef IMPL
+
+} // extern "C"
+
+/* ============================================================================================ */
@@ -138,6 +138,41 @@ namespace
         if(!alpha || !A || !B)
             return rocblas_status_invalid_pointer;
 
+        // The inverses of the diagonal blocks of A are taken from the handle's trsm inverse cache,
+        // or added to it once computed. The small kernels solve without them, and they are not
+        // computed when alpha is zero. A size query assumes a miss, which needs the most workspace.
+        bool cache_invA = handle->trsm_inverse_cache.size && !supplied_invA && (m > 64 || n > 64);
+
+        rocblas_inverse_key key{A,
+                                k,
+                                lda,
+                                uplo,
+                                diag,
+                                BLOCK,
+                                rocblas_precision_string<T>,
+                                handle->trsm_inverse_cache.version};
+
+        const T* cached_invA = nullptr;
+        if(cache_invA && !handle->is_device_memory_size_query())
+        {
+            cached_invA = (const T*)handle->trsm_inverse_cache.find(key);
+            if(cached_invA)
+            {
+                supplied_invA      = cached_invA;
+                supplied_invA_size = BLOCK * k;
+            }
+            else
+            {
+                T alpha_h;
+                if(handle->pointer_mode == rocblas_pointer_mode_host)
+                    alpha_h = *alpha;
+                else
+                    RETURN_IF_HIP_ERROR(
+                        hipMemcpy(&alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost));
+                cache_invA = alpha_h != T(0);
+            }
+        }
+
         //////////////////////
         // MEMORY MANAGEMENT//
         //////////////////////
@@ -149,6 +184,9 @@ namespace
         void* w_mem_invA;
         void* w_mem_invA_arr;
 
+        // the recursive algorithm needs no workspace if the optimal one cannot be allocated
+        bool recursive_fallback = rocblas_use_trsm_recursive(side, m, n, 0, lda, 0, ldb);
+
         rocblas_status perf_status
             = rocblas_internal_trsm_template_mem<BLOCK, false, T>(handle,
                                                                   side,
@@ -161,7 +199,28 @@ namespace
                                                                   w_mem_invA,
                                                                   w_mem_invA_arr,
                                                                   supplied_invA,
-                                                                  supplied_invA_size);
+                                                                  supplied_invA_size,
+                                                                  recursive_fallback);
+
+        // without the optimal workspace, solve recursively with gemm, which needs no workspace
+        if(perf_status == rocblas_status_continue)
+            return rocblas_internal_trsm_recursive_template<false>(handle,
+                                                                   side,
+                                                                   uplo,
+                                                                   transA,
+                                                                   diag,
+                                                                   m,
+                                                                   n,
+                                                                   alpha,
+                                                                   A,
+                                                                   0,
+                                                                   lda,
+                                                                   0,
+                                                                   B,
+                                                                   0,
+                                                                   ldb,
+                                                                   0,
+                                                                   1);
 
         // If this was a device memory query or an error occurred, return status
         if(perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
@@ -194,6 +253,11 @@ namespace
                                                                                 supplied_invA,
                                                                                 supplied_invA_size);
 
+        // keep the inverses computed in the workspace for the next solves
+        if(cache_invA && !cached_invA && status == rocblas_status_success)
+            handle->trsm_inverse_cache.insert(
+                key, w_mem_invA, sizeof(T) * BLOCK * k, handle->get_stream());
+
         return status != rocblas_status_success ? status : perf_status;
     }
 
@@ -1442,6 +1442,10 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
  *
  *  Note that for the batched version of trsm, we are also allocating memory to store the
  *  arrays of pointers for invA and w_x_temp (mem_x_temp_arr, mem_invA_arr).
+ *
+ *  With recursive_fallback, rocblas_status_continue is returned instead of allocating the backup
+ *  memory when the optimal memory cannot be allocated, for the caller to solve with
+ *  rocblas_internal_trsm_recursive_template, which needs none.
  */
 template <rocblas_int BLOCK, bool BATCHED, typename T, typename U>
 rocblas_status rocblas_internal_trsm_template_mem(rocblas_handle              handle,
@@ -1455,7 +1459,8 @@ rocblas_status rocblas_internal_trsm_template_mem(rocblas_handle              ha
                                                   void*&                      w_mem_invA,
                                                   void*&                      w_mem_invA_arr,
                                                   const U*    supplied_invA      = nullptr,
-                                                  rocblas_int supplied_invA_size = 0)
+                                                  rocblas_int supplied_invA_size = 0,
+                                                  bool        recursive_fallback = false)
 {
     auto& workspace = static_cast<decltype(handle->device_malloc(0))&>(w_mem);
 
@@ -1509,6 +1514,9 @@ rocblas_status rocblas_internal_trsm_template_mem(rocblas_handle              ha
         workspace
             = handle->device_malloc(w_x_tmp_size, w_x_tmp_arr_size, w_invA_size, w_invA_arr_size);
 
+        if(!workspace && recursive_fallback)
+            return rocblas_status_continue;
+
         if(!workspace)
         {
             // if memory allocation fails, try backup. If that fails, return error.
@@ -2193,6 +2201,156 @@ void rocblas_trsm_small_64(rocblas_handle    handle,
     }
 }
 
+// whether rocblas_internal_trsm_template solves with rocblas_trsm_tiny, for k <= 32
+inline bool rocblas_use_trsm_tiny(rocblas_side side,
+                                  rocblas_int  m,
+                                  rocblas_int  n,
+                                  rocblas_int  batch_count)
+{
+    rocblas_int k = side == rocblas_side_left ? m : n;
+    return rocblas_use_trtri_tiny(k, batch_count);
+}
+
+/*
+ *  Solves many tiny problems op(A) X = alpha B or X op(A) = alpha B, A being k x k with
+ *  k <= NB, each thread solving one column of B on the left, or one row on the right, in registers
+ *  by forward substitution. There is no shared memory and no barrier, so that a wavefront holds the
+ *  right-hand sides of several problems. The right-hand side x solves M x = alpha b with
+ *  M = op(A) on the left and M = op(A)^T on the right, and an upper M is solved as the lower
+ *  triangle of its rows and columns in reverse order.
+ */
+template <typename T, typename ATYPE, typename BTYPE, const int NB>
+ROCBLAS_KERNEL __launch_bounds__(ROCBLAS_TINY_TRIANGLE_THREADS) void
+    rocblas_trsm_tiny_device(rocblas_side      side,
+                             rocblas_fill      uplo,
+                             rocblas_operation transA,
+                             rocblas_diagonal  diag,
+                             int               m,
+                             int               n,
+                             T                 alpha,
+                             ATYPE             Aa,
+                             ptrdiff_t         offset_A,
+                             int               lda,
+                             rocblas_stride    stride_A,
+                             BTYPE             Ba,
+                             ptrdiff_t         offset_B,
+                             int               ldb,
+                             rocblas_stride    stride_B,
+                             size_t            num_rhs)
+{
+    bool LEFT = side == rocblas_side_left;
+    bool CONJ = transA == rocblas_operation_conjugate_transpose;
+    int  k    = LEFT ? m : n;
+    int  nrhs = LEFT ? n : m;
+
+    // M(i, j) is A[i * inc_i + j * inc_j], M is lower when the order is not reversed
+    bool      swap    = LEFT == (transA != rocblas_operation_none);
+    bool      forward = (uplo == rocblas_fill_lower) != swap;
+    ptrdiff_t inc_i   = swap ? lda : 1;
+    ptrdiff_t inc_j   = swap ? 1 : lda;
+    ptrdiff_t inc_b   = LEFT ? 1 : ldb;
+    ptrdiff_t first   = forward ? 0 : k - 1;
+    if(!forward)
+    {
+        inc_i = -inc_i;
+        inc_j = -inc_j;
+        inc_b = -inc_b;
+    }
+
+    for(size_t tid = size_t(blockIdx.x) * blockDim.x + threadIdx.x; tid < num_rhs;
+        tid += size_t(gridDim.x) * blockDim.x)
+    {
+        int rhs     = tid % nrhs;
+        int batchid = tid / nrhs;
+
+        const T* A = load_ptr_batch(Aa, batchid, offset_A, stride_A);
+        T*       B = load_ptr_batch(Ba, batchid, offset_B, stride_B);
+        A += first * (lda + 1);
+        B += (LEFT ? ptrdiff_t(rhs) * ldb : rhs) + first * (LEFT ? 1 : ldb);
+
+        T x[NB];
+#pragma unroll
+        for(int i = 0; i < NB; i++)
+        {
+            if(i >= k)
+                break;
+
+            T xi = alpha * B[i * inc_b];
+#pragma unroll
+            for(int j = 0; j < i; j++)
+            {
+                T a = A[i * inc_i + j * inc_j];
+                xi -= (CONJ ? conj(a) : a) * x[j];
+            }
+
+            if(diag == rocblas_diagonal_non_unit)
+            {
+                T a = A[i * (inc_i + inc_j)];
+                xi /= CONJ ? conj(a) : a;
+            }
+            x[i] = xi;
+        }
+
+#pragma unroll
+        for(int i = 0; i < NB; i++)
+        {
+            if(i >= k)
+                break;
+            B[i * inc_b] = x[i];
+        }
+    }
+}
+
+/*
+ * Launches rocblas_trsm_tiny_device with enough threads for the right-hand sides of all of the
+ * problems.
+ */
+template <typename T, typename ATYPE, typename BTYPE, const int NB>
+void rocblas_trsm_tiny(rocblas_handle    handle,
+                       rocblas_side      side,
+                       rocblas_fill      uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal  diag,
+                       rocblas_int       m,
+                       rocblas_int       n,
+                       T                 alpha,
+                       ATYPE             dA,
+                       ptrdiff_t         offset_A,
+                       rocblas_int       lda,
+                       rocblas_stride    stride_A,
+                       BTYPE             dB,
+                       ptrdiff_t         offset_B,
+                       rocblas_int       ldb,
+                       rocblas_stride    stride_B,
+                       rocblas_int       batch_count)
+{
+    size_t num_rhs = size_t(side == rocblas_side_left ? n : m) * batch_count;
+    size_t blocks  = std::min((num_rhs - 1) / ROCBLAS_TINY_TRIANGLE_THREADS + 1,
+                             ROCBLAS_TINY_TRIANGLE_MAX_BLOCKS);
+
+    hipLaunchKernelGGL((rocblas_trsm_tiny_device<T, ATYPE, BTYPE, NB>),
+                       dim3(blocks),
+                       dim3(ROCBLAS_TINY_TRIANGLE_THREADS),
+                       0,
+                       handle->get_stream(),
+                       side,
+                       uplo,
+                       transA,
+                       diag,
+                       m,
+                       n,
+                       alpha,
+                       dA,
+                       offset_A,
+                       lda,
+                       stride_A,
+                       dB,
+                       offset_B,
+                       ldb,
+                       stride_B,
+                       num_rhs);
+}
+
 //////////////////////////////
 //////////////////////////////
 //////////////////////////////
@@ -2255,7 +2413,65 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     bool is_small = (m <= 64 && n <= 64);
     if(SUBSTITUTION_ENABLED && is_small)
     {
-        if(k <= 2)
+        // many tiny problems are solved in registers, several per wavefront
+        if(rocblas_use_trsm_tiny(side, m, n, batch_count))
+        {
+            if(k <= 8)
+                rocblas_trsm_tiny<T, U, V, 8>(handle,
+                                              side,
+                                              uplo,
+                                              transA,
+                                              diag,
+                                              m,
+                                              n,
+                                              alpha_h,
+                                              A,
+                                              offset_A,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              offset_B,
+                                              ldb,
+                                              stride_B,
+                                              batch_count);
+            else if(k <= 16)
+                rocblas_trsm_tiny<T, U, V, 16>(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               m,
+                                               n,
+                                               alpha_h,
+                                               A,
+                                               offset_A,
+                                               lda,
+                                               stride_A,
+                                               B,
+                                               offset_B,
+                                               ldb,
+                                               stride_B,
+                                               batch_count);
+            else
+                rocblas_trsm_tiny<T, U, V, ROCBLAS_TINY_TRIANGLE_MAX_N>(handle,
+                                                                        side,
+                                                                        uplo,
+                                                                        transA,
+                                                                        diag,
+                                                                        m,
+                                                                        n,
+                                                                        alpha_h,
+                                                                        A,
+                                                                        offset_A,
+                                                                        lda,
+                                                                        stride_A,
+                                                                        B,
+                                                                        offset_B,
+                                                                        ldb,
+                                                                        stride_B,
+                                                                        batch_count);
+        }
+        else if(k <= 2)
             rocblas_trsm_small<T, T, U, V, 2>(handle,
                                               side,
                                               uplo,
@@ -2521,3 +2737,202 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
     return rocblas_status_success;
 }
+
+// largest triangle solved by the substitution kernels at the leaves of rocblas_trsm_recursive
+constexpr rocblas_int ROCBLAS_TRSM_RECURSIVE_NB = 64;
+
+// whether rocblas_internal_trsm_recursive_template applies, the offsets of the blocks of A and B
+// passed to gemm being rocblas_int
+inline bool rocblas_use_trsm_recursive(rocblas_side side,
+                                       rocblas_int  m,
+                                       rocblas_int  n,
+                                       rocblas_int  offset_A,
+                                       rocblas_int  lda,
+                                       rocblas_int  offset_B,
+                                       rocblas_int  ldb)
+{
+    size_t      max_offset = std::numeric_limits<rocblas_int>::max();
+    rocblas_int k          = side == rocblas_side_left ? m : n;
+    return offset_A + size_t(k) * lda <= max_offset && offset_B + size_t(n) * ldb <= max_offset;
+}
+
+/**
+ *  Solves op(A) X = alpha B or X op(A) = alpha B, A being k x k, without device memory. The
+ *  triangle of A is split into two diagonal blocks, the first one being a multiple of
+ *  ROCBLAS_TRSM_RECURSIVE_NB. The half of X whose block of op(A) has no off-diagonal term is
+ *  solved first, the right-hand sides of the other half are updated by gemm with the
+ *  off-diagonal block, and the other half is solved with alpha 1. Triangles of at most
+ *  ROCBLAS_TRSM_RECURSIVE_NB are solved by the substitution kernels, for any number of
+ *  right-hand sides. alpha is on the host, and the handle is in host pointer mode.
+ */
+template <bool BATCHED, typename T, typename U, typename V>
+rocblas_status rocblas_trsm_recursive(rocblas_handle    handle,
+                                      rocblas_side      side,
+                                      rocblas_fill      uplo,
+                                      rocblas_operation transA,
+                                      rocblas_diagonal  diag,
+                                      rocblas_int       m,
+                                      rocblas_int       n,
+                                      const T*          alpha,
+                                      U                 A,
+                                      rocblas_int       offset_A,
+                                      rocblas_int       lda,
+                                      rocblas_stride    stride_A,
+                                      V                 B,
+                                      rocblas_int       offset_B,
+                                      rocblas_int       ldb,
+                                      rocblas_stride    stride_B,
+                                      rocblas_int       batch_count)
+{
+    static constexpr rocblas_int NB = ROCBLAS_TRSM_RECURSIVE_NB;
+
+    bool        left = side == rocblas_side_left;
+    rocblas_int k    = left ? m : n;
+    if(k <= NB)
+    {
+        rocblas_trsm_small_64<T, T, U, V, NB>(handle,
+                                              side,
+                                              uplo,
+                                              transA,
+                                              diag,
+                                              m,
+                                              n,
+                                              *alpha,
+                                              A,
+                                              offset_A,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              offset_B,
+                                              ldb,
+                                              stride_B,
+                                              batch_count);
+        return rocblas_status_success;
+    }
+
+    rocblas_int k1 = ((k / 2 - 1) / NB + 1) * NB;
+    rocblas_int k2 = k - k1;
+
+    // op(A) is lower triangular when A is lower and not transposed, or upper and transposed. The
+    // leading half of X is solved first when op(A) is lower on the left, or upper on the right.
+    bool lower_op      = (uplo == rocblas_fill_lower) == (transA == rocblas_operation_none);
+    bool leading_first = left == lower_op;
+
+    // the off-diagonal block stored in A is A[k1 : k, 0 : k1] or A[0 : k1, k1 : k]
+    rocblas_int b_s1       = left ? 1 : ldb;
+    rocblas_int offset_A12 = offset_A + (uplo == rocblas_fill_lower ? k1 : k1 * lda);
+    rocblas_int offset_A22 = offset_A + k1 + k1 * lda;
+    rocblas_int offset_B2  = offset_B + k1 * b_s1;
+
+    rocblas_int k_first  = leading_first ? k1 : k2;
+    rocblas_int k_second = leading_first ? k2 : k1;
+    rocblas_int offA_1st = leading_first ? offset_A : offset_A22;
+    rocblas_int offA_2nd = leading_first ? offset_A22 : offset_A;
+    rocblas_int offB_1st = leading_first ? offset_B : offset_B2;
+    rocblas_int offB_2nd = leading_first ? offset_B2 : offset_B;
+
+    auto solve = [&](rocblas_int kd, rocblas_int offA, rocblas_int offB, const T* alpha_d) {
+        return rocblas_trsm_recursive<BATCHED>(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               left ? kd : m,
+                                               left ? n : kd,
+                                               alpha_d,
+                                               A,
+                                               offA,
+                                               lda,
+                                               stride_A,
+                                               B,
+                                               offB,
+                                               ldb,
+                                               stride_B,
+                                               batch_count);
+    };
+
+    RETURN_IF_ROCBLAS_ERROR(solve(k_first, offA_1st, offB_1st, alpha));
+
+    // B_2nd := alpha * B_2nd - op(A)_{2nd, 1st} * X_1st on the left, or
+    // B_2nd := alpha * B_2nd - X_1st * op(A)_{1st, 2nd} on the right
+    // clang-format off
+    if(left)
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemm_template<BATCHED>(
+            handle, transA, rocblas_operation_none, k_second, n, k_first, &negative_one<T>,
+            A,    offset_A12, lda, stride_A,
+            (U)B, offB_1st,   ldb, stride_B, alpha,
+            B,    offB_2nd,   ldb, stride_B, batch_count));
+    else
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemm_template<BATCHED>(
+            handle, rocblas_operation_none, transA, m, k_second, k_first, &negative_one<T>,
+            (U)B, offB_1st,   ldb, stride_B,
+            A,    offset_A12, lda, stride_A, alpha,
+            B,    offB_2nd,   ldb, stride_B, batch_count));
+    // clang-format on
+
+    return solve(k_second, offA_2nd, offB_2nd, &one<T>);
+}
+
+/**
+ *  Recursive trsm of rocblas_trsm_recursive, which spends most of its flops in gemm and needs no
+ *  device memory, for trsm calls which cannot get the workspace of
+ *  rocblas_internal_trsm_workspace_size. rocblas_use_trsm_recursive must hold.
+ */
+template <bool BATCHED, typename T, typename U, typename V>
+rocblas_status rocblas_internal_trsm_recursive_template(rocblas_handle    handle,
+                                                        rocblas_side      side,
+                                                        rocblas_fill      uplo,
+                                                        rocblas_operation transA,
+                                                        rocblas_diagonal  diag,
+                                                        rocblas_int       m,
+                                                        rocblas_int       n,
+                                                        const T*          alpha,
+                                                        U                 A,
+                                                        rocblas_int       offset_A,
+                                                        rocblas_int       lda,
+                                                        rocblas_stride    stride_A,
+                                                        V                 B,
+                                                        rocblas_int       offset_B,
+                                                        rocblas_int       ldb,
+                                                        rocblas_stride    stride_B,
+                                                        rocblas_int       batch_count)
+{
+    if(!batch_count)
+        return rocblas_status_success;
+
+    // Temporarily switch to host pointer mode, saving current pointer mode, restored on return
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    T alpha_h;
+    if(saved_pointer_mode == rocblas_pointer_mode_host)
+        alpha_h = *alpha;
+    else
+        RETURN_IF_HIP_ERROR(hipMemcpy(&alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost));
+
+    if(alpha_h == T(0.0))
+    {
+        set_block_unit<T>(handle, m, n, B, ldb, stride_B, batch_count, T(0.0), offset_B);
+        return rocblas_status_success;
+    }
+
+    if(!is_complex<T> && transA == rocblas_operation_conjugate_transpose)
+        transA = rocblas_operation_transpose;
+
+    return rocblas_trsm_recursive<BATCHED>(handle,
+                                           side,
+                                           uplo,
+                                           transA,
+                                           diag,
+                                           m,
+                                           n,
+                                           &alpha_h,
+                                           A,
+                                           offset_A,
+                                           lda,
+                                           stride_A,
+                                           B,
+                                           offset_B,
+                                           ldb,
+                                           stride_B,
+                                           batch_count);
+}
@@ -156,6 +156,9 @@ namespace
         void* w_mem_invA;
         void* w_mem_invA_arr;
 
+        // the recursive algorithm needs no workspace if the optimal one cannot be allocated
+        bool recursive_fallback = rocblas_use_trsm_recursive(side, m, n, 0, lda, 0, ldb);
+
         rocblas_status perf_status
             = rocblas_internal_trsm_template_mem<BLOCK, true, T>(handle,
                                                                  side,
@@ -168,7 +171,28 @@ namespace
                                                                  w_mem_invA,
                                                                  w_mem_invA_arr,
                                                                  supplied_invA,
-                                                                 supplied_invA_size);
+                                                                 supplied_invA_size,
+                                                                 recursive_fallback);
+
+        // without the optimal workspace, solve recursively with gemm, which needs no workspace
+        if(perf_status == rocblas_status_continue)
+            return rocblas_internal_trsm_recursive_template<true>(handle,
+                                                                  side,
+                                                                  uplo,
+                                                                  transA,
+                                                                  diag,
+                                                                  m,
+                                                                  n,
+                                                                  alpha,
+                                                                  A,
+                                                                  0,
+                                                                  lda,
+                                                                  0,
+                                                                  B,
+                                                                  0,
+                                                                  ldb,
+                                                                  0,
+                                                                  batch_count);
 
         if(perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
             return perf_status;
@@ -172,6 +172,9 @@ namespace
         void* w_mem_invA;
         void* w_mem_invA_arr;
 
+        // the recursive algorithm needs no workspace if the optimal one cannot be allocated
+        bool recursive_fallback = rocblas_use_trsm_recursive(side, m, n, 0, lda, 0, ldb);
+
         rocblas_status perf_status
             = rocblas_internal_trsm_template_mem<BLOCK, false, T>(handle,
                                                                   side,
@@ -184,7 +187,28 @@ namespace
                                                                   w_mem_invA,
                                                                   w_mem_invA_arr,
                                                                   supplied_invA,
-                                                                  supplied_invA_size);
+                                                                  supplied_invA_size,
+                                                                  recursive_fallback);
+
+        // without the optimal workspace, solve recursively with gemm, which needs no workspace
+        if(perf_status == rocblas_status_continue)
+            return rocblas_internal_trsm_recursive_template<false>(handle,
+                                                                   side,
+                                                                   uplo,
+                                                                   transA,
+                                                                   diag,
+                                                                   m,
+                                                                   n,
+                                                                   alpha,
+                                                                   (const T*)A,
+                                                                   0,
+                                                                   lda,
+                                                                   stride_A,
+                                                                   (T*)B,
+                                                                   0,
+                                                                   ldb,
+                                                                   stride_B,
+                                                                   batch_count);
 
         if(perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
             return perf_status;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "../blas2/tiny_batched_device.hpp"
 #include "gemm.hpp"
 
 template <rocblas_int IB, typename T>
@@ -414,6 +415,160 @@ ROCBLAS_KERNEL void trtri_remainder_kernel(rocblas_fill     uplo,
     trtri_device<2 * NB>(uplo, diag, n, individual_A, lda, individual_invA, ldinvA);
 }
 
+// largest n of the register resident trtri and trsm kernels for many tiny triangles
+constexpr rocblas_int ROCBLAS_TINY_TRIANGLE_MAX_N = 32;
+
+// threads of a block of the register resident kernels, which spans several triangles
+constexpr rocblas_int ROCBLAS_TINY_TRIANGLE_THREADS = 64;
+
+// most blocks of the register resident kernels, which loop over the remaining problems
+constexpr size_t ROCBLAS_TINY_TRIANGLE_MAX_BLOCKS = size_t(1) << 24;
+
+inline bool rocblas_use_trtri_tiny(rocblas_int n, size_t batches)
+{
+    return n <= ROCBLAS_TINY_TRIANGLE_MAX_N
+           && batches >= size_t(rocblas_tiny_batched_min_batch_count());
+}
+
+/**
+  *  Inverts many tiny triangles, each thread computing one column of an inverse in registers by
+  *  forward substitution, without shared memory, so that a block holds the columns of several
+  *  triangles. An upper triangle is inverted as the lower triangle of its rows and columns in
+  *  reverse order. The whole n x n inverse is written, zeros included, so the other triangle of
+  *  invA needs no separate fill. As invA may be A, the columns of a triangle are in the same block
+  *  and are written after a barrier.
+  */
+template <rocblas_int NB, typename T, typename U, typename V>
+ROCBLAS_KERNEL __launch_bounds__(ROCBLAS_TINY_TRIANGLE_THREADS) void
+    trtri_tiny_kernel(rocblas_fill     uplo,
+                      rocblas_diagonal diag,
+                      rocblas_int      n,
+                      U                A,
+                      rocblas_int      offset_A,
+                      rocblas_int      lda,
+                      rocblas_stride   stride_A,
+                      rocblas_stride   sub_stride_A,
+                      V                invA,
+                      rocblas_int      offset_invA,
+                      rocblas_int      ldinvA,
+                      rocblas_stride   stride_invA,
+                      rocblas_stride   sub_stride_invA,
+                      rocblas_int      sub_batch_count,
+                      size_t           num_triangles)
+{
+    bool      upper = uplo == rocblas_fill_upper;
+    ptrdiff_t step  = upper ? -1 : 1;
+    ptrdiff_t last  = n - 1;
+
+    rocblas_int per_block  = ROCBLAS_TINY_TRIANGLE_THREADS / n;
+    size_t      num_groups = (num_triangles - 1) / per_block + 1;
+    rocblas_int local      = hipThreadIdx_x / n;
+    rocblas_int col        = hipThreadIdx_x % n;
+
+    // column c of the inverse of the lower triangle a(i, j), which is A reversed when upper
+    rocblas_int c = upper ? last - col : col;
+
+    for(size_t group = hipBlockIdx_x; group < num_groups; group += hipGridDim_x)
+    {
+        size_t triangle = group * per_block + local;
+        bool   active   = local < per_block && triangle < num_triangles;
+
+        T  x[NB];
+        T* pI = nullptr;
+        if(active)
+        {
+            rocblas_int sub   = triangle % sub_batch_count;
+            rocblas_int batch = triangle / sub_batch_count;
+
+            const T* pA = load_ptr_batch(A, batch, offset_A, stride_A) + sub * sub_stride_A;
+            pI = load_ptr_batch(invA, batch, offset_invA, stride_invA) + sub * sub_stride_invA;
+
+            const T* a0 = upper ? pA + last * (1 + lda) : pA;
+            auto     a
+                = [=](rocblas_int i, rocblas_int j) { return a0[step * (i + ptrdiff_t(j) * lda)]; };
+
+#pragma unroll
+            for(rocblas_int i = 0; i < NB; i++)
+            {
+                if(i >= n)
+                    break;
+
+                T xi = i == c ? T(1) : T(0);
+#pragma unroll
+                for(rocblas_int j = 0; j < i; j++)
+                    xi -= a(i, j) * x[j];
+
+                // as trtri_device, a zero diagonal element is taken as one
+                T d  = diag == rocblas_diagonal_unit || a(i, i) == T(0) ? T(1) : T(1) / a(i, i);
+                x[i] = i < c ? T(0) : xi * d;
+            }
+        }
+
+        __syncthreads();
+
+        if(active)
+        {
+            pI += ptrdiff_t(col) * ldinvA;
+#pragma unroll
+            for(rocblas_int i = 0; i < NB; i++)
+            {
+                if(i >= n)
+                    break;
+                pI[upper ? last - i : i] = x[i];
+            }
+        }
+    }
+}
+
+template <rocblas_int NB, typename T, typename U, typename V>
+void rocblas_trtri_tiny_launcher(rocblas_handle   handle,
+                                 rocblas_fill     uplo,
+                                 rocblas_diagonal diag,
+                                 rocblas_int      n,
+                                 U                A,
+                                 rocblas_int      offset_A,
+                                 rocblas_int      lda,
+                                 rocblas_stride   stride_A,
+                                 rocblas_stride   sub_stride_A,
+                                 V                invA,
+                                 rocblas_int      offset_invA,
+                                 rocblas_int      ldinvA,
+                                 rocblas_stride   stride_invA,
+                                 rocblas_stride   sub_stride_invA,
+                                 rocblas_int      batch_count,
+                                 rocblas_int      sub_batch_count)
+{
+    size_t num_triangles = size_t(sub_batch_count) * batch_count;
+    size_t per_block     = ROCBLAS_TINY_TRIANGLE_THREADS / n;
+    size_t blocks = std::min((num_triangles - 1) / per_block + 1, ROCBLAS_TINY_TRIANGLE_MAX_BLOCKS);
+
+    hipLaunchKernelGGL((trtri_tiny_kernel<NB, T>),
+                       dim3(blocks),
+                       dim3(ROCBLAS_TINY_TRIANGLE_THREADS),
+                       0,
+                       handle->get_stream(),
+                       uplo,
+                       diag,
+                       n,
+                       A,
+                       offset_A,
+                       lda,
+                       stride_A,
+                       sub_stride_A,
+                       invA,
+                       offset_invA,
+                       ldinvA,
+                       stride_invA,
+                       sub_stride_invA,
+                       sub_batch_count,
+                       num_triangles);
+}
+
+/**
+  *  Inverts the n x n triangles of A, n <= NB, with one block per triangle, or with the register
+  *  resident trtri_tiny_kernel when there are many triangles, in which case n may be up to
+  *  ROCBLAS_TINY_TRIANGLE_MAX_N.
+  */
 template <rocblas_int NB, typename T, typename U, typename V>
 rocblas_status rocblas_trtri_small(rocblas_handle   handle,
                                    rocblas_fill     uplo,
@@ -432,6 +587,62 @@ rocblas_status rocblas_trtri_small(rocblas_handle   handle,
                                    rocblas_int      batch_count,
                                    rocblas_int      sub_batch_count)
 {
+    if(rocblas_use_trtri_tiny(n, size_t(batch_count) * sub_batch_count))
+    {
+        if(n <= 8)
+            rocblas_trtri_tiny_launcher<8, T>(handle,
+                                              uplo,
+                                              diag,
+                                              n,
+                                              A,
+                                              offset_A,
+                                              lda,
+                                              stride_A,
+                                              sub_stride_A,
+                                              invA,
+                                              offset_invA,
+                                              ldinvA,
+                                              stride_invA,
+                                              sub_stride_invA,
+                                              batch_count,
+                                              sub_batch_count);
+        else if(n <= 16)
+            rocblas_trtri_tiny_launcher<16, T>(handle,
+                                               uplo,
+                                               diag,
+                                               n,
+                                               A,
+                                               offset_A,
+                                               lda,
+                                               stride_A,
+                                               sub_stride_A,
+                                               invA,
+                                               offset_invA,
+                                               ldinvA,
+                                               stride_invA,
+                                               sub_stride_invA,
+                                               batch_count,
+                                               sub_batch_count);
+        else
+            rocblas_trtri_tiny_launcher<ROCBLAS_TINY_TRIANGLE_MAX_N, T>(handle,
+                                                                        uplo,
+                                                                        diag,
+                                                                        n,
+                                                                        A,
+                                                                        offset_A,
+                                                                        lda,
+                                                                        stride_A,
+                                                                        sub_stride_A,
+                                                                        invA,
+                                                                        offset_invA,
+                                                                        ldinvA,
+                                                                        stride_invA,
+                                                                        sub_stride_invA,
+                                                                        batch_count,
+                                                                        sub_batch_count);
+        return rocblas_status_success;
+    }
+
     if(n > NB)
         return rocblas_status_not_implemented;
 
@@ -1064,7 +1275,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!n || !sub_batch_count)
         return rocblas_status_success;
 
-    if(n <= NB)
+    if(n <= NB || rocblas_use_trtri_tiny(n, size_t(batch_count) * sub_batch_count))
     {
         return rocblas_trtri_small<NB, T>(handle,
                                           uplo,
@@ -40,7 +40,7 @@ namespace
         size_t sizep = batch_count * sizeof(T*);
         if(handle->is_device_memory_size_query())
         {
-            if(n <= NB || !batch_count)
+            if(n <= NB || !batch_count || rocblas_use_trtri_tiny(n, batch_count))
                 return rocblas_status_size_unchanged;
             return handle->set_optimal_device_memory_size(size, sizep);
         }
@@ -75,8 +75,9 @@ namespace
         if(!A || !invA)
             return rocblas_status_invalid_pointer;
 
+        // many triangles of up to ROCBLAS_TINY_TRIANGLE_MAX_N are inverted in registers
         rocblas_status status;
-        if(n <= NB)
+        if(n <= NB || rocblas_use_trtri_tiny(n, batch_count))
         {
             status = rocblas_trtri_small<NB, T>(
                 handle, uplo, diag, n, A, 0, lda, 0, 0, invA, 0, ldinvA, 0, 0, batch_count, 1);
@@ -0,0 +1,487 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "rocblas_gemm_epilogue.hpp"
+#include "logging.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // largest finite value of the type of D, the bound of the saturation
+    template <typename To>
+    constexpr double rocblas_gemm_epilogue_max = 0;
+    template <>
+    constexpr double rocblas_gemm_epilogue_max<double> = std::numeric_limits<double>::max();
+    template <>
+    constexpr double rocblas_gemm_epilogue_max<float> = std::numeric_limits<float>::max();
+    template <>
+    constexpr double rocblas_gemm_epilogue_max<rocblas_half> = 65504.0;
+    template <>
+    constexpr double rocblas_gemm_epilogue_max<rocblas_bfloat16> = 3.38953138925153547590e+38;
+
+    template <typename Tw>
+    __device__ Tw rocblas_gemm_epilogue_activate(rocblas_activation activation, Tw x)
+    {
+        switch(activation)
+        {
+        case rocblas_activation_relu:
+            return x > 0 ? x : Tw(0);
+        case rocblas_activation_gelu:
+            // tanh approximation, sqrt(2 / pi) = 0.7978845608...
+            return Tw(0.5) * x
+                   * (1 + std::tanh(Tw(0.7978845608028654) * (x + Tw(0.044715) * x * x * x)));
+        default:
+            return x;
+        }
+    }
+
+    // saturate(activation(scale[i or j] * x + bias[i or j])) for the element (i, j) of D
+    template <typename Tw, typename To, typename Tc>
+    __device__ Tw rocblas_gemm_epilogue_element(Tw                 x,
+                                                rocblas_int        i,
+                                                rocblas_int        j,
+                                                const Tc*          bias,
+                                                bool               bias_per_row,
+                                                const Tc*          scale,
+                                                bool               scale_per_row,
+                                                rocblas_activation activation,
+                                                bool               saturate)
+    {
+        constexpr Tw max = Tw(rocblas_gemm_epilogue_max<To>);
+
+        if(scale)
+            x *= Tw(scale[scale_per_row ? i : j]);
+        if(bias)
+            x += Tw(bias[bias_per_row ? i : j]);
+        x = rocblas_gemm_epilogue_activate(activation, x);
+
+        // comparisons keep NaN
+        if(saturate)
+            x = x > max ? max : x < -max ? -max : x;
+        return x;
+    }
+
+    /**
+     *  D := saturate(activation(scale .* D + bias)) on an m by n matrix, the elements being
+     *  computed in Tw, which is double for double D and float otherwise. Each block handles DIM_X
+     *  rows of DIM_Y columns and loops over the columns when n exceeds the grid.
+     */
+    template <rocblas_int DIM_X, rocblas_int DIM_Y, typename Tw, typename Tc, typename To>
+    ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void
+        rocblas_gemm_epilogue_kernel(rocblas_int        m,
+                                     rocblas_int        n,
+                                     To*                D,
+                                     rocblas_stride     row_stride_d,
+                                     rocblas_stride     col_stride_d,
+                                     const Tc*          bias,
+                                     bool               bias_per_row,
+                                     const Tc*          scale,
+                                     bool               scale_per_row,
+                                     rocblas_activation activation,
+                                     bool               saturate)
+    {
+        rocblas_int i = hipBlockIdx_x * DIM_X + hipThreadIdx_x;
+        if(i >= m)
+            return;
+
+        for(rocblas_int j = hipBlockIdx_y * DIM_Y + hipThreadIdx_y; j < n;
+            j += hipGridDim_y * DIM_Y)
+        {
+            To& d = D[i * row_stride_d + j * col_stride_d];
+            d     = To(rocblas_gemm_epilogue_element<Tw, To>(
+                Tw(d), i, j, bias, bias_per_row, scale, scale_per_row, activation, saturate));
+        }
+    }
+
+    /**
+     *  D := epilogue(alpha * column_scale[j] * row_scale[i] * (Q + row_offset[i]
+     *  + column_offset[j]) + beta * C), computed in float, Q being the int32 product of an int8
+     *  gemm with a leading dimension of m. The offsets are added in int32.
+     */
+    template <rocblas_int DIM_X, rocblas_int DIM_Y, typename To>
+    ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void
+        rocblas_gemm_epilogue_dequantize_kernel(rocblas_int        m,
+                                                rocblas_int        n,
+                                                const int32_t*     Q,
+                                                float              alpha,
+                                                float              beta,
+                                                const To*          C,
+                                                rocblas_stride     row_stride_c,
+                                                rocblas_stride     col_stride_c,
+                                                To*                D,
+                                                rocblas_stride     row_stride_d,
+                                                rocblas_stride     col_stride_d,
+                                                const float*       row_scale,
+                                                const float*       column_scale,
+                                                const int32_t*     row_offset,
+                                                const int32_t*     column_offset,
+                                                const float*       bias,
+                                                bool               bias_per_row,
+                                                const float*       scale,
+                                                bool               scale_per_row,
+                                                rocblas_activation activation,
+                                                bool               saturate)
+    {
+        rocblas_int i = hipBlockIdx_x * DIM_X + hipThreadIdx_x;
+        if(i >= m)
+            return;
+
+        int32_t offset_i = row_offset ? row_offset[i] : 0;
+        float   scale_i  = row_scale ? row_scale[i] : 1.0f;
+
+        for(rocblas_int j = hipBlockIdx_y * DIM_Y + hipThreadIdx_y; j < n;
+            j += hipGridDim_y * DIM_Y)
+        {
+            float x = 0;
+            if(alpha)
+            {
+                int32_t q = (Q ? Q[i + size_t(j) * m] : 0) + offset_i;
+                if(column_offset)
+                    q += column_offset[j];
+                x = alpha * float(q);
+                x *= scale_i;
+                if(column_scale)
+                    x *= column_scale[j];
+            }
+            if(beta)
+                x += beta * float(C[i * row_stride_c + j * col_stride_c]);
+
+            D[i * row_stride_d + j * col_stride_d] = To(rocblas_gemm_epilogue_element<float, To>(
+                x, i, j, bias, bias_per_row, scale, scale_per_row, activation, saturate));
+        }
+    }
+
+    template <typename Tw, typename Tc, typename To>
+    rocblas_status rocblas_gemm_epilogue_launch(rocblas_handle        handle,
+                                                rocblas_gemm_epilogue epilogue,
+                                                rocblas_int           m,
+                                                rocblas_int           n,
+                                                void*                 d,
+                                                rocblas_stride        row_stride_d,
+                                                rocblas_stride        col_stride_d)
+    {
+        static constexpr int GEMM_EPILOGUE_DIM_X = 64;
+        static constexpr int GEMM_EPILOGUE_DIM_Y = 4;
+        rocblas_int          gx = (m - 1) / GEMM_EPILOGUE_DIM_X + 1;
+        rocblas_int          gy = std::min((n - 1) / GEMM_EPILOGUE_DIM_Y + 1, 65535);
+        dim3                 grid(gx, gy);
+        dim3                 threads(GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y);
+
+        hipLaunchKernelGGL(
+            (rocblas_gemm_epilogue_kernel<GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y, Tw, Tc, To>),
+            grid,
+            threads,
+            0,
+            handle->get_stream(),
+            m,
+            n,
+            (To*)d,
+            row_stride_d,
+            col_stride_d,
+            (const Tc*)epilogue->bias,
+            epilogue->bias_vector == rocblas_epilogue_vector_per_row,
+            (const Tc*)epilogue->scale,
+            epilogue->scale_vector == rocblas_epilogue_vector_per_row,
+            epilogue->activation,
+            epilogue->saturate);
+
+        return rocblas_status_success;
+    }
+
+    template <typename To>
+    rocblas_status rocblas_gemm_epilogue_dequantize_launch(rocblas_handle        handle,
+                                                           rocblas_gemm_epilogue epilogue,
+                                                           rocblas_int           m,
+                                                           rocblas_int           n,
+                                                           const int32_t*        q,
+                                                           float                 alpha,
+                                                           float                 beta,
+                                                           const void*           c,
+                                                           rocblas_stride        row_stride_c,
+                                                           rocblas_stride        col_stride_c,
+                                                           void*                 d,
+                                                           rocblas_stride        row_stride_d,
+                                                           rocblas_stride        col_stride_d)
+    {
+        static constexpr int GEMM_EPILOGUE_DIM_X = 64;
+        static constexpr int GEMM_EPILOGUE_DIM_Y = 4;
+        rocblas_int          gx = (m - 1) / GEMM_EPILOGUE_DIM_X + 1;
+        rocblas_int          gy = std::min((n - 1) / GEMM_EPILOGUE_DIM_Y + 1, 65535);
+        dim3                 grid(gx, gy);
+        dim3                 threads(GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y);
+
+        // a nullptr epilogue only dequantizes with unit scales and no offsets
+        _rocblas_gemm_epilogue none;
+        if(!epilogue)
+            epilogue = &none;
+
+        hipLaunchKernelGGL(
+            (rocblas_gemm_epilogue_dequantize_kernel<GEMM_EPILOGUE_DIM_X, GEMM_EPILOGUE_DIM_Y, To>),
+            grid,
+            threads,
+            0,
+            handle->get_stream(),
+            m,
+            n,
+            q,
+            alpha,
+            beta,
+            (const To*)c,
+            row_stride_c,
+            col_stride_c,
+            (To*)d,
+            row_stride_d,
+            col_stride_d,
+            epilogue->dequant_row_scale,
+            epilogue->dequant_column_scale,
+            epilogue->dequant_row_offset,
+            epilogue->dequant_column_offset,
+            (const float*)epilogue->bias,
+            epilogue->bias_vector == rocblas_epilogue_vector_per_row,
+            (const float*)epilogue->scale,
+            epilogue->scale_vector == rocblas_epilogue_vector_per_row,
+            epilogue->activation,
+            epilogue->saturate);
+
+        return rocblas_status_success;
+    }
+
+    bool rocblas_epilogue_vector_valid(rocblas_epilogue_vector vector)
+    {
+        return vector == rocblas_epilogue_vector_per_row
+               || vector == rocblas_epilogue_vector_per_column;
+    }
+} // namespace
+
+rocblas_status rocblas_gemm_epilogue_template(rocblas_handle        handle,
+                                              rocblas_gemm_epilogue epilogue,
+                                              rocblas_int           m,
+                                              rocblas_int           n,
+                                              void*                 d,
+                                              rocblas_datatype      d_type,
+                                              rocblas_stride        row_stride_d,
+                                              rocblas_stride        col_stride_d,
+                                              rocblas_datatype      compute_type)
+{
+    if(!epilogue || epilogue->is_identity() || !m || !n)
+        return rocblas_status_success;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle,
+                  "rocblas_gemm_epilogue",
+                  m,
+                  n,
+                  d,
+                  rocblas_datatype_string(d_type),
+                  row_stride_d,
+                  col_stride_d,
+                  rocblas_datatype_string(compute_type),
+                  epilogue->bias,
+                  epilogue->scale,
+                  int(epilogue->activation),
+                  epilogue->saturate);
+
+#define GEMM_EPILOGUE_PARM handle, epilogue, m, n, d, row_stride_d, col_stride_d
+
+    switch(d_type)
+    {
+    case rocblas_datatype_f64_r:
+        return rocblas_gemm_epilogue_launch<double, double, double>(GEMM_EPILOGUE_PARM);
+    case rocblas_datatype_f32_r:
+        return rocblas_gemm_epilogue_launch<float, float, float>(GEMM_EPILOGUE_PARM);
+    case rocblas_datatype_bf16_r:
+        return rocblas_gemm_epilogue_launch<float, float, rocblas_bfloat16>(GEMM_EPILOGUE_PARM);
+    case rocblas_datatype_f16_r:
+        if(compute_type == rocblas_datatype_f16_r)
+            return rocblas_gemm_epilogue_launch<float, rocblas_half, rocblas_half>(
+                GEMM_EPILOGUE_PARM);
+        else
+            return rocblas_gemm_epilogue_launch<float, float, rocblas_half>(GEMM_EPILOGUE_PARM);
+    default:
+        return rocblas_status_not_implemented;
+    }
+
+#undef GEMM_EPILOGUE_PARM
+}
+
+rocblas_status rocblas_gemm_epilogue_dequantize_template(rocblas_handle        handle,
+                                                         rocblas_gemm_epilogue epilogue,
+                                                         rocblas_int           m,
+                                                         rocblas_int           n,
+                                                         const int32_t*        q,
+                                                         float                 alpha,
+                                                         float                 beta,
+                                                         const void*           c,
+                                                         rocblas_stride        row_stride_c,
+                                                         rocblas_stride        col_stride_c,
+                                                         void*                 d,
+                                                         rocblas_datatype      d_type,
+                                                         rocblas_stride        row_stride_d,
+                                                         rocblas_stride        col_stride_d)
+{
+    if(!m || !n)
+        return rocblas_status_success;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle,
+                  "rocblas_gemm_epilogue_dequantize",
+                  m,
+                  n,
+                  q,
+                  alpha,
+                  beta,
+                  c,
+                  d,
+                  rocblas_datatype_string(d_type),
+                  row_stride_d,
+                  col_stride_d,
+                  epilogue ? epilogue->dequant_row_scale : nullptr,
+                  epilogue ? epilogue->dequant_column_scale : nullptr);
+
+#define GEMM_EPILOGUE_PARM                                                                         \
+    handle, epilogue, m, n, q, alpha, beta, c, row_stride_c, col_stride_c, d, row_stride_d,        \
+        col_stride_d
+
+    switch(d_type)
+    {
+    case rocblas_datatype_f32_r:
+        return rocblas_gemm_epilogue_dequantize_launch<float>(GEMM_EPILOGUE_PARM);
+    case rocblas_datatype_f16_r:
+        return rocblas_gemm_epilogue_dequantize_launch<rocblas_half>(GEMM_EPILOGUE_PARM);
+    case rocblas_datatype_bf16_r:
+        return rocblas_gemm_epilogue_dequantize_launch<rocblas_bfloat16>(GEMM_EPILOGUE_PARM);
+    default:
+        return rocblas_status_not_implemented;
+    }
+
+#undef GEMM_EPILOGUE_PARM
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_create_gemm_epilogue(rocblas_gemm_epilogue* epilogue)
+try
+{
+    if(!epilogue)
+        return rocblas_status_invalid_pointer;
+
+    *epilogue = new _rocblas_gemm_epilogue;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_destroy_gemm_epilogue(rocblas_gemm_epilogue epilogue)
+try
+{
+    delete epilogue;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_epilogue_set_bias(rocblas_gemm_epilogue   epilogue,
+                                              const void*             bias,
+                                              rocblas_epilogue_vector vector)
+try
+{
+    if(!epilogue)
+        return rocblas_status_invalid_pointer;
+
+    if(!rocblas_epilogue_vector_valid(vector))
+        return rocblas_status_invalid_value;
+
+    epilogue->bias        = bias;
+    epilogue->bias_vector = vector;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_epilogue_set_scale(rocblas_gemm_epilogue   epilogue,
+                                               const void*             scale,
+                                               rocblas_epilogue_vector vector)
+try
+{
+    if(!epilogue)
+        return rocblas_status_invalid_pointer;
+
+    if(!rocblas_epilogue_vector_valid(vector))
+        return rocblas_status_invalid_value;
+
+    epilogue->scale        = scale;
+    epilogue->scale_vector = vector;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_epilogue_set_activation(rocblas_gemm_epilogue epilogue,
+                                                    rocblas_activation    activation)
+try
+{
+    if(!epilogue)
+        return rocblas_status_invalid_pointer;
+
+    if(activation != rocblas_activation_none && activation != rocblas_activation_relu
+       && activation != rocblas_activation_gelu)
+        return rocblas_status_invalid_value;
+
+    epilogue->activation = activation;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_epilogue_set_saturation(rocblas_gemm_epilogue epilogue, bool saturate)
+try
+{
+    if(!epilogue)
+        return rocblas_status_invalid_pointer;
+
+    epilogue->saturate = saturate;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_epilogue_set_dequantization(rocblas_gemm_epilogue epilogue,
+                                                        const float*          row_scale,
+                                                        const float*          column_scale,
+                                                        const int32_t*        row_offset,
+                                                        const int32_t*        column_offset)
+try
+{
+    if(!epilogue)
+        return rocblas_status_invalid_pointer;
+
+    epilogue->dequant_row_scale     = row_scale;
+    epilogue->dequant_column_scale  = column_scale;
+    epilogue->dequant_row_offset    = row_offset;
+    epilogue->dequant_column_offset = column_offset;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+
+/*! \brief rocblas_gemm_epilogue
+
+    \details
+    Element-wise operations applied to the result D of gemm_ex and gemm_ext2, in the order
+        D := saturate(activation(scale .* D + bias))
+    The bias and scale vectors are device arrays of compute_type, indexed by the row or by the
+    column of D. Tensile has no kernels with such an epilogue, so it is applied by a single
+    kernel which reads and writes D once after the gemm, instead of one pass per operation.
+    ********************************************************************/
+struct _rocblas_gemm_epilogue
+{
+    const void*             bias        = nullptr;
+    rocblas_epilogue_vector bias_vector = rocblas_epilogue_vector_per_row;
+
+    const void*             scale        = nullptr;
+    rocblas_epilogue_vector scale_vector = rocblas_epilogue_vector_per_row;
+
+    rocblas_activation activation = rocblas_activation_none;
+    bool               saturate   = false;
+
+    // dequantization of the int32 product of an int8 gemm
+    const float*   dequant_row_scale     = nullptr;
+    const float*   dequant_column_scale  = nullptr;
+    const int32_t* dequant_row_offset    = nullptr;
+    const int32_t* dequant_column_offset = nullptr;
+
+    // whether the epilogue leaves D unchanged
+    bool is_identity() const
+    {
+        return !bias && !scale && activation == rocblas_activation_none && !saturate;
+    }
+};
+
+/*! \brief Checks that an epilogue can be applied to a D of d_type computed in compute_type.
+
+    Returns rocblas_status_continue when it can, rocblas_status_not_implemented for the integer
+    and complex types. A nullptr epilogue is always valid.
+    ********************************************************************/
+inline rocblas_status rocblas_gemm_epilogue_check(rocblas_gemm_epilogue epilogue,
+                                                  rocblas_datatype      d_type,
+                                                  rocblas_datatype      compute_type)
+{
+    if(!epilogue || epilogue->is_identity())
+        return rocblas_status_continue;
+
+    switch(d_type)
+    {
+    case rocblas_datatype_f64_r:
+        return compute_type == rocblas_datatype_f64_r ? rocblas_status_continue
+                                                      : rocblas_status_not_implemented;
+    case rocblas_datatype_f32_r:
+    case rocblas_datatype_bf16_r:
+        return compute_type == rocblas_datatype_f32_r ? rocblas_status_continue
+                                                      : rocblas_status_not_implemented;
+    case rocblas_datatype_f16_r:
+        return compute_type == rocblas_datatype_f16_r || compute_type == rocblas_datatype_f32_r
+                   ? rocblas_status_continue
+                   : rocblas_status_not_implemented;
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+
+/*! \brief Whether a gemm_ex of these types is an int8 gemm whose int32 product is dequantized
+    to D by rocblas_gemm_epilogue_dequantize_template.
+    ********************************************************************/
+inline bool rocblas_gemm_epilogue_dequantizes(rocblas_datatype a_type,
+                                              rocblas_datatype b_type,
+                                              rocblas_datatype c_type,
+                                              rocblas_datatype d_type,
+                                              rocblas_datatype compute_type)
+{
+    return a_type == rocblas_datatype_i8_r && b_type == rocblas_datatype_i8_r && c_type == d_type
+           && compute_type == rocblas_datatype_f32_r
+           && (d_type == rocblas_datatype_f32_r || d_type == rocblas_datatype_f16_r
+               || d_type == rocblas_datatype_bf16_r);
+}
+
+/*! \brief Applies epilogue to the m by n matrix D, of d_type, whose element (i, j) is
+    D[i * row_stride_d + j * col_stride_d].
+
+    epilogue must have been checked with rocblas_gemm_epilogue_check.
+    ********************************************************************/
+rocblas_status rocblas_gemm_epilogue_template(rocblas_handle        handle,
+                                              rocblas_gemm_epilogue epilogue,
+                                              rocblas_int           m,
+                                              rocblas_int           n,
+                                              void*                 d,
+                                              rocblas_datatype      d_type,
+                                              rocblas_stride        row_stride_d,
+                                              rocblas_stride        col_stride_d,
+                                              rocblas_datatype      compute_type);
+
+/*! \brief Writes to the m by n matrix D, of d_type, the dequantization of the int32 product Q of
+    an int8 gemm followed by the other operations of epilogue, which may be nullptr.
+
+    Q is m by n with a leading dimension of m, and nullptr when alpha is 0 or k is 0, in which
+    case it is taken as 0. C, of d_type, is not read when beta is 0.
+    ********************************************************************/
+rocblas_status rocblas_gemm_epilogue_dequantize_template(rocblas_handle        handle,
+                                                         rocblas_gemm_epilogue epilogue,
+                                                         rocblas_int           m,
+                                                         rocblas_int           n,
+                                                         const int32_t*        q,
+                                                         float                 alpha,
+                                                         float                 beta,
+                                                         const void*           c,
+                                                         rocblas_stride        row_stride_c,
+                                                         rocblas_stride        col_stride_c,
+                                                         void*                 d,
+                                                         rocblas_datatype      d_type,
+                                                         rocblas_stride        row_stride_d,
+                                                         rocblas_stride        col_stride_d);
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocblas_gemm_ex.hpp"
+#include "rocblas_gemm_epilogue.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
@@ -280,6 +281,119 @@ namespace
             return gemm_ex();
         }
     }
+
+    /**
+     *  int8 gemm whose D is real: Tensile has no int8 kernels with such a D, so the int32
+     *  product of A and B goes to device memory of the handle, from which the epilogue dequantizes
+     *  it to D. alpha and beta are float.
+     */
+    rocblas_status rocblas_gemm_ex_dequantize(rocblas_handle        handle,
+                                              rocblas_operation     trans_a,
+                                              rocblas_operation     trans_b,
+                                              rocblas_int           m,
+                                              rocblas_int           n,
+                                              rocblas_int           k,
+                                              const void*           alpha,
+                                              const void*           a,
+                                              rocblas_int           lda,
+                                              const void*           b,
+                                              rocblas_int           ldb,
+                                              const void*           beta,
+                                              const void*           c,
+                                              rocblas_int           ldc,
+                                              void*                 d,
+                                              rocblas_datatype      d_type,
+                                              rocblas_int           ldd,
+                                              rocblas_gemm_algo     algo,
+                                              int32_t               solution_index,
+                                              uint32_t              flags,
+                                              rocblas_gemm_epilogue epilogue)
+    {
+        if(handle->is_device_memory_size_query())
+        {
+            if(m <= 0 || n <= 0 || k <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(sizeof(int32_t) * m * n);
+        }
+
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, k, rocblas_datatype_f32_r));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        rocblas_status validArgs = validateArgs(handle,
+                                                trans_a,
+                                                trans_b,
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                a,
+                                                lda,
+                                                b,
+                                                ldb,
+                                                beta,
+                                                c,
+                                                ldc,
+                                                d,
+                                                ldd,
+                                                rocblas_datatype_f32_r);
+        if(validArgs != rocblas_status_continue)
+            return validArgs;
+
+        float alpha_f = k ? *(const float*)alpha : 0;
+        float beta_f  = *(const float*)beta;
+
+        // Q = A * B in int32, with a leading dimension of m
+        auto w_mem = handle->device_malloc(alpha_f ? sizeof(int32_t) * m * n : 0);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(alpha_f)
+        {
+            const int32_t one = 1, zero = 0;
+            RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_ex_impl(handle,
+                                                         trans_a,
+                                                         trans_b,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         &one,
+                                                         a,
+                                                         rocblas_datatype_i8_r,
+                                                         lda,
+                                                         b,
+                                                         rocblas_datatype_i8_r,
+                                                         ldb,
+                                                         &zero,
+                                                         (int32_t*)w_mem,
+                                                         rocblas_datatype_i32_r,
+                                                         m,
+                                                         (int32_t*)w_mem,
+                                                         rocblas_datatype_i32_r,
+                                                         m,
+                                                         rocblas_datatype_i32_r,
+                                                         algo,
+                                                         solution_index,
+                                                         flags));
+        }
+
+        return rocblas_gemm_epilogue_dequantize_template(handle,
+                                                         epilogue,
+                                                         m,
+                                                         n,
+                                                         alpha_f ? (const int32_t*)w_mem : nullptr,
+                                                         alpha_f,
+                                                         beta_f,
+                                                         c,
+                                                         1,
+                                                         ldc,
+                                                         d,
+                                                         d_type,
+                                                         1,
+                                                         ldd);
+    }
 } // namespace
 
 extern "C" rocblas_status rocblas_gemm_ex(rocblas_handle    handle,
@@ -337,3 +451,94 @@ catch(...)
 {
     return exception_to_rocblas_status();
 }
+
+extern "C" rocblas_status rocblas_gemm_ex_epilogue(rocblas_handle        handle,
+                                                   rocblas_operation     trans_a,
+                                                   rocblas_operation     trans_b,
+                                                   rocblas_int           m,
+                                                   rocblas_int           n,
+                                                   rocblas_int           k,
+                                                   const void*           alpha,
+                                                   const void*           a,
+                                                   rocblas_datatype      a_type,
+                                                   rocblas_int           lda,
+                                                   const void*           b,
+                                                   rocblas_datatype      b_type,
+                                                   rocblas_int           ldb,
+                                                   const void*           beta,
+                                                   const void*           c,
+                                                   rocblas_datatype      c_type,
+                                                   rocblas_int           ldc,
+                                                   void*                 d,
+                                                   rocblas_datatype      d_type,
+                                                   rocblas_int           ldd,
+                                                   rocblas_datatype      compute_type,
+                                                   rocblas_gemm_algo     algo,
+                                                   int32_t               solution_index,
+                                                   uint32_t              flags,
+                                                   rocblas_gemm_epilogue epilogue)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(rocblas_gemm_epilogue_dequantizes(a_type, b_type, c_type, d_type, compute_type))
+        return rocblas_gemm_ex_dequantize(handle,
+                                          trans_a,
+                                          trans_b,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          a,
+                                          lda,
+                                          b,
+                                          ldb,
+                                          beta,
+                                          c,
+                                          ldc,
+                                          d,
+                                          d_type,
+                                          ldd,
+                                          algo,
+                                          solution_index,
+                                          flags,
+                                          epilogue);
+
+    rocblas_status status = rocblas_gemm_epilogue_check(epilogue, d_type, compute_type);
+    if(status != rocblas_status_continue)
+        return status;
+
+    status = rocblas_gemm_ex_impl(handle,
+                                  trans_a,
+                                  trans_b,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  a,
+                                  a_type,
+                                  lda,
+                                  b,
+                                  b_type,
+                                  ldb,
+                                  beta,
+                                  c,
+                                  c_type,
+                                  ldc,
+                                  d,
+                                  d_type,
+                                  ldd,
+                                  compute_type,
+                                  algo,
+                                  solution_index,
+                                  flags);
+    if(status != rocblas_status_success || handle->is_device_memory_size_query())
+        return status;
+
+    return rocblas_gemm_epilogue_template(handle, epilogue, m, n, d, d_type, 1, ldd, compute_type);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocblas_gemm_ext2.hpp"
+#include "rocblas_gemm_epilogue.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
@@ -546,3 +547,76 @@ catch(...)
 {
     return exception_to_rocblas_status();
 }
+
+extern "C" rocblas_status rocblas_gemm_ext2_epilogue(rocblas_handle        handle,
+                                                     rocblas_int           m,
+                                                     rocblas_int           n,
+                                                     rocblas_int           k,
+                                                     const void*           alpha,
+                                                     const void*           a,
+                                                     rocblas_datatype      a_type,
+                                                     rocblas_stride        row_stride_a,
+                                                     rocblas_stride        col_stride_a,
+                                                     const void*           b,
+                                                     rocblas_datatype      b_type,
+                                                     rocblas_stride        row_stride_b,
+                                                     rocblas_stride        col_stride_b,
+                                                     const void*           beta,
+                                                     const void*           c,
+                                                     rocblas_datatype      c_type,
+                                                     rocblas_stride        row_stride_c,
+                                                     rocblas_stride        col_stride_c,
+                                                     void*                 d,
+                                                     rocblas_datatype      d_type,
+                                                     rocblas_stride        row_stride_d,
+                                                     rocblas_stride        col_stride_d,
+                                                     rocblas_datatype      compute_type,
+                                                     rocblas_gemm_algo     algo,
+                                                     int32_t               solution_index,
+                                                     uint32_t              flags,
+                                                     rocblas_gemm_epilogue epilogue)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocblas_status status = rocblas_gemm_epilogue_check(epilogue, d_type, compute_type);
+    if(status != rocblas_status_continue)
+        return status;
+
+    status = rocblas_gemm_ext2_impl(handle,
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    a,
+                                    a_type,
+                                    row_stride_a,
+                                    col_stride_a,
+                                    b,
+                                    b_type,
+                                    row_stride_b,
+                                    col_stride_b,
+                                    beta,
+                                    c,
+                                    c_type,
+                                    row_stride_c,
+                                    col_stride_c,
+                                    d,
+                                    d_type,
+                                    row_stride_d,
+                                    col_stride_d,
+                                    compute_type,
+                                    algo,
+                                    solution_index,
+                                    flags);
+    if(status != rocblas_status_success || handle->is_device_memory_size_query())
+        return status;
+
+    return rocblas_gemm_epilogue_template(
+        handle, epilogue, m, n, d, d_type, row_stride_d, col_stride_d, compute_type);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -23,7 +23,8 @@ namespace
             return rocblas_status_invalid_handle;
         }
 
-        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB>(n, 1, execution_type);
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<NB>(
+            n, 1, execution_type, handle->accuracy_mode);
 
         if(handle->is_device_memory_size_query())
         {
@@ -26,7 +26,8 @@ namespace
         }
 
         size_t dev_bytes
-            = rocblas_reduction_kernel_workspace_size<NB>(n, batch_count, execution_type);
+            = rocblas_reduction_kernel_workspace_size<NB>(
+                n, batch_count, execution_type, handle->accuracy_mode);
 
         if(handle->is_device_memory_size_query())
         {
@@ -48,18 +48,6 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!m || !n || !batch_count || !A)
         return rocblas_status_success;
 
-    //Creating structure host object
-    rocblas_check_numerics_t h_abnormal;
-
-    //Allocating memory for device structure
-    auto d_abnormal = handle->device_malloc(sizeof(rocblas_check_numerics_t));
-
-    //Transferring the rocblas_check_numerics_t structure from host to the device
-    RETURN_IF_HIP_ERROR(hipMemcpy((rocblas_check_numerics_t*)d_abnormal,
-                                  &h_abnormal,
-                                  sizeof(rocblas_check_numerics_t),
-                                  hipMemcpyHostToDevice));
-
     //Checking trans_a to transpose a matrix 'A'
     rocblas_int num_rows_a = trans_a == rocblas_operation_none ? m : n;
     rocblas_int num_cols_a = trans_a == rocblas_operation_none ? n : m;
@@ -73,6 +61,42 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     dim3 blocks(blocks_X, blocks_Y, batch_count);
     dim3 threads(DIM_X, DIM_Y);
 
+    //Deferred mode records NaN/Inf in the handle and never synchronizes
+    if((check_numerics & rocblas_check_numerics_mode_deferred)
+       && !(check_numerics & rocblas_check_numerics_mode_stats))
+    {
+        RETURN_IF_ROCBLAS_ERROR(handle->init_check_numerics_deferred());
+
+        hipLaunchKernelGGL(rocblas_check_numerics_deferred_ge_matrix_kernel,
+                           blocks,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           num_rows_a,
+                           num_cols_a,
+                           A,
+                           offset_a,
+                           lda,
+                           stride_a,
+                           handle->get_check_numerics_function_id(function_name),
+                           is_input,
+                           handle->check_numerics_deferred_device);
+
+        return rocblas_check_numerics_deferred_readback(handle);
+    }
+
+    //Creating structure host object
+    rocblas_check_numerics_t h_abnormal;
+
+    //Allocating memory for device structure
+    auto d_abnormal = handle->device_malloc(sizeof(rocblas_check_numerics_t));
+
+    //Transferring the rocblas_check_numerics_t structure from host to the device
+    RETURN_IF_HIP_ERROR(hipMemcpy((rocblas_check_numerics_t*)d_abnormal,
+                                  &h_abnormal,
+                                  sizeof(rocblas_check_numerics_t),
+                                  hipMemcpyHostToDevice));
+
     hipLaunchKernelGGL(rocblas_check_numerics_ge_matrix_kernel,
                        blocks,
                        threads,
@@ -92,6 +116,42 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                   sizeof(rocblas_check_numerics_t),
                                   hipMemcpyDeviceToHost));
 
+    if(check_numerics & rocblas_check_numerics_mode_stats)
+    {
+        rocblas_check_numerics_stats_device_t h_stats;
+
+        auto d_stats = handle->device_malloc(sizeof(rocblas_check_numerics_stats_device_t));
+        if(!d_stats)
+            return rocblas_status_memory_error;
+
+        RETURN_IF_HIP_ERROR(hipMemcpy((rocblas_check_numerics_stats_device_t*)d_stats,
+                                      &h_stats,
+                                      sizeof(rocblas_check_numerics_stats_device_t),
+                                      hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL((rocblas_check_numerics_stats_ge_matrix_kernel<DIM_X, DIM_Y>),
+                           blocks,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           num_rows_a,
+                           num_cols_a,
+                           A,
+                           offset_a,
+                           lda,
+                           stride_a,
+                           (rocblas_check_numerics_stats_device_t*)d_stats);
+
+        rocblas_status status = rocblas_check_numerics_stats_update(
+            function_name,
+            handle,
+            check_numerics,
+            is_input,
+            (rocblas_check_numerics_stats_device_t*)d_stats);
+        if(status != rocblas_status_success)
+            return status;
+    }
+
     return rocblas_check_numerics_abnormal_struct(
         function_name, check_numerics, is_input, &h_abnormal);
 }
@@ -1,5 +1,7 @@
 #include "check_numerics_vector.hpp"
 #include "utility.hpp"
+#include <algorithm>
+#include <cstring>
 
 /**
   *
@@ -55,6 +57,102 @@ rocblas_status rocblas_check_numerics_abnormal_struct(const char*
     }
     return rocblas_status_success;
 }
+/**
+  *
+  * rocblas_check_numerics_stats_update(function_name, handle, check_numerics, is_input, d_stats)
+  *
+  * Info about rocblas_check_numerics_stats_update function:
+  *
+  *    It is the host function which copies the statistics gathered by a rocblas_check_numerics_stats_*_kernel back to the host
+  *    and merges them into the statistics the handle keeps for the Input or the Output of 'function_name'.
+  *
+  * Parameters   : function_name         : Name of the rocBLAS math function
+  *                handle                : Handle to the rocblas library context queue
+  *                check_numerics        : User defined flag for debugging
+  *                is_input              : To check if the vector/matrix under consideration is an Input or an Output
+  *                d_stats               : Device pointer to the rocblas_check_numerics_stats_device_t structure
+  *
+  * Return Value : rocblas_status
+  *
+**/
+
+rocblas_status rocblas_check_numerics_stats_update(const char*    function_name,
+                                                   rocblas_handle handle,
+                                                   const int      check_numerics,
+                                                   bool           is_input,
+                                                   rocblas_check_numerics_stats_device_t* d_stats)
+{
+    rocblas_check_numerics_stats_device_t h_stats;
+    RETURN_IF_HIP_ERROR(hipMemcpy(&h_stats,
+                                  d_stats,
+                                  sizeof(rocblas_check_numerics_stats_device_t),
+                                  hipMemcpyDeviceToHost));
+
+    auto& stats = handle->check_numerics_stats[std::make_pair(std::string(function_name), is_input)];
+
+    double min_magnitude, max_magnitude;
+    std::memcpy(&min_magnitude, &h_stats.min_magnitude_bits, sizeof(double));
+    std::memcpy(&max_magnitude, &h_stats.max_magnitude_bits, sizeof(double));
+
+    // min_magnitude_bits is still +Inf if there was no finite nonzero value
+    bool has_finite_nonzero = h_stats.max_magnitude_bits != 0;
+    bool had_finite_nonzero = stats.max_magnitude != 0;
+    if(has_finite_nonzero)
+    {
+        stats.min_magnitude = had_finite_nonzero ? std::min(stats.min_magnitude, min_magnitude)
+                                                 : min_magnitude;
+        stats.max_magnitude = std::max(stats.max_magnitude, max_magnitude);
+    }
+
+    stats.num_calls += 1;
+    stats.num_elements += h_stats.num_elements;
+    stats.num_zero += h_stats.num_zero;
+    stats.num_denormal += h_stats.num_denormal;
+    stats.num_NaN += h_stats.num_NaN;
+    stats.num_Inf += h_stats.num_Inf;
+    for(int i = 0; i < ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS; i++)
+        stats.exponent_histogram[i] += h_stats.exponent_histogram[i];
+
+    if((check_numerics & rocblas_check_numerics_mode_info) != 0)
+    {
+        rocblas_cerr << "Funtion name:\t" << function_name
+                     << (is_input ? " :- Input :\t" : " :- Output :\t") << " num_elements "
+                     << h_stats.num_elements << " num_denormal " << h_stats.num_denormal
+                     << " min_magnitude " << (has_finite_nonzero ? min_magnitude : 0.0)
+                     << " max_magnitude " << max_magnitude << std::endl;
+    }
+
+    return rocblas_status_success;
+}
+
+/**
+  *
+  * rocblas_check_numerics_deferred_readback(handle)
+  *
+  * Info about rocblas_check_numerics_deferred_readback function:
+  *
+  *    It is the host function which queues an asynchronous copy of the rocblas_check_numerics_mode_deferred record
+  *    of the handle to its pinned host mirror, and records the event which rocblas_check_numerics_poll queries
+  *    to know when the mirror is up to date. Nothing is synchronized.
+  *
+  * Parameters   : handle                : Handle to the rocblas library context queue
+  *
+  * Return Value : rocblas_status
+  *
+**/
+
+rocblas_status rocblas_check_numerics_deferred_readback(rocblas_handle handle)
+{
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(handle->check_numerics_deferred_host,
+                                       handle->check_numerics_deferred_device,
+                                       sizeof(rocblas_check_numerics_deferred_t),
+                                       hipMemcpyDeviceToHost,
+                                       handle->get_stream()));
+    RETURN_IF_HIP_ERROR(
+        hipEventRecord(handle->check_numerics_deferred_event, handle->get_stream()));
+    return rocblas_status_success;
+}
+
 /**
   *
   * rocblas_internal_check_numerics_vector_template(function_name, handle, n, x, offset_x, inc_x, stride_x, batch_count, check_numerics, is_input)
@@ -100,6 +198,34 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_success;
     }
 
+    hipStream_t           rocblas_stream = handle->get_stream();
+    constexpr rocblas_int NB             = 256;
+    dim3                  blocks((n - 1) / NB + 1, batch_count);
+    dim3                  threads(NB);
+
+    //Deferred mode records NaN/Inf in the handle and never synchronizes
+    if((check_numerics & rocblas_check_numerics_mode_deferred)
+       && !(check_numerics & rocblas_check_numerics_mode_stats))
+    {
+        RETURN_IF_ROCBLAS_ERROR(handle->init_check_numerics_deferred());
+
+        hipLaunchKernelGGL(rocblas_check_numerics_deferred_vector_kernel,
+                           blocks,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           n,
+                           x,
+                           offset_x,
+                           inc_x,
+                           stride_x,
+                           handle->get_check_numerics_function_id(function_name),
+                           is_input,
+                           handle->check_numerics_deferred_device);
+
+        return rocblas_check_numerics_deferred_readback(handle);
+    }
+
     //Creating structure host object
     rocblas_check_numerics_t h_abnormal;
 
@@ -112,11 +238,6 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                   sizeof(rocblas_check_numerics_t),
                                   hipMemcpyHostToDevice));
 
-    hipStream_t           rocblas_stream = handle->get_stream();
-    constexpr rocblas_int NB             = 256;
-    dim3                  blocks((n - 1) / NB + 1, batch_count);
-    dim3                  threads(NB);
-
     hipLaunchKernelGGL(rocblas_check_numerics_vector_kernel,
                        blocks,
                        threads,
@@ -135,6 +256,41 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                   sizeof(rocblas_check_numerics_t),
                                   hipMemcpyDeviceToHost));
 
+    if(check_numerics & rocblas_check_numerics_mode_stats)
+    {
+        rocblas_check_numerics_stats_device_t h_stats;
+
+        auto d_stats = handle->device_malloc(sizeof(rocblas_check_numerics_stats_device_t));
+        if(!d_stats)
+            return rocblas_status_memory_error;
+
+        RETURN_IF_HIP_ERROR(hipMemcpy((rocblas_check_numerics_stats_device_t*)d_stats,
+                                      &h_stats,
+                                      sizeof(rocblas_check_numerics_stats_device_t),
+                                      hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(rocblas_check_numerics_stats_vector_kernel<NB>,
+                           blocks,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           n,
+                           x,
+                           offset_x,
+                           inc_x,
+                           stride_x,
+                           (rocblas_check_numerics_stats_device_t*)d_stats);
+
+        rocblas_status status = rocblas_check_numerics_stats_update(
+            function_name,
+            handle,
+            check_numerics,
+            is_input,
+            (rocblas_check_numerics_stats_device_t*)d_stats);
+        if(status != rocblas_status_success)
+            return status;
+    }
+
     return rocblas_check_numerics_abnormal_struct(
         function_name, check_numerics, is_input, &h_abnormal);
 }
@@ -58,20 +58,27 @@ static inline int getActiveDevice()
     return device;
 }
 
-static inline int getActiveArch(int deviceId)
+static inline hipDeviceProp_t getActiveProperties()
 {
-    hipDeviceProp_t deviceProperties;
-    hipGetDeviceProperties(&deviceProperties, deviceId);
-    return deviceProperties.gcnArch;
+    // zeroed properties, if they cannot be read, give no CU
+    hipDeviceProp_t deviceProperties{};
+    hipGetDeviceProperties(&deviceProperties, getActiveDevice());
+    return deviceProperties;
 }
 
 /*******************************************************************************
  * constructor
  ******************************************************************************/
 _rocblas_handle::_rocblas_handle()
-    : device(getActiveDevice())
+    : _rocblas_handle(getActiveDevice(), getActiveProperties())
+{
+}
+
+_rocblas_handle::_rocblas_handle(int device, const hipDeviceProp_t& properties)
+    : device(device)
     , // active device is handle device
-    arch(getActiveArch(device))
+    arch(properties.gcnArch)
+    , cu_count(properties.multiProcessorCount)
 {
 #if BUILD_WITH_TENSILE
 #ifndef USE_TENSILE_HOST
@@ -130,6 +137,19 @@ _rocblas_handle::~_rocblas_handle()
         rocblas_abort();
     }
 
+    // Free the trsv and trsm inverse caches and the packed unpack cache
+    trsv_inverse_cache.clear();
+    trsm_inverse_cache.clear();
+    packed_unpack_cache.clear();
+
+    // Free the state of rocblas_check_numerics_mode_deferred
+    if(check_numerics_deferred_event)
+        hipEventDestroy(check_numerics_deferred_event);
+    if(check_numerics_deferred_host)
+        hipHostFree(check_numerics_deferred_host);
+    if(check_numerics_deferred_device)
+        (hipFree)(check_numerics_deferred_device);
+
     // Free device memory unless it's user-owned
     if(device_memory_owner != rocblas_device_memory_ownership::user_owned)
     {
@@ -644,3 +664,113 @@ void _rocblas_handle::init_check_numerics()
             = static_cast<rocblas_check_numerics_mode>(strtol(str_check_numerics_mode, 0, 0));
     }
 }
+
+/*******************************************************************************
+ * Deferred numerics checking: allocate the device record and its pinned host
+ * mirror the first time rocblas_check_numerics_mode_deferred is used
+ ******************************************************************************/
+rocblas_status _rocblas_handle::init_check_numerics_deferred()
+{
+    if(check_numerics_deferred_device)
+        return rocblas_status_success;
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    auto saved_device_id = push_device_id();
+
+    rocblas_check_numerics_deferred_t h_deferred;
+
+    void* d_ptr = nullptr;
+    void* h_ptr = nullptr;
+    RETURN_IF_HIP_ERROR((hipMalloc)(&d_ptr, sizeof(rocblas_check_numerics_deferred_t)));
+    hipError_t hip_status = hipHostMalloc(&h_ptr, sizeof(rocblas_check_numerics_deferred_t));
+    if(hip_status == hipSuccess)
+        hip_status = hipEventCreateWithFlags(&check_numerics_deferred_event, hipEventDisableTiming);
+    if(hip_status == hipSuccess)
+        hip_status = hipMemcpy(
+            d_ptr, &h_deferred, sizeof(rocblas_check_numerics_deferred_t), hipMemcpyHostToDevice);
+    if(hip_status != hipSuccess)
+    {
+        if(check_numerics_deferred_event)
+            hipEventDestroy(check_numerics_deferred_event);
+        check_numerics_deferred_event = nullptr;
+        if(h_ptr)
+            hipHostFree(h_ptr);
+        (hipFree)(d_ptr);
+        return get_rocblas_status_for_hip_status(hip_status);
+    }
+
+    check_numerics_deferred_device  = static_cast<rocblas_check_numerics_deferred_t*>(d_ptr);
+    check_numerics_deferred_host    = new(h_ptr) rocblas_check_numerics_deferred_t;
+    return rocblas_status_success;
+}
+
+int _rocblas_handle::get_check_numerics_function_id(const char* function_name)
+{
+    auto it = check_numerics_function_ids.emplace(function_name,
+                                                  int(check_numerics_function_names.size()));
+    if(it.second)
+        check_numerics_function_names.push_back(&it.first->first);
+    return it.first->second;
+}
+
+template <typename KEY>
+void* rocblas_device_cache<KEY>::find(const KEY& key)
+{
+    for(auto it = entries.begin(); it != entries.end(); ++it)
+        if(it->key == key)
+        {
+            entries.splice(entries.begin(), entries, it);
+            return it->data;
+        }
+    return nullptr;
+}
+
+template <typename KEY>
+void rocblas_device_cache<KEY>::insert(const KEY&  key,
+                                       const void* data,
+                                       size_t      bytes,
+                                       hipStream_t stream)
+{
+    if(bytes > size)
+        return;
+
+    // hipFree waits for the kernels which may still read the evicted data
+    while(entries_bytes + bytes > size)
+    {
+        (hipFree)(entries.back().data);
+        entries_bytes -= entries.back().bytes;
+        entries.pop_back();
+    }
+
+    void* cached = nullptr;
+    if((hipMalloc)(&cached, bytes) != hipSuccess)
+        return;
+
+    if(hipMemcpyAsync(cached, data, bytes, hipMemcpyDeviceToDevice, stream) != hipSuccess)
+    {
+        (hipFree)(cached);
+        return;
+    }
+
+    entries.push_front({key, cached, bytes});
+    entries_bytes += bytes;
+}
+
+template <typename KEY>
+void rocblas_device_cache<KEY>::clear(const void* A)
+{
+    for(auto it = entries.begin(); it != entries.end();)
+    {
+        if(A && it->key.A != A)
+        {
+            ++it;
+            continue;
+        }
+        (hipFree)(it->data);
+        entries_bytes -= it->bytes;
+        it = entries.erase(it);
+    }
+}
+
+template class rocblas_device_cache<rocblas_inverse_key>;
+template class rocblas_device_cache<rocblas_unpack_key>;
@@ -55,6 +55,103 @@ ROCBLAS_KERNEL void rocblas_check_numerics_ge_matrix_kernel(rocblas_int
             abnormal->has_Inf = true;
     }
 }
+/**
+  *
+  * rocblas_check_numerics_deferred_ge_matrix_kernel(m, n, Aa, offset_a, lda, stride_a, function_id, is_input, deferred)
+  *
+  * Info about rocblas_check_numerics_deferred_ge_matrix_kernel function:
+  *
+  *    It is the kernel function which checks a general matrix for NaN/Inf and records the first offending element in the
+  *    per-handle record of rocblas_check_numerics_mode_deferred, without any synchronization with the host.
+  *
+  * Parameters   : m            : number of rows of matrix 'A'
+  *                n            : number of columns of matrix 'A'
+  *                Aa           : Pointer to the matrix which is under consideration for numerical abnormalities
+  *                offset_a     : Offset of matrix 'Aa'
+  *                lda          : specifies the leading dimension of matrix 'Aa'
+  *                stride_a     : Specifies the pointer increment between one matrix 'A_i' and the next one (Aa_i+1) (where (Aa_i) is the i-th instance of the batch)
+  *                function_id  : Id of the rocBLAS function name in the handle
+  *                is_input     : To check if the matrix under consideration is an Input or an Output matrix
+  *                deferred     : Device pointer to the rocblas_check_numerics_deferred_t record of the handle
+  *
+  * Return Value : Nothing --
+  *
+**/
+
+template <typename T>
+ROCBLAS_KERNEL void
+    rocblas_check_numerics_deferred_ge_matrix_kernel(rocblas_int                        m,
+                                                     rocblas_int                        n,
+                                                     T                                  Aa,
+                                                     ptrdiff_t                          offset_a,
+                                                     rocblas_int                        lda,
+                                                     rocblas_stride                     stride_a,
+                                                     int                                function_id,
+                                                     bool                               is_input,
+                                                     rocblas_check_numerics_deferred_t* deferred)
+{
+    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(tx < m && ty < n)
+    {
+        auto* A = load_ptr_batch(Aa, hipBlockIdx_z, offset_a, stride_a);
+
+        ptrdiff_t tid = tx + ptrdiff_t(lda) * ty;
+        rocblas_check_numerics_deferred_add(
+            deferred, A[tid], function_id, is_input, (const void*)Aa, hipBlockIdx_z, tid);
+    }
+}
+
+/**
+  *
+  * rocblas_check_numerics_stats_ge_matrix_kernel(m, n, Aa, offset_a, lda, stride_a, stats)
+  *
+  * Info about rocblas_check_numerics_stats_ge_matrix_kernel function:
+  *
+  *    It is the kernel function which gathers the magnitude range, denormal count and exponent histogram of a general matrix.
+  *    Each block accumulates in LDS and flushes its partial statistics to 'stats' with atomics.
+  *
+  * Parameters   : m            : number of rows of matrix 'A'
+  *                n            : number of columns of matrix 'A'
+  *                Aa           : Pointer to the matrix which is under consideration
+  *                offset_a     : Offset of matrix 'Aa'
+  *                lda          : specifies the leading dimension of matrix 'Aa'
+  *                stride_a     : Specifies the pointer increment between one matrix 'A_i' and the next one (Aa_i+1) (where (Aa_i) is the i-th instance of the batch)
+  *                stats        : Device pointer to the rocblas_check_numerics_stats_device_t structure
+  *
+  * Return Value : Nothing --
+  *
+**/
+
+template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
+ROCBLAS_KERNEL __launch_bounds__(DIM_X* DIM_Y) void rocblas_check_numerics_stats_ge_matrix_kernel(
+    rocblas_int                            m,
+    rocblas_int                            n,
+    T                                      Aa,
+    ptrdiff_t                              offset_a,
+    rocblas_int                            lda,
+    rocblas_stride                         stride_a,
+    rocblas_check_numerics_stats_device_t* stats)
+{
+    __shared__ rocblas_check_numerics_stats_block lds;
+    rocblas_int tid = hipThreadIdx_x + hipThreadIdx_y * DIM_X;
+    rocblas_check_numerics_stats_block_init(lds, tid, DIM_X * DIM_Y);
+    __syncthreads();
+
+    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(tx < m && ty < n)
+    {
+        auto* A = load_ptr_batch(Aa, hipBlockIdx_z, offset_a, stride_a);
+        rocblas_check_numerics_stats_add(lds, A[tx + ptrdiff_t(lda) * ty]);
+    }
+    __syncthreads();
+
+    rocblas_check_numerics_stats_block_flush(lds, tid, DIM_X * DIM_Y, stats);
+}
+
 template <typename T>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_check_numerics_ge_matrix_template(const char*       function_name,
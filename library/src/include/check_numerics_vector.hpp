@@ -51,6 +51,235 @@ ROCBLAS_KERNEL void rocblas_check_numerics_vector_kernel(rocblas_int
     }
 }
 
+// Per-block staging of the rocblas_check_numerics_mode_stats statistics in LDS
+struct rocblas_check_numerics_stats_block
+{
+    unsigned int       num_elements;
+    unsigned int       num_zero;
+    unsigned int       num_denormal;
+    unsigned int       num_NaN;
+    unsigned int       num_Inf;
+    unsigned long long min_magnitude_bits;
+    unsigned long long max_magnitude_bits;
+    unsigned int       exponent_histogram[ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS];
+};
+
+template <typename T>
+__device__ inline double rocblas_check_numerics_to_double(T x)
+{
+    return double(x);
+}
+
+__device__ inline double rocblas_check_numerics_to_double(rocblas_bfloat16 x)
+{
+    return double(float(x));
+}
+
+// Clear the LDS statistics of the block, tid and nthreads are the flattened thread index and block size
+__device__ inline void rocblas_check_numerics_stats_block_init(rocblas_check_numerics_stats_block& lds,
+                                                               rocblas_int                         tid,
+                                                               rocblas_int nthreads)
+{
+    if(tid == 0)
+    {
+        lds.num_elements       = 0;
+        lds.num_zero           = 0;
+        lds.num_denormal       = 0;
+        lds.num_NaN            = 0;
+        lds.num_Inf            = 0;
+        lds.min_magnitude_bits = 0x7ff0000000000000ULL;
+        lds.max_magnitude_bits = 0;
+    }
+    for(rocblas_int i = tid; i < ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS; i += nthreads)
+        lds.exponent_histogram[i] = 0;
+}
+
+// Add one real value to the LDS statistics of the block
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ inline void rocblas_check_numerics_stats_add(rocblas_check_numerics_stats_block& lds,
+                                                        T                                   value)
+{
+    atomicAdd(&lds.num_elements, 1u);
+    if(rocblas_isnan(value))
+        atomicAdd(&lds.num_NaN, 1u);
+    else if(rocblas_isinf(value))
+        atomicAdd(&lds.num_Inf, 1u);
+    else if(rocblas_iszero(value))
+        atomicAdd(&lds.num_zero, 1u);
+    else
+    {
+        if(rocblas_isdenorm(value))
+            atomicAdd(&lds.num_denormal, 1u);
+
+        double magnitude = fabs(rocblas_check_numerics_to_double(value));
+        auto   bits      = (unsigned long long)__double_as_longlong(magnitude);
+        atomicMin(&lds.min_magnitude_bits, bits);
+        atomicMax(&lds.max_magnitude_bits, bits);
+
+        int bin = ilogb(magnitude) - ROCBLAS_CHECK_NUMERICS_EXPONENT_MIN;
+        bin     = bin < 0 ? 0
+                          : bin >= ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS
+                                ? ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS - 1
+                                : bin;
+        atomicAdd(&lds.exponent_histogram[bin], 1u);
+    }
+}
+
+// Complex values are counted per real and imaginary part
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ inline void rocblas_check_numerics_stats_add(rocblas_check_numerics_stats_block& lds,
+                                                        const T&                            value)
+{
+    rocblas_check_numerics_stats_add(lds, std::real(value));
+    rocblas_check_numerics_stats_add(lds, std::imag(value));
+}
+
+// Flush the LDS statistics of the block to the global statistics
+__device__ inline void
+    rocblas_check_numerics_stats_block_flush(const rocblas_check_numerics_stats_block& lds,
+                                             rocblas_int                               tid,
+                                             rocblas_int                               nthreads,
+                                             rocblas_check_numerics_stats_device_t*    stats)
+{
+    if(tid == 0 && lds.num_elements)
+    {
+        atomicAdd(&stats->num_elements, (unsigned long long)lds.num_elements);
+        atomicAdd(&stats->num_zero, (unsigned long long)lds.num_zero);
+        atomicAdd(&stats->num_denormal, (unsigned long long)lds.num_denormal);
+        atomicAdd(&stats->num_NaN, (unsigned long long)lds.num_NaN);
+        atomicAdd(&stats->num_Inf, (unsigned long long)lds.num_Inf);
+        atomicMin(&stats->min_magnitude_bits, lds.min_magnitude_bits);
+        atomicMax(&stats->max_magnitude_bits, lds.max_magnitude_bits);
+    }
+    for(rocblas_int i = tid; i < ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS; i += nthreads)
+        if(lds.exponent_histogram[i])
+            atomicAdd(&stats->exponent_histogram[i],
+                      (unsigned long long)lds.exponent_histogram[i]);
+}
+
+/**
+  *
+  * rocblas_check_numerics_stats_vector_kernel(n, xa, offset_x, inc_x, stride_x, stats)
+  *
+  * Info about rocblas_check_numerics_stats_vector_kernel function:
+  *
+  *    It is the kernel function which gathers the magnitude range, denormal count and exponent histogram of a vector.
+  *    Each block accumulates in LDS and flushes its partial statistics to 'stats' with atomics.
+  *
+  * Parameters   : n            : Total number of elements in the vector
+  *                xa           : Pointer to the vector which is under consideration
+  *                offset_x     : Offset of vector 'xa'
+  *                inc_x        : Stride between consecutive values of vector 'xa'
+  *                stride_x     : Specifies the pointer increment between one vector 'x_i' and the next one (xa_i+1) (where (xa_i) is the i-th instance of the batch)
+  *                stats        : Device pointer to the rocblas_check_numerics_stats_device_t structure
+  *
+  * Return Value : Nothing --
+  *
+**/
+
+template <rocblas_int NB, typename T>
+ROCBLAS_KERNEL __launch_bounds__(NB) void rocblas_check_numerics_stats_vector_kernel(
+    rocblas_int                            n,
+    T                                      xa,
+    ptrdiff_t                              offset_x,
+    rocblas_int                            inc_x,
+    rocblas_stride                         stride_x,
+    rocblas_check_numerics_stats_device_t* stats)
+{
+    __shared__ rocblas_check_numerics_stats_block lds;
+    rocblas_check_numerics_stats_block_init(lds, hipThreadIdx_x, NB);
+    __syncthreads();
+
+    auto*     x   = load_ptr_batch(xa, hipBlockIdx_y, offset_x, stride_x);
+    ptrdiff_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(tid < n)
+        rocblas_check_numerics_stats_add(lds, x[tid * inc_x]);
+    __syncthreads();
+
+    rocblas_check_numerics_stats_block_flush(lds, hipThreadIdx_x, NB, stats);
+}
+
+// Claim the deferred record if value is a NaN or an Inf and no earlier check has claimed it
+template <typename T>
+__device__ inline void
+    rocblas_check_numerics_deferred_add(rocblas_check_numerics_deferred_t* deferred,
+                                        T                                  value,
+                                        int                                function_id,
+                                        bool                               is_input,
+                                        const void*                        operand,
+                                        rocblas_int                        batch_index,
+                                        int64_t                            element_index)
+{
+    bool has_NaN = rocblas_isnan(value);
+    bool has_Inf = rocblas_isinf(value);
+    if((has_NaN || has_Inf) && !*(volatile int*)&deferred->failed
+       && !atomicCAS(&deferred->failed, 0, 1))
+    {
+        deferred->function_id   = function_id;
+        deferred->is_input      = is_input;
+        deferred->has_NaN       = has_NaN;
+        deferred->has_Inf       = has_Inf;
+        deferred->operand       = operand;
+        deferred->batch_index   = batch_index;
+        deferred->element_index = element_index;
+    }
+}
+
+/**
+  *
+  * rocblas_check_numerics_deferred_vector_kernel(n, xa, offset_x, inc_x, stride_x, function_id, is_input, deferred)
+  *
+  * Info about rocblas_check_numerics_deferred_vector_kernel function:
+  *
+  *    It is the kernel function which checks a vector for NaN/Inf and records the first offending element in the
+  *    per-handle record of rocblas_check_numerics_mode_deferred, without any synchronization with the host.
+  *
+  * Parameters   : n            : Total number of elements in the vector
+  *                xa           : Pointer to the vector which is under consideration for numerical abnormalities
+  *                offset_x     : Offset of vector 'xa'
+  *                inc_x        : Stride between consecutive values of vector 'xa'
+  *                stride_x     : Specifies the pointer increment between one vector 'x_i' and the next one (xa_i+1) (where (xa_i) is the i-th instance of the batch)
+  *                function_id  : Id of the rocBLAS function name in the handle
+  *                is_input     : To check if the vector under consideration is an Input or an Output vector
+  *                deferred     : Device pointer to the rocblas_check_numerics_deferred_t record of the handle
+  *
+  * Return Value : Nothing --
+  *
+**/
+
+template <typename T>
+ROCBLAS_KERNEL void
+    rocblas_check_numerics_deferred_vector_kernel(rocblas_int                        n,
+                                                  T                                  xa,
+                                                  ptrdiff_t                          offset_x,
+                                                  rocblas_int                        inc_x,
+                                                  rocblas_stride                     stride_x,
+                                                  int                                function_id,
+                                                  bool                               is_input,
+                                                  rocblas_check_numerics_deferred_t* deferred)
+{
+    auto*     x   = load_ptr_batch(xa, hipBlockIdx_y, offset_x, stride_x);
+    ptrdiff_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(tid < n)
+        rocblas_check_numerics_deferred_add(deferred,
+                                            x[tid * inc_x],
+                                            function_id,
+                                            is_input,
+                                            (const void*)xa,
+                                            hipBlockIdx_y,
+                                            tid * inc_x);
+}
+
+// Queue the copy of the deferred record to its host mirror, followed by the event polled by rocblas_check_numerics_poll
+rocblas_status rocblas_check_numerics_deferred_readback(rocblas_handle handle);
+
+rocblas_status rocblas_check_numerics_stats_update(const char*    function_name,
+                                                   rocblas_handle handle,
+                                                   const int      check_numerics,
+                                                   bool           is_input,
+                                                   rocblas_check_numerics_stats_device_t* d_stats);
+
 rocblas_status rocblas_check_numerics_abnormal_struct(const char*               function_name,
                                                       const int                 check_numerics,
                                                       bool                      is_input,
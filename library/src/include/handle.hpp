@@ -10,10 +10,15 @@
 #include "utility.hpp"
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <hip/hip_runtime.h>
+#include <list>
+#include <map>
 #include <memory>
+#include <string>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 #ifdef WIN32
 #include <stdio.h>
 #define STDOUT_FILENO _fileno(stdout)
@@ -26,6 +31,9 @@
 // forcing early cleanup
 extern "C" ROCBLAS_EXPORT void rocblas_shutdown();
 
+// value of an environment variable, or nullptr if it is not set
+const char* read_env(const char* env_var);
+
 // Whether rocBLAS can reallocate device memory on demand, at the cost of only
 // allowing one allocation at a time, and at the cost of potential synchronization.
 // If this is 0, then stack-like allocation is allowed, but reallocation on demand
@@ -55,6 +63,81 @@ enum class rocblas_device_memory_ownership
 // helper function in handle.cpp
 static rocblas_status free_existing_device_memory(rocblas_handle);
 
+// Identifies the inverses of the diagonal blocks of a triangular matrix of size m kept by the
+// handle for trsv or trsm. precision is a rocblas_precision_string, version the version of the
+// cache at the time of the solve.
+struct rocblas_inverse_key
+{
+    const void*      A;
+    rocblas_int      m;
+    rocblas_int      lda;
+    rocblas_fill     uplo;
+    rocblas_diagonal diag;
+    rocblas_int      block;
+    const char*      precision;
+    int64_t          version;
+
+    bool operator==(const rocblas_inverse_key& other) const
+    {
+        return A == other.A && m == other.m && lda == other.lda && uplo == other.uplo
+               && diag == other.diag && block == other.block && version == other.version
+               && !strcmp(precision, other.precision);
+    }
+};
+
+// Identifies the unpacked copy of a packed matrix A of size n kept by the handle in the
+// rocblas_packed_unpack mode. precision is a rocblas_precision_string, version the version of
+// the cache at the time of the call.
+struct rocblas_unpack_key
+{
+    const void*  A;
+    rocblas_int  n;
+    rocblas_fill uplo;
+    const char*  precision;
+    int64_t      version;
+
+    bool operator==(const rocblas_unpack_key& other) const
+    {
+        return A == other.A && n == other.n && uplo == other.uplo && version == other.version
+               && !strcmp(precision, other.precision);
+    }
+};
+
+// Device memory derived from a matrix and kept across calls, up to size bytes: the inverses of
+// the diagonal blocks of triangular matrices, or the unpacked copies of packed matrices. Entries
+// are ordered from most to least recently used.
+template <typename KEY>
+class rocblas_device_cache
+{
+public:
+    size_t  size    = 0;
+    int64_t version = 0;
+
+    // cached data of key, or nullptr. A hit becomes the most recently used entry.
+    void* find(const KEY& key);
+
+    // copies the bytes of data into a new entry for key, on stream, evicting the least recently
+    // used entries to stay within size. data is not cached if it does not fit, or if the
+    // allocation fails.
+    void insert(const KEY& key, const void* data, size_t bytes, hipStream_t stream);
+
+    // frees the cached data of the matrix A, or all the cached data if A is nullptr
+    void clear(const void* A = nullptr);
+
+private:
+    struct entry
+    {
+        KEY    key;
+        void*  data;
+        size_t bytes;
+    };
+    std::list<entry> entries;
+    size_t           entries_bytes = 0;
+};
+
+using rocblas_inverse_cache = rocblas_device_cache<rocblas_inverse_key>;
+using rocblas_unpack_cache  = rocblas_device_cache<rocblas_unpack_key>;
+
 /*******************************************************************************
  * \brief rocblas_handle is a structure holding the rocblas library context.
  * It must be initialized using rocblas_create_handle() and the returned handle mus
@@ -157,6 +240,9 @@ private:
     };
     // clang-format on
 
+    // the handle of device, whose properties are read once by the public constructor
+    _rocblas_handle(int device, const hipDeviceProp_t& properties);
+
 public:
     _rocblas_handle();
     ~_rocblas_handle();
@@ -180,6 +266,11 @@ public:
         return arch;
     }
 
+    int getCUCount()
+    {
+        return cu_count;
+    }
+
     // hipEvent_t pointers (for internal use only)
     hipEvent_t startEvent = nullptr;
     hipEvent_t stopEvent  = nullptr;
@@ -193,12 +284,49 @@ public:
     // default atomics mode allows atomic operations
     rocblas_atomics_mode atomics_mode = rocblas_atomics_allowed;
 
+    // default reduction mode uses the fastest summation order
+    rocblas_reduction_mode reduction_mode = rocblas_reduction_default;
+
+    // default accuracy mode accumulates reductions in the computation type
+    rocblas_accuracy_mode accuracy_mode = rocblas_accuracy_default;
+
+    // default packed mode indexes packed matrices directly
+    rocblas_packed_mode packed_mode = rocblas_packed_default;
+
     // Selects the benchmark library to be used for solution selection
     rocblas_performance_metric performance_metric = rocblas_default_performance_metric;
 
     // default check_numerics_mode is no numeric_check
     rocblas_check_numerics_mode check_numerics = rocblas_check_numerics_mode_no_check;
 
+    // statistics gathered by rocblas_check_numerics_mode_stats, keyed by function name and is_input
+    std::map<std::pair<std::string, bool>, rocblas_check_numerics_stats> check_numerics_stats;
+
+    // state of rocblas_check_numerics_mode_deferred, allocated on first use:
+    // the device record, its pinned host mirror, and the event recorded after the last mirror update
+    rocblas_check_numerics_deferred_t* check_numerics_deferred_device = nullptr;
+    rocblas_check_numerics_deferred_t* check_numerics_deferred_host   = nullptr;
+    hipEvent_t                         check_numerics_deferred_event  = nullptr;
+    rocblas_status                     init_check_numerics_deferred();
+
+    // small integer ids for the function names recorded by rocblas_check_numerics_mode_deferred
+    int         get_check_numerics_function_id(const char* function_name);
+    const char* get_check_numerics_function_name(int function_id) const
+    {
+        return function_id >= 0 && size_t(function_id) < check_numerics_function_names.size()
+                   ? check_numerics_function_names[function_id]->c_str()
+                   : nullptr;
+    }
+
+    // inverses of the diagonal blocks of trsv and trsm matrices kept across calls, enabled by a
+    // non-zero rocblas_set_trsv_inverse_cache_size and rocblas_set_trsm_inverse_cache_size
+    rocblas_inverse_cache trsv_inverse_cache;
+    rocblas_inverse_cache trsm_inverse_cache;
+
+    // unpacked copies of the packed matrices of the rocblas_packed_unpack mode kept across calls,
+    // enabled by a non-zero rocblas_set_packed_unpack_cache_size
+    rocblas_unpack_cache packed_unpack_cache;
+
     // logging streams
     std::unique_ptr<rocblas_internal_ostream> log_trace_os;
     std::unique_ptr<rocblas_internal_ostream> log_bench_os;
@@ -296,6 +424,10 @@ private:
     // Solution fitness query (used for internal testing)
     double* solution_fitness_query = nullptr;
 
+    // Interned function names for rocblas_check_numerics_mode_deferred; map nodes are stable
+    std::map<std::string, int>      check_numerics_function_ids;
+    std::vector<const std::string*> check_numerics_function_names;
+
     // rocblas by default take the system default stream 0 users cannot create
     hipStream_t stream = 0;
 
@@ -310,6 +442,10 @@ private:
     // Arch ID is created at handle creation time and remains in effect for the life of the handle.
     const int arch;
 
+    // Number of compute units of the device, read with the arch ID at handle creation time, so
+    // that kernels sized to fill the device do not query it at every call.
+    const int cu_count;
+
     // Opaque smart allocator class to perform device memory allocations
     // clang-format off
     class [[nodiscard]] _device_malloc : public rocblas_device_malloc_base
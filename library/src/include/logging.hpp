@@ -163,10 +163,21 @@ void log_trace(rocblas_handle handle, Ts&&... xs)
 template <typename... Ts>
 void log_bench(rocblas_handle handle, Ts&&... xs)
 {
+    // handle modes which differ from the rocblas-bench defaults are appended as switches
+    std::string mode_flags;
     if(handle->atomics_mode == rocblas_atomics_not_allowed)
-        log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)..., "--atomics_not_allowed");
-    else
+        mode_flags += " --atomics_not_allowed";
+    if(handle->reduction_mode == rocblas_reduction_reproducible)
+        mode_flags += " --reduction_reproducible";
+    if(handle->accuracy_mode == rocblas_accuracy_compensated)
+        mode_flags += " --accuracy_compensated";
+    if(handle->packed_mode == rocblas_packed_unpack)
+        mode_flags += " --packed_unpack";
+
+    if(mode_flags.empty())
         log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)...);
+    else
+        log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)..., mode_flags.c_str() + 1);
 }
 
 /*************************************************
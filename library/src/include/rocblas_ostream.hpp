@@ -446,6 +446,30 @@ public:
         return os;
     }
 
+    // reduction mode output
+    friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
+                                                rocblas_reduction_mode    mode)
+    {
+        os.os << rocblas_reduction_mode_to_string(mode);
+        return os;
+    }
+
+    // accuracy mode output
+    friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
+                                                rocblas_accuracy_mode     mode)
+    {
+        os.os << rocblas_accuracy_mode_to_string(mode);
+        return os;
+    }
+
+    // packed mode output
+    friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
+                                                rocblas_packed_mode       mode)
+    {
+        os.os << rocblas_packed_mode_to_string(mode);
+        return os;
+    }
+
     // gemm flags output
     friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
                                                 rocblas_gemm_flags        flags)
@@ -11,6 +11,7 @@
 #include <complex>
 #include <exception>
 #include <hip/hip_runtime.h>
+#include <limits>
 #include <new>
 #include <type_traits>
 
@@ -291,6 +292,24 @@ constexpr const char* rocblas_atomics_mode_to_string(rocblas_atomics_mode mode)
     return mode != rocblas_atomics_not_allowed ? "atomics_allowed" : "atomics_not_allowed";
 }
 
+// Convert reduction mode to string
+constexpr const char* rocblas_reduction_mode_to_string(rocblas_reduction_mode mode)
+{
+    return mode == rocblas_reduction_reproducible ? "reduction_reproducible" : "reduction_default";
+}
+
+// Convert accuracy mode to string
+constexpr const char* rocblas_accuracy_mode_to_string(rocblas_accuracy_mode mode)
+{
+    return mode == rocblas_accuracy_compensated ? "accuracy_compensated" : "accuracy_default";
+}
+
+// Convert packed mode to string
+constexpr const char* rocblas_packed_mode_to_string(rocblas_packed_mode mode)
+{
+    return mode == rocblas_packed_unpack ? "packed_unpack" : "packed_default";
+}
+
 // Convert gemm flags to string
 constexpr const char* rocblas_gemm_flags_to_string(rocblas_gemm_flags)
 {
@@ -385,6 +404,42 @@ typedef struct rocblas_check_numerics_s
     bool has_Inf = false;
 } rocblas_check_numerics_t;
 
+/*********************************************************************************************************
+ * \brief Device side accumulator for rocblas_check_numerics_mode_stats. Magnitudes are kept as the bit
+ * patterns of non-negative doubles, which order the same way as the values, so that they can be
+ * updated with integer atomicMin/atomicMax.
+ *********************************************************************************************************/
+typedef struct rocblas_check_numerics_stats_device_s
+{
+    unsigned long long num_elements = 0;
+    unsigned long long num_zero     = 0;
+    unsigned long long num_denormal = 0;
+    unsigned long long num_NaN      = 0;
+    unsigned long long num_Inf      = 0;
+
+    // Bit pattern of +Inf, i.e. no finite nonzero value seen yet
+    unsigned long long min_magnitude_bits = 0x7ff0000000000000ULL;
+    unsigned long long max_magnitude_bits = 0;
+
+    unsigned long long exponent_histogram[ROCBLAS_CHECK_NUMERICS_EXPONENT_BINS] = {};
+} rocblas_check_numerics_stats_device_t;
+
+/*********************************************************************************************************
+ * \brief Device side record of rocblas_check_numerics_mode_deferred. The first check which finds a NaN
+ * or an Inf claims the record by setting 'failed' and fills in the remaining fields.
+ *********************************************************************************************************/
+typedef struct rocblas_check_numerics_deferred_s
+{
+    int         failed        = 0;
+    int         function_id   = -1;
+    int         is_input      = 0;
+    int         has_NaN       = 0;
+    int         has_Inf       = 0;
+    rocblas_int batch_index   = 0;
+    const void* operand       = nullptr;
+    int64_t     element_index = 0;
+} rocblas_check_numerics_deferred_t;
+
 /*******************************************************************************
 * \brief  returns true if arg is NaN
 ********************************************************************************/
@@ -458,6 +513,43 @@ __host__ __device__ inline bool rocblas_iszero(T arg)
     return arg == 0;
 }
 
+/*******************************************************************************
+* \brief  returns true if arg is a denormal (subnormal) number
+********************************************************************************/
+
+template <typename T, std::enable_if_t<std::is_integral<T>{}, int> = 0>
+__host__ __device__ inline bool rocblas_isdenorm(T)
+{
+    return false;
+}
+
+template <typename T, std::enable_if_t<!std::is_integral<T>{} && !is_complex<T>, int> = 0>
+__host__ __device__ inline bool rocblas_isdenorm(T arg)
+{
+    return arg != 0 && std::abs(arg) < std::numeric_limits<T>::min();
+}
+
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__host__ __device__ inline bool rocblas_isdenorm(const T& arg)
+{
+    return rocblas_isdenorm(std::real(arg)) || rocblas_isdenorm(std::imag(arg));
+}
+
+__host__ __device__ inline bool rocblas_isdenorm(rocblas_half arg)
+{
+    union
+    {
+        rocblas_half fp;
+        uint16_t     data;
+    } x = {arg};
+    return (x.data & 0x7c00) == 0 && (x.data & 0x3ff) != 0;
+}
+
+__host__ __device__ inline bool rocblas_isdenorm(rocblas_bfloat16 arg)
+{
+    return (arg.data & 0x7f80) == 0 && (arg.data & 0x7f) != 0;
+}
+
 // Absolute value
 template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
 __device__ __host__ inline T rocblas_abs(T x)
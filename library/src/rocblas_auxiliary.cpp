@@ -102,6 +102,493 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * ! \brief get reduction mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_reduction_mode(rocblas_handle          handle,
+                                                     rocblas_reduction_mode* mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->reduction_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_reduction_mode", *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set reduction mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_reduction_mode(rocblas_handle         handle,
+                                                     rocblas_reduction_mode mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(mode != rocblas_reduction_default && mode != rocblas_reduction_reproducible)
+        return rocblas_status_invalid_value;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_reduction_mode", mode);
+    handle->reduction_mode = mode;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get accuracy mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_accuracy_mode(rocblas_handle         handle,
+                                                    rocblas_accuracy_mode* mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->accuracy_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_accuracy_mode", *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set accuracy mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_accuracy_mode(rocblas_handle        handle,
+                                                    rocblas_accuracy_mode mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(mode != rocblas_accuracy_default && mode != rocblas_accuracy_compensated)
+        return rocblas_status_invalid_value;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_accuracy_mode", mode);
+    handle->accuracy_mode = mode;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set trsv inverse cache size
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_trsv_inverse_cache_size(rocblas_handle handle, size_t size)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_trsv_inverse_cache_size", size);
+    handle->trsv_inverse_cache.clear();
+    handle->trsv_inverse_cache.size = size;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get trsv inverse cache size
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_trsv_inverse_cache_size(rocblas_handle handle, size_t* size)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    *size = handle->trsv_inverse_cache.size;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_trsv_inverse_cache_size", *size);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set trsv inverse cache version
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_trsv_inverse_cache_version(rocblas_handle handle,
+                                                                 int64_t        version)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_trsv_inverse_cache_version", version);
+    handle->trsv_inverse_cache.version = version;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set trsm inverse cache size
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_trsm_inverse_cache_size(rocblas_handle handle, size_t size)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_trsm_inverse_cache_size", size);
+    handle->trsm_inverse_cache.clear();
+    handle->trsm_inverse_cache.size = size;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get trsm inverse cache size
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_trsm_inverse_cache_size(rocblas_handle handle, size_t* size)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    *size = handle->trsm_inverse_cache.size;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_trsm_inverse_cache_size", *size);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set trsm inverse cache version
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_trsm_inverse_cache_version(rocblas_handle handle,
+                                                                 int64_t        version)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_trsm_inverse_cache_version", version);
+    handle->trsm_inverse_cache.version = version;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief free the trsm inverses cached for a matrix
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_clear_trsm_inverse_cache(rocblas_handle handle, const void* A)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_clear_trsm_inverse_cache", A);
+    handle->trsm_inverse_cache.clear(A);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get packed mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_packed_mode(rocblas_handle handle, rocblas_packed_mode* mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->packed_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_packed_mode", *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set packed mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_packed_mode(rocblas_handle handle, rocblas_packed_mode mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(mode != rocblas_packed_default && mode != rocblas_packed_unpack)
+        return rocblas_status_invalid_value;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_packed_mode", mode);
+    handle->packed_mode = mode;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set packed unpack cache size
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_packed_unpack_cache_size(rocblas_handle handle, size_t size)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_packed_unpack_cache_size", size);
+    handle->packed_unpack_cache.clear();
+    handle->packed_unpack_cache.size = size;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get packed unpack cache size
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_packed_unpack_cache_size(rocblas_handle handle, size_t* size)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    *size = handle->packed_unpack_cache.size;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_packed_unpack_cache_size", *size);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set packed unpack cache version
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_packed_unpack_cache_version(rocblas_handle handle,
+                                                                  int64_t        version)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_packed_unpack_cache_version", version);
+    handle->packed_unpack_cache.version = version;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get check numerics mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_check_numerics_mode(rocblas_handle               handle,
+                                                          rocblas_check_numerics_mode* mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->check_numerics;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_check_numerics_mode", *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set check numerics mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_check_numerics_mode(rocblas_handle              handle,
+                                                          rocblas_check_numerics_mode mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_check_numerics_mode", mode);
+    handle->check_numerics = mode;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get the statistics gathered by rocblas_check_numerics_mode_stats
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_check_numerics_stats(rocblas_handle                handle,
+                                                           const char*                   function_name,
+                                                           bool                          is_input,
+                                                           rocblas_check_numerics_stats* stats)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!function_name || !stats)
+        return rocblas_status_invalid_pointer;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_check_numerics_stats", function_name, is_input);
+
+    auto it = handle->check_numerics_stats.find(std::make_pair(std::string(function_name), is_input));
+    if(it != handle->check_numerics_stats.end())
+        *stats = it->second;
+    else
+        *stats = rocblas_check_numerics_stats{};
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief clear the statistics gathered by rocblas_check_numerics_mode_stats
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_reset_check_numerics_stats(rocblas_handle handle)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_reset_check_numerics_stats");
+    handle->check_numerics_stats.clear();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief poll for a NaN or an Inf found by rocblas_check_numerics_mode_deferred
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_check_numerics_poll(rocblas_handle                 handle,
+                                                      rocblas_check_numerics_report* report)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_check_numerics_poll");
+
+    if(report)
+        *report = rocblas_check_numerics_report{};
+
+    // Nothing has been checked in deferred mode yet
+    if(!handle->check_numerics_deferred_device)
+        return rocblas_status_success;
+
+    // The host mirror is only consistent once the last queued readback has completed
+    hipError_t hip_status = hipEventQuery(handle->check_numerics_deferred_event);
+    if(hip_status == hipErrorNotReady)
+        return rocblas_status_continue;
+    RETURN_IF_HIP_ERROR(hip_status);
+
+    const rocblas_check_numerics_deferred_t& deferred = *handle->check_numerics_deferred_host;
+    if(!deferred.failed)
+        return rocblas_status_success;
+
+    const char* function_name = handle->get_check_numerics_function_name(deferred.function_id);
+    if(report)
+    {
+        report->function_name = function_name;
+        report->is_input      = deferred.is_input;
+        report->has_NaN       = deferred.has_NaN;
+        report->has_Inf       = deferred.has_Inf;
+        report->operand       = deferred.operand;
+        report->batch_index   = deferred.batch_index;
+        report->element_index = deferred.element_index;
+    }
+
+    if(handle->check_numerics & (rocblas_check_numerics_mode_info | rocblas_check_numerics_mode_warn))
+    {
+        rocblas_cerr << "Funtion name:\t" << (function_name ? function_name : "unknown")
+                     << (deferred.is_input ? " :- Input :\t" : " :- Output :\t") << " has_NaN "
+                     << bool(deferred.has_NaN) << " has_Inf " << bool(deferred.has_Inf)
+                     << " batch_index " << deferred.batch_index << " element_index "
+                     << deferred.element_index << std::endl;
+    }
+
+    // Clear the failure so that the next poll reports the next one
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(handle->check_numerics_deferred_device,
+                                       0,
+                                       sizeof(rocblas_check_numerics_deferred_t),
+                                       handle->get_stream()));
+    *handle->check_numerics_deferred_host = rocblas_check_numerics_deferred_t{};
+
+    return rocblas_status_check_numerics_fail;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * ! \brief query the preferable supported int8 input layout for gemm by device
  ******************************************************************************/
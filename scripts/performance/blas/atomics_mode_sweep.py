@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Measure the cost of rocblas_atomics_not_allowed for the level-2 functions.
+
+Times every level-2 function with rocblas-bench over a list of sizes n, once with the default
+rocblas_atomics_allowed and once with --atomics_not_allowed, and prints both timings with the
+relative change. Level-2 functions reduce in a fixed order in both modes, so the change is
+expected to be within noise except for gemv_grouped, whose blocks take their tiles in a fixed
+round robin order instead of from an atomic counter when atomics are not allowed.
+
+Example:
+    ./atomics_mode_sweep.py -f gemv,symv,gemv_grouped -r s,d -n 1024,8192
+"""
+
+import sys
+
+from benchsweep import bench, int_list, parser
+
+# rocblas-bench arguments of each function for a size n
+SIZES = {
+    'gemv': lambda n: ['-m', n, '-n', n, '--lda', n],
+    'gemv_grouped': lambda n: ['-m', n, '-n', n, '--lda', n],
+    'gbmv': lambda n: ['-m', n, '-n', n, '--kl', '32', '--ku', '32', '--lda', '65'],
+    'ger': lambda n: ['-m', n, '-n', n, '--lda', n],
+    'geru': lambda n: ['-m', n, '-n', n, '--lda', n],
+    'gerc': lambda n: ['-m', n, '-n', n, '--lda', n],
+    'symv': lambda n: ['-n', n, '--lda', n],
+    'hemv': lambda n: ['-n', n, '--lda', n],
+    'sbmv': lambda n: ['-n', n, '-k', '64', '--lda', '65'],
+    'hbmv': lambda n: ['-n', n, '-k', '64', '--lda', '65'],
+    'spmv': lambda n: ['-n', n],
+    'hpmv': lambda n: ['-n', n],
+    'syr': lambda n: ['-n', n, '--lda', n],
+    'her': lambda n: ['-n', n, '--lda', n],
+    'syr2': lambda n: ['-n', n, '--lda', n],
+    'her2': lambda n: ['-n', n, '--lda', n],
+    'spr': lambda n: ['-n', n],
+    'hpr': lambda n: ['-n', n],
+    'spr2': lambda n: ['-n', n],
+    'hpr2': lambda n: ['-n', n],
+    'trmv': lambda n: ['-m', n, '--lda', n],
+    'tbmv': lambda n: ['-m', n, '-k', '64', '--lda', '65'],
+    'tpmv': lambda n: ['-m', n],
+    'trsv': lambda n: ['-m', n, '--lda', n],
+    'tbsv': lambda n: ['-n', n, '-k', '64', '--lda', '65'],
+    'tpsv': lambda n: ['-n', n],
+}
+
+COMPLEX_ONLY = {'geru', 'gerc', 'hemv', 'hbmv', 'hpmv', 'her', 'her2', 'hpr', 'hpr2'}
+REAL_ONLY = {'ger'}
+
+
+def bench_mode(args, atomics_not_allowed, function, precision, n):
+    '''Returns the rocblas-Gflops of one run, or None when rocblas-bench fails.'''
+    bench_args = ['-f', function, '-r', precision, *SIZES[function](str(n)),
+                  '--batch_count', args.batch_count]
+    if atomics_not_allowed:
+        bench_args.append('--atomics_not_allowed')
+    return bench(args, bench_args)
+
+
+def main():
+    options = parser(__doc__)
+    options.add_argument('-f', '--functions', default=','.join(SIZES),
+                         help='comma separated level-2 functions')
+    options.add_argument('-n', default='256,1024,4096', type=int_list)
+    options.add_argument('--batch_count', default=1, type=int,
+                         help='number of problems of gemv_grouped, ignored by other functions')
+    args = options.parse_args()
+
+    print('function precision n allowed_gflops not_allowed_gflops change_percent')
+    for function in args.functions.split(','):
+        if function not in SIZES:
+            print('unknown function {}'.format(function), file=sys.stderr)
+            continue
+        for precision in args.precisions.split(','):
+            if function in COMPLEX_ONLY and precision in ('s', 'd'):
+                continue
+            if function in REAL_ONLY and precision in ('c', 'z'):
+                continue
+            for n in args.n:
+                allowed = bench_mode(args, False, function, precision, n)
+                not_allowed = bench_mode(args, True, function, precision, n)
+                if allowed is None or not_allowed is None:
+                    continue
+                print('{} {} {} {:.1f} {:.1f} {:+.1f}'.format(
+                    function, precision, n, allowed, not_allowed,
+                    100 * (not_allowed - allowed) / allowed))
+
+
+if __name__ == '__main__':
+    main()
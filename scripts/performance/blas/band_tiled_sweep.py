@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""Measure the crossover between the band-tiled and the per-row banded kernels.
+
+Times gbmv, sbmv, hbmv and tbmv with rocblas-bench over a grid of sizes n and bandwidths k, once
+with ROCBLAS_BAND_TILED_MIN_BANDWIDTH=1 so that the band-tiled kernels always run and once with
+a bandwidth larger than any of the grid so that they never run. Prints both timings of each grid
+point and, for each function, precision, operation and n, the smallest k from which the
+band-tiled kernels stay faster. gbmv uses kl = ku = k / 2.
+
+Example:
+    ./band_tiled_sweep.py -f gbmv,sbmv -r s,d -n 1024,8192 -k 4,16,32,64,128
+    export ROCBLAS_BAND_TILED_MIN_BANDWIDTH=48
+"""
+
+from benchsweep import NEVER, Crossover, batched_name, bench, int_list, parser
+
+# operations and triangles swept by each function
+SHAPES = {
+    'gbmv': [('--transposeA', 'N'), ('--transposeA', 'T')],
+    'sbmv': [('--uplo', 'U'), ('--uplo', 'L')],
+    'hbmv': [('--uplo', 'U'), ('--uplo', 'L')],
+    'tbmv': [('--transposeA', 'N'), ('--transposeA', 'T')],
+}
+
+COMPLEX_ONLY = {'hbmv'}
+
+
+def size_args(function, n, k):
+    if function == 'gbmv':
+        kl = k // 2
+        ku = k - kl
+        return ['-m', str(n), '-n', str(n), '--kl', str(kl), '--ku', str(ku),
+                '--lda', str(kl + ku + 1)]
+    if function == 'tbmv':
+        return ['-m', str(n), '-k', str(k), '--lda', str(k + 1)]
+    return ['-n', str(n), '-k', str(k), '--lda', str(k + 1)]
+
+
+def bench_bandwidth(args, min_bandwidth, function, precision, shape, n, k):
+    '''Returns the rocblas-Gflops of one run, or None when rocblas-bench fails.'''
+    return bench(args, ['-f', batched_name(function, args.batch_count), '-r', precision, *shape,
+                        *size_args(function, n, k), '--batch_count', args.batch_count],
+                 {'ROCBLAS_BAND_TILED_MIN_BANDWIDTH': min_bandwidth})
+
+
+def main():
+    options = parser(__doc__)
+    options.add_argument('-f', '--functions', default='gbmv,sbmv,hbmv,tbmv',
+                         help='comma separated of gbmv, sbmv, hbmv and tbmv')
+    options.add_argument('-n', default='256,1024,4096,16384', type=int_list)
+    options.add_argument('-k', default='1,4,8,16,24,32,48,64,128,256', type=int_list)
+    options.add_argument('--batch_count', default=1, type=int)
+    args = options.parse_args()
+
+    print('function precision shape n k per_row_gflops tiled_gflops')
+    for function in args.functions.split(','):
+        for precision in args.precisions.split(','):
+            if function in COMPLEX_ONLY and precision in ('s', 'd'):
+                continue
+            for shape in SHAPES[function]:
+                for n in args.n:
+                    crossover = Crossover()
+                    for k in args.k:
+                        if k >= n:
+                            break
+                        per_row = bench_bandwidth(args, NEVER, function, precision, shape, n, k)
+                        tiled = bench_bandwidth(args, 1, function, precision, shape, n, k)
+                        if per_row is None or tiled is None:
+                            continue
+                        print('{} {} {} {} {} {:.1f} {:.1f}'.format(
+                            function, precision, shape[1], n, k, per_row, tiled))
+                        crossover.add(k, per_row, tiled)
+                    # rocblas_band_tiled_min_bandwidth compares kl + ku + 1, which is k + 1
+                    bandwidth = 'none' if crossover.value is None else str(crossover.value + 1)
+                    print('# {} {} {} n={}: band-tiled from bandwidth {}'.format(
+                        function, precision, shape[1], n, bandwidth))
+
+
+if __name__ == '__main__':
+    main()
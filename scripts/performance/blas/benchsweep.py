@@ -0,0 +1,80 @@
+"""Shared helpers of the *_sweep.py scripts.
+
+The sweep scripts time rocblas-bench over a grid of problems under different settings of the
+environment variables of the library, and only define their grid, their environment variables
+and how the results are reported. This module runs rocblas-bench and parses its output, holds
+the command line options common to all sweeps, and tracks crossover points.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+# a threshold no grid point reaches, to keep a path from ever running
+NEVER = 1 << 30
+
+
+def bench(args, bench_args, env=None):
+    '''Returns the rocblas-Gflops of one rocblas-bench run, or None when rocblas-bench fails.
+
+    bench_args are the rocblas-bench arguments of the problem, the iteration counts are taken
+    from args. env holds the environment variables set for the run on top of os.environ.
+    '''
+    cmd = [args.bench, *[str(arg) for arg in bench_args], '-i', str(args.iters), '-j',
+           str(args.cold_iters)]
+    run_env = dict(os.environ, **{name: str(value) for name, value in (env or {}).items()})
+    try:
+        out = subprocess.run(cmd, env=run_env, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL,
+                             universal_newlines=True, check=True).stdout
+    except (subprocess.CalledProcessError, FileNotFoundError) as err:
+        print('{}: {}'.format(' '.join(cmd), err), file=sys.stderr)
+        return None
+
+    lines = out.splitlines()
+    for i, line in enumerate(lines[:-1]):
+        names = line.split(',')
+        if 'rocblas-Gflops' in names:
+            return float(lines[i + 1].split(',')[names.index('rocblas-Gflops')])
+    return None
+
+
+def batched_name(function, batch_count):
+    '''The rocblas-bench function timing batch_count problems of function.'''
+    return function if batch_count == 1 else function + '_strided_batched'
+
+
+def int_list(text):
+    '''Sorted unique integers of a comma separated list.'''
+    return sorted({int(v) for v in text.split(',')})
+
+
+def parser(doc, iters=20):
+    '''An argument parser with the rocblas-bench options common to all sweeps.'''
+    result = argparse.ArgumentParser(description=doc,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    result.add_argument('--bench', default='./rocblas-bench', help='rocblas-bench executable')
+    result.add_argument('-r', '--precisions', default='s,d,c,z',
+                        help='comma separated rocblas-bench precisions')
+    result.add_argument('-i', '--iters', default=iters, type=int)
+    result.add_argument('-j', '--cold_iters', default=2, type=int)
+    return result
+
+
+class Crossover:
+    '''Smallest grid value from which a candidate path stays at least as fast as a baseline.
+
+    Values are added in increasing order; a slower candidate resets the crossover.
+    '''
+
+    def __init__(self):
+        self.value = None
+
+    def add(self, value, baseline_gflops, candidate_gflops):
+        if candidate_gflops < baseline_gflops:
+            self.value = None
+        elif self.value is None:
+            self.value = value
+
+    def __str__(self):
+        return 'none' if self.value is None else str(self.value)
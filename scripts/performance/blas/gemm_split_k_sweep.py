@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""Measure the crossover k from which gemm splits k across workgroups.
+
+Times gemm with rocblas-bench over a grid of sizes m = n and depths k, once with
+ROCBLAS_GEMM_SPLIT_K_MIN_K=1 so that k is split whenever it is at least 16 times m and n and the
+tiles of C occupy at most half of the compute units, and once with a k larger than any of the grid
+so that it is never split. Prints both timings of each grid point and, for each precision,
+operation and m, the smallest k from which splitting stays faster.
+
+Example:
+    ./gemm_split_k_sweep.py -r s,d -m 16,64,128 -k 2048,4096,8192,16384,65536
+    export ROCBLAS_GEMM_SPLIT_K_MIN_K=4096
+"""
+
+from benchsweep import NEVER, Crossover, bench, int_list, parser
+
+TRANSPOSES = ['NN', 'NT', 'TN', 'TT']
+
+
+def bench_min_k(args, min_k, precision, transpose, m, k):
+    '''Returns the rocblas-Gflops of one run, or None when rocblas-bench fails.'''
+    lda = m if transpose[0] == 'N' else k
+    ldb = k if transpose[1] == 'N' else m
+    return bench(args, ['-f', 'gemm', '-r', precision, '--transposeA', transpose[0],
+                        '--transposeB', transpose[1], '-m', m, '-n', m, '-k', k, '--lda', lda,
+                        '--ldb', ldb, '--ldc', m],
+                 {'ROCBLAS_GEMM_SPLIT_K_MIN_K': min_k})
+
+
+def main():
+    options = parser(__doc__)
+    options.add_argument('-t', '--transposes', default='NN,TN',
+                         help='comma separated of NN, NT, TN and TT')
+    options.add_argument('-m', default='16,32,64,128,256', type=int_list)
+    options.add_argument('-k', default='1024,2048,4096,8192,16384,32768,65536,131072',
+                         type=int_list)
+    args = options.parse_args()
+
+    print('precision transpose m k unsplit_gflops split_gflops')
+    for precision in args.precisions.split(','):
+        for transpose in [t for t in args.transposes.split(',') if t in TRANSPOSES]:
+            for m in args.m:
+                crossover = Crossover()
+                for k in args.k:
+                    unsplit = bench_min_k(args, NEVER, precision, transpose, m, k)
+                    split = bench_min_k(args, 1, precision, transpose, m, k)
+                    if unsplit is None or split is None:
+                        continue
+                    print('{} {} {} {} {:.1f} {:.1f}'.format(precision, transpose, m, k, unsplit,
+                                                             split))
+                    crossover.add(k, unsplit, split)
+                print('# {} {} m=n={}: split from k {}'.format(precision, transpose, m, crossover))
+
+
+if __name__ == '__main__':
+    main()
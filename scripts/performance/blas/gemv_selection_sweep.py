@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""Regenerate the gemv kernel selection table for one architecture.
+
+Times every gemv kernel variant with rocblas-bench over a grid of precisions, operations, sizes
+and batch counts, and writes the fastest variant of each grid point as a rule in the format read
+through ROCBLAS_GEMV_SELECTION_TABLE (see library/src/blas2/rocblas_gemv_selection.hpp). Each
+variant is forced by pointing ROCBLAS_GEMV_SELECTION_TABLE at a one-rule table while it is timed.
+The bounds of a rule reach halfway to the neighbouring grid points, in geometric mean.
+
+Example:
+    ./gemv_selection_sweep.py --arch 908 -o gemv_gfx908.txt
+    export ROCBLAS_GEMV_SELECTION_TABLE=$PWD/gemv_gfx908.txt
+"""
+
+import math
+import os
+import tempfile
+
+from benchsweep import batched_name, bench, int_list, parser
+
+VARIANTS = {
+    'N': ['gemvn_64x4', 'gemvn_32x16', 'gemvn_64x16'],
+    'T': ['gemvt_sm', 'gemvt_sn', 'gemvt_256', 'gemvt_1024'],
+}
+VARIANTS['C'] = VARIANTS['T']
+
+PRECISIONS = {'s': 'f32_r', 'd': 'f64_r', 'c': 'f32_c', 'z': 'f64_c'}
+
+# rocblas_gemvt_sn_crossover
+SN_CROSSOVER = {'s': 256, 'd': 128, 'c': 64, 'z': 16}
+
+
+def applicable(variant, precision, op, m, n):
+    '''Mirrors the applicability checks of rocblas_gemv_select_variant.'''
+    if variant == 'gemvt_sm':
+        return m <= 64
+    if variant == 'gemvt_sn':
+        return n < SN_CROSSOVER[precision] and m >= 2048 * n
+    return True
+
+
+def bench_variant(args, variant, precision, op, m, n, batch_count):
+    '''Returns the rocblas-Gflops of one variant, or None when rocblas-bench fails.'''
+    with tempfile.NamedTemporaryFile(mode='w', suffix='.txt', delete=False) as table:
+        table.write('* * * * * * * * * * {}\n'.format(variant))
+    try:
+        return bench(args, ['-f', batched_name('gemv', batch_count), '-r', precision,
+                            '--transposeA', op, '-m', m, '-n', n, '--lda', m,
+                            '--batch_count', batch_count],
+                     {'ROCBLAS_GEMV_SELECTION_TABLE': table.name})
+    finally:
+        os.unlink(table.name)
+
+
+def bounds(values, i):
+    '''Inclusive bounds of grid point i, '*' at the ends of the grid.'''
+    low = '*' if i == 0 else str(int(math.sqrt(values[i - 1] * values[i])) + 1)
+    high = '*' if i == len(values) - 1 else str(int(math.sqrt(values[i] * values[i + 1])))
+    return low, high
+
+
+def main():
+    options = parser(__doc__)
+    options.add_argument('--arch', type=int, required=True,
+                         help='gcnArch the table is for, e.g. 906 or 908')
+    options.add_argument('-o', '--output', required=True, help='table file to write')
+    options.add_argument('--operations', default='N,T,C', help='comma separated of N, T and C')
+    options.add_argument('-m', default='16,64,256,1024,4096,16384,65536', type=int_list)
+    options.add_argument('-n', default='16,64,256,1024,4096,16384', type=int_list)
+    options.add_argument('--batch_count', default='1', type=int_list)
+    args = options.parse_args()
+
+    rules = []
+    for precision in args.precisions.split(','):
+        for op in args.operations.split(','):
+            for bi, batch_count in enumerate(args.batch_count):
+                for mi, m in enumerate(args.m):
+                    for ni, n in enumerate(args.n):
+                        timings = {}
+                        for variant in VARIANTS[op]:
+                            if applicable(variant, precision, op, m, n):
+                                gflops = bench_variant(args, variant, precision, op, m, n,
+                                                       batch_count)
+                                if gflops is not None:
+                                    timings[variant] = gflops
+                        if not timings:
+                            continue
+                        best = max(timings, key=timings.get)
+                        print('{} {} m={} n={} batch_count={}: {} {:.1f} Gflops'.format(
+                            precision, op, m, n, batch_count, best, timings[best]))
+                        rules.append([str(args.arch), PRECISIONS[precision], op,
+                                      *bounds(args.m, mi), *bounds(args.n, ni),
+                                      *bounds(args.batch_count, bi), '*', best])
+
+    with open(args.output, 'w') as table:
+        table.write('# gemv selection table for gfx{} generated by {}\n'.format(
+            args.arch, os.path.basename(__file__)))
+        table.write('# arch precisions ops m_min m_max n_min n_max batch_min batch_max'
+                    ' m_over_n variant\n')
+        for rule in rules:
+            table.write(' '.join(rule) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Measure the crossover between the tiled symm and hemm kernel and gemm on a symmetrized A.
+
+Times symm and hemm with rocblas-bench over a grid of sizes, with m and n equal, once with
+ROCBLAS_SYMM_HEMM_GEMM_MIN_SIZE set to 1 so that A is always copied to a full matrix and
+multiplied with gemm, and once with a size larger than any of the grid so that the tiled kernel
+always runs. Prints both timings of each grid point and, for each function, precision and side,
+the smallest size from which the gemm path stays faster.
+
+Example:
+    ./symm_hemm_gemm_sweep.py -f symm,hemm -r s,c -n 128,256,512,1024,2048
+    export ROCBLAS_SYMM_HEMM_GEMM_MIN_SIZE=384
+"""
+
+from benchsweep import NEVER, Crossover, batched_name, bench, int_list, parser
+
+COMPLEX_ONLY = {'hemm'}
+
+
+def bench_min_size(args, min_size, function, precision, side, n):
+    '''Returns the rocblas-Gflops of one run, or None when rocblas-bench fails.'''
+    return bench(args, ['-f', batched_name(function, args.batch_count), '-r', precision,
+                        '--side', side, '--uplo', args.uplo, '-m', n, '-n', n, '--lda', n,
+                        '--ldb', n, '--ldc', n, '--batch_count', args.batch_count],
+                 {'ROCBLAS_SYMM_HEMM_GEMM_MIN_SIZE': min_size})
+
+
+def main():
+    options = parser(__doc__, iters=10)
+    options.add_argument('-f', '--functions', default='symm,hemm',
+                         help='comma separated of symm and hemm')
+    options.add_argument('-n', default='64,128,192,256,384,512,768,1024,2048,4096',
+                         type=int_list, help='comma separated sizes m = n')
+    options.add_argument('--uplo', default='U', choices=['U', 'L'])
+    options.add_argument('--batch_count', default=1, type=int)
+    args = options.parse_args()
+
+    print('function precision side n kernel_gflops gemm_gflops')
+    for function in args.functions.split(','):
+        for precision in args.precisions.split(','):
+            if function in COMPLEX_ONLY and precision in ('s', 'd'):
+                continue
+            for side in ['L', 'R']:
+                crossover = Crossover()
+                for n in args.n:
+                    kernel = bench_min_size(args, NEVER, function, precision, side, n)
+                    gemm = bench_min_size(args, 1, function, precision, side, n)
+                    if kernel is None or gemm is None:
+                        continue
+                    print('{} {} {} {} {:.1f} {:.1f}'.format(
+                        function, precision, side, n, kernel, gemm))
+                    crossover.add(n, kernel, gemm)
+                print('# {} {} {}: gemm from size {}'.format(function, precision, side, crossover))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""Measure the crossover between the syrk and herk kernels and their gemm decomposition.
+
+Times syrk, herk, syr2k and her2k with rocblas-bench over a grid of sizes n and k, once with
+ROCBLAS_SYRK_HERK_GEMM_MIN_N and ROCBLAS_SYRK_HERK_GEMM_MIN_K set to 1 so that every n larger
+than the diagonal block of 256 is decomposed into gemm calls, and once with a size larger than
+any of the grid so that the kernels always run. Prints both timings of each grid point and, for
+each function, precision, operation and k, the smallest n from which the gemm decomposition
+stays faster.
+
+Example:
+    ./syrk_herk_gemm_sweep.py -f syrk,herk -r s,c -n 512,1024,2048,4096 -k 32,128,512
+    export ROCBLAS_SYRK_HERK_GEMM_MIN_N=1536 ROCBLAS_SYRK_HERK_GEMM_MIN_K=64
+"""
+
+from benchsweep import NEVER, Crossover, batched_name, bench, int_list, parser
+
+# diagonal blocks of rocblas_syrk_herk_gemm_nb() are always left to the kernels
+NB = 256
+
+COMPLEX_ONLY = {'herk', 'her2k'}
+
+TWO_MATRICES = {'syr2k', 'her2k'}
+
+
+def size_args(function, n, k, transpose):
+    lda = n if transpose == 'N' else k
+    args = ['-n', str(n), '-k', str(k), '--lda', str(lda), '--ldc', str(n)]
+    if function in TWO_MATRICES:
+        args += ['--ldb', str(lda)]
+    return args
+
+
+def bench_min_size(args, min_size, function, precision, transpose, n, k):
+    '''Returns the rocblas-Gflops of one run, or None when rocblas-bench fails.'''
+    return bench(args, ['-f', batched_name(function, args.batch_count), '-r', precision,
+                        '--uplo', args.uplo, '--transposeA', transpose,
+                        *size_args(function, n, k, transpose), '--batch_count', args.batch_count],
+                 {'ROCBLAS_SYRK_HERK_GEMM_MIN_N': min_size,
+                  'ROCBLAS_SYRK_HERK_GEMM_MIN_K': min_size})
+
+
+def main():
+    options = parser(__doc__, iters=10)
+    options.add_argument('-f', '--functions', default='syrk,herk,syr2k,her2k',
+                         help='comma separated of syrk, herk, syr2k and her2k')
+    options.add_argument('-n', default='384,512,768,1024,1536,2048,4096,8192', type=int_list)
+    options.add_argument('-k', default='16,32,64,128,256,512,1024', type=int_list)
+    options.add_argument('--uplo', default='U', choices=['U', 'L'])
+    options.add_argument('--batch_count', default=1, type=int)
+    args = options.parse_args()
+
+    print('function precision transpose n k kernel_gflops gemm_gflops')
+    for function in args.functions.split(','):
+        for precision in args.precisions.split(','):
+            if function in COMPLEX_ONLY and precision in ('s', 'd'):
+                continue
+            transposes = ['N', 'C' if function in COMPLEX_ONLY else 'T']
+            for transpose in transposes:
+                for k in args.k:
+                    crossover = Crossover()
+                    for n in args.n:
+                        if n <= NB:
+                            continue
+                        kernel = bench_min_size(args, NEVER, function, precision, transpose, n, k)
+                        gemm = bench_min_size(args, 1, function, precision, transpose, n, k)
+                        if kernel is None or gemm is None:
+                            continue
+                        print('{} {} {} {} {} {:.1f} {:.1f}'.format(
+                            function, precision, transpose, n, k, kernel, gemm))
+                        crossover.add(n, kernel, gemm)
+                    print('# {} {} {} k={}: gemm decomposition from n {}'.format(
+                        function, precision, transpose, k, crossover))
+
+
+if __name__ == '__main__':
+    main()
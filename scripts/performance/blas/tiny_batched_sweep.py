@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Measure the crossover between the tiny batched and the per-problem kernels.
+
+Times the strided_batched gemv, trmv, trsv, ger, trsm and trtri with rocblas-bench over a grid of
+sizes n and batch counts, once with ROCBLAS_TINY_BATCHED_MIN_BATCH_COUNT=1 so that the tiny
+batched kernels always run, for n <= 64 in level 2 and n <= 32 in trsm and trtri, and once with a
+batch count larger than any of the grid so that they never run. Prints both timings of each grid
+point and, for each function, precision, operation and n, the smallest batch count from which
+the tiny batched kernels stay faster.
+
+Example:
+    ./tiny_batched_sweep.py -f gemv,trsv -r s,d -n 4,16,64 -b 256,4096,65536,262144
+    ./tiny_batched_sweep.py -f trsm,trtri -r s,z -n 2,8,16,32 -b 1024,65536,1048576
+    export ROCBLAS_TINY_BATCHED_MIN_BATCH_COUNT=4096
+"""
+
+from benchsweep import NEVER, Crossover, bench, int_list, parser
+
+# operations swept by each function
+SHAPES = {
+    'gemv': [('--transposeA', 'N'), ('--transposeA', 'T')],
+    'trmv': [('--transposeA', 'N'), ('--transposeA', 'T')],
+    'trsv': [('--transposeA', 'N'), ('--transposeA', 'T')],
+    'ger': [],
+    'trsm': [('--side', 'L', '--transposeA', 'N'), ('--side', 'L', '--transposeA', 'T'),
+             ('--side', 'R', '--transposeA', 'N'), ('--side', 'R', '--transposeA', 'T')],
+    'trtri': [('--uplo', 'L'), ('--uplo', 'U')],
+}
+
+# largest n of the tiny batched kernels of each function
+MAX_N = {'trsm': 32, 'trtri': 32}
+
+
+def size_args(function, n):
+    if function in ('gemv', 'ger'):
+        return ['-m', str(n), '-n', str(n), '--lda', str(n)]
+    if function == 'trsm':
+        return ['-m', str(n), '-n', str(n), '--lda', str(n), '--ldb', str(n)]
+    if function == 'trtri':
+        return ['-n', str(n), '--lda', str(n)]
+    return ['-m', str(n), '--lda', str(n)]
+
+
+def bench_min_batch_count(args, min_batch_count, function, precision, shape, n, batch_count):
+    '''Returns the rocblas-Gflops of one run, or None when rocblas-bench fails.'''
+    return bench(args, ['-f', function + '_strided_batched', '-r', precision, *shape,
+                        *size_args(function, n), '--batch_count', batch_count],
+                 {'ROCBLAS_TINY_BATCHED_MIN_BATCH_COUNT': min_batch_count})
+
+
+def main():
+    options = parser(__doc__)
+    options.add_argument('-f', '--functions', default='gemv,trmv,trsv,ger,trsm,trtri',
+                         help='comma separated of gemv, trmv, trsv, ger, trsm and trtri')
+    options.add_argument('-n', default='4,8,16,32,64', type=int_list)
+    options.add_argument('-b', '--batch_counts', default='64,256,1024,4096,16384,65536,262144',
+                         type=int_list)
+    args = options.parse_args()
+
+    print('function precision shape n batch_count per_problem_gflops tiny_gflops')
+    for function in args.functions.split(','):
+        for precision in args.precisions.split(','):
+            if function == 'ger' and precision in ('c', 'z'):
+                continue
+            for shape in SHAPES[function] or [()]:
+                label = ''.join(shape[1::2]) if shape else '-'
+                for n in [n for n in args.n if n <= MAX_N.get(function, n)]:
+                    crossover = Crossover()
+                    for batch_count in args.batch_counts:
+                        per_problem = bench_min_batch_count(args, NEVER, function, precision,
+                                                            shape, n, batch_count)
+                        tiny = bench_min_batch_count(args, 1, function, precision, shape, n,
+                                                     batch_count)
+                        if per_problem is None or tiny is None:
+                            continue
+                        print('{} {} {} {} {} {:.1f} {:.1f}'.format(
+                            function, precision, label, n, batch_count, per_problem, tiny))
+                        crossover.add(batch_count, per_problem, tiny)
+                    print('# {} {} {} n={}: tiny batched from batch_count {}'.format(
+                        function, precision, label, n, crossover))
+
+
+if __name__ == '__main__':
+    main()